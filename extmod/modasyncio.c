@@ -28,6 +28,8 @@
 #include "py/smallint.h"
 #include "py/pairheap.h"
 #include "py/mphal.h"
+// CIRCUITPY-CHANGE
+#include "extmod/modasyncio.h"
 
 #if MICROPY_PY_ASYNCIO
 
@@ -326,6 +328,20 @@ STATIC mp_obj_t task_iternext(mp_obj_t self_in) {
     return mp_const_none;
 }
 
+// CIRCUITPY-CHANGE
+bool mp_asyncio_reschedule_current_task(void) {
+    if (asyncio_context == MP_OBJ_NULL) {
+        return false;
+    }
+    mp_obj_t cur_task = mp_obj_dict_get(asyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR_cur_task));
+    if (!mp_obj_is_type(cur_task, &task_type)) {
+        return false;
+    }
+    mp_obj_t args[2] = { mp_obj_dict_get(asyncio_context, MP_OBJ_NEW_QSTR(MP_QSTR__task_queue)), cur_task };
+    task_queue_push(2, args);
+    return true;
+}
+
 STATIC const mp_getiter_iternext_custom_t task_getiter_iternext = {
     .getiter = task_getiter,
     .iternext = task_iternext,
@@ -25,13 +25,19 @@
  */
 
 #include <stdio.h>
+// CIRCUITPY-CHANGE
+#include <string.h>
 
 #include "py/binary.h"
 #include "py/objarray.h"
 #include "py/objlist.h"
+// CIRCUITPY-CHANGE
+#include "py/objstr.h"
 #include "py/objstringio.h"
 #include "py/parsenum.h"
 #include "py/runtime.h"
+// CIRCUITPY-CHANGE
+#include "py/stackctrl.h"
 #include "py/stream.h"
 
 #if MICROPY_PY_JSON
@@ -187,49 +193,101 @@ STATIC mp_uint_t json_python_readinto(mp_obj_t obj, void *buf, mp_uint_t size, i
     return 1;
 }
 
-STATIC mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
+// CIRCUITPY-CHANGE: stream setup, string parsing and value parsing are split
+// out of _mod_json_load so that json.select() can share them.
+STATIC void json_stream_init(json_stream_t *s, mp_obj_t stream_obj, uint8_t *character_buffer) {
     const mp_stream_p_t *stream_p = mp_proto_get(0, stream_obj);
-    json_stream_t s;
-    uint8_t character_buffer[CIRCUITPY_JSON_READ_CHUNK_SIZE];
     if (stream_p == NULL) {
-        s.start = 0;
-        s.end = 0;
-        mp_load_method(stream_obj, MP_QSTR_readinto, s.python_readinto);
-        s.bytearray_obj.base.type = &mp_type_bytearray;
-        s.bytearray_obj.typecode = BYTEARRAY_TYPECODE;
-        s.bytearray_obj.len = CIRCUITPY_JSON_READ_CHUNK_SIZE;
-        s.bytearray_obj.free = 0;
-        s.bytearray_obj.items = character_buffer;
-        s.python_readinto[2] = MP_OBJ_FROM_PTR(&s.bytearray_obj);
-        s.stream_obj = &s;
-        s.read = json_python_readinto;
+        s->start = 0;
+        s->end = 0;
+        mp_load_method(stream_obj, MP_QSTR_readinto, s->python_readinto);
+        s->bytearray_obj.base.type = &mp_type_bytearray;
+        s->bytearray_obj.typecode = BYTEARRAY_TYPECODE;
+        s->bytearray_obj.len = CIRCUITPY_JSON_READ_CHUNK_SIZE;
+        s->bytearray_obj.free = 0;
+        s->bytearray_obj.items = character_buffer;
+        s->python_readinto[2] = MP_OBJ_FROM_PTR(&s->bytearray_obj);
+        s->stream_obj = s;
+        s->read = json_python_readinto;
     } else {
         stream_p = mp_get_stream_raise(stream_obj, MP_STREAM_OP_READ);
-        s.stream_obj = stream_obj;
-        s.read = stream_p->read;
-        s.errcode = 0;
-        s.cur = 0;
+        s->stream_obj = stream_obj;
+        s->read = stream_p->read;
+        s->errcode = 0;
+        s->cur = 0;
     }
-
     JSON_DEBUG("got JSON stream\n");
-    vstr_t vstr;
-    vstr_init(&vstr, 8);
+}
+
+STATIC NORETURN void json_syntax_error(void) {
+    mp_raise_ValueError(MP_ERROR_TEXT("syntax error in JSON"));
+}
+
+// Parse the rest of a string whose opening quote has been consumed into vstr.
+STATIC void json_parse_string(json_stream_t *s, vstr_t *vstr) {
+    vstr_reset(vstr);
+    for (; !S_END(*s) && S_CUR(*s) != '"';) {
+        byte c = S_CUR(*s);
+        if (c == '\\') {
+            c = S_NEXT(*s);
+            switch (c) {
+                case 'b':
+                    c = 0x08;
+                    break;
+                case 'f':
+                    c = 0x0c;
+                    break;
+                case 'n':
+                    c = 0x0a;
+                    break;
+                case 'r':
+                    c = 0x0d;
+                    break;
+                case 't':
+                    c = 0x09;
+                    break;
+                case 'u': {
+                    mp_uint_t num = 0;
+                    for (int i = 0; i < 4; i++) {
+                        c = (S_NEXT(*s) | 0x20) - '0';
+                        if (c > 9) {
+                            c -= ('a' - ('9' + 1));
+                        }
+                        num = (num << 4) | c;
+                    }
+                    vstr_add_char(vstr, num);
+                    goto str_cont;
+                }
+            }
+        }
+        vstr_add_byte(vstr, c);
+    str_cont:
+        S_NEXT(*s);
+    }
+    if (S_END(*s)) {
+        json_syntax_error();
+    }
+    S_NEXT(*s);
+}
+
+// Parse one value starting at the current character, leaving the stream at the
+// character following it.
+STATIC mp_obj_t json_parse_value(json_stream_t *s, vstr_t *vstr) {
     mp_obj_list_t stack; // we use a list as a simple stack for nested JSON
     stack.len = 0;
     stack.items = NULL;
     mp_obj_t stack_top = MP_OBJ_NULL;
     const mp_obj_type_t *stack_top_type = NULL;
     mp_obj_t stack_key = MP_OBJ_NULL;
-    S_NEXT(s);
     for (;;) {
     cont:
-        if (S_END(s)) {
+        if (S_END(*s)) {
             break;
         }
         mp_obj_t next = MP_OBJ_NULL;
         bool enter = false;
-        byte cur = S_CUR(s);
-        S_NEXT(s);
+        byte cur = S_CUR(*s);
+        S_NEXT(*s);
         switch (cur) {
             case ',':
             case ':':
@@ -239,74 +297,32 @@ STATIC mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
             case '\r':
                 goto cont;
             case 'n':
-                if (S_CUR(s) == 'u' && S_NEXT(s) == 'l' && S_NEXT(s) == 'l') {
-                    S_NEXT(s);
+                if (S_CUR(*s) == 'u' && S_NEXT(*s) == 'l' && S_NEXT(*s) == 'l') {
+                    S_NEXT(*s);
                     next = mp_const_none;
                 } else {
                     goto fail;
                 }
                 break;
             case 'f':
-                if (S_CUR(s) == 'a' && S_NEXT(s) == 'l' && S_NEXT(s) == 's' && S_NEXT(s) == 'e') {
-                    S_NEXT(s);
+                if (S_CUR(*s) == 'a' && S_NEXT(*s) == 'l' && S_NEXT(*s) == 's' && S_NEXT(*s) == 'e') {
+                    S_NEXT(*s);
                     next = mp_const_false;
                 } else {
                     goto fail;
                 }
                 break;
             case 't':
-                if (S_CUR(s) == 'r' && S_NEXT(s) == 'u' && S_NEXT(s) == 'e') {
-                    S_NEXT(s);
+                if (S_CUR(*s) == 'r' && S_NEXT(*s) == 'u' && S_NEXT(*s) == 'e') {
+                    S_NEXT(*s);
                     next = mp_const_true;
                 } else {
                     goto fail;
                 }
                 break;
             case '"':
-                vstr_reset(&vstr);
-                for (; !S_END(s) && S_CUR(s) != '"';) {
-                    byte c = S_CUR(s);
-                    if (c == '\\') {
-                        c = S_NEXT(s);
-                        switch (c) {
-                            case 'b':
-                                c = 0x08;
-                                break;
-                            case 'f':
-                                c = 0x0c;
-                                break;
-                            case 'n':
-                                c = 0x0a;
-                                break;
-                            case 'r':
-                                c = 0x0d;
-                                break;
-                            case 't':
-                                c = 0x09;
-                                break;
-                            case 'u': {
-                                mp_uint_t num = 0;
-                                for (int i = 0; i < 4; i++) {
-                                    c = (S_NEXT(s) | 0x20) - '0';
-                                    if (c > 9) {
-                                        c -= ('a' - ('9' + 1));
-                                    }
-                                    num = (num << 4) | c;
-                                }
-                                vstr_add_char(&vstr, num);
-                                goto str_cont;
-                            }
-                        }
-                    }
-                    vstr_add_byte(&vstr, c);
-                str_cont:
-                    S_NEXT(s);
-                }
-                if (S_END(s)) {
-                    goto fail;
-                }
-                S_NEXT(s);
-                next = mp_obj_new_str(vstr.buf, vstr.len);
+                json_parse_string(s, vstr);
+                next = mp_obj_new_str(vstr->buf, vstr->len);
                 break;
             case '-':
             case '0':
@@ -320,10 +336,10 @@ STATIC mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
             case '8':
             case '9': {
                 bool flt = false;
-                vstr_reset(&vstr);
+                vstr_reset(vstr);
                 for (;;) {
-                    vstr_add_byte(&vstr, cur);
-                    cur = S_CUR(s);
+                    vstr_add_byte(vstr, cur);
+                    cur = S_CUR(*s);
                     if (cur == '.' || cur == 'E' || cur == 'e') {
                         flt = true;
                     } else if (cur == '+' || cur == '-' || unichar_isdigit(cur)) {
@@ -331,12 +347,12 @@ STATIC mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
                     } else {
                         break;
                     }
-                    S_NEXT(s);
+                    S_NEXT(*s);
                 }
                 if (flt) {
-                    next = mp_parse_num_float(vstr.buf, vstr.len, false, NULL);
+                    next = mp_parse_num_float(vstr->buf, vstr->len, false, NULL);
                 } else {
-                    next = mp_parse_num_integer(vstr.buf, vstr.len, 10, NULL);
+                    next = mp_parse_num_integer(vstr->buf, vstr->len, 10, NULL);
                 }
                 break;
             }
@@ -401,6 +417,26 @@ STATIC mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
         }
     }
 success:
+    if (stack_top == MP_OBJ_NULL || stack.len != 0) {
+        // not exactly 1 object
+        goto fail;
+    }
+    return stack_top;
+
+fail:
+    json_syntax_error();
+}
+
+STATIC mp_obj_t _mod_json_load(mp_obj_t stream_obj, bool return_first_json) {
+    json_stream_t s;
+    uint8_t character_buffer[CIRCUITPY_JSON_READ_CHUNK_SIZE];
+    json_stream_init(&s, stream_obj, character_buffer);
+
+    vstr_t vstr;
+    vstr_init(&vstr, 8);
+    S_NEXT(s);
+    mp_obj_t value = json_parse_value(&s, &vstr);
+
     // CIRCUITPY-CHANGE
 
     // It is legal for a stream to have contents after JSON.
@@ -413,18 +449,11 @@ success:
         }
         if (!S_END(s)) {
             // unexpected chars
-            goto fail;
+            json_syntax_error();
         }
     }
-    if (stack_top == MP_OBJ_NULL || stack.len != 0) {
-        // not exactly 1 object
-        goto fail;
-    }
     vstr_clear(&vstr);
-    return stack_top;
-
-fail:
-    mp_raise_ValueError(MP_ERROR_TEXT("syntax error in JSON"));
+    return value;
 }
 
 STATIC mp_obj_t mod_json_load(mp_obj_t stream_obj) {
@@ -441,12 +470,140 @@ STATIC mp_obj_t mod_json_loads(mp_obj_t obj) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(mod_json_loads_obj, mod_json_loads);
 
+// CIRCUITPY-CHANGE: json.select() walks the document without building it, and
+// only parses the values whose position matches a path.
+
+STATIC void json_skip_separators(json_stream_t *s) {
+    while (!S_END(*s) && (unichar_isspace(S_CUR(*s)) || S_CUR(*s) == ',' || S_CUR(*s) == ':')) {
+        S_NEXT(*s);
+    }
+}
+
+// Skip one value, leaving the stream at the character following it.
+STATIC void json_skip_value(json_stream_t *s) {
+    size_t depth = 0;
+    do {
+        json_skip_separators(s);
+        byte cur = S_CUR(*s);
+        if (S_END(*s)) {
+            json_syntax_error();
+        } else if (cur == '"') {
+            while (S_NEXT(*s) != '"' && !S_END(*s)) {
+                if (S_CUR(*s) == '\\') {
+                    S_NEXT(*s);
+                }
+            }
+            if (S_END(*s)) {
+                json_syntax_error();
+            }
+            S_NEXT(*s);
+        } else if (cur == '[' || cur == '{') {
+            depth++;
+            S_NEXT(*s);
+        } else if (cur == ']' || cur == '}') {
+            if (depth == 0) {
+                json_syntax_error();
+            }
+            depth--;
+            S_NEXT(*s);
+        } else {
+            // number or literal: runs up to the next delimiter
+            do {
+                cur = S_NEXT(*s);
+            } while (!S_END(*s) && !unichar_isspace(cur) && strchr(",:[]{}\"", cur) == NULL);
+        }
+    } while (depth > 0);
+}
+
+STATIC void json_select_value(json_stream_t *s, vstr_t *vstr, const mp_obj_t *path, size_t path_len, mp_obj_t results) {
+    if (path_len == 0) {
+        mp_obj_list_append(results, json_parse_value(s, vstr));
+        return;
+    }
+    MP_STACK_CHECK();
+
+    json_skip_separators(s);
+    byte container = S_CUR(*s);
+    if (container != '[' && container != '{') {
+        // A value where the path needs an array or object can't match.
+        json_skip_value(s);
+        return;
+    }
+    S_NEXT(*s);
+
+    size_t key_len = 0;
+    const char *key = NULL;
+    if (mp_obj_is_str(path[0])) {
+        key = mp_obj_str_get_data(path[0], &key_len);
+    }
+    bool wildcard = key_len == 1 && key[0] == '*';
+    for (mp_int_t index = 0;; index++) {
+        json_skip_separators(s);
+        byte cur = S_CUR(*s);
+        if (S_END(*s)) {
+            json_syntax_error();
+        }
+        if (cur == ']' || cur == '}') {
+            S_NEXT(*s);
+            return;
+        }
+        bool match = wildcard;
+        if (container == '{') {
+            if (cur != '"') {
+                json_syntax_error();
+            }
+            S_NEXT(*s);
+            json_parse_string(s, vstr);
+            match = match || (key != NULL && vstr->len == key_len && memcmp(vstr->buf, key, key_len) == 0);
+        } else {
+            match = match || (mp_obj_is_small_int(path[0]) && MP_OBJ_SMALL_INT_VALUE(path[0]) == index);
+        }
+        if (match) {
+            json_select_value(s, vstr, path + 1, path_len - 1, results);
+        } else {
+            json_skip_value(s);
+        }
+    }
+}
+
+STATIC mp_obj_t mod_json_select(mp_obj_t obj, mp_obj_t path_in) {
+    size_t path_len;
+    mp_obj_t *path;
+    mp_obj_get_array(path_in, &path_len, &path);
+
+    // Like loads(), accept a str or bytes as well as a stream.
+    mp_obj_stringio_t sio;
+    vstr_t data;
+    if (mp_obj_is_str_or_bytes(obj)) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(obj, &bufinfo, MP_BUFFER_READ);
+        data = (vstr_t) {bufinfo.len, bufinfo.len, (char *)bufinfo.buf, true};
+        sio = (mp_obj_stringio_t) {{&mp_type_stringio}, &data, 0, MP_OBJ_NULL};
+        obj = MP_OBJ_FROM_PTR(&sio);
+    }
+
+    json_stream_t s;
+    uint8_t character_buffer[CIRCUITPY_JSON_READ_CHUNK_SIZE];
+    json_stream_init(&s, obj, character_buffer);
+
+    vstr_t vstr;
+    vstr_init(&vstr, 8);
+    mp_obj_t results = mp_obj_new_list(0, NULL);
+    S_NEXT(s);
+    json_select_value(&s, &vstr, path, path_len, results);
+    vstr_clear(&vstr);
+    return results;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_json_select_obj, mod_json_select);
+
 STATIC const mp_rom_map_elem_t mp_module_json_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_json) },
     { MP_ROM_QSTR(MP_QSTR_dump), MP_ROM_PTR(&mod_json_dump_obj) },
     { MP_ROM_QSTR(MP_QSTR_dumps), MP_ROM_PTR(&mod_json_dumps_obj) },
     { MP_ROM_QSTR(MP_QSTR_load), MP_ROM_PTR(&mod_json_load_obj) },
     { MP_ROM_QSTR(MP_QSTR_loads), MP_ROM_PTR(&mod_json_loads_obj) },
+    // CIRCUITPY-CHANGE
+    { MP_ROM_QSTR(MP_QSTR_select), MP_ROM_PTR(&mod_json_select_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_json_globals, mp_module_json_globals_table);
@@ -34,6 +34,17 @@
 #include "py/mphal.h"
 #include "shared/runtime/interrupt_char.h"
 
+// CIRCUITPY-CHANGE
+#if CIRCUITPY && !(defined(__unix__) || defined(__APPLE__))
+#include "supervisor/port.h"
+#if CIRCUITPY_CPU_GOVERNOR
+#include "supervisor/shared/cpu_governor.h"
+#endif
+#define SELECT_CAN_SLEEP (1)
+#else
+#define SELECT_CAN_SLEEP (0)
+#endif
+
 #if MICROPY_PY_SELECT
 
 #if MICROPY_PY_SELECT_SELECT && MICROPY_PY_SELECT_POSIX_OPTIMISATIONS
@@ -305,6 +316,25 @@ STATIC mp_uint_t poll_set_poll_once(poll_set_t *poll_set, size_t *rwx_num) {
     return n_ready;
 }
 
+// CIRCUITPY-CHANGE
+#if SELECT_CAN_SLEEP
+// Ask each object to wake the main task when it may become ready. Returns false
+// if any of them can't, in which case they all have to be polled repeatedly.
+STATIC bool poll_set_wake_when_ready(poll_set_t *poll_set) {
+    for (mp_uint_t i = 0; i < poll_set->map.alloc; ++i) {
+        if (!mp_map_slot_is_filled(&poll_set->map, i)) {
+            continue;
+        }
+        poll_obj_t *poll_obj = MP_OBJ_TO_PTR(poll_set->map.table[i].value);
+        int errcode;
+        if (poll_obj->ioctl(poll_obj->obj, MP_STREAM_POLL_WAKE, poll_obj_get_events(poll_obj), &errcode) == MP_STREAM_ERROR) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
 STATIC mp_uint_t poll_set_poll_until_ready_or_timeout(poll_set_t *poll_set, size_t *rwx_num, mp_uint_t timeout) {
     mp_uint_t start_ticks = mp_hal_ticks_ms();
 
@@ -372,6 +402,28 @@ STATIC mp_uint_t poll_set_poll_until_ready_or_timeout(poll_set_t *poll_set, size
         if (mp_hal_is_interrupted()) {
             return 0;
         }
+        #if SELECT_CAN_SLEEP
+        // If every object will wake us when it may be ready, sleep until then
+        // or until the timeout instead of polling them over and over.
+        if (poll_set_wake_when_ready(poll_set)) {
+            uint64_t expected_ticks = UINT64_MAX;
+            if (timeout != (mp_uint_t)-1) {
+                mp_uint_t delta = mp_hal_ticks_ms() - start_ticks;
+                if (delta >= timeout) {
+                    continue;
+                }
+                expected_ticks = ((timeout - delta) * (uint64_t)1024) / 1000 + 1;
+                port_interrupt_after_ticks(expected_ticks);
+            }
+            #if CIRCUITPY_CPU_GOVERNOR
+            cpu_governor_idle_begin(expected_ticks);
+            #endif
+            port_idle_until_interrupt();
+            #if CIRCUITPY_CPU_GOVERNOR
+            cpu_governor_idle_end();
+            #endif
+        }
+        #endif
         #ifdef MICROPY_EVENT_POLL_HOOK
         MICROPY_EVENT_POLL_HOOK;
         #endif
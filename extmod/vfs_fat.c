@@ -141,17 +141,25 @@ typedef struct _mp_vfs_fat_ilistdir_it_t {
     FF_DIR dir;
 } mp_vfs_fat_ilistdir_it_t;
 
+// CIRCUITPY-CHANGE: also used by os.scandir() to get whole FILINFOs.
+bool fat_vfs_ilistdir_next(mp_obj_t iter_in, FILINFO *fno) {
+    mp_vfs_fat_ilistdir_it_t *self = MP_OBJ_TO_PTR(iter_in);
+    FRESULT res = f_readdir(&self->dir, fno);
+    if (res != FR_OK || fno->fname[0] == 0) {
+        // stop on error or end of dir
+        // ignore error because we may be closing a second time
+        f_closedir(&self->dir);
+        return false;
+    }
+    return true;
+}
+
 STATIC mp_obj_t mp_vfs_fat_ilistdir_it_iternext(mp_obj_t self_in) {
     mp_vfs_fat_ilistdir_it_t *self = MP_OBJ_TO_PTR(self_in);
 
-    for (;;) {
-        FILINFO fno;
-        FRESULT res = f_readdir(&self->dir, &fno);
+    FILINFO fno;
+    if (fat_vfs_ilistdir_next(self_in, &fno)) {
         char *fn = fno.fname;
-        if (res != FR_OK || fn[0] == 0) {
-            // stop on error or end of dir
-            break;
-        }
 
         // Note that FatFS already filters . and .., so we don't need to
 
@@ -175,9 +183,6 @@ STATIC mp_obj_t mp_vfs_fat_ilistdir_it_iternext(mp_obj_t self_in) {
         return MP_OBJ_FROM_PTR(t);
     }
 
-    // ignore error because we may be closing a second time
-    f_closedir(&self->dir);
-
     return MP_OBJ_STOP_ITERATION;
 }
 
@@ -314,6 +319,25 @@ STATIC mp_obj_t fat_vfs_getcwd(mp_obj_t vfs_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(fat_vfs_getcwd_obj, fat_vfs_getcwd);
 
+// CIRCUITPY-CHANGE: The modification time of a file, as an int for os.stat().
+mp_obj_t fat_vfs_filinfo_mtime(const FILINFO *fno) {
+    #if MICROPY_LONGINT_IMPL == MICROPY_LONGINT_IMPL_NONE
+    // On non-longint builds, the number of seconds since 1970 (epoch) is too
+    // large to fit in a smallint, so just return 31-DEC-1999 (0).
+    return MP_OBJ_NEW_SMALL_INT(946684800);
+    #else
+    return mp_obj_new_int_from_uint(
+        timeutils_seconds_since_epoch(
+            1980 + ((fno->fdate >> 9) & 0x7f),
+            (fno->fdate >> 5) & 0x0f,
+            fno->fdate & 0x1f,
+            (fno->ftime >> 11) & 0x1f,
+            (fno->ftime >> 5) & 0x3f,
+            2 * (fno->ftime & 0x1f)
+            ));
+    #endif
+}
+
 // Get the status of a file or directory.
 STATIC mp_obj_t fat_vfs_stat(mp_obj_t vfs_in, mp_obj_t path_in) {
     mp_obj_fat_vfs_t *self = MP_OBJ_TO_PTR(vfs_in);
@@ -340,21 +364,8 @@ STATIC mp_obj_t fat_vfs_stat(mp_obj_t vfs_in, mp_obj_t path_in) {
     } else {
         mode |= MP_S_IFREG;
     }
-    #if MICROPY_LONGINT_IMPL == MICROPY_LONGINT_IMPL_NONE
-    // On non-longint builds, the number of seconds since 1970 (epoch) is too
-    // large to fit in a smallint, so just return 31-DEC-1999 (0).
-    mp_obj_t seconds = MP_OBJ_NEW_SMALL_INT(946684800);
-    #else
-    mp_obj_t seconds = mp_obj_new_int_from_uint(
-        timeutils_seconds_since_epoch(
-            1980 + ((fno.fdate >> 9) & 0x7f),
-            (fno.fdate >> 5) & 0x0f,
-            fno.fdate & 0x1f,
-            (fno.ftime >> 11) & 0x1f,
-            (fno.ftime >> 5) & 0x3f,
-            2 * (fno.ftime & 0x1f)
-            ));
-    #endif
+    // CIRCUITPY-CHANGE: conversion shared with os.scandir().
+    mp_obj_t seconds = fat_vfs_filinfo_mtime(&fno);
     t->items[0] = MP_OBJ_NEW_SMALL_INT(mode); // st_mode
     t->items[1] = MP_OBJ_NEW_SMALL_INT(0); // st_ino
     t->items[2] = MP_OBJ_NEW_SMALL_INT(0); // st_dev
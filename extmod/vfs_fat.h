@@ -41,11 +41,27 @@ extern const mp_obj_type_t mp_fat_vfs_type;
 extern const mp_obj_type_t mp_type_vfs_fat_fileio;
 extern const mp_obj_type_t mp_type_vfs_fat_textio;
 
-MP_DECLARE_CONST_FUN_OBJ_3(fat_vfs_open_obj);
+// CIRCUITPY-CHANGE: for os.scandir(). fat_vfs_ilistdir_next() takes an
+// iterator returned by the VFS's ilistdir() and returns false at the end.
+bool fat_vfs_ilistdir_next(mp_obj_t iter_in, FILINFO *fno);
+mp_obj_t fat_vfs_filinfo_mtime(const FILINFO *fno);
+
+// CIRCUITPY-CHANGE: open() takes an optional buffer size.
+MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(fat_vfs_open_obj);
 
 typedef struct _pyb_file_obj_t {
     mp_obj_base_t base;
     FIL fp;
+    // CIRCUITPY-CHANGE: read buffer, holding the bytes before the FatFs file
+    // position; rbuf is NULL when the file is unbuffered.
+    byte *rbuf;
+    size_t rbuf_size;
+    size_t rbuf_pos;
+    size_t rbuf_len;
 } pyb_file_obj_t;
 
+// CIRCUITPY-CHANGE: C code that uses fp directly calls this first, so that fp
+// is at the position seen by Python and later Python reads start from fp.
+void vfs_fat_file_drop_buffer(pyb_file_obj_t *self);
+
 #endif  // MICROPY_INCLUDED_EXTMOD_VFS_FAT_H
@@ -42,6 +42,10 @@
 #include "lib/oofatfs/ff.h"
 #include "lib/oofatfs/diskio.h"
 #include "extmod/vfs_fat.h"
+// CIRCUITPY-CHANGE
+#if CIRCUITPY_OS_GETENV
+#include "shared-module/os/__init__.h"
+#endif
 
 typedef void *bdev_t;
 STATIC fs_user_mount_t *disk_get_device(void *bdev) {
@@ -85,6 +89,11 @@ DRESULT disk_write(
 
     int ret = mp_vfs_blockdev_write(&vfs->blockdev, sector, count, buff);
 
+    // CIRCUITPY-CHANGE: settings.toml may have changed under os.getenv()'s index.
+    #if CIRCUITPY_OS_GETENV
+    os_getenv_invalidate_index();
+    #endif
+
     if (ret == -MP_EROFS) {
         // read-only block device
         return RES_WRPRT;
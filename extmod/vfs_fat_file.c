@@ -66,9 +66,71 @@ STATIC void file_obj_print(const mp_print_t *print, mp_obj_t self_in, mp_print_k
     mp_printf(print, "<io.%q %p>", mp_obj_get_type_qstr(self_in), MP_OBJ_TO_PTR(self_in));
 }
 
+// CIRCUITPY-CHANGE: small reads and readline() are served from a read buffer,
+// so they don't each go through FatFs.
+
+// The position seen by Python, which is behind FatFs's by the unread part of the buffer.
+STATIC FSIZE_t file_obj_tell(pyb_file_obj_t *self) {
+    return f_tell(&self->fp) - (self->rbuf_len - self->rbuf_pos);
+}
+
+// Discard the read buffer, moving FatFs's position back to the one seen by Python.
+void vfs_fat_file_drop_buffer(pyb_file_obj_t *self) {
+    if (self->rbuf_pos != self->rbuf_len) {
+        f_lseek(&self->fp, file_obj_tell(self));
+    }
+    self->rbuf_pos = 0;
+    self->rbuf_len = 0;
+}
+
+// Refill the empty read buffer. At the end of the file it stays empty.
+STATIC bool file_obj_fill_buffer(pyb_file_obj_t *self, int *errcode) {
+    UINT sz_out;
+    FRESULT res = f_read(&self->fp, self->rbuf, self->rbuf_size, &sz_out);
+    self->rbuf_pos = 0;
+    if (res != FR_OK) {
+        self->rbuf_len = 0;
+        *errcode = fresult_to_errno_table[res];
+        return false;
+    }
+    self->rbuf_len = sz_out;
+    return true;
+}
+
 STATIC mp_uint_t file_obj_read(mp_obj_t self_in, void *buf, mp_uint_t size, int *errcode) {
     pyb_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
     UINT sz_out;
+    if (self->rbuf != NULL) {
+        byte *out = buf;
+        while (size > 0) {
+            if (self->rbuf_pos == self->rbuf_len) {
+                if (size >= self->rbuf_size) {
+                    // Large reads bypass the buffer once it is empty.
+                    break;
+                }
+                if (!file_obj_fill_buffer(self, errcode)) {
+                    return MP_STREAM_ERROR;
+                }
+                if (self->rbuf_len == 0) {
+                    return out - (byte *)buf;
+                }
+            }
+            size_t n = MIN(size, self->rbuf_len - self->rbuf_pos);
+            memcpy(out, self->rbuf + self->rbuf_pos, n);
+            self->rbuf_pos += n;
+            out += n;
+            size -= n;
+        }
+        if (size == 0) {
+            return out - (byte *)buf;
+        }
+        FRESULT res = f_read(&self->fp, out, size, &sz_out);
+        if (res != FR_OK) {
+            *errcode = fresult_to_errno_table[res];
+            return MP_STREAM_ERROR;
+        }
+        return out - (byte *)buf + sz_out;
+    }
     FRESULT res = f_read(&self->fp, buf, size, &sz_out);
     if (res != FR_OK) {
         *errcode = fresult_to_errno_table[res];
@@ -79,6 +141,8 @@ STATIC mp_uint_t file_obj_read(mp_obj_t self_in, void *buf, mp_uint_t size, int
 
 STATIC mp_uint_t file_obj_write(mp_obj_t self_in, const void *buf, mp_uint_t size, int *errcode) {
     pyb_file_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    // CIRCUITPY-CHANGE: write at the position seen by Python.
+    vfs_fat_file_drop_buffer(self);
     UINT sz_out;
     FRESULT res = f_write(&self->fp, buf, size, &sz_out);
     if (res != FR_OK) {
@@ -99,23 +163,59 @@ STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
     if (request == MP_STREAM_SEEK) {
         struct mp_stream_seek_t *s = (struct mp_stream_seek_t *)(uintptr_t)arg;
 
+        // CIRCUITPY-CHANGE: seeks within the read buffer keep it.
+        FSIZE_t target;
         switch (s->whence) {
             case 0: // SEEK_SET
-                f_lseek(&self->fp, s->offset);
+                target = s->offset;
                 break;
 
             case 1: // SEEK_CUR
-                f_lseek(&self->fp, f_tell(&self->fp) + s->offset);
+                target = file_obj_tell(self) + s->offset;
                 break;
 
             case 2: // SEEK_END
-                f_lseek(&self->fp, f_size(&self->fp) + s->offset);
+                target = f_size(&self->fp) + s->offset;
+                break;
+
+            default:
+                target = file_obj_tell(self);
                 break;
         }
 
-        s->offset = f_tell(&self->fp);
+        FSIZE_t buffer_start = f_tell(&self->fp) - self->rbuf_len;
+        if (target >= buffer_start && target <= f_tell(&self->fp)) {
+            self->rbuf_pos = target - buffer_start;
+        } else {
+            self->rbuf_pos = 0;
+            self->rbuf_len = 0;
+            f_lseek(&self->fp, target);
+        }
+
+        s->offset = file_obj_tell(self);
         return 0;
 
+    } else if (request == MP_STREAM_WRITEV) {
+        // CIRCUITPY-CHANGE: write the pieces one after another, as write() would, with one dispatch.
+        const mp_stream_writev_t *writev = (const mp_stream_writev_t *)(uintptr_t)arg;
+        vfs_fat_file_drop_buffer(self);
+        mp_uint_t total = 0;
+        for (size_t i = 0; i < writev->count; i++) {
+            UINT sz_out;
+            FRESULT res = f_write(&self->fp, writev->bufs[i].buf, writev->bufs[i].len, &sz_out);
+            if (res != FR_OK) {
+                *errcode = fresult_to_errno_table[res];
+                return MP_STREAM_ERROR;
+            }
+            total += sz_out;
+            if (sz_out != writev->bufs[i].len) {
+                // The FatFS documentation says that this means disk full.
+                *errcode = MP_ENOSPC;
+                return MP_STREAM_ERROR;
+            }
+        }
+        return total;
+
     } else if (request == MP_STREAM_FLUSH) {
         FRESULT res = f_sync(&self->fp);
         if (res != FR_OK) {
@@ -127,6 +227,10 @@ STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
     } else if (request == MP_STREAM_CLOSE) {
         // if fs==NULL then the file is closed and in that case this method is a no-op
         if (self->fp.obj.fs != NULL) {
+            // CIRCUITPY-CHANGE: The buffer is left for the GC to free, since this may run in a finaliser.
+            self->rbuf = NULL;
+            self->rbuf_pos = 0;
+            self->rbuf_len = 0;
             FRESULT res = f_close(&self->fp);
             if (res != FR_OK) {
                 *errcode = fresult_to_errno_table[res];
@@ -141,14 +245,90 @@ STATIC mp_uint_t file_obj_ioctl(mp_obj_t o_in, mp_uint_t request, uintptr_t arg,
     }
 }
 
+// CIRCUITPY-CHANGE: readline(), readlines() and iteration look for line ends
+// in the read buffer a chunk at a time.
+STATIC mp_obj_t file_obj_readline(size_t n_args, const mp_obj_t *args) {
+    pyb_file_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    if (self->rbuf == NULL) {
+        return mp_call_function_n_kw(MP_OBJ_FROM_PTR(&mp_stream_unbuffered_readline_obj), n_args, 0, args);
+    }
+
+    mp_int_t max_size = -1;
+    if (n_args > 1) {
+        max_size = MP_OBJ_SMALL_INT_VALUE(args[1]);
+    }
+
+    vstr_t vstr;
+    vstr_init(&vstr, 16);
+    while (max_size != 0) {
+        if (self->rbuf_pos == self->rbuf_len) {
+            int errcode;
+            if (!file_obj_fill_buffer(self, &errcode)) {
+                mp_raise_OSError(errcode);
+            }
+            if (self->rbuf_len == 0) {
+                break;
+            }
+        }
+        const byte *start = self->rbuf + self->rbuf_pos;
+        size_t n = self->rbuf_len - self->rbuf_pos;
+        if (max_size > 0 && n > (size_t)max_size) {
+            n = max_size;
+        }
+        const byte *newline = memchr(start, '\n', n);
+        if (newline != NULL) {
+            n = newline - start + 1;
+        }
+        vstr_add_strn(&vstr, (const char *)start, n);
+        self->rbuf_pos += n;
+        if (max_size > 0) {
+            max_size -= n;
+        }
+        if (newline != NULL) {
+            break;
+        }
+    }
+
+    if (mp_obj_is_type(args[0], &mp_type_vfs_fat_textio)) {
+        return mp_obj_new_str_from_vstr(&vstr);
+    } else {
+        return mp_obj_new_bytes_from_vstr(&vstr);
+    }
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(file_obj_readline_obj, 1, 2, file_obj_readline);
+
+STATIC mp_obj_t file_obj_readlines(mp_obj_t self) {
+    mp_obj_t lines = mp_obj_new_list(0, NULL);
+    for (;;) {
+        mp_obj_t line = file_obj_readline(1, &self);
+        if (!mp_obj_is_true(line)) {
+            break;
+        }
+        mp_obj_list_append(lines, line);
+    }
+    return lines;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(file_obj_readlines_obj, file_obj_readlines);
+
+STATIC mp_obj_t file_obj_iternext(mp_obj_t self) {
+    mp_obj_t line = file_obj_readline(1, &self);
+    if (mp_obj_is_true(line)) {
+        return line;
+    }
+    return MP_OBJ_STOP_ITERATION;
+}
+
 // TODO gc hook to close the file if not already closed
 
 STATIC const mp_rom_map_elem_t vfs_fat_rawfile_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_read), MP_ROM_PTR(&mp_stream_read_obj) },
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
-    { MP_ROM_QSTR(MP_QSTR_readline), MP_ROM_PTR(&mp_stream_unbuffered_readline_obj) },
-    { MP_ROM_QSTR(MP_QSTR_readlines), MP_ROM_PTR(&mp_stream_unbuffered_readlines_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readline), MP_ROM_PTR(&file_obj_readline_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readlines), MP_ROM_PTR(&file_obj_readlines_obj) },
     { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&mp_stream_write_obj) },
+    // CIRCUITPY-CHANGE
+    { MP_ROM_QSTR(MP_QSTR_readv), MP_ROM_PTR(&mp_stream_readv_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writev), MP_ROM_PTR(&mp_stream_writev_obj) },
     { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&mp_stream_flush_obj) },
     { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&mp_stream_close_obj) },
     { MP_ROM_QSTR(MP_QSTR_seek), MP_ROM_PTR(&mp_stream_seek_obj) },
@@ -169,8 +349,9 @@ STATIC const mp_stream_p_t vfs_fat_fileio_stream_p = {
 MP_DEFINE_CONST_OBJ_TYPE(
     mp_type_vfs_fat_fileio,
     MP_QSTR_FileIO,
-    MP_TYPE_FLAG_ITER_IS_STREAM,
+    MP_TYPE_FLAG_ITER_IS_ITERNEXT,
     print, file_obj_print,
+    iter, file_obj_iternext,
     protocol, &vfs_fat_fileio_stream_p,
     locals_dict, &vfs_fat_rawfile_locals_dict
     );
@@ -185,15 +366,21 @@ STATIC const mp_stream_p_t vfs_fat_textio_stream_p = {
 MP_DEFINE_CONST_OBJ_TYPE(
     mp_type_vfs_fat_textio,
     MP_QSTR_TextIOWrapper,
-    MP_TYPE_FLAG_ITER_IS_STREAM,
+    MP_TYPE_FLAG_ITER_IS_ITERNEXT,
     print, file_obj_print,
+    iter, file_obj_iternext,
     protocol, &vfs_fat_textio_stream_p,
     locals_dict, &vfs_fat_rawfile_locals_dict
     );
 
 // Factory function for I/O stream classes
-STATIC mp_obj_t fat_vfs_open(mp_obj_t self_in, mp_obj_t path_in, mp_obj_t mode_in) {
-    fs_user_mount_t *self = MP_OBJ_TO_PTR(self_in);
+// CIRCUITPY-CHANGE: optional buffering argument, as in open(). 0 turns off the
+// read buffer; a negative value or 1 gives a buffer of one sector.
+STATIC mp_obj_t fat_vfs_open(size_t n_args, const mp_obj_t *args) {
+    fs_user_mount_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_obj_t path_in = args[1];
+    mp_obj_t mode_in = args[2];
+    mp_int_t buffering = n_args > 3 ? mp_obj_get_int(args[3]) : -1;
 
     const mp_obj_type_t *type = &mp_type_vfs_fat_textio;
     int mode = 0;
@@ -250,6 +437,9 @@ STATIC mp_obj_t fat_vfs_open(mp_obj_t self_in, mp_obj_t path_in, mp_obj_t mode_i
 
     pyb_file_obj_t *o = m_new_obj_with_finaliser(pyb_file_obj_t);
     o->base.type = type;
+    o->rbuf = NULL;
+    o->rbuf_pos = 0;
+    o->rbuf_len = 0;
 
     const char *fname = mp_obj_str_get_str(path_in);
     FRESULT res = f_open(&self->fatfs, &o->fp, fname, mode);
@@ -283,8 +473,23 @@ STATIC mp_obj_t fat_vfs_open(mp_obj_t self_in, mp_obj_t path_in, mp_obj_t mode_i
         f_lseek(&o->fp, f_size(&o->fp));
     }
 
+    // CIRCUITPY-CHANGE: If there isn't room for a read buffer, the file is unbuffered.
+    if ((mode & FA_READ) != 0 && buffering != 0) {
+        if (buffering < 0 || buffering == 1) {
+            #if FF_MAX_SS == FF_MIN_SS
+            buffering = FF_MAX_SS;
+            #else
+            buffering = self->fatfs.ssize;
+            #endif
+        }
+        o->rbuf = m_malloc_maybe(buffering);
+        if (o->rbuf != NULL) {
+            o->rbuf_size = buffering;
+        }
+    }
+
     return MP_OBJ_FROM_PTR(o);
 }
-MP_DEFINE_CONST_FUN_OBJ_3(fat_vfs_open_obj, fat_vfs_open);
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(fat_vfs_open_obj, 3, 4, fat_vfs_open);
 
 #endif // MICROPY_VFS && MICROPY_VFS_FAT
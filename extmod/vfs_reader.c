@@ -27,6 +27,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "py/gc.h"
 #include "py/runtime.h"
 #include "py/stream.h"
 #include "py/reader.h"
@@ -76,6 +77,23 @@ void mp_reader_new_file(mp_reader_t *reader, const char *filename) {
         MP_OBJ_NEW_QSTR(MP_QSTR_rb),
     };
     rf->file = mp_vfs_open(MP_ARRAY_SIZE(args), &args[0], (mp_map_t *)&mp_const_empty_map);
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+    // A filesystem whose files are in memory-mapped storage can expose their
+    // contents with the buffer protocol. Read those directly, and let the .mpy
+    // loader use them in place unless the data is in the GC heap. The data
+    // is read through the buffer, not the file, so the file is closed here.
+    mp_buffer_info_t bufinfo;
+    if (mp_get_buffer(rf->file, &bufinfo, MP_BUFFER_READ)) {
+        const mp_stream_p_t *stream_p = mp_get_stream(rf->file);
+        if (stream_p != NULL && stream_p->ioctl != NULL) {
+            mp_stream_close(rf->file);
+        }
+        m_del_obj(mp_reader_vfs_t, rf);
+        mp_reader_new_mem(reader, bufinfo.buf, bufinfo.len, gc_ptr_on_heap(bufinfo.buf) ? 0 : MP_READER_IS_ROM);
+        return;
+    }
+    #endif
     int errcode;
     rf->len = mp_stream_rw(rf->file, rf->buf, sizeof(rf->buf), &errcode, MP_STREAM_RW_READ | MP_STREAM_RW_ONCE);
     if (errcode != 0) {
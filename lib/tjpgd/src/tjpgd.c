@@ -811,6 +811,12 @@ static JRESULT mcu_output (
 	rect.left = x; rect.right = x + rx - 1;				/* Rectangular area in the frame buffer */
 	rect.top = y; rect.bottom = y + ry - 1;
 
+	// CIRCUITPY-CHANGE: skip the color conversion of MCUs outside the clip, and
+	// stop once the MCU rows are below it.
+	if (jd->clip) {
+		if (rect.top > jd->clip->bottom) return JDR_INTR;
+		if (rect.bottom < jd->clip->top || rect.right < jd->clip->left || rect.left > jd->clip->right) return JDR_OK;
+	}
 
 	if (!JD_USE_SCALE || jd->scale != 3) {	/* Not for 1/8 scaling */
 		pix = (uint8_t*)jd->workbuf;
@@ -86,6 +86,8 @@ struct JDEC {
 	size_t sz_pool;				/* Size of momory pool (bytes available) */
 	size_t (*infunc)(JDEC*, uint8_t*, size_t);	/* Pointer to jpeg stream input function */
 	void* device;				/* Pointer to I/O device identifiler for the session */
+	// CIRCUITPY-CHANGE: optional output clip; MCUs outside it are not color converted
+	const JRECT* clip;			/* Scaled output area to produce (NULL:all) */
 };
 
 
@@ -114,10 +114,26 @@
 #include "supervisor/shared/status_bar.h"
 #endif
 
+#if CIRCUITPY_CPU_GOVERNOR
+#include "supervisor/shared/cpu_governor.h"
+#endif
+
+#if CIRCUITPY_SUPERVISOR_BOOT_TIMELINE
+#include "supervisor/shared/boot_timeline.h"
+#endif
+
+#if CIRCUITPY_SUPERVISOR_PROFILE
+#include "shared-module/supervisor/Profiler.h"
+#endif
+
 #if CIRCUITPY_USB_HID
 #include "shared-module/usb_hid/__init__.h"
 #endif
 
+#if CIRCUITPY_USB_HOST
+#include "shared-module/usb/core/Device.h"
+#endif
+
 #if CIRCUITPY_WIFI
 #include "shared-bindings/wifi/__init__.h"
 #endif
@@ -151,12 +167,12 @@ STATIC uint8_t *_allocate_memory(safe_mode_t safe_mode, const char *env_key, siz
         }
     }
     #endif
-    uint8_t *ptr = port_malloc(*final_size, false);
+    uint8_t *ptr = port_malloc_tagged(*final_size, false, PORT_HEAP_TAG_VM);
 
     #if CIRCUITPY_OS_GETENV
     if (ptr == NULL) {
         // Fallback to the build size.
-        ptr = port_malloc(default_size, false);
+        ptr = port_malloc_tagged(default_size, false, PORT_HEAP_TAG_VM);
     }
     #endif
     if (ptr == NULL) {
@@ -242,11 +258,11 @@ STATIC void stop_mp(void) {
     qstr_reset();
 
     gc_deinit();
-    port_free(_heap);
+    port_free_tagged(_heap, PORT_HEAP_TAG_VM);
     _heap = NULL;
 
     #if MICROPY_ENABLE_PYSTACK
-    port_free(_pystack);
+    port_free_tagged(_pystack, PORT_HEAP_TAG_VM);
     _pystack = NULL;
     #endif
 }
@@ -256,16 +272,16 @@ STATIC const char *_current_executing_filename = NULL;
 STATIC pyexec_result_t _exec_result = {0, MP_OBJ_NULL, 0};
 
 #if CIRCUITPY_STATUS_BAR
-void supervisor_execution_status(void) {
+void supervisor_execution_status(const mp_print_t *print) {
     mp_obj_exception_t *exception = MP_OBJ_TO_PTR(_exec_result.exception);
     if (_current_executing_filename != NULL) {
-        serial_write(_current_executing_filename);
+        mp_print_str(print, _current_executing_filename);
     } else if ((_exec_result.return_code & PYEXEC_EXCEPTION) != 0 &&
                _exec_result.exception_line > 0 &&
                exception != NULL) {
-        mp_printf(&mp_plat_print, "%d@%s %q", _exec_result.exception_line, _exec_result.exception_filename, exception->base.type->name);
+        mp_printf(print, "%d@%s %q", _exec_result.exception_line, _exec_result.exception_filename, exception->base.type->name);
     } else {
-        serial_write_compressed(MP_ERROR_TEXT("Done"));
+        mp_printf(print, "%S", MP_ERROR_TEXT("Done"));
     }
 }
 #endif
@@ -328,7 +344,7 @@ STATIC void cleanup_after_vm(mp_obj_t exception) {
     // MP_OBJ_NULL (=0) means "this run completed successfully, clear any stored traceback"
     if (exception != MP_OBJ_SENTINEL) {
         if (prev_traceback_string != NULL) {
-            port_free(prev_traceback_string);
+            port_free_tagged(prev_traceback_string, PORT_HEAP_TAG_SUPERVISOR);
             prev_traceback_string = NULL;
         }
         // ReloadException is exempt from traceback printing in pyexec_file(), so treat it as "no
@@ -337,7 +353,7 @@ STATIC void cleanup_after_vm(mp_obj_t exception) {
             size_t traceback_len = 0;
             mp_print_t print_count = {&traceback_len, count_strn};
             mp_obj_print_exception(&print_count, exception);
-            prev_traceback_string = (char *)port_malloc(traceback_len + 1, false);
+            prev_traceback_string = (char *)port_malloc_tagged(traceback_len + 1, false, PORT_HEAP_TAG_SUPERVISOR);
             // Empirically, this never fails in practice - even when the heap is totally filled up
             // with single-block-sized objects referenced by a root pointer, exiting the VM frees
             // up several hundred bytes, sufficient for the traceback (which tends to be shortened
@@ -382,6 +398,15 @@ STATIC void cleanup_after_vm(mp_obj_t exception) {
     keypad_reset();
     #endif
 
+    #if CIRCUITPY_SUPERVISOR_PROFILE
+    supervisor_profiler_reset();
+    #endif
+
+    // Stop background USB host endpoint reads that use the heap.
+    #if CIRCUITPY_USB_HOST
+    usb_core_reset();
+    #endif
+
     // Close user-initiated sockets.
     #if CIRCUITPY_SOCKETPOOL
     socketpool_user_reset();
@@ -404,6 +429,11 @@ STATIC void cleanup_after_vm(mp_obj_t exception) {
     filesystem_flush();
     stop_mp();
 
+    // Native code is only referenced from the VM heap so it can go now too.
+    #if CIRCUITPY_ENABLE_MPY_NATIVE
+    supervisor_native_code_free_all();
+    #endif
+
     // Let the workflows know we've reset in case they want to restart.
     supervisor_workflow_reset();
 }
@@ -464,6 +494,19 @@ STATIC bool run_code_py(safe_mode_t safe_mode, bool *simulate_reset) {
         // Make sure we are in the root directory before looking at files.
         common_hal_os_chdir("/");
 
+        #if CIRCUITPY_CPU_GOVERNOR
+        cpu_governor_start();
+        #endif
+
+        #if CIRCUITPY_SUPERVISOR_BOOT_TIMELINE
+        supervisor_boot_timeline_mark(SUPERVISOR_BOOT_EVENT_CODE_PY_START);
+        #if CIRCUITPY_SUPERVISOR_BOOT_TIMELINE_PRINT
+        if (supervisor_get_run_reason() == RUN_REASON_STARTUP) {
+            supervisor_boot_timeline_print(&mp_plat_print);
+        }
+        #endif
+        #endif
+
         // Check if a different run file has been allocated
         if (next_code_configuration != NULL) {
             next_code_configuration->options &= ~SUPERVISOR_NEXT_CODE_OPT_NEWLY_SET;
@@ -547,6 +590,13 @@ STATIC bool run_code_py(safe_mode_t safe_mode, bool *simulate_reset) {
         }
     }
 
+    #if CIRCUITPY_ALARM_FAST_RESUME
+    // A fast wake from deep sleep that isn't going back to sleep needs USB after all.
+    if (!(_exec_result.return_code & PYEXEC_DEEP_SLEEP)) {
+        supervisor_workflow_start_usb();
+    }
+    #endif
+
     // Program has finished running.
     bool printed_press_any_key = false;
     #if CIRCUITPY_EPAPERDISPLAY
@@ -749,12 +799,24 @@ STATIC bool run_code_py(safe_mode_t safe_mode, bool *simulate_reset) {
             // we'll undersleep just a little. It shouldn't matter.
             if (time_to_next_change > 0) {
                 port_interrupt_after_ticks(time_to_next_change);
+                #if CIRCUITPY_CPU_GOVERNOR
+                cpu_governor_idle_begin(time_to_next_change);
+                #endif
                 port_idle_until_interrupt();
+                #if CIRCUITPY_CPU_GOVERNOR
+                cpu_governor_idle_end();
+                #endif
             }
             #else
             // No status LED can we sleep until we are interrupted by some
             // interaction.
+            #if CIRCUITPY_CPU_GOVERNOR
+            cpu_governor_idle_begin(UINT64_MAX);
+            #endif
             port_idle_until_interrupt();
+            #if CIRCUITPY_CPU_GOVERNOR
+            cpu_governor_idle_end();
+            #endif
             #endif
         }
     }
@@ -769,7 +831,7 @@ STATIC bool run_code_py(safe_mode_t safe_mode, bool *simulate_reset) {
 
     // free code allocation if unused
     if (next_code_configuration != NULL && (next_code_configuration->options & next_code_stickiness_situation) == 0) {
-        port_free(next_code_configuration);
+        port_free_tagged(next_code_configuration, PORT_HEAP_TAG_SUPERVISOR);
         next_code_configuration = NULL;
     }
 
@@ -865,8 +927,14 @@ STATIC void __attribute__ ((noinline)) run_boot_py(safe_mode_t safe_mode) {
         port_boot_info();
         #endif
 
+        #if CIRCUITPY_SUPERVISOR_BOOT_TIMELINE
+        supervisor_boot_timeline_mark(SUPERVISOR_BOOT_EVENT_BOOT_PY_START);
+        #endif
         bool found_boot = maybe_run_list(boot_py_filenames, MP_ARRAY_SIZE(boot_py_filenames));
         (void)found_boot;
+        #if CIRCUITPY_SUPERVISOR_BOOT_TIMELINE
+        supervisor_boot_timeline_mark(SUPERVISOR_BOOT_EVENT_BOOT_PY_DONE);
+        #endif
 
 
         #ifdef CIRCUITPY_BOOT_OUTPUT_FILE
@@ -989,6 +1057,9 @@ int __attribute__((used)) main(void) {
 
     // initialise the cpu and peripherals
     set_safe_mode(port_init());
+    #if CIRCUITPY_SUPERVISOR_BOOT_TIMELINE
+    supervisor_boot_timeline_mark(SUPERVISOR_BOOT_EVENT_PORT_INIT);
+    #endif
 
     port_heap_init();
 
@@ -1054,6 +1125,9 @@ int __attribute__((used)) main(void) {
 
     // displays init after filesystem, since they could share the flash SPI
     board_init();
+    #if CIRCUITPY_SUPERVISOR_BOOT_TIMELINE
+    supervisor_boot_timeline_mark(SUPERVISOR_BOOT_EVENT_BOARD_INIT);
+    #endif
 
     // This is first time we are running CircuitPython after a reset or power-up.
     supervisor_set_run_reason(RUN_REASON_STARTUP);
@@ -1130,6 +1204,11 @@ void gc_collect(void) {
 
     port_gc_collect();
 
+    // Every collection marks from scratch, even with MICROPY_GC_INCREMENTAL_SWEEP,
+    // so every root below must be traced every time: a root skipped because it
+    // didn't change would leave the objects it references unmarked and they would
+    // be freed. The subsystem collectors only mark the few pointers they hold, and
+    // roots that are plain pointers belong in MP_REGISTER_ROOT_POINTER instead.
     background_callback_gc_collect();
 
     #if CIRCUITPY_ALARM
@@ -0,0 +1,623 @@
+#!/usr/bin/env python3
+
+# SPDX-FileCopyrightText: 2014 MicroPython & CircuitPython contributors (https://github.com/adafruit/circuitpython/graphs/contributors)
+#
+# SPDX-License-Identifier: MIT
+
+"""
+Whole-program optimisation of a CircuitPython application.
+
+mpy-cross compiles one module at a time and cannot see how a module is used.
+Given the application's entry file (usually code.py) and its library
+directories, this tool finds every module the application can import and,
+before compiling them, rewrites their sources knowing the whole program:
+
+ - Public `X = const(...)` integers are folded into the modules that use them,
+   so `from m import X` and `m.X` no longer cost a global lookup (or an import,
+   when `m` has no side effects).
+ - Top-level functions and classes whose names are never referenced anywhere
+   in the program are removed.
+ - Modules that are no longer imported after folding are left out.
+
+Every rewrite keeps line numbers unchanged so tracebacks still point at the
+original source.  The libraries are then compiled with mpy-cross into the
+output directory, laid out like CIRCUITPY (code.py stays a .py).  With
+--source the rewritten .py files are written instead, ready to be frozen into
+firmware with FROZEN_MPY_DIRS, which also interns their qstrs in flash.
+
+Run as:
+
+    python -m mpy_cross.bundle code.py -o build-app
+"""
+
+from __future__ import print_function
+import argparse
+import ast
+import collections
+import os
+import re
+import shutil
+import sys
+import tempfile
+
+from . import compile as mpy_cross_compile, CrossCompileError
+
+# Names that can reach module globals without naming them.  When a program uses
+# any of these the unused definitions cannot be found safely.
+_DYNAMIC_NAMES = frozenset(("eval", "exec", "globals", "locals", "vars", "__import__"))
+
+_MPY_NAME_RE = re.compile(rb"[A-Za-z_][A-Za-z0-9_]*(?:\.[A-Za-z_][A-Za-z0-9_]*)*")
+
+
+class BundleError(Exception):
+    pass
+
+
+class _NotConst(Exception):
+    pass
+
+
+class Module:
+    def __init__(self, name, path, out_path, kind, is_package):
+        self.name = name
+        # Source file, or None for a namespace package (a directory without __init__).
+        self.path = path
+        # Path within the output directory, without extension.
+        self.out_path = out_path
+        # "py", "mpy" (already compiled, cannot be analysed) or "ns".
+        self.kind = kind
+        self.is_package = is_package
+        self.source = None
+        self.tree = None
+        self.consts = {}
+        self.pure = None
+
+    def load(self):
+        if self.kind != "py":
+            return
+        with open(self.path, "rb") as f:
+            self.source = f.read()
+        self.reparse(self.source)
+
+    def reparse(self, source):
+        try:
+            self.tree = ast.parse(source, self.path)
+        except SyntaxError as er:
+            raise BundleError("{}:{}: {}".format(self.path, er.lineno, er.msg))
+        self.source = source
+
+    def package(self):
+        if self.is_package:
+            return self.name
+        return self.name.rpartition(".")[0]
+
+
+def _dotted_prefixes(name):
+    parts = name.split(".")
+    return [".".join(parts[: i + 1]) for i in range(len(parts))]
+
+
+def _store_names(tree):
+    # How many times each name is bound in a module, in any scope.
+    count = collections.Counter()
+    for node in ast.walk(tree):
+        if isinstance(node, ast.Name) and not isinstance(node.ctx, ast.Load):
+            count[node.id] += 1
+        elif isinstance(node, (ast.FunctionDef, ast.AsyncFunctionDef, ast.ClassDef)):
+            count[node.name] += 1
+        elif isinstance(node, ast.arg):
+            count[node.arg] += 1
+        elif isinstance(node, ast.alias):
+            count[(node.asname or node.name).partition(".")[0]] += 1
+        elif isinstance(node, (ast.Global, ast.Nonlocal)):
+            for name in node.names:
+                count[name] += 1
+    return count
+
+
+def _used_names(node):
+    # Every identifier a piece of code might use to reach a definition.
+    count = collections.Counter()
+    for n in ast.walk(node):
+        if isinstance(n, ast.Name):
+            count[n.id] += 1
+        elif isinstance(n, ast.Attribute):
+            count[n.attr] += 1
+        elif isinstance(n, ast.alias):
+            count.update(n.name.split("."))
+            if n.asname:
+                count[n.asname] += 1
+        elif isinstance(n, ast.keyword) and n.arg:
+            count[n.arg] += 1
+        elif isinstance(n, ast.Constant) and isinstance(n.value, str):
+            count[n.value] += 1
+        elif isinstance(n, (ast.Global, ast.Nonlocal)):
+            count.update(n.names)
+    return count
+
+
+_BINOPS = {
+    ast.Add: lambda a, b: a + b,
+    ast.Sub: lambda a, b: a - b,
+    ast.Mult: lambda a, b: a * b,
+    ast.FloorDiv: lambda a, b: a // b,
+    ast.Mod: lambda a, b: a % b,
+    ast.LShift: lambda a, b: a << b,
+    ast.RShift: lambda a, b: a >> b,
+    ast.BitAnd: lambda a, b: a & b,
+    ast.BitOr: lambda a, b: a | b,
+    ast.BitXor: lambda a, b: a ^ b,
+    ast.Pow: lambda a, b: a**b,
+}
+
+
+def _eval_const(node, env):
+    # Evaluate the argument of const() the way the MicroPython parser does.
+    if isinstance(node, ast.Constant) and type(node.value) is int:
+        return node.value
+    if isinstance(node, ast.Name) and node.id in env:
+        return env[node.id]
+    if isinstance(node, ast.UnaryOp):
+        value = _eval_const(node.operand, env)
+        if isinstance(node.op, ast.USub):
+            return -value
+        if isinstance(node.op, ast.UAdd):
+            return value
+        if isinstance(node.op, ast.Invert):
+            return ~value
+    if isinstance(node, ast.BinOp) and type(node.op) in _BINOPS:
+        lhs = _eval_const(node.left, env)
+        rhs = _eval_const(node.right, env)
+        if isinstance(node.op, (ast.LShift, ast.RShift, ast.Pow)) and not 0 <= rhs <= 1024:
+            raise _NotConst
+        try:
+            return _BINOPS[type(node.op)](lhs, rhs)
+        except ZeroDivisionError:
+            raise _NotConst
+    raise _NotConst
+
+
+def _const_call(node):
+    return (
+        isinstance(node, ast.Call)
+        and isinstance(node.func, ast.Name)
+        and node.func.id == "const"
+        and len(node.args) == 1
+        and not node.keywords
+    )
+
+
+class _Editor:
+    # Applies replacements to a source given as ast positions (columns are UTF-8 offsets).
+    def __init__(self, source):
+        self.source = source
+        self.lines = source.splitlines(True)
+        self.starts = [0]
+        for line in self.lines:
+            self.starts.append(self.starts[-1] + len(line))
+        self.edits = []
+
+    def offset(self, lineno, col):
+        return self.starts[lineno - 1] + col
+
+    def line_end(self, lineno):
+        return self.starts[lineno - 1] + len(self.lines[lineno - 1].rstrip(b"\r\n"))
+
+    def replace(self, start, end, text):
+        self.edits.append((start, end, text.encode()))
+
+    def replace_node(self, node, text):
+        # Keep the line count, so later lines keep their numbers.
+        text += "\n" * (node.end_lineno - node.lineno)
+        self.replace(
+            self.offset(node.lineno, node.col_offset),
+            self.offset(node.end_lineno, node.end_col_offset),
+            text,
+        )
+
+    def remove_lines(self, first, last):
+        self.replace(self.starts[first - 1], self.line_end(last), "\n" * (last - first))
+
+    def apply(self):
+        out = self.source
+        last_start = len(out) + 1
+        for start, end, text in sorted(self.edits, reverse=True):
+            if end > last_start:
+                # Inside an edit already made (for example a const use in a removed function).
+                continue
+            out = out[:start] + text + out[end:]
+            last_start = start
+        return out
+
+
+class Bundle:
+    def __init__(self, entry, lib_dirs, verbose=False):
+        self.entry = entry
+        self.root = os.path.dirname(os.path.abspath(entry))
+        self.lib_dirs = lib_dirs
+        self.verbose = verbose
+        self.modules = collections.OrderedDict()
+        self.not_found = set()
+        self.found = set()
+        self.stats = collections.Counter()
+        main_name = os.path.splitext(os.path.basename(entry))[0]
+        self.main = Module("__main__", entry, main_name, "py", False)
+        self.main.load()
+
+    def log(self, *args):
+        if self.verbose:
+            print(*args)
+
+    def _find(self, name):
+        # Search like the runtime: the application directory, then each library
+        # directory; a package directory first, then .py, then .mpy.
+        rel = name.replace(".", os.sep)
+        roots = [(self.root, "")] + [(d, "lib") for d in self.lib_dirs]
+        for root, out_dir in roots:
+            base = os.path.join(root, rel)
+            out_base = os.path.join(out_dir, rel)
+            if os.path.isdir(base):
+                for ext, kind in ((".py", "py"), (".mpy", "mpy")):
+                    init = os.path.join(base, "__init__" + ext)
+                    if os.path.isfile(init):
+                        return Module(name, init, os.path.join(out_base, "__init__"), kind, True)
+                return Module(name, None, out_base, "ns", True)
+            for ext, kind in ((".py", "py"), (".mpy", "mpy")):
+                if os.path.isfile(base + ext):
+                    return Module(name, base + ext, out_base, kind, False)
+        return None
+
+    def _imports(self, module):
+        # Names of the modules the given module may import, whether or not they exist.
+        if module.kind == "mpy":
+            with open(module.path, "rb") as f:
+                return [n.decode() for n in _MPY_NAME_RE.findall(f.read())]
+        if module.kind != "py":
+            return []
+        names = []
+        for node in ast.walk(module.tree):
+            if isinstance(node, ast.Import):
+                for alias in node.names:
+                    names.extend(_dotted_prefixes(alias.name))
+            elif isinstance(node, ast.ImportFrom):
+                base = self._from_base(module, node)
+                if base is None:
+                    continue
+                names.extend(_dotted_prefixes(base))
+                for alias in node.names:
+                    if alias.name != "*":
+                        names.append(base + "." + alias.name)
+        return names
+
+    def _from_base(self, module, node):
+        if not node.level:
+            return node.module
+        pkg = module.package().split(".") if module.package() else []
+        if node.level - 1 > len(pkg):
+            return None
+        pkg = pkg[: len(pkg) - (node.level - 1)]
+        if node.module:
+            pkg.append(node.module)
+        return ".".join(pkg) or None
+
+    def resolve(self):
+        # Find every module reachable from the entry file.
+        reachable = collections.OrderedDict()
+        todo = [self.main]
+        while todo:
+            module = todo.pop(0)
+            for name in self._imports(module):
+                if name in reachable or name in self.not_found:
+                    continue
+                found = self.modules.get(name) or self._find(name)
+                if found is None:
+                    # A built-in module, or something the runtime will fail to import.
+                    self.not_found.add(name)
+                    continue
+                if found.tree is None:
+                    found.load()
+                reachable[name] = found
+                self.found.add(name)
+                todo.append(found)
+        self.modules = reachable
+
+    def analysed(self):
+        return [self.main] + [m for m in self.modules.values() if m.kind == "py"]
+
+    def _is_pure(self, module):
+        # True if importing the module does nothing beyond defining names.
+        if module is None:
+            return True
+        if module.pure is not None:
+            return module.pure
+        if module.kind == "mpy":
+            module.pure = False
+            return False
+        module.pure = True
+        if module.kind == "ns":
+            return True
+        for stmt in module.tree.body:
+            if isinstance(stmt, (ast.FunctionDef, ast.AsyncFunctionDef, ast.ClassDef)):
+                if not stmt.decorator_list:
+                    continue
+            elif isinstance(stmt, (ast.Import, ast.ImportFrom, ast.Pass)):
+                continue
+            elif isinstance(stmt, ast.Expr) and isinstance(stmt.value, ast.Constant):
+                continue
+            elif isinstance(stmt, (ast.Assign, ast.AnnAssign)) and stmt.value is not None:
+                if isinstance(stmt.value, ast.Constant) or _const_call(stmt.value):
+                    continue
+            module.pure = False
+            return False
+        for name in self._imports(module):
+            if not self._is_pure(self.modules.get(name)):
+                module.pure = False
+                return False
+        return True
+
+    def find_consts(self):
+        # Attributes assigned from outside their module are not constant.
+        attr_stores = set()
+        for module in self.analysed():
+            for node in ast.walk(module.tree):
+                if isinstance(node, ast.Attribute) and not isinstance(node.ctx, ast.Load):
+                    attr_stores.add(node.attr)
+        for module in self.analysed():
+            stores = _store_names(module.tree)
+            env = {}
+            for stmt in module.tree.body:
+                if not (
+                    isinstance(stmt, ast.Assign)
+                    and len(stmt.targets) == 1
+                    and isinstance(stmt.targets[0], ast.Name)
+                    and _const_call(stmt.value)
+                ):
+                    continue
+                name = stmt.targets[0].id
+                try:
+                    env[name] = _eval_const(stmt.value.args[0], env)
+                except _NotConst:
+                    continue
+                # Names starting with an underscore are private to their module.
+                if not name.startswith("_") and stores[name] == 1 and name not in attr_stores:
+                    module.consts[name] = env[name]
+
+    def fold_consts(self):
+        for module in self.analysed():
+            stores = _store_names(module.tree)
+            editor = _Editor(module.source)
+            bound = {}
+            for stmt in module.tree.body:
+                if isinstance(stmt, ast.ImportFrom):
+                    self._fold_import_from(module, stmt, stores, editor)
+                elif isinstance(stmt, ast.Import):
+                    for alias in stmt.names:
+                        target = self.modules.get(alias.name)
+                        if target is None or not target.consts:
+                            continue
+                        if alias.asname:
+                            if stores[alias.asname] == 1:
+                                bound[alias.asname] = target
+                        elif stores[alias.name.partition(".")[0]] == 1:
+                            bound[alias.name] = target
+            if bound:
+                self._fold_attributes(module, bound, editor)
+            if editor.edits:
+                self._rewrite(module, editor)
+
+    def _fold_import_from(self, module, stmt, stores, editor):
+        target = self.modules.get(self._from_base(module, stmt))
+        if target is None or not target.consts:
+            return
+        folded = []
+        kept = []
+        # const() names must be bound after the import, which would otherwise see
+        # them replaced by their values.
+        for alias in stmt.names:
+            name = alias.asname or alias.name
+            if alias.name in target.consts and stores[name] == 1:
+                folded.append("{} = const({})".format(name, target.consts[alias.name]))
+            else:
+                kept.append(alias.name + (" as " + alias.asname if alias.asname else ""))
+        if not folded:
+            return
+        from_name = "." * stmt.level + (stmt.module or "")
+        if not kept and not self._is_pure(target):
+            # The import still has to run; its bindings are replaced straight after.
+            kept = [a.name + (" as " + a.asname if a.asname else "") for a in stmt.names]
+        if kept:
+            folded.insert(0, "from {} import {}".format(from_name, ", ".join(kept)))
+        self.stats["consts"] += len(folded) - bool(kept)
+        editor.replace_node(stmt, "; ".join(folded))
+
+    def _fold_attributes(self, module, bound, editor):
+        parents = {}
+        for node in ast.walk(module.tree):
+            for child in ast.iter_child_nodes(node):
+                parents[child] = node
+        for node in ast.walk(module.tree):
+            if not (isinstance(node, ast.Attribute) and isinstance(node.ctx, ast.Load)):
+                continue
+            if node.lineno != node.end_lineno:
+                continue
+            chain = []
+            base = node.value
+            while isinstance(base, ast.Attribute):
+                chain.append(base.attr)
+                base = base.value
+            if not isinstance(base, ast.Name):
+                continue
+            chain.append(base.id)
+            target = bound.get(".".join(reversed(chain)))
+            if target is None or node.attr not in target.consts:
+                continue
+            value = target.consts[node.attr]
+            text = str(value)
+            if value < 0 or isinstance(parents.get(node), ast.Attribute):
+                text = "(" + text + ")"
+            editor.replace_node(node, text)
+            self.stats["consts"] += 1
+
+    def _rewrite(self, module, editor):
+        source = editor.apply()
+        try:
+            module.reparse(source)
+        except BundleError as er:
+            # Should not happen; leave the module as it was rather than break it.
+            print("warning: not optimising {}: {}".format(module.path, er), file=sys.stderr)
+
+    def strip(self):
+        # Remove top-level definitions that nothing in the program refers to.
+        used = collections.Counter()
+        for module in self.analysed():
+            used.update(_used_names(module.tree))
+        for module in self.modules.values():
+            if module.kind == "mpy":
+                with open(module.path, "rb") as f:
+                    for name in _MPY_NAME_RE.findall(f.read()):
+                        used.update(name.decode().split("."))
+        dynamic = set()
+        for module in self.analysed():
+            for node in ast.walk(module.tree):
+                if isinstance(node, ast.Name) and node.id in _DYNAMIC_NAMES:
+                    dynamic.add(node.id)
+        if dynamic:
+            print(
+                "warning: not removing unused code, program uses {}".format(
+                    ", ".join(sorted(dynamic))
+                ),
+                file=sys.stderr,
+            )
+            return
+
+        removed = {module: [] for module in self.analysed()}
+        changed = True
+        while changed:
+            changed = False
+            for module in self.analysed():
+                for stmt in module.tree.body:
+                    if not isinstance(stmt, (ast.FunctionDef, ast.AsyncFunctionDef, ast.ClassDef)):
+                        continue
+                    if stmt.decorator_list or stmt.name.startswith("__"):
+                        continue
+                    if stmt in removed[module]:
+                        continue
+                    inner = _used_names(stmt)
+                    if used[stmt.name] - inner[stmt.name] > 0:
+                        continue
+                    self.log("removing {}.{}".format(module.name, stmt.name))
+                    removed[module].append(stmt)
+                    used.subtract(inner)
+                    changed = True
+
+        for module, stmts in removed.items():
+            if not stmts:
+                continue
+            editor = _Editor(module.source)
+            for stmt in stmts:
+                editor.remove_lines(stmt.lineno, stmt.end_lineno)
+            self.stats["definitions"] += len(stmts)
+            self._rewrite(module, editor)
+
+    def write(self, out_dir, source_only=False, opt=None, march=None, mpy_cross=None):
+        shutil.rmtree(out_dir, ignore_errors=True)
+        os.makedirs(out_dir)
+        tmp_dir = tempfile.mkdtemp()
+        try:
+            for module in [self.main] + list(self.modules.values()):
+                if module.kind == "ns":
+                    continue
+                if module.kind == "mpy":
+                    dest = os.path.join(out_dir, module.out_path + ".mpy")
+                    os.makedirs(os.path.dirname(dest) or out_dir, exist_ok=True)
+                    shutil.copyfile(module.path, dest)
+                    continue
+                with open(module.path, "rb") as f:
+                    self.stats["input"] += len(f.read())
+                src_path = module.out_path + ".py"
+                if module is self.main or source_only:
+                    dest = os.path.join(out_dir, src_path)
+                    os.makedirs(os.path.dirname(dest) or out_dir, exist_ok=True)
+                    with open(dest, "wb") as f:
+                        f.write(module.source)
+                else:
+                    src = os.path.join(tmp_dir, module.name + ".py")
+                    with open(src, "wb") as f:
+                        f.write(module.source)
+                    dest = os.path.join(out_dir, module.out_path + ".mpy")
+                    os.makedirs(os.path.dirname(dest) or out_dir, exist_ok=True)
+                    mpy_cross_compile(
+                        src, dest, src_path=src_path, opt=opt, march=march, mpy_cross=mpy_cross
+                    )
+                self.stats["output"] += os.path.getsize(dest)
+                self.log("{} -> {}".format(module.path, dest))
+        finally:
+            shutil.rmtree(tmp_dir, ignore_errors=True)
+
+
+def main():
+    cmd_parser = argparse.ArgumentParser(
+        description="Optimise and compile an application and the libraries it imports."
+    )
+    cmd_parser.add_argument("entry", help="the application's entry file, usually code.py")
+    cmd_parser.add_argument("-o", "--out", required=True, help="output directory (replaced)")
+    cmd_parser.add_argument(
+        "-L",
+        "--lib",
+        action="append",
+        help="library directory, may be repeated (default: lib next to the entry file)",
+    )
+    cmd_parser.add_argument(
+        "--no-const", action="store_true", help="do not fold const() across modules"
+    )
+    cmd_parser.add_argument(
+        "--no-strip", action="store_true", help="do not remove unused functions and classes"
+    )
+    cmd_parser.add_argument(
+        "--source",
+        action="store_true",
+        help="write optimised .py files instead of compiling them, for example to freeze",
+    )
+    cmd_parser.add_argument("-O", dest="opt", type=int, help="mpy-cross optimisation level")
+    cmd_parser.add_argument("-march", help="mpy-cross native architecture")
+    cmd_parser.add_argument("--mpy-cross", help="mpy-cross binary to use")
+    cmd_parser.add_argument("-v", "--verbose", action="store_true", help="list what is done")
+    args = cmd_parser.parse_args()
+
+    lib_dirs = args.lib
+    if lib_dirs is None:
+        lib_dirs = [os.path.join(os.path.dirname(os.path.abspath(args.entry)), "lib")]
+
+    try:
+        bundle = Bundle(args.entry, lib_dirs, args.verbose)
+        bundle.resolve()
+        bundle.find_consts()
+        if not args.no_const:
+            bundle.fold_consts()
+            # Modules only imported for their constants are no longer needed.
+            bundle.resolve()
+        if not args.no_strip:
+            bundle.strip()
+        bundle.write(args.out, args.source, args.opt, args.march, args.mpy_cross)
+    except (BundleError, CrossCompileError, OSError) as er:
+        print(er, file=sys.stderr)
+        raise SystemExit(1)
+
+    for name in sorted(bundle.not_found):
+        parent = name.rpartition(".")[0]
+        # Names imported from a module are tried as submodules first.
+        if parent not in bundle.found and parent not in bundle.not_found:
+            bundle.log("not found, assumed built in: " + name)
+    print(
+        "{} modules, {} constants folded, {} definitions removed, {} -> {} bytes".format(
+            1 + sum(m.kind != "ns" for m in bundle.modules.values()),
+            bundle.stats["consts"],
+            bundle.stats["definitions"],
+            bundle.stats["input"],
+            bundle.stats["output"],
+        )
+    )
+
+
+if __name__ == "__main__":
+    main()
@@ -226,6 +226,7 @@ audio_dma_result audio_dma_setup_playback(audio_dma_t *dma,
     dma->spacing = 1;
     audiosample_reset_buffer(sample, single_channel_output, audio_channel);
     dma->buffer_to_load = NO_BUFFER_TO_LOAD;
+    dma->underruns = 0;
     dma->descriptor[0] = dma_descriptor(dma_channel);
     dma->descriptor[1] = &dma->second_descriptor;
 
@@ -369,6 +370,10 @@ void audio_dma_reset(void) {
     }
 }
 
+uint32_t audio_dma_get_underruns(audio_dma_t *dma) {
+    return dma->underruns;
+}
+
 bool audio_dma_get_playing(audio_dma_t *dma) {
     if (dma->dma_channel >= AUDIO_DMA_CHANNEL_COUNT) {
         return false;
@@ -418,6 +423,11 @@ void audio_dma_evsys_handler(void) {
         // of which buffer to fill here appears correct.
         DmacDescriptor *next_descriptor =
             (DmacDescriptor *)dma_write_back_descriptor(dma->dma_channel)->DESCADDR.reg;
+        // The buffer from the last block is still waiting to be loaded, and the
+        // DMA has now moved on to it.
+        if (!dma->single_buffer && dma->buffer_to_load != NO_BUFFER_TO_LOAD) {
+            dma->underruns++;
+        }
         if (next_descriptor == dma->descriptor[0]) {
             dma->buffer_to_load = 0;
         } else if (next_descriptor == dma->descriptor[1]) {
@@ -47,6 +47,7 @@ typedef struct {
     uint8_t beat_size;
     uint8_t spacing;
     uint8_t buffer_to_load; // Index
+    volatile uint32_t underruns; // times the DMA moved to a buffer before it was refilled
     bool loop;
     bool single_buffer;
     bool single_channel_output;
@@ -93,6 +94,8 @@ void audio_dma_disable_channel(uint8_t channel);
 void audio_dma_enable_channel(uint8_t channel);
 void audio_dma_stop(audio_dma_t *dma);
 bool audio_dma_get_playing(audio_dma_t *dma);
+// The number of underruns since playback last started.
+uint32_t audio_dma_get_underruns(audio_dma_t *dma);
 void audio_dma_pause(audio_dma_t *dma);
 void audio_dma_resume(audio_dma_t *dma);
 bool audio_dma_get_paused(audio_dma_t *dma);
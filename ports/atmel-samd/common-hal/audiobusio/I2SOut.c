@@ -399,3 +399,7 @@ bool common_hal_audiobusio_i2sout_get_playing(audiobusio_i2sout_obj_t *self) {
 }
 
 #endif // CIRCUITPY_AUDIOBUSIO_I2SOUT
+
+mp_int_t common_hal_audiobusio_i2sout_get_underruns(audiobusio_i2sout_obj_t *self) {
+    return audio_dma_get_underruns(&self->dma);
+}
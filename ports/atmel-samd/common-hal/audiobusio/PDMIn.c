@@ -37,6 +37,7 @@
 #include "shared-bindings/audiobusio/PDMIn.h"
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/microcontroller/Pin.h"
+#include "shared-module/audiobusio/__init__.h"
 
 #include "atmel_start_pins.h"
 #include "hal/include/hal_gpio.h"
@@ -50,7 +51,7 @@
 
 #include "audio_dma.h"
 
-#define OVERSAMPLING 64
+#define OVERSAMPLING AUDIOBUSIO_PDM_OVERSAMPLING
 #define SAMPLES_PER_BUFFER 32
 
 // MEMS microphones must be clocked at at least 1MHz.
@@ -333,53 +334,6 @@ static void setup_dma(audiobusio_pdmin_obj_t *self, uint32_t length,
     }
 }
 
-// a windowed sinc filter for 44 khz, 64 samples
-//
-// This filter is good enough to use for lower sample rates as
-// well. It does not increase the noise enough to be a problem.
-//
-// In the long run we could use a fast filter like this to do the
-// decimation and initial filtering in real time, filtering to a
-// higher sample rate than specified.  Then after the audio is
-// recorded, a more expensive filter non-real-time filter could be
-// used to down-sample and low-pass.
-const uint16_t sinc_filter[OVERSAMPLING] = {
-    0, 2, 9, 21, 39, 63, 94, 132,
-    179, 236, 302, 379, 467, 565, 674, 792,
-    920, 1055, 1196, 1341, 1487, 1633, 1776, 1913,
-    2042, 2159, 2263, 2352, 2422, 2474, 2506, 2516,
-    2506, 2474, 2422, 2352, 2263, 2159, 2042, 1913,
-    1776, 1633, 1487, 1341, 1196, 1055, 920, 792,
-    674, 565, 467, 379, 302, 236, 179, 132,
-    94, 63, 39, 21, 9, 2, 0, 0
-};
-
-#ifdef SAMD21
-#define REPEAT_16_TIMES(X) do { for (uint8_t j = 0; j < 4; j++) { X X X X } } while (0)
-#else
-#define REPEAT_16_TIMES(X) do { X X X X X X X X X X X X X X X X } while (0)
-#endif
-
-static uint16_t filter_sample(uint32_t pdm_samples[4]) {
-    uint16_t running_sum = 0;
-    const uint16_t *filter_ptr = sinc_filter;
-    for (uint8_t i = 0; i < OVERSAMPLING / 16; i++) {
-        // The sample is 16-bits right channel in the upper two bytes and 16-bits left channel
-        // in the lower two bytes.
-        // We just ignore the upper bits
-        uint32_t pdm_sample = pdm_samples[i];
-        REPEAT_16_TIMES({
-            if (pdm_sample & 0x8000) {
-                running_sum += *filter_ptr;
-            }
-            filter_ptr++;
-            pdm_sample <<= 1;
-        }
-            );
-    }
-    return running_sum;
-}
-
 // output_buffer may be a byte buffer or a halfword buffer.
 // output_buffer_length is the number of slots, not the number of bytes.
 uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t *self,
@@ -457,8 +411,7 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t *se
         // Don't run off the end of output buffer. Process only as many as needed.
         uint32_t samples_to_process = min(remaining_samples_needed, samples_gathered);
         for (uint32_t i = 0; i < samples_to_process; i++) {
-            // Call filter_sample just one place so it can be inlined.
-            uint16_t value = filter_sample(buffer + i * words_per_sample);
+            uint16_t value = audiobusio_pdm_filter_msb_first_halfwords(buffer + i * words_per_sample);
             if (self->bit_depth == 8) {
                 // Truncate to 8 bits.
                 ((uint8_t *)output_buffer)[values_output] = value >> 8;
@@ -502,3 +455,19 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t *se
 
     return values_output;
 }
+
+void common_hal_audiobusio_pdmin_start_recording(audiobusio_pdmin_obj_t *self, uint32_t buffer_length) {
+    mp_raise_NotImplementedError(NULL);
+}
+
+void common_hal_audiobusio_pdmin_stop_recording(audiobusio_pdmin_obj_t *self) {
+}
+
+uint32_t common_hal_audiobusio_pdmin_readinto(audiobusio_pdmin_obj_t *self,
+    uint16_t *output_buffer, uint32_t output_buffer_length) {
+    return 0;
+}
+
+uint32_t common_hal_audiobusio_pdmin_get_overruns(audiobusio_pdmin_obj_t *self) {
+    return 0;
+}
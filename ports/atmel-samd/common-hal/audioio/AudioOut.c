@@ -496,3 +496,13 @@ bool common_hal_audioio_audioout_get_playing(audioio_audioout_obj_t *self) {
     }
     return now_playing;
 }
+
+mp_int_t common_hal_audioio_audioout_get_underruns(audioio_audioout_obj_t *self) {
+    uint32_t underruns = audio_dma_get_underruns(&self->left_dma);
+    #ifdef SAM_D5X_E5X
+    if (self->right_channel != NULL) {
+        underruns += audio_dma_get_underruns(&self->right_dma);
+    }
+    #endif
+    return underruns;
+}
@@ -223,7 +223,11 @@ int common_hal_sdioio_sdcard_readblocks(sdioio_sdcard_obj_t *self, uint32_t star
         debug_print_state(self, "sd_mmc_start_read_blocks", r);
         return -EIO;
     }
-    sd_mmc_wait_end_of_write_blocks(0);
+    r = sd_mmc_wait_end_of_read_blocks(false);
+    if (r != SD_MMC_OK) {
+        debug_print_state(self, "sd_mmc_wait_end_of_read_blocks", r);
+        return -EIO;
+    }
     return 0;
 }
 
@@ -67,6 +67,9 @@
 // Only support simpler HID descriptors on SAMD21.
 #define CIRCUITPY_USB_HID_MAX_REPORT_IDS_PER_DESCRIPTOR (1)
 
+// Write USB mass storage transfers straight through to save ram.
+#define CIRCUITPY_USB_MSC_WRITE_BUFFER_BLOCKS (0)
+
 #endif // SAMD21
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -83,6 +86,7 @@
 #define MICROPY_PY_SYS_PLATFORM                     "MicroChip SAME54"
 #endif
 #define SPI_FLASH_MAX_BAUDRATE 24000000
+#define CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS      (4)
 #define MICROPY_PY_BUILTINS_NOTIMPLEMENTED          (1)
 #define MICROPY_PY_FUNCTION_ATTRS                   (1)
 //      MICROPY_PY_ERRNO_LIST - Use the default
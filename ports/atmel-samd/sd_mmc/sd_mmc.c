@@ -195,6 +195,7 @@ static bool sdio_cmd53(uint8_t rw_flag, uint8_t func_nb, uint32_t reg_addr, uint
     bool access_block);
 #endif
 static bool sd_acmd6(void);
+static bool sd_acmd23(uint16_t nb_block);
 static bool sd_acmd51(void);
 /** @} */
 
@@ -927,6 +928,26 @@ static bool sd_acmd6(void) {
     return true;
 }
 
+/**
+ * \brief ACMD23 - Set the number of write blocks to be pre-erased
+ *
+ * \note
+ * This is only a hint that lets the card erase the blocks of a multiple
+ * block write before they arrive. The write works even if it fails.
+ *
+ * \param nb_block  Number of blocks that the next CMD25 will write
+ *
+ * \return true if success, otherwise false
+ */
+static bool sd_acmd23(uint16_t nb_block) {
+    /* CMD55 - Indicate to the card that the next command is an
+     * application specific command rather than a standard command.*/
+    if (!driver_send_cmd(sd_mmc_hal, SDMMC_CMD55_APP_CMD, (uint32_t)sd_mmc_card->rca << 16)) {
+        return false;
+    }
+    return driver_send_cmd(sd_mmc_hal, SD_ACMD23_SET_WR_BLK_ERASE_COUNT, nb_block);
+}
+
 /**
  * \brief ACMD51 - Read the SD Configuration Register.
  *
@@ -1458,6 +1479,9 @@ sd_mmc_err_t sd_mmc_init_write_blocks(uint8_t slot, uint32_t start, uint16_t nb_
 
     if (nb_block > 1) {
         cmd = SDMMC_CMD25_WRITE_MULTIPLE_BLOCK;
+        if (sd_mmc_card->type & CARD_TYPE_SD) {
+            sd_acmd23(nb_block);
+        }
     } else {
         cmd = SDMMC_CMD24_WRITE_BLOCK;
     }
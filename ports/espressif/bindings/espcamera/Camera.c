@@ -87,7 +87,7 @@
 //|         :param pixel_format: The pixel format of the captured image
 //|         :param frame_size: The size of captured image
 //|         :param jpeg_quality: For `PixelFormat.JPEG`, the quality. Higher numbers increase quality. If the quality is too high, the JPEG data will be larger than the available buffer size and the image will be unusable or truncated. The exact range of appropriate values depends on the sensor and must be determined empirically.
-//|         :param framebuffer_count: The number of framebuffers (1 for single-buffered and 2 for double-buffered)
+//|         :param framebuffer_count: The number of framebuffers, from 1 to 4. Use 1 for single-buffered and 2 for double-buffered capture, or more to hold several frames from `take_frame` at once
 //|         :param grab_mode: When to grab a new frame
 //|         """
 STATIC mp_obj_t espcamera_camera_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
@@ -138,7 +138,7 @@ STATIC mp_obj_t espcamera_camera_make_new(const mp_obj_type_t *type, size_t n_ar
     framesize_t frame_size = validate_frame_size(args[ARG_frame_size].u_obj, MP_QSTR_frame_size);
     pixformat_t pixel_format = validate_pixel_format(args[ARG_pixel_format].u_obj, MP_QSTR_pixel_format);
     mp_int_t jpeg_quality = mp_arg_validate_int_range(args[ARG_jpeg_quality].u_int, 2, 55, MP_QSTR_jpeg_quality);
-    mp_int_t framebuffer_count = mp_arg_validate_int_range(args[ARG_framebuffer_count].u_int, 1, 2, MP_QSTR_framebuffer_count);
+    mp_int_t framebuffer_count = mp_arg_validate_int_range(args[ARG_framebuffer_count].u_int, 1, ESPCAMERA_MAX_FRAMEBUFFERS, MP_QSTR_framebuffer_count);
 
     espcamera_camera_obj_t *self = mp_obj_malloc(espcamera_camera_obj_t, &espcamera_camera_type);
     common_hal_espcamera_camera_construct(
@@ -204,6 +204,29 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_1(espcamera_camera_frame_available_get_obj, espca
 MP_PROPERTY_GETTER(espcamera_camera_frame_available_obj,
     (mp_obj_t)&espcamera_camera_frame_available_get_obj);
 
+// Wrap a framebuffer without copying it.
+STATIC mp_obj_t frame_view(espcamera_camera_obj_t *self, camera_fb_t *fb) {
+    if (!fb) {
+        return mp_const_none;
+    }
+    pixformat_t format = common_hal_espcamera_camera_get_pixel_format(self);
+    if (format == PIXFORMAT_JPEG) {
+        return mp_obj_new_memoryview('b', fb->len, fb->buf);
+    } else {
+        int width = common_hal_espcamera_camera_get_width(self);
+        int height = common_hal_espcamera_camera_get_height(self);
+        displayio_bitmap_t *bitmap = m_new_obj(displayio_bitmap_t);
+        bitmap->base.type = &displayio_bitmap_type;
+        common_hal_displayio_bitmap_construct_from_buffer(bitmap, width, height, (format == PIXFORMAT_RGB565) ? 16 : 8, (uint32_t *)(void *)fb->buf, true);
+        return bitmap;
+    }
+}
+
+STATIC int timeout_ms_arg(size_t n_args, const mp_obj_t *args) {
+    mp_float_t timeout = n_args < 2 ? MICROPY_FLOAT_CONST(0.25) : mp_obj_get_float(args[1]);
+    return (int)MICROPY_FLOAT_C_FUN(round)(timeout * 1000);
+}
+
 //|     def take(
 //|         self, timeout: Optional[float] = 0.25
 //|     ) -> Optional[displayio.Bitmap | ReadableBuffer]:
@@ -212,29 +235,51 @@ MP_PROPERTY_GETTER(espcamera_camera_frame_available_obj,
 //|         In the case of timeout, `None` is returned.
 //|         If `pixel_format` is `PixelFormat.JPEG`, the returned value is a read-only `memoryview`.
 //|         Otherwise, the returned value is a read-only `displayio.Bitmap`.
+//|
+//|         The frame is given back to the camera on the next call to `take`.
 //|         """
 STATIC mp_obj_t espcamera_camera_take(size_t n_args, const mp_obj_t *args) {
     espcamera_camera_obj_t *self = MP_OBJ_TO_PTR(args[0]);
-    mp_float_t timeout = n_args < 2 ? MICROPY_FLOAT_CONST(0.25) : mp_obj_get_float(args[1]);
     check_for_deinit(self);
-    camera_fb_t *result = common_hal_espcamera_camera_take(self, (int)MICROPY_FLOAT_C_FUN(round)(timeout * 1000));
-    if (!result) {
-        return mp_const_none;
-    }
-    pixformat_t format = common_hal_espcamera_camera_get_pixel_format(self);
-    if (format == PIXFORMAT_JPEG) {
-        return mp_obj_new_memoryview('b', result->len, result->buf);
-    } else {
-        int width = common_hal_espcamera_camera_get_width(self);
-        int height = common_hal_espcamera_camera_get_height(self);
-        displayio_bitmap_t *bitmap = m_new_obj(displayio_bitmap_t);
-        bitmap->base.type = &displayio_bitmap_type;
-        common_hal_displayio_bitmap_construct_from_buffer(bitmap, width, height, (format == PIXFORMAT_RGB565) ? 16 : 8, (uint32_t *)(void *)result->buf, true);
-        return bitmap;
-    }
+    return frame_view(self, common_hal_espcamera_camera_take(self, timeout_ms_arg(n_args, args)));
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(espcamera_camera_take_obj, 1, 2, espcamera_camera_take);
 
+//|     def take_frame(
+//|         self, timeout: Optional[float] = 0.25
+//|     ) -> Optional[displayio.Bitmap | ReadableBuffer]:
+//|         """Borrow a captured frame until it is passed to `release_frame`. Wait up to
+//|         'timeout' seconds for a frame to be captured.
+//|
+//|         The returned value is the same kind of view as from `take`, over the camera's
+//|         own framebuffer: nothing is copied. It can be shown with a `displayio.TileGrid`
+//|         or passed straight to ``socket.send()``. Up to `framebuffer_count` frames can be
+//|         borrowed at once; the camera keeps capturing into the rest. Once every
+//|         framebuffer is borrowed, this times out and returns `None`.
+//|         """
+STATIC mp_obj_t espcamera_camera_take_frame(size_t n_args, const mp_obj_t *args) {
+    espcamera_camera_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    check_for_deinit(self);
+    return frame_view(self, common_hal_espcamera_camera_take_frame(self, timeout_ms_arg(n_args, args)));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(espcamera_camera_take_frame_obj, 1, 2, espcamera_camera_take_frame);
+
+//|     def release_frame(self, frame: displayio.Bitmap | ReadableBuffer) -> None:
+//|         """Give a frame from `take_frame` back to the camera so it can capture into it again.
+//|
+//|         The contents of ``frame`` are undefined afterwards."""
+STATIC mp_obj_t espcamera_camera_release_frame(mp_obj_t self_in, mp_obj_t frame) {
+    espcamera_camera_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(frame, &bufinfo, MP_BUFFER_READ);
+    if (!common_hal_espcamera_camera_release_frame(self, bufinfo.buf)) {
+        mp_arg_error_invalid(MP_QSTR_frame);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(espcamera_camera_release_frame_obj, espcamera_camera_release_frame);
+
 
 //|     def reconfigure(
 //|         self,
@@ -277,9 +322,9 @@ STATIC mp_obj_t espcamera_camera_reconfigure(mp_uint_t n_args, const mp_obj_t *p
         args[ARG_grab_mode].u_obj != MP_ROM_NONE
         ?  validate_grab_mode(args[ARG_grab_mode].u_obj, MP_QSTR_grab_mode)
         : common_hal_espcamera_camera_get_grab_mode(self);
-    bool framebuffer_count =
+    mp_int_t framebuffer_count =
         args[ARG_framebuffer_count].u_obj != MP_ROM_NONE
-        ?  mp_obj_get_int(args[ARG_framebuffer_count].u_obj)
+        ?  mp_arg_validate_int_range(mp_obj_get_int(args[ARG_framebuffer_count].u_obj), 1, ESPCAMERA_MAX_FRAMEBUFFERS, MP_QSTR_framebuffer_count)
         : common_hal_espcamera_camera_get_framebuffer_count(self);
 
     common_hal_espcamera_camera_reconfigure(self, frame_size, pixel_format, grab_mode, framebuffer_count);
@@ -980,6 +1025,8 @@ STATIC const mp_rom_map_elem_t espcamera_camera_locals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_special_effect), MP_ROM_PTR(&espcamera_camera_special_effect_obj) },
     { MP_ROM_QSTR(MP_QSTR_supports_jpeg), MP_ROM_PTR(&espcamera_camera_supports_jpeg_obj) },
     { MP_ROM_QSTR(MP_QSTR_take), MP_ROM_PTR(&espcamera_camera_take_obj) },
+    { MP_ROM_QSTR(MP_QSTR_take_frame), MP_ROM_PTR(&espcamera_camera_take_frame_obj) },
+    { MP_ROM_QSTR(MP_QSTR_release_frame), MP_ROM_PTR(&espcamera_camera_release_frame_obj) },
     { MP_ROM_QSTR(MP_QSTR_vflip), MP_ROM_PTR(&espcamera_camera_vflip_obj) },
     { MP_ROM_QSTR(MP_QSTR_wb_mode), MP_ROM_PTR(&espcamera_camera_wb_mode_obj) },
     { MP_ROM_QSTR(MP_QSTR_whitebal), MP_ROM_PTR(&espcamera_camera_whitebal_obj) },
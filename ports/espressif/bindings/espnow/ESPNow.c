@@ -56,7 +56,9 @@ static void espnow_check_for_deinit(espnow_obj_t *self) {
 //|     def __init__(self, buffer_size: int = 526, phy_rate: int = 0) -> None:
 //|         """Allocate and initialize `ESPNow` instance as a singleton.
 //|
-//|         :param int buffer_size: The size of the internal ring buffer. Default: 526 bytes.
+//|         :param int buffer_size: The size of the internal receive buffer. Default: 526 bytes.
+//|             It is divided into slots of 263 bytes, each holding one received packet
+//|             of any length, with at least one slot.
 //|         :param int phy_rate: The ESP-NOW physical layer rate. Default: 1 Mbps.
 //|             `wifi_phy_rate_t <https://docs.espressif.com/projects/esp-idf/en/release-v4.4/esp32/api-reference/network/esp_wifi.html#_CPPv415wifi_phy_rate_t>`_
 //|         """
@@ -171,6 +173,68 @@ STATIC mp_obj_t espnow_read(mp_obj_t self_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(espnow_read_obj, espnow_read);
 
+//|     def read_into(self, buffer: WriteableBuffer, mac: Optional[WriteableBuffer] = None) -> Optional[int]:
+//|         """Read the message of a packet from the receive buffer into ``buffer``,
+//|         without allocating.
+//|
+//|         This is non-blocking. If ``buffer`` is too small for the message, `ValueError`
+//|         is raised and the packet is left to be read again.
+//|
+//|         :param WriteableBuffer buffer: Where to store the message (up to 250 bytes).
+//|         :param WriteableBuffer mac: If given, where to store the 6-byte mac address of the sender.
+//|         :returns: The length of the message, or `None` if no packet is available."""
+//|         ...
+STATIC mp_obj_t espnow_read_into(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_mac };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer,   MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_mac,      MP_ARG_OBJ, { .u_obj = mp_const_none } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    espnow_obj_t *self = pos_args[0];
+    espnow_check_for_deinit(self);
+
+    mp_buffer_info_t buffer;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &buffer, MP_BUFFER_WRITE);
+
+    mp_buffer_info_t mac_buffer;
+    const mp_buffer_info_t *mac = NULL;
+    if (args[ARG_mac].u_obj != mp_const_none) {
+        mp_get_buffer_raise(args[ARG_mac].u_obj, &mac_buffer, MP_BUFFER_WRITE);
+        mp_arg_validate_length_min(mac_buffer.len, ESP_NOW_ETH_ALEN, MP_QSTR_mac);
+        mac = &mac_buffer;
+    }
+
+    return common_hal_espnow_read_into(self, &buffer, mac);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(espnow_read_into_obj, 2, espnow_read_into);
+
+//|     def read_records(self, buffer: WriteableBuffer) -> int:
+//|         """Read as many packets as fit into ``buffer`` without allocating.
+//|
+//|         This is non-blocking. Each packet is stored as a 263-byte record that can
+//|         be unpacked with ``struct.unpack_from("<xBIb6s", buffer, offset)``, giving
+//|         the message length, the timestamp (ms), the RSSI (dBm) and the mac address.
+//|         The message starts 13 bytes into the record; the rest of the record is
+//|         left unchanged.
+//|
+//|         :param WriteableBuffer buffer: Where to store the records.
+//|         :returns: The number of records stored, at most ``len(buffer) // 263``."""
+//|         ...
+STATIC mp_obj_t espnow_read_records(mp_obj_t self_in, mp_obj_t buffer_in) {
+    espnow_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    espnow_check_for_deinit(self);
+
+    mp_buffer_info_t buffer;
+    mp_get_buffer_raise(buffer_in, &buffer, MP_BUFFER_WRITE);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_espnow_read_records(self, &buffer));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(espnow_read_records_obj, espnow_read_records);
+
 //|     send_success: int
 //|     """The number of tx packets received by the peer(s) ``ESP_NOW_SEND_SUCCESS``. (read-only)"""
 //|
@@ -233,7 +297,7 @@ STATIC mp_obj_t espnow_set_pmk(mp_obj_t self_in, mp_obj_t key) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(espnow_set_pmk_obj, espnow_set_pmk);
 
 //|     buffer_size: int
-//|     """The size of the internal ring buffer. (read-only)"""
+//|     """The size of the internal receive buffer. (read-only)"""
 //|
 STATIC mp_obj_t espnow_get_buffer_size(const mp_obj_t self_in) {
     espnow_obj_t *self = MP_OBJ_TO_PTR(self_in);
@@ -296,6 +360,8 @@ STATIC const mp_rom_map_elem_t espnow_locals_dict_table[] = {
 
     // Read messages
     { MP_ROM_QSTR(MP_QSTR_read),         MP_ROM_PTR(&espnow_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_into),    MP_ROM_PTR(&espnow_read_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_records), MP_ROM_PTR(&espnow_read_records_obj) },
     { MP_ROM_QSTR(MP_QSTR_read_success), MP_ROM_PTR(&espnow_read_success_obj)},
     { MP_ROM_QSTR(MP_QSTR_read_failure), MP_ROM_PTR(&espnow_read_failure_obj)},
 
@@ -320,7 +386,7 @@ STATIC mp_uint_t espnow_stream_ioctl(mp_obj_t self_in, mp_uint_t request, uintpt
         case MP_STREAM_POLL: {
             mp_uint_t flags = arg;
             mp_uint_t ret = 0;
-            if ((flags & MP_STREAM_POLL_RD) && ringbuf_num_filled(self->recv_buffer) > 0) {
+            if ((flags & MP_STREAM_POLL_RD) && common_hal_espnow_packets_available(self) > 0) {
                 ret |= MP_STREAM_POLL_RD;
             }
             return ret;
@@ -347,7 +413,7 @@ STATIC const mp_stream_p_t espnow_stream_p = {
 STATIC mp_obj_t espnow_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
     espnow_obj_t *self = MP_OBJ_TO_PTR(self_in);
     espnow_check_for_deinit(self);
-    size_t len = ringbuf_num_filled(self->recv_buffer);
+    size_t len = common_hal_espnow_bytes_available(self);
     switch (op) {
         case MP_UNARY_OP_BOOL:
             return mp_obj_new_bool(len != 0);
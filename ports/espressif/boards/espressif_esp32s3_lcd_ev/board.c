@@ -122,7 +122,9 @@ void board_init(void) {
         /* de_idle_high */ false,
         /* pclk_active_high */ true,
         /* pclk_idle_high */ false,
-        /* overscan_left */ 0
+        /* overscan_left */ 0,
+        /* bounce_buffer_rows */ 0,
+        /* double_buffer */ false
         );
 
     framebufferio_framebufferdisplay_obj_t *disp = &allocate_display_or_raise()->framebuffer_display;
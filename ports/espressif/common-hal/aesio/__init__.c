@@ -0,0 +1,93 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+
+#include "shared-bindings/aesio/__init__.h"
+
+void common_hal_aesio_aes_construct(aesio_aes_obj_t *self, const uint8_t *key,
+    uint32_t key_length, const uint8_t *iv,
+    int mode, int counter) {
+    self->mode = mode;
+    self->counter = counter;
+    mbedtls_aes_init(&self->encrypt_ctx);
+    mbedtls_aes_init(&self->decrypt_ctx);
+    common_hal_aesio_aes_rekey(self, key, key_length, iv);
+}
+
+void common_hal_aesio_aes_rekey(aesio_aes_obj_t *self, const uint8_t *key,
+    uint32_t key_length, const uint8_t *iv) {
+    mbedtls_aes_setkey_enc(&self->encrypt_ctx, key, key_length * 8);
+    mbedtls_aes_setkey_dec(&self->decrypt_ctx, key, key_length * 8);
+    if (iv != NULL) {
+        memcpy(self->iv, iv, AES_BLOCKLEN);
+    } else {
+        memset(self->iv, 0, AES_BLOCKLEN);
+    }
+}
+
+void common_hal_aesio_aes_set_mode(aesio_aes_obj_t *self, int mode) {
+    self->mode = mode;
+}
+
+// Like the software implementation, each CTR call starts on a new counter block.
+STATIC void aesio_aes_ctr(aesio_aes_obj_t *self, uint8_t *buffer, size_t length) {
+    size_t nc_off = 0;
+    uint8_t stream_block[AES_BLOCKLEN];
+    mbedtls_aes_crypt_ctr(&self->encrypt_ctx, length, &nc_off, self->iv, stream_block, buffer, buffer);
+}
+
+void common_hal_aesio_aes_encrypt(aesio_aes_obj_t *self, uint8_t *buffer,
+    size_t length) {
+    switch (self->mode) {
+        case AES_MODE_ECB:
+            mbedtls_aes_crypt_ecb(&self->encrypt_ctx, MBEDTLS_AES_ENCRYPT, buffer, buffer);
+            break;
+        case AES_MODE_CBC:
+            mbedtls_aes_crypt_cbc(&self->encrypt_ctx, MBEDTLS_AES_ENCRYPT, length, self->iv, buffer, buffer);
+            break;
+        case AES_MODE_CTR:
+            aesio_aes_ctr(self, buffer, length);
+            break;
+    }
+}
+
+void common_hal_aesio_aes_decrypt(aesio_aes_obj_t *self, uint8_t *buffer,
+    size_t length) {
+    switch (self->mode) {
+        case AES_MODE_ECB:
+            mbedtls_aes_crypt_ecb(&self->decrypt_ctx, MBEDTLS_AES_DECRYPT, buffer, buffer);
+            break;
+        case AES_MODE_CBC:
+            mbedtls_aes_crypt_cbc(&self->decrypt_ctx, MBEDTLS_AES_DECRYPT, length, self->iv, buffer, buffer);
+            break;
+        case AES_MODE_CTR:
+            aesio_aes_ctr(self, buffer, length);
+            break;
+    }
+}
@@ -316,3 +316,22 @@ uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t
     #endif // DEBUG_ANALOGBUFIO
     return captured_samples;
 }
+
+void common_hal_analogbufio_bufferedin_start_continuous(analogbufio_bufferedin_obj_t *self, mp_obj_t ring_obj, uint8_t *ring, uint32_t len, uint8_t bytes_per_sample) {
+    mp_raise_NotImplementedError(NULL);
+}
+
+void common_hal_analogbufio_bufferedin_stop_continuous(analogbufio_bufferedin_obj_t *self) {
+}
+
+bool common_hal_analogbufio_bufferedin_get_continuous(analogbufio_bufferedin_obj_t *self) {
+    return false;
+}
+
+uint64_t common_hal_analogbufio_bufferedin_get_sample_count(analogbufio_bufferedin_obj_t *self) {
+    return 0;
+}
+
+uint32_t common_hal_analogbufio_bufferedin_get_overruns(analogbufio_bufferedin_obj_t *self) {
+    return 0;
+}
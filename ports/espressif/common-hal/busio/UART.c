@@ -47,6 +47,10 @@ static void uart_event_task(void *param) {
     uart_event_t event;
     while (true) {
         if (xQueueReceive(self->event_queue, &event, portMAX_DELAY)) {
+            if (self->wake_on_rx) {
+                self->wake_on_rx = false;
+                port_wake_main_task();
+            }
             switch (event.type) {
                 case UART_BREAK:
                 case UART_PATTERN_DET:
@@ -404,6 +408,16 @@ uint32_t common_hal_busio_uart_rx_characters_available(busio_uart_obj_t *self) {
     return count;
 }
 
+bool common_hal_busio_uart_wake_when_ready(busio_uart_obj_t *self, mp_uint_t flags) {
+    // Only received data raises UART events.
+    if (flags & ~MP_STREAM_POLL_RD) {
+        return false;
+    }
+    // Arm before checking so that data arriving in between still wakes us.
+    self->wake_on_rx = true;
+    return common_hal_busio_uart_rx_characters_available(self) == 0;
+}
+
 void common_hal_busio_uart_clear_rx_buffer(busio_uart_obj_t *self) {
     uart_flush(self->uart_num);
 }
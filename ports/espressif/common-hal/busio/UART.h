@@ -47,6 +47,8 @@ typedef struct {
     bool rx_error;
     uint32_t timeout_ms;
     bool is_console;
+    // Wake the main task on the next UART event.
+    volatile bool wake_on_rx;
     QueueHandle_t event_queue;
     TaskHandle_t event_task;
 } busio_uart_obj_t;
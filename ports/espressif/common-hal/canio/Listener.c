@@ -67,6 +67,22 @@ STATIC void install_all_match_filter(canio_listener_obj_t *self) {
     self->standard = true;
 }
 
+// Combine matches of one id length into the narrowest single filter that
+// accepts all of them: only bits that every match compares, and on which every
+// match agrees, are kept in the mask.
+STATIC void install_combined_filter(canio_listener_obj_t *self, size_t nmatch, canio_match_obj_t **matches) {
+    canio_match_obj_t combined = *matches[0];
+    for (size_t i = 1; i < nmatch; i++) {
+        combined.mask &= matches[i]->mask & ~(matches[i]->id ^ combined.id);
+    }
+    combined.id &= combined.mask;
+    if (combined.extended) {
+        install_extended_filter(self, &combined);
+    } else {
+        install_standard_filter(self, &combined);
+    }
+}
+
 __attribute__((noinline, optimize("O0")))
 STATIC void set_filters(canio_listener_obj_t *self, size_t nmatch, canio_match_obj_t **matches) {
     twai_ll_enter_reset_mode(&TWAI);
@@ -74,24 +90,49 @@ STATIC void set_filters(canio_listener_obj_t *self, size_t nmatch, canio_match_o
     if (!nmatch) {
         install_all_match_filter(self);
     } else {
-        canio_match_obj_t *match = matches[0];
-        if (match->extended) {
-            install_extended_filter(self, match);
+        bool mixed = false;
+        for (size_t i = 1; i < nmatch; i++) {
+            mixed |= matches[i]->extended != matches[0]->extended;
+        }
+        if (mixed) {
+            install_all_match_filter(self);
         } else {
-            install_standard_filter(self, match);
+            install_combined_filter(self, nmatch, matches);
         }
     }
 
     twai_ll_exit_reset_mode(&TWAI);
 }
 
+STATIC bool software_filter_accepts(canio_listener_obj_t *self, const twai_message_t *message) {
+    if (!self->nmatch) {
+        return true;
+    }
+    for (size_t i = 0; i < self->nmatch; i++) {
+        canio_match_obj_t *match = &self->matches[i];
+        if (match->extended == (bool)message->extd
+            && ((message->identifier ^ match->id) & match->mask) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
 
 void common_hal_canio_listener_construct(canio_listener_obj_t *self, canio_can_obj_t *can, size_t nmatch, canio_match_obj_t **matches, float timeout) {
     if (can->fifo_in_use) {
         mp_raise_ValueError(MP_ERROR_TEXT("All RX FIFOs in use"));
     }
+
+    // A single match is exact in hardware; more are narrowed by the hardware
+    // filter and then checked in software.
+    self->matches = NULL;
+    self->nmatch = 0;
     if (nmatch > 1) {
-        mp_raise_ValueError(MP_ERROR_TEXT("Filters too complex"));
+        self->matches = m_malloc(nmatch * sizeof(canio_match_obj_t));
+        for (size_t i = 0; i < nmatch; i++) {
+            self->matches[i] = *matches[i];
+        }
+        self->nmatch = nmatch;
     }
 
     // Nothing can fail now so it's safe to assign self->can
@@ -130,33 +171,37 @@ int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self) {
         if (!self->message_in.extd && self->standard) {
             self->pending = true;
         }
+        if (self->pending) {
+            self->pending = software_filter_accepts(self, &self->message_in);
+        }
     }
     return self->pending;
 }
 
-mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+STATIC bool listener_wait(canio_listener_obj_t *self) {
     if (!common_hal_canio_listener_in_waiting(self)) {
         uint64_t deadline = supervisor_ticks_ms64() + self->timeout_ms;
         do {
             if (supervisor_ticks_ms64() > deadline) {
-                return NULL;
+                return false;
             }
             RUN_BACKGROUND_TASKS;
             // Allow user to break out of a timeout with a KeyboardInterrupt.
             if (mp_hal_is_interrupted()) {
-                return NULL;
+                return false;
             }
         } while (!common_hal_canio_listener_in_waiting(self));
     }
+    return true;
+}
 
+// Move the pending message out of the holding area. Returns true for a remote transmission request.
+STATIC bool listener_read(canio_listener_obj_t *self, canio_message_obj_t *message) {
     bool rtr = self->message_in.rtr;
 
-    int dlc = self->message_in.data_length_code;
-    canio_message_obj_t *message =
-        mp_obj_malloc(canio_message_obj_t, rtr ? &canio_remote_transmission_request_type : &canio_message_type);
     message->extended = self->message_in.extd;
     message->id = self->message_in.identifier;
-    message->size = dlc;
+    message->size = self->message_in.data_length_code;
 
     if (!rtr) {
         MP_STATIC_ASSERT(sizeof(self->message_in.data) == sizeof(message->data));
@@ -164,13 +209,40 @@ mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
     }
 
     self->pending = false;
+    return rtr;
+}
 
+mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+    if (!listener_wait(self)) {
+        return NULL;
+    }
+    canio_message_obj_t *message = mp_obj_malloc(canio_message_obj_t, &canio_message_type);
+    if (listener_read(self, message)) {
+        message->base.type = &canio_remote_transmission_request_type;
+    }
     return message;
 }
 
+size_t common_hal_canio_listener_receive_into(canio_listener_obj_t *self, uint8_t *records, size_t max_records) {
+    if (max_records == 0 || !listener_wait(self)) {
+        return 0;
+    }
+    size_t count = 0;
+    do {
+        canio_message_obj_t message;
+        bool rtr = listener_read(self, &message);
+        canio_message_pack_record(&message, rtr, records + count * CANIO_LISTENER_RECORD_SIZE);
+        count++;
+    } while (count < max_records && common_hal_canio_listener_in_waiting(self));
+    return count;
+}
+
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self) {
     if (self->can) {
         self->can->fifo_in_use = false;
     }
     self->can = NULL;
+    m_free(self->matches);
+    self->matches = NULL;
+    self->nmatch = 0;
 }
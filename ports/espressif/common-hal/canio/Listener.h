@@ -37,4 +37,8 @@ typedef struct canio_listener_obj {
     bool pending : 1;
     twai_message_t message_in;
     uint32_t timeout_ms;
+    // When the matches don't fit the single hardware acceptance filter, the
+    // hardware accepts a superset and these are checked in software.
+    canio_match_obj_t *matches;
+    size_t nmatch;
 } canio_listener_obj_t;
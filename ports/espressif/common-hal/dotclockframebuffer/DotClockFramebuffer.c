@@ -25,6 +25,7 @@
  */
 
 #include <stdint.h>
+#include <string.h>
 
 #include "esp_intr_alloc.h"
 #include "esp_lcd_panel_interface.h"
@@ -48,6 +49,7 @@
 #include "common-hal/espidf/__init__.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "py/runtime.h"
+#include "supervisor/shared/tick.h"
 #include "components/driver/gpio/include/driver/gpio.h"
 #include "components/esp_rom/include/esp_rom_gpio.h"
 #include "components/hal/esp32s3/include/hal/lcd_ll.h"
@@ -72,6 +74,12 @@ static void claim_and_record(const mcu_pin_obj_t *pin, uint64_t *used_pins_mask)
     }
 }
 
+static IRAM_ATTR bool on_vsync(esp_lcd_panel_handle_t panel, const esp_lcd_rgb_panel_event_data_t *edata, void *user_ctx) {
+    dotclockframebuffer_framebuffer_obj_t *self = user_ctx;
+    self->frame_count++;
+    return false;
+}
+
 static int valid_pin(const mcu_pin_obj_t *pin, qstr name) {
     int result = common_hal_mcu_pin_number(pin);
     if (result == NO_PIN) {
@@ -91,11 +99,16 @@ void common_hal_dotclockframebuffer_framebuffer_construct(dotclockframebuffer_fr
     int frequency, int width, int height,
     int hsync_pulse_width, int hsync_back_porch, int hsync_front_porch, bool hsync_idle_low,
     int vsync_pulse_width, int vsync_back_porch, int vsync_front_porch, bool vsync_idle_low,
-    bool de_idle_high, bool pclk_active_high, bool pclk_idle_high, int overscan_left) {
+    bool de_idle_high, bool pclk_active_high, bool pclk_idle_high, int overscan_left,
+    int bounce_buffer_rows, bool double_buffer) {
 
     if (num_red != 5 || num_green != 6 || num_blue != 5) {
         mp_raise_ValueError(MP_ERROR_TEXT("Must provide 5/6/5 RGB pins"));
     }
+    // The framebuffer must hold a whole number of pairs of bounce buffers.
+    if (bounce_buffer_rows && height % (2 * bounce_buffer_rows) != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_bounce_buffer_rows);
+    }
 
     claim_and_record(de, &self->used_pins_mask);
     claim_and_record(vsync, &self->used_pins_mask);
@@ -161,17 +174,32 @@ void common_hal_dotclockframebuffer_framebuffer_construct(dotclockframebuffer_fr
     cfg->flags.disp_active_low = 0;
     cfg->flags.refresh_on_demand = 0;
     cfg->flags.fb_in_psram = 1; // allocate frame buffer in PSRAM
+    cfg->num_fbs = double_buffer ? 2 : 1;
+    cfg->bounce_buffer_size_px = bounce_buffer_rows * cfg->timings.h_res;
 
     esp_err_t ret = esp_lcd_new_rgb_panel(&self->panel_config, &self->panel_handle);
     cp_check_esp_error(ret);
     cp_check_esp_error(esp_lcd_panel_reset(self->panel_handle));
     cp_check_esp_error(esp_lcd_panel_init(self->panel_handle));
 
+    self->frame_count = 0;
+    esp_lcd_rgb_panel_event_callbacks_t callbacks = {
+        .on_vsync = on_vsync,
+    };
+    cp_check_esp_error(esp_lcd_rgb_panel_register_event_callbacks(self->panel_handle, &callbacks, self));
+
     uint16_t color = 0;
     cp_check_esp_error(self->panel_handle->draw_bitmap(self->panel_handle, 0, 0, 1, 1, &color));
 
     void *fb;
-    cp_check_esp_error(esp_lcd_rgb_panel_get_frame_buffer(self->panel_handle, 1, &fb));
+    self->double_buffer = double_buffer;
+    if (double_buffer) {
+        cp_check_esp_error(esp_lcd_rgb_panel_get_frame_buffer(self->panel_handle, 2, &self->framebuffers[0], &self->framebuffers[1]));
+        // The panel starts out showing the first buffer, so draw into the second.
+        fb = self->framebuffers[1];
+    } else {
+        cp_check_esp_error(esp_lcd_rgb_panel_get_frame_buffer(self->panel_handle, 1, &fb));
+    }
 
     self->frequency = frequency;
     self->width = width;
@@ -223,8 +251,46 @@ mp_int_t common_hal_dotclockframebuffer_framebuffer_get_first_pixel_offset(dotcl
     return self->first_pixel_offset;
 }
 
+// Wait for the given number of vsyncs, giving up after a few frames' time in
+// case the panel has stopped.
+static void wait_for_frames(dotclockframebuffer_framebuffer_obj_t *self, int32_t frames) {
+    int32_t start = self->frame_count;
+    uint64_t deadline = supervisor_ticks_ms64() + (frames + 2) * 1000 / MAX(self->refresh_rate, 1u);
+    while (self->frame_count - start < frames && supervisor_ticks_ms64() < deadline) {
+        RUN_BACKGROUND_TASKS;
+    }
+}
+
+void common_hal_dotclockframebuffer_framebuffer_swapbuffers(dotclockframebuffer_framebuffer_obj_t *self, const uint8_t *dirty_row_bitmap) {
+    uint8_t *drawn = self->bufinfo.buf;
+    Cache_WriteBack_Addr((uint32_t)drawn, self->bufinfo.len);
+    if (!self->double_buffer) {
+        return;
+    }
+
+    // The panel switches to the drawn buffer when its current frame ends. The
+    // frame after that may already have been fetched from the old buffer, so
+    // wait for two vsyncs before writing to it.
+    cp_check_esp_error(esp_lcd_panel_draw_bitmap(self->panel_handle, 0, 0, self->width, self->panel_config.timings.v_res, drawn));
+    wait_for_frames(self, 2);
+
+    // Bring the next buffer up to date with the rows drawn this time, because
+    // only the changed parts of the next frame get drawn into it.
+    uint8_t *next = self->framebuffers[self->framebuffers[0] == drawn ? 1 : 0];
+    if (dirty_row_bitmap == NULL) {
+        memcpy(next, drawn, self->bufinfo.len);
+    } else {
+        for (mp_int_t row = 0; row < self->panel_config.timings.v_res; row++) {
+            if (dirty_row_bitmap[row / 8] & (1 << (row & 7))) {
+                memcpy(next + row * self->row_stride, drawn + row * self->row_stride, self->row_stride);
+            }
+        }
+    }
+    self->bufinfo.buf = next;
+}
+
 void common_hal_dotclockframebuffer_framebuffer_refresh(dotclockframebuffer_framebuffer_obj_t *self) {
-    Cache_WriteBack_Addr((uint32_t)(self->bufinfo.buf), self->bufinfo.len);
+    common_hal_dotclockframebuffer_framebuffer_swapbuffers(self, NULL);
 }
 
 mp_int_t common_hal_dotclockframebuffer_framebuffer_get_refresh_rate(dotclockframebuffer_framebuffer_obj_t *self) {
@@ -41,7 +41,11 @@ typedef struct dotclockframebuffer_framebuffer_obj {
     uint32_t frequency, refresh_rate;
     uint32_t first_pixel_offset;
     uint64_t used_pins_mask;
+    // Counted up at each vsync.
     volatile int32_t frame_count;
+    // Both framebuffers when double buffered. bufinfo.buf is the one drawn into.
+    void *framebuffers[2];
+    bool double_buffer;
     esp_lcd_rgb_panel_config_t panel_config;
     esp_lcd_panel_handle_t panel_handle;
 } dotclockframebuffer_framebuffer_obj_t;
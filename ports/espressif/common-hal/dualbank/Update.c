@@ -0,0 +1,161 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "common-hal/dualbank/__init__.h"
+#include "shared-bindings/dualbank/Update.h"
+
+#include "esp_log.h"
+#include "py/runtime.h"
+
+static const char *TAG = "dualbank";
+
+// Only one update can write the next-update partition at a time.
+static dualbank_update_obj_t *active_update = NULL;
+
+bool dualbank_update_in_progress(void) {
+    return active_update != NULL;
+}
+
+void dualbank_update_reset(void) {
+    if (active_update != NULL) {
+        common_hal_dualbank_update_deinit(active_update);
+    }
+}
+
+static void __attribute__((noreturn)) update_failed(dualbank_update_obj_t *self, esp_err_t err) {
+    ESP_LOGE(TAG, "update failed (%s)", esp_err_to_name(err));
+    common_hal_dualbank_update_deinit(self);
+    if (err == ESP_ERR_OTA_VALIDATE_FAILED) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Firmware is invalid"));
+    }
+    mp_raise_RuntimeError(MP_ERROR_TEXT("Update Failed"));
+}
+
+void common_hal_dualbank_update_construct(dualbank_update_obj_t *self, const uint8_t *expected_sha256) {
+    if (active_update != NULL || dualbank_flash_in_progress()) {
+        mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("%q in use"), MP_QSTR_Update);
+    }
+
+    self->partition = esp_ota_get_next_update_partition(NULL);
+    if (self->partition == NULL) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Update Failed"));
+    }
+    // Erase sectors as they are reached instead of the whole partition up front.
+    esp_err_t err = esp_ota_begin(self->partition, OTA_WITH_SEQUENTIAL_WRITES, &self->handle);
+    if (err != ESP_OK) {
+        self->partition = NULL;
+        ESP_LOGE(TAG, "esp_ota_begin failed (%s)", esp_err_to_name(err));
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Update Failed"));
+    }
+
+    mbedtls_sha256_init(&self->sha256);
+    mbedtls_sha256_starts(&self->sha256, 0);
+    self->offset = 0;
+    self->check_sha256 = expected_sha256 != NULL;
+    if (self->check_sha256) {
+        memcpy(self->expected_sha256, expected_sha256, sizeof(self->expected_sha256));
+    }
+    active_update = self;
+}
+
+bool common_hal_dualbank_update_deinited(dualbank_update_obj_t *self) {
+    return self->partition == NULL;
+}
+
+void common_hal_dualbank_update_deinit(dualbank_update_obj_t *self) {
+    if (common_hal_dualbank_update_deinited(self)) {
+        return;
+    }
+    if (self->handle != 0) {
+        esp_ota_abort(self->handle);
+        self->handle = 0;
+    }
+    mbedtls_sha256_free(&self->sha256);
+    self->partition = NULL;
+    if (active_update == self) {
+        active_update = NULL;
+    }
+}
+
+void common_hal_dualbank_update_write(dualbank_update_obj_t *self, const uint8_t *buf, size_t len) {
+    // Keep the start of the image until its version can be checked, so that chunks of any size work.
+    if (self->offset < DUALBANK_UPDATE_HEADER_SIZE) {
+        size_t header_len = MIN(len, DUALBANK_UPDATE_HEADER_SIZE - self->offset);
+        memcpy(self->header + self->offset, buf, header_len);
+        if (self->offset + header_len == DUALBANK_UPDATE_HEADER_SIZE) {
+            nlr_buf_t nlr;
+            if (nlr_push(&nlr) == 0) {
+                dualbank_check_new_app(self->header);
+                nlr_pop();
+            } else {
+                common_hal_dualbank_update_deinit(self);
+                nlr_jump(nlr.ret_val);
+            }
+        }
+    }
+
+    esp_err_t err = esp_ota_write(self->handle, buf, len);
+    if (err != ESP_OK) {
+        update_failed(self, err);
+    }
+    mbedtls_sha256_update(&self->sha256, buf, len);
+    self->offset += len;
+}
+
+size_t common_hal_dualbank_update_get_offset(dualbank_update_obj_t *self) {
+    return self->offset;
+}
+
+void common_hal_dualbank_update_get_sha256(dualbank_update_obj_t *self, uint8_t digest[32]) {
+    // Finish a copy so that more data can still be added.
+    mbedtls_sha256_context copy;
+    mbedtls_sha256_init(&copy);
+    mbedtls_sha256_clone(&copy, &self->sha256);
+    mbedtls_sha256_finish(&copy, digest);
+    mbedtls_sha256_free(&copy);
+}
+
+void common_hal_dualbank_update_finish(dualbank_update_obj_t *self) {
+    if (self->check_sha256) {
+        uint8_t digest[32];
+        common_hal_dualbank_update_get_sha256(self, digest);
+        if (memcmp(digest, self->expected_sha256, sizeof(digest)) != 0) {
+            ESP_LOGE(TAG, "SHA-256 of image does not match");
+            common_hal_dualbank_update_deinit(self);
+            mp_raise_RuntimeError(MP_ERROR_TEXT("Firmware is invalid"));
+        }
+    }
+
+    // esp_ota_end() validates the image and releases the handle even when it fails.
+    esp_err_t err = esp_ota_end(self->handle);
+    self->handle = 0;
+    if (err != ESP_OK) {
+        update_failed(self, err);
+    }
+    common_hal_dualbank_update_deinit(self);
+}
@@ -25,6 +25,7 @@
  */
 
 #include "common-hal/dualbank/__init__.h"
+#include "common-hal/dualbank/Update.h"
 #include "shared-bindings/dualbank/__init__.h"
 
 #include <string.h>
@@ -43,6 +44,44 @@ void dualbank_reset(void) {
         update_handle = 0;
         update_partition = NULL;
     }
+    dualbank_update_reset();
+}
+
+bool dualbank_flash_in_progress(void) {
+    return update_handle != 0;
+}
+
+void dualbank_check_new_app(const void *image_start) {
+    const esp_partition_t *running = esp_ota_get_running_partition();
+    const esp_partition_t *last_invalid = esp_ota_get_last_invalid_partition();
+
+    esp_app_desc_t new_app_info;
+    memcpy(&new_app_info, &((const char *)image_start)[sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t)], sizeof(esp_app_desc_t));
+    ESP_LOGI(TAG, "New firmware version: %s", new_app_info.version);
+
+    esp_app_desc_t running_app_info;
+    if (esp_ota_get_partition_description(running, &running_app_info) == ESP_OK) {
+        ESP_LOGI(TAG, "Running firmware version: %s", running_app_info.version);
+    }
+
+    esp_app_desc_t invalid_app_info;
+    if (esp_ota_get_partition_description(last_invalid, &invalid_app_info) == ESP_OK) {
+        ESP_LOGI(TAG, "Last invalid firmware version: %s", invalid_app_info.version);
+    }
+
+    // check new version with running version
+    if (memcmp(new_app_info.version, running_app_info.version, sizeof(new_app_info.version)) == 0) {
+        ESP_LOGW(TAG, "New version is the same as running version.");
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Firmware is duplicate"));
+    }
+
+    // check new version with last invalid partition
+    if (last_invalid != NULL) {
+        if (memcmp(new_app_info.version, invalid_app_info.version, sizeof(new_app_info.version)) == 0) {
+            ESP_LOGW(TAG, "New version is the same as invalid version.");
+            mp_raise_RuntimeError(MP_ERROR_TEXT("Firmware is invalid"));
+        }
+    }
 }
 
 static void __attribute__((noreturn)) task_fatal_error(void) {
@@ -53,8 +92,11 @@ static void __attribute__((noreturn)) task_fatal_error(void) {
 void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t offset) {
     esp_err_t err;
 
+    if (dualbank_update_in_progress()) {
+        mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("%q in use"), MP_QSTR_Update);
+    }
+
     const esp_partition_t *running = esp_ota_get_running_partition();
-    const esp_partition_t *last_invalid = esp_ota_get_last_invalid_partition();
 
     if (update_partition == NULL) {
         update_partition = esp_ota_get_next_update_partition(NULL);
@@ -69,33 +111,7 @@ void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t o
 
     if (update_handle == 0) {
         if (len > sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t) + sizeof(esp_app_desc_t)) {
-            esp_app_desc_t new_app_info;
-            memcpy(&new_app_info, &((char *)buf)[sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t)], sizeof(esp_app_desc_t));
-            ESP_LOGI(TAG, "New firmware version: %s", new_app_info.version);
-
-            esp_app_desc_t running_app_info;
-            if (esp_ota_get_partition_description(running, &running_app_info) == ESP_OK) {
-                ESP_LOGI(TAG, "Running firmware version: %s", running_app_info.version);
-            }
-
-            esp_app_desc_t invalid_app_info;
-            if (esp_ota_get_partition_description(last_invalid, &invalid_app_info) == ESP_OK) {
-                ESP_LOGI(TAG, "Last invalid firmware version: %s", invalid_app_info.version);
-            }
-
-            // check new version with running version
-            if (memcmp(new_app_info.version, running_app_info.version, sizeof(new_app_info.version)) == 0) {
-                ESP_LOGW(TAG, "New version is the same as running version.");
-                mp_raise_RuntimeError(MP_ERROR_TEXT("Firmware is duplicate"));
-            }
-
-            // check new version with last invalid partition
-            if (last_invalid != NULL) {
-                if (memcmp(new_app_info.version, invalid_app_info.version, sizeof(new_app_info.version)) == 0) {
-                    ESP_LOGW(TAG, "New version is the same as invalid version.");
-                    mp_raise_RuntimeError(MP_ERROR_TEXT("Firmware is invalid"));
-                }
-            }
+            dualbank_check_new_app(buf);
 
             err = esp_ota_begin(update_partition, OTA_SIZE_UNKNOWN, &update_handle);
             if (err != ESP_OK) {
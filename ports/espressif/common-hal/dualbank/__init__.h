@@ -27,6 +27,12 @@
 #ifndef MICROPY_INCLUDED_ESPRESSIF_COMMON_HAL_DUALBANK___INIT___H
 #define MICROPY_INCLUDED_ESPRESSIF_COMMON_HAL_DUALBANK___INIT___H
 
+#include <stdbool.h>
+
 extern void dualbank_reset(void);
 
+// For internal use by dualbank.Update.
+extern bool dualbank_flash_in_progress(void);
+extern void dualbank_check_new_app(const void *image_start);
+
 #endif // MICROPY_INCLUDED_ESPRESSIF_COMMON_HAL_DUALBANK___INIT___H
@@ -24,6 +24,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "py/mperrno.h"
 #include "py/runtime.h"
 
@@ -155,7 +157,10 @@ extern void common_hal_espcamera_camera_deinit(espcamera_camera_obj_t *self) {
     reset_pin_number(self->camera_config.pin_d1);
     reset_pin_number(self->camera_config.pin_d0);
 
+    // The driver frees all framebuffers, including any still lent out.
     esp_camera_deinit();
+    self->buffer_to_return = NULL;
+    memset(self->lent, 0, sizeof(self->lent));
 
     reset_pin_number(self->camera_config.pin_pclk);
     reset_pin_number(self->camera_config.pin_vsync);
@@ -180,6 +185,28 @@ camera_fb_t *common_hal_espcamera_camera_take(espcamera_camera_obj_t *self, int
     return self->buffer_to_return = esp_camera_fb_get_timeout(timeout_ms);
 }
 
+camera_fb_t *common_hal_espcamera_camera_take_frame(espcamera_camera_obj_t *self, int timeout_ms) {
+    // With every framebuffer lent out the driver has nowhere to capture to, so
+    // this times out unless there is a free slot.
+    for (size_t i = 0; i < ESPCAMERA_MAX_FRAMEBUFFERS; i++) {
+        if (self->lent[i] == NULL) {
+            return self->lent[i] = esp_camera_fb_get_timeout(timeout_ms);
+        }
+    }
+    return NULL;
+}
+
+bool common_hal_espcamera_camera_release_frame(espcamera_camera_obj_t *self, const void *buf) {
+    for (size_t i = 0; i < ESPCAMERA_MAX_FRAMEBUFFERS; i++) {
+        if (self->lent[i] != NULL && self->lent[i]->buf == buf) {
+            esp_camera_fb_return(self->lent[i]);
+            self->lent[i] = NULL;
+            return true;
+        }
+    }
+    return false;
+}
+
 #define SENSOR_GETSET(type, name, field_name, setter_function_name) \
     SENSOR_GET(type, name, field_name, setter_function_name) \
     SENSOR_SET(type, name, setter_function_name)
@@ -232,7 +259,10 @@ void common_hal_espcamera_camera_reconfigure(espcamera_camera_obj_t *self, frame
     }
 
     i2c_lock(self);
+    // cam_deinit() frees the framebuffers, so forget any that were handed out.
     cam_deinit();
+    self->buffer_to_return = NULL;
+    memset(self->lent, 0, sizeof(self->lent));
     self->camera_config.pixel_format = pixel_format;
     self->camera_config.frame_size = frame_size;
     self->camera_config.grab_mode = grab_mode;
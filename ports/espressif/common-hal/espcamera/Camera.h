@@ -31,10 +31,14 @@
 #include "shared-bindings/pwmio/PWMOut.h"
 #include "common-hal/busio/I2C.h"
 
+// Upper limit for framebuffer_count, and so for frames lent out by take_frame().
+#define ESPCAMERA_MAX_FRAMEBUFFERS (4)
+
 typedef struct espcamera_camera_obj {
     mp_obj_base_t base;
     camera_config_t camera_config;
     camera_fb_t *buffer_to_return;
+    camera_fb_t *lent[ESPCAMERA_MAX_FRAMEBUFFERS];
     pwmio_pwmout_obj_t pwm;
     busio_i2c_obj_t *i2c;
 } espcamera_obj_t;
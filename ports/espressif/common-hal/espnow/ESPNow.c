@@ -27,6 +27,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "py/mperrno.h"
 #include "py/runtime.h"
 
@@ -49,15 +51,15 @@
 #define MIN_PACKET_LEN (sizeof(espnow_packet_t))
 #define MAX_PACKET_LEN (sizeof(espnow_packet_t) + ESP_NOW_MAX_DATA_LEN)
 
-// Enough for 2 full-size packets: 2 * (6 + 7 + 250) = 526 bytes
-// Will allocate an additional 7 bytes for buffer overhead
+// Each received packet gets a slot big enough for a full-size packet.
+// The default buffer size of 526 bytes is 2 slots: 2 * (6 + 7 + 250).
 #define DEFAULT_RECV_BUFFER_SIZE (2 * MAX_PACKET_LEN)
 
 // Time to wait (millisec) for responses from sent packets: (2 seconds).
 #define DEFAULT_SEND_TIMEOUT_MS (2000)
 
-// ESPNow packet format for the receive buffer.
-// Use this for peeking at the header of the next packet in the buffer.
+// ESPNow packet format for the receive slots, and for the records
+// returned by read_records().
 typedef struct {
     uint8_t magic;              // = ESPNOW_MAGIC
     uint8_t msg_len;            // Length of the message
@@ -71,6 +73,22 @@ typedef struct {
     uint8_t msg[0];             // Message is up to 250 bytes
 } __attribute__((packed)) espnow_packet_t;
 
+MP_STATIC_ASSERT(MAX_PACKET_LEN == ESPNOW_RECORD_SIZE);
+
+// recv_cb runs in the Wi-Fi task, possibly on the other core, so the slot
+// contents must be visible before the index that hands them over.
+static inline size_t load_index(const size_t *index) {
+    return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+}
+
+static inline void store_index(size_t *index, size_t value) {
+    __atomic_store_n(index, value, __ATOMIC_RELEASE);
+}
+
+static inline espnow_packet_t *recv_slot(espnow_obj_t *self, size_t index) {
+    return (espnow_packet_t *)(self->recv_slots + (index % self->recv_slot_count) * MAX_PACKET_LEN);
+}
+
 // --- The ESP-NOW send and recv callback routines ---
 
 // Callback triggered when a sent packet is acknowledged by the peer (or not).
@@ -86,13 +104,14 @@ static void send_cb(const uint8_t *mac, esp_now_send_status_t status) {
 }
 
 // Callback triggered when an ESP-NOW packet is received.
-// Write the peer MAC address and the message into the recv_buffer as an ESPNow packet.
-// If the buffer is full, drop the message and increment the dropped count.
+// Write the peer MAC address and the message into the next free slot as an ESPNow packet.
+// If all the slots are full, drop the message and increment the dropped count.
 static void recv_cb(const esp_now_recv_info_t *esp_now_info, const uint8_t *msg, int msg_len) {
     espnow_obj_t *self = MP_STATE_PORT(espnow_singleton);
-    ringbuf_t *buf = self->recv_buffer;
+    size_t head = self->recv_head;
 
-    if (sizeof(espnow_packet_t) + msg_len > ringbuf_num_empty(buf)) {
+    if (head - load_index(&self->recv_tail) >= self->recv_slot_count ||
+        msg_len > ESP_NOW_MAX_DATA_LEN) {
         self->read_failure++;
         return;
     }
@@ -110,21 +129,21 @@ static void recv_cb(const esp_now_recv_info_t *esp_now_info, const uint8_t *msg,
         msg - SIZEOF_ESPNOW_FRAME_FORMAT - sizeof(wifi_promiscuous_pkt_t));
     #pragma GCC diagnostic pop
 
-    espnow_header_t header;
-    header.magic = ESPNOW_MAGIC;
-    header.msg_len = msg_len;
-    header.rssi = wifi_packet->rx_ctrl.rssi;
-    header.time_ms = mp_hal_ticks_ms();
+    espnow_packet_t *packet = recv_slot(self, head);
+    packet->header.magic = ESPNOW_MAGIC;
+    packet->header.msg_len = msg_len;
+    packet->header.rssi = wifi_packet->rx_ctrl.rssi;
+    packet->header.time_ms = mp_hal_ticks_ms();
+    memcpy(packet->peer, esp_now_info->src_addr, ESP_NOW_ETH_ALEN);
+    memcpy(packet->msg, msg, msg_len);
 
-    ringbuf_put_n(buf, (uint8_t *)&header, sizeof(header));
-    ringbuf_put_n(buf, esp_now_info->src_addr, ESP_NOW_ETH_ALEN);
-    ringbuf_put_n(buf, msg, msg_len);
+    store_index(&self->recv_head, head + 1);
 
     self->read_success++;
 }
 
 bool common_hal_espnow_deinited(espnow_obj_t *self) {
-    return self == NULL || self->recv_buffer == NULL;
+    return self == NULL || self->recv_slots == NULL;
 }
 
 // Construct the ESPNow object
@@ -142,10 +161,10 @@ void common_hal_espnow_init(espnow_obj_t *self) {
         return;
     }
 
-    self->recv_buffer = m_new_obj(ringbuf_t);
-    if (!ringbuf_alloc(self->recv_buffer, self->recv_buffer_size /*, true*/)) {
-        m_malloc_fail(self->recv_buffer_size);
-    }
+    self->recv_slot_count = MAX(1, self->recv_buffer_size / MAX_PACKET_LEN);
+    self->recv_slots = m_malloc(self->recv_slot_count * MAX_PACKET_LEN);
+    self->recv_head = 0;
+    self->recv_tail = 0;
 
     if (!common_hal_wifi_radio_get_enabled(&common_hal_wifi_radio_obj)) {
         common_hal_wifi_init(false);
@@ -171,8 +190,7 @@ void common_hal_espnow_deinit(espnow_obj_t *self) {
     CHECK_ESP_RESULT(esp_now_unregister_recv_cb());
     CHECK_ESP_RESULT(esp_now_deinit());
 
-    self->recv_buffer->buf = NULL;
-    self->recv_buffer = NULL;
+    self->recv_slots = NULL;
 }
 
 void espnow_reset(void) {
@@ -205,36 +223,87 @@ mp_obj_t common_hal_espnow_send(espnow_obj_t *self, const mp_buffer_info_t *mess
     return mp_const_none;
 }
 
-mp_obj_t common_hal_espnow_read(espnow_obj_t *self) {
-    if (!ringbuf_num_filled(self->recv_buffer)) {
-        return mp_const_none;
+// Return the oldest received packet, or NULL if there is none.
+// It stays in its slot until release_packet() is called.
+static const espnow_packet_t *peek_packet(espnow_obj_t *self) {
+    size_t tail = self->recv_tail;
+    if (tail == load_index(&self->recv_head)) {
+        return NULL;
     }
-
-    // Read the packet header from the incoming buffer
-    espnow_header_t header;
-    if (ringbuf_get_n(self->recv_buffer, (uint8_t *)&header, sizeof(header)) != sizeof(header)) {
+    const espnow_packet_t *packet = recv_slot(self, tail);
+    // Check the packet header format, and drop the packet if it is bad.
+    if (packet->header.magic != ESPNOW_MAGIC || packet->header.msg_len > ESP_NOW_MAX_DATA_LEN) {
+        store_index(&self->recv_tail, tail + 1);
         mp_arg_error_invalid(MP_QSTR_buffer);
     }
+    return packet;
+}
 
-    uint8_t msg_len = header.msg_len;
+static void release_packet(espnow_obj_t *self) {
+    store_index(&self->recv_tail, self->recv_tail + 1);
+}
 
-    uint8_t mac_buf[ESP_NOW_ETH_ALEN];
-    uint8_t msg_buf[msg_len];
+size_t common_hal_espnow_packets_available(espnow_obj_t *self) {
+    return load_index(&self->recv_head) - self->recv_tail;
+}
 
-    // Check the message packet header format and read the message data
-    if (header.magic != ESPNOW_MAGIC ||
-        msg_len > ESP_NOW_MAX_DATA_LEN ||
-        ringbuf_get_n(self->recv_buffer, mac_buf, ESP_NOW_ETH_ALEN) != ESP_NOW_ETH_ALEN ||
-        ringbuf_get_n(self->recv_buffer, msg_buf, msg_len) != msg_len) {
-        mp_arg_error_invalid(MP_QSTR_buffer);
+size_t common_hal_espnow_bytes_available(espnow_obj_t *self) {
+    size_t tail = self->recv_tail;
+    size_t head = load_index(&self->recv_head);
+    size_t len = 0;
+    for (size_t i = tail; i != head; i++) {
+        len += MIN_PACKET_LEN + recv_slot(self, i)->header.msg_len;
+    }
+    return len;
+}
+
+mp_obj_t common_hal_espnow_read(espnow_obj_t *self) {
+    const espnow_packet_t *packet = peek_packet(self);
+    if (packet == NULL) {
+        return mp_const_none;
     }
 
     mp_obj_t elems[4] = {
-        mp_obj_new_bytes(mac_buf, ESP_NOW_ETH_ALEN),
-        mp_obj_new_bytes(msg_buf, msg_len),
-        MP_OBJ_NEW_SMALL_INT(header.rssi),
-        mp_obj_new_int(header.time_ms),
+        mp_obj_new_bytes(packet->peer, ESP_NOW_ETH_ALEN),
+        mp_obj_new_bytes(packet->msg, packet->header.msg_len),
+        MP_OBJ_NEW_SMALL_INT(packet->header.rssi),
+        mp_obj_new_int(packet->header.time_ms),
     };
+    release_packet(self);
 
     return namedtuple_make_new((const mp_obj_type_t *)&espnow_packet_type_obj, 4, 0, elems);
 }
+
+mp_obj_t common_hal_espnow_read_into(espnow_obj_t *self, const mp_buffer_info_t *buffer, const mp_buffer_info_t *mac) {
+    const espnow_packet_t *packet = peek_packet(self);
+    if (packet == NULL) {
+        return mp_const_none;
+    }
+
+    // Leave the packet to be read with a larger buffer.
+    size_t msg_len = packet->header.msg_len;
+    mp_arg_validate_length_min(buffer->len, msg_len, MP_QSTR_buffer);
+
+    memcpy(buffer->buf, packet->msg, msg_len);
+    if (mac != NULL) {
+        memcpy(mac->buf, packet->peer, ESP_NOW_ETH_ALEN);
+    }
+    release_packet(self);
+
+    return MP_OBJ_NEW_SMALL_INT(msg_len);
+}
+
+size_t common_hal_espnow_read_records(espnow_obj_t *self, const mp_buffer_info_t *buffer) {
+    size_t max_count = buffer->len / MAX_PACKET_LEN;
+    uint8_t *record = buffer->buf;
+    size_t count = 0;
+    const espnow_packet_t *packet;
+    while (count < max_count && (packet = peek_packet(self)) != NULL) {
+        // Only the used part of the record is written.
+        memcpy(record, packet, MIN_PACKET_LEN + packet->header.msg_len);
+        release_packet(self);
+        record += MAX_PACKET_LEN;
+        count++;
+    }
+    return count;
+}
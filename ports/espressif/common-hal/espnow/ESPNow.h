@@ -27,7 +27,6 @@
 #pragma once
 
 #include "py/obj.h"
-#include "py/ringbuf.h"
 
 #include "bindings/espnow/Peers.h"
 
@@ -35,7 +34,14 @@
 
 typedef struct _espnow_obj_t {
     mp_obj_base_t base;
-    ringbuf_t *recv_buffer;
+    // Received packets, one per fixed-size slot. recv_cb fills the slot at
+    // recv_head and the reader empties the one at recv_tail. Both count
+    // up freely; only their difference and their values modulo
+    // recv_slot_count matter.
+    uint8_t *recv_slots;
+    size_t recv_slot_count;
+    size_t recv_head;
+    size_t recv_tail;
     size_t recv_buffer_size;
     wifi_phy_rate_t phy_rate;
     espnow_peers_obj_t *peers;
@@ -57,3 +63,10 @@ extern void common_hal_espnow_set_pmk(espnow_obj_t *self, const uint8_t *key);
 
 extern mp_obj_t common_hal_espnow_send(espnow_obj_t *self, const mp_buffer_info_t *message, const uint8_t *mac);
 extern mp_obj_t common_hal_espnow_read(espnow_obj_t *self);
+extern mp_obj_t common_hal_espnow_read_into(espnow_obj_t *self, const mp_buffer_info_t *buffer, const mp_buffer_info_t *mac);
+extern size_t common_hal_espnow_read_records(espnow_obj_t *self, const mp_buffer_info_t *buffer);
+extern size_t common_hal_espnow_packets_available(espnow_obj_t *self);
+extern size_t common_hal_espnow_bytes_available(espnow_obj_t *self);
+
+// The size of each record stored by common_hal_espnow_read_records().
+#define ESPNOW_RECORD_SIZE (13 + 250)
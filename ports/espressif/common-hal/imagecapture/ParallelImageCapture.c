@@ -146,6 +146,19 @@ STATIC void common_hal_imagecapture_parallelimagecapture_continuous_capture_give
     }
 }
 
+STATIC mp_obj_t common_hal_imagecapture_parallelimagecapture_continuous_capture_take_frame(imagecapture_parallelimagecapture_obj_t *self) {
+    cam_take(&self->buffer_to_give);
+
+    if (self->buffer_to_give == self->config.frame1_buffer) {
+        return self->buffer1;
+    }
+    if (self->buffer_to_give == self->config.frame2_buffer) {
+        return self->buffer2;
+    }
+
+    return mp_const_none;  // should be unreachable
+}
+
 mp_obj_t common_hal_imagecapture_parallelimagecapture_continuous_capture_get_frame(imagecapture_parallelimagecapture_obj_t *self) {
     if (self->buffer1 == NULL) {
         mp_raise_RuntimeError(MP_ERROR_TEXT("No capture in progress"));
@@ -159,16 +172,18 @@ mp_obj_t common_hal_imagecapture_parallelimagecapture_continuous_capture_get_fra
         }
     }
 
-    cam_take(&self->buffer_to_give);
+    return common_hal_imagecapture_parallelimagecapture_continuous_capture_take_frame(self);
+}
 
-    if (self->buffer_to_give == self->config.frame1_buffer) {
-        return self->buffer1;
+mp_obj_t common_hal_imagecapture_parallelimagecapture_continuous_capture_latest_frame(imagecapture_parallelimagecapture_obj_t *self) {
+    if (self->buffer1 == NULL) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("No capture in progress"));
     }
-    if (self->buffer_to_give == self->config.frame2_buffer) {
-        return self->buffer2;
+    if (!cam_ready()) {
+        return mp_const_none;
     }
-
-    return mp_const_none;  // should be unreachable
+    common_hal_imagecapture_parallelimagecapture_continuous_capture_give_frame(self);
+    return common_hal_imagecapture_parallelimagecapture_continuous_capture_take_frame(self);
 }
 
 void common_hal_imagecapture_parallelimagecapture_singleshot_capture(imagecapture_parallelimagecapture_obj_t *self, mp_obj_t buffer) {
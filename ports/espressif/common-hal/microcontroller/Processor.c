@@ -39,6 +39,11 @@
 
 #include "soc/efuse_reg.h"
 
+#if CIRCUITPY_CPU_GOVERNOR
+#include "esp_pm.h"
+#include "supervisor/shared/cpu_governor.h"
+#endif
+
 #if !defined(CONFIG_IDF_TARGET_ESP32)
 #include "driver/temperature_sensor.h"
 #endif
@@ -63,8 +68,43 @@ float common_hal_mcu_processor_get_voltage(void) {
     return NAN;
 }
 
+#if CIRCUITPY_CPU_GOVERNOR
+static uint32_t cpu_frequency_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ;
+
+// The APB clock stays at 80 MHz at all of these, so peripherals keep their timing.
+STATIC const cpu_governor_level_t governor_levels[] = {
+    { .frequency = 80000000, .min_idle_ms = 5 },
+    { .frequency = 160000000, .min_idle_ms = 1 },
+};
+
+const cpu_governor_level_t *port_cpu_governor_levels(size_t *count) {
+    *count = MP_ARRAY_SIZE(governor_levels);
+    return governor_levels;
+}
+
+bool port_cpu_governor_set_frequency(uint32_t frequency) {
+    int mhz = frequency / 1000000;
+    // Pinning the minimum to the maximum keeps ESP-IDF's own frequency scaling
+    // out of the way. This fails unless the board's sdkconfig sets CONFIG_PM_ENABLE.
+    esp_pm_config_t config = {
+        .max_freq_mhz = mhz,
+        .min_freq_mhz = mhz,
+        .light_sleep_enable = false,
+    };
+    if (esp_pm_configure(&config) != ESP_OK) {
+        return false;
+    }
+    cpu_frequency_mhz = mhz;
+    return true;
+}
+#endif
+
 uint32_t common_hal_mcu_processor_get_frequency(void) {
+    #if CIRCUITPY_CPU_GOVERNOR
+    return cpu_frequency_mhz * 1000000;
+    #else
     return CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ * 1000000;
+    #endif
 }
 
 STATIC uint8_t swap_nibbles(uint8_t v) {
@@ -24,16 +24,29 @@
  * THE SOFTWARE.
  */
 
+#include <stdio.h>
 #include <string.h>
 
 #include "common-hal/nvm/ByteArray.h"
 #include "shared-bindings/nvm/ByteArray.h"
 #include "bindings/espidf/__init__.h"
 
+#include "py/misc.h"
 #include "py/runtime.h"
-#include "py/gc.h"
+#include "supervisor/port.h"
 #include "nvs_flash.h"
 
+// The contents are kept in NVS as fixed size chunks so that a write only stores
+// the chunks it changes. NVS appends each new version of a chunk to its log and
+// reclaims the old ones as pages fill, which spreads the wear over the whole
+// partition. Reads are served from a copy kept in RAM.
+#define NVM_CHUNK_SIZE (256)
+#define NVM_CHUNK_COUNT ((CIRCUITPY_INTERNAL_NVM_SIZE + NVM_CHUNK_SIZE - 1) / NVM_CHUNK_SIZE)
+
+// Outlives the VM, so that reads after a reload don't need to go to flash.
+static uint8_t *mirror;
+static bool mirror_valid;
+
 uint32_t common_hal_nvm_bytearray_get_length(const nvm_bytearray_obj_t *self) {
     return self->len;
 }
@@ -55,94 +68,134 @@ static void get_nvs_handle(nvs_handle_t *nvs_handle) {
     }
 }
 
-// Get a copy of the nvm data, or an array initialized to all 0 bytes if it is not present
-static esp_err_t get_bytes(nvs_handle_t handle, uint8_t **buf_out) {
-    size_t size;
-    void *buf;
-    esp_err_t result = nvs_get_blob(handle, "data", NULL, &size);
-    if (result == ESP_ERR_NVS_NOT_FOUND) {
-        size = CIRCUITPY_INTERNAL_NVM_SIZE;
-    } else if (result != ESP_OK) {
-        *buf_out = NULL;
-        return result;
+static void chunk_key(char *key, size_t key_len, size_t chunk) {
+    snprintf(key, key_len, "d%u", (unsigned int)chunk);
+}
+
+static size_t chunk_len(size_t chunk) {
+    return MIN(NVM_CHUNK_SIZE, CIRCUITPY_INTERNAL_NVM_SIZE - chunk * NVM_CHUNK_SIZE);
+}
+
+static esp_err_t write_chunk(nvs_handle_t handle, size_t chunk) {
+    char key[8];
+    chunk_key(key, sizeof(key), chunk);
+    return nvs_set_blob(handle, key, mirror + chunk * NVM_CHUNK_SIZE, chunk_len(chunk));
+}
+
+// Earlier versions stored everything as one "data" blob that was rewritten on
+// every change. Split it into chunks and then drop it.
+static esp_err_t convert_single_blob(nvs_handle_t handle, size_t size) {
+    esp_err_t result = nvs_get_blob(handle, "data", mirror, &size);
+    for (size_t chunk = 0; result == ESP_OK && chunk < NVM_CHUNK_COUNT; chunk++) {
+        result = write_chunk(handle, chunk);
+    }
+    if (result == ESP_OK) {
+        result = nvs_commit(handle);
+    }
+    if (result == ESP_OK) {
+        result = nvs_erase_key(handle, "data");
     }
-    buf = m_malloc(size); // this SHOULD be the same as
     if (result == ESP_OK) {
-        result = nvs_get_blob(handle, "data", buf, &size);
-    } else {
-        result = ESP_OK;
+        result = nvs_commit(handle);
     }
-    *buf_out = buf;
     return result;
 }
 
-bool common_hal_nvm_bytearray_set_bytes(const nvm_bytearray_obj_t *self,
-    uint32_t start_index, uint8_t *values, uint32_t len) {
-
-    // start nvs
-    nvs_handle_t handle;
-    get_nvs_handle(&handle);
+// Chunks that were never written read as 0 bytes.
+static esp_err_t load_mirror(nvs_handle_t handle) {
+    if (mirror == NULL) {
+        mirror = port_malloc_tagged(CIRCUITPY_INTERNAL_NVM_SIZE, false, PORT_HEAP_TAG_SUPERVISOR);
+        if (mirror == NULL) {
+            m_malloc_fail(CIRCUITPY_INTERNAL_NVM_SIZE);
+        }
+    }
+    memset(mirror, 0, CIRCUITPY_INTERNAL_NVM_SIZE);
 
-    // get from flash
-    uint8_t *buf = NULL;
-    esp_err_t result = get_bytes(handle, &buf);
-    if (result != ESP_OK) {
-        gc_free(buf);
-        nvs_close(handle);
-        raise_esp_error(result);
+    size_t size;
+    esp_err_t result = nvs_get_blob(handle, "data", NULL, &size);
+    if (result == ESP_OK) {
+        return convert_single_blob(handle, MIN(size, CIRCUITPY_INTERNAL_NVM_SIZE));
+    }
+    if (result != ESP_ERR_NVS_NOT_FOUND) {
+        return result;
     }
+    for (size_t chunk = 0; chunk < NVM_CHUNK_COUNT; chunk++) {
+        char key[8];
+        chunk_key(key, sizeof(key), chunk);
+        size = chunk_len(chunk);
+        result = nvs_get_blob(handle, key, mirror + chunk * NVM_CHUNK_SIZE, &size);
+        if (result != ESP_OK && result != ESP_ERR_NVS_NOT_FOUND) {
+            return result;
+        }
+    }
+    return ESP_OK;
+}
 
-    // erase old data, including 6.3.x incompatible data
-    result = nvs_erase_all(handle);
+static void ensure_mirror(nvs_handle_t handle) {
+    if (mirror_valid) {
+        return;
+    }
+    esp_err_t result = load_mirror(handle);
     if (result != ESP_OK) {
-        gc_free(buf);
         nvs_close(handle);
         raise_esp_error(result);
     }
+    mirror_valid = true;
+}
 
-    // make our modification
-    memcpy(buf + start_index, values, len);
-
-    result = nvs_set_blob(handle, "data", buf, CIRCUITPY_INTERNAL_NVM_SIZE);
-    if (result != ESP_OK) {
-        gc_free(buf);
-        nvs_close(handle);
-        raise_esp_error(result);
+bool common_hal_nvm_bytearray_set_bytes(const nvm_bytearray_obj_t *self,
+    uint32_t start_index, uint8_t *values, uint32_t len) {
+    if (len == 0 || (mirror_valid && memcmp(mirror + start_index, values, len) == 0)) {
+        return true;
     }
 
-    result = nvs_commit(handle);
-    if (result != ESP_OK) {
-        gc_free(buf);
-        nvs_close(handle);
-        raise_esp_error(result);
+    // start nvs
+    nvs_handle_t handle;
+    get_nvs_handle(&handle);
+    ensure_mirror(handle);
+
+    // Only store the chunks whose contents change.
+    esp_err_t result = ESP_OK;
+    bool changed = false;
+    const size_t first = start_index / NVM_CHUNK_SIZE;
+    const size_t last = (start_index + len - 1) / NVM_CHUNK_SIZE;
+    for (size_t chunk = first; result == ESP_OK && chunk <= last; chunk++) {
+        size_t chunk_start = MAX(start_index, chunk * NVM_CHUNK_SIZE);
+        size_t chunk_end = MIN(start_index + len, chunk * NVM_CHUNK_SIZE + chunk_len(chunk));
+        uint8_t *dest = mirror + chunk_start;
+        const uint8_t *src = values + (chunk_start - start_index);
+        if (memcmp(dest, src, chunk_end - chunk_start) == 0) {
+            continue;
+        }
+        memcpy(dest, src, chunk_end - chunk_start);
+        result = write_chunk(handle, chunk);
+        changed = true;
+    }
+    if (result == ESP_OK && changed) {
+        result = nvs_commit(handle);
     }
 
     // close nvs
-    gc_free(buf);
     nvs_close(handle);
+    if (result != ESP_OK) {
+        // The RAM copy may now be ahead of flash, so read it again next time.
+        mirror_valid = false;
+        raise_esp_error(result);
+    }
     return true;
 }
 
 void common_hal_nvm_bytearray_get_bytes(const nvm_bytearray_obj_t *self,
     uint32_t start_index, uint32_t len, uint8_t *values) {
-
-    // start nvs
-    nvs_handle_t handle;
-    get_nvs_handle(&handle);
-
-    // get from flash
-    uint8_t *buf;
-    esp_err_t result = get_bytes(handle, &buf);
-    if (result != ESP_OK) {
-        gc_free(buf);
+    if (!mirror_valid) {
+        // start nvs
+        nvs_handle_t handle;
+        get_nvs_handle(&handle);
+        ensure_mirror(handle);
+        // close nvs
         nvs_close(handle);
-        raise_esp_error(result);
     }
 
     // copy the subset of data requested
-    memcpy(values, buf + start_index, len);
-
-    // close nvs
-    gc_free(buf);
-    nvs_close(handle);
+    memcpy(values, mirror + start_index, len);
 }
@@ -28,6 +28,7 @@
 #define MICROPY_INCLUDED_ESPRESSIF_COMMON_HAL_ROTARYIO_INCREMENTALENCODER_H
 
 #include "py/obj.h"
+#include "shared-module/rotaryio/velocity.h"
 #include "peripherals/pcnt.h"
 
 typedef struct {
@@ -36,6 +37,7 @@ typedef struct {
     mp_int_t position;
     pcnt_unit_t unit;
     int8_t divisor; // Number of quadrature edges required per count
+    rotaryio_velocity_t velocity;
 } rotaryio_incrementalencoder_obj_t;
 
 #endif // MICROPY_INCLUDED_ESPRESSIF_COMMON_HAL_ROTARYIO_INCREMENTALENCODER_H
@@ -30,6 +30,7 @@
 #include "shared/runtime/interrupt_char.h"
 #include "py/mperrno.h"
 #include "py/runtime.h"
+#include "py/stream.h"
 #include "shared-bindings/socketpool/SocketPool.h"
 #include "shared-bindings/ssl/SSLSocket.h"
 #include "common-hal/ssl/SSLSocket.h"
@@ -57,6 +58,9 @@ StackType_t socket_select_stack[2 * configMINIMAL_STACK_SIZE];
 STATIC uint8_t socket_fd_state[CONFIG_LWIP_MAX_SOCKETS];
 
 STATIC socketpool_socket_obj_t *user_socket[CONFIG_LWIP_MAX_SOCKETS];
+// MP_STREAM_POLL_* flags that a poll of a user socket is waiting for. The select
+// task watches the socket for them and wakes the main task once one happens.
+STATIC uint8_t user_socket_wake_flags[CONFIG_LWIP_MAX_SOCKETS];
 StaticTask_t socket_select_task_buffer;
 TaskHandle_t socket_select_task_handle;
 STATIC int socket_change_fd = -1;
@@ -64,23 +68,37 @@ STATIC int socket_change_fd = -1;
 STATIC void socket_select_task(void *arg) {
     uint64_t signal;
     fd_set readfds;
+    fd_set writefds;
     fd_set excptfds;
 
     while (true) {
         FD_ZERO(&readfds);
+        FD_ZERO(&writefds);
         FD_ZERO(&excptfds);
         FD_SET(socket_change_fd, &readfds);
         int max_fd = socket_change_fd;
         for (size_t i = 0; i < MP_ARRAY_SIZE(socket_fd_state); i++) {
-            if ((socket_fd_state[i] == FDSTATE_OPEN) && (user_socket[i] == NULL)) {
-                int sockfd = i + LWIP_SOCKET_OFFSET;
+            if (socket_fd_state[i] != FDSTATE_OPEN) {
+                continue;
+            }
+            int sockfd = i + LWIP_SOCKET_OFFSET;
+            if (user_socket[i] == NULL) {
                 max_fd = MAX(max_fd, sockfd);
                 FD_SET(sockfd, &readfds);
                 FD_SET(sockfd, &excptfds);
+            } else if (user_socket_wake_flags[i] != 0) {
+                max_fd = MAX(max_fd, sockfd);
+                if (user_socket_wake_flags[i] & MP_STREAM_POLL_RD) {
+                    FD_SET(sockfd, &readfds);
+                }
+                if (user_socket_wake_flags[i] & MP_STREAM_POLL_WR) {
+                    FD_SET(sockfd, &writefds);
+                }
+                FD_SET(sockfd, &excptfds);
             }
         }
 
-        int num_triggered = select(max_fd + 1, &readfds, NULL, &excptfds, NULL);
+        int num_triggered = select(max_fd + 1, &readfds, &writefds, &excptfds, NULL);
         // Hard error (or someone closed a socket on another thread)
         if (num_triggered == -1) {
             assert(errno == EBADF);
@@ -96,18 +114,29 @@ STATIC void socket_select_task(void *arg) {
         }
 
         // Handle active FDs, close the dead ones
+        bool wake_user = false;
         for (size_t i = 0; i < MP_ARRAY_SIZE(socket_fd_state); i++) {
             int sockfd = i + LWIP_SOCKET_OFFSET;
             if (socket_fd_state[i] != FDSTATE_CLOSED) {
-                if (FD_ISSET(sockfd, &readfds) || FD_ISSET(sockfd, &excptfds)) {
+                if (FD_ISSET(sockfd, &readfds) || FD_ISSET(sockfd, &writefds) || FD_ISSET(sockfd, &excptfds)) {
                     if (socket_fd_state[i] == FDSTATE_CLOSING) {
                         socket_fd_state[i] = FDSTATE_CLOSED;
                         num_triggered--;
+                    } else if (user_socket[i] != NULL) {
+                        // A poll is waiting for this socket. Stop watching it
+                        // until the poll asks again.
+                        user_socket_wake_flags[i] = 0;
+                        wake_user = true;
+                        num_triggered--;
                     }
                 }
             }
         }
 
+        if (wake_user) {
+            port_wake_main_task();
+        }
+
         if (num_triggered > 0) {
             // Wake up CircuitPython by queuing request
             supervisor_workflow_request_background();
@@ -129,6 +158,7 @@ void socket_user_reset(void) {
         for (size_t i = 0; i < MP_ARRAY_SIZE(socket_fd_state); i++) {
             socket_fd_state[i] = FDSTATE_CLOSED;
             user_socket[i] = NULL;
+            user_socket_wake_flags[i] = 0;
         }
         socket_change_fd = eventfd(0, 0);
         // Run this at the same priority as CP so that the web workflow background task can be
@@ -165,6 +195,7 @@ STATIC bool register_open_socket(int fd) {
     if (fd < FD_SETSIZE) {
         socket_fd_state[fd - LWIP_SOCKET_OFFSET] = FDSTATE_OPEN;
         user_socket[fd - LWIP_SOCKET_OFFSET] = NULL;
+        user_socket_wake_flags[fd - LWIP_SOCKET_OFFSET] = 0;
 
         uint64_t signal = 1;
         write(socket_change_fd, &signal, sizeof(signal));
@@ -177,6 +208,7 @@ STATIC bool register_open_socket(int fd) {
 STATIC void mark_user_socket(int fd, socketpool_socket_obj_t *obj) {
     socket_fd_state[fd - LWIP_SOCKET_OFFSET] = FDSTATE_OPEN;
     user_socket[fd - LWIP_SOCKET_OFFSET] = obj;
+    user_socket_wake_flags[fd - LWIP_SOCKET_OFFSET] = 0;
     // No need to wakeup select task
 }
 
@@ -374,10 +406,17 @@ void socketpool_socket_close(socketpool_socket_obj_t *self) {
             lwip_shutdown(fd, SHUT_RDWR);
             lwip_close(fd);
         } else {
+            bool watched = user_socket_wake_flags[fd - LWIP_SOCKET_OFFSET] != 0;
+            user_socket_wake_flags[fd - LWIP_SOCKET_OFFSET] = 0;
             lwip_shutdown(fd, SHUT_RDWR);
             lwip_close(fd);
             socket_fd_state[fd - LWIP_SOCKET_OFFSET] = FDSTATE_CLOSED;
             user_socket[fd - LWIP_SOCKET_OFFSET] = NULL;
+            if (watched) {
+                // Have the select task stop watching the closed fd.
+                uint64_t signal = 1;
+                write(socket_change_fd, &signal, sizeof(signal));
+            }
         }
     }
     self->num = -1;
@@ -441,6 +480,11 @@ bool common_hal_socketpool_socket_get_connected(socketpool_socket_obj_t *self) {
     return self->connected;
 }
 
+mp_int_t common_hal_socketpool_socket_get_datagrams_dropped(socketpool_socket_obj_t *self) {
+    // lwIP drops datagrams when the socket's receive mailbox is full without counting them.
+    return -1;
+}
+
 bool common_hal_socketpool_socket_listen(socketpool_socket_obj_t *self, int backlog) {
     return lwip_listen(self->num, backlog) == 0;
 }
@@ -485,6 +529,20 @@ mp_uint_t common_hal_socketpool_socket_recvfrom_into(socketpool_socket_obj_t *se
     return received;
 }
 
+int socketpool_socket_recvfrom_into(socketpool_socket_obj_t *self,
+    uint8_t *buf, uint32_t len, uint8_t *ip, uint32_t *port) {
+    struct sockaddr_in source_addr;
+    socklen_t socklen = sizeof(source_addr);
+    // The socket is non-blocking, so this returns straight away.
+    int received = lwip_recvfrom(self->num, buf, len, 0, (struct sockaddr *)&source_addr, &socklen);
+    if (received < 0) {
+        return -errno;
+    }
+    memcpy((void *)ip, (void *)&source_addr.sin_addr.s_addr, sizeof(source_addr.sin_addr.s_addr));
+    *port = htons(source_addr.sin_port);
+    return received;
+}
+
 int socketpool_socket_recv_into(socketpool_socket_obj_t *self,
     const uint8_t *buf, uint32_t len) {
     int received = 0;
@@ -556,6 +614,30 @@ int socketpool_socket_send(socketpool_socket_obj_t *self, const uint8_t *buf, ui
     return sent;
 }
 
+int socketpool_socket_sendv(socketpool_socket_obj_t *self, const mp_buffer_info_t *bufs, size_t count) {
+    if (self->num == -1) {
+        return -MP_EBADF;
+    }
+    if (self->type != SOCK_STREAM) {
+        // Keep one datagram per piece, as on other ports.
+        return -MP_EINVAL;
+    }
+    struct iovec iov[MP_STREAM_WRITEV_MAX];
+    count = MIN(count, MP_STREAM_WRITEV_MAX);
+    for (size_t i = 0; i < count; i++) {
+        iov[i].iov_base = bufs[i].buf;
+        iov[i].iov_len = bufs[i].len;
+    }
+    int sent = lwip_writev(self->num, iov, count);
+    if (sent < 0) {
+        if (errno == ECONNRESET || errno == ENOTCONN) {
+            self->connected = false;
+        }
+        return -errno;
+    }
+    return sent;
+}
+
 mp_uint_t common_hal_socketpool_socket_send(socketpool_socket_obj_t *self, const uint8_t *buf, uint32_t len) {
     int sent = socketpool_socket_send(self, buf, len);
 
@@ -565,6 +647,24 @@ mp_uint_t common_hal_socketpool_socket_send(socketpool_socket_obj_t *self, const
     return sent;
 }
 
+mp_uint_t common_hal_socketpool_socket_send_buffer(socketpool_socket_obj_t *self, mp_obj_t buffer, const uint8_t *buf, uint32_t len) {
+    // The lwIP socket API always copies, so there is nothing to gain from holding buffer.
+    return common_hal_socketpool_socket_send(self, buf, len);
+}
+
+int socketpool_socket_sendto(socketpool_socket_obj_t *self,
+    const uint8_t *ip, uint32_t port, const uint8_t *buf, uint32_t len) {
+    struct sockaddr_in dest_addr;
+    dest_addr.sin_family = AF_INET;
+    dest_addr.sin_port = htons(port);
+    memcpy((void *)&dest_addr.sin_addr.s_addr, ip, sizeof(dest_addr.sin_addr.s_addr));
+    int bytes_sent = lwip_sendto(self->num, buf, len, 0, (struct sockaddr *)&dest_addr, sizeof(dest_addr));
+    if (bytes_sent < 0) {
+        return -errno;
+    }
+    return bytes_sent;
+}
+
 mp_uint_t common_hal_socketpool_socket_sendto(socketpool_socket_obj_t *self,
     const char *host, size_t hostlen, uint32_t port, const uint8_t *buf, uint32_t len) {
 
@@ -623,6 +723,26 @@ bool common_hal_socketpool_readable(socketpool_socket_obj_t *self) {
     return num_triggered != 0;
 }
 
+bool common_hal_socketpool_socket_wake_when_ready(socketpool_socket_obj_t *self, mp_uint_t flags) {
+    int fd = self->num;
+    if (fd < LWIP_SOCKET_OFFSET || user_socket[fd - LWIP_SOCKET_OFFSET] != self) {
+        // Closed, or not a socket the select task knows about.
+        return false;
+    }
+    // Errors are always watched for, so that a poll for neither reading nor
+    // writing still wakes up.
+    uint8_t wanted = (flags & (MP_STREAM_POLL_RD | MP_STREAM_POLL_WR)) | MP_STREAM_POLL_ERR;
+    uint8_t *wake_flags = &user_socket_wake_flags[fd - LWIP_SOCKET_OFFSET];
+    if ((*wake_flags & wanted) != wanted) {
+        // Have the select task redo its select with this socket in it. If the
+        // socket is already ready, the select returns straight away.
+        *wake_flags |= wanted;
+        uint64_t signal = 1;
+        write(socket_change_fd, &signal, sizeof(signal));
+    }
+    return true;
+}
+
 bool common_hal_socketpool_writable(socketpool_socket_obj_t *self) {
     struct timeval immediate = {0, 0};
 
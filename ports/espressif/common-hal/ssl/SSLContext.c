@@ -34,8 +34,56 @@
 #include "py/runtime.h"
 #include "lwip/sockets.h"
 
-void common_hal_ssl_sslcontext_construct(ssl_sslcontext_obj_t *self) {
+// Sessions from past handshakes, most recently used first. The sessions are
+// allocated by ESP-TLS outside the VM heap so they survive soft reloads.
+#define SSL_SESSION_CACHE_SIZE (4)
+#define SSL_SESSION_HOSTNAME_LEN (64)
+
+typedef struct {
+    char hostname[SSL_SESSION_HOSTNAME_LEN];
+    esp_tls_client_session_t *session;
+} ssl_session_cache_entry_t;
+
+static ssl_session_cache_entry_t ssl_session_cache[SSL_SESSION_CACHE_SIZE];
+
+// Moves the entry for hostname, or the least recently used one, to the front.
+static ssl_session_cache_entry_t *ssl_session_cache_find(const char *hostname) {
+    size_t i = 0;
+    while (i < SSL_SESSION_CACHE_SIZE - 1 && strcmp(ssl_session_cache[i].hostname, hostname) != 0) {
+        i++;
+    }
+    ssl_session_cache_entry_t entry = ssl_session_cache[i];
+    memmove(&ssl_session_cache[1], &ssl_session_cache[0], i * sizeof(ssl_session_cache_entry_t));
+    ssl_session_cache[0] = entry;
+    return &ssl_session_cache[0];
+}
+
+esp_tls_client_session_t *ssl_session_cache_get(const char *hostname) {
+    if (strlen(hostname) >= SSL_SESSION_HOSTNAME_LEN) {
+        return NULL;
+    }
+    ssl_session_cache_entry_t *entry = ssl_session_cache_find(hostname);
+    if (strcmp(entry->hostname, hostname) != 0) {
+        return NULL;
+    }
+    return entry->session;
+}
+
+void ssl_session_cache_put(const char *hostname, esp_tls_client_session_t *session) {
+    if (strlen(hostname) >= SSL_SESSION_HOSTNAME_LEN) {
+        esp_tls_free_client_session(session);
+        return;
+    }
+    ssl_session_cache_entry_t *entry = ssl_session_cache_find(hostname);
+    if (entry->session != NULL) {
+        esp_tls_free_client_session(entry->session);
+    }
+    strcpy(entry->hostname, hostname);
+    entry->session = session;
+}
 
+void common_hal_ssl_sslcontext_construct(ssl_sslcontext_obj_t *self) {
+    self->session_cache = false;
 }
 
 ssl_sslsocket_obj_t *common_hal_ssl_sslcontext_wrap_socket(ssl_sslcontext_obj_t *self,
@@ -90,6 +138,14 @@ void common_hal_ssl_sslcontext_set_check_hostname(ssl_sslcontext_obj_t *self, bo
     self->ssl_config.skip_common_name = !value;
 }
 
+bool common_hal_ssl_sslcontext_get_session_cache(ssl_sslcontext_obj_t *self) {
+    return self->session_cache;
+}
+
+void common_hal_ssl_sslcontext_set_session_cache(ssl_sslcontext_obj_t *self, bool value) {
+    self->session_cache = value;
+}
+
 void common_hal_ssl_sslcontext_load_cert_chain(ssl_sslcontext_obj_t *self, mp_buffer_info_t *cert_buf, mp_buffer_info_t *key_buf) {
     self->ssl_config.clientcert_buf = cert_buf->buf;
     self->ssl_config.clientcert_bytes = cert_buf->len + 1;
@@ -34,6 +34,10 @@
 typedef struct {
     mp_obj_base_t base;
     esp_tls_cfg_t ssl_config;
+    bool session_cache;
 } ssl_sslcontext_obj_t;
 
+esp_tls_client_session_t *ssl_session_cache_get(const char *hostname);
+void ssl_session_cache_put(const char *hostname, esp_tls_client_session_t *session);
+
 #endif // MICROPY_INCLUDED_ESPRESSIF_COMMON_HAL_SSL_SSL_CONTEXT_H
@@ -57,10 +57,24 @@ void common_hal_ssl_sslsocket_close(ssl_sslsocket_obj_t *self) {
 
 void common_hal_ssl_sslsocket_connect(ssl_sslsocket_obj_t *self,
     const char *host, size_t hostlen, uint32_t port) {
+    // Offer the session from the last handshake with this server so that it
+    // can be resumed instead of doing a full handshake.
+    const char *session_hostname = self->ssl_config.common_name != NULL ? self->ssl_config.common_name : host;
+    self->ssl_config.client_session = NULL;
+    if (self->ssl_context->session_cache) {
+        self->ssl_config.client_session = ssl_session_cache_get(session_hostname);
+    }
+
     // Yield briefly so that the IDF can clean up memory before we need more.
     port_yield();
     int result = esp_tls_conn_new_sync(host, hostlen, port, &self->ssl_config, self->tls);
     self->sock->connected = result >= 0;
+    if (result >= 0 && self->ssl_context->session_cache) {
+        esp_tls_client_session_t *session = esp_tls_get_client_session(self->tls);
+        if (session != NULL) {
+            ssl_session_cache_put(session_hostname, session);
+        }
+    }
     if (result < 0) {
         int esp_tls_code;
         int flags;
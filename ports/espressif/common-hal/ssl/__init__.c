@@ -32,4 +32,5 @@
 void common_hal_ssl_create_default_context(ssl_sslcontext_obj_t *self) {
     memset(&self->ssl_config, 0, sizeof(esp_tls_cfg_t));
     self->ssl_config.crt_bundle_attach = esp_crt_bundle_attach;
+    self->session_cache = false;
 }
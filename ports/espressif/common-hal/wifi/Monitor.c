@@ -38,46 +38,110 @@
 #define MONITOR_QUEUE_TIMEOUT_TICK  (0)
 
 typedef struct {
+    // Whole frame, only when the monitor keeps payloads.
     void *payload;
-    unsigned channel;
-    uint32_t length;
-    signed rssi;
+    uint32_t timestamp;
+    uint16_t length;
+    uint8_t channel;
+    int8_t rssi;
+    uint8_t header[WIFI_MONITOR_HEADER_LEN];
 } monitor_packet_t;
 
 static const char *TAG = "monitor";
 
+// Protects the filter, which the VM changes while the wifi task reads it.
+static portMUX_TYPE monitor_filter_mutex = portMUX_INITIALIZER_UNLOCKED;
+
+static bool monitor_filter_match(const wifi_monitor_filter_t *filter, const uint8_t *frame, uint32_t length, int rssi) {
+    if (rssi < filter->min_rssi || length < 2) {
+        return false;
+    }
+    // Frame control: protocol version in bits 0-1, type in bits 2-3, subtype in bits 4-7.
+    uint8_t kind = ((frame[0] >> 2) & 0x3) << 4 | frame[0] >> 4;
+    if (!(filter->subtypes & (1ULL << kind))) {
+        return false;
+    }
+    if (filter->address_count == 0) {
+        return true;
+    }
+    // The transmitter address is the second address, after frame control, duration and the first address.
+    if (length < 16) {
+        return false;
+    }
+    for (size_t i = 0; i < filter->address_count; i++) {
+        if (memcmp(frame + 10, filter->addresses[i], 6) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
 static void wifi_monitor_cb(void *recv_buf, wifi_promiscuous_pkt_type_t type) {
     wifi_promiscuous_pkt_t *pkt = (wifi_promiscuous_pkt_t *)recv_buf;
+    wifi_monitor_obj_t *self = MP_STATE_VM(wifi_monitor_singleton);
+
+    // for now, the monitor only dumps the length of the MISC type frame
+    if (type == WIFI_PKT_MISC || pkt->rx_ctrl.rx_state || self == NULL || self->queue == NULL) {
+        return;
+    }
+    uint32_t length = pkt->rx_ctrl.sig_len - MONITOR_PAYLOAD_FCS_LEN;
+
+    portENTER_CRITICAL(&monitor_filter_mutex);
+    bool match = monitor_filter_match(&self->filter, pkt->payload, length, pkt->rx_ctrl.rssi);
+    portEXIT_CRITICAL(&monitor_filter_mutex);
+    if (!match) {
+        return;
+    }
 
     // prepare packet
     monitor_packet_t packet = {
+        .payload = NULL,
+        .timestamp = pkt->rx_ctrl.timestamp,
+        .length = length,
         .channel = pkt->rx_ctrl.channel,
-        .length = pkt->rx_ctrl.sig_len,
         .rssi = pkt->rx_ctrl.rssi,
     };
+    size_t header_len = MIN(length, sizeof(packet.header));
+    memcpy(packet.header, pkt->payload, header_len);
+    memset(packet.header + header_len, 0, sizeof(packet.header) - header_len);
 
-    // for now, the monitor only dumps the length of the MISC type frame
-    if (type != WIFI_PKT_MISC && !pkt->rx_ctrl.rx_state) {
-        packet.length -= MONITOR_PAYLOAD_FCS_LEN;
-        packet.payload = malloc(packet.length);
-        if (packet.payload) {
-            memcpy(packet.payload, pkt->payload, packet.length);
-            wifi_monitor_obj_t *self = MP_STATE_VM(wifi_monitor_singleton);
-            if (self->queue) {
-                // send packet
-                if (xQueueSendFromISR(self->queue, &packet, NULL) != pdTRUE) {
-                    self->lost++;
-                    free(packet.payload);
-                    ESP_LOGE(TAG, "packet queue full");
-                }
-            }
-        } else {
+    if (self->payload) {
+        packet.payload = malloc(length);
+        if (!packet.payload) {
             ESP_LOGE(TAG, "not enough memory for packet");
+            return;
         }
+        memcpy(packet.payload, pkt->payload, length);
+    }
+
+    // send packet
+    if (xQueueSendFromISR(self->queue, &packet, NULL) != pdTRUE) {
+        self->lost++;
+        free(packet.payload);
+        ESP_LOGE(TAG, "packet queue full");
     }
 }
 
-void common_hal_wifi_monitor_construct(wifi_monitor_obj_t *self, uint8_t channel, size_t queue) {
+// The hardware filter passes the frame types that have any subtype selected.
+static void monitor_set_hardware_filter(uint64_t subtypes) {
+    wifi_promiscuous_filter_t wifi_filter = { .filter_mask = 0 };
+    if (subtypes & 0xffff) {
+        wifi_filter.filter_mask |= WIFI_PROMIS_FILTER_MASK_MGMT;
+    }
+    if (subtypes & 0xffff0000) {
+        wifi_filter.filter_mask |= WIFI_PROMIS_FILTER_MASK_CTRL;
+    }
+    if (subtypes & 0xffff00000000) {
+        wifi_filter.filter_mask |= WIFI_PROMIS_FILTER_MASK_DATA;
+    }
+    esp_wifi_set_promiscuous_filter(&wifi_filter);
+    if (wifi_filter.filter_mask & WIFI_PROMIS_FILTER_MASK_CTRL) {
+        wifi_promiscuous_filter_t ctrl_filter = { .filter_mask = WIFI_PROMIS_CTRL_FILTER_MASK_ALL };
+        esp_wifi_set_promiscuous_ctrl_filter(&ctrl_filter);
+    }
+}
+
+void common_hal_wifi_monitor_construct(wifi_monitor_obj_t *self, uint8_t channel, size_t queue, bool payload) {
     mp_rom_error_text_t monitor_mode_init_error = MP_ERROR_TEXT("monitor init failed");
 
     self->queue = xQueueCreate(queue, sizeof(monitor_packet_t));
@@ -85,11 +149,14 @@ void common_hal_wifi_monitor_construct(wifi_monitor_obj_t *self, uint8_t channel
         mp_raise_RuntimeError(monitor_mode_init_error);
     }
 
+    // Management frames of any kind, from anyone.
+    self->filter.subtypes = 0xffff;
+    self->filter.address_count = 0;
+    self->filter.min_rssi = INT8_MIN;
+    self->payload = payload;
+
     // start wifi promicuous mode
-    wifi_promiscuous_filter_t wifi_filter = {
-        .filter_mask = WIFI_PROMIS_FILTER_MASK_MGMT,
-    };
-    esp_wifi_set_promiscuous_filter(&wifi_filter);
+    monitor_set_hardware_filter(self->filter.subtypes);
     esp_wifi_set_promiscuous_rx_cb(wifi_monitor_cb);
     if (esp_wifi_set_promiscuous(true) != ESP_OK) {
         mp_raise_RuntimeError(monitor_mode_init_error);
@@ -147,6 +214,40 @@ mp_obj_t common_hal_wifi_monitor_get_queued(wifi_monitor_obj_t *self) {
     return mp_obj_new_int_from_uint(uxQueueMessagesWaiting(self->queue));
 }
 
+void common_hal_wifi_monitor_set_filter(wifi_monitor_obj_t *self, uint64_t subtypes,
+    const uint8_t *addresses, size_t address_count, int8_t min_rssi) {
+    mp_arg_validate_length_max(address_count, MONITOR_FILTER_ADDRESSES, MP_QSTR_addresses);
+
+    portENTER_CRITICAL(&monitor_filter_mutex);
+    self->filter.subtypes = subtypes;
+    memcpy(self->filter.addresses, addresses, address_count * 6);
+    self->filter.address_count = address_count;
+    self->filter.min_rssi = min_rssi;
+    portEXIT_CRITICAL(&monitor_filter_mutex);
+
+    monitor_set_hardware_filter(subtypes);
+}
+
+size_t common_hal_wifi_monitor_get_packets_into(wifi_monitor_obj_t *self, uint8_t *buf, size_t count) {
+    monitor_packet_t packet;
+    size_t i = 0;
+    while (i < count && xQueueReceive(self->queue, &packet, MONITOR_QUEUE_TIMEOUT_TICK) == pdTRUE) {
+        free(packet.payload);
+        uint8_t *record = buf + i * WIFI_MONITOR_RECORD_LEN;
+        record[0] = packet.channel;
+        record[1] = (uint8_t)packet.rssi;
+        record[2] = packet.length;
+        record[3] = packet.length >> 8;
+        record[4] = packet.timestamp;
+        record[5] = packet.timestamp >> 8;
+        record[6] = packet.timestamp >> 16;
+        record[7] = packet.timestamp >> 24;
+        memcpy(record + 8, packet.header, WIFI_MONITOR_HEADER_LEN);
+        i++;
+    }
+    return i;
+}
+
 mp_obj_t common_hal_wifi_monitor_get_packet(wifi_monitor_obj_t *self) {
     monitor_packet_t packet;
 
@@ -160,8 +261,12 @@ mp_obj_t common_hal_wifi_monitor_get_packet(wifi_monitor_obj_t *self) {
 
     mp_obj_dict_store(dict, cp_enum_find(&wifi_packet_type, PACKET_LEN), MP_OBJ_NEW_SMALL_INT(packet.length));
 
-    mp_obj_dict_store(dict, cp_enum_find(&wifi_packet_type, PACKET_RAW), mp_obj_new_bytes(packet.payload, packet.length));
-    free(packet.payload);
+    if (packet.payload != NULL) {
+        mp_obj_dict_store(dict, cp_enum_find(&wifi_packet_type, PACKET_RAW), mp_obj_new_bytes(packet.payload, packet.length));
+        free(packet.payload);
+    } else {
+        mp_obj_dict_store(dict, cp_enum_find(&wifi_packet_type, PACKET_RAW), mp_obj_new_bytes(packet.header, MIN(packet.length, WIFI_MONITOR_HEADER_LEN)));
+    }
 
     mp_obj_dict_store(dict, cp_enum_find(&wifi_packet_type, PACKET_RSSI), MP_OBJ_NEW_SMALL_INT(packet.rssi));
 
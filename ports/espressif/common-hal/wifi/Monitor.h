@@ -30,12 +30,26 @@
 #include "py/obj.h"
 #include "components/esp_wifi/include/esp_wifi.h"
 
+#define MONITOR_FILTER_ADDRESSES    (8)
+
+// Checked in the wifi callback before a frame is queued.
+typedef struct {
+    // Bit (type << 4 | subtype) is set for each frame kind to keep.
+    uint64_t subtypes;
+    // Transmitter addresses to keep, or all if address_count is 0.
+    uint8_t addresses[MONITOR_FILTER_ADDRESSES][6];
+    uint8_t address_count;
+    int8_t min_rssi;
+} wifi_monitor_filter_t;
+
 typedef struct {
     mp_obj_base_t base;
     uint8_t channel;
+    bool payload;
     size_t lost;
     size_t queue_length;
     QueueHandle_t queue;
+    wifi_monitor_filter_t filter;
 } wifi_monitor_obj_t;
 
 #endif // MICROPY_INCLUDED_ESPRESSIF_COMMON_HAL_WIFI_MONITOR_H
@@ -101,6 +101,7 @@ void common_hal_wifi_radio_set_enabled(wifi_radio_obj_t *self, bool enabled) {
         #endif
         ESP_ERROR_CHECK(esp_wifi_stop());
         self->started = false;
+        self->connecting = false;
         return;
     }
     if (!self->started && enabled) {
@@ -203,6 +204,7 @@ void common_hal_wifi_radio_start_station(wifi_radio_obj_t *self) {
 
 void common_hal_wifi_radio_stop_station(wifi_radio_obj_t *self) {
     set_mode_station(self, false);
+    self->connecting = false;
 }
 
 void common_hal_wifi_radio_start_ap(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, uint32_t authmode, uint8_t max_connections) {
@@ -250,15 +252,19 @@ void common_hal_wifi_radio_stop_ap(wifi_radio_obj_t *self) {
     set_mode_ap(self, false);
 }
 
-wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, mp_float_t timeout, uint8_t *bssid, size_t bssid_len) {
+wifi_radio_error_t common_hal_wifi_radio_connect_start(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, uint8_t *bssid, size_t bssid_len) {
     if (!common_hal_wifi_radio_get_enabled(self)) {
         mp_raise_RuntimeError(MP_ERROR_TEXT("wifi is not enabled"));
     }
     wifi_config_t *config = &self->sta_config;
 
-    size_t timeout_ms = timeout * 1000;
-    uint32_t start_time = common_hal_time_monotonic_ms();
-    uint32_t end_time = start_time + timeout_ms;
+    // SSIDs are up to 32 bytes. Assume it is null terminated if it is less.
+    bool same_ssid = memcmp(ssid, config->sta.ssid, ssid_len) == 0 &&
+        (ssid_len == 32 || strlen((const char *)config->sta.ssid) == ssid_len);
+    if (self->connecting && same_ssid) {
+        // Let the attempt already under way, such as the web workflow's, finish.
+        return WIFI_RADIO_ERROR_NONE;
+    }
 
     EventBits_t bits;
     // can't block since both bits are false after wifi_init
@@ -271,9 +277,7 @@ wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t
     bool connected = ((bits & WIFI_CONNECTED_BIT) != 0) &&
         !((bits & WIFI_DISCONNECTED_BIT) != 0);
     if (connected) {
-        // SSIDs are up to 32 bytes. Assume it is null terminated if it is less.
-        if (memcmp(ssid, config->sta.ssid, ssid_len) == 0 &&
-            (ssid_len == 32 || strlen((const char *)config->sta.ssid) == ssid_len)) {
+        if (same_ssid) {
             // Already connected to the desired network.
             return WIFI_RADIO_ERROR_NONE;
         } else {
@@ -322,32 +326,57 @@ wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t
     esp_wifi_set_config(ESP_IF_WIFI_STA, config);
     self->starting_retries = 5;
     self->retries_left = 5;
+    self->connecting = true;
     esp_wifi_connect();
+    return WIFI_RADIO_ERROR_NONE;
+}
+
+bool common_hal_wifi_radio_connect_finished(wifi_radio_obj_t *self, wifi_radio_error_t *error) {
+    EventBits_t bits = xEventGroupGetBits(self->event_group_handle);
+    if ((bits & WIFI_DISCONNECTED_BIT) != 0) {
+        self->connecting = false;
+        if (self->last_disconnect_reason == WIFI_REASON_AUTH_FAIL) {
+            *error = WIFI_RADIO_ERROR_AUTH_FAIL;
+        } else if (self->last_disconnect_reason == WIFI_REASON_NO_AP_FOUND) {
+            *error = WIFI_RADIO_ERROR_NO_AP_FOUND;
+        } else {
+            *error = self->last_disconnect_reason;
+        }
+        return true;
+    }
+    if ((bits & WIFI_CONNECTED_BIT) != 0) {
+        if (self->connecting) {
+            self->connecting = false;
+            // We're connected, allow us to retry if we get disconnected.
+            self->retries_left = self->starting_retries;
+        }
+        *error = WIFI_RADIO_ERROR_NONE;
+        return true;
+    }
+    return false;
+}
+
+wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, mp_float_t timeout, uint8_t *bssid, size_t bssid_len) {
+    size_t timeout_ms = timeout * 1000;
+    uint32_t start_time = common_hal_time_monotonic_ms();
+    uint32_t end_time = start_time + timeout_ms;
+
+    wifi_radio_error_t error = common_hal_wifi_radio_connect_start(self, ssid, ssid_len, password, password_len, channel, bssid, bssid_len);
+    if (error != WIFI_RADIO_ERROR_NONE) {
+        return error;
+    }
 
     do {
         RUN_BACKGROUND_TASKS;
-        bits = xEventGroupWaitBits(self->event_group_handle,
-            WIFI_CONNECTED_BIT | WIFI_DISCONNECTED_BIT,
-            pdTRUE,
-            pdTRUE,
-            0);
+        if (common_hal_wifi_radio_connect_finished(self, &error)) {
+            return error;
+        }
         // Don't retry anymore if we're over our time budget.
         if (self->retries_left > 0 && common_hal_time_monotonic_ms() > end_time) {
             self->retries_left = 0;
         }
-    } while ((bits & (WIFI_CONNECTED_BIT | WIFI_DISCONNECTED_BIT)) == 0 && !mp_hal_is_interrupted());
+    } while (!mp_hal_is_interrupted());
 
-    if ((bits & WIFI_DISCONNECTED_BIT) != 0) {
-        if (self->last_disconnect_reason == WIFI_REASON_AUTH_FAIL) {
-            return WIFI_RADIO_ERROR_AUTH_FAIL;
-        } else if (self->last_disconnect_reason == WIFI_REASON_NO_AP_FOUND) {
-            return WIFI_RADIO_ERROR_NO_AP_FOUND;
-        }
-        return self->last_disconnect_reason;
-    } else {
-        // We're connected, allow us to retry if we get disconnected.
-        self->retries_left = self->starting_retries;
-    }
     return WIFI_RADIO_ERROR_NONE;
 }
 
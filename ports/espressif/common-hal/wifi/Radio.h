@@ -56,6 +56,8 @@ typedef struct {
     bool started;
     bool ap_mode;
     bool sta_mode;
+    // A connection attempt has been started and hasn't finished yet.
+    bool connecting;
     uint8_t retries_left;
     uint8_t starting_retries;
     uint8_t last_disconnect_reason;
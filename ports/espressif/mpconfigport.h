@@ -43,6 +43,14 @@
 #define MICROPY_NLR_SETJMP                  (1)
 #define CIRCUITPY_DEFAULT_STACK_SIZE        0x6000
 
+// Keep small objects in internal SRAM and put large buffers in PSRAM when the
+// split heap has areas in both.
+#if defined(CONFIG_SPIRAM)
+#include "esp_memory_utils.h"
+#define MICROPY_GC_SLOW_AREAS               (1)
+#define MICROPY_GC_AREA_IS_SLOW(start, end) (esp_ptr_external_ram(start))
+#endif
+
 // Nearly all boards have this because it is used to enter the ROM bootloader.
 #ifndef CIRCUITPY_BOOT_BUTTON
   #if defined(CONFIG_IDF_TARGET_ESP32C3) || defined(CONFIG_IDF_TARGET_ESP32C6) || defined(CONFIG_IDF_TARGET_ESP32H2)
@@ -14,6 +14,8 @@ CIRCUITPY_ESP_PSRAM_SIZE ?= 0
 CIRCUITPY_FULL_BUILD ?= 1
 
 # These modules are implemented in ports/<port>/common-hal:
+# Use the AES engine through ESP-IDF's mbedtls. (hashlib already does this for SHA.)
+CIRCUITPY_AESIO_TINYAES ?= 0
 CIRCUITPY_ALARM ?= 1
 CIRCUITPY_ANALOGBUFIO ?= 1
 CIRCUITPY_AUDIOBUSIO ?= 1
@@ -340,6 +340,10 @@ void port_realloc(void *ptr, size_t size) {
     heap_caps_realloc(ptr, size, MALLOC_CAP_8BIT);
 }
 
+size_t port_heap_get_block_size(void *ptr) {
+    return heap_caps_get_allocated_size(ptr);
+}
+
 size_t port_heap_get_largest_free_size(void) {
     size_t free_size = heap_caps_get_largest_free_block(0);
     return free_size;
@@ -469,6 +473,10 @@ uint64_t port_get_raw_ticks(uint8_t *subticks) {
     return all_subticks / 32;
 }
 
+uint64_t port_get_raw_ticks_us(void) {
+    return esp_timer_get_time();
+}
+
 // Enable 1/1024 second tick.
 void port_enable_tick(void) {
     esp_timer_start_periodic(_tick_timer, 1000000 / 1024);
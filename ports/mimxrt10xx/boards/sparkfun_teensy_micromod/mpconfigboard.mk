@@ -9,3 +9,4 @@ FLASH = W25Q128JV
 CIRCUITPY__EVE = 1
 CIRCUITPY_USB_HOST = 1
 CIRCUITPY_SETTABLE_PROCESSOR_FREQUENCY = 1
+CIRCUITPY_CPU_GOVERNOR = 1
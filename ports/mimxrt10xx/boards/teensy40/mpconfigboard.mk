@@ -8,3 +8,4 @@ CHIP_FAMILY = MIMXRT1062
 FLASH = W25Q16JV
 CIRCUITPY__EVE = 1
 CIRCUITPY_SETTABLE_PROCESSOR_FREQUENCY = 1
+CIRCUITPY_CPU_GOVERNOR = 1
@@ -39,6 +39,10 @@
 #include "sdk/drivers/ocotp/fsl_ocotp.h"
 #include "clocks.h"
 
+#if CIRCUITPY_CPU_GOVERNOR
+#include "supervisor/shared/cpu_governor.h"
+#endif
+
 float common_hal_mcu_processor_get_temperature(void) {
     #if CIRCUITPY_ANALOGIO
     tempmon_config_t config;
@@ -68,6 +72,34 @@ void common_hal_mcu_processor_set_frequency(mcu_processor_obj_t *self,
     SystemCoreClock = setarmclock(frequency);
 }
 
+#if CIRCUITPY_CPU_GOVERNOR
+// These are entries of the table above. setarmclock() lowers the core voltage
+// at 24 MHz, which takes longer to undo, so that is kept for long waits.
+STATIC const cpu_governor_level_t governor_levels[] = {
+    { .frequency = 24000000, .min_idle_ms = 50 },
+    { .frequency = 150000000, .min_idle_ms = 5 },
+};
+
+const cpu_governor_level_t *port_cpu_governor_levels(size_t *count) {
+    *count = MP_ARRAY_SIZE(governor_levels);
+    return governor_levels;
+}
+
+bool port_cpu_governor_set_frequency(uint32_t frequency) {
+    // FlexPWM counts the IPG clock, which is divided down from the ARM clock.
+    if (frequency < SystemCoreClock) {
+        static PWM_Type *const flexpwms[] = PWM_BASE_PTRS;
+        for (size_t i = 0; i < MP_ARRAY_SIZE(flexpwms); i++) {
+            if (flexpwms[i] != NULL && (flexpwms[i]->MCTRL & PWM_MCTRL_RUN_MASK) != 0) {
+                return false;
+            }
+        }
+    }
+    SystemCoreClock = setarmclock(frequency);
+    return true;
+}
+#endif
+
 
 float common_hal_mcu_processor_get_voltage(void) {
     return NAN;
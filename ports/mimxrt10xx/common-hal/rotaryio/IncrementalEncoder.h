@@ -30,6 +30,7 @@
 #include "common-hal/microcontroller/Pin.h"
 
 #include "py/obj.h"
+#include "shared-module/rotaryio/velocity.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -38,6 +39,7 @@ typedef struct {
     int8_t sub_count; // count intermediate transitions between detents
     int8_t divisor; // Number of quadrature edges required per count
     mp_int_t position;
+    rotaryio_velocity_t velocity;
 } rotaryio_incrementalencoder_obj_t;
 
 
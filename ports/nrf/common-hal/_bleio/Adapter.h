@@ -37,6 +37,11 @@
 
 #include "supervisor/background_callback.h"
 
+// Number of notifications per connection that the SoftDevice can hold for transmission.
+#ifndef BLEIO_HVN_TX_QUEUE_SIZE
+#define BLEIO_HVN_TX_QUEUE_SIZE 5
+#endif
+
 #ifndef BLEIO_TOTAL_CONNECTION_COUNT
 #define BLEIO_TOTAL_CONNECTION_COUNT 5
 #endif
@@ -36,6 +36,7 @@
 #include "py/stream.h"
 
 #include "shared-bindings/_bleio/__init__.h"
+#include "shared-bindings/_bleio/Adapter.h"
 #include "shared-bindings/_bleio/Connection.h"
 #include "shared-bindings/_bleio/PacketBuffer.h"
 #include "supervisor/shared/tick.h"
@@ -66,12 +67,12 @@ STATIC void write_to_ringbuf(bleio_packet_buffer_obj_t *self, uint8_t *data, uin
 }
 
 STATIC uint32_t queue_next_write(bleio_packet_buffer_obj_t *self) {
-    // Queue up the next outgoing buffer. We use two, one that has been passed to the SD for
-    // transmission (when packet_queued is true) and the other is `pending` and can still be
-    // modified. By primarily appending to the `pending` buffer we can reduce the protocol overhead
-    // of the lower level link and ATT layers.
-    self->packet_queued = false;
-    if (self->pending_size > 0) {
+    // Queue up the next outgoing buffer. We use two, one that was last passed to the SD for
+    // transmission and the other is `pending` and can still be modified. By primarily appending to
+    // the `pending` buffer we can reduce the protocol overhead of the lower level link and ATT
+    // layers. Notifications and writes without response are copied into the SD's own TX queue,
+    // so several can be in flight and go out in the same connection event.
+    if (self->pending_size > 0 && self->packets_queued < self->max_packets_queued) {
         uint16_t conn_handle = self->conn_handle;
         uint32_t err_code;
         if (self->client) {
@@ -102,11 +103,19 @@ STATIC uint32_t queue_next_write(bleio_packet_buffer_obj_t *self) {
         }
         self->pending_size = 0;
         self->pending_index = (self->pending_index + 1) % 2;
-        self->packet_queued = true;
+        self->packets_queued++;
     }
     return NRF_SUCCESS;
 }
 
+STATIC void packets_sent(bleio_packet_buffer_obj_t *self, uint8_t count) {
+    // TX complete counts are per connection, so they include other characteristics' packets.
+    // Undercounting what is queued is harmless: the SD refuses packets it has no room for and
+    // they are retried on the next completion.
+    self->packets_queued -= MIN(count, self->packets_queued);
+    queue_next_write(self);
+}
+
 STATIC bool packet_buffer_on_ble_client_evt(ble_evt_t *ble_evt, void *param) {
     const uint16_t evt_id = ble_evt->header.evt_id;
     bleio_packet_buffer_obj_t *self = (bleio_packet_buffer_obj_t *)param;
@@ -136,10 +145,10 @@ STATIC bool packet_buffer_on_ble_client_evt(ble_evt_t *ble_evt, void *param) {
             break;
         }
         case BLE_GATTC_EVT_WRITE_CMD_TX_COMPLETE:
-            queue_next_write(self);
+            packets_sent(self, ble_evt->evt.gattc_evt.params.write_cmd_tx_complete.count);
             break;
         case BLE_GATTC_EVT_WRITE_RSP:
-            queue_next_write(self);
+            packets_sent(self, 1);
             break;
         default:
             return false;
@@ -200,7 +209,18 @@ STATIC bool packet_buffer_on_ble_server_evt(ble_evt_t *ble_evt, void *param) {
             }
             break;
         case BLE_GATTS_EVT_HVN_TX_COMPLETE:
-            queue_next_write(self);
+            if (ble_evt->evt.gatts_evt.conn_handle != self->conn_handle) {
+                return false;
+            }
+            packets_sent(self, ble_evt->evt.gatts_evt.params.hvn_tx_complete.count);
+            break;
+        case BLE_GATTS_EVT_HVC:
+            // An indication was confirmed.
+            if (ble_evt->evt.gatts_evt.conn_handle != self->conn_handle ||
+                ble_evt->evt.gatts_evt.params.hvc.handle != self->characteristic->handle) {
+                return false;
+            }
+            packets_sent(self, 1);
             break;
         default:
             return false;
@@ -236,7 +256,9 @@ void _common_hal_bleio_packet_buffer_construct(
         ringbuf_init(&self->ringbuf, (uint8_t *)incoming_buffer, incoming_buffer_size);
     }
 
-    self->packet_queued = false;
+    self->packets_queued = 0;
+    // Writes with response and indications must each be acknowledged before the next.
+    self->max_packets_queued = 1;
     self->pending_index = 0;
     self->pending_size = 0;
     self->outgoing[0] = outgoing_buffer1;
@@ -273,6 +295,7 @@ void _common_hal_bleio_packet_buffer_construct(
             self->write_type = BLE_GATT_HVX_INDICATION;
             if (outgoing & CHAR_PROP_NOTIFY) {
                 self->write_type = BLE_GATT_HVX_NOTIFICATION;
+                self->max_packets_queued = BLEIO_HVN_TX_QUEUE_SIZE;
             }
         }
     }
@@ -401,12 +424,12 @@ mp_int_t common_hal_bleio_packet_buffer_write(bleio_packet_buffer_obj_t *self, c
     self->pending_size += len;
     num_bytes_written += len;
 
+    // If the SD has room then sneak in this data now. This is done before leaving the critical
+    // region so a TX complete event can't queue the same pending buffer at the same time.
+    queue_next_write(self);
+
     sd_nvic_critical_region_exit(is_nested_critical_region);
 
-    // If no writes are queued then sneak in this data.
-    if (!self->packet_queued) {
-        queue_next_write(self);
-    }
     return num_bytes_written;
 }
 
@@ -26,6 +26,7 @@
 
 #include "common-hal/audiobusio/PDMIn.h"
 #include "shared-bindings/audiobusio/PDMIn.h"
+#include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/microcontroller/Pin.h"
 
 #include "py/runtime.h"
@@ -35,6 +36,11 @@ NRF_PDM_Type *nrf_pdm = NRF_PDM;
 
 static uint32_t dummy_buffer[4];
 
+// Continuous recording fills the ring one block at a time. 8ms at 16 kHz.
+#define SAMPLES_PER_BLOCK 128
+
+static audiobusio_pdmin_obj_t *recording_pdmin = NULL;
+
 // Caller validates that pins are free.
 void common_hal_audiobusio_pdmin_construct(audiobusio_pdmin_obj_t *self,
     const mcu_pin_obj_t *clock_pin,
@@ -47,6 +53,7 @@ void common_hal_audiobusio_pdmin_construct(audiobusio_pdmin_obj_t *self,
     claim_pin(data_pin);
 
     self->mono = mono;
+    self->ring_obj = NULL;
     self->clock_pin_number = clock_pin->number;
     self->data_pin_number = data_pin->number;
 
@@ -74,6 +81,10 @@ bool common_hal_audiobusio_pdmin_deinited(audiobusio_pdmin_obj_t *self) {
 }
 
 void common_hal_audiobusio_pdmin_deinit(audiobusio_pdmin_obj_t *self) {
+    if (common_hal_audiobusio_pdmin_deinited(self)) {
+        return;
+    }
+    common_hal_audiobusio_pdmin_stop_recording(self);
     nrf_pdm->ENABLE = 0;
 
     reset_pin_number(self->clock_pin_number);
@@ -90,8 +101,7 @@ uint32_t common_hal_audiobusio_pdmin_get_sample_rate(audiobusio_pdmin_obj_t *sel
     return 16000;
 }
 
-uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t *self,
-    uint16_t *output_buffer, uint32_t output_buffer_length) {
+static void set_mode(audiobusio_pdmin_obj_t *self) {
     // Note: Adafruit's module has SELECT pulled to GND, which makes the DATA
     // valid when the CLK is low, therefore it must be sampled on the rising edge.
     if (self->mono) {
@@ -99,6 +109,21 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t *se
     } else {
         nrf_pdm->MODE = PDM_MODE_OPERATION_Mono | PDM_MODE_EDGE_LeftRising;
     }
+}
+
+// SAMPLE.PTR and SAMPLE.MAXCNT are double buffered. The STARTED event means they
+// have been latched for the next transfer and may be changed again.
+static void wait_for_started(void) {
+    nrf_pdm->EVENTS_STARTED = 0;
+    while (!nrf_pdm->EVENTS_STARTED) {
+    }
+    nrf_pdm->EVENTS_STARTED = 0;
+}
+
+uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t *self,
+    uint16_t *output_buffer, uint32_t output_buffer_length) {
+    common_hal_audiobusio_pdmin_stop_recording(self);
+    set_mode(self);
 
     // step 1. Redirect to real buffer
     nrf_pdm->SAMPLE.PTR = (uintptr_t)output_buffer;
@@ -128,3 +153,103 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t *se
         return (output_buffer_length / 4) * 4;
     }
 }
+
+void PDM_IRQHandler(void) {
+    if (!nrf_pdm->EVENTS_STARTED) {
+        return;
+    }
+    nrf_pdm->EVENTS_STARTED = 0;
+    audiobusio_pdmin_obj_t *self = recording_pdmin;
+    if (self == NULL) {
+        return;
+    }
+    // The block being filled is done and the one queued after it has started.
+    // Queue the one after that.
+    self->blocks_done++;
+    uint32_t next_block = (self->blocks_done + 1) % self->ring_blocks;
+    nrf_pdm->SAMPLE.PTR = (uintptr_t)(self->ring + next_block * SAMPLES_PER_BLOCK);
+}
+
+void common_hal_audiobusio_pdmin_start_recording(audiobusio_pdmin_obj_t *self, uint32_t buffer_length) {
+    common_hal_audiobusio_pdmin_stop_recording(self);
+
+    // Round up to whole blocks. One block is being filled and the next is queued
+    // so keep at least one more to read from.
+    uint32_t ring_blocks = MAX(3, (buffer_length + SAMPLES_PER_BLOCK - 1) / SAMPLES_PER_BLOCK);
+    mp_obj_t ring_obj = mp_obj_new_bytearray_of_zeros(ring_blocks * SAMPLES_PER_BLOCK * sizeof(int16_t));
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(ring_obj, &bufinfo, MP_BUFFER_WRITE);
+
+    self->ring_obj = ring_obj;
+    self->ring = bufinfo.buf;
+    self->ring_blocks = ring_blocks;
+    self->blocks_done = 0;
+    self->next_sample = 0;
+    self->overruns = 0;
+
+    set_mode(self);
+    // The PDM is always running into the dummy buffer. Wait for one dummy transfer
+    // to start so that the first block is latched for the one after it.
+    wait_for_started();
+    nrf_pdm->SAMPLE.PTR = (uintptr_t)self->ring;
+    nrf_pdm->SAMPLE.MAXCNT = SAMPLES_PER_BLOCK;
+    wait_for_started();
+    nrf_pdm->SAMPLE.PTR = (uintptr_t)(self->ring + SAMPLES_PER_BLOCK);
+
+    recording_pdmin = self;
+    nrf_pdm->INTENSET = PDM_INTENSET_STARTED_Msk;
+    NVIC_ClearPendingIRQ(PDM_IRQn);
+    NVIC_EnableIRQ(PDM_IRQn);
+}
+
+void common_hal_audiobusio_pdmin_stop_recording(audiobusio_pdmin_obj_t *self) {
+    if (self->ring_obj == NULL) {
+        return;
+    }
+    nrf_pdm->INTENCLR = PDM_INTENCLR_STARTED_Msk;
+    NVIC_DisableIRQ(PDM_IRQn);
+    recording_pdmin = NULL;
+
+    // Go back to the dummy buffer and wait until it is in use so that the ring is
+    // no longer written.
+    nrf_pdm->SAMPLE.PTR = (uintptr_t)&dummy_buffer;
+    nrf_pdm->SAMPLE.MAXCNT = 1;
+    wait_for_started();
+
+    self->ring_obj = NULL;
+    self->ring = NULL;
+}
+
+uint32_t common_hal_audiobusio_pdmin_readinto(audiobusio_pdmin_obj_t *self,
+    uint16_t *output_buffer, uint32_t output_buffer_length) {
+    if (self->ring_obj == NULL) {
+        return 0;
+    }
+    uint64_t captured = (uint64_t)self->blocks_done * SAMPLES_PER_BLOCK;
+    uint64_t available = captured - self->next_sample;
+    // Skip anything in the block being filled or queued to be filled next.
+    uint32_t max_available = (self->ring_blocks - 2) * SAMPLES_PER_BLOCK;
+    if (available > max_available) {
+        uint64_t lost = available - max_available;
+        self->overruns += lost;
+        self->next_sample += lost;
+        available = max_available;
+    }
+    uint32_t ring_samples = self->ring_blocks * SAMPLES_PER_BLOCK;
+    uint32_t count = MIN(available, output_buffer_length);
+    uint32_t index = self->next_sample % ring_samples;
+    for (uint32_t i = 0; i < count; i++) {
+        // They want unsigned.
+        output_buffer[i] = self->ring[index] + 32768;
+        index++;
+        if (index == ring_samples) {
+            index = 0;
+        }
+    }
+    self->next_sample += count;
+    return count;
+}
+
+uint32_t common_hal_audiobusio_pdmin_get_overruns(audiobusio_pdmin_obj_t *self) {
+    return self->overruns;
+}
@@ -35,6 +35,13 @@ typedef struct {
     mp_obj_base_t base;
     uint8_t clock_pin_number, data_pin_number;
     bool mono;
+    // Continuous recording state. ring_obj is NULL when not recording.
+    mp_obj_t ring_obj;
+    int16_t *ring;
+    uint32_t ring_blocks;
+    volatile uint32_t blocks_done;
+    uint64_t next_sample;
+    uint32_t overruns;
 } audiobusio_pdmin_obj_t;
 
 #endif
@@ -48,6 +48,7 @@
 // Special RAM area for SPIM3 transmit buffer, to work around hardware bug.
 // See common.template.ld.
 #define SPIM3_BUFFER_RAM_SIZE       (8 * 1024)     // 8 KiB
+#define CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS (4)
 #endif
 
 #ifdef NRF52833
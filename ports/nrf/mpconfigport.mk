@@ -39,6 +39,8 @@ CIRCUITPY_ROTARYIO_SOFTENCODER = 1
 
 # Sleep and Wakeup
 CIRCUITPY_ALARM ?= 1
+# USB still starts on a deep sleep wake when VBUS is present.
+CIRCUITPY_ALARM_FAST_RESUME ?= $(CIRCUITPY_ALARM)
 
 # Turn on the BLE file service
 CIRCUITPY_BLE_FILE_SERVICE ?= 1
@@ -66,6 +68,9 @@ CIRCUITPY_FRAMEBUFFERIO ?= 1
 CIRCUITPY_COUNTIO ?= 1
 CIRCUITPY_WATCHDOG ?= 1
 
+# The RTC compare interrupt services tick deadlines.
+CIRCUITPY_TICKLESS ?= 1
+
 SD ?= s140
 SOFTDEV_VERSION ?= 6.1.0
 
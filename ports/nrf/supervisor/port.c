@@ -30,6 +30,7 @@
 #include <stdint.h>
 #include "supervisor/background_callback.h"
 #include "supervisor/board.h"
+#include "supervisor/shared/tick.h"
 
 #include "nrfx/hal/nrf_clock.h"
 #include "nrfx/hal/nrf_power.h"
@@ -108,6 +109,9 @@ STATIC void rtc_handler(nrfx_rtc_int_type_t int_type) {
         supervisor_tick();
     } else if (int_type == NRFX_RTC_INT_COMPARE0) {
         nrfx_rtc_cc_set(&rtc_instance, 0, 0, false);
+        #if CIRCUITPY_TICKLESS
+        supervisor_tick_deadline_interrupt();
+        #endif
     } else if (int_type == NRFX_RTC_INT_COMPARE1) {
         // used in light sleep
         #if CIRCUITPY_ALARM
@@ -91,6 +91,22 @@ void init_usb_hardware(void) {
     }
 }
 
+bool port_usb_vbus_present(void) {
+    uint32_t usb_reg;
+    #ifdef SOFTDEVICE_PRESENT
+    uint8_t sd_en = false;
+    (void)sd_softdevice_is_enabled(&sd_en);
+
+    if (sd_en) {
+        sd_power_usbregstatus_get(&usb_reg);
+    } else
+    #endif
+    {
+        usb_reg = NRF_POWER->USBREGSTATUS;
+    }
+    return (usb_reg & POWER_USBREGSTATUS_VBUSDETECT_Msk) != 0;
+}
+
 extern void USBD_IRQHandler(void);
 void USBD_IRQHandler(void) {
     usb_irq_handler(0);
@@ -30,6 +30,9 @@
 #include "shared-bindings/audiocore/WaveFile.h"
 #include "shared-bindings/microcontroller/__init__.h"
 #include "bindings/rp2pio/StateMachine.h"
+#if CIRCUITPY_ANALOGBUFIO
+#include "common-hal/analogbufio/BufferedIn.h"
+#endif
 #include "supervisor/background_callback.h"
 
 #include "py/mpstate.h"
@@ -60,6 +63,8 @@ STATIC size_t audio_dma_convert_samples(audio_dma_t *dma, uint8_t *input, uint32
         mp_raise_RuntimeError(MP_ERROR_TEXT("Internal audio buffer too small"));
     }
 
+    // Each format gets its own loop so that nothing is decided per sample.
+    // Changing signedness in either direction is flipping the top bit.
     uint32_t out_i = 0;
     if (dma->sample_resolution <= 8 && dma->output_resolution > 8) {
         // reading bytes, writing 16-bit words, so output buffer will be bigger.
@@ -76,46 +81,62 @@ STATIC size_t audio_dma_convert_samples(audio_dma_t *dma, uint8_t *input, uint32
         // result, so this is no worse off WRT supported resolutions.
         uint16_t mul = ((1 << dma->output_resolution) - 1) / ((1 << dma->sample_resolution) - 1);
         uint16_t offset = (1 << dma->output_resolution) / 2;
+        uint16_t *out16 = (uint16_t *)output;
 
-        for (uint32_t i = 0; i < input_length; i += dma->sample_spacing) {
-            if (dma->signed_to_unsigned) {
-                ((uint16_t *)output)[out_i] = (uint16_t)((((int8_t *)input)[i] + 0x80) * mul);
-            } else if (dma->unsigned_to_signed) {
-                ((int16_t *)output)[out_i] = (int16_t)(((uint8_t *)input)[i] * mul - offset);
-            } else {
-                ((uint16_t *)output)[out_i] = (uint16_t)(((uint8_t *)input)[i] * mul);
+        if (dma->signed_to_unsigned) {
+            for (uint32_t i = 0; i < input_length; i += dma->sample_spacing) {
+                out16[out_i++] = (input[i] ^ 0x80) * mul;
+            }
+        } else if (dma->unsigned_to_signed) {
+            for (uint32_t i = 0; i < input_length; i += dma->sample_spacing) {
+                out16[out_i++] = input[i] * mul - offset;
+            }
+        } else {
+            for (uint32_t i = 0; i < input_length; i += dma->sample_spacing) {
+                out16[out_i++] = input[i] * mul;
             }
-            out_i += 1;
         }
     } else if (dma->sample_resolution <= 8 && dma->output_resolution <= 8) {
+        uint8_t flip = (dma->signed_to_unsigned || dma->unsigned_to_signed) ? 0x80 : 0;
         for (uint32_t i = 0; i < input_length; i += dma->sample_spacing) {
-            if (dma->signed_to_unsigned) {
-                ((uint8_t *)output)[out_i] = ((int8_t *)input)[i] + 0x80;
-            } else if (dma->unsigned_to_signed) {
-                ((int8_t *)output)[out_i] = ((uint8_t *)input)[i] - 0x80;
-            } else {
-                ((uint8_t *)output)[out_i] = ((uint8_t *)input)[i];
-            }
-            out_i += 1;
+            output[out_i++] = input[i] ^ flip;
         }
     } else if (dma->sample_resolution > 8 && dma->output_resolution > 8) {
         size_t shift = 16 - dma->output_resolution;
-        for (uint32_t i = 0; i < input_length / 2; i += dma->sample_spacing) {
-            if (dma->signed_to_unsigned) {
-                ((uint16_t *)output)[out_i] = ((int16_t *)input)[i] + 0x8000;
-            } else if (dma->unsigned_to_signed) {
-                ((int16_t *)output)[out_i] = ((uint16_t *)input)[i] - 0x8000;
-            } else {
-                ((uint16_t *)output)[out_i] = ((uint16_t *)input)[i];
+        uint16_t flip = (dma->signed_to_unsigned || dma->unsigned_to_signed) ? 0x8000 : 0;
+        const uint16_t *in16 = (const uint16_t *)input;
+        uint16_t *out16 = (uint16_t *)output;
+        uint32_t input_count = input_length / 2;
+
+        if (shift == 0) {
+            for (uint32_t i = 0; i < input_count; i += dma->sample_spacing) {
+                out16[out_i++] = in16[i] ^ flip;
+            }
+        } else if (dma->output_signed) {
+            for (uint32_t i = 0; i < input_count; i += dma->sample_spacing) {
+                out16[out_i++] = (int16_t)(in16[i] ^ flip) >> shift;
             }
-            if (dma->output_resolution < 16) {
-                if (dma->output_signed) {
-                    ((int16_t *)output)[out_i] = ((int16_t *)output)[out_i] >> shift;
-                } else {
-                    ((uint16_t *)output)[out_i] = ((uint16_t *)output)[out_i] >> shift;
+        } else if (dma->noise_shaping) {
+            // Carry each channel's truncation error into its next sample. This
+            // moves the quantization noise up in frequency, above most of the
+            // audio, where the output filter removes more of it.
+            uint32_t mask = (1 << shift) - 1;
+            size_t channel = 0;
+            for (uint32_t i = 0; i < input_count; i += dma->sample_spacing) {
+                uint32_t value = (in16[i] ^ flip) + dma->noise_shaping_error[channel];
+                if (value > 0xffff) {
+                    value = 0xffff;
                 }
+                dma->noise_shaping_error[channel] = value & mask;
+                out16[out_i++] = value >> shift;
+                if (++channel == dma->output_channel_count) {
+                    channel = 0;
+                }
+            }
+        } else {
+            for (uint32_t i = 0; i < input_count; i += dma->sample_spacing) {
+                out16[out_i++] = (in16[i] ^ flip) >> shift;
             }
-            out_i += 1;
         }
     } else {
         // (dma->sample_resolution > 8 && dma->output_resolution <= 8)
@@ -130,45 +151,50 @@ STATIC size_t audio_dma_convert_samples(audio_dma_t *dma, uint8_t *input, uint32
 STATIC void audio_dma_load_next_block(audio_dma_t *dma, size_t buffer_idx) {
     size_t dma_channel = dma->channel[buffer_idx];
 
-    audioio_get_buffer_result_t get_buffer_result;
-    uint8_t *sample_buffer;
-    uint32_t sample_buffer_length;
-    get_buffer_result = audiosample_get_buffer(dma->sample,
-        dma->single_channel_output, dma->audio_channel, &sample_buffer, &sample_buffer_length);
-
-    if (get_buffer_result == GET_BUFFER_ERROR) {
-        audio_dma_stop(dma);
-        return;
-    }
-
     // Convert the sample format resolution and signedness, as necessary.
     // The input sample buffer is what was read from a file, Mixer, or a raw sample buffer.
-    // The output buffer is one of the DMA buffers (passed in).
+    // The output buffer is one of the DMA buffers (passed in). Several sample buffers
+    // go into each DMA buffer so that a late refill is less likely to be heard.
+    audioio_get_buffer_result_t get_buffer_result = GET_BUFFER_MORE_DATA;
+    size_t output_length_used = 0;
+    for (size_t block = 0; block < dma->blocks_per_buffer && get_buffer_result != GET_BUFFER_DONE; block++) {
+        uint8_t *sample_buffer;
+        uint32_t sample_buffer_length;
+        get_buffer_result = audiosample_get_buffer(dma->sample,
+            dma->single_channel_output, dma->audio_channel, &sample_buffer, &sample_buffer_length);
+
+        if (get_buffer_result == GET_BUFFER_ERROR) {
+            audio_dma_stop(dma);
+            return;
+        }
 
-    size_t output_length_used = audio_dma_convert_samples(
-        dma, sample_buffer, sample_buffer_length,
-        dma->buffer[buffer_idx], dma->buffer_length[buffer_idx]);
+        output_length_used += audio_dma_convert_samples(
+            dma, sample_buffer, sample_buffer_length,
+            dma->buffer[buffer_idx] + output_length_used,
+            dma->buffer_length[buffer_idx] - output_length_used);
+
+        if (get_buffer_result == GET_BUFFER_DONE && dma->loop) {
+            audiosample_reset_buffer(dma->sample, dma->single_channel_output, dma->audio_channel);
+            get_buffer_result = GET_BUFFER_MORE_DATA;
+        }
+    }
 
     dma_channel_set_read_addr(dma_channel, dma->buffer[buffer_idx], false /* trigger */);
     dma_channel_set_trans_count(dma_channel, output_length_used / dma->output_size, false /* trigger */);
 
     if (get_buffer_result == GET_BUFFER_DONE) {
-        if (dma->loop) {
-            audiosample_reset_buffer(dma->sample, dma->single_channel_output, dma->audio_channel);
-        } else {
-            // Set channel trigger to ourselves so we don't keep going.
-            dma_channel_hw_t *c = &dma_hw->ch[dma_channel];
-            c->al1_ctrl =
-                (c->al1_ctrl & ~DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS) |
-                (dma_channel << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB);
-
-            if (output_length_used == 0 &&
-                !dma_channel_is_busy(dma->channel[0]) &&
-                !dma_channel_is_busy(dma->channel[1])) {
-                // No data has been read, and both DMA channels have now finished, so it's safe to stop.
-                audio_dma_stop(dma);
-                dma->playing_in_progress = false;
-            }
+        // Set channel trigger to ourselves so we don't keep going.
+        dma_channel_hw_t *c = &dma_hw->ch[dma_channel];
+        c->al1_ctrl =
+            (c->al1_ctrl & ~DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS) |
+            (dma_channel << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB);
+
+        if (output_length_used == 0 &&
+            !dma_channel_is_busy(dma->channel[0]) &&
+            !dma_channel_is_busy(dma->channel[1])) {
+            // No data has been read, and both DMA channels have now finished, so it's safe to stop.
+            audio_dma_stop(dma);
+            dma->playing_in_progress = false;
         }
     }
 }
@@ -182,6 +208,7 @@ audio_dma_result audio_dma_setup_playback(
     uint8_t audio_channel,
     bool output_signed,
     uint8_t output_resolution,
+    bool noise_shaping,
     uint32_t output_register_address,
     uint8_t dma_trigger_source) {
 
@@ -211,6 +238,9 @@ audio_dma_result audio_dma_setup_playback(
     dma->sample_spacing = 1;
     dma->output_resolution = output_resolution;
     dma->sample_resolution = audiosample_bits_per_sample(sample);
+    dma->noise_shaping = noise_shaping;
+    dma->noise_shaping_error[0] = 0;
+    dma->noise_shaping_error[1] = 0;
     dma->output_register_address = output_register_address;
 
     audiosample_reset_buffer(sample, single_channel_output, audio_channel);
@@ -233,6 +263,12 @@ audio_dma_result audio_dma_setup_playback(
         max_buffer_length /= dma->sample_spacing;
     }
 
+    // A sample that fits in one buffer loops by itself.
+    dma->blocks_per_buffer = single_buffer ? 1 : CIRCUITPY_AUDIO_DMA_BLOCKS_PER_BUFFER;
+    max_buffer_length *= dma->blocks_per_buffer;
+    dma->underruns = 0;
+    dma->channels_to_load_mask = 0;
+
     dma->buffer[0] = (uint8_t *)m_realloc(dma->buffer[0], max_buffer_length);
     dma->buffer_length[0] = max_buffer_length;
     if (dma->buffer[0] == NULL) {
@@ -256,8 +292,10 @@ audio_dma_result audio_dma_setup_playback(
         dma->output_size = 1;
     }
     // Transfer both channels at once.
+    dma->output_channel_count = 1;
     if (!single_channel_output && audiosample_channel_count(sample) == 2) {
         dma->output_size *= 2;
+        dma->output_channel_count = 2;
     }
     enum dma_channel_transfer_size dma_size = DMA_SIZE_8;
     if (dma->output_size == 2) {
@@ -431,6 +469,10 @@ void audio_dma_deinit(audio_dma_t *dma) {
     dma->buffer[1] = NULL;
 }
 
+uint32_t audio_dma_get_underruns(audio_dma_t *dma) {
+    return dma->underruns;
+}
+
 bool audio_dma_get_playing(audio_dma_t *dma) {
     if (dma->channel[0] == NUM_DMA_CHANNELS) {
         return false;
@@ -482,6 +524,11 @@ void isr_dma_0(void) {
         dma_hw->ints0 = mask;
         if (MP_STATE_PORT(playing_audio)[i] != NULL) {
             audio_dma_t *dma = MP_STATE_PORT(playing_audio)[i];
+            // The other channel has now started. It is an underrun when it
+            // hasn't been loaded since it last finished.
+            if (dma->channels_to_load_mask & ~mask) {
+                dma->underruns++;
+            }
             // Record all channels whose DMA has completed; they need loading.
             dma->channels_to_load_mask |= mask;
             background_callback_add(&dma->callback, dma_callback_fun, (void *)dma);
@@ -490,6 +537,9 @@ void isr_dma_0(void) {
             rp2pio_statemachine_obj_t *pio = MP_STATE_PORT(background_pio)[i];
             rp2pio_statemachine_dma_complete(pio, i);
         }
+        #if CIRCUITPY_ANALOGBUFIO
+        analogbufio_bufferedin_dma_complete(i);
+        #endif
     }
 }
 
@@ -45,12 +45,17 @@ typedef struct {
     uint8_t sample_spacing;
     uint8_t output_resolution; // in bits
     uint8_t sample_resolution; // in bits
+    uint8_t output_channel_count; // interleaved in the output
+    uint8_t blocks_per_buffer; // sample buffers per DMA buffer
+    volatile uint32_t underruns; // times a DMA buffer started before it was refilled
+    uint16_t noise_shaping_error[2]; // per output channel
     bool loop;
     bool single_channel_output;
     bool signed_to_unsigned;
     bool unsigned_to_signed;
     bool output_signed;
     bool playing_in_progress;
+    bool noise_shaping;
 } audio_dma_t;
 
 typedef enum {
@@ -71,6 +76,8 @@ void audio_dma_reset(void);
 //   output.
 // audio_channel is the index of the channel to dma. single_channel_output must be false in this case.
 // output_signed is true if the dma'd data should be signed. False and it will be unsigned.
+// noise_shaping is true to carry the error of dropping low bits into the next sample. It only
+//   applies to unsigned output of fewer bits than the sample.
 // output_register_address is the address to copy data to.
 // dma_trigger_source is the DMA trigger source which cause another copy
 audio_dma_result audio_dma_setup_playback(audio_dma_t *dma,
@@ -80,11 +87,14 @@ audio_dma_result audio_dma_setup_playback(audio_dma_t *dma,
     uint8_t audio_channel,
     bool output_signed,
     uint8_t output_resolution,
+    bool noise_shaping,
     uint32_t output_register_address,
     uint8_t dma_trigger_source);
 
 void audio_dma_stop(audio_dma_t *dma);
 bool audio_dma_get_playing(audio_dma_t *dma);
+// The number of underruns since playback last started.
+uint32_t audio_dma_get_underruns(audio_dma_t *dma);
 void audio_dma_pause(audio_dma_t *dma);
 void audio_dma_resume(audio_dma_t *dma);
 bool audio_dma_get_paused(audio_dma_t *dma);
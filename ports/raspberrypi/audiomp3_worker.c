@@ -0,0 +1,108 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "audiomp3_worker.h"
+
+#include "py/mpconfig.h"
+
+#if CIRCUITPY_AUDIOMP3_MULTICORE
+
+#include "shared-module/audiomp3/MP3Decoder.h"
+
+#if CIRCUITPY_PICODVI
+#include "common-hal/picodvi/Framebuffer.h"
+extern picodvi_framebuffer_obj_t *active_picodvi;
+#endif
+#if CIRCUITPY_USB_HOST
+#include "common-hal/usb_host/Port.h"
+extern usb_host_port_obj_t usb_host_instance;
+#endif
+
+#include "src/rp2_common/hardware_sync/include/hardware/sync.h"
+#include "src/rp2_common/pico_multicore/include/pico/multicore.h"
+
+STATIC volatile bool _worker_running = false;
+
+static void __not_in_flash_func(core1_main)(void) {
+    // Lets flash writes on core 0 hold this core in RAM.
+    multicore_lockout_victim_init();
+    _worker_running = true;
+
+    while (true) {
+        // A wake that arrives while we're decoding leaves the event set, so
+        // it is never missed.
+        __wfe();
+        audiomp3_mp3file_worker_poll();
+    }
+}
+
+bool audiomp3_port_worker_start(void) {
+    if (_worker_running) {
+        return true;
+    }
+    // Core 1 may already run USB host or DVI.
+    #if CIRCUITPY_PICODVI
+    if (active_picodvi != NULL) {
+        return false;
+    }
+    #endif
+    #if CIRCUITPY_USB_HOST
+    if (usb_host_instance.dp != NULL) {
+        return false;
+    }
+    #endif
+    multicore_launch_core1(core1_main);
+    while (!_worker_running) {
+    }
+    return true;
+}
+
+void audiomp3_port_worker_wake(void) {
+    __sev();
+}
+
+void audiomp3_worker_reset(void) {
+    if (!_worker_running) {
+        return;
+    }
+    audiomp3_mp3file_worker_release();
+    multicore_reset_core1();
+    _worker_running = false;
+}
+
+void audiomp3_worker_lockout_start(void) {
+    if (_worker_running) {
+        multicore_lockout_start_blocking();
+    }
+}
+
+void audiomp3_worker_lockout_end(void) {
+    if (_worker_running) {
+        multicore_lockout_end_blocking();
+    }
+}
+
+#endif
@@ -50,6 +50,8 @@
 //|         blue_dp: microcontroller.Pin,
 //|         blue_dn: microcontroller.Pin,
 //|         color_depth: int = 8,
+//|         tile_size: int = 0,
+//|         tile_count: int = 256,
 //|     ) -> None:
 //|         """Create a Framebuffer object with the given dimensions. Memory is
 //|         allocated outside of onto the heap and then moved outside on VM end.
@@ -80,6 +82,13 @@
 //|         A Framebuffer is often used in conjunction with a
 //|         `framebufferio.FramebufferDisplay`.
 //|
+//|         When tile_size is given, no framebuffer is allocated. Instead each
+//|         scanline is drawn just before it is sent, from a `tile_map` of tile
+//|         indices and `tiles` of pixels in the color_depth format. The map may
+//|         be moved with `scroll_x` and `scroll_y`. This needs a few kilobytes
+//|         plus the tiles, rather than a whole frame, but can't be used with
+//|         `framebufferio.FramebufferDisplay`. Only color framebuffers can have tiles.
+//|
 //|         :param int width: the width of the target display signal. Only 320, 400, 640 or 800 is currently supported depending on color_depth.
 //|         :param int height: the height of the target display signal. Only 240 or 480 is currently supported depending on color_depth.
 //|         :param ~microcontroller.Pin clk_dp: the positive clock signal pin
@@ -92,11 +101,14 @@
 //|         :param ~microcontroller.Pin blue_dn: the negative blue signal pin
 //|         :param int color_depth: the color depth of the framebuffer in bits. 1, 2 for grayscale
 //|           and 8 or 16 for color
+//|         :param int tile_size: the width and height of each tile in pixels. A power of two that
+//|           divides the width and height, or 0 for a normal framebuffer
+//|         :param int tile_count: the number of tiles, up to 256
 //|         """
 
 STATIC mp_obj_t picodvi_framebuffer_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
     enum { ARG_width, ARG_height, ARG_clk_dp, ARG_clk_dn, ARG_red_dp, ARG_red_dn, ARG_green_dp,
-           ARG_green_dn, ARG_blue_dp, ARG_blue_dn, ARG_color_depth };
+           ARG_green_dn, ARG_blue_dp, ARG_blue_dn, ARG_color_depth, ARG_tile_size, ARG_tile_count };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_width, MP_ARG_INT | MP_ARG_REQUIRED },
         { MP_QSTR_height, MP_ARG_INT | MP_ARG_REQUIRED },
@@ -111,6 +123,8 @@ STATIC mp_obj_t picodvi_framebuffer_make_new(const mp_obj_type_t *type, size_t n
         { MP_QSTR_blue_dn, MP_ARG_KW_ONLY | MP_ARG_OBJ | MP_ARG_REQUIRED },
 
         { MP_QSTR_color_depth, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 8} },
+        { MP_QSTR_tile_size, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_tile_count, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 256} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -124,6 +138,8 @@ STATIC mp_obj_t picodvi_framebuffer_make_new(const mp_obj_type_t *type, size_t n
     if (color_depth != 1 && color_depth != 2 && color_depth != 8 && color_depth != 16) {
         mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_color_depth);
     }
+    mp_uint_t tile_size = (mp_uint_t)mp_arg_validate_int_range(args[ARG_tile_size].u_int, 0, 64, MP_QSTR_tile_size);
+    mp_uint_t tile_count = (mp_uint_t)mp_arg_validate_int_range(args[ARG_tile_count].u_int, 1, 256, MP_QSTR_tile_count);
     common_hal_picodvi_framebuffer_construct(self,
         width, height,
         validate_obj_is_free_pin(args[ARG_clk_dp].u_obj, MP_QSTR_clk_dp),
@@ -134,7 +150,7 @@ STATIC mp_obj_t picodvi_framebuffer_make_new(const mp_obj_type_t *type, size_t n
         validate_obj_is_free_pin(args[ARG_green_dn].u_obj, MP_QSTR_green_dn),
         validate_obj_is_free_pin(args[ARG_blue_dp].u_obj, MP_QSTR_blue_dp),
         validate_obj_is_free_pin(args[ARG_blue_dn].u_obj, MP_QSTR_blue_dn),
-        color_depth);
+        color_depth, tile_size, tile_count);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -182,11 +198,94 @@ MP_DEFINE_CONST_FUN_OBJ_1(picodvi_framebuffer_get_height_obj, picodvi_framebuffe
 MP_PROPERTY_GETTER(picodvi_framebuffer_height_obj,
     (mp_obj_t)&picodvi_framebuffer_get_height_obj);
 
+//|     tile_map: Optional[bytearray]
+//|     """The tile index of each tile position, row by row, or None without tiles.
+//|     Indices past tile_count show tile 0."""
+STATIC mp_obj_t picodvi_framebuffer_get_tile_map(mp_obj_t self_in) {
+    picodvi_framebuffer_obj_t *self = (picodvi_framebuffer_obj_t *)self_in;
+    check_for_deinit(self);
+    if (!common_hal_picodvi_framebuffer_has_tiles(self)) {
+        return mp_const_none;
+    }
+    return common_hal_picodvi_framebuffer_get_tile_map(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(picodvi_framebuffer_get_tile_map_obj, picodvi_framebuffer_get_tile_map);
+
+MP_PROPERTY_GETTER(picodvi_framebuffer_tile_map_obj,
+    (mp_obj_t)&picodvi_framebuffer_get_tile_map_obj);
+
+//|     tiles: Optional[memoryview]
+//|     """The pixels of every tile, one tile after another and row by row within each,
+//|     or None without tiles. Items are bytes when color_depth is 8 and 16-bit when it is 16."""
+STATIC mp_obj_t picodvi_framebuffer_get_tiles(mp_obj_t self_in) {
+    picodvi_framebuffer_obj_t *self = (picodvi_framebuffer_obj_t *)self_in;
+    check_for_deinit(self);
+    if (!common_hal_picodvi_framebuffer_has_tiles(self)) {
+        return mp_const_none;
+    }
+    return common_hal_picodvi_framebuffer_get_tiles(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(picodvi_framebuffer_get_tiles_obj, picodvi_framebuffer_get_tiles);
+
+MP_PROPERTY_GETTER(picodvi_framebuffer_tiles_obj,
+    (mp_obj_t)&picodvi_framebuffer_get_tiles_obj);
+
+//|     scroll_x: int
+//|     """The pixel column of the tile map shown at the left edge. The map wraps around."""
+STATIC mp_obj_t picodvi_framebuffer_get_scroll_x(mp_obj_t self_in) {
+    picodvi_framebuffer_obj_t *self = (picodvi_framebuffer_obj_t *)self_in;
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_picodvi_framebuffer_get_scroll_x(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(picodvi_framebuffer_get_scroll_x_obj, picodvi_framebuffer_get_scroll_x);
+
+STATIC mp_obj_t picodvi_framebuffer_set_scroll_x(mp_obj_t self_in, mp_obj_t x_obj) {
+    picodvi_framebuffer_obj_t *self = (picodvi_framebuffer_obj_t *)self_in;
+    check_for_deinit(self);
+    mp_int_t x = mp_arg_validate_int_range(mp_obj_get_int(x_obj), 0,
+        common_hal_picodvi_framebuffer_get_width(self) - 1, MP_QSTR_scroll_x);
+    common_hal_picodvi_framebuffer_set_scroll(self, x, common_hal_picodvi_framebuffer_get_scroll_y(self));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(picodvi_framebuffer_set_scroll_x_obj, picodvi_framebuffer_set_scroll_x);
+
+MP_PROPERTY_GETSET(picodvi_framebuffer_scroll_x_obj,
+    (mp_obj_t)&picodvi_framebuffer_get_scroll_x_obj,
+    (mp_obj_t)&picodvi_framebuffer_set_scroll_x_obj);
+
+//|     scroll_y: int
+//|     """The pixel row of the tile map shown at the top edge. The map wraps around."""
+//|
+STATIC mp_obj_t picodvi_framebuffer_get_scroll_y(mp_obj_t self_in) {
+    picodvi_framebuffer_obj_t *self = (picodvi_framebuffer_obj_t *)self_in;
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_picodvi_framebuffer_get_scroll_y(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(picodvi_framebuffer_get_scroll_y_obj, picodvi_framebuffer_get_scroll_y);
+
+STATIC mp_obj_t picodvi_framebuffer_set_scroll_y(mp_obj_t self_in, mp_obj_t y_obj) {
+    picodvi_framebuffer_obj_t *self = (picodvi_framebuffer_obj_t *)self_in;
+    check_for_deinit(self);
+    mp_int_t y = mp_arg_validate_int_range(mp_obj_get_int(y_obj), 0,
+        common_hal_picodvi_framebuffer_get_height(self) - 1, MP_QSTR_scroll_y);
+    common_hal_picodvi_framebuffer_set_scroll(self, common_hal_picodvi_framebuffer_get_scroll_x(self), y);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(picodvi_framebuffer_set_scroll_y_obj, picodvi_framebuffer_set_scroll_y);
+
+MP_PROPERTY_GETSET(picodvi_framebuffer_scroll_y_obj,
+    (mp_obj_t)&picodvi_framebuffer_get_scroll_y_obj,
+    (mp_obj_t)&picodvi_framebuffer_set_scroll_y_obj);
+
 STATIC const mp_rom_map_elem_t picodvi_framebuffer_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&picodvi_framebuffer_deinit_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&picodvi_framebuffer_width_obj) },
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&picodvi_framebuffer_height_obj) },
+    { MP_ROM_QSTR(MP_QSTR_tile_map), MP_ROM_PTR(&picodvi_framebuffer_tile_map_obj) },
+    { MP_ROM_QSTR(MP_QSTR_tiles), MP_ROM_PTR(&picodvi_framebuffer_tiles_obj) },
+    { MP_ROM_QSTR(MP_QSTR_scroll_x), MP_ROM_PTR(&picodvi_framebuffer_scroll_x_obj) },
+    { MP_ROM_QSTR(MP_QSTR_scroll_y), MP_ROM_PTR(&picodvi_framebuffer_scroll_y_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(picodvi_framebuffer_locals_dict, picodvi_framebuffer_locals_dict_table);
 
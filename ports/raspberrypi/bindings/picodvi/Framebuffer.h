@@ -38,7 +38,7 @@ void common_hal_picodvi_framebuffer_construct(picodvi_framebuffer_obj_t *self,
     const mcu_pin_obj_t *red_dp, const mcu_pin_obj_t *red_dn,
     const mcu_pin_obj_t *green_dp, const mcu_pin_obj_t *green_dn,
     const mcu_pin_obj_t *blue_dp, const mcu_pin_obj_t *blue_dn,
-    mp_uint_t color_depth);
+    mp_uint_t color_depth, mp_uint_t tile_size, mp_uint_t tile_count);
 void common_hal_picodvi_framebuffer_deinit(picodvi_framebuffer_obj_t *self);
 bool common_hal_picodvi_framebuffer_deinited(picodvi_framebuffer_obj_t *self);
 void common_hal_picodvi_framebuffer_refresh(picodvi_framebuffer_obj_t *self);
@@ -47,3 +47,9 @@ int common_hal_picodvi_framebuffer_get_height(picodvi_framebuffer_obj_t *self);
 int common_hal_picodvi_framebuffer_get_row_stride(picodvi_framebuffer_obj_t *self);
 int common_hal_picodvi_framebuffer_get_color_depth(picodvi_framebuffer_obj_t *self);
 mp_int_t common_hal_picodvi_framebuffer_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags);
+bool common_hal_picodvi_framebuffer_has_tiles(picodvi_framebuffer_obj_t *self);
+mp_obj_t common_hal_picodvi_framebuffer_get_tile_map(picodvi_framebuffer_obj_t *self);
+mp_obj_t common_hal_picodvi_framebuffer_get_tiles(picodvi_framebuffer_obj_t *self);
+mp_uint_t common_hal_picodvi_framebuffer_get_scroll_x(picodvi_framebuffer_obj_t *self);
+mp_uint_t common_hal_picodvi_framebuffer_get_scroll_y(picodvi_framebuffer_obj_t *self);
+void common_hal_picodvi_framebuffer_set_scroll(picodvi_framebuffer_obj_t *self, mp_uint_t x, mp_uint_t y);
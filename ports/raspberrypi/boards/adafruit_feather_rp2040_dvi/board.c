@@ -38,7 +38,7 @@ void board_init(void) {
         &pin_GPIO19, &pin_GPIO18,
         &pin_GPIO21, &pin_GPIO20,
         &pin_GPIO23, &pin_GPIO22,
-        8);
+        8, 0, 0);
 
     framebufferio_framebufferdisplay_obj_t *display = &allocate_display()->framebuffer_display;
     display->base.type = &framebufferio_framebufferdisplay_type;
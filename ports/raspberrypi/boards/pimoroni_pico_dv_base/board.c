@@ -38,7 +38,7 @@ void board_init(void) {
         &pin_GPIO9, &pin_GPIO8,
         &pin_GPIO11, &pin_GPIO10,
         &pin_GPIO13, &pin_GPIO12,
-        8);
+        8, 0, 0);
 
     framebufferio_framebufferdisplay_obj_t *display = &displays[0].framebuffer_display;
     display->base.type = &framebufferio_framebufferdisplay_type;
@@ -30,13 +30,16 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include "common-hal/analogbufio/BufferedIn.h"
 #include "shared-bindings/analogbufio/BufferedIn.h"
+#include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared/runtime/interrupt_char.h"
 #include "py/runtime.h"
 #include "src/rp2_common/hardware_adc/include/hardware/adc.h"
 #include "src/rp2_common/hardware_dma/include/hardware/dma.h"
+#include "src/rp2_common/hardware_irq/include/hardware/irq.h"
 #include "src/common/pico_stdlib/include/pico/stdlib.h"
 
 #define ADC_FIRST_PIN_NUMBER 26
@@ -45,6 +48,9 @@
 #define ADC_CLOCK_INPUT 48000000
 #define ADC_MAX_CLOCK_DIV (1 << (ADC_DIV_INT_MSB - ADC_DIV_INT_LSB + 1))
 
+// There is only one ADC so only one BufferedIn can capture continuously.
+STATIC analogbufio_bufferedin_obj_t *continuous_bufferedin = NULL;
+
 void common_hal_analogbufio_bufferedin_construct(analogbufio_bufferedin_obj_t *self, const mcu_pin_obj_t *pin, uint32_t sample_rate) {
     // Make sure pin number is in range for ADC
     if (pin->number < ADC_FIRST_PIN_NUMBER || pin->number >= (ADC_FIRST_PIN_NUMBER + ADC_PIN_COUNT)) {
@@ -56,6 +62,7 @@ void common_hal_analogbufio_bufferedin_construct(analogbufio_bufferedin_obj_t *s
 
     // Set pin and channel
     self->pin = pin;
+    self->ring_obj = NULL;
     claim_pin(pin);
 
     // TODO: find a way to accept ADC4 for temperature
@@ -108,6 +115,8 @@ void common_hal_analogbufio_bufferedin_deinit(analogbufio_bufferedin_obj_t *self
         return;
     }
 
+    common_hal_analogbufio_bufferedin_stop_continuous(self);
+
     // Release ADC Pin
     reset_pin_number(self->pin->number);
     self->pin = NULL;
@@ -116,7 +125,168 @@ void common_hal_analogbufio_bufferedin_deinit(analogbufio_bufferedin_obj_t *self
     dma_channel_unclaim(self->dma_chan);
 }
 
+// Called from the DMA interrupt each time the data channel reaches the end of the
+// ring. The control channel has already restarted it at the beginning.
+void analogbufio_bufferedin_dma_complete(uint channel) {
+    if (continuous_bufferedin != NULL && continuous_bufferedin->dma_chan == channel) {
+        continuous_bufferedin->laps++;
+    }
+}
+
+void common_hal_analogbufio_bufferedin_start_continuous(analogbufio_bufferedin_obj_t *self, mp_obj_t ring_obj, uint8_t *ring, uint32_t len, uint8_t bytes_per_sample) {
+    #if !CIRCUITPY_AUDIOCORE
+    // The DMA interrupt handler lives with audio.
+    mp_raise_NotImplementedError(NULL);
+    #endif
+    common_hal_analogbufio_bufferedin_stop_continuous(self);
+    if (continuous_bufferedin != NULL) {
+        mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q in use"), MP_QSTR_BufferedIn);
+    }
+
+    self->ring = ring;
+    self->ring_len = len / bytes_per_sample;
+    self->bytes_per_sample = bytes_per_sample;
+    self->ring_start = (uint32_t)ring;
+    self->laps = 0;
+    self->next_sample = 0;
+    self->overruns = 0;
+
+    adc_fifo_setup(
+        true,                 // Write each completed conversion to the sample FIFO
+        true,                 // Enable DMA data request (DREQ)
+        1,                    // DREQ (and IRQ) asserted when at least 1 sample present
+        false,                // Leave out the ERR bit so it doesn't need to be masked
+        bytes_per_sample == 1 // Shift each sample to 8 bits when pushing to FIFO
+        );
+
+    // The control channel restarts the data channel at the start of the ring as
+    // soon as it finishes so that no samples are missed.
+    self->ctrl_chan = dma_claim_unused_channel(true);
+    dma_channel_config ctrl_cfg = dma_channel_get_default_config(self->ctrl_chan);
+    channel_config_set_transfer_data_size(&ctrl_cfg, DMA_SIZE_32);
+    channel_config_set_read_increment(&ctrl_cfg, false);
+    channel_config_set_write_increment(&ctrl_cfg, false);
+    dma_channel_configure(self->ctrl_chan, &ctrl_cfg,
+        &dma_hw->ch[self->dma_chan].al2_write_addr_trig, // dst
+        &self->ring_start, // src
+        1,                 // transfer count
+        false              // don't start yet
+        );
+
+    dma_channel_config data_cfg = self->cfg;
+    channel_config_set_transfer_data_size(&data_cfg, bytes_per_sample == 2 ? DMA_SIZE_16 : DMA_SIZE_8);
+    channel_config_set_chain_to(&data_cfg, self->ctrl_chan);
+    dma_channel_configure(self->dma_chan, &data_cfg,
+        ring,          // dst
+        &adc_hw->fifo, // src
+        self->ring_len, // transfer count, reloaded on each restart
+        false          // don't start yet
+        );
+
+    self->ring_obj = ring_obj;
+    continuous_bufferedin = self;
+
+    uint32_t mask = 1u << self->dma_chan;
+    dma_hw->ints0 = mask;
+    dma_hw->inte0 |= mask;
+    irq_set_mask_enabled(1 << DMA_IRQ_0, true);
+
+    adc_fifo_drain();
+    dma_channel_start(self->dma_chan);
+    adc_run(true);
+}
+
+void common_hal_analogbufio_bufferedin_stop_continuous(analogbufio_bufferedin_obj_t *self) {
+    if (self->ring_obj == NULL) {
+        return;
+    }
+    adc_run(false);
+    dma_hw->inte0 &= ~(1u << self->dma_chan);
+    // Stop the channels from triggering each other before aborting them.
+    hw_clear_bits(&dma_hw->ch[self->dma_chan].al1_ctrl, DMA_CH0_CTRL_TRIG_EN_BITS);
+    hw_clear_bits(&dma_hw->ch[self->ctrl_chan].al1_ctrl, DMA_CH0_CTRL_TRIG_EN_BITS);
+    dma_channel_abort(self->dma_chan);
+    dma_channel_abort(self->ctrl_chan);
+    dma_channel_unclaim(self->ctrl_chan);
+    adc_fifo_drain();
+
+    continuous_bufferedin = NULL;
+    self->ring_obj = NULL;
+    self->ring = NULL;
+}
+
+bool common_hal_analogbufio_bufferedin_get_continuous(analogbufio_bufferedin_obj_t *self) {
+    return self->ring_obj != NULL;
+}
+
+// The total number of samples written to the ring since capture started.
+STATIC uint64_t _samples_captured(analogbufio_bufferedin_obj_t *self) {
+    uint32_t mask = 1u << self->dma_chan;
+    uint32_t pending;
+    uint32_t write_addr;
+    common_hal_mcu_disable_interrupts();
+    // A lap that finished but hasn't been counted by the interrupt yet shows up as
+    // a pending interrupt. Make sure the address goes with the pending state.
+    do {
+        pending = dma_hw->intr & mask;
+        write_addr = dma_hw->ch[self->dma_chan].write_addr;
+    } while ((dma_hw->intr & mask) != pending);
+    uint64_t laps = self->laps + (pending != 0 ? 1 : 0);
+    common_hal_mcu_enable_interrupts();
+
+    uint32_t position = (write_addr - self->ring_start) / self->bytes_per_sample;
+    // The data channel sits at the end of the ring until it is restarted.
+    if (position >= self->ring_len) {
+        position = 0;
+    }
+    return laps * self->ring_len + position;
+}
+
+uint64_t common_hal_analogbufio_bufferedin_get_sample_count(analogbufio_bufferedin_obj_t *self) {
+    return self->next_sample;
+}
+
+uint32_t common_hal_analogbufio_bufferedin_get_overruns(analogbufio_bufferedin_obj_t *self) {
+    return self->overruns;
+}
+
+// Copy out whatever has been captured since the last read without waiting.
+STATIC uint32_t _read_continuous(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len) {
+    uint8_t bytes_per_sample = self->bytes_per_sample;
+    uint64_t captured = _samples_captured(self);
+    uint64_t available = captured - self->next_sample;
+    if (available > self->ring_len) {
+        // The oldest samples have been overwritten.
+        uint64_t lost = available - self->ring_len;
+        self->overruns += lost;
+        self->next_sample += lost;
+        available = self->ring_len;
+    }
+    uint32_t count = MIN(available, len / bytes_per_sample);
+    uint32_t start = self->next_sample % self->ring_len;
+    uint32_t first = MIN(count, self->ring_len - start);
+    memcpy(buffer, self->ring + start * bytes_per_sample, first * bytes_per_sample);
+    memcpy(buffer + first * bytes_per_sample, self->ring, (count - first) * bytes_per_sample);
+    self->next_sample += count;
+
+    if (bytes_per_sample == 2) {
+        uint16_t *buf16 = (uint16_t *)buffer;
+        for (size_t i = 0; i < count; i++) {
+            // Scale the values to the standard 16 bit range.
+            uint16_t value = buf16[i];
+            buf16[i] = (value << 4) | (value >> 8);
+        }
+    }
+    return count;
+}
+
 uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample) {
+    if (self->ring_obj != NULL) {
+        if (bytes_per_sample != self->bytes_per_sample) {
+            mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be array of type 'H'"), MP_QSTR_buffer);
+        }
+        return _read_continuous(self, buffer, len);
+    }
     // RP2040 Implementation Detail
     // Fills the supplied buffer with ADC values using DMA transfer.
     // If the buffer is 8-bit, then values are 8-bit shifted and error bit is off.
@@ -44,6 +44,19 @@ typedef struct {
     uint8_t chan;
     uint dma_chan;
     dma_channel_config cfg;
+    // Continuous capture state. ring_obj is NULL when not capturing continuously.
+    mp_obj_t ring_obj;
+    uint8_t *ring;
+    uint32_t ring_len; // in samples
+    uint8_t bytes_per_sample;
+    uint ctrl_chan;
+    // The control channel rewrites the data channel's write address from here.
+    uint32_t ring_start;
+    volatile uint32_t laps;
+    uint64_t next_sample;
+    uint32_t overruns;
 } analogbufio_bufferedin_obj_t;
 
+void analogbufio_bufferedin_dma_complete(uint channel);
+
 #endif // MICROPY_INCLUDED_RASPBERRYPI_COMMON_HAL_ANALOGBUFIO_BUFFEREDIN_H
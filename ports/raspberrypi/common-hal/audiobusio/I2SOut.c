@@ -201,6 +201,7 @@ void common_hal_audiobusio_i2sout_play(audiobusio_i2sout_obj_t *self,
         0, // audio channel
         true,  // output signed
         bits_per_sample,
+        false, // noise shaping
         (uint32_t)&self->state_machine.pio->txf[self->state_machine.state_machine],  // output register
         self->state_machine.tx_dreq); // data request line
 
@@ -244,3 +245,7 @@ bool common_hal_audiobusio_i2sout_get_playing(audiobusio_i2sout_obj_t *self) {
     }
     return playing;
 }
+
+mp_int_t common_hal_audiobusio_i2sout_get_underruns(audiobusio_i2sout_obj_t *self) {
+    return audio_dma_get_underruns(&self->dma);
+}
@@ -31,11 +31,15 @@
 #include "py/mperrno.h"
 #include "py/runtime.h"
 #include "shared-bindings/audiobusio/PDMIn.h"
+#include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/microcontroller/Pin.h"
+#include "shared-module/audiobusio/__init__.h"
 
 #include "audio_dma.h"
 
-#define OVERSAMPLING 64
+#define OVERSAMPLING AUDIOBUSIO_PDM_OVERSAMPLING
+// Each sample is decimated from two words of PDM data.
+#define WORDS_PER_SAMPLE (OVERSAMPLING / 32)
 #define SAMPLES_PER_BUFFER 32
 
 // MEMS microphones must be clocked at at least 1MHz.
@@ -88,6 +92,7 @@ void common_hal_audiobusio_pdmin_construct(audiobusio_pdmin_obj_t *self,
 
     self->sample_rate = actual_frequency / oversample;
     self->bit_depth = bit_depth;
+    self->raw_obj = NULL;
 }
 
 bool common_hal_audiobusio_pdmin_deinited(audiobusio_pdmin_obj_t *self) {
@@ -98,6 +103,7 @@ void common_hal_audiobusio_pdmin_deinit(audiobusio_pdmin_obj_t *self) {
     if (common_hal_audiobusio_pdmin_deinited(self)) {
         return;
     }
+    common_hal_audiobusio_pdmin_stop_recording(self);
     return common_hal_rp2pio_statemachine_deinit(&self->state_machine);
 }
 
@@ -109,59 +115,19 @@ uint32_t common_hal_audiobusio_pdmin_get_sample_rate(audiobusio_pdmin_obj_t *sel
     return self->sample_rate;
 }
 
-// a windowed sinc filter for 44 khz, 64 samples
-//
-// This filter is good enough to use for lower sample rates as
-// well. It does not increase the noise enough to be a problem.
-//
-// In the long run we could use a fast filter like this to do the
-// decimation and initial filtering in real time, filtering to a
-// higher sample rate than specified.  Then after the audio is
-// recorded, a more expensive filter non-real-time filter could be
-// used to down-sample and low-pass.
-const uint16_t sinc_filter[OVERSAMPLING] = {
-    0, 2, 9, 21, 39, 63, 94, 132,
-    179, 236, 302, 379, 467, 565, 674, 792,
-    920, 1055, 1196, 1341, 1487, 1633, 1776, 1913,
-    2042, 2159, 2263, 2352, 2422, 2474, 2506, 2516,
-    2506, 2474, 2422, 2352, 2263, 2159, 2042, 1913,
-    1776, 1633, 1487, 1341, 1196, 1055, 920, 792,
-    674, 565, 467, 379, 302, 236, 179, 132,
-    94, 63, 39, 21, 9, 2, 0, 0
-};
-
-#define REPEAT_32_TIMES(X) do { X X X X X X X X X X X X X X X X X X X X X X X X X X X X X X X X } while (0)
-
-static uint16_t filter_sample(uint32_t pdm_samples[2]) {
-    uint16_t running_sum = 0;
-    const uint16_t *filter_ptr = sinc_filter;
-    for (uint8_t i = 0; i < 2; i++) {
-        uint32_t pdm_sample = pdm_samples[i];
-        REPEAT_32_TIMES({
-            if (pdm_sample & 0x1) {
-                running_sum += *filter_ptr;
-            }
-            filter_ptr++;
-            pdm_sample >>= 1;
-        }
-            );
-    }
-    return running_sum;
-}
-
 // output_buffer may be a byte buffer or a halfword buffer.
 // output_buffer_length is the number of slots, not the number of bytes.
 uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t *self,
     uint16_t *output_buffer, uint32_t output_buffer_length) {
-    uint32_t samples[2];
+    uint32_t samples[WORDS_PER_SAMPLE];
     size_t output_count = 0;
+    common_hal_audiobusio_pdmin_stop_recording(self);
     common_hal_rp2pio_statemachine_clear_rxfifo(&self->state_machine);
     // Do one read to get the mic going and throw it away.
     common_hal_rp2pio_statemachine_readinto(&self->state_machine, (uint8_t *)samples, 2 * sizeof(uint32_t), sizeof(uint32_t), false);
     while (output_count < output_buffer_length && !common_hal_rp2pio_statemachine_get_rxstall(&self->state_machine)) {
         common_hal_rp2pio_statemachine_readinto(&self->state_machine, (uint8_t *)samples, 2 * sizeof(uint32_t), sizeof(uint32_t), false);
-        // Call filter_sample just one place so it can be inlined.
-        uint16_t value = filter_sample(samples);
+        uint16_t value = audiobusio_pdm_filter_lsb_first(samples);
         if (self->bit_depth == 8) {
             // Truncate to 8 bits.
             ((uint8_t *)output_buffer)[output_count] = value >> 8;
@@ -173,3 +139,89 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t *se
 
     return output_count;
 }
+
+void common_hal_audiobusio_pdmin_start_recording(audiobusio_pdmin_obj_t *self, uint32_t buffer_length) {
+    common_hal_audiobusio_pdmin_stop_recording(self);
+
+    // The state machine DMAs raw PDM data round and round this buffer. It is
+    // filtered when it is read.
+    mp_obj_t raw_obj = mp_obj_new_bytearray_of_zeros(buffer_length * WORDS_PER_SAMPLE * sizeof(uint32_t));
+    sm_buf_info loop;
+    loop.obj = raw_obj;
+    mp_get_buffer_raise(raw_obj, &loop.info, MP_BUFFER_WRITE);
+    sm_buf_info once;
+    memset(&once, 0, sizeof(once));
+
+    common_hal_rp2pio_statemachine_clear_rxfifo(&self->state_machine);
+    if (!common_hal_rp2pio_statemachine_background_read(&self->state_machine, &once, &loop, &once, sizeof(uint32_t), false)) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("No DMA channel found"));
+    }
+    self->raw_obj = raw_obj;
+    self->raw = loop.info.buf;
+    self->raw_samples = buffer_length;
+    self->laps = 0;
+    self->next_sample = 0;
+    self->overruns = 0;
+}
+
+void common_hal_audiobusio_pdmin_stop_recording(audiobusio_pdmin_obj_t *self) {
+    if (self->raw_obj == NULL) {
+        return;
+    }
+    common_hal_rp2pio_statemachine_stop_background_read(&self->state_machine);
+    self->raw_obj = NULL;
+    self->raw = NULL;
+}
+
+// The total number of samples of raw data written since recording started.
+STATIC uint64_t _samples_captured(audiobusio_pdmin_obj_t *self) {
+    common_hal_mcu_disable_interrupts();
+    // Each pass around the buffer is either handed over as the last read or counted
+    // as a read overrun when the previous one wasn't collected.
+    if (common_hal_rp2pio_statemachine_get_last_read(&self->state_machine) != mp_const_empty_bytes) {
+        self->laps++;
+    }
+    uint64_t laps = self->laps + common_hal_rp2pio_statemachine_get_read_overruns(&self->state_machine);
+    size_t offset = rp2pio_statemachine_get_read_offset(&self->state_machine);
+    common_hal_mcu_enable_interrupts();
+    return laps * self->raw_samples + offset / (WORDS_PER_SAMPLE * sizeof(uint32_t));
+}
+
+// output_buffer may be a byte buffer or a halfword buffer.
+// output_buffer_length is the number of slots, not the number of bytes.
+uint32_t common_hal_audiobusio_pdmin_readinto(audiobusio_pdmin_obj_t *self,
+    uint16_t *output_buffer, uint32_t output_buffer_length) {
+    if (self->raw_obj == NULL) {
+        return 0;
+    }
+    uint64_t available = _samples_captured(self) - self->next_sample;
+    // Leave room for the DMA to keep writing while the oldest samples are filtered.
+    uint32_t max_available = self->raw_samples - self->raw_samples / 4;
+    if (available > max_available) {
+        uint64_t lost = available - max_available;
+        self->overruns += lost;
+        self->next_sample += lost;
+        available = max_available;
+    }
+    uint32_t count = MIN(available, output_buffer_length);
+    uint32_t index = self->next_sample % self->raw_samples;
+    for (uint32_t i = 0; i < count; i++) {
+        uint16_t value = audiobusio_pdm_filter_lsb_first(self->raw + index * WORDS_PER_SAMPLE);
+        if (self->bit_depth == 8) {
+            // Truncate to 8 bits.
+            ((uint8_t *)output_buffer)[i] = value >> 8;
+        } else {
+            output_buffer[i] = value;
+        }
+        index++;
+        if (index == self->raw_samples) {
+            index = 0;
+        }
+    }
+    self->next_sample += count;
+    return count;
+}
+
+uint32_t common_hal_audiobusio_pdmin_get_overruns(audiobusio_pdmin_obj_t *self) {
+    return self->overruns;
+}
@@ -41,6 +41,13 @@ typedef struct {
     uint8_t bytes_per_sample;
     uint8_t bit_depth;
     rp2pio_statemachine_obj_t state_machine;
+    // Continuous recording state. raw_obj is NULL when not recording.
+    mp_obj_t raw_obj;
+    uint32_t *raw;
+    uint32_t raw_samples;
+    uint32_t laps;
+    uint64_t next_sample;
+    uint32_t overruns;
 } audiobusio_pdmin_obj_t;
 
 void pdmin_reset(void);
@@ -232,6 +232,7 @@ void common_hal_audiopwmio_pwmaudioout_play(audiopwmio_pwmaudioout_obj_t *self,
         0, // audio channel
         false,  // output signed
         BITS_PER_SAMPLE,
+        CIRCUITPY_AUDIOPWMIO_NOISE_SHAPING,
         (uint32_t)tx_register,  // output register: PWM cc register
         0x3b + pacing_timer); // data request line
 
@@ -284,3 +285,7 @@ void common_hal_audiopwmio_pwmaudioout_resume(audiopwmio_pwmaudioout_obj_t *self
 bool common_hal_audiopwmio_pwmaudioout_get_paused(audiopwmio_pwmaudioout_obj_t *self) {
     return audio_dma_get_paused(&self->dma);
 }
+
+mp_int_t common_hal_audiopwmio_pwmaudioout_get_underruns(audiopwmio_pwmaudioout_obj_t *self) {
+    return audio_dma_get_underruns(&self->dma);
+}
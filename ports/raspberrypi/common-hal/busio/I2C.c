@@ -34,6 +34,8 @@
 #include "shared-bindings/bitbangio/I2C.h"
 
 #include "src/rp2_common/hardware_gpio/include/hardware/gpio.h"
+#include "src/rp2_common/hardware_irq/include/hardware/irq.h"
+#include "src/rp2_common/hardware_timer/include/hardware/timer.h"
 
 // Synopsys  DW_apb_i2c  (v2.01)  IP
 
@@ -42,8 +44,22 @@
 // One second
 #define BUS_TIMEOUT_US 1000000
 
+// Both FIFOs are this deep.
+#define FIFO_DEPTH 16
+
 STATIC bool never_reset_i2c[2];
 STATIC i2c_inst_t *i2c[2] = {i2c0, i2c1};
+// The object with an asynchronous transfer in progress on each peripheral.
+STATIC busio_i2c_obj_t *async_i2c[2];
+
+STATIC void async_stop(size_t index) {
+    irq_set_enabled(I2C0_IRQ + index, false);
+    // Only touch the peripheral when it's running.
+    if (async_i2c[index] != NULL) {
+        i2c_get_hw(i2c[index])->intr_mask = 0;
+        async_i2c[index] = NULL;
+    }
+}
 
 void reset_i2c(void) {
     for (size_t i = 0; i < 2; i++) {
@@ -51,6 +67,7 @@ void reset_i2c(void) {
             continue;
         }
 
+        async_stop(i);
         i2c_deinit(i2c[i]);
     }
 }
@@ -120,6 +137,8 @@ void common_hal_busio_i2c_construct(busio_i2c_obj_t *self,
 
     self->scl_pin = scl->number;
     self->sda_pin = sda->number;
+    self->async_pending = false;
+    self->async_result = 0;
     claim_pin(scl);
     claim_pin(sda);
 
@@ -135,8 +154,13 @@ void common_hal_busio_i2c_deinit(busio_i2c_obj_t *self) {
     if (common_hal_busio_i2c_deinited(self)) {
         return;
     }
-    never_reset_i2c[i2c_hw_index(self->peripheral)] = false;
+    size_t index = i2c_hw_index(self->peripheral);
+    never_reset_i2c[index] = false;
 
+    if (self->async_pending) {
+        async_stop(index);
+        self->async_pending = false;
+    }
     i2c_deinit(self->peripheral);
 
     reset_pin_number(self->sda_pin);
@@ -166,8 +190,102 @@ void common_hal_busio_i2c_unlock(busio_i2c_obj_t *self) {
     self->has_lock = false;
 }
 
+// Queue as many commands as there is room for, without queueing more reads than the RX FIFO
+// can hold, and only ask to be interrupted for more room when there is more to queue.
+STATIC void async_queue(busio_i2c_obj_t *self) {
+    i2c_hw_t *hw = i2c_get_hw(self->peripheral);
+    bool blocked = false;
+    while (self->async_out_remaining > 0 || self->async_in_queued < self->async_in_len) {
+        if (i2c_get_write_available(self->peripheral) == 0) {
+            break;
+        }
+        uint32_t cmd;
+        if (self->async_out_remaining > 0) {
+            cmd = *self->async_out++;
+            self->async_out_remaining--;
+            if (self->async_out_remaining == 0 && self->async_in_len == 0) {
+                cmd |= I2C_IC_DATA_CMD_STOP_BITS;
+            }
+        } else {
+            if (self->async_in_queued - self->async_in_received >= FIFO_DEPTH) {
+                blocked = true;
+                break;
+            }
+            cmd = I2C_IC_DATA_CMD_CMD_BITS;
+            if (self->async_in_queued == 0 && self->async_restart) {
+                cmd |= I2C_IC_DATA_CMD_RESTART_BITS;
+            }
+            self->async_in_queued++;
+            if (self->async_in_queued == self->async_in_len) {
+                cmd |= I2C_IC_DATA_CMD_STOP_BITS;
+            }
+        }
+        hw->data_cmd = cmd;
+    }
+    bool more = self->async_out_remaining > 0 || self->async_in_queued < self->async_in_len;
+    if (more && !blocked) {
+        hw->intr_mask |= I2C_IC_INTR_MASK_M_TX_EMPTY_BITS;
+    } else {
+        hw->intr_mask &= ~I2C_IC_INTR_MASK_M_TX_EMPTY_BITS;
+    }
+}
+
+STATIC void async_interrupt(size_t index) {
+    busio_i2c_obj_t *self = async_i2c[index];
+    i2c_hw_t *hw = i2c_get_hw(i2c[index]);
+    if (self == NULL) {
+        hw->intr_mask = 0;
+        return;
+    }
+    uint32_t status = hw->intr_stat;
+    if (status & I2C_IC_INTR_STAT_R_TX_ABRT_BITS) {
+        (void)hw->clr_tx_abrt;
+        // Report any abort as the blocking transfers do.
+        self->async_result = MP_ENODEV;
+        // Queue nothing more. The controller sends a stop.
+        self->async_out_remaining = 0;
+        self->async_in_len = self->async_in_queued;
+    }
+    while (i2c_get_read_available(self->peripheral) > 0 && self->async_in_received < self->async_in_len) {
+        self->async_in[self->async_in_received++] = (uint8_t)hw->data_cmd;
+    }
+    async_queue(self);
+    if (status & I2C_IC_INTR_STAT_R_STOP_DET_BITS) {
+        (void)hw->clr_stop_det;
+        async_stop(index);
+        self->async_pending = false;
+    }
+}
+
+STATIC void i2c0_interrupt(void) {
+    async_interrupt(0);
+}
+
+STATIC void i2c1_interrupt(void) {
+    async_interrupt(1);
+}
+
+// Wait for any asynchronous transfer to finish, leaving its result to be collected.
+STATIC void async_wait(busio_i2c_obj_t *self) {
+    while (self->async_pending) {
+        RUN_BACKGROUND_TASKS;
+        if (time_us_64() - self->async_start_us > BUS_TIMEOUT_US) {
+            // Give up on the transfer. The abort ends it with a stop.
+            common_hal_mcu_disable_interrupts();
+            if (self->async_pending) {
+                async_stop(i2c_hw_index(self->peripheral));
+                i2c_get_hw(self->peripheral)->enable |= I2C_IC_ENABLE_ABORT_BITS;
+                self->async_result = MP_ETIMEDOUT;
+                self->async_pending = false;
+            }
+            common_hal_mcu_enable_interrupts();
+        }
+    }
+}
+
 STATIC uint8_t _common_hal_busio_i2c_write(busio_i2c_obj_t *self, uint16_t addr,
     const uint8_t *data, size_t len, bool transmit_stop_bit) {
+    async_wait(self);
     if (len == 0) {
         // The RP2040 I2C peripheral will not perform 0 byte writes.
         // So use bitbangio.I2C to do the write.
@@ -211,6 +329,7 @@ uint8_t common_hal_busio_i2c_write(busio_i2c_obj_t *self, uint16_t addr,
 
 uint8_t common_hal_busio_i2c_read(busio_i2c_obj_t *self, uint16_t addr,
     uint8_t *data, size_t len) {
+    async_wait(self);
     size_t result = i2c_read_timeout_us(self->peripheral, addr, data, len, false, BUS_TIMEOUT_US);
     if (result == len) {
         return 0;
@@ -235,6 +354,56 @@ uint8_t common_hal_busio_i2c_write_read(busio_i2c_obj_t *self, uint16_t addr,
     return common_hal_busio_i2c_read(self, addr, in_data, in_len);
 }
 
+void common_hal_busio_i2c_write_read_async(busio_i2c_obj_t *self, uint16_t addr,
+    const uint8_t *out_data, size_t out_len, uint8_t *in_data, size_t in_len) {
+    async_wait(self);
+    if (out_len == 0 && in_len == 0) {
+        // Only the bitbanged write can do this, and it's short.
+        self->async_result = _common_hal_busio_i2c_write(self, addr, NULL, 0, true);
+        return;
+    }
+
+    size_t index = i2c_hw_index(self->peripheral);
+    i2c_hw_t *hw = i2c_get_hw(self->peripheral);
+    hw->enable = 0;
+    hw->tar = addr;
+    hw->enable = 1;
+    (void)hw->clr_intr;
+    // Refill the TX FIFO when half empty, and take each byte as it comes.
+    hw->tx_tl = FIFO_DEPTH / 2;
+    hw->rx_tl = 0;
+
+    self->async_out = out_data;
+    self->async_out_remaining = out_len;
+    self->async_in = in_data;
+    self->async_in_len = in_len;
+    self->async_in_queued = 0;
+    self->async_in_received = 0;
+    self->async_restart = out_len > 0;
+    self->async_result = 0;
+    self->async_start_us = time_us_64();
+    self->async_pending = true;
+
+    common_hal_mcu_disable_interrupts();
+    async_i2c[index] = self;
+    irq_set_exclusive_handler(I2C0_IRQ + index, index == 0 ? i2c0_interrupt : i2c1_interrupt);
+    hw->intr_mask = I2C_IC_INTR_MASK_M_TX_ABRT_BITS | I2C_IC_INTR_MASK_M_STOP_DET_BITS | I2C_IC_INTR_MASK_M_RX_FULL_BITS;
+    async_queue(self);
+    irq_set_enabled(I2C0_IRQ + index, true);
+    common_hal_mcu_enable_interrupts();
+}
+
+bool common_hal_busio_i2c_get_pending(busio_i2c_obj_t *self) {
+    return self->async_pending;
+}
+
+uint8_t common_hal_busio_i2c_wait(busio_i2c_obj_t *self) {
+    async_wait(self);
+    uint8_t result = self->async_result;
+    self->async_result = 0;
+    return result;
+}
+
 void common_hal_busio_i2c_never_reset(busio_i2c_obj_t *self) {
     never_reset_i2c[i2c_hw_index(self->peripheral)] = true;
 
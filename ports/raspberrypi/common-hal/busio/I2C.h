@@ -42,6 +42,18 @@ typedef struct {
     uint baudrate;
     uint8_t scl_pin;
     uint8_t sda_pin;
+
+    // Asynchronous transfer, driven by the I2C interrupt.
+    const uint8_t *async_out;
+    size_t async_out_remaining;
+    uint8_t *async_in;
+    size_t async_in_len;
+    size_t async_in_queued;
+    size_t async_in_received;
+    uint64_t async_start_us;
+    bool async_restart;
+    volatile bool async_pending;
+    volatile uint8_t async_result;
 } busio_i2c_obj_t;
 
 void reset_i2c(void);
@@ -31,15 +31,91 @@
 #include "py/mperrno.h"
 #include "py/mphal.h"
 #include "shared-bindings/busio/I2C.h"
+#include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "py/runtime.h"
 
 #include "src/rp2_common/hardware_gpio/include/hardware/gpio.h"
+#include "src/rp2_common/hardware_irq/include/hardware/irq.h"
 
 STATIC i2c_inst_t *i2c[2] = {i2c0, i2c1};
+// The target serving a register map on each peripheral.
+STATIC i2ctarget_i2c_target_obj_t *register_map_target[2];
 
 #define NO_PIN 0xff
 
+STATIC void register_map_interrupt(size_t index) {
+    i2ctarget_i2c_target_obj_t *self = register_map_target[index];
+    if (self == NULL) {
+        return;
+    }
+    i2c_hw_t *hw = i2c_get_hw(self->peripheral);
+    uint32_t status = hw->intr_stat;
+
+    if (status & I2C_IC_INTR_STAT_R_TX_ABRT_BITS) {
+        (void)hw->clr_tx_abrt;
+    }
+    // Take writes before answering a read so that a pointer write followed by
+    // a restart reads from the new place.
+    while (hw->status & I2C_IC_STATUS_RFNE_BITS) {
+        uint32_t data = hw->data_cmd;
+        uint8_t value = data & I2C_IC_DATA_CMD_DAT_BITS;
+        if (data & I2C_IC_DATA_CMD_FIRST_DATA_BYTE_BITS) {
+            self->register_pointer = value < self->register_map_len ? value : 0;
+            continue;
+        }
+        uint16_t pointer = self->register_pointer;
+        if (self->register_map_writable) {
+            self->register_map[pointer] = value;
+            if (self->changed_end == 0) {
+                self->changed_start = pointer;
+                self->changed_end = pointer + 1;
+            } else if (pointer < self->changed_start) {
+                self->changed_start = pointer;
+            } else if (pointer >= self->changed_end) {
+                self->changed_end = pointer + 1;
+            }
+        }
+        self->register_pointer = pointer + 1 < self->register_map_len ? pointer + 1 : 0;
+    }
+    if (status & I2C_IC_INTR_STAT_R_RD_REQ_BITS) {
+        uint16_t pointer = self->register_pointer;
+        hw->data_cmd = self->register_map[pointer];
+        self->register_pointer = pointer + 1 < self->register_map_len ? pointer + 1 : 0;
+        (void)hw->clr_rd_req;
+    }
+    if (status & I2C_IC_INTR_STAT_R_STOP_DET_BITS) {
+        (void)hw->clr_stop_det;
+    }
+}
+
+STATIC void i2c0_target_interrupt(void) {
+    register_map_interrupt(0);
+}
+
+STATIC void i2c1_target_interrupt(void) {
+    register_map_interrupt(1);
+}
+
+STATIC void register_map_stop(i2ctarget_i2c_target_obj_t *self) {
+    size_t index = i2c_hw_index(self->peripheral);
+    irq_set_enabled(I2C0_IRQ + index, false);
+    irq_remove_handler(I2C0_IRQ + index, index == 0 ? i2c0_target_interrupt : i2c1_target_interrupt);
+    register_map_target[index] = NULL;
+    self->peripheral->hw->intr_mask = I2C_IC_INTR_MASK_M_RESTART_DET_BITS;
+    self->register_map_obj = MP_OBJ_NULL;
+    self->register_map = NULL;
+    self->register_map_len = 0;
+}
+
+void i2ctarget_reset(void) {
+    for (size_t i = 0; i < 2; i++) {
+        if (register_map_target[i] != NULL) {
+            register_map_stop(register_map_target[i]);
+        }
+    }
+}
+
 void common_hal_i2ctarget_i2c_target_construct(i2ctarget_i2c_target_obj_t *self, const mcu_pin_obj_t *scl, const mcu_pin_obj_t *sda,
     uint8_t *addresses, unsigned int num_addresses, bool smbus) {
     self->peripheral = NULL;
@@ -79,6 +155,10 @@ void common_hal_i2ctarget_i2c_target_construct(i2ctarget_i2c_target_obj_t *self,
     gpio_set_pulls(sda->number, true, false);
     gpio_set_pulls(scl->number, true, false);
 
+    self->register_map_obj = MP_OBJ_NULL;
+    self->register_map = NULL;
+    self->register_map_len = 0;
+
     self->peripheral->hw->intr_mask |= I2C_IC_INTR_MASK_M_RESTART_DET_BITS;
     i2c_set_slave_mode(self->peripheral, true, self->addresses[0]);
 
@@ -94,6 +174,9 @@ void common_hal_i2ctarget_i2c_target_deinit(i2ctarget_i2c_target_obj_t *self) {
         return;
     }
 
+    if (self->register_map != NULL) {
+        register_map_stop(self);
+    }
     i2c_deinit(self->peripheral);
 
     reset_pin_number(self->sda_pin);
@@ -150,3 +233,53 @@ void common_hal_i2ctarget_i2c_target_ack(i2ctarget_i2c_target_obj_t *self, bool
 void common_hal_i2ctarget_i2c_target_close(i2ctarget_i2c_target_obj_t *self) {
     return;
 }
+
+void common_hal_i2ctarget_i2c_target_serve_registers(i2ctarget_i2c_target_obj_t *self, mp_obj_t registers) {
+    if (self->register_map != NULL) {
+        register_map_stop(self);
+    }
+    if (registers == mp_const_none) {
+        return;
+    }
+
+    mp_buffer_info_t bufinfo;
+    bool writable = mp_get_buffer(registers, &bufinfo, MP_BUFFER_WRITE);
+    if (!writable) {
+        mp_get_buffer_raise(registers, &bufinfo, MP_BUFFER_READ);
+    }
+    mp_arg_validate_length_range(bufinfo.len, 1, 256, MP_QSTR_registers);
+
+    size_t index = i2c_hw_index(self->peripheral);
+    i2c_hw_t *hw = i2c_get_hw(self->peripheral);
+
+    common_hal_mcu_disable_interrupts();
+    self->register_map_obj = registers;
+    self->register_map = bufinfo.buf;
+    self->register_map_len = bufinfo.len;
+    self->register_map_writable = writable;
+    self->register_pointer = 0;
+    self->changed_end = 0;
+    register_map_target[index] = self;
+
+    // Something else, such as busio.I2C, may have left its handler behind.
+    irq_handler_t handler = irq_get_exclusive_handler(I2C0_IRQ + index);
+    if (handler != NULL) {
+        irq_remove_handler(I2C0_IRQ + index, handler);
+    }
+    irq_set_exclusive_handler(I2C0_IRQ + index, index == 0 ? i2c0_target_interrupt : i2c1_target_interrupt);
+    hw->rx_tl = 0;
+    (void)hw->clr_intr;
+    hw->intr_mask = I2C_IC_INTR_MASK_M_RX_FULL_BITS | I2C_IC_INTR_MASK_M_RD_REQ_BITS |
+        I2C_IC_INTR_MASK_M_TX_ABRT_BITS | I2C_IC_INTR_MASK_M_STOP_DET_BITS;
+    irq_set_enabled(I2C0_IRQ + index, true);
+    common_hal_mcu_enable_interrupts();
+}
+
+bool common_hal_i2ctarget_i2c_target_take_changed_registers(i2ctarget_i2c_target_obj_t *self, size_t *start, size_t *end) {
+    common_hal_mcu_disable_interrupts();
+    *start = self->changed_start;
+    *end = self->changed_end;
+    self->changed_end = 0;
+    common_hal_mcu_enable_interrupts();
+    return *end != 0;
+}
@@ -39,8 +39,23 @@ typedef struct {
 
     i2c_inst_t *peripheral;
 
+    // Served from the interrupt handler when set. The first byte written
+    // after the address sets register_pointer. Later ones are stored at it,
+    // and reads come from it, moving it on by one each time.
+    mp_obj_t register_map_obj;
+    uint8_t *register_map;
+    volatile uint16_t register_pointer;
+    // The registers written by the controller since last taken, changed_end
+    // is 0 when there are none.
+    volatile uint16_t changed_start;
+    volatile uint16_t changed_end;
+    uint16_t register_map_len;
+    bool register_map_writable;
+
     uint8_t scl_pin;
     uint8_t sda_pin;
 } i2ctarget_i2c_target_obj_t;
 
+void i2ctarget_reset(void);
+
 #endif MICROPY_INCLUDED_RPI_COMMON_HAL_BUSIO_I2C_TARGET_H
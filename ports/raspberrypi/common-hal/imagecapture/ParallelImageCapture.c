@@ -24,6 +24,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "py/obj.h"
 #include "py/runtime.h"
 
@@ -55,16 +57,24 @@
 #define _3 SIDE(0b10100)
 #define _4 SIDE(0b11000)
 #define _5 SIDE(0b10100)
+#define _6 SIDE(0b01000)
 
+// The number of samples in a frame, less one, is pulled into Y when the state machine
+// starts. Each frame then begins at the end of the VSYNC pulse, and the state machine goes
+// back to waiting for VSYNC after the last sample so that every frame starts in sync.
 #define IMAGECAPTURE_CODE(width, pclk, vsync, href) \
     { \
-/* 0 */ pio_encode_wait_gpio(0, vsync) | _0, \
-/* 1 */ pio_encode_wait_gpio(1, vsync) | _1, \
+/* 0 */ pio_encode_pull(false, true) | _0, \
+/* 1 */ pio_encode_mov(pio_y, pio_osr) | _0, \
         /* .wrap_target */  \
-/* 2 */ pio_encode_wait_gpio(1, href) | _2, \
-/* 3 */ pio_encode_wait_gpio(1, pclk) | _3, \
-/* 4 */ pio_encode_in(pio_pins, width) | _4, \
-/* 5 */ pio_encode_wait_gpio(0, pclk) | _5, \
+/* 2 */ pio_encode_mov(pio_x, pio_y) | _0, \
+/* 3 */ pio_encode_wait_gpio(0, vsync) | _0, \
+/* 4 */ pio_encode_wait_gpio(1, vsync) | _1, \
+/* 5 */ pio_encode_wait_gpio(1, href) | _2, \
+/* 6 */ pio_encode_wait_gpio(1, pclk) | _3, \
+/* 7 */ pio_encode_in(pio_pins, width) | _4, \
+/* 8 */ pio_encode_wait_gpio(0, pclk) | _5, \
+/* 9 */ pio_encode_jmp_x_dec(5) | _6, \
         /* .wrap */ \
     }
 
@@ -96,11 +106,14 @@ void common_hal_imagecapture_parallelimagecapture_construct(imagecapture_paralle
         }
     }
 
+    self->data_count = data_count;
+    self->buffer1 = self->buffer2 = NULL;
+
     uint16_t imagecapture_code[] = IMAGECAPTURE_CODE(data_count, data_clock->number, vertical_sync->number, horizontal_reference->number);
 
     common_hal_rp2pio_statemachine_construct(&self->state_machine,
         imagecapture_code, MP_ARRAY_SIZE(imagecapture_code),
-        common_hal_mcu_processor_get_frequency(), // full speed (4 instructions per loop -> max pclk 30MHz @ 120MHz)
+        common_hal_mcu_processor_get_frequency(), // full speed (5 instructions per loop -> max pclk 24MHz @ 120MHz)
         0, 0, // init
         NULL, 0, // may_exec
         NULL, 0, 0, 0, // out pins
@@ -120,7 +133,7 @@ void common_hal_imagecapture_parallelimagecapture_construct(imagecapture_paralle
         false, // wait for txstall
         true, 32, true,  // in settings
         false, // Not user-interruptible.
-        2, 5, // wrap settings
+        2, 9, // wrap settings
         PIO_ANY_OFFSET);
 }
 
@@ -128,6 +141,7 @@ void common_hal_imagecapture_parallelimagecapture_deinit(imagecapture_parallelim
     if (common_hal_imagecapture_parallelimagecapture_deinited(self)) {
         return;
     }
+    self->buffer1 = self->buffer2 = NULL;
     return common_hal_rp2pio_statemachine_deinit(&self->state_machine);
 }
 
@@ -135,10 +149,9 @@ bool common_hal_imagecapture_parallelimagecapture_deinited(imagecapture_parallel
     return common_hal_rp2pio_statemachine_deinited(&self->state_machine);
 }
 
-void common_hal_imagecapture_parallelimagecapture_singleshot_capture(imagecapture_parallelimagecapture_obj_t *self, mp_obj_t buffer) {
-    mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_RW);
-
+// Restart the state machine at the start of its program, waiting for the next frame of
+// frame_length bytes.
+STATIC void imagecapture_parallelimagecapture_restart(imagecapture_parallelimagecapture_obj_t *self, size_t frame_length) {
     PIO pio = self->state_machine.pio;
     uint sm = self->state_machine.state_machine;
     uint8_t offset = rp2pio_statemachine_program_offset(&self->state_machine);
@@ -148,9 +161,76 @@ void common_hal_imagecapture_parallelimagecapture_singleshot_capture(imagecaptur
 
     pio_sm_restart(pio, sm);
     pio_sm_exec(pio, sm, pio_encode_jmp(offset));
+    pio_sm_put(pio, sm, frame_length * 8 / self->data_count - 1);
     pio_sm_set_enabled(pio, sm, true);
+}
+
+void common_hal_imagecapture_parallelimagecapture_singleshot_capture(imagecapture_parallelimagecapture_obj_t *self, mp_obj_t buffer) {
+    common_hal_imagecapture_parallelimagecapture_continuous_capture_stop(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_RW);
+
+    imagecapture_parallelimagecapture_restart(self, bufinfo.len);
 
     common_hal_rp2pio_statemachine_readinto(&self->state_machine, bufinfo.buf, bufinfo.len, 4, false);
 
-    pio_sm_set_enabled(pio, sm, false);
+    pio_sm_set_enabled(self->state_machine.pio, self->state_machine.state_machine, false);
+}
+
+// Frames are captured alternately into the two buffers by a background read. After each
+// frame is complete it becomes the state machine's last read, and the DMA moves on to the
+// other buffer at the next VSYNC.
+void common_hal_imagecapture_parallelimagecapture_continuous_capture_start(imagecapture_parallelimagecapture_obj_t *self, mp_obj_t buffer1, mp_obj_t buffer2) {
+    common_hal_imagecapture_parallelimagecapture_continuous_capture_stop(self);
+
+    sm_buf_info once, loop, loop2;
+    memset(&once, 0, sizeof(once));
+    loop.obj = buffer1;
+    mp_get_buffer_raise(buffer1, &loop.info, MP_BUFFER_RW);
+    loop2.obj = buffer2;
+    mp_get_buffer_raise(buffer2, &loop2.info, MP_BUFFER_RW);
+    if (loop.info.len != loop2.info.len) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Buffers must be same size"));
+    }
+
+    imagecapture_parallelimagecapture_restart(self, loop.info.len);
+
+    if (!common_hal_rp2pio_statemachine_background_read(&self->state_machine, &once, &loop, &loop2, 4, false)) {
+        pio_sm_set_enabled(self->state_machine.pio, self->state_machine.state_machine, false);
+        mp_raise_RuntimeError(MP_ERROR_TEXT("No DMA channel found"));
+    }
+    self->buffer1 = buffer1;
+    self->buffer2 = buffer2;
+}
+
+void common_hal_imagecapture_parallelimagecapture_continuous_capture_stop(imagecapture_parallelimagecapture_obj_t *self) {
+    if (self->buffer1 == NULL) {
+        return;
+    }
+    common_hal_rp2pio_statemachine_stop_background_read(&self->state_machine);
+    pio_sm_set_enabled(self->state_machine.pio, self->state_machine.state_machine, false);
+    self->buffer1 = self->buffer2 = NULL;
+}
+
+mp_obj_t common_hal_imagecapture_parallelimagecapture_continuous_capture_get_frame(imagecapture_parallelimagecapture_obj_t *self) {
+    if (self->buffer1 == NULL) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("No capture in progress"));
+    }
+    mp_obj_t frame;
+    while ((frame = common_hal_rp2pio_statemachine_get_last_read(&self->state_machine)) == mp_const_empty_bytes) {
+        RUN_BACKGROUND_TASKS;
+        if (mp_hal_is_interrupted()) {
+            return mp_const_none;
+        }
+    }
+    return frame;
+}
+
+mp_obj_t common_hal_imagecapture_parallelimagecapture_continuous_capture_latest_frame(imagecapture_parallelimagecapture_obj_t *self) {
+    if (self->buffer1 == NULL) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("No capture in progress"));
+    }
+    mp_obj_t frame = common_hal_rp2pio_statemachine_get_last_read(&self->state_machine);
+    return frame == mp_const_empty_bytes ? mp_const_none : frame;
 }
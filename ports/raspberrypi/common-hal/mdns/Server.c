@@ -93,6 +93,7 @@ void common_hal_mdns_server_deinit(mdns_server_obj_t *self) {
     }
     self->inited = false;
     object_inited = false;
+    stop_refresh(true);
     mdns_resp_remove_netif(NETIF_STA);
 }
 
@@ -122,12 +123,90 @@ void common_hal_mdns_server_set_instance_name(mdns_server_obj_t *self, const cha
     self->instance_name = instance_name;
 }
 
+// Services seen in search results, kept until their TTL runs out so that find()
+// can answer straight away. The TTL is capped so that changes still show up
+// reasonably soon, and a cache hit starts a query in the background to refresh
+// the entries.
+#define MDNS_CACHE_LEN (16)
+#define MDNS_CACHE_MAX_TTL_MS (120 * 1000)
+
 typedef struct {
-    uint8_t request_id;
-    size_t i;
-    mdns_remoteservice_obj_t *out;
-    size_t out_len;
-} nonalloc_search_state_t;
+    mdns_remoteservice_obj_t service;
+    uint64_t expires_ms; // 0 when the entry is free
+} mdns_cache_entry_t;
+
+STATIC mdns_cache_entry_t cache[MDNS_CACHE_LEN];
+
+// Background refresh started by a cache hit. Its results only go into the cache,
+// and it stops once it has seen as many services as were cached.
+STATIC uint8_t refresh_request_id = MDNS_MAX_REQUESTS;
+STATIC uint64_t refresh_end_ms;
+STATIC size_t refresh_remaining;
+STATIC mdns_remoteservice_obj_t refresh_service;
+STATIC uint32_t refresh_ttl;
+
+STATIC void cache_store(const mdns_remoteservice_obj_t *service, uint32_t ttl) {
+    uint64_t now = supervisor_ticks_ms64();
+    mdns_cache_entry_t *slot = NULL;
+    bool found = false;
+    for (size_t i = 0; i < MDNS_CACHE_LEN; i++) {
+        mdns_cache_entry_t *entry = &cache[i];
+        if (entry->expires_ms != 0 &&
+            strcmp(entry->service.instance_name, service->instance_name) == 0 &&
+            strcmp(entry->service.service_name, service->service_name) == 0 &&
+            strcmp(entry->service.protocol, service->protocol) == 0) {
+            slot = entry;
+            found = true;
+            break;
+        }
+        // Otherwise replace a free entry or the one that expires first.
+        if (slot == NULL || (slot->expires_ms != 0 && entry->expires_ms < slot->expires_ms)) {
+            slot = entry;
+        }
+    }
+    if (ttl == 0) {
+        // A goodbye packet, so forget the service if we have it.
+        if (found) {
+            slot->expires_ms = 0;
+        }
+        return;
+    }
+    slot->service = *service;
+    slot->service.next = NULL;
+    slot->expires_ms = now + MIN((uint64_t)ttl * 1000, MDNS_CACHE_MAX_TTL_MS);
+}
+
+// Copies up to out_len live entries for the service into out and returns how
+// many there are. out may be NULL to only count them.
+STATIC size_t cache_find(const char *service_type, const char *protocol, mdns_remoteservice_obj_t *out, size_t out_len) {
+    uint64_t now = supervisor_ticks_ms64();
+    size_t count = 0;
+    for (size_t i = 0; i < MDNS_CACHE_LEN; i++) {
+        mdns_cache_entry_t *entry = &cache[i];
+        if (entry->expires_ms != 0 && entry->expires_ms <= now) {
+            entry->expires_ms = 0;
+        }
+        if (entry->expires_ms == 0 ||
+            strcmp(entry->service.service_name, service_type) != 0 ||
+            strcmp(entry->service.protocol, protocol) != 0) {
+            continue;
+        }
+        if (out != NULL && count < out_len) {
+            out[count] = entry->service;
+            out[count].base.type = &mdns_remoteservice_type;
+        }
+        count++;
+    }
+    return count;
+}
+
+STATIC void stop_refresh(bool force) {
+    if (refresh_request_id < MDNS_MAX_REQUESTS &&
+        (force || supervisor_ticks_ms64() >= refresh_end_ms)) {
+        mdns_search_stop(refresh_request_id);
+        refresh_request_id = MDNS_MAX_REQUESTS;
+    }
+}
 
 STATIC void copy_data_into_remote_service(struct mdns_answer *answer, const char *varpart, int varlen, mdns_remoteservice_obj_t *out) {
     if (varlen > 0) {
@@ -168,13 +247,71 @@ STATIC void copy_data_into_remote_service(struct mdns_answer *answer, const char
     }
 }
 
+// A result is made of several answers. It is cached for the shortest of their TTLs.
+STATIC void track_ttl(struct mdns_answer *answer, int flags, uint32_t *ttl) {
+    if ((flags & MDNS_SEARCH_RESULT_FIRST) != 0 || answer->ttl < *ttl) {
+        *ttl = answer->ttl;
+    }
+}
+
+STATIC void refresh_result_cb(struct mdns_answer *answer, const char *varpart, int varlen, int flags, void *arg) {
+    if ((flags & MDNS_SEARCH_RESULT_FIRST) != 0) {
+        // Don't let a result without some answers keep those of the last one.
+        memset(&refresh_service, 0, sizeof(refresh_service));
+    }
+    track_ttl(answer, flags, &refresh_ttl);
+    copy_data_into_remote_service(answer, varpart, varlen, &refresh_service);
+    if ((flags & MDNS_SEARCH_RESULT_LAST) != 0) {
+        cache_store(&refresh_service, refresh_ttl);
+        if (refresh_remaining > 0) {
+            refresh_remaining--;
+        }
+        if (refresh_remaining == 0) {
+            stop_refresh(true);
+        }
+    }
+}
+
+// Answers from the cache if it has the service, starting a background query so
+// that later calls see changes. Returns the number of cached services, 0 if a
+// query is needed.
+STATIC size_t find_cached(const char *service_type, enum mdns_sd_proto proto, const char *protocol,
+    mp_float_t timeout, mdns_remoteservice_obj_t *out, size_t out_len) {
+    stop_refresh(false);
+    size_t count = cache_find(service_type, protocol, out, out_len);
+    if (count > 0 && refresh_request_id == MDNS_MAX_REQUESTS) {
+        if (mdns_search_service(NULL, service_type, proto, NETIF_STA, &refresh_result_cb, NULL,
+            &refresh_request_id) == ERR_OK) {
+            refresh_end_ms = supervisor_ticks_ms64() + (uint64_t)(timeout * 1000);
+            refresh_remaining = count;
+        } else {
+            refresh_request_id = MDNS_MAX_REQUESTS;
+        }
+    }
+    if (count == 0) {
+        // A foreground query needs the request slot more.
+        stop_refresh(true);
+    }
+    return count;
+}
+
+typedef struct {
+    uint8_t request_id;
+    size_t i;
+    mdns_remoteservice_obj_t *out;
+    size_t out_len;
+    uint32_t ttl;
+} nonalloc_search_state_t;
+
 STATIC void search_result_cb(struct mdns_answer *answer, const char *varpart, int varlen, int flags, void *arg) {
     nonalloc_search_state_t *state = arg;
     state->out[state->i].base.type = &mdns_remoteservice_type;
 
+    track_ttl(answer, flags, &state->ttl);
     copy_data_into_remote_service(answer, varpart, varlen, &state->out[state->i]);
 
     if ((flags & MDNS_SEARCH_RESULT_LAST) != 0) {
+        cache_store(&state->out[state->i], state->ttl);
         state->i += 1;
     }
 
@@ -192,6 +329,11 @@ size_t mdns_server_find(mdns_server_obj_t *self, const char *service_type, const
         proto = DNSSD_PROTO_TCP;
     }
 
+    size_t cached = find_cached(service_type, proto, protocol, timeout, out, out_len);
+    if (cached > 0) {
+        return MIN(cached, out_len);
+    }
+
     nonalloc_search_state_t state;
     state.i = 0;
     state.out = out;
@@ -224,6 +366,7 @@ typedef struct {
     uint8_t request_id;
     mdns_remoteservice_obj_t *head;
     size_t count;
+    uint32_t ttl;
 } alloc_search_state_t;
 
 STATIC void alloc_search_result_cb(struct mdns_answer *answer, const char *varpart, int varlen, int flags, void *arg) {
@@ -247,7 +390,12 @@ STATIC void alloc_search_result_cb(struct mdns_answer *answer, const char *varpa
         state->head = service;
     }
 
+    track_ttl(answer, flags, &state->ttl);
     copy_data_into_remote_service(answer, varpart, varlen, state->head);
+
+    if ((flags & MDNS_SEARCH_RESULT_LAST) != 0) {
+        cache_store(state->head, state->ttl);
+    }
 }
 
 mp_obj_t common_hal_mdns_server_find(mdns_server_obj_t *self, const char *service_type, const char *protocol, mp_float_t timeout) {
@@ -256,6 +404,20 @@ mp_obj_t common_hal_mdns_server_find(mdns_server_obj_t *self, const char *servic
         proto = DNSSD_PROTO_TCP;
     }
 
+    size_t cached = find_cached(service_type, proto, protocol, timeout, NULL, 0);
+    if (cached > 0) {
+        mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(cached, NULL));
+        mdns_remoteservice_obj_t *services = m_new(mdns_remoteservice_obj_t, cached);
+        cache_find(service_type, protocol, services, cached);
+        for (size_t i = 0; i < cached; i++) {
+            mdns_remoteservice_obj_t *service = m_new_obj(mdns_remoteservice_obj_t);
+            *service = services[i];
+            tuple->items[i] = MP_OBJ_FROM_PTR(service);
+        }
+        m_del(mdns_remoteservice_obj_t, services, cached);
+        return MP_OBJ_FROM_PTR(tuple);
+    }
+
     alloc_search_state_t state;
     state.count = 0;
     state.head = NULL;
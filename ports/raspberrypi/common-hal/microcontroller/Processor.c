@@ -45,6 +45,13 @@
 #include "src/rp2040/hardware_structs/include/hardware/structs/vreg_and_chip_reset.h"
 #include "src/rp2040/hardware_structs/include/hardware/structs/watchdog.h"
 
+#if CIRCUITPY_CPU_GOVERNOR
+#include "supervisor/shared/cpu_governor.h"
+#include "src/rp2040/hardware_structs/include/hardware/structs/pio.h"
+#include "src/rp2040/hardware_structs/include/hardware/structs/pwm.h"
+#include "src/rp2040/hardware_structs/include/hardware/structs/uart.h"
+#endif
+
 float common_hal_mcu_processor_get_temperature(void) {
     adc_init();
     adc_set_temp_sensor_enabled(true);
@@ -85,6 +92,37 @@ void common_hal_mcu_processor_set_frequency(mcu_processor_obj_t *self, uint32_t
     set_sys_clock_khz(freq_khz, false);
 }
 
+#if CIRCUITPY_CPU_GOVERNOR
+// Interrupts are handled slowly at 24 MHz, so only go that low for long waits.
+STATIC const cpu_governor_level_t governor_levels[] = {
+    { .frequency = 24000000, .min_idle_ms = 50 },
+    { .frequency = 48000000, .min_idle_ms = 5 },
+};
+
+const cpu_governor_level_t *port_cpu_governor_levels(size_t *count) {
+    *count = MP_ARRAY_SIZE(governor_levels);
+    return governor_levels;
+}
+
+// PWM and PIO count clk_sys cycles and the UARTs count clk_peri cycles, so
+// slowing the clock would change their output while the VM idles.
+STATIC bool clk_sys_timed_peripheral_active(void) {
+    return pwm_hw->en != 0 ||
+           (pio0_hw->ctrl & PIO_CTRL_SM_ENABLE_BITS) != 0 ||
+           (pio1_hw->ctrl & PIO_CTRL_SM_ENABLE_BITS) != 0 ||
+           (uart0_hw->cr & UART_UARTCR_UARTEN_BITS) != 0 ||
+           (uart1_hw->cr & UART_UARTCR_UARTEN_BITS) != 0;
+}
+
+bool port_cpu_governor_set_frequency(uint32_t frequency) {
+    if (frequency < clock_get_hz(clk_sys) && clk_sys_timed_peripheral_active()) {
+        return false;
+    }
+    // The voltage set for the full frequency is kept, so raising needs no wait.
+    return set_sys_clock_khz(frequency / 1000, false);
+}
+#endif
+
 void common_hal_mcu_processor_get_uid(uint8_t raw_id[]) {
     pico_unique_board_id_t retrieved_id;
     pico_get_unique_board_id(&retrieved_id);
@@ -24,16 +24,21 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "shared-bindings/neopixel_write/__init__.h"
+#include "common-hal/neopixel_write/__init__.h"
 
+#include "py/runtime.h"
 #include "bindings/rp2pio/StateMachine.h"
 #include "common-hal/rp2pio/StateMachine.h"
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/digitalio/DigitalInOut.h"
 
-#include "supervisor/port.h"
+#include "src/rp2_common/hardware_timer/include/hardware/timer.h"
 
-uint64_t next_start_raw_ticks = 0;
+// When the pixels will have latched the last data sent, so the next write can start.
+STATIC uint64_t next_start_us = 0;
 
 // NeoPixels are 800khz bit streams. We are choosing zeros as <312ns hi, 936 lo> and ones
 // and ones as <700 ns hi, 556 ns lo>.
@@ -54,7 +59,40 @@ const uint16_t neopixel_program[] = {
     0xa442
 };
 
+// The parallel program sends the same bit of up to eight strands at once, with the
+// same timing: every pin goes high, the ones sending a zero go low again after
+// 312ns and the rest after 703ns. Each byte holds one bit of each strand, from the
+// first pin in its least significant bit.
+const uint16_t neopixel_parallel_program[] = {
+// bitloop:
+//   out x 8              ; Take the next bits. Pins stay low while waiting for data.
+    0x6028,
+//   mov pins ~null [3]   ; Drive all high.
+    0xa30b,
+//   mov pins x [4]       ; Drive the zeros low.
+    0xa401,
+//   mov pins null [5]    ; Drive all low.
+    0xa503
+};
+
+// The state machine sending in the background, if any. MP_STATE_PORT holds the
+// DigitalInOuts it drives and the copy of the data it is sending.
+STATIC rp2pio_statemachine_obj_t background_state_machine = { .state_machine = NUM_PIO_STATE_MACHINES };
+STATIC size_t background_pin_count;
+STATIC size_t background_buffer_len;
+STATIC bool background_dma;
+
+STATIC void wait_to_start(void) {
+    // Wait to make sure we don't append onto the last transmission. This should only be
+    // a few hundred microseconds.
+    while (time_us_64() < next_start_us) {
+    }
+}
+
 void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout, uint8_t *pixels, uint32_t num_bytes) {
+    // The pin may still be sending in the background.
+    common_hal_neopixel_write_wait();
+
     // Set everything up.
     rp2pio_statemachine_obj_t state_machine;
 
@@ -87,10 +125,7 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout,
         return;
     }
 
-    // Wait to make sure we don't append onto the last transmission. This should only be a tick or
-    // two.
-    while (port_get_raw_ticks(NULL) < next_start_raw_ticks) {
-    }
+    wait_to_start();
 
     common_hal_rp2pio_statemachine_write(&state_machine, pixels, num_bytes, 1 /* stride in bytes */, false);
 
@@ -101,6 +136,168 @@ void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *digitalinout,
     gpio_init(digitalinout->pin->number);
     common_hal_digitalio_digitalinout_switch_to_output((digitalio_digitalinout_obj_t *)digitalinout, false, DRIVE_MODE_PUSH_PULL);
 
-    // Update the next start to +2 ticks. This ensures we give it at least 300us.
-    next_start_raw_ticks = port_get_raw_ticks(NULL) + 2;
+    // Give the pixels 300us to latch before the next write.
+    next_start_us = time_us_64() + 300;
+}
+
+void common_hal_neopixel_write_parallel(digitalio_digitalinout_obj_t *const *digitalinouts, size_t count,
+    const uint8_t *pixels, uint32_t num_bytes, bool background) {
+    common_hal_neopixel_write_wait();
+
+    const mcu_pin_obj_t *first_pin = digitalinouts[0]->pin;
+    uint32_t pins_we_use = 0;
+    for (size_t i = 0; i < count; i++) {
+        // The state machine drives a run of pins, in order.
+        if (digitalinouts[i]->pin->number != first_pin->number + (int)i) {
+            mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_pins);
+        }
+        pins_we_use |= 1 << digitalinouts[i]->pin->number;
+    }
+
+    // Keep our own copy of the data since the caller may change theirs while it is sent.
+    // A single strand is sent as is; several are rearranged so that each byte holds one
+    // bit of every strand.
+    size_t strand_len = num_bytes / count;
+    size_t len = count == 1 ? num_bytes : strand_len * 8;
+    if (len == 0) {
+        return;
+    }
+    uint8_t *buffer = MP_STATE_PORT(neopixel_write_buffer);
+    if (buffer == NULL || background_buffer_len < len) {
+        MP_STATE_PORT(neopixel_write_buffer) = NULL;
+        buffer = m_malloc(len);
+        MP_STATE_PORT(neopixel_write_buffer) = buffer;
+        background_buffer_len = len;
+    }
+    if (count == 1) {
+        memcpy(buffer, pixels, len);
+    } else {
+        uint8_t *out = buffer;
+        for (size_t i = 0; i < strand_len; i++) {
+            memset(out, 0, 8);
+            for (size_t strand = 0; strand < count; strand++) {
+                uint8_t value = pixels[strand];
+                for (size_t bit = 0; bit < 8; bit++) {
+                    out[7 - bit] |= ((value >> bit) & 1) << strand;
+                }
+            }
+            pixels += count;
+            out += 8;
+        }
+    }
+
+    rp2pio_statemachine_obj_t *state_machine = &background_state_machine;
+    bool ok;
+    if (count == 1) {
+        ok = rp2pio_statemachine_construct(state_machine,
+            neopixel_program, MP_ARRAY_SIZE(neopixel_program),
+            12800000, // 12.8MHz, to get appropriate sub-bit times in PIO program.
+            NULL, 0, // init program
+            NULL, 1, // out
+            NULL, 1, // in
+            0, 0, // in pulls
+            NULL, 1, // set
+            first_pin, 1, // sideset
+            0, pins_we_use, // initial pin state
+            NULL, // jump pin
+            pins_we_use, true, false,
+            true, 8, false, // TX, auto pull every 8 bits. shift left to output msb first
+            true, // Wait for txstall.
+            false, 32, true, // RX setting we don't use
+            false, // claim pins
+            false, // Not user-interruptible.
+            false, // No sideset enable
+            0, -1, // wrap
+            PIO_ANY_OFFSET  // offset
+            );
+    } else {
+        ok = rp2pio_statemachine_construct(state_machine,
+            neopixel_parallel_program, MP_ARRAY_SIZE(neopixel_parallel_program),
+            12800000, // 12.8MHz, the same sub-bit times as the single strand program.
+            NULL, 0, // init program
+            first_pin, count, // out
+            NULL, 1, // in
+            0, 0, // in pulls
+            NULL, 1, // set
+            NULL, 1, // sideset
+            0, pins_we_use, // initial pin state
+            NULL, // jump pin
+            pins_we_use, true, false,
+            true, 8, false, // TX, auto pull every 8 bits. shift left to output the bits we take
+            true, // Wait for txstall.
+            false, 32, true, // RX setting we don't use
+            false, // claim pins
+            false, // Not user-interruptible.
+            false, // No sideset enable
+            0, -1, // wrap
+            PIO_ANY_OFFSET  // offset
+            );
+    }
+    if (!ok) {
+        // Do nothing, like a single strand write.
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        MP_STATE_PORT(neopixel_write_digitalinouts)[i] = MP_OBJ_FROM_PTR(digitalinouts[i]);
+    }
+    background_pin_count = count;
+
+    wait_to_start();
+
+    sm_buf_info once = { .obj = MP_OBJ_NULL, .info = { .buf = buffer, .len = len } };
+    sm_buf_info loop = { .obj = MP_OBJ_NULL };
+    common_hal_rp2pio_statemachine_clear_txstall(state_machine);
+    background_dma = common_hal_rp2pio_statemachine_background_write(state_machine, &once, &loop, 1, false);
+    if (!background_dma) {
+        // No DMA channel free, so send it from here.
+        common_hal_rp2pio_statemachine_write(state_machine, buffer, len, 1, false);
+    }
+    // Each byte of a strand takes 10us to send, so the pixels can't latch before then.
+    next_start_us = time_us_64() + strand_len * 10 + 300;
+
+    if (!background) {
+        common_hal_neopixel_write_wait();
+    }
 }
+
+void common_hal_neopixel_write_wait(void) {
+    rp2pio_statemachine_obj_t *state_machine = &background_state_machine;
+    if (common_hal_rp2pio_statemachine_deinited(state_machine)) {
+        return;
+    }
+    bool sending = false;
+    while (background_dma && common_hal_rp2pio_statemachine_get_writing(state_machine)) {
+        sending = true;
+        RUN_BACKGROUND_TASKS;
+    }
+    // Everything is in the FIFO now. Wait for the state machine to send it.
+    common_hal_rp2pio_statemachine_clear_txstall(state_machine);
+    while (!common_hal_rp2pio_statemachine_get_txstall(state_machine)) {
+        sending = true;
+    }
+    if (sending && time_us_64() + 300 > next_start_us) {
+        next_start_us = time_us_64() + 300;
+    }
+
+    // Use a private deinit of the state machine that doesn't reset the pins.
+    rp2pio_statemachine_deinit(state_machine, true);
+    // Reset the pins and release them from the PIO
+    for (size_t i = 0; i < background_pin_count; i++) {
+        digitalio_digitalinout_obj_t *digitalinout = MP_OBJ_TO_PTR(MP_STATE_PORT(neopixel_write_digitalinouts)[i]);
+        gpio_init(digitalinout->pin->number);
+        common_hal_digitalio_digitalinout_switch_to_output(digitalinout, false, DRIVE_MODE_PUSH_PULL);
+        MP_STATE_PORT(neopixel_write_digitalinouts)[i] = MP_OBJ_NULL;
+    }
+    background_pin_count = 0;
+}
+
+void reset_neopixel_write(void) {
+    // Let the last write finish so that a program's final colors are shown.
+    common_hal_neopixel_write_wait();
+    MP_STATE_PORT(neopixel_write_buffer) = NULL;
+    background_buffer_len = 0;
+}
+
+MP_REGISTER_ROOT_POINTER(uint8_t *neopixel_write_buffer);
+// One for each of NEOPIXEL_WRITE_MAX_STRANDS.
+MP_REGISTER_ROOT_POINTER(mp_obj_t neopixel_write_digitalinouts[8]);
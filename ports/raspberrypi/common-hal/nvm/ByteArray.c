@@ -30,6 +30,7 @@
 #include <string.h>
 
 #include "py/runtime.h"
+#include "audiomp3_worker.h"
 #include "src/rp2_common/hardware_flash/include/hardware/flash.h"
 #include "shared-bindings/microcontroller/__init__.h"
 
@@ -47,16 +48,28 @@ static void write_page(uint32_t page_addr, uint32_t offset, uint32_t len, uint8_
     // since we can only write a whole page at a time.
     if (offset == 0 && len == FLASH_PAGE_SIZE) {
         // disable interrupts to prevent core hang on rp2040
+        #if CIRCUITPY_AUDIOMP3_MULTICORE
+        audiomp3_worker_lockout_start();
+        #endif
         common_hal_mcu_disable_interrupts();
         flash_range_program(RMV_OFFSET(page_addr), bytes, FLASH_PAGE_SIZE);
         common_hal_mcu_enable_interrupts();
+        #if CIRCUITPY_AUDIOMP3_MULTICORE
+        audiomp3_worker_lockout_end();
+        #endif
     } else {
         uint8_t buffer[FLASH_PAGE_SIZE];
         memcpy(buffer, (uint8_t *)page_addr, FLASH_PAGE_SIZE);
         memcpy(buffer + offset, bytes, len);
+        #if CIRCUITPY_AUDIOMP3_MULTICORE
+        audiomp3_worker_lockout_start();
+        #endif
         common_hal_mcu_disable_interrupts();
         flash_range_program(RMV_OFFSET(page_addr), buffer, FLASH_PAGE_SIZE);
         common_hal_mcu_enable_interrupts();
+        #if CIRCUITPY_AUDIOMP3_MULTICORE
+        audiomp3_worker_lockout_end();
+        #endif
     }
 
 }
@@ -76,10 +89,16 @@ static void erase_and_write_sector(uint32_t address, uint32_t len, uint8_t *byte
     #pragma GCC diagnostic pop
     memcpy(buffer + address, bytes, len);
     // disable interrupts to prevent core hang on rp2040
+    #if CIRCUITPY_AUDIOMP3_MULTICORE
+    audiomp3_worker_lockout_start();
+    #endif
     common_hal_mcu_disable_interrupts();
     flash_range_erase(RMV_OFFSET(CIRCUITPY_INTERNAL_NVM_START_ADDR), FLASH_SECTOR_SIZE);
     flash_range_program(RMV_OFFSET(CIRCUITPY_INTERNAL_NVM_START_ADDR), buffer, FLASH_SECTOR_SIZE);
     common_hal_mcu_enable_interrupts();
+    #if CIRCUITPY_AUDIOMP3_MULTICORE
+    audiomp3_worker_lockout_end();
+    #endif
 }
 
 void common_hal_nvm_bytearray_get_bytes(const nvm_bytearray_obj_t *self,
@@ -28,10 +28,12 @@
 
 #include <stdint.h>
 
+#include "common-hal/microcontroller/__init__.h"
 #include "common-hal/microcontroller/Pin.h"
 #include "py/runtime.h"
 #include "shared-bindings/digitalio/DigitalInOut.h"
 #include "shared-bindings/microcontroller/__init__.h"
+#include "shared-bindings/microcontroller/Pin.h"
 #include "bindings/rp2pio/StateMachine.h"
 #include "common-hal/rp2pio/StateMachine.h"
 
@@ -43,12 +45,43 @@ static const uint16_t parallel_program[] = {
 // .wrap
 };
 
+static const uint16_t parallel16_program[] = {
+// .side_set 1
+// .wrap_target
+    0x6010, // out pins, 16 side 0
+    0xB042  // nop          side 1
+// .wrap
+};
+
 void common_hal_paralleldisplaybus_parallelbus_construct(paralleldisplaybus_parallelbus_obj_t *self,
     const mcu_pin_obj_t *data0, const mcu_pin_obj_t *command, const mcu_pin_obj_t *chip_select,
     const mcu_pin_obj_t *write, const mcu_pin_obj_t *read, const mcu_pin_obj_t *reset, uint32_t frequency) {
-
-    uint8_t data_pin = data0->number;
+    const mcu_pin_obj_t *data_pins[8];
     for (uint8_t i = 0; i < 8; i++) {
+        data_pins[i] = mcu_get_pin_by_number(data0->number + i);
+        if (data_pins[i] == NULL) {
+            raise_ValueError_invalid_pin_name(MP_QSTR_data0);
+        }
+    }
+    common_hal_paralleldisplaybus_parallelbus_construct_nonsequential(self, 8, data_pins, command, chip_select, write, read, reset, frequency);
+}
+
+void common_hal_paralleldisplaybus_parallelbus_construct_nonsequential(paralleldisplaybus_parallelbus_obj_t *self,
+    uint8_t n_pins, const mcu_pin_obj_t **data_pins, const mcu_pin_obj_t *command, const mcu_pin_obj_t *chip_select,
+    const mcu_pin_obj_t *write, const mcu_pin_obj_t *read, const mcu_pin_obj_t *reset, uint32_t frequency) {
+
+    if (n_pins != 8 && n_pins != 16) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Number of data_pins must be 8 or 16, not %d"), n_pins);
+    }
+
+    // The state machine shifts out all of the data pins at once so they must be consecutive.
+    uint8_t data_pin = data_pins[0]->number;
+    for (uint8_t i = 1; i < n_pins; i++) {
+        if (data_pins[i]->number != data_pin + i) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Pins must be sequential GPIO pins"));
+        }
+    }
+    for (uint8_t i = 0; i < n_pins; i++) {
         if (!pin_number_is_free(data_pin + i)) {
             mp_raise_ValueError_varg(MP_ERROR_TEXT("Bus pin %d is already in use"), i);
         }
@@ -76,6 +109,7 @@ void common_hal_paralleldisplaybus_parallelbus_construct(paralleldisplaybus_para
     }
 
     self->data0_pin = data_pin;
+    self->data_pin_count = n_pins;
     self->write = write_pin;
 
     self->reset.base.type = &mp_type_NoneType;
@@ -90,16 +124,17 @@ void common_hal_paralleldisplaybus_parallelbus_construct(paralleldisplaybus_para
     never_reset_pin_number(command->number);
     never_reset_pin_number(chip_select->number);
     never_reset_pin_number(write_pin);
-    for (uint8_t i = 0; i < 8; i++) {
+    for (uint8_t i = 0; i < n_pins; i++) {
         never_reset_pin_number(data_pin + i);
     }
 
+    const uint16_t *program = n_pins == 16 ? parallel16_program : parallel_program;
     common_hal_rp2pio_statemachine_construct(&self->state_machine,
-        parallel_program, MP_ARRAY_SIZE(parallel_program),
+        program, MP_ARRAY_SIZE(parallel_program),
         frequency * 2, // frequency multiplied by 2 as 2 PIO instructions
         NULL, 0, // init
         NULL, 0, // may_exec
-        data0, 8, 0, 255, // first out pin, # out pins
+        data_pins[0], n_pins, 0, n_pins == 16 ? 0xffff : 0xff, // first out pin, # out pins
         NULL, 0, 0, 0, // first in pin, # in pins
         NULL, 0, 0, 0, // first set pin
         write, 1, 0, 1, // first sideset pin
@@ -107,8 +142,8 @@ void common_hal_paralleldisplaybus_parallelbus_construct(paralleldisplaybus_para
         NULL, PULL_NONE, // jump pin
         0, // wait gpio pins
         true, // exclusive pin usage
-        true, 8, true, // TX, auto pull every 8 bits. shift left to output msb first
-        false, // wait for TX stall
+        true, n_pins, true, // TX, auto pull every 8 or 16 bits. shift right to output the low bits first
+        true, // wait for TX stall so the command pin only changes after the last write strobe
         false, 32, true, // RX setting we don't use
         false, // Not user-interruptible.
         0, -1, // wrap settings
@@ -120,7 +155,7 @@ void common_hal_paralleldisplaybus_parallelbus_construct(paralleldisplaybus_para
 void common_hal_paralleldisplaybus_parallelbus_deinit(paralleldisplaybus_parallelbus_obj_t *self) {
     common_hal_rp2pio_statemachine_deinit(&self->state_machine);
 
-    for (uint8_t i = 0; i < 8; i++) {
+    for (uint8_t i = 0; i < self->data_pin_count; i++) {
         reset_pin_number(self->data0_pin + i);
     }
 
@@ -163,7 +198,32 @@ void common_hal_paralleldisplaybus_parallelbus_send(mp_obj_t obj, display_byte_t
     paralleldisplaybus_parallelbus_obj_t *self = MP_OBJ_TO_PTR(obj);
 
     common_hal_digitalio_digitalinout_set_value(&self->command, byte_type == DISPLAY_DATA);
-    common_hal_rp2pio_statemachine_write(&self->state_machine, data, data_length, 1, false);
+    if (self->data_pin_count == 8) {
+        common_hal_rp2pio_statemachine_write(&self->state_machine, data, data_length, 1, false);
+        return;
+    }
+
+    // A 16-bit bus sends data two bytes per write with the first byte on the upper pins. The
+    // byte swap is done by the DMA. Commands, and an odd final data byte, are sent one byte
+    // per write on the lower pins.
+    if (byte_type == DISPLAY_DATA && ((uintptr_t)data & 1) == 0) {
+        uint32_t paired_length = data_length & ~1;
+        if (paired_length > 0) {
+            common_hal_rp2pio_statemachine_write(&self->state_machine, data, paired_length, 2, true);
+        }
+        data += paired_length;
+        data_length -= paired_length;
+    }
+    uint16_t widened[16];
+    while (data_length > 0) {
+        uint32_t count = MIN(data_length, MP_ARRAY_SIZE(widened));
+        for (uint32_t i = 0; i < count; i++) {
+            widened[i] = data[i];
+        }
+        common_hal_rp2pio_statemachine_write(&self->state_machine, (const uint8_t *)widened, count * 2, 2, false);
+        data += count;
+        data_length -= count;
+    }
 }
 
 void common_hal_paralleldisplaybus_parallelbus_end_transaction(mp_obj_t obj) {
@@ -38,5 +38,6 @@ typedef struct {
     digitalio_digitalinout_obj_t read;
     uint8_t write;
     uint8_t data0_pin;
+    uint8_t data_pin_count;
     rp2pio_statemachine_obj_t state_machine;
 } paralleldisplaybus_parallelbus_obj_t;
@@ -24,6 +24,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "bindings/picodvi/Framebuffer.h"
 
 #include "py/gc.h"
@@ -33,6 +35,8 @@
 #include "common-hal/rp2pio/StateMachine.h"
 #include "supervisor/port.h"
 
+#include "audiomp3_worker.h"
+
 #include "src/common/pico_stdlib/include/pico/stdlib.h"
 #include "src/rp2040/hardware_structs/include/hardware/structs/mpu.h"
 #include "src/rp2_common/cmsis/stub/CMSIS/Device/RaspberryPi/RP2040/Include/RP2040.h"
@@ -112,10 +116,65 @@ static void __not_in_flash_func(core1_main)(void) {
     __builtin_unreachable();
 }
 
+// Render row y of the tile map into buf. This runs on core 1, which can't reach
+// flash, so it avoids division (the divider helpers are in flash) and stops the
+// compiler from turning the copy loops into memcpy calls.
+static void __attribute__((optimize("no-tree-loop-distribute-patterns"))) __not_in_flash_func(render_tile_row)(picodvi_framebuffer_obj_t *self, uint32_t *buf, uint y) {
+    uint shift = self->tile_shift;
+    uint mask = self->tile_size - 1;
+    uint width = self->width;
+    y += self->scroll_y;
+    if (y >= self->height) {
+        y -= self->height;
+    }
+    const uint8_t *map_row = self->tile_map + (y >> shift) * self->map_width;
+    uint tile_row = (y & mask) << shift;
+    uint tile_pixels = 1 << (shift * 2);
+    uint x = self->scroll_x;
+
+    for (uint i = 0; i < width;) {
+        uint tile = map_row[x >> shift];
+        if (tile >= self->tile_count) {
+            tile = 0;
+        }
+        uint first = tile * tile_pixels + tile_row + (x & mask);
+        uint n = self->tile_size - (x & mask);
+        if (n > width - i) {
+            n = width - i;
+        }
+        if (self->color_depth == 16) {
+            const uint16_t *src = (const uint16_t *)self->tiles + first;
+            uint16_t *dst = (uint16_t *)buf + i;
+            for (uint j = 0; j < n; j++) {
+                dst[j] = src[j];
+            }
+        } else {
+            const uint8_t *src = self->tiles + first;
+            uint8_t *dst = (uint8_t *)buf + i;
+            for (uint j = 0; j < n; j++) {
+                dst[j] = src[j];
+            }
+        }
+        i += n;
+        x += n;
+        if (x >= width) {
+            x -= width;
+        }
+    }
+}
+
 static void __not_in_flash_func(core1_scanline_callback)(void) {
     picodvi_framebuffer_obj_t *self = active_picodvi;
     uint32_t *next_scanline_buf;
-    next_scanline_buf = self->framebuffer + (self->pitch * self->next_scanline);
+    if (self->tile_size != 0) {
+        next_scanline_buf = self->framebuffer + (self->pitch * self->next_line_buffer);
+        if (++self->next_line_buffer == PICODVI_TILE_LINE_BUFFERS) {
+            self->next_line_buffer = 0;
+        }
+        render_tile_row(self, next_scanline_buf, self->next_scanline);
+    } else {
+        next_scanline_buf = self->framebuffer + (self->pitch * self->next_scanline);
+    }
     queue_add_blocking_u32(&self->dvi.q_colour_valid, &next_scanline_buf);
 
     // Remove any buffers that were sent back to us.
@@ -136,7 +195,7 @@ void common_hal_picodvi_framebuffer_construct(picodvi_framebuffer_obj_t *self,
     const mcu_pin_obj_t *red_dp, const mcu_pin_obj_t *red_dn,
     const mcu_pin_obj_t *green_dp, const mcu_pin_obj_t *green_dn,
     const mcu_pin_obj_t *blue_dp, const mcu_pin_obj_t *blue_dn,
-    mp_uint_t color_depth) {
+    mp_uint_t color_depth, mp_uint_t tile_size, mp_uint_t tile_count) {
     if (active_picodvi != NULL) {
         mp_raise_msg_varg(&mp_type_RuntimeError, MP_ERROR_TEXT("%q in use"), MP_QSTR_picodvi);
     }
@@ -162,6 +221,20 @@ void common_hal_picodvi_framebuffer_construct(picodvi_framebuffer_obj_t *self,
         mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_color_depth);
     }
 
+    // Tiles must be a power of two in size that fits the width and height a
+    // whole number of times, and only color modes have them.
+    uint8_t tile_shift = 0;
+    if (tile_size != 0) {
+        while ((1u << tile_shift) < tile_size) {
+            tile_shift++;
+        }
+        if (!color_framebuffer || (1u << tile_shift) != tile_size ||
+            width % tile_size != 0 || height % tile_size != 0) {
+            mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_tile_size);
+        }
+        mp_arg_validate_int_range(tile_count, 1, 256, MP_QSTR_tile_count);
+    }
+
     bool invert_diffpairs = clk_dn->number < clk_dp->number;
     int8_t other_pins[4];
     int8_t *a;
@@ -239,14 +312,39 @@ void common_hal_picodvi_framebuffer_construct(picodvi_framebuffer_obj_t *self,
         self->pitch += sizeof(uint32_t) - (self->pitch % sizeof(uint32_t));
     }
     self->pitch /= sizeof(uint32_t);
-    size_t framebuffer_size = self->pitch * self->height;
+    size_t framebuffer_size = self->pitch * (tile_size != 0 ? PICODVI_TILE_LINE_BUFFERS : self->height);
     self->tmdsbuf_size = tmds_bufs_per_scanline * scanline_width / DVI_SYMBOLS_PER_WORD + 1;
-    size_t total_allocation_size = sizeof(uint32_t) * (framebuffer_size + DVI_N_TMDS_BUFFERS * self->tmdsbuf_size);
-    self->framebuffer = (uint32_t *)port_malloc(total_allocation_size, true);
+    // Tiles follow the TMDS buffers: the map, then the tiles' pixels.
+    size_t map_size = 0;
+    size_t tiles_size = 0;
+    if (tile_size != 0) {
+        map_size = (width / tile_size) * (height / tile_size);
+        map_size = (map_size + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+        tiles_size = (tile_count * tile_size * tile_size * color_depth / 8) / sizeof(uint32_t);
+    }
+    size_t total_allocation_size = sizeof(uint32_t) * (framebuffer_size + DVI_N_TMDS_BUFFERS * self->tmdsbuf_size + map_size + tiles_size);
+    self->framebuffer = (uint32_t *)port_malloc_tagged(total_allocation_size, true, PORT_HEAP_TAG_DISPLAY);
     if (self->framebuffer == NULL) {
         m_malloc_fail(total_allocation_size);
         return;
     }
+    self->tile_size = tile_size;
+    self->tile_shift = tile_shift;
+    self->tile_count = tile_count;
+    self->scroll_x = 0;
+    self->scroll_y = 0;
+    self->next_line_buffer = 0;
+    if (tile_size != 0) {
+        uint32_t *tile_words = self->framebuffer + framebuffer_size + DVI_N_TMDS_BUFFERS * self->tmdsbuf_size;
+        self->map_width = width / tile_size;
+        self->tile_map = (uint8_t *)tile_words;
+        self->tiles = (uint8_t *)(tile_words + map_size);
+        memset(tile_words, 0, sizeof(uint32_t) * (map_size + tiles_size));
+    } else {
+        self->map_width = 0;
+        self->tile_map = NULL;
+        self->tiles = NULL;
+    }
 
     // Do the pwmio check last because it claims the pwm slice.
     if (!pwmio_claim_slice_ab_channels(slice)) {
@@ -303,15 +401,24 @@ void common_hal_picodvi_framebuffer_construct(picodvi_framebuffer_obj_t *self,
 
     // Core 1 will wait until it sees the first colour buffer, then start up the
     // DVI signalling.
+    #if CIRCUITPY_AUDIOMP3_MULTICORE
+    audiomp3_worker_reset();
+    #endif
     multicore_launch_core1(core1_main);
 
     self->next_scanline = 0;
-    uint32_t *next_scanline_buf = self->framebuffer + (self->pitch * self->next_scanline);
-    queue_add_blocking_u32(&self->dvi.q_colour_valid, &next_scanline_buf);
-    self->next_scanline += 1;
-    next_scanline_buf = self->framebuffer + (self->pitch * self->next_scanline);
-    queue_add_blocking_u32(&self->dvi.q_colour_valid, &next_scanline_buf);
-    self->next_scanline += 1;
+    for (size_t i = 0; i < 2; i++) {
+        uint32_t *next_scanline_buf;
+        if (self->tile_size != 0) {
+            next_scanline_buf = self->framebuffer + (self->pitch * self->next_line_buffer);
+            self->next_line_buffer++;
+            render_tile_row(self, next_scanline_buf, self->next_scanline);
+        } else {
+            next_scanline_buf = self->framebuffer + (self->pitch * self->next_scanline);
+        }
+        queue_add_blocking_u32(&self->dvi.q_colour_valid, &next_scanline_buf);
+        self->next_scanline += 1;
+    }
 
     // Wait for the second core to run dvi_start because it is in flash. Once it is done,
     // it'll pull from this queue. Not waiting may lead to us reading flash when this core
@@ -381,7 +488,7 @@ void common_hal_picodvi_framebuffer_deinit(picodvi_framebuffer_obj_t *self) {
 
     active_picodvi = NULL;
 
-    port_free(self->framebuffer);
+    port_free_tagged(self->framebuffer, PORT_HEAP_TAG_DISPLAY);
     self->framebuffer = NULL;
 
     self->base.type = &mp_type_NoneType;
@@ -408,6 +515,12 @@ int common_hal_picodvi_framebuffer_get_color_depth(picodvi_framebuffer_obj_t *se
 
 mp_int_t common_hal_picodvi_framebuffer_get_buffer(mp_obj_t self_in, mp_buffer_info_t *bufinfo, mp_uint_t flags) {
     picodvi_framebuffer_obj_t *self = (picodvi_framebuffer_obj_t *)self_in;
+    if (self->tile_size != 0) {
+        // There is no whole frame to draw into.
+        bufinfo->buf = NULL;
+        bufinfo->len = 0;
+        return 1;
+    }
     bufinfo->buf = self->framebuffer;
     char typecode = 'B';
     if (self->color_depth == 16) {
@@ -422,3 +535,31 @@ int common_hal_picodvi_framebuffer_get_row_stride(picodvi_framebuffer_obj_t *sel
     // Pitch is in words but row stride is expected as bytes.
     return self->pitch * sizeof(uint32_t);
 }
+
+mp_obj_t common_hal_picodvi_framebuffer_get_tile_map(picodvi_framebuffer_obj_t *self) {
+    return mp_obj_new_bytearray_by_ref(self->map_width * (self->height >> self->tile_shift), self->tile_map);
+}
+
+mp_obj_t common_hal_picodvi_framebuffer_get_tiles(picodvi_framebuffer_obj_t *self) {
+    size_t pixels = self->tile_count << (self->tile_shift * 2);
+    return mp_obj_new_memoryview(self->color_depth == 16 ? 'H' : 'B', pixels, self->tiles);
+}
+
+bool common_hal_picodvi_framebuffer_has_tiles(picodvi_framebuffer_obj_t *self) {
+    return self->tile_size != 0;
+}
+
+mp_uint_t common_hal_picodvi_framebuffer_get_scroll_x(picodvi_framebuffer_obj_t *self) {
+    return self->scroll_x;
+}
+
+mp_uint_t common_hal_picodvi_framebuffer_get_scroll_y(picodvi_framebuffer_obj_t *self) {
+    return self->scroll_y;
+}
+
+void common_hal_picodvi_framebuffer_set_scroll(picodvi_framebuffer_obj_t *self, mp_uint_t x, mp_uint_t y) {
+    // Rows are rendered on the other core, which reads these without locking.
+    // A half-updated pair only affects the row being rendered.
+    self->scroll_x = x;
+    self->scroll_y = y;
+}
@@ -30,8 +30,13 @@
 
 #include "lib/PicoDVI/software/libdvi/dvi.h"
 
+// Scanlines rendered ahead from tiles. Enough that one isn't rendered into while core 1
+// is still encoding it.
+#define PICODVI_TILE_LINE_BUFFERS (4)
+
 typedef struct {
     mp_obj_base_t base;
+    // Without tiles, the whole frame. With tiles, PICODVI_TILE_LINE_BUFFERS scanlines.
     uint32_t *framebuffer;
     size_t framebuffer_len; // in words
     size_t tmdsbuf_size; // in words
@@ -42,6 +47,17 @@ typedef struct {
     uint colour_lock;
     uint16_t next_scanline;
     uint16_t pitch; // Number of words between rows. (May be more than a width's worth.)
+    // Tile mode, when tile_size isn't 0: each scanline is made from tile_map, one
+    // byte per tile index, and tiles, tile_count square tiles of pixels.
+    uint8_t *tile_map;
+    uint8_t *tiles;
+    uint16_t tile_count;
+    uint16_t map_width; // in tiles
+    volatile uint16_t scroll_x;
+    volatile uint16_t scroll_y;
+    uint8_t tile_size;
+    uint8_t tile_shift; // log2(tile_size)
+    uint8_t next_line_buffer;
     uint8_t color_depth;
     uint8_t pwm_slice;
     int8_t pin_pair[4];
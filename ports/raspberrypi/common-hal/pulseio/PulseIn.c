@@ -106,39 +106,50 @@ void common_hal_pulseio_pulsein_pause(pulseio_pulsein_obj_t *self) {
     self->level_count = 0;
     self->paused = true;
 }
+STATIC void pulsein_record(pulseio_pulsein_obj_t *self, uint32_t result) {
+    // Pulses that are longer than MAX_PULSE will return MAX_PULSE
+    if (result > MAX_PULSE) {
+        result = MAX_PULSE;
+    }
+    // return  pulses that are not too short
+    if (result > MIN_PULSE) {
+        size_t buf_index = (self->start + self->len) % self->maxlen;
+        self->buffer[buf_index] = (uint16_t)result;
+        if (self->len < self->maxlen) {
+            self->len++;
+        } else {
+            self->start = (self->start + 1) % self->maxlen;
+        }
+    }
+}
+
 void common_hal_pulseio_pulsein_interrupt(void *self_in) {
     pulseio_pulsein_obj_t *self = self_in;
-
-    uint32_t rxfifo = 0;
-
-    rxfifo = pio_sm_get_blocking(self->state_machine.pio, self->state_machine.state_machine);
-    // translate from fifo to buffer
-    if ((rxfifo == 0 && self->last_level == false) || (rxfifo == 0xffffffff && self->last_level == true)) {
-        self->level_count = self->level_count + 32;
-    } else {
-        for (uint i = 0; i < 32; i++) {
-            bool level = (rxfifo & (1 << i)) >> i;
-            if (level == self->last_level) {
-                self->level_count++;
-            } else {
-                uint32_t result = self->level_count;
-                self->last_level = level;
-                self->level_count = 1;
-                // Pulses that are longer than MAX_PULSE will return MAX_PULSE
-                if (result > MAX_PULSE) {
-                    result = MAX_PULSE;
-                }
-                // return  pulses that are not too short
-                if (result > MIN_PULSE) {
-                    size_t buf_index = (self->start + self->len) % self->maxlen;
-                    self->buffer[buf_index] = (uint16_t)result;
-                    if (self->len < self->maxlen) {
-                        self->len++;
-                    } else {
-                        self->start = (self->start + 1) % self->maxlen;
-                    }
-                }
+    PIO pio = self->state_machine.pio;
+    uint sm = self->state_machine.state_machine;
+
+    // Drain every word that is queued so that a late interrupt doesn't let the
+    // FIFO overflow and drop samples from the middle of the sequence.
+    while (!pio_sm_is_rx_fifo_empty(pio, sm)) {
+        // translate from fifo to buffer. Bit 0 is the oldest sample.
+        uint32_t samples = pio_sm_get(pio, sm);
+        uint32_t remaining = 32;
+        while (remaining > 0) {
+            // Step from edge to edge instead of sample to sample.
+            uint32_t changed = self->last_level ? ~samples : samples;
+            if (remaining < 32) {
+                changed &= (1u << remaining) - 1;
+            }
+            if (changed == 0) {
+                self->level_count += remaining;
+                break;
             }
+            uint32_t run = __builtin_ctz(changed);
+            pulsein_record(self, self->level_count + run);
+            self->last_level = !self->last_level;
+            self->level_count = 0;
+            samples >>= run;
+            remaining -= run;
         }
     }
 }
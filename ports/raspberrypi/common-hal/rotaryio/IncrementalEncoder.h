@@ -30,6 +30,7 @@
 #include "common-hal/microcontroller/Pin.h"
 
 #include "py/obj.h"
+#include "shared-module/rotaryio/velocity.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -39,4 +40,5 @@ typedef struct {
     int8_t divisor; // Number of quadrature edges required per count
     bool swapped;         // Did the pins need to be swapped to be sequential?
     mp_int_t position;
+    rotaryio_velocity_t velocity;
 } rotaryio_incrementalencoder_obj_t;
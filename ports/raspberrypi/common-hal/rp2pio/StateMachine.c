@@ -63,6 +63,13 @@ STATIC int8_t _sm_dma_plus_one[NUM_PIOS][NUM_PIO_STATE_MACHINES];
 #define SM_DMA_CLEAR_CHANNEL(pio_index, sm) (_sm_dma_plus_one[(pio_index)][(sm)] = 0)
 #define SM_DMA_SET_CHANNEL(pio_isntance, sm, channel) (_sm_dma_plus_one[(pio_index)][(sm)] = (channel) + 1)
 
+STATIC int8_t _sm_dma_plus_one_read[NUM_PIOS][NUM_PIO_STATE_MACHINES];
+
+#define SM_DMA_ALLOCATED_READ(pio_index, sm) (_sm_dma_plus_one_read[(pio_index)][(sm)] != 0)
+#define SM_DMA_GET_CHANNEL_READ(pio_index, sm) (_sm_dma_plus_one_read[(pio_index)][(sm)] - 1)
+#define SM_DMA_CLEAR_CHANNEL_READ(pio_index, sm) (_sm_dma_plus_one_read[(pio_index)][(sm)] = 0)
+#define SM_DMA_SET_CHANNEL_READ(pio_index, sm, channel) (_sm_dma_plus_one_read[(pio_index)][(sm)] = (channel) + 1)
+
 STATIC PIO pio_instances[2] = {pio0, pio1};
 typedef void (*interrupt_handler_type)(void *);
 STATIC interrupt_handler_type _interrupt_handler[NUM_PIOS][NUM_PIO_STATE_MACHINES];
@@ -81,24 +88,35 @@ static void rp2pio_statemachine_set_pull(uint32_t pull_pin_up, uint32_t pull_pin
     }
 }
 
+STATIC void rp2pio_statemachine_release_dma(int channel) {
+    uint32_t channel_mask = 1u << channel;
+    dma_hw->inte0 &= ~channel_mask;
+    if (!dma_hw->inte0) {
+        irq_set_mask_enabled(1 << DMA_IRQ_0, false);
+    }
+    MP_STATE_PORT(background_pio)[channel] = NULL;
+    dma_channel_abort(channel);
+    dma_channel_unclaim(channel);
+}
+
 STATIC void rp2pio_statemachine_clear_dma(int pio_index, int sm) {
     if (SM_DMA_ALLOCATED(pio_index, sm)) {
-        int channel = SM_DMA_GET_CHANNEL(pio_index, sm);
-        uint32_t channel_mask = 1u << channel;
-        dma_hw->inte0 &= ~channel_mask;
-        if (!dma_hw->inte0) {
-            irq_set_mask_enabled(1 << DMA_IRQ_0, false);
-        }
-        MP_STATE_PORT(background_pio)[channel] = NULL;
-        dma_channel_abort(channel);
-        dma_channel_unclaim(channel);
+        rp2pio_statemachine_release_dma(SM_DMA_GET_CHANNEL(pio_index, sm));
     }
     SM_DMA_CLEAR_CHANNEL(pio_index, sm);
 }
 
+STATIC void rp2pio_statemachine_clear_dma_read(int pio_index, int sm) {
+    if (SM_DMA_ALLOCATED_READ(pio_index, sm)) {
+        rp2pio_statemachine_release_dma(SM_DMA_GET_CHANNEL_READ(pio_index, sm));
+    }
+    SM_DMA_CLEAR_CHANNEL_READ(pio_index, sm);
+}
+
 STATIC void _reset_statemachine(PIO pio, uint8_t sm, bool leave_pins) {
     uint8_t pio_index = pio_get_index(pio);
     rp2pio_statemachine_clear_dma(pio_index, sm);
+    rp2pio_statemachine_clear_dma_read(pio_index, sm);
     uint32_t program_id = _current_program_id[pio_index][sm];
     if (program_id == 0) {
         return;
@@ -692,6 +710,7 @@ void rp2pio_statemachine_never_reset(PIO pio, int sm) {
 void rp2pio_statemachine_deinit(rp2pio_statemachine_obj_t *self, bool leave_pins) {
     common_hal_rp2pio_statemachine_stop(self);
     (void)common_hal_rp2pio_statemachine_stop_background_write(self);
+    (void)common_hal_rp2pio_statemachine_stop_background_read(self);
 
     uint8_t sm = self->state_machine;
     uint8_t pio_index = pio_get_index(self->pio);
@@ -1067,7 +1086,48 @@ bool common_hal_rp2pio_statemachine_background_write(rp2pio_statemachine_obj_t *
     return true;
 }
 
+// The next buffer of the repeating part of a background read. A second loop buffer
+// alternates with the first.
+STATIC sm_buf_info rp2pio_statemachine_next_loop_read(rp2pio_statemachine_obj_t *self) {
+    sm_buf_info next = self->loop_read;
+    if (self->loop2_read.info.buf) {
+        self->loop_read = self->loop2_read;
+        self->loop2_read = next;
+    }
+    return next;
+}
+
+STATIC void rp2pio_statemachine_dma_complete_read(rp2pio_statemachine_obj_t *self, int channel) {
+    if (self->current_read.info.buf) {
+        // The previous buffer was never collected through last_read.
+        if (self->last_read.info.buf) {
+            self->read_overruns++;
+        }
+        self->last_read = self->current_read;
+    }
+    self->current_read = self->once_read;
+    self->once_read = rp2pio_statemachine_next_loop_read(self);
+
+    if (self->current_read.info.buf) {
+        if (self->pending_buffers_read > 0) {
+            self->pending_buffers_read--;
+        }
+        dma_channel_set_write_addr(channel, self->current_read.info.buf, false);
+        dma_channel_set_trans_count(channel, self->current_read.info.len / self->background_stride_in_bytes_read, true);
+    } else {
+        self->dma_completed_read = true;
+        self->pending_buffers_read = 0; // should be a no-op
+    }
+}
+
 void rp2pio_statemachine_dma_complete(rp2pio_statemachine_obj_t *self, int channel) {
+    uint8_t pio_index = pio_get_index(self->pio);
+    uint8_t sm = self->state_machine;
+    if (SM_DMA_ALLOCATED_READ(pio_index, sm) && SM_DMA_GET_CHANNEL_READ(pio_index, sm) == channel) {
+        rp2pio_statemachine_dma_complete_read(self, channel);
+        return;
+    }
+
     self->current = self->once;
     self->once = self->loop;
 
@@ -1102,6 +1162,138 @@ int common_hal_rp2pio_statemachine_get_pending(rp2pio_statemachine_obj_t *self)
     return self->pending_buffers;
 }
 
+bool common_hal_rp2pio_statemachine_background_read(rp2pio_statemachine_obj_t *self, const sm_buf_info *once, const sm_buf_info *loop, const sm_buf_info *loop2, uint8_t stride_in_bytes, bool swap) {
+    uint8_t pio_index = pio_get_index(self->pio);
+    uint8_t sm = self->state_machine;
+
+    int pending_buffers = (once->info.len != 0) + (loop->info.len != 0) + (loop2->info.len != 0);
+    bool once_is_loop = !once->info.len;
+
+    if (SM_DMA_ALLOCATED_READ(pio_index, sm)) {
+        if (stride_in_bytes != self->background_stride_in_bytes_read) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Mismatched data size"));
+        }
+        if (swap != self->byteswap_read) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Mismatched swap flag"));
+        }
+
+        while (self->pending_buffers_read) {
+            RUN_BACKGROUND_TASKS;
+            if (self->user_interruptible && mp_hal_is_interrupted()) {
+                return false;
+            }
+        }
+
+        common_hal_mcu_disable_interrupts();
+        self->loop_read = *loop;
+        self->loop2_read = *loop2;
+        self->once_read = once_is_loop ? rp2pio_statemachine_next_loop_read(self) : *once;
+        self->pending_buffers_read = pending_buffers;
+
+        if (self->dma_completed_read && self->once_read.info.len) {
+            rp2pio_statemachine_dma_complete_read(self, SM_DMA_GET_CHANNEL_READ(pio_index, sm));
+            self->dma_completed_read = false;
+        }
+
+        common_hal_mcu_enable_interrupts();
+
+        return true;
+    }
+
+    int channel = dma_claim_unused_channel(false);
+    if (channel == -1) {
+        return false;
+    }
+
+    SM_DMA_SET_CHANNEL_READ(pio_index, sm, channel);
+
+    volatile uint8_t *rx_source = (volatile uint8_t *)&self->pio->rxf[self->state_machine];
+    if (self->in_shift_right) {
+        rx_source += 4 - stride_in_bytes;
+    }
+
+    self->rx_dreq = pio_get_dreq(self->pio, self->state_machine, false);
+
+    dma_channel_config c;
+
+    self->loop_read = *loop;
+    self->loop2_read = *loop2;
+    self->current_read = once_is_loop ? rp2pio_statemachine_next_loop_read(self) : *once;
+    self->once_read = rp2pio_statemachine_next_loop_read(self);
+    memset(&self->last_read, 0, sizeof(self->last_read));
+    self->read_overruns = 0;
+    self->pending_buffers_read = pending_buffers;
+    self->dma_completed_read = false;
+    self->background_stride_in_bytes_read = stride_in_bytes;
+    self->byteswap_read = swap;
+
+    c = dma_channel_get_default_config(channel);
+    channel_config_set_transfer_data_size(&c, _stride_to_dma_size(stride_in_bytes));
+    channel_config_set_dreq(&c, self->rx_dreq);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_bswap(&c, swap);
+    dma_channel_configure(channel, &c,
+        self->current_read.info.buf,
+        rx_source,
+        self->current_read.info.len / stride_in_bytes,
+        false);
+
+    common_hal_mcu_disable_interrupts();
+    MP_STATE_PORT(background_pio)[channel] = self;
+    dma_hw->inte0 |= 1u << channel;
+    irq_set_mask_enabled(1 << DMA_IRQ_0, true);
+    dma_start_channel_mask(1u << channel);
+    common_hal_mcu_enable_interrupts();
+
+    return true;
+}
+
+bool common_hal_rp2pio_statemachine_stop_background_read(rp2pio_statemachine_obj_t *self) {
+    uint8_t pio_index = pio_get_index(self->pio);
+    uint8_t sm = self->state_machine;
+    rp2pio_statemachine_clear_dma_read(pio_index, sm);
+    memset(&self->current_read, 0, sizeof(self->current_read));
+    memset(&self->once_read, 0, sizeof(self->once_read));
+    memset(&self->loop_read, 0, sizeof(self->loop_read));
+    memset(&self->loop2_read, 0, sizeof(self->loop2_read));
+    self->pending_buffers_read = 0;
+    return true;
+}
+
+bool common_hal_rp2pio_statemachine_get_reading(rp2pio_statemachine_obj_t *self) {
+    uint8_t pio_index = pio_get_index(self->pio);
+    return SM_DMA_ALLOCATED_READ(pio_index, self->state_machine) && !self->dma_completed_read;
+}
+
+// The number of bytes background_read has written into its current buffer. Call with
+// interrupts disabled so that the buffer doesn't change underneath.
+size_t rp2pio_statemachine_get_read_offset(rp2pio_statemachine_obj_t *self) {
+    uint8_t pio_index = pio_get_index(self->pio);
+    uint8_t sm = self->state_machine;
+    if (!SM_DMA_ALLOCATED_READ(pio_index, sm) || self->current_read.info.buf == NULL) {
+        return 0;
+    }
+    int channel = SM_DMA_GET_CHANNEL_READ(pio_index, sm);
+    return dma_channel_hw_addr(channel)->write_addr - (uint32_t)self->current_read.info.buf;
+}
+
+mp_int_t common_hal_rp2pio_statemachine_get_pending_read(rp2pio_statemachine_obj_t *self) {
+    return self->pending_buffers_read;
+}
+
+mp_obj_t common_hal_rp2pio_statemachine_get_last_read(rp2pio_statemachine_obj_t *self) {
+    common_hal_mcu_disable_interrupts();
+    mp_obj_t last_read = self->last_read.obj;
+    memset(&self->last_read, 0, sizeof(self->last_read));
+    common_hal_mcu_enable_interrupts();
+    return last_read ? last_read : mp_const_empty_bytes;
+}
+
+uint32_t common_hal_rp2pio_statemachine_get_read_overruns(rp2pio_statemachine_obj_t *self) {
+    return self->read_overruns;
+}
+
 // Use a compile-time constant for MP_REGISTER_POINTER so the preprocessor will
 // not split the expansion across multiple lines.
 MP_REGISTER_ROOT_POINTER(mp_obj_t background_pio[enum_NUM_DMA_CHANNELS]);
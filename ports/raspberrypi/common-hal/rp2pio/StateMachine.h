@@ -68,6 +68,13 @@ typedef struct {
     sm_buf_info current, once, loop;
     int background_stride_in_bytes;
     bool dma_completed, byteswap;
+
+    // background read items
+    volatile int pending_buffers_read;
+    sm_buf_info current_read, once_read, loop_read, loop2_read, last_read;
+    int background_stride_in_bytes_read;
+    volatile uint32_t read_overruns;
+    bool dma_completed_read, byteswap_read;
 } rp2pio_statemachine_obj_t;
 
 void reset_rp2pio_statemachine(void);
@@ -97,6 +104,7 @@ uint8_t rp2pio_statemachine_program_offset(rp2pio_statemachine_obj_t *self);
 
 void rp2pio_statemachine_deinit(rp2pio_statemachine_obj_t *self, bool leave_pins);
 void rp2pio_statemachine_dma_complete(rp2pio_statemachine_obj_t *self, int channel);
+size_t rp2pio_statemachine_get_read_offset(rp2pio_statemachine_obj_t *self);
 
 void rp2pio_statemachine_reset_ok(PIO pio, int sm);
 void rp2pio_statemachine_never_reset(PIO pio, int sm);
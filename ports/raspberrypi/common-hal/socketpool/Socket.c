@@ -33,6 +33,7 @@
 #include "py/gc.h"
 #include "py/mperrno.h"
 #include "py/mphal.h"
+#include "py/objarray.h"
 #include "py/runtime.h"
 #include "py/stream.h"
 #include "shared-bindings/socketpool/SocketPool.h"
@@ -134,13 +135,35 @@ STATIC struct tcp_pcb *volatile *lwip_socket_incoming_array(socketpool_socket_ob
     }
 }
 
+// Move the oldest queued datagram, if any, to incoming.pbuf once that is empty.
+STATIC void lwip_socket_next_datagram(socketpool_socket_obj_t *socket) {
+    #if CIRCUITPY_SOCKETPOOL_DATAGRAM_QUEUE_LEN > 1
+    if (socket->datagram_queue_len == 0) {
+        return;
+    }
+    uint8_t i = socket->datagram_queue_get;
+    socket->incoming.pbuf = socket->datagram_queue[i].pbuf;
+    socket->peer_port = socket->datagram_queue[i].peer_port;
+    memcpy(&socket->peer, socket->datagram_queue[i].peer, sizeof(socket->peer));
+    socket->datagram_queue[i].pbuf = NULL;
+    socket->datagram_queue_get = (i + 1) % (CIRCUITPY_SOCKETPOOL_DATAGRAM_QUEUE_LEN - 1);
+    socket->datagram_queue_len--;
+    #endif
+}
+
 STATIC void lwip_socket_free_incoming(socketpool_socket_obj_t *socket) {
     bool socket_is_listener =
         socket->type == MOD_NETWORK_SOCK_STREAM
         && socket->pcb.tcp->state == LISTEN;
 
     if (!socket_is_listener) {
-        if (socket->incoming.pbuf != NULL) {
+        if (socket->type != MOD_NETWORK_SOCK_STREAM) {
+            while (socket->incoming.pbuf != NULL) {
+                pbuf_free(socket->incoming.pbuf);
+                socket->incoming.pbuf = NULL;
+                lwip_socket_next_datagram(socket);
+            }
+        } else if (socket->incoming.pbuf != NULL) {
             pbuf_free(socket->incoming.pbuf);
             socket->incoming.pbuf = NULL;
         }
@@ -171,6 +194,29 @@ static inline void exec_user_callback(socketpool_socket_obj_t *socket) {
     supervisor_workflow_request_background();
 }
 
+// Hold datagram p from addr and port until it is read, unless too many are unread already.
+STATIC void lwip_socket_queue_datagram(socketpool_socket_obj_t *socket, struct pbuf *p, const ip_addr_t *addr, u16_t port) {
+    if (socket->incoming.pbuf == NULL) {
+        socket->incoming.pbuf = p;
+        socket->peer_port = (mp_uint_t)port;
+        memcpy(&socket->peer, addr, sizeof(socket->peer));
+        return;
+    }
+    #if CIRCUITPY_SOCKETPOOL_DATAGRAM_QUEUE_LEN > 1
+    if (socket->datagram_queue_len < CIRCUITPY_SOCKETPOOL_DATAGRAM_QUEUE_LEN - 1) {
+        uint8_t i = (socket->datagram_queue_get + socket->datagram_queue_len) % (CIRCUITPY_SOCKETPOOL_DATAGRAM_QUEUE_LEN - 1);
+        socket->datagram_queue[i].pbuf = p;
+        socket->datagram_queue[i].peer_port = port;
+        memcpy(socket->datagram_queue[i].peer, addr, sizeof(socket->datagram_queue[i].peer));
+        socket->datagram_queue_len++;
+        return;
+    }
+    #endif
+    // That's why they call it "unreliable". No room in the inn, drop the packet.
+    socket->datagrams_dropped++;
+    pbuf_free(p);
+}
+
 #if MICROPY_PY_LWIP_SOCK_RAW
 // Callback for incoming raw packets.
 #if LWIP_VERSION_MAJOR < 2
@@ -181,12 +227,7 @@ STATIC u8_t _lwip_raw_incoming(void *arg, struct raw_pcb *pcb, struct pbuf *p, c
 {
     socketpool_socket_obj_t *socket = (socketpool_socket_obj_t *)arg;
 
-    if (socket->incoming.pbuf != NULL) {
-        pbuf_free(p);
-    } else {
-        socket->incoming.pbuf = p;
-        memcpy(&socket->peer, addr, sizeof(socket->peer));
-    }
+    lwip_socket_queue_datagram(socket, p, addr, 0);
     return 1; // we ate the packet
 }
 #endif
@@ -201,14 +242,7 @@ STATIC void _lwip_udp_incoming(void *arg, struct udp_pcb *upcb, struct pbuf *p,
 {
     socketpool_socket_obj_t *socket = (socketpool_socket_obj_t *)arg;
 
-    if (socket->incoming.pbuf != NULL) {
-        // That's why they call it "unreliable". No room in the inn, drop the packet.
-        pbuf_free(p);
-    } else {
-        socket->incoming.pbuf = p;
-        socket->peer_port = (mp_uint_t)port;
-        memcpy(&socket->peer, addr, sizeof(socket->peer));
-    }
+    lwip_socket_queue_datagram(socket, p, addr, port);
 }
 
 // Callback for general tcp errors.
@@ -219,6 +253,8 @@ STATIC void _lwip_tcp_error(void *arg, err_t err) {
     lwip_socket_free_incoming(socket);
     // Pass the error code back via the connection variable.
     socket->state = err;
+    // lwIP has dropped any queued data, so it no longer refers to send_buffer.
+    socket->send_buffer = MP_OBJ_NULL;
     // If we got here, the lwIP stack either has deallocated or will deallocate the pcb.
     socket->pcb.tcp = NULL;
 }
@@ -420,6 +456,8 @@ STATIC mp_uint_t lwip_raw_udp_receive(socketpool_socket_obj_t *socket, byte *buf
         }
     }
 
+    MICROPY_PY_LWIP_ENTER
+
     if (ip != NULL) {
         memcpy(ip, &socket->peer, sizeof(socket->peer));
         *port = socket->peer_port;
@@ -427,11 +465,10 @@ STATIC mp_uint_t lwip_raw_udp_receive(socketpool_socket_obj_t *socket, byte *buf
 
     struct pbuf *p = socket->incoming.pbuf;
 
-    MICROPY_PY_LWIP_ENTER
-
     u16_t result = pbuf_copy_partial(p, buf, ((p->tot_len > len) ? len : p->tot_len), 0);
     pbuf_free(p);
     socket->incoming.pbuf = NULL;
+    lwip_socket_next_datagram(socket);
 
     MICROPY_PY_LWIP_EXIT
 
@@ -456,8 +493,9 @@ STATIC mp_uint_t lwip_raw_udp_receive(socketpool_socket_obj_t *socket, byte *buf
     assert(socket->pcb.tcp);
 
 
-// Helper function for send/sendto to handle TCP packets
-STATIC mp_uint_t lwip_tcp_send(socketpool_socket_obj_t *socket, const byte *buf, mp_uint_t len, int *_errno) {
+// Helper function for send/sendto to handle TCP packets. Without TCP_WRITE_FLAG_COPY
+// in apiflags, lwIP refers to buf until the data has been acknowledged.
+STATIC mp_uint_t lwip_tcp_send(socketpool_socket_obj_t *socket, const byte *buf, mp_uint_t len, u8_t apiflags, int *_errno) {
     // Check for any pending errors
     STREAM_ERROR_CHECK(socket);
 
@@ -503,7 +541,7 @@ STATIC mp_uint_t lwip_tcp_send(socketpool_socket_obj_t *socket, const byte *buf,
     // committed to being able to write the data.
     err_t err;
     for (int i = 0; i < 200; ++i) {
-        err = tcp_write(socket->pcb.tcp, buf, write_len, TCP_WRITE_FLAG_COPY);
+        err = tcp_write(socket->pcb.tcp, buf, write_len, apiflags);
         if (err != ERR_MEM) {
             break;
         }
@@ -521,8 +559,9 @@ STATIC mp_uint_t lwip_tcp_send(socketpool_socket_obj_t *socket, const byte *buf,
         MICROPY_PY_LWIP_REENTER
     }
 
-    // If the output buffer is getting full then send the data to the lower layers
-    if (err == ERR_OK && tcp_sndbuf(socket->pcb.tcp) < TCP_SND_BUF / 4) {
+    // If the output buffer is getting full then send the data to the lower layers.
+    // Data that isn't copied is sent straight away so that it is released sooner.
+    if (err == ERR_OK && (!(apiflags & TCP_WRITE_FLAG_COPY) || tcp_sndbuf(socket->pcb.tcp) < TCP_SND_BUF / 4)) {
         err = tcp_output(socket->pcb.tcp);
     }
 
@@ -536,6 +575,32 @@ STATIC mp_uint_t lwip_tcp_send(socketpool_socket_obj_t *socket, const byte *buf,
     return write_len;
 }
 
+// Releases send_buffer once lwIP has had everything queued from it acknowledged.
+// Call with the lwIP lock held.
+STATIC bool send_buffer_done(socketpool_socket_obj_t *socket) {
+    if (socket->send_buffer != MP_OBJ_NULL &&
+        (socket->pcb.tcp == NULL || TCP_SEQ_GEQ(socket->pcb.tcp->lastack, socket->send_buffer_end))) {
+        socket->send_buffer = MP_OBJ_NULL;
+    }
+    return socket->send_buffer == MP_OBJ_NULL;
+}
+
+// lwIP reads zero-copy data until it is acknowledged, so only data that can't
+// be changed or resized meanwhile is sent that way: bytes, or a read-only
+// memoryview such as a slice of bytes.
+STATIC bool send_buffer_is_immutable(mp_obj_t buffer) {
+    if (mp_obj_is_type(buffer, &mp_type_bytes)) {
+        return true;
+    }
+    #if MICROPY_PY_BUILTINS_MEMORYVIEW
+    if (mp_obj_is_type(buffer, &mp_type_memoryview)) {
+        mp_obj_array_t *view = MP_OBJ_TO_PTR(buffer);
+        return !(view->typecode & MP_OBJ_ARRAY_TYPECODE_FLAG_RW);
+    }
+    #endif
+    return false;
+}
+
 // Helper function for recv/recvfrom to handle TCP packets
 STATIC mp_uint_t lwip_tcp_receive(socketpool_socket_obj_t *socket, byte *buf, mp_uint_t len, int *_errno) {
     // Check for any pending errors
@@ -580,32 +645,34 @@ STATIC mp_uint_t lwip_tcp_receive(socketpool_socket_obj_t *socket, byte *buf, mp
 
     assert(socket->pcb.tcp != NULL);
 
+    // Copy from as many of the queued segments as fit, and then reopen the
+    // window for all of them at once.
     struct pbuf *p = socket->incoming.pbuf;
-
-    mp_uint_t remaining = p->len - socket->recv_offset;
-    if (len > remaining) {
-        len = remaining;
-    }
-
-    memcpy(buf, (byte *)p->payload + socket->recv_offset, len);
-
-    remaining -= len;
-    if (remaining == 0) {
-        socket->incoming.pbuf = p->next;
-        // If we don't ref here, free() will free the entire chain,
-        // if we ref, it does what we need: frees 1st buf, and decrements
-        // next buf's refcount back to 1.
-        pbuf_ref(p->next);
-        pbuf_free(p);
-        socket->recv_offset = 0;
-    } else {
-        socket->recv_offset += len;
+    mp_uint_t copied = 0;
+    while (p != NULL && copied < len) {
+        mp_uint_t remaining = p->len - socket->recv_offset;
+        mp_uint_t n = MIN(len - copied, remaining);
+        memcpy(buf + copied, (byte *)p->payload + socket->recv_offset, n);
+        copied += n;
+        if (n == remaining) {
+            struct pbuf *next = p->next;
+            // If we don't ref here, free() will free the entire chain,
+            // if we ref, it does what we need: frees 1st buf, and decrements
+            // next buf's refcount back to 1.
+            pbuf_ref(next);
+            pbuf_free(p);
+            p = next;
+            socket->recv_offset = 0;
+        } else {
+            socket->recv_offset += n;
+        }
     }
-    tcp_recved(socket->pcb.tcp, len);
+    socket->incoming.pbuf = p;
+    tcp_recved(socket->pcb.tcp, copied);
 
     MICROPY_PY_LWIP_EXIT
 
-    return len;
+    return copied;
 }
 
 
@@ -679,7 +746,13 @@ bool socketpool_socket(socketpool_socketpool_obj_t *self,
     socket->domain = SOCKETPOOL_AF_INET;
     socket->type = type;
     socket->callback = MP_OBJ_NULL;
+    socket->send_buffer = MP_OBJ_NULL;
     socket->state = STATE_NEW;
+    #if CIRCUITPY_SOCKETPOOL_DATAGRAM_QUEUE_LEN > 1
+    socket->datagram_queue_get = 0;
+    socket->datagram_queue_len = 0;
+    #endif
+    socket->datagrams_dropped = 0;
 
     switch (socket->type) {
         case SOCKETPOOL_SOCK_STREAM:
@@ -694,6 +767,7 @@ bool socketpool_socket(socketpool_socketpool_obj_t *self,
         #if MICROPY_PY_LWIP_SOCK_RAW
         case SOCKETPOOL_SOCK_RAW: {
             socket->pcb.raw = raw_new(proto);
+            socket->incoming.pbuf = NULL;
             break;
         }
         #endif
@@ -815,10 +889,12 @@ int socketpool_socket_accept(socketpool_socket_obj_t *self, uint8_t *ip, uint32_
     accepted->domain = MOD_NETWORK_AF_INET;
     accepted->type = MOD_NETWORK_SOCK_STREAM;
     accepted->incoming.pbuf = NULL;
+    accepted->datagrams_dropped = 0;
     accepted->timeout = self->timeout;
     accepted->state = STATE_CONNECTED;
     accepted->recv_offset = 0;
     accepted->callback = MP_OBJ_NULL;
+    accepted->send_buffer = MP_OBJ_NULL;
     tcp_arg(accepted->pcb.tcp, (void *)accepted);
     tcp_err(accepted->pcb.tcp, _lwip_tcp_error);
     tcp_recv(accepted->pcb.tcp, _lwip_tcp_recv);
@@ -926,7 +1002,11 @@ void socketpool_socket_close(socketpool_socket_obj_t *socket) {
                 // the latter may free the pcb; if it doesn't then the callback will be active.
                 tcp_poll(socket->pcb.tcp, _lwip_tcp_close_poll, MICROPY_PY_LWIP_TCP_CLOSE_TIMEOUT_MS / 500);
             }
-            if (tcp_close(socket->pcb.tcp) != ERR_OK) {
+            // lwIP would keep sending from send_buffer after the socket has gone,
+            // so drop the connection instead.
+            if (!send_buffer_done(socket)) {
+                tcp_abort(socket->pcb.tcp);
+            } else if (tcp_close(socket->pcb.tcp) != ERR_OK) {
                 DEBUG_printf("lwip_close: had to call tcp_abort()\n");
                 tcp_abort(socket->pcb.tcp);
             }
@@ -945,6 +1025,7 @@ void socketpool_socket_close(socketpool_socket_obj_t *socket) {
     }
 
     socket->pcb.tcp = NULL;
+    socket->send_buffer = MP_OBJ_NULL;
     socket->state = _ERR_BADF;
     MICROPY_PY_LWIP_EXIT
 }
@@ -1038,6 +1119,10 @@ bool common_hal_socketpool_socket_get_connected(socketpool_socket_obj_t *socket)
     return socket->state == STATE_CONNECTED;
 }
 
+mp_int_t common_hal_socketpool_socket_get_datagrams_dropped(socketpool_socket_obj_t *socket) {
+    return socket->datagrams_dropped;
+}
+
 bool common_hal_socketpool_socket_listen(socketpool_socket_obj_t *socket, int backlog) {
     if (socket->type != MOD_NETWORK_SOCK_STREAM) {
         mp_raise_OSError(MP_EOPNOTSUPP);
@@ -1094,6 +1179,22 @@ mp_uint_t common_hal_socketpool_socket_recvfrom_into(socketpool_socket_obj_t *so
     return ret;
 }
 
+int socketpool_socket_recvfrom_into(socketpool_socket_obj_t *socket,
+    uint8_t *buf, uint32_t len, uint8_t *ip, uint32_t *port) {
+    if (socket->type == SOCKETPOOL_SOCK_STREAM) {
+        return -MP_EOPNOTSUPP;
+    }
+    if (socket->incoming.pbuf == NULL) {
+        return -MP_EAGAIN;
+    }
+    int _errno;
+    mp_uint_t ret = lwip_raw_udp_receive(socket, (byte *)buf, len, ip, port, &_errno);
+    if (ret == (unsigned)-1) {
+        return -_errno;
+    }
+    return ret;
+}
+
 int socketpool_socket_recv_into(socketpool_socket_obj_t *socket,
     const uint8_t *buf, uint32_t len) {
     mp_uint_t ret = 0;
@@ -1129,7 +1230,7 @@ int socketpool_socket_send(socketpool_socket_obj_t *socket, const uint8_t *buf,
     int _errno = 0;
     switch (socket->type) {
         case SOCKETPOOL_SOCK_STREAM: {
-            ret = lwip_tcp_send(socket, buf, len, &_errno);
+            ret = lwip_tcp_send(socket, buf, len, TCP_WRITE_FLAG_COPY, &_errno);
             break;
         }
         case SOCKETPOOL_SOCK_DGRAM:
@@ -1145,6 +1246,31 @@ int socketpool_socket_send(socketpool_socket_obj_t *socket, const uint8_t *buf,
     return ret;
 }
 
+int socketpool_socket_sendv(socketpool_socket_obj_t *socket, const mp_buffer_info_t *bufs, size_t count) {
+    if (socket->type != SOCKETPOOL_SOCK_STREAM) {
+        // Each piece would be its own datagram, so let the caller do that.
+        return -MP_EINVAL;
+    }
+    int total = 0;
+    for (size_t i = 0; i < count; i++) {
+        // Hold back PSH until the last piece so that the pieces can share segments.
+        u8_t apiflags = TCP_WRITE_FLAG_COPY;
+        if (i + 1 < count) {
+            apiflags |= TCP_WRITE_FLAG_MORE;
+        }
+        int _errno = 0;
+        mp_uint_t ret = lwip_tcp_send(socket, bufs[i].buf, bufs[i].len, apiflags, &_errno);
+        if (ret == (unsigned)-1) {
+            return total > 0 ? total : -_errno;
+        }
+        total += ret;
+        if (ret < bufs[i].len) {
+            break;
+        }
+    }
+    return total;
+}
+
 mp_uint_t common_hal_socketpool_socket_send(socketpool_socket_obj_t *self, const uint8_t *buf, uint32_t len) {
     int sent = socketpool_socket_send(self, buf, len);
 
@@ -1154,6 +1280,56 @@ mp_uint_t common_hal_socketpool_socket_send(socketpool_socket_obj_t *self, const
     return sent;
 }
 
+mp_uint_t common_hal_socketpool_socket_send_buffer(socketpool_socket_obj_t *self, mp_obj_t buffer, const uint8_t *buf, uint32_t len) {
+    if (self->type != SOCKETPOOL_SOCK_STREAM || !send_buffer_is_immutable(buffer)) {
+        return common_hal_socketpool_socket_send(self, buf, len);
+    }
+
+    // Only one buffer is held at a time, so wait for the previous one.
+    mp_uint_t start = mp_hal_ticks_ms();
+    MICROPY_PY_LWIP_ENTER
+    while (!send_buffer_done(self)) {
+        MICROPY_PY_LWIP_EXIT
+        if (self->timeout == 0) {
+            mp_raise_OSError(MP_EAGAIN);
+        }
+        if (self->timeout != (unsigned)-1 && mp_hal_ticks_ms() - start > self->timeout) {
+            mp_raise_OSError(MP_ETIMEDOUT);
+        }
+        poll_sockets();
+        MICROPY_PY_LWIP_REENTER
+    }
+    MICROPY_PY_LWIP_EXIT
+
+    int _errno;
+    mp_uint_t ret = lwip_tcp_send(self, buf, len, 0, &_errno);
+    if (ret == (unsigned)-1) {
+        mp_raise_OSError(_errno);
+    }
+    if (ret > 0 && self->pcb.tcp != NULL) {
+        MICROPY_PY_LWIP_ENTER
+        self->send_buffer = buffer;
+        self->send_buffer_end = self->pcb.tcp->snd_lbb;
+        MICROPY_PY_LWIP_EXIT
+    }
+    return ret;
+}
+
+int socketpool_socket_sendto(socketpool_socket_obj_t *socket,
+    const uint8_t *ip, uint32_t port, const uint8_t *buf, uint32_t len) {
+    if (socket->type == SOCKETPOOL_SOCK_STREAM) {
+        return -MP_EOPNOTSUPP;
+    }
+    ip_addr_t dest;
+    IP_ADDR4(&dest, ip[0], ip[1], ip[2], ip[3]);
+    int _errno;
+    mp_uint_t ret = lwip_raw_udp_send(socket, buf, len, &dest, port, &_errno);
+    if (ret == (unsigned)-1) {
+        return -_errno;
+    }
+    return ret;
+}
+
 mp_uint_t common_hal_socketpool_socket_sendto(socketpool_socket_obj_t *socket,
     const char *host, size_t hostlen, uint32_t port, const uint8_t *buf, uint32_t len) {
     int _errno;
@@ -1163,7 +1339,7 @@ mp_uint_t common_hal_socketpool_socket_sendto(socketpool_socket_obj_t *socket,
     mp_uint_t ret = 0;
     switch (socket->type) {
         case SOCKETPOOL_SOCK_STREAM: {
-            ret = lwip_tcp_send(socket, buf, len, &_errno);
+            ret = lwip_tcp_send(socket, buf, len, TCP_WRITE_FLAG_COPY, &_errno);
             break;
         }
         case SOCKETPOOL_SOCK_DGRAM:
@@ -1210,7 +1386,7 @@ bool common_hal_socketpool_readable(socketpool_socket_obj_t *self) {
 
     if (self->type == SOCKETPOOL_SOCK_STREAM && self->pcb.tcp->state == LISTEN) {
         struct tcp_pcb *volatile *incoming_connection = &lwip_socket_incoming_array(self)[self->incoming.connection.iget];
-        result = (incoming_connection != NULL);
+        result = (*incoming_connection != NULL);
     }
 
     MICROPY_PY_LWIP_EXIT;
@@ -1218,6 +1394,12 @@ bool common_hal_socketpool_readable(socketpool_socket_obj_t *self) {
     return result;
 }
 
+bool common_hal_socketpool_socket_wake_when_ready(socketpool_socket_obj_t *self, mp_uint_t flags) {
+    // Readiness changes in lwIP callbacks that don't wake the main task, so
+    // sockets have to be polled.
+    return false;
+}
+
 bool common_hal_socketpool_writable(socketpool_socket_obj_t *self) {
     bool result = false;
 
@@ -1225,7 +1407,7 @@ bool common_hal_socketpool_writable(socketpool_socket_obj_t *self) {
 
     switch (self->type) {
         case SOCKETPOOL_SOCK_STREAM: {
-            result = tcp_sndbuf(self->pcb.tcp) != 0;
+            result = tcp_sndbuf(self->pcb.tcp) != 0 && send_buffer_done(self);
             break;
         }
         case SOCKETPOOL_SOCK_DGRAM:
@@ -1267,5 +1449,6 @@ void socketpool_socket_reset(socketpool_socket_obj_t *self) {
     }
     self->base.type = &socketpool_socket_type;
     self->pcb.tcp = NULL;
+    self->send_buffer = MP_OBJ_NULL;
     self->state = _ERR_BADF;
 }
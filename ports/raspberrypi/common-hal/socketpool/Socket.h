@@ -54,7 +54,23 @@ typedef struct _lwip_socket_obj_t {
             } tcp;
         } connection;
     } incoming;
+    #if CIRCUITPY_SOCKETPOOL_DATAGRAM_QUEUE_LEN > 1
+    // Datagrams that arrived while incoming.pbuf held an unread one, oldest first.
+    struct {
+        struct pbuf *pbuf;
+        byte peer[4];
+        uint16_t peer_port;
+    } datagram_queue[CIRCUITPY_SOCKETPOOL_DATAGRAM_QUEUE_LEN - 1];
+    uint8_t datagram_queue_get;
+    uint8_t datagram_queue_len;
+    #endif
+    // Datagrams freed on arrival because the queue was full.
+    uint32_t datagrams_dropped;
     mp_obj_t callback;
+    // Buffer queued by send_buffer without copying, held until lwIP has sent
+    // everything up to send_buffer_end.
+    mp_obj_t send_buffer;
+    uint32_t send_buffer_end;
     byte peer[4];
     mp_uint_t peer_port;
     mp_uint_t timeout;
@@ -60,6 +60,17 @@ void common_hal_ssl_sslcontext_set_check_hostname(ssl_sslcontext_obj_t *self, bo
     self->check_name = value;
 }
 
+bool common_hal_ssl_sslcontext_get_session_cache(ssl_sslcontext_obj_t *self) {
+    return false;
+}
+
+void common_hal_ssl_sslcontext_set_session_cache(ssl_sslcontext_obj_t *self, bool value) {
+    // mbedTLS allocates from the VM heap here, so sessions couldn't be kept.
+    if (value) {
+        mp_raise_NotImplementedError_varg(MP_ERROR_TEXT("%q"), MP_QSTR_session_cache);
+    }
+}
+
 void common_hal_ssl_sslcontext_load_cert_chain(ssl_sslcontext_obj_t *self, mp_buffer_info_t *cert_buf, mp_buffer_info_t *key_buf) {
     self->cert_buf = *cert_buf;
     self->key_buf = *key_buf;
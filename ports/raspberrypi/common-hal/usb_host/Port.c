@@ -30,6 +30,8 @@
 #include "shared-bindings/usb_host/Port.h"
 #include "supervisor/usb.h"
 
+#include "audiomp3_worker.h"
+
 #include "src/common/pico_time/include/pico/time.h"
 #include "src/rp2040/hardware_structs/include/hardware/structs/mpu.h"
 #include "src/rp2_common/cmsis/stub/CMSIS/Device/RaspberryPi/RP2040/Include/RP2040.h"
@@ -160,6 +162,9 @@ usb_host_port_obj_t *common_hal_usb_host_port_construct(const mcu_pin_obj_t *dp,
     common_hal_never_reset_pin(dm);
 
     // Core 1 will run the SOF interrupt directly.
+    #if CIRCUITPY_AUDIOMP3_MULTICORE
+    audiomp3_worker_reset();
+    #endif
     _core1_ready = false;
     multicore_launch_core1(core1_main);
     while (!_core1_ready) {
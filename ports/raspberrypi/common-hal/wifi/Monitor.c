@@ -39,7 +39,7 @@
 typedef struct {
 } monitor_packet_t;
 
-void common_hal_wifi_monitor_construct(wifi_monitor_obj_t *self, uint8_t channel, size_t queue) {
+void common_hal_wifi_monitor_construct(wifi_monitor_obj_t *self, uint8_t channel, size_t queue, bool payload) {
     mp_raise_NotImplementedError(MP_ERROR_TEXT("wifi.Monitor not available"));
 }
 
@@ -69,6 +69,14 @@ mp_obj_t common_hal_wifi_monitor_get_queued(wifi_monitor_obj_t *self) {
     return mp_obj_new_int_from_uint(0);
 }
 
+void common_hal_wifi_monitor_set_filter(wifi_monitor_obj_t *self, uint64_t subtypes,
+    const uint8_t *addresses, size_t address_count, int8_t min_rssi) {
+}
+
+size_t common_hal_wifi_monitor_get_packets_into(wifi_monitor_obj_t *self, uint8_t *buf, size_t count) {
+    return 0;
+}
+
 mp_obj_t common_hal_wifi_monitor_get_packet(wifi_monitor_obj_t *self) {
     return mp_const_none;
 }
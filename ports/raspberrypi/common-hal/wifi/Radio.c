@@ -162,6 +162,7 @@ void common_hal_wifi_radio_start_station(wifi_radio_obj_t *self) {
 void common_hal_wifi_radio_stop_station(wifi_radio_obj_t *self) {
 
     cyw43_wifi_leave(&cyw43_state, CYW43_ITF_STA);
+    self->connecting = false;
     const size_t timeout_ms = 500;
     uint64_t start = port_get_raw_ticks(NULL);
     uint64_t deadline = start + timeout_ms;
@@ -257,7 +258,7 @@ static bool connection_unchanged(wifi_radio_obj_t *self, const uint8_t *ssid, si
     return true;
 }
 
-wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, mp_float_t timeout, uint8_t *bssid, size_t bssid_len) {
+wifi_radio_error_t common_hal_wifi_radio_connect_start(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, uint8_t *bssid, size_t bssid_len) {
     if (!common_hal_wifi_radio_get_enabled(self)) {
         mp_raise_RuntimeError(MP_ERROR_TEXT("Wifi is not enabled"));
     }
@@ -266,13 +267,14 @@ wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t
         return WIFI_RADIO_ERROR_CONNECTION_FAIL;
     }
 
-    size_t timeout_ms = timeout <= 0 ? 8000 : (size_t)MICROPY_FLOAT_C_FUN(ceil)(timeout * 1000);
-    uint64_t start = port_get_raw_ticks(NULL);
-    uint64_t deadline = start + timeout_ms;
-
     if (connection_unchanged(self, ssid, ssid_len)) {
         return WIFI_RADIO_ERROR_NONE;
     }
+    if (self->connecting && ssid_len == self->connected_ssid_len &&
+        memcmp(ssid, self->connected_ssid, ssid_len) == 0) {
+        // Let the attempt already under way, such as the web workflow's, finish.
+        return WIFI_RADIO_ERROR_NONE;
+    }
 
     // disconnect
     common_hal_wifi_radio_stop_station(self);
@@ -282,26 +284,57 @@ wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t
     cyw43_arch_wifi_connect_async((const char *)ssid, (const char *)password, auth_mode);
     // TODO: Implement authmode check like in espressif
 
+    memcpy(self->connected_ssid, ssid, ssid_len);
+    self->connected_ssid_len = ssid_len;
+    self->connecting = true;
+    return WIFI_RADIO_ERROR_NONE;
+}
+
+bool common_hal_wifi_radio_connect_finished(wifi_radio_obj_t *self, wifi_radio_error_t *error) {
+    int result = cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA);
+
+    switch (result) {
+        case CYW43_LINK_UP:
+            if (self->connecting) {
+                self->connecting = false;
+                bindings_cyw43_wifi_enforce_pm();
+            }
+            *error = WIFI_RADIO_ERROR_NONE;
+            return true;
+        case CYW43_LINK_FAIL:
+            *error = WIFI_RADIO_ERROR_CONNECTION_FAIL;
+            break;
+        case CYW43_LINK_NONET:
+            *error = WIFI_RADIO_ERROR_NO_AP_FOUND;
+            break;
+        case CYW43_LINK_BADAUTH:
+            *error = WIFI_RADIO_ERROR_AUTH_FAIL;
+            break;
+        default:
+            return false;
+    }
+    self->connecting = false;
+    return true;
+}
+
+wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, mp_float_t timeout, uint8_t *bssid, size_t bssid_len) {
+    size_t timeout_ms = timeout <= 0 ? 8000 : (size_t)MICROPY_FLOAT_C_FUN(ceil)(timeout * 1000);
+    uint64_t start = port_get_raw_ticks(NULL);
+    uint64_t deadline = start + timeout_ms;
+
+    wifi_radio_error_t error = common_hal_wifi_radio_connect_start(self, ssid, ssid_len, password, password_len, channel, bssid, bssid_len);
+    if (error != WIFI_RADIO_ERROR_NONE) {
+        return error;
+    }
+
     while (port_get_raw_ticks(NULL) < deadline) {
         RUN_BACKGROUND_TASKS;
         if (mp_hal_is_interrupted()) {
             break;
         }
 
-        int result = cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA);
-
-        switch (result) {
-            case CYW43_LINK_UP:
-                memcpy(self->connected_ssid, ssid, ssid_len);
-                self->connected_ssid_len = ssid_len;
-                bindings_cyw43_wifi_enforce_pm();
-                return WIFI_RADIO_ERROR_NONE;
-            case CYW43_LINK_FAIL:
-                return WIFI_RADIO_ERROR_CONNECTION_FAIL;
-            case CYW43_LINK_NONET:
-                return WIFI_RADIO_ERROR_NO_AP_FOUND;
-            case CYW43_LINK_BADAUTH:
-                return WIFI_RADIO_ERROR_AUTH_FAIL;
+        if (common_hal_wifi_radio_connect_finished(self, &error)) {
+            return error;
         }
     }
 
@@ -38,6 +38,8 @@ typedef struct {
     uint8_t connected_ssid[32];
     uint8_t connected_ssid_len;
     bool enabled;
+    // A connection attempt to connected_ssid has been started and hasn't finished yet.
+    bool connecting;
 } wifi_radio_obj_t;
 
 extern void common_hal_wifi_radio_gc_collect(wifi_radio_obj_t *self);
@@ -23,12 +23,19 @@
 #define MEM_SIZE                    4000
 #define MEMP_NUM_TCP_SEG            32
 #define MEMP_NUM_ARP_QUEUE          10
-#define PBUF_POOL_SIZE              24
+// Received TCP segments wait in pool buffers until they are read, so keep
+// enough for a full window plus other traffic.
+#define PBUF_POOL_SIZE              (CIRCUITPY_LWIP_TCP_WND_SEGMENTS + 16)
 #define LWIP_ARP                    1
 #define LWIP_ETHERNET               1
 #define LWIP_ICMP                   1
 #define LWIP_RAW                    1
-#define TCP_WND                     (8 * TCP_MSS)
+// The receive window in full-size segments. Larger windows let a sender keep
+// more in flight, which speeds up downloads at the cost of pool buffers.
+#ifndef CIRCUITPY_LWIP_TCP_WND_SEGMENTS
+#define CIRCUITPY_LWIP_TCP_WND_SEGMENTS 8
+#endif
+#define TCP_WND                     (CIRCUITPY_LWIP_TCP_WND_SEGMENTS * TCP_MSS)
 #define TCP_MSS                     1460
 #define TCP_SND_BUF                 (8 * TCP_MSS)
 #define TCP_SND_QUEUELEN            ((4 * (TCP_SND_BUF) + (TCP_MSS - 1)) / (TCP_MSS))
@@ -48,6 +48,22 @@
 
 #define CIRCUITPY_PROCESSOR_COUNT           (2)
 
+// Decode mp3 from memory on core 1 unless it is needed for something else.
+#ifndef CIRCUITPY_AUDIOMP3_MULTICORE
+#define CIRCUITPY_AUDIOMP3_MULTICORE (CIRCUITPY_AUDIOMP3)
+#endif
+
+// How many sample buffers to put in each audio DMA buffer. More makes late refills
+// less likely to be heard, at the cost of RAM and latency.
+#ifndef CIRCUITPY_AUDIO_DMA_BLOCKS_PER_BUFFER
+#define CIRCUITPY_AUDIO_DMA_BLOCKS_PER_BUFFER (2)
+#endif
+
+// Noise shape 16-bit samples as they are cut down to the PWM audio resolution.
+#ifndef CIRCUITPY_AUDIOPWMIO_NOISE_SHAPING
+#define CIRCUITPY_AUDIOPWMIO_NOISE_SHAPING (1)
+#endif
+
 #if CIRCUITPY_USB_HOST
 #define CIRCUITPY_USB_HOST_INSTANCE 1
 #endif
@@ -59,6 +75,12 @@
 #define MICROPY_PY_LWIP_ENTER   cyw43_arch_lwip_begin();
 #define MICROPY_PY_LWIP_REENTER MICROPY_PY_LWIP_ENTER
 #define MICROPY_PY_LWIP_EXIT    cyw43_arch_lwip_end();
+
+// Number of unread datagrams a UDP or raw socket holds before dropping new ones.
+// Each holds an lwIP pbuf until it is read.
+#ifndef CIRCUITPY_SOCKETPOOL_DATAGRAM_QUEUE_LEN
+#define CIRCUITPY_SOCKETPOOL_DATAGRAM_QUEUE_LEN (4)
+#endif
 #endif
 
 // Protect the background queue with a lock because both cores may modify it.
@@ -8,6 +8,8 @@ CIRCUITPY_WIFI_RADIO_SETTABLE_MAC_ADDRESS = 0
 CIRCUITPY_ALARM ?= 1
 CIRCUITPY_RP2PIO ?= 1
 CIRCUITPY_NEOPIXEL_WRITE ?= $(CIRCUITPY_RP2PIO)
+CIRCUITPY_NEOPIXEL_WRITE_PARALLEL ?= $(CIRCUITPY_NEOPIXEL_WRITE)
+CIRCUITPY_BUSIO_I2C_ASYNC ?= $(CIRCUITPY_BUSIO)
 CIRCUITPY_FLOPPYIO ?= 1
 CIRCUITPY_FRAMEBUFFERIO ?= $(CIRCUITPY_DISPLAYIO)
 CIRCUITPY_FULL_BUILD ?= 1
@@ -54,6 +56,11 @@ USB_NUM_ENDPOINT_PAIRS = 8
 
 INTERNAL_FLASH_FILESYSTEM = 1
 CIRCUITPY_SETTABLE_PROCESSOR_FREQUENCY = 1
+CIRCUITPY_CPU_GOVERNOR ?= 1
+
+# TCP receive window for CYW43 wifi, in full-size segments. Each one needs an
+# lwIP pool buffer of about 1.5kB. Above 44 needs lwIP window scaling.
+CIRCUITPY_LWIP_TCP_WND_SEGMENTS ?= 8
 
 # Usually lots of flash space available
 CIRCUITPY_MESSAGE_COMPRESSION_LEVEL ?= 1
@@ -40,6 +40,7 @@
 #include "shared-bindings/microcontroller/__init__.h"
 
 #include "audio_dma.h"
+#include "audiomp3_worker.h"
 #include "supervisor/flash.h"
 #include "supervisor/usb.h"
 
@@ -96,6 +97,10 @@ void port_internal_flash_flush(void) {
     if (_cache_lba == NO_CACHE) {
         return;
     }
+    // Core 1 may be decoding from flash.
+    #if CIRCUITPY_AUDIOMP3_MULTICORE
+    audiomp3_worker_lockout_start();
+    #endif
     // Make sure we don't have an interrupt while we do flash operations.
     common_hal_mcu_disable_interrupts();
     // and audio DMA must be paused as well
@@ -109,6 +114,9 @@ void port_internal_flash_flush(void) {
     audio_dma_unpause_mask(channel_mask);
     #endif
     common_hal_mcu_enable_interrupts();
+    #if CIRCUITPY_AUDIOMP3_MULTICORE
+    audiomp3_worker_lockout_end();
+    #endif
 }
 
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block, uint32_t num_blocks) {
@@ -31,12 +31,14 @@
 #include "supervisor/board.h"
 #include "supervisor/port.h"
 
+#include "audiomp3_worker.h"
 #include "bindings/rp2pio/StateMachine.h"
 #include "genhdr/mpversion.h"
 #include "shared-bindings/audiopwmio/PWMAudioOut.h"
 #include "shared-bindings/busio/I2C.h"
 #include "shared-bindings/busio/SPI.h"
 #include "shared-bindings/countio/Counter.h"
+#include "common-hal/neopixel_write/__init__.h"
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/rtc/__init__.h"
 #include "shared-bindings/pwmio/PWMOut.h"
@@ -52,6 +54,10 @@
 #include "common-hal/rtc/RTC.h"
 #include "common-hal/busio/UART.h"
 
+#if CIRCUITPY_I2CTARGET
+#include "common-hal/i2ctarget/I2CTarget.h"
+#endif
+
 #include "supervisor/shared/safe_mode.h"
 #include "supervisor/shared/stack.h"
 #include "supervisor/shared/tick.h"
@@ -184,10 +190,18 @@ void reset_port(void) {
     reset_countio();
     #endif
 
+    #if CIRCUITPY_I2CTARGET
+    i2ctarget_reset();
+    #endif
+
     #if CIRCUITPY_PWMIO
     pwmout_reset();
     #endif
 
+    #if CIRCUITPY_NEOPIXEL_WRITE
+    reset_neopixel_write();
+    #endif
+
     #if CIRCUITPY_RP2PIO
     reset_rp2pio_statemachine();
     #endif
@@ -202,6 +216,9 @@ void reset_port(void) {
     #if CIRCUITPY_AUDIOCORE
     audio_dma_reset();
     #endif
+    #if CIRCUITPY_AUDIOMP3_MULTICORE
+    audiomp3_worker_reset();
+    #endif
 
     #if CIRCUITPY_SSL
     ssl_reset();
@@ -275,6 +292,10 @@ uint64_t port_get_raw_ticks(uint8_t *subticks) {
     return 1024 * (microseconds / 1000000) + (microseconds % 1000000) / 977;
 }
 
+uint64_t port_get_raw_ticks_us(void) {
+    return time_us_64();
+}
+
 STATIC void _tick_callback(uint alarm_num) {
     if (ticks_enabled) {
         supervisor_tick();
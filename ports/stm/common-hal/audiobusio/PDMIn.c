@@ -196,3 +196,19 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t *se
 
     return samples_output;
 }
+
+void common_hal_audiobusio_pdmin_start_recording(audiobusio_pdmin_obj_t *self, uint32_t buffer_length) {
+    mp_raise_NotImplementedError(NULL);
+}
+
+void common_hal_audiobusio_pdmin_stop_recording(audiobusio_pdmin_obj_t *self) {
+}
+
+uint32_t common_hal_audiobusio_pdmin_readinto(audiobusio_pdmin_obj_t *self,
+    uint16_t *output_buffer, uint32_t output_buffer_length) {
+    return 0;
+}
+
+uint32_t common_hal_audiobusio_pdmin_get_overruns(audiobusio_pdmin_obj_t *self) {
+    return 0;
+}
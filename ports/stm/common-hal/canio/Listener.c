@@ -266,27 +266,29 @@ int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self) {
     return *(self->rfr) & CAN_RF0R_FMP0;
 }
 
-mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+STATIC bool listener_wait(canio_listener_obj_t *self) {
     if (!common_hal_canio_listener_in_waiting(self)) {
         uint64_t deadline = supervisor_ticks_ms64() + self->timeout_ms;
         do {
             if (supervisor_ticks_ms64() > deadline) {
-                return NULL;
+                return false;
             }
             RUN_BACKGROUND_TASKS;
             // Allow user to break out of a timeout with a KeyboardInterrupt.
             if (mp_hal_is_interrupted()) {
-                return NULL;
+                return false;
             }
         } while (!common_hal_canio_listener_in_waiting(self));
     }
+    return true;
+}
 
+// Move the oldest message out of the mailbox. Returns true for a remote transmission request.
+STATIC bool listener_read(canio_listener_obj_t *self, canio_message_obj_t *message) {
     uint32_t rir = self->mailbox->RIR;
     uint32_t rdtr = self->mailbox->RDTR;
 
     bool rtr = rir & CAN_RI0R_RTR;
-    canio_message_obj_t *message =
-        mp_obj_malloc(canio_message_obj_t, rtr ? &canio_remote_transmission_request_type : &canio_message_type);
     message->extended = rir & CAN_RI0R_IDE;
     if (message->extended) {
         message->id = rir >> 3;
@@ -301,9 +303,33 @@ mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
     }
     // Release the mailbox
     SET_BIT(*self->rfr, CAN_RF0R_RFOM0);
+    return rtr;
+}
+mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self) {
+    if (!listener_wait(self)) {
+        return NULL;
+    }
+    canio_message_obj_t *message = mp_obj_malloc(canio_message_obj_t, &canio_message_type);
+    if (listener_read(self, message)) {
+        message->base.type = &canio_remote_transmission_request_type;
+    }
     return message;
 }
 
+size_t common_hal_canio_listener_receive_into(canio_listener_obj_t *self, uint8_t *records, size_t max_records) {
+    if (max_records == 0 || !listener_wait(self)) {
+        return 0;
+    }
+    size_t count = 0;
+    do {
+        canio_message_obj_t message;
+        bool rtr = listener_read(self, &message);
+        canio_message_pack_record(&message, rtr, records + count * CANIO_LISTENER_RECORD_SIZE);
+        count++;
+    } while (count < max_records && common_hal_canio_listener_in_waiting(self));
+    return count;
+}
+
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self) {
     if (self->can) {
         clear_filters(self);
@@ -24,12 +24,20 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "py/enum.h"
 #include "py/obj.h"
 #include "py/runtime.h"
 
 #include "shared-bindings/displayio/__init__.h"
 #include "shared-bindings/displayio/Bitmap.h"
+#include "shared-bindings/displayio/ColorConverter.h"
+#include "shared-bindings/displayio/Group.h"
+#include "shared-bindings/displayio/OnDiskBitmap.h"
+#include "shared-bindings/displayio/Palette.h"
+#include "shared-bindings/displayio/TileGrid.h"
+#include "shared-module/displayio/area.h"
 
 MAKE_ENUM_VALUE(displayio_colorspace_type, displayio_colorspace, RGB888, DISPLAYIO_COLORSPACE_RGB888);
 MAKE_ENUM_VALUE(displayio_colorspace_type, displayio_colorspace, RGB565, DISPLAYIO_COLORSPACE_RGB565);
@@ -77,10 +85,137 @@ STATIC MP_DEFINE_CONST_DICT(displayio_colorspace_locals_dict, displayio_colorspa
 MAKE_PRINTER(displayio, displayio_colorspace);
 MAKE_ENUM_TYPE(displayio, ColorSpace, displayio_colorspace);
 
+displayio_buffer_transform_t null_transform = {
+    .x = 0,
+    .y = 0,
+    .dx = 1,
+    .dy = 1,
+    .scale = 1,
+    .width = 0,
+    .height = 0,
+    .mirror_x = false,
+    .mirror_y = false,
+    .transpose_xy = false
+};
+
+// There are no FatFS file objects here so an OnDiskBitmap can never be made.
+// TileGrid still checks for one, so give it a type that is never instantiated.
+MP_DEFINE_CONST_OBJ_TYPE(
+    displayio_ondiskbitmap_type,
+    MP_QSTR_OnDiskBitmap,
+    MP_TYPE_FLAG_NONE
+    );
+
+uint16_t common_hal_displayio_ondiskbitmap_get_width(displayio_ondiskbitmap_t *self) {
+    return 0;
+}
+
+uint16_t common_hal_displayio_ondiskbitmap_get_height(displayio_ondiskbitmap_t *self) {
+    return 0;
+}
+
+uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *self, int16_t x, int16_t y) {
+    return 0;
+}
+
+void displayio_ondiskbitmap_get_row_pixels(displayio_ondiskbitmap_t *self, int16_t x, int16_t y, uint16_t count, uint32_t *values) {
+}
+
+#define RENDER_BUFFER_SIZE (512)
+
+// Composes the area into the RGB565 bitmap, one band of rows at a time, the
+// same way a FramebufferDisplay refreshes an area into its framebuffer.
+STATIC uint32_t _render_area(displayio_group_t *group, const _displayio_colorspace_t *colorspace, displayio_bitmap_t *bitmap, const displayio_area_t *area) {
+    displayio_area_t bitmap_area = {0, 0, bitmap->width, bitmap->height, NULL};
+    displayio_area_t clipped;
+    if (!displayio_area_compute_overlap(area, &bitmap_area, &clipped)) {
+        return 0;
+    }
+    uint16_t width = displayio_area_width(&clipped);
+    uint16_t rows_per_buffer = RENDER_BUFFER_SIZE * 2 / width;
+    if (rows_per_buffer == 0) {
+        rows_per_buffer = 1;
+    }
+    uint32_t buffer[(width * rows_per_buffer + 1) / 2];
+    uint32_t mask[(width * rows_per_buffer) / 32 + 1];
+
+    for (int16_t y = clipped.y1; y < clipped.y2; y += rows_per_buffer) {
+        displayio_area_t subrectangle = {
+            .x1 = clipped.x1,
+            .y1 = y,
+            .x2 = clipped.x2,
+            .y2 = MIN(y + rows_per_buffer, clipped.y2),
+        };
+        memset(mask, 0, sizeof(mask));
+        memset(buffer, 0, sizeof(buffer));
+        displayio_group_fill_area(group, colorspace, &subrectangle, mask, buffer);
+
+        const uint16_t *src = (uint16_t *)buffer;
+        for (int16_t row = subrectangle.y1; row < subrectangle.y2; row++) {
+            uint16_t *dest = (uint16_t *)(bitmap->data + row * bitmap->stride) + clipped.x1;
+            memcpy(dest, src, width * sizeof(uint16_t));
+            src += width;
+        }
+    }
+    return displayio_area_size(&clipped);
+}
+
+//| def _render(group: Group, bitmap: Bitmap, full: bool = False) -> int:
+//|     """Render ``group`` into the 16 bit ``bitmap`` as RGB565 and return how
+//|     many pixels were drawn. Only the dirty areas are drawn unless ``full`` is
+//|     set. This lets the host build exercise and time displayio's compositor
+//|     without a display."""
+//|
+STATIC mp_obj_t displayio__render(size_t n_args, const mp_obj_t *args) {
+    displayio_group_t *group = mp_arg_validate_type(args[0], &displayio_group_type, MP_QSTR_group);
+    displayio_bitmap_t *bitmap = mp_arg_validate_type(args[1], &displayio_bitmap_type, MP_QSTR_bitmap);
+    bool full = n_args > 2 && mp_obj_is_true(args[2]);
+    if (bitmap->bits_per_value != 16) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be %d"), MP_QSTR_bits_per_value, 16);
+    }
+    if (bitmap->read_only) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
+    }
+
+    // Attach the group the first time it is rendered, like setting it as a
+    // display's root_group. That also makes the first render a full one.
+    if (!group->in_group) {
+        displayio_group_update_transform(group, &null_transform);
+    }
+
+    _displayio_colorspace_t colorspace = {
+        .depth = 16,
+        .bytes_per_cell = 2,
+        .pixels_in_byte_share_row = true,
+    };
+
+    uint32_t rendered = 0;
+    const displayio_area_t *areas = displayio_group_get_refresh_areas(group, NULL);
+    if (full) {
+        displayio_area_t area = {0, 0, bitmap->width, bitmap->height, NULL};
+        rendered = _render_area(group, &colorspace, bitmap, &area);
+    } else {
+        for (const displayio_area_t *area = areas; area != NULL; area = area->next) {
+            rendered += _render_area(group, &colorspace, bitmap, area);
+        }
+    }
+    displayio_group_finish_refresh(group);
+
+    displayio_area_t dirty = {0, 0, bitmap->width, bitmap->height, NULL};
+    displayio_bitmap_set_dirty_area(bitmap, &dirty);
+    return mp_obj_new_int_from_uint(rendered);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(displayio__render_obj, 2, 3, displayio__render);
+
 STATIC const mp_rom_map_elem_t displayio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_displayio) },
     { MP_ROM_QSTR(MP_QSTR_Bitmap), MP_ROM_PTR(&displayio_bitmap_type) },
+    { MP_ROM_QSTR(MP_QSTR_ColorConverter), MP_ROM_PTR(&displayio_colorconverter_type) },
     { MP_ROM_QSTR(MP_QSTR_Colorspace), MP_ROM_PTR(&displayio_colorspace_type) },
+    { MP_ROM_QSTR(MP_QSTR_Group), MP_ROM_PTR(&displayio_group_type) },
+    { MP_ROM_QSTR(MP_QSTR_Palette), MP_ROM_PTR(&displayio_palette_type) },
+    { MP_ROM_QSTR(MP_QSTR_TileGrid), MP_ROM_PTR(&displayio_tilegrid_type) },
+    { MP_ROM_QSTR(MP_QSTR__render), MP_ROM_PTR(&displayio__render_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(displayio_module_globals, displayio_module_globals_table);
 
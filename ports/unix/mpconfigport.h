@@ -40,6 +40,10 @@
 // CIRCUITPY-CHANGE
 #define CIRCUITPY_MICROPYTHON_ADVANCED (1)
 #define MICROPY_PY_ASYNC_AWAIT (1)
+// There are no background callbacks so WaveFile reads each buffer as it is needed.
+#define CIRCUITPY_AUDIOCORE_WAVEFILE_READ_AHEAD (0)
+#define CIRCUITPY_AUDIOCORE_WAVEFILE_BUFFER_COUNT (2)
+#define CIRCUITPY_AUDIOCORE_WAVEFILE_BUFFER_SIZE (256)
 
 #ifndef MICROPY_CONFIG_ROM_LEVEL
 #define MICROPY_CONFIG_ROM_LEVEL (MICROPY_CONFIG_ROM_LEVEL_CORE_FEATURES)
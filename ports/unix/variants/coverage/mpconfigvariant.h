@@ -36,6 +36,49 @@
 // Enable testing of split heap.
 #define MICROPY_GC_SPLIT_HEAP          (1)
 #define MICROPY_GC_SPLIT_HEAP_N_HEAPS  (4)
+#define MICROPY_GC_NURSERY_MAX_BLOCKS  (4)
+#define MICROPY_GC_SLOW_AREAS          (1)
+// Pretend that areas added after the second one are slow, to test placement.
+#define MICROPY_GC_AREA_IS_SLOW(start, end) (MP_STATE_MEM(area).next != NULL)
+
+// Enable testing of the small allocation size classes.
+#define MICROPY_GC_SIZE_CLASSES        (1)
+
+// Enable testing of sweeping in steps from gc_alloc.
+#define MICROPY_GC_INCREMENTAL_SWEEP   (1)
+
+// Enable testing of queued finalisers, with a short queue to exercise overflow.
+#define MICROPY_GC_DEFERRED_FINALISERS (1)
+#define MICROPY_GC_FINALISER_QUEUE_LEN (8)
+
+// Enable testing of gc.Arena.
+#define MICROPY_GC_ARENA               (1)
+
+// Enable testing of heap compaction.
+#define MICROPY_GC_COMPACT             (1)
+
+// Enable testing of allocation site tracking.
+#define MICROPY_GC_ALLOC_SITES         (1)
+
+// Enable testing of allocation statistics.
+#define MICROPY_GC_STATS               (1)
+
+// Enable testing of the import compile cache. The directory is relative so that
+// it is only used by tests that create it.
+#define MICROPY_MODULE_COMPILE_CACHE   (1)
+#define MICROPY_MODULE_COMPILE_CACHE_DIR ".mpycache"
+
+// Cache the listings of directories searched by import.
+#define MICROPY_MODULE_IMPORT_DIR_CACHE (1)
+
+// Index the characters of long str objects as they are indexed.
+#define MICROPY_PY_BUILTINS_STR_UNICODE_INDEX (1)
+
+// Compile file input a group of statements at a time.
+#define MICROPY_COMP_STREAMING (1)
+
+// Enable testing of using .mpy data in place.
+#define MICROPY_PERSISTENT_CODE_LOAD_XIP (1)
 
 // Enable additional features.
 #define MICROPY_DEBUG_PARSE_RULE_NAME  (1)
@@ -30,18 +30,29 @@ SRC_BITMAP := \
 	shared-bindings/aesio/__init__.c \
 	shared-bindings/audiocore/__init__.c \
 	shared-bindings/audiocore/RawSample.c \
+	shared-bindings/audiocore/Resampler.c \
 	shared-bindings/audiocore/WaveFile.c \
+	shared-bindings/audiofilters/__init__.c \
+	shared-bindings/audiofilters/Compressor.c \
+	shared-bindings/audiofilters/Echo.c \
+	shared-bindings/audiofilters/Filter.c \
+	shared-bindings/audiofilters/SoftClip.c \
 	shared-bindings/audiomixer/__init__.c \
 	shared-bindings/audiomixer/Mixer.c \
 	shared-bindings/audiomixer/MixerVoice.c \
 	shared-bindings/bitmaptools/__init__.c \
 	shared-bindings/codeop/__init__.c \
 	shared-bindings/displayio/Bitmap.c \
+	shared-bindings/displayio/ColorConverter.c \
+	shared-bindings/displayio/Group.c \
+	shared-bindings/displayio/Palette.c \
+	shared-bindings/displayio/TileGrid.c \
 	shared-bindings/jpegio/__init__.c \
 	shared-bindings/jpegio/JpegDecoder.c \
 	shared-bindings/locale/__init__.c \
 	shared-bindings/rainbowio/__init__.c \
 	shared-bindings/struct/__init__.c \
+	shared-bindings/struct/Struct.c \
 	shared-bindings/synthio/__init__.c \
 	shared-bindings/synthio/Math.c \
 	shared-bindings/synthio/MidiTrack.c \
@@ -49,14 +60,27 @@ SRC_BITMAP := \
 	shared-bindings/synthio/Note.c \
 	shared-bindings/synthio/Biquad.c \
 	shared-bindings/synthio/Synthesizer.c \
+	shared-bindings/synthio/Wavetable.c \
 	shared-bindings/traceback/__init__.c \
 	shared-bindings/util.c \
+	shared-bindings/vectorio/__init__.c \
+	shared-bindings/vectorio/Circle.c \
+	shared-bindings/vectorio/Polygon.c \
+	shared-bindings/vectorio/Rectangle.c \
+	shared-bindings/vectorio/VectorShape.c \
+	shared-bindings/zlib/Decompress.c \
 	shared-bindings/zlib/__init__.c \
 	shared-module/aesio/aes.c \
 	shared-module/aesio/__init__.c \
 	shared-module/audiocore/__init__.c \
 	shared-module/audiocore/RawSample.c \
+	shared-module/audiocore/Resampler.c \
 	shared-module/audiocore/WaveFile.c \
+	shared-module/audiofilters/__init__.c \
+	shared-module/audiofilters/Compressor.c \
+	shared-module/audiofilters/Echo.c \
+	shared-module/audiofilters/Filter.c \
+	shared-module/audiofilters/SoftClip.c \
 	shared-module/audiomixer/__init__.c \
 	shared-module/audiomixer/Mixer.c \
 	shared-module/audiomixer/MixerVoice.c \
@@ -65,11 +89,16 @@ SRC_BITMAP := \
 	shared-module/displayio/Bitmap.c \
 	shared-module/displayio/ColorConverter.c \
 	shared-module/displayio/ColorConverter.c \
+	shared-module/displayio/dither.c \
+	shared-module/displayio/Group.c \
+	shared-module/displayio/Palette.c \
+	shared-module/displayio/TileGrid.c \
 	shared-module/jpegio/__init__.c \
 	shared-module/jpegio/JpegDecoder.c \
 	shared-module/os/getenv.c \
 	shared-module/rainbowio/__init__.c \
 	shared-module/struct/__init__.c \
+	shared-module/struct/Struct.c \
 	shared-module/synthio/__init__.c \
 	shared-module/synthio/Math.c \
 	shared-module/synthio/MidiTrack.c \
@@ -77,14 +106,23 @@ SRC_BITMAP := \
 	shared-module/synthio/Note.c \
 	shared-module/synthio/Biquad.c \
 	shared-module/synthio/Synthesizer.c \
+	shared-module/synthio/Wavetable.c \
 	shared-module/traceback/__init__.c \
+	shared-module/vectorio/__init__.c \
+	shared-module/vectorio/Circle.c \
+	shared-module/vectorio/Polygon.c \
+	shared-module/vectorio/Rectangle.c \
+	shared-module/vectorio/VectorShape.c \
+	shared-module/zlib/Decompress.c \
 	shared-module/zlib/__init__.c \
 
 SRC_C += $(SRC_BITMAP)
 
 CFLAGS += \
 	-DCIRCUITPY_AESIO=1 \
+	-DCIRCUITPY_AESIO_TINYAES=1 \
 	-DCIRCUITPY_AUDIOCORE=1 \
+	-DCIRCUITPY_AUDIOFILTERS=1 \
 	-DCIRCUITPY_AUDIOMIXER=1 \
 	-DCIRCUITPY_AUDIOCORE_DEBUG=1 \
 	-DCIRCUITPY_BITMAPTOOLS=1 \
@@ -99,7 +137,9 @@ CFLAGS += \
 	-DCIRCUITPY_STRUCT=1 \
 	-DCIRCUITPY_SYNTHIO=1 \
 	-DCIRCUITPY_SYNTHIO_MAX_CHANNELS=14 \
+	-DCIRCUITPY_SYNTHIO_MAX_EVENTS=32 \
 	-DCIRCUITPY_TRACEBACK=1 \
+	-DCIRCUITPY_VECTORIO=1 \
 	-DCIRCUITPY_ZLIB=1
 
 # CIRCUITPY-CHANGE: test native base classes.
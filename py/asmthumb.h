@@ -291,6 +291,47 @@ static inline void asm_thumb_ldrb_rlo_rlo_i5(asm_thumb_t *as, uint rlo_dest, uin
 static inline void asm_thumb_ldrh_rlo_rlo_i5(asm_thumb_t *as, uint rlo_dest, uint rlo_base, uint uint16_offset) {
     asm_thumb_format_9_10(as, ASM_THUMB_FORMAT_10_LDRH, rlo_dest, rlo_base, uint16_offset);
 }
+// CIRCUITPY-CHANGE: register-offset loads and stores for viper pointers
+// FORMAT 7: load/store with register offset
+// FORMAT 8: load/store halfword with register offset
+// The loads are zero extended into the register
+
+#define ASM_THUMB_FORMAT_7_STR (0x5000)
+#define ASM_THUMB_FORMAT_7_STRB (0x5400)
+#define ASM_THUMB_FORMAT_7_LDR (0x5800)
+#define ASM_THUMB_FORMAT_7_LDRB (0x5c00)
+#define ASM_THUMB_FORMAT_8_STRH (0x5200)
+#define ASM_THUMB_FORMAT_8_LDRH (0x5a00)
+
+#define ASM_THUMB_FORMAT_7_8_ENCODE(op, rlo_dest, rlo_base, rlo_index) \
+    ((op) | ((rlo_index) << 6) | ((rlo_base) << 3) | (rlo_dest))
+
+static inline void asm_thumb_format_7_8(asm_thumb_t *as, uint op, uint rlo_dest, uint rlo_base, uint rlo_index) {
+    assert(rlo_dest < ASM_THUMB_REG_R8);
+    assert(rlo_base < ASM_THUMB_REG_R8);
+    assert(rlo_index < ASM_THUMB_REG_R8);
+    asm_thumb_op16(as, ASM_THUMB_FORMAT_7_8_ENCODE(op, rlo_dest, rlo_base, rlo_index));
+}
+
+static inline void asm_thumb_str_rlo_rlo_rlo(asm_thumb_t *as, uint rlo_src, uint rlo_base, uint rlo_index) {
+    asm_thumb_format_7_8(as, ASM_THUMB_FORMAT_7_STR, rlo_src, rlo_base, rlo_index);
+}
+static inline void asm_thumb_strb_rlo_rlo_rlo(asm_thumb_t *as, uint rlo_src, uint rlo_base, uint rlo_index) {
+    asm_thumb_format_7_8(as, ASM_THUMB_FORMAT_7_STRB, rlo_src, rlo_base, rlo_index);
+}
+static inline void asm_thumb_strh_rlo_rlo_rlo(asm_thumb_t *as, uint rlo_src, uint rlo_base, uint rlo_index) {
+    asm_thumb_format_7_8(as, ASM_THUMB_FORMAT_8_STRH, rlo_src, rlo_base, rlo_index);
+}
+static inline void asm_thumb_ldr_rlo_rlo_rlo(asm_thumb_t *as, uint rlo_dest, uint rlo_base, uint rlo_index) {
+    asm_thumb_format_7_8(as, ASM_THUMB_FORMAT_7_LDR, rlo_dest, rlo_base, rlo_index);
+}
+static inline void asm_thumb_ldrb_rlo_rlo_rlo(asm_thumb_t *as, uint rlo_dest, uint rlo_base, uint rlo_index) {
+    asm_thumb_format_7_8(as, ASM_THUMB_FORMAT_7_LDRB, rlo_dest, rlo_base, rlo_index);
+}
+static inline void asm_thumb_ldrh_rlo_rlo_rlo(asm_thumb_t *as, uint rlo_dest, uint rlo_base, uint rlo_index) {
+    asm_thumb_format_7_8(as, ASM_THUMB_FORMAT_8_LDRH, rlo_dest, rlo_base, rlo_index);
+}
+
 static inline void asm_thumb_lsl_rlo_rlo_i5(asm_thumb_t *as, uint rlo_dest, uint rlo_src, uint shift) {
     asm_thumb_format_1(as, ASM_THUMB_FORMAT_1_LSL, rlo_dest, rlo_src, shift);
 }
@@ -320,6 +361,18 @@ static inline void asm_thumb_sxth_rlo_rlo(asm_thumb_t *as, uint rlo_dest, uint r
 
 // TODO convert these to above format style
 
+// CIRCUITPY-CHANGE: register-offset loads and stores for viper pointers
+// ARMv7-M only: load/store with a register offset shifted left by 0-3
+
+#define ASM_THUMB_OP_STR_W_REG (0xf840)
+#define ASM_THUMB_OP_STRH_W_REG (0xf820)
+#define ASM_THUMB_OP_LDR_W_REG (0xf850)
+#define ASM_THUMB_OP_LDRH_W_REG (0xf830)
+
+static inline void asm_thumb_load_store_reg_reg_reg_lsl(asm_thumb_t *as, uint op, uint reg_dest, uint reg_base, uint reg_index, uint shift) {
+    asm_thumb_op32(as, op | reg_base, (reg_dest << 12) | (shift << 4) | reg_index);
+}
+
 #define ASM_THUMB_OP_MOVW (0xf240)
 #define ASM_THUMB_OP_MOVT (0xf2c0)
 
@@ -71,6 +71,16 @@ MP_DECLARE_CONST_FUN_OBJ_KW(mp_builtin_open_obj);
 mp_obj_t mp_builtin___import__(size_t n_args, const mp_obj_t *args);
 mp_obj_t mp_builtin___import___default(size_t n_args, const mp_obj_t *args);
 
+// CIRCUITPY-CHANGE
+// Drop the directory listings that import keeps to rule out missing modules.
+// Must be called on every change to the filesystem.
+#if MICROPY_MODULE_IMPORT_DIR_CACHE
+void mp_import_dir_cache_invalidate(void);
+#else
+static inline void mp_import_dir_cache_invalidate(void) {
+}
+#endif
+
 mp_obj_t mp_micropython_mem_info(size_t n_args, const mp_obj_t *args);
 
 MP_DECLARE_CONST_FUN_OBJ_VAR(mp_builtin___build_class___obj);
@@ -39,6 +39,18 @@
 #include "py/builtin.h"
 #include "py/frozenmod.h"
 
+// CIRCUITPY-CHANGE
+#if MICROPY_MODULE_COMPILE_CACHE
+#include "genhdr/mpversion.h"
+#include "py/stream.h"
+#include "extmod/vfs.h"
+#endif
+
+#if MICROPY_MODULE_IMPORT_DIR_CACHE
+#include "py/mperrno.h"
+#include "extmod/vfs.h"
+#endif
+
 #if MICROPY_DEBUG_VERBOSE // print debugging info
 #define DEBUG_PRINT (1)
 #define DEBUG_printf DEBUG_printf
@@ -71,25 +83,37 @@ STATIC mp_import_stat_t stat_path(const char *path) {
     return mp_import_stat(path);
 }
 
+// CIRCUITPY-CHANGE: the forms a module may take in a directory. Forms known
+// to be absent (see import_dir_cache_lookup) are not stat'ed.
+#define IMPORT_KIND_DIR (1)
+#define IMPORT_KIND_PY (2)
+#define IMPORT_KIND_MPY (4)
+#define IMPORT_KIND_ANY (IMPORT_KIND_DIR | IMPORT_KIND_PY | IMPORT_KIND_MPY)
+
 // Stat a given filesystem path to a .py file. If the file does not exist,
 // then attempt to stat the corresponding .mpy file, and update the path
 // argument. This is the logic that makes .py files take precedent over .mpy
 // files. This uses stat_path above, rather than mp_import_stat directly, so
 // that the .frozen path prefix is handled.
-STATIC mp_import_stat_t stat_file_py_or_mpy(vstr_t *path) {
-    mp_import_stat_t stat = stat_path(vstr_null_terminated_str(path));
-    if (stat == MP_IMPORT_STAT_FILE) {
-        return stat;
+STATIC mp_import_stat_t stat_file_py_or_mpy(vstr_t *path, uint8_t kinds) {
+    mp_import_stat_t stat;
+    if (kinds & IMPORT_KIND_PY) {
+        stat = stat_path(vstr_null_terminated_str(path));
+        if (stat == MP_IMPORT_STAT_FILE) {
+            return stat;
+        }
     }
 
     #if MICROPY_PERSISTENT_CODE_LOAD
     // Didn't find .py -- try the .mpy instead by inserting an 'm' into the '.py'.
     // Note: There's no point doing this if it's a frozen path, but adding the check
     // would be extra code, and no harm letting mp_find_frozen_module fail instead.
-    vstr_ins_byte(path, path->len - 2, 'm');
-    stat = stat_path(vstr_null_terminated_str(path));
-    if (stat == MP_IMPORT_STAT_FILE) {
-        return stat;
+    if (kinds & IMPORT_KIND_MPY) {
+        vstr_ins_byte(path, path->len - 2, 'm');
+        stat = stat_path(vstr_null_terminated_str(path));
+        if (stat == MP_IMPORT_STAT_FILE) {
+            return stat;
+        }
     }
     #endif
 
@@ -100,17 +124,140 @@ STATIC mp_import_stat_t stat_file_py_or_mpy(vstr_t *path) {
 // or "foo/bar.(m)py" in either the filesystem or frozen modules. If the
 // result is a file, the path argument will be updated to include the file
 // extension.
-STATIC mp_import_stat_t stat_module(vstr_t *path) {
-    mp_import_stat_t stat = stat_path(vstr_null_terminated_str(path));
-    DEBUG_printf("stat %s: %d\n", vstr_str(path), stat);
-    if (stat == MP_IMPORT_STAT_DIR) {
-        return stat;
+STATIC mp_import_stat_t stat_module(vstr_t *path, uint8_t kinds) {
+    if (kinds & IMPORT_KIND_DIR) {
+        mp_import_stat_t stat = stat_path(vstr_null_terminated_str(path));
+        DEBUG_printf("stat %s: %d\n", vstr_str(path), stat);
+        if (stat == MP_IMPORT_STAT_DIR) {
+            return stat;
+        }
     }
 
     // Not a directory, add .py and try as a file.
     vstr_add_str(path, ".py");
-    return stat_file_py_or_mpy(path);
+    return stat_file_py_or_mpy(path, kinds);
+}
+
+// CIRCUITPY-CHANGE
+#if MICROPY_MODULE_IMPORT_DIR_CACHE
+// Listings of the directories that imports search, so that a module missing
+// from a directory is ruled out without any stat calls. The cache maps each
+// directory path, as given in sys.path or __path__, to a dict of lower-cased
+// module names and the IMPORT_KIND_* forms they are present in, or to None if
+// the directory could not be listed. Names are lower-cased because FAT
+// matches them without regard to case; a name that is present is still
+// stat'ed, so case-sensitive filesystems behave as before.
+
+void mp_import_dir_cache_invalidate(void) {
+    MP_STATE_VM(import_dir_cache) = MP_OBJ_NULL;
+}
+
+// Return a lower-cased copy of the given module or file name.
+STATIC mp_obj_t import_dir_cache_name(const char *name, size_t len) {
+    vstr_t vstr;
+    vstr_init_len(&vstr, len);
+    for (size_t i = 0; i < len; i++) {
+        vstr.buf[i] = unichar_tolower((byte)name[i]);
+    }
+    return mp_obj_new_str_from_vstr(&vstr);
+}
+
+STATIC void import_dir_cache_add(mp_obj_t listing, const char *name, size_t len, uint8_t kind) {
+    mp_obj_t key = import_dir_cache_name(name, len);
+    mp_map_elem_t *elem = mp_map_lookup(mp_obj_dict_get_map(listing), key, MP_MAP_LOOKUP_ADD_IF_NOT_FOUND);
+    mp_int_t kinds = elem->value == MP_OBJ_NULL ? 0 : MP_OBJ_SMALL_INT_VALUE(elem->value);
+    elem->value = MP_OBJ_NEW_SMALL_INT(kinds | kind);
+}
+
+STATIC mp_obj_t import_dir_cache_list(mp_obj_t dir, size_t dir_len) {
+    mp_obj_t listing = mp_obj_new_dict(0);
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        // An empty entry is the current directory.
+        mp_obj_t iter = mp_vfs_ilistdir(dir_len == 0 ? 0 : 1, &dir);
+        mp_obj_t next;
+        while ((next = mp_iternext(iter)) != MP_OBJ_STOP_ITERATION) {
+            size_t n_items;
+            mp_obj_t *items;
+            mp_obj_get_array(next, &n_items, &items);
+            if (n_items < 2) {
+                continue;
+            }
+            size_t len;
+            const char *name = mp_obj_str_get_data(items[0], &len);
+            mp_int_t type = mp_obj_get_int(items[1]);
+            // Some filesystems don't report the type, so then allow for either.
+            if (type != MP_S_IFREG) {
+                import_dir_cache_add(listing, name, len, IMPORT_KIND_DIR);
+            }
+            if (type != MP_S_IFDIR) {
+                if (len > 3 && !memcmp(name + len - 3, ".py", 3)) {
+                    import_dir_cache_add(listing, name, len - 3, IMPORT_KIND_PY);
+                } else if (len > 4 && !memcmp(name + len - 4, ".mpy", 4)) {
+                    import_dir_cache_add(listing, name, len - 4, IMPORT_KIND_MPY);
+                }
+            }
+        }
+        nlr_pop();
+    } else {
+        mp_obj_t exc = MP_OBJ_FROM_PTR(nlr.ret_val);
+        // Pass on KeyboardInterrupt and the like.
+        if (!mp_obj_exception_match(exc, MP_OBJ_FROM_PTR(&mp_type_Exception))) {
+            nlr_jump(nlr.ret_val);
+        }
+        // A directory that doesn't exist holds no modules. Other errors,
+        // including a filesystem without ilistdir, leave the directory to be
+        // searched as if there were no cache.
+        if (!mp_obj_exception_match(exc, MP_OBJ_FROM_PTR(&mp_type_OSError))
+            || !mp_obj_equal(mp_obj_exception_get_value(exc), MP_OBJ_NEW_SMALL_INT(MP_ENOENT))) {
+            listing = mp_const_none;
+        }
+    }
+    return listing;
+}
+
+// Return the IMPORT_KIND_* forms in which mod_name may be present in dir.
+STATIC uint8_t import_dir_cache_lookup(mp_obj_t dir, qstr mod_name) {
+    size_t dir_len;
+    const char *dir_str = mp_obj_str_get_data(dir, &dir_len);
+    #if MICROPY_MODULE_FROZEN
+    // Frozen modules are already looked up without touching the filesystem.
+    const size_t frozen_dir_len = strlen(MP_FROZEN_PATH_PREFIX) - 1;
+    if (dir_len >= frozen_dir_len && !memcmp(dir_str, MP_FROZEN_PATH_PREFIX, frozen_dir_len)) {
+        return IMPORT_KIND_ANY;
+    }
+    #else
+    (void)dir_str;
+    #endif
+
+    if (MP_STATE_VM(import_dir_cache) == MP_OBJ_NULL) {
+        MP_STATE_VM(import_dir_cache) = mp_obj_new_dict(0);
+    }
+    mp_map_t *cache = mp_obj_dict_get_map(MP_STATE_VM(import_dir_cache));
+    mp_map_elem_t *elem = mp_map_lookup(cache, dir, MP_MAP_LOOKUP);
+    mp_obj_t listing;
+    if (elem != NULL) {
+        listing = elem->value;
+    } else {
+        listing = import_dir_cache_list(dir, dir_len);
+        // Listing the directory may have invalidated the cache, for example
+        // if a filesystem's ilistdir writes. Only keep it if still valid.
+        if (MP_STATE_VM(import_dir_cache) != MP_OBJ_NULL) {
+            mp_obj_dict_store(MP_STATE_VM(import_dir_cache), dir, listing);
+        }
+    }
+    if (listing == mp_const_none) {
+        return IMPORT_KIND_ANY;
+    }
+
+    size_t len;
+    const char *name = (const char *)qstr_data(mod_name, &len);
+    elem = mp_map_lookup(mp_obj_dict_get_map(listing), import_dir_cache_name(name, len), MP_MAP_LOOKUP);
+    return elem == NULL ? 0 : MP_OBJ_SMALL_INT_VALUE(elem->value);
 }
+#else
+#define import_dir_cache_lookup(dir, mod_name) (IMPORT_KIND_ANY)
+#endif
 
 // Given a top-level module name, try and find it in each of the sys.path
 // entries. Note: On success, the dest argument will be updated to the matching
@@ -133,7 +280,12 @@ STATIC mp_import_stat_t stat_top_level(qstr mod_name, vstr_t *dest) {
             vstr_add_char(dest, PATH_SEP_CHAR[0]);
         }
         vstr_add_str(dest, qstr_str(mod_name));
-        mp_import_stat_t stat = stat_module(dest);
+        // CIRCUITPY-CHANGE: skip entries known not to hold the module.
+        uint8_t kinds = import_dir_cache_lookup(path_items[i], mod_name);
+        if (kinds == 0) {
+            continue;
+        }
+        mp_import_stat_t stat = stat_module(dest, kinds);
         if (stat != MP_IMPORT_STAT_NO_EXIST) {
             return stat;
         }
@@ -147,7 +299,7 @@ STATIC mp_import_stat_t stat_top_level(qstr mod_name, vstr_t *dest) {
 
     // mp_sys_path is not enabled, so just stat the given path directly.
     vstr_add_str(dest, qstr_str(mod_name));
-    return stat_module(dest);
+    return stat_module(dest, IMPORT_KIND_ANY);
 
     #endif
 }
@@ -165,6 +317,155 @@ STATIC void do_load_from_lexer(mp_module_context_t *context, mp_lexer_t *lex) {
 }
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_MODULE_COMPILE_CACHE
+// The compiled code for a .py file is kept in MICROPY_MODULE_COMPILE_CACHE_DIR
+// as <hash of path>.mpy. It starts with a key identifying the firmware and the
+// size and a hash of the contents of the source, followed by the source path,
+// so a cache file for a different build, an edited source or a colliding path
+// is ignored and replaced. The contents are hashed rather than trusting the
+// mtime, which doesn't change on boards without a clock and is only kept to
+// 2 seconds by FAT.
+
+#define COMPILE_CACHE_KEY_LEN (12)
+
+// FNV-1a
+#define COMPILE_CACHE_HASH_INIT (2166136261u)
+
+STATIC uint32_t compile_cache_hash_byte(uint32_t hash, byte b) {
+    return (hash ^ b) * 16777619u;
+}
+
+STATIC uint32_t compile_cache_hash(const char *str) {
+    uint32_t hash = COMPILE_CACHE_HASH_INIT;
+    for (; *str != '\0'; str++) {
+        hash = compile_cache_hash_byte(hash, *str);
+    }
+    return hash;
+}
+
+STATIC void compile_cache_put_uint32(byte *buf, uint32_t val) {
+    for (size_t i = 0; i < 4; i++) {
+        buf[i] = val >> (8 * i);
+    }
+}
+
+STATIC bool compile_cache_exception_is(void *exc, const mp_obj_type_t *type) {
+    return mp_obj_is_subclass_fast(MP_OBJ_FROM_PTR(((mp_obj_base_t *)exc)->type), MP_OBJ_FROM_PTR(type));
+}
+
+// Compute the key for the source file and the path of its cache file. Returns
+// false if there is nothing to cache into, i.e. the cache directory doesn't exist.
+STATIC bool compile_cache_prepare(const char *file_str, byte *key, vstr_t *cache_path) {
+    if (mp_import_stat(MICROPY_MODULE_COMPILE_CACHE_DIR) != MP_IMPORT_STAT_DIR) {
+        return false;
+    }
+    uint32_t size = 0;
+    uint32_t hash = COMPILE_CACHE_HASH_INIT;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_reader_t reader;
+        mp_reader_new_file(&reader, file_str);
+        for (;;) {
+            mp_uint_t c = reader.readbyte(reader.data);
+            if (c == MP_READER_EOF) {
+                break;
+            }
+            hash = compile_cache_hash_byte(hash, c);
+            size++;
+        }
+        reader.close(reader.data);
+        nlr_pop();
+    } else {
+        if (!compile_cache_exception_is(nlr.ret_val, &mp_type_OSError)) {
+            nlr_jump(nlr.ret_val);
+        }
+        return false;
+    }
+    compile_cache_put_uint32(key, compile_cache_hash(MICROPY_GIT_HASH));
+    compile_cache_put_uint32(key + 4, size);
+    compile_cache_put_uint32(key + 8, hash);
+    vstr_printf(cache_path, "%s/%08x.mpy", MICROPY_MODULE_COMPILE_CACHE_DIR, (unsigned int)compile_cache_hash(file_str));
+    return true;
+}
+
+// Load the cached code for file_str into cm. Returns false if there is no
+// usable cache file, in which case the source must be compiled.
+STATIC bool compile_cache_load(const char *cache_path, const byte *key, const char *file_str, mp_compiled_module_t *cm) {
+    if (mp_import_stat(cache_path) != MP_IMPORT_STAT_FILE) {
+        return false;
+    }
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_reader_t reader;
+        mp_reader_new_file(&reader, cache_path);
+        bool match = true;
+        for (size_t i = 0; i < COMPILE_CACHE_KEY_LEN; i++) {
+            if (reader.readbyte(reader.data) != key[i]) {
+                match = false;
+            }
+        }
+        for (const char *c = file_str; match; c++) {
+            if (reader.readbyte(reader.data) != (byte)*c) {
+                match = false;
+            }
+            if (*c == '\0') {
+                break;
+            }
+        }
+        if (match) {
+            // This closes the reader.
+            mp_raw_code_load(&reader, cm);
+        } else {
+            reader.close(reader.data);
+        }
+        nlr_pop();
+        return match;
+    } else {
+        // An unreadable or incompatible cache file is replaced like a stale one.
+        if (!compile_cache_exception_is(nlr.ret_val, &mp_type_OSError)
+            && !compile_cache_exception_is(nlr.ret_val, &mp_type_ValueError)) {
+            nlr_jump(nlr.ret_val);
+        }
+        return false;
+    }
+}
+
+// Save the compiled code for file_str. Failing to write is not an error: the
+// filesystem is read-only to Python while USB has it, for example.
+STATIC void compile_cache_store(const char *cache_path, const byte *key, const char *file_str, mp_compiled_module_t *cm) {
+    // Write to a temporary file first so an interrupted write never leaves a
+    // truncated cache file with a valid key.
+    vstr_t tmp_path;
+    vstr_init(&tmp_path, strlen(cache_path) + 5);
+    vstr_add_str(&tmp_path, cache_path);
+    vstr_add_str(&tmp_path, ".tmp");
+    mp_obj_t tmp_path_obj = mp_obj_new_str_from_vstr(&tmp_path);
+    mp_obj_t cache_path_obj = mp_obj_new_str(cache_path, strlen(cache_path));
+
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_obj_t args[2] = { tmp_path_obj, MP_OBJ_NEW_QSTR(MP_QSTR_wb) };
+        mp_obj_t file = mp_vfs_open(MP_ARRAY_SIZE(args), &args[0], (mp_map_t *)&mp_const_empty_map);
+        mp_stream_write(file, key, COMPILE_CACHE_KEY_LEN, MP_STREAM_RW_WRITE);
+        mp_stream_write(file, file_str, strlen(file_str) + 1, MP_STREAM_RW_WRITE);
+        mp_print_t print = {MP_OBJ_TO_PTR(file), mp_stream_write_adaptor};
+        mp_raw_code_save(cm, &print);
+        mp_stream_close(file);
+        // FAT can't rename onto an existing file.
+        if (mp_import_stat(cache_path) == MP_IMPORT_STAT_FILE) {
+            mp_vfs_remove(cache_path_obj);
+        }
+        mp_vfs_rename(tmp_path_obj, cache_path_obj);
+        nlr_pop();
+    } else {
+        if (!compile_cache_exception_is(nlr.ret_val, &mp_type_OSError)) {
+            nlr_jump(nlr.ret_val);
+        }
+    }
+}
+#endif
+
 #if (MICROPY_HAS_FILE_READER && MICROPY_PERSISTENT_CODE_LOAD) || MICROPY_MODULE_FROZEN_MPY
 STATIC void do_execute_raw_code(const mp_module_context_t *context, const mp_raw_code_t *rc, const char *source_name) {
     (void)source_name;
@@ -246,6 +547,33 @@ STATIC void do_load(mp_module_context_t *module_obj, vstr_t *file) {
     }
     #endif
 
+    // CIRCUITPY-CHANGE
+    // Use the cached compiled code for the file if it is current, otherwise
+    // compile the file and try to update the cache.
+    #if MICROPY_MODULE_COMPILE_CACHE
+    {
+        byte key[COMPILE_CACHE_KEY_LEN];
+        vstr_t cache_path;
+        vstr_init(&cache_path, sizeof(MICROPY_MODULE_COMPILE_CACHE_DIR) + 13);
+        if (compile_cache_prepare(file_str, key, &cache_path)) {
+            const char *cache_path_str = vstr_null_terminated_str(&cache_path);
+            mp_compiled_module_t cm;
+            cm.context = module_obj;
+            if (!compile_cache_load(cache_path_str, key, file_str, &cm)) {
+                mp_lexer_t *lex = mp_lexer_new_from_file(file_str);
+                qstr source_name = lex->source_name;
+                mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+                mp_compile_to_raw_code(&parse_tree, source_name, false, &cm);
+                compile_cache_store(cache_path_str, key, file_str, &cm);
+            }
+            vstr_clear(&cache_path);
+            do_execute_raw_code(cm.context, cm.rc, file_str);
+            return;
+        }
+        vstr_clear(&cache_path);
+    }
+    #endif
+
     // If we can compile scripts then load the file and compile and execute it.
     #if MICROPY_ENABLE_COMPILER
     {
@@ -434,7 +762,9 @@ STATIC mp_obj_t process_import_at_level(qstr full_mod_name, qstr level_mod_name,
             vstr_add_char(&path, PATH_SEP_CHAR[0]);
             vstr_add_str(&path, qstr_str(level_mod_name));
 
-            stat = stat_module(&path);
+            // CIRCUITPY-CHANGE: skip the lookup if the package doesn't hold the module.
+            uint8_t kinds = import_dir_cache_lookup(dest[0], level_mod_name);
+            stat = kinds == 0 ? MP_IMPORT_STAT_NO_EXIST : stat_module(&path, kinds);
         }
     }
 
@@ -494,7 +824,7 @@ STATIC mp_obj_t process_import_at_level(qstr full_mod_name, qstr level_mod_name,
         vstr_add_str(&path, PATH_SEP_CHAR "__init__.py");
 
         // execute "path/__init__.py" (if available).
-        if (stat_file_py_or_mpy(&path) == MP_IMPORT_STAT_FILE) {
+        if (stat_file_py_or_mpy(&path, IMPORT_KIND_ANY) == MP_IMPORT_STAT_FILE) {
             do_load(MP_OBJ_TO_PTR(module_obj), &path);
         } else {
             // No-op. Nothing to load.
@@ -661,4 +991,9 @@ mp_obj_t mp_builtin___import___default(size_t n_args, const mp_obj_t *args) {
 
 #endif // MICROPY_ENABLE_EXTERNAL_IMPORT
 
+// CIRCUITPY-CHANGE
+#if MICROPY_ENABLE_EXTERNAL_IMPORT && MICROPY_MODULE_IMPORT_DIR_CACHE
+MP_REGISTER_ROOT_POINTER(mp_obj_t import_dir_cache);
+#endif
+
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(mp_builtin___import___obj, 1, 5, mp_builtin___import__);
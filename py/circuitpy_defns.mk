@@ -128,6 +128,9 @@ endif
 ifeq ($(CIRCUITPY_AUDIOCORE),1)
 SRC_PATTERNS += audiocore/%
 endif
+ifeq ($(CIRCUITPY_AUDIOFILTERS),1)
+SRC_PATTERNS += audiofilters/%
+endif
 ifeq ($(CIRCUITPY_AUDIOMIXER),1)
 SRC_PATTERNS += audiomixer/%
 endif
@@ -469,6 +472,7 @@ SRC_COMMON_HAL_ALL = \
 	dotclockframebuffer/DotClockFramebuffer.c \
 	dotclockframebuffer/__init__.c \
 	dualbank/__init__.c \
+	dualbank/Update.c \
 	frequencyio/FrequencyIn.c \
 	frequencyio/__init__.c \
 	imagecapture/ParallelImageCapture.c \
@@ -592,12 +596,17 @@ SRC_SHARED_MODULE_ALL = \
 	_stage/Layer.c \
 	_stage/Text.c \
 	_stage/__init__.c \
-	aesio/__init__.c \
-	aesio/aes.c \
 	atexit/__init__.c \
+	audiobusio/__init__.c \
 	audiocore/RawSample.c \
+	audiocore/Resampler.c \
 	audiocore/WaveFile.c \
 	audiocore/__init__.c \
+	audiofilters/Compressor.c \
+	audiofilters/Echo.c \
+	audiofilters/Filter.c \
+	audiofilters/SoftClip.c \
+	audiofilters/__init__.c \
 	audioio/__init__.c \
 	audiomixer/Mixer.c \
 	audiomixer/MixerVoice.c \
@@ -662,9 +671,11 @@ SRC_SHARED_MODULE_ALL = \
 	memorymonitor/AllocationSize.c \
 	network/__init__.c \
 	msgpack/__init__.c \
+	msgpack/Unpacker.c \
 	onewireio/__init__.c \
 	onewireio/OneWire.c \
 	os/__init__.c \
+	os/DirEntry.c \
 	paralleldisplaybus/ParallelBus.c \
 	qrio/__init__.c \
 	qrio/QRDecoder.c \
@@ -680,6 +691,7 @@ SRC_SHARED_MODULE_ALL = \
 	socket/__init__.c \
 	storage/__init__.c \
 	struct/__init__.c \
+	struct/Struct.c \
 	supervisor/__init__.c \
 	supervisor/StatusBar.c \
 	synthio/Biquad.c \
@@ -688,6 +700,7 @@ SRC_SHARED_MODULE_ALL = \
 	synthio/MidiTrack.c \
 	synthio/Note.c \
 	synthio/Synthesizer.c \
+	synthio/Wavetable.c \
 	synthio/__init__.c \
 	terminalio/Terminal.c \
 	terminalio/__init__.c \
@@ -706,6 +719,7 @@ SRC_SHARED_MODULE_ALL = \
 	warnings/__init__.c \
 	watchdog/__init__.c \
 	zlib/__init__.c \
+	zlib/Decompress.c \
 
 # All possible sources are listed here, and are filtered by SRC_PATTERNS.
 SRC_SHARED_MODULE = $(filter $(SRC_PATTERNS), $(SRC_SHARED_MODULE_ALL))
@@ -723,6 +737,21 @@ SRC_SHARED_MODULE_ALL += \
 	touchio/__init__.c
 endif
 
+# Ports with an AES engine provide aesio in common-hal rather than using tinyaes.
+ifeq ($(CIRCUITPY_AESIO_TINYAES),1)
+SRC_SHARED_MODULE_ALL += \
+	aesio/__init__.c \
+	aesio/aes.c
+else
+SRC_COMMON_HAL_ALL += \
+	aesio/__init__.c
+endif
+
+ifeq ($(CIRCUITPY_SUPERVISOR_PROFILE),1)
+SRC_SHARED_MODULE_ALL += \
+	supervisor/Profiler.c
+endif
+
 # If supporting _bleio via HCI, make devices/ble_hci/common-hal/_bleio be includable,
 # and use C source files in devices/ble_hci/common-hal.
 ifeq ($(CIRCUITPY_BLEIO_HCI),1)
@@ -809,6 +838,7 @@ SRC_SHARED_MODULE_INTERNAL = \
 $(filter $(SRC_PATTERNS), \
 	displayio/bus_core.c \
 	displayio/display_core.c \
+	displayio/dither.c \
 	os/getenv.c \
 	usb/utf16le.c \
 )
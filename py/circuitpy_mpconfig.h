@@ -93,9 +93,19 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_GC_ALLOC_THRESHOLD       (0)
 #define MICROPY_GC_SPLIT_HEAP            (1)
 #define MICROPY_GC_SPLIT_HEAP_AUTO       (1)
-#define MP_PLAT_ALLOC_HEAP(size) port_malloc(size, false)
-#define MP_PLAT_FREE_HEAP(ptr) port_free(ptr)
+// Allocation statistics for gc.stats() and the web workflow's /cp/gc.json.
+#ifndef MICROPY_GC_STATS
+#define MICROPY_GC_STATS                 (CIRCUITPY_WEB_WORKFLOW)
+#endif
+#define MICROPY_GC_STATS_TICKS_US()      port_get_raw_ticks_us()
+#define MP_PLAT_ALLOC_HEAP(size) port_malloc_tagged(size, false, PORT_HEAP_TAG_VM)
+#define MP_PLAT_FREE_HEAP(ptr) port_free_tagged(ptr, PORT_HEAP_TAG_VM)
 #include "supervisor/port_heap.h"
+#if CIRCUITPY_ENABLE_MPY_NATIVE
+// Native code runs from outside the VM heap, see supervisor/shared/native_code.c.
+#define MP_PLAT_COMMIT_EXEC(buf, len, reloc) supervisor_native_code_commit(buf, len, reloc)
+#include "supervisor/shared/native_code.h"
+#endif
 #define MICROPY_HELPER_LEXER_UNIX        (0)
 #define MICROPY_HELPER_REPL              (1)
 #define MICROPY_KBD_EXCEPTION            (1)
@@ -107,11 +117,23 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_OPT_COMPUTED_GOTO_SAVE_SPACE (CIRCUITPY_COMPUTED_GOTO_SAVE_SPACE)
 #define MICROPY_OPT_LOAD_ATTR_FAST_PATH  (CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
 #define MICROPY_OPT_MAP_LOOKUP_CACHE  (CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
+#define MICROPY_OPT_CLASS_LOOKUP_CACHE (CIRCUITPY_OPT_CLASS_LOOKUP_CACHE)
+#define MICROPY_OPT_LOAD_GLOBAL_CACHE (CIRCUITPY_OPT_LOAD_GLOBAL_CACHE)
+#define MICROPY_OPT_CACHE_EXCEPTION_ARGS (CIRCUITPY_OPT_CACHE_EXCEPTION_ARGS)
+#define MICROPY_OPT_VM_SMALL_INT_FAST_PATH (CIRCUITPY_OPT_VM_SMALL_INT_FAST_PATH)
+#define MICROPY_OPT_MPZ_FAST_MUL         (CIRCUITPY_OPT_MPZ_FAST_MUL)
+#define MICROPY_QSTR_INDEX               (CIRCUITPY_QSTR_INDEX)
+#define MICROPY_MAP_COMPACT              (CIRCUITPY_MAP_COMPACT)
+#define MICROPY_VM_TRACK_CURRENT_CODE_STATE (CIRCUITPY_SUPERVISOR_PROFILE || MICROPY_GC_ALLOC_SITES)
+#define MICROPY_MODULE_COMPILE_CACHE     (CIRCUITPY_MODULE_COMPILE_CACHE)
+#define MICROPY_MODULE_IMPORT_DIR_CACHE  (CIRCUITPY_MODULE_IMPORT_DIR_CACHE)
+#define MICROPY_COMP_STREAMING           (CIRCUITPY_COMP_STREAMING)
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (CIRCUITPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE)
 #define MICROPY_PERSISTENT_CODE_LOAD     (1)
 
 #define MICROPY_PY_ARRAY                 (CIRCUITPY_ARRAY)
 #define MICROPY_PY_ARRAY_SLICE_ASSIGN    (1)
+#define MICROPY_PY_ARRAY_VECTOR_OPS      (CIRCUITPY_ARRAY_VECTOR_OPS)
 #define MICROPY_PY_ATTRTUPLE             (1)
 #define MICROPY_PY_BUILTINS_BYTEARRAY    (1)
 #define MICROPY_PY_BUILTINS_BYTES_HEX    (1)
@@ -130,6 +152,7 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_PY_BUILTINS_SLICE_ATTRS  (1)
 #define MICROPY_PY_BUILTINS_SLICE_INDICES (1)
 #define MICROPY_PY_BUILTINS_STR_UNICODE  (1)
+#define MICROPY_PY_BUILTINS_STR_UNICODE_INDEX (CIRCUITPY_STR_UNICODE_INDEX)
 
 #define MICROPY_PY_BINASCII             (CIRCUITPY_BINASCII)
 #define MICROPY_PY_BINASCII_CRC32       (CIRCUITPY_BINASCII && CIRCUITPY_ZLIB)
@@ -357,9 +380,54 @@ typedef long mp_off_t;
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (128)
 #endif
 
+// Default BusDisplay area buffer size in bytes. Each display may override it.
+#ifndef CIRCUITPY_BUSDISPLAY_AREA_BUFFER_SIZE
+#define CIRCUITPY_BUSDISPLAY_AREA_BUFFER_SIZE (512)
+#endif
+
+// Largest BusDisplay area buffer size in bytes. Each display allocates its own
+// buffer, so this only bounds what a display may ask for.
+#ifndef CIRCUITPY_BUSDISPLAY_AREA_BUFFER_MAX_SIZE
+#define CIRCUITPY_BUSDISPLAY_AREA_BUFFER_MAX_SIZE (4096)
+#endif
+
+// Maximum number of areas a display refreshes after merging dirty areas.
+#ifndef CIRCUITPY_DISPLAY_COALESCED_AREAS
+#define CIRCUITPY_DISPLAY_COALESCED_AREAS (8)
+#endif
+
+// When non-zero, BusDisplay auto refreshes send at most this many milliseconds
+// of pixels per background call and continue in later calls, so that Python
+// keeps running while a large refresh is in progress.
+#ifndef CIRCUITPY_BUSDISPLAY_REFRESH_SLICE_MS
+#define CIRCUITPY_BUSDISPLAY_REFRESH_SLICE_MS (0)
+#endif
+
+// Bytes of file rows each OnDiskBitmap keeps in RAM so that pixels are not
+// read from the filesystem one at a time. At least one row is cached when
+// non-zero. 0 disables the cache.
+#ifndef CIRCUITPY_ONDISKBITMAP_CACHE_SIZE
+#define CIRCUITPY_ONDISKBITMAP_CACHE_SIZE (2048)
+#endif
+
 #else
 #define CIRCUITPY_DISPLAY_LIMIT (0)
 #define CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE (0)
+#define CIRCUITPY_DISPLAY_COALESCED_AREAS (0)
+#endif
+
+// Number of colorspaces each Palette keeps converted colors for. Displays with
+// different colorspaces sharing a Palette each get their own cached values as
+// long as there are no more of them than this. At most 8.
+#ifndef CIRCUITPY_DISPLAYIO_PALETTE_CACHE_COLORSPACES
+#define CIRCUITPY_DISPLAYIO_PALETTE_CACHE_COLORSPACES (2)
+#endif
+
+// Number of separate dirty areas each Bitmap tracks between refreshes. Changes
+// far apart stay in their own areas so sparse updates don't redraw the whole
+// Bitmap. At least 1.
+#ifndef CIRCUITPY_DISPLAYIO_BITMAP_DIRTY_AREAS
+#define CIRCUITPY_DISPLAYIO_BITMAP_DIRTY_AREAS (4)
 #endif
 
 // This is not a top-level module; it's microcontroller.nvm.
@@ -433,6 +501,30 @@ void background_callback_run_all(void);
 #define CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS 1000
 #endif
 
+// Raw ticks (1/1024 s) that background callbacks below realtime priority may
+// use in one pass. Callbacks still queued after that wait for the next pass.
+#ifndef CIRCUITPY_BACKGROUND_CALLBACK_BUDGET_TICKS
+#define CIRCUITPY_BACKGROUND_CALLBACK_BUDGET_TICKS (2)
+#endif
+
+// Number of erase sectors the external flash driver can hold in ram while
+// they are being written. Fewer are used if the ram isn't available.
+#ifndef CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS
+#define CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS (1)
+#endif
+
+// Number of 512 byte blocks USB mass storage writes are gathered into before
+// they are passed to the block device. Contiguous writes are merged and the
+// run is written once the host has been idle for the flush delay. 0 writes
+// each transfer straight through.
+#ifndef CIRCUITPY_USB_MSC_WRITE_BUFFER_BLOCKS
+#define CIRCUITPY_USB_MSC_WRITE_BUFFER_BLOCKS (8)
+#endif
+
+#ifndef CIRCUITPY_USB_MSC_WRITE_FLUSH_DELAY_MS
+#define CIRCUITPY_USB_MSC_WRITE_FLUSH_DELAY_MS (50)
+#endif
+
 #ifndef CIRCUITPY_PYSTACK_SIZE
 #define CIRCUITPY_PYSTACK_SIZE 1536
 #endif
@@ -481,6 +573,39 @@ void background_callback_run_all(void);
 #define CIRCUITPY_REPL_LOGO (1)
 #endif
 
+// Bytes of console output held for the display terminal and drawn from the
+// background. 0 draws each write as it happens.
+#ifndef CIRCUITPY_TERMINAL_OUTPUT_BUFFER_SIZE
+#define CIRCUITPY_TERMINAL_OUTPUT_BUFFER_SIZE (CIRCUITPY_FULL_BUILD ? 1024 : 0)
+#endif
+
+// Status bar changes noticed in the background are sent at most this often.
+// Direct updates, such as when code.py starts, are always sent straight away.
+#ifndef CIRCUITPY_STATUS_BAR_MIN_INTERVAL_MS
+#define CIRCUITPY_STATUS_BAR_MIN_INTERVAL_MS (250)
+#endif
+
+// audiocore.WaveFile reads ahead of playback from the background into this many
+// buffers of CIRCUITPY_AUDIOCORE_WAVEFILE_BUFFER_SIZE bytes each, unless it is
+// given a buffer.
+#ifndef CIRCUITPY_AUDIOCORE_WAVEFILE_READ_AHEAD
+#define CIRCUITPY_AUDIOCORE_WAVEFILE_READ_AHEAD (1)
+#endif
+
+#ifndef CIRCUITPY_AUDIOCORE_WAVEFILE_BUFFER_COUNT
+#define CIRCUITPY_AUDIOCORE_WAVEFILE_BUFFER_COUNT (CIRCUITPY_FULL_BUILD ? 4 : 2)
+#endif
+
+#ifndef CIRCUITPY_AUDIOCORE_WAVEFILE_BUFFER_SIZE
+#define CIRCUITPY_AUDIOCORE_WAVEFILE_BUFFER_SIZE (CIRCUITPY_FULL_BUILD ? 512 : 256)
+#endif
+
+// audiomp3.MP3Decoder decodes buffer sources on a second core while they play.
+// The port provides the worker; see shared-module/audiomp3/MP3Decoder.h.
+#ifndef CIRCUITPY_AUDIOMP3_MULTICORE
+#define CIRCUITPY_AUDIOMP3_MULTICORE (0)
+#endif
+
 // USB settings
 
 // Debug level for TinyUSB. Only outputs over debug UART so it doesn't cause
@@ -497,6 +622,12 @@ void background_callback_run_all(void);
 #define CIRCUITPY_USB_HOST_INSTANCE -1
 #endif
 
+// Bytes buffered behind the TinyUSB FIFO for writes to usb_cdc.data, so that large
+// writes can return before they are sent. 0 writes straight to the FIFO.
+#ifndef CIRCUITPY_USB_CDC_DATA_TX_BUFFER_SIZE
+#define CIRCUITPY_USB_CDC_DATA_TX_BUFFER_SIZE (CIRCUITPY_FULL_BUILD ? 2048 : 0)
+#endif
+
 // If the port requires certain USB endpoint numbers, define these in mpconfigport.h.
 
 #ifndef USB_CDC_EP_NUM_NOTIFICATION
@@ -549,6 +680,17 @@ void background_callback_run_all(void);
 #error "CIRCUITPY_USB_HID_MAX_REPORT_IDS_PER_DESCRIPTOR must be at least 1"
 #endif
 
+// Bytes of storage for HID IN reports sent with send_report(block=False) until the endpoint
+// is free. Each report takes two bytes more than its length.
+#ifndef CIRCUITPY_USB_HID_REPORT_QUEUE_SIZE
+#define CIRCUITPY_USB_HID_REPORT_QUEUE_SIZE (256)
+#endif
+
+// Number of messages that usb_midi.PortOut.write_messages() can hold until they are due.
+#ifndef CIRCUITPY_USB_MIDI_SCHEDULE_LENGTH
+#define CIRCUITPY_USB_MIDI_SCHEDULE_LENGTH (32)
+#endif
+
 #ifndef USB_MIDI_EP_NUM_OUT
 #define USB_MIDI_EP_NUM_OUT (0)
 #endif
@@ -593,6 +735,11 @@ void background_callback_run_all(void);
 #define CIRCUITPY_DIGITALIO_HAVE_INVALID_DRIVE_MODE (0)
 #endif
 
+// Deepest nesting of arrays and maps that msgpack.Unpacker can resume inside.
+#ifndef CIRCUITPY_MSGPACK_UNPACKER_MAX_DEPTH
+#define CIRCUITPY_MSGPACK_UNPACKER_MAX_DEPTH (16)
+#endif
+
 // Align the internal sector buffer. Useful when it is passed into TinyUSB for
 // loads.
 #ifndef MICROPY_FATFS_WINDOW_ALIGNMENT
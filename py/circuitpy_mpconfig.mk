@@ -90,11 +90,22 @@ CFLAGS += -DMICROPY_PY_SELECT_SELECT=$(MICROPY_PY_SELECT_SELECT)
 CIRCUITPY_AESIO ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_AESIO=$(CIRCUITPY_AESIO)
 
+# Use the software AES in shared-module. Ports with an AES engine can set this to 0
+# and provide common-hal/aesio instead.
+CIRCUITPY_AESIO_TINYAES ?= $(CIRCUITPY_AESIO)
+CFLAGS += -DCIRCUITPY_AESIO_TINYAES=$(CIRCUITPY_AESIO_TINYAES)
+
 # TODO: CIRCUITPY_ALARM will gradually be added to as many ports as possible
 # so make this 1 or CIRCUITPY_FULL_BUILD eventually
 CIRCUITPY_ALARM ?= 0
 CFLAGS += -DCIRCUITPY_ALARM=$(CIRCUITPY_ALARM)
 
+# Don't start USB when waking from a true deep sleep, unless code.py then stays awake.
+# Ports that sense VBUS still start it when a host may be attached. Others skip it on
+# every such wake, so boards opt in.
+CIRCUITPY_ALARM_FAST_RESUME ?= 0
+CFLAGS += -DCIRCUITPY_ALARM_FAST_RESUME=$(CIRCUITPY_ALARM_FAST_RESUME)
+
 CIRCUITPY_ANALOGBUFIO ?= 0
 CFLAGS += -DCIRCUITPY_ANALOGBUFIO=$(CIRCUITPY_ANALOGBUFIO)
 
@@ -104,6 +115,10 @@ CFLAGS += -DCIRCUITPY_ANALOGIO=$(CIRCUITPY_ANALOGIO)
 CIRCUITPY_ARRAY ?= 1
 CFLAGS += -DCIRCUITPY_ARRAY=$(CIRCUITPY_ARRAY)
 
+# Elementwise arithmetic on arrays, for full builds that don't have ulab.
+CIRCUITPY_ARRAY_VECTOR_OPS ?= $(call enable-if-all,$(CIRCUITPY_ARRAY) $(CIRCUITPY_FULL_BUILD) $(call enable-if-not,$(CIRCUITPY_ULAB)))
+CFLAGS += -DCIRCUITPY_ARRAY_VECTOR_OPS=$(CIRCUITPY_ARRAY_VECTOR_OPS)
+
 CIRCUITPY_ATEXIT ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_ATEXIT=$(CIRCUITPY_ATEXIT)
 
@@ -130,6 +145,10 @@ CFLAGS += -DCIRCUITPY_AUDIOCORE=$(CIRCUITPY_AUDIOCORE)
 CIRCUITPY_AUDIOMIXER ?= $(CIRCUITPY_AUDIOCORE)
 CFLAGS += -DCIRCUITPY_AUDIOMIXER=$(CIRCUITPY_AUDIOMIXER)
 
+# audiofilters.Filter takes its coefficients from synthio.
+CIRCUITPY_AUDIOFILTERS ?= $(call enable-if-all,$(CIRCUITPY_FULL_BUILD) $(CIRCUITPY_SYNTHIO))
+CFLAGS += -DCIRCUITPY_AUDIOFILTERS=$(CIRCUITPY_AUDIOFILTERS)
+
 ifndef CIRCUITPY_AUDIOCORE_DEBUG
 CIRCUITPY_AUDIOCORE_DEBUG ?= 0
 endif
@@ -182,6 +201,10 @@ CFLAGS += -DCIRCUITPY_BUSIO_SPI=$(CIRCUITPY_BUSIO_SPI)
 CIRCUITPY_BUSIO_UART ?= 1
 CFLAGS += -DCIRCUITPY_BUSIO_UART=$(CIRCUITPY_BUSIO_UART)
 
+# busio.I2C transfers that run in the background
+CIRCUITPY_BUSIO_I2C_ASYNC ?= 0
+CFLAGS += -DCIRCUITPY_BUSIO_I2C_ASYNC=$(CIRCUITPY_BUSIO_I2C_ASYNC)
+
 CIRCUITPY_CAMERA ?= 0
 CFLAGS += -DCIRCUITPY_CAMERA=$(CIRCUITPY_CAMERA)
 
@@ -367,6 +390,10 @@ CFLAGS += -DCIRCUITPY_MSGPACK=$(CIRCUITPY_MSGPACK)
 CIRCUITPY_NEOPIXEL_WRITE ?= 1
 CFLAGS += -DCIRCUITPY_NEOPIXEL_WRITE=$(CIRCUITPY_NEOPIXEL_WRITE)
 
+# Send to several strands at once, and in the background
+CIRCUITPY_NEOPIXEL_WRITE_PARALLEL ?= 0
+CFLAGS += -DCIRCUITPY_NEOPIXEL_WRITE_PARALLEL=$(CIRCUITPY_NEOPIXEL_WRITE_PARALLEL)
+
 CIRCUITPY_NVM ?= 1
 CFLAGS += -DCIRCUITPY_NVM=$(CIRCUITPY_NVM)
 
@@ -379,6 +406,47 @@ CFLAGS += -DCIRCUITPY_OPT_LOAD_ATTR_FAST_PATH=$(CIRCUITPY_OPT_LOAD_ATTR_FAST_PAT
 CIRCUITPY_OPT_MAP_LOOKUP_CACHE ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_OPT_MAP_LOOKUP_CACHE=$(CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
 
+CIRCUITPY_OPT_CLASS_LOOKUP_CACHE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_CLASS_LOOKUP_CACHE=$(CIRCUITPY_OPT_CLASS_LOOKUP_CACHE)
+
+CIRCUITPY_OPT_LOAD_GLOBAL_CACHE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_LOAD_GLOBAL_CACHE=$(CIRCUITPY_OPT_LOAD_GLOBAL_CACHE)
+
+CIRCUITPY_OPT_CACHE_EXCEPTION_ARGS ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_CACHE_EXCEPTION_ARGS=$(CIRCUITPY_OPT_CACHE_EXCEPTION_ARGS)
+
+CIRCUITPY_OPT_VM_SMALL_INT_FAST_PATH ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_VM_SMALL_INT_FAST_PATH=$(CIRCUITPY_OPT_VM_SMALL_INT_FAST_PATH)
+
+CIRCUITPY_OPT_MPZ_FAST_MUL ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_MPZ_FAST_MUL=$(CIRCUITPY_OPT_MPZ_FAST_MUL)
+
+CIRCUITPY_QSTR_INDEX ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_QSTR_INDEX=$(CIRCUITPY_QSTR_INDEX)
+
+CIRCUITPY_MAP_COMPACT ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_MAP_COMPACT=$(CIRCUITPY_MAP_COMPACT)
+
+# Keep compiled .py modules as .mpy files in /.mpycache, if that directory exists.
+# Off by default: it needs persistent code save support, which adds RAM to every function.
+CIRCUITPY_MODULE_COMPILE_CACHE ?= 0
+CFLAGS += -DCIRCUITPY_MODULE_COMPILE_CACHE=$(CIRCUITPY_MODULE_COMPILE_CACHE)
+
+# Keep a listing of each directory searched by import, so that missing modules
+# are ruled out without stat'ing every sys.path entry.
+CIRCUITPY_MODULE_IMPORT_DIR_CACHE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_MODULE_IMPORT_DIR_CACHE=$(CIRCUITPY_MODULE_IMPORT_DIR_CACHE)
+
+# Index the characters of the last long non-ASCII str indexed, so loops over
+# its characters don't rescan it from the start.
+CIRCUITPY_STR_UNICODE_INDEX ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_STR_UNICODE_INDEX=$(CIRCUITPY_STR_UNICODE_INDEX)
+
+# Compile imported modules and code.py a group of top-level statements at a time,
+# so large files don't need their whole parse tree in memory.
+CIRCUITPY_COMP_STREAMING ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_COMP_STREAMING=$(CIRCUITPY_COMP_STREAMING)
+
 CIRCUITPY_OS ?= 1
 CFLAGS += -DCIRCUITPY_OS=$(CIRCUITPY_OS)
 
@@ -501,12 +569,45 @@ CFLAGS += -DCIRCUITPY_STRUCT=$(CIRCUITPY_STRUCT)
 CIRCUITPY_SUPERVISOR ?= 1
 CFLAGS += -DCIRCUITPY_SUPERVISOR=$(CIRCUITPY_SUPERVISOR)
 
+# Lower the CPU clock while the VM idles, when settings.toml sets
+# CIRCUITPY_CPU_GOVERNOR. Ports provide port_cpu_governor_levels() and
+# port_cpu_governor_set_frequency().
+CIRCUITPY_CPU_GOVERNOR ?= 0
+CFLAGS += -DCIRCUITPY_CPU_GOVERNOR=$(CIRCUITPY_CPU_GOVERNOR)
+
+# Let tick users that only need occasional wakeups, such as keypad, ask for a
+# supervisor_tick() at a deadline instead of enabling the 1ms tick. Ports that
+# set this call supervisor_tick_deadline_interrupt() from the interrupt for
+# port_interrupt_after_ticks().
+CIRCUITPY_TICKLESS ?= 0
+CFLAGS += -DCIRCUITPY_TICKLESS=$(CIRCUITPY_TICKLESS)
+
+# supervisor.boot_timeline(): timestamps of fixed points in startup.
+CIRCUITPY_SUPERVISOR_BOOT_TIMELINE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_SUPERVISOR_BOOT_TIMELINE=$(CIRCUITPY_SUPERVISOR_BOOT_TIMELINE)
+
+# supervisor.memory_stats(): outer heap bytes held by each subsystem.
+CIRCUITPY_SUPERVISOR_MEMORY_STATS ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_SUPERVISOR_MEMORY_STATS=$(CIRCUITPY_SUPERVISOR_MEMORY_STATS)
+
+# Also print the boot timeline to the serial console before the first code.py run.
+CIRCUITPY_SUPERVISOR_BOOT_TIMELINE_PRINT ?= 0
+CFLAGS += -DCIRCUITPY_SUPERVISOR_BOOT_TIMELINE_PRINT=$(CIRCUITPY_SUPERVISOR_BOOT_TIMELINE_PRINT)
+
+# supervisor.profile sampling profiler. Makes the VM track the current frame.
+CIRCUITPY_SUPERVISOR_PROFILE ?= 0
+CFLAGS += -DCIRCUITPY_SUPERVISOR_PROFILE=$(CIRCUITPY_SUPERVISOR_PROFILE)
+
 CIRCUITPY_SYNTHIO ?= $(CIRCUITPY_AUDIOCORE)
 CFLAGS += -DCIRCUITPY_SYNTHIO=$(CIRCUITPY_SYNTHIO)
 
 CIRCUITPY_SYNTHIO_MAX_CHANNELS ?= 2
 CFLAGS += -DCIRCUITPY_SYNTHIO_MAX_CHANNELS=$(CIRCUITPY_SYNTHIO_MAX_CHANNELS)
 
+# Changes that synthio.Synthesizer.schedule() can hold at once
+CIRCUITPY_SYNTHIO_MAX_EVENTS ?= 32
+CFLAGS += -DCIRCUITPY_SYNTHIO_MAX_EVENTS=$(CIRCUITPY_SYNTHIO_MAX_EVENTS)
+
 
 CIRCUITPY_SYS ?= 1
 CFLAGS += -DCIRCUITPY_SYS=$(CIRCUITPY_SYS)
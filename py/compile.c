@@ -165,6 +165,8 @@ STATIC const emit_inline_asm_method_table_t *emit_asm_table[] = {
 // elements in this struct are ordered to make it compact
 typedef struct _compiler_t {
     uint8_t is_repl;
+    // CIRCUITPY-CHANGE: set for the later groups of statements of a streamed file
+    uint8_t is_continuation;
     uint8_t pass; // holds enum type pass_kind_t
     uint8_t have_star;
 
@@ -3049,7 +3051,8 @@ STATIC bool compile_scope(compiler_t *comp, scope_t *scope, pass_kind_t pass) {
         compile_node(comp, pns->nodes[0]); // compile the expression
         EMIT(return_value);
     } else if (scope->kind == SCOPE_MODULE) {
-        if (!comp->is_repl) {
+        // CIRCUITPY-CHANGE: only the start of a file can be a doc string
+        if (!comp->is_repl && !comp->is_continuation) {
             check_for_doc_string(comp, scope->pn);
         }
         compile_node(comp, scope->pn);
@@ -3460,18 +3463,19 @@ STATIC void scope_compute_things(scope_t *scope) {
     }
 }
 
-#if !MICROPY_PERSISTENT_CODE_SAVE
-STATIC
-#endif
-void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl, mp_compiled_module_t *cm) {
-    // put compiler state on the stack, it's relatively small
-    compiler_t comp_state = {0};
-    compiler_t *comp = &comp_state;
-
-    comp->is_repl = is_repl;
+// CIRCUITPY-CHANGE: split out of mp_compile_to_raw_code so that file input can
+// also be compiled a group of statements at a time, see mp_compile_stream.
+// Compile the given node as a module scope along with all the scopes in it.
+// The emitters are freed before returning, but the scopes are not, and any
+// error is left in comp->compile_error.
+STATIC scope_t *compile_module(compiler_t *comp, mp_parse_node_t pn, qstr source_file, bool *has_native) {
     comp->break_label = INVALID_LABEL;
     comp->continue_label = INVALID_LABEL;
-    mp_emit_common_init(&comp->emit_common, source_file);
+    comp->scope_head = NULL;
+    comp->scope_cur = NULL;
+    #if MICROPY_EMIT_INLINE_ASM
+    comp->emit_inline_asm = NULL;
+    #endif
 
     // create the module scope
     #if MICROPY_EMIT_NATIVE
@@ -3479,7 +3483,7 @@ void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool
     #else
     const uint emit_opt = MP_EMIT_OPT_NONE;
     #endif
-    scope_t *module_scope = scope_new_and_link(comp, SCOPE_MODULE, parse_tree->root, emit_opt);
+    scope_t *module_scope = scope_new_and_link(comp, SCOPE_MODULE, pn, emit_opt);
 
     // create standard emitter; it's used at least for MP_PASS_SCOPE
     emit_t *emit_bc = emit_bc_new(&comp->emit_common);
@@ -3603,22 +3607,65 @@ void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool
             comp->compile_error_line, comp->scope_cur->simple_name);
     }
 
-    // construct the global qstr/const table for this module
-    cm->rc = module_scope->raw_code;
-    #if MICROPY_PERSISTENT_CODE_SAVE
-    cm->has_native = false;
+    *has_native = false;
+    #if MICROPY_EMIT_NATIVE
+    if (emit_native != NULL) {
+        *has_native = true;
+    }
+    #endif
+    #if MICROPY_EMIT_INLINE_ASM
+    if (comp->emit_inline_asm != NULL) {
+        *has_native = true;
+    }
+    #endif
+
+    // free the emitters
+
+    emit_bc_free(emit_bc);
     #if MICROPY_EMIT_NATIVE
     if (emit_native != NULL) {
-        cm->has_native = true;
+        NATIVE_EMITTER(free)(emit_native);
     }
     #endif
     #if MICROPY_EMIT_INLINE_ASM
     if (comp->emit_inline_asm != NULL) {
-        cm->has_native = true;
+        ASM_EMITTER(free)(comp->emit_inline_asm);
     }
     #endif
+
+    return module_scope;
+}
+
+STATIC void compile_free_scopes(scope_t *module_scope) {
+    for (scope_t *s = module_scope; s;) {
+        scope_t *next = s->next;
+        scope_free(s);
+        s = next;
+    }
+}
+
+#if !MICROPY_PERSISTENT_CODE_SAVE
+STATIC
+#endif
+void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl, mp_compiled_module_t *cm) {
+    // put compiler state on the stack, it's relatively small
+    compiler_t comp_state = {0};
+    compiler_t *comp = &comp_state;
+
+    comp->is_repl = is_repl;
+    mp_emit_common_init(&comp->emit_common, source_file);
+
+    bool has_native;
+    scope_t *module_scope = compile_module(comp, parse_tree->root, source_file, &has_native);
+
+    // construct the global qstr/const table for this module
+    cm->rc = module_scope->raw_code;
+    #if MICROPY_PERSISTENT_CODE_SAVE
+    cm->has_native = has_native;
     cm->n_qstr = comp->emit_common.qstr_map.used;
     cm->n_obj = comp->emit_common.const_obj_list.len;
+    #else
+    (void)has_native;
     #endif
     if (comp->compile_error == MP_OBJ_NULL) {
         mp_emit_common_populate_module_context(&comp->emit_common, source_file, cm->context);
@@ -3636,29 +3683,11 @@ void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool
         #endif
     }
 
-    // free the emitters
-
-    emit_bc_free(emit_bc);
-    #if MICROPY_EMIT_NATIVE
-    if (emit_native != NULL) {
-        NATIVE_EMITTER(free)(emit_native);
-    }
-    #endif
-    #if MICROPY_EMIT_INLINE_ASM
-    if (comp->emit_inline_asm != NULL) {
-        ASM_EMITTER(free)(comp->emit_inline_asm);
-    }
-    #endif
-
     // free the parse tree
     mp_parse_tree_clear(parse_tree);
 
     // free the scopes
-    for (scope_t *s = module_scope; s;) {
-        scope_t *next = s->next;
-        scope_free(s);
-        s = next;
-    }
+    compile_free_scopes(module_scope);
 
     if (comp->compile_error != MP_OBJ_NULL) {
         nlr_raise(comp->compile_error);
@@ -3674,4 +3703,82 @@ mp_obj_t mp_compile(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl)
     return mp_make_function_from_raw_code(cm.rc, cm.context, NULL);
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_STREAMING
+typedef struct _compile_stream_t {
+    compiler_t comp;
+    qstr source_file;
+    size_t num_rc;
+    size_t alloc_rc;
+    mp_raw_code_t **rc;
+} compile_stream_t;
+
+// Compile a group of top-level statements passed on by the parser into its
+// own module-level raw code. All the groups share one constant table.
+STATIC void compile_stream_statements(void *ctx, mp_parse_node_t pn) {
+    compile_stream_t *cs = ctx;
+    compiler_t *comp = &cs->comp;
+    bool has_native;
+    scope_t *module_scope = compile_module(comp, pn, cs->source_file, &has_native);
+    (void)has_native;
+    mp_raw_code_t *rc = module_scope->raw_code;
+    compile_free_scopes(module_scope);
+    if (comp->compile_error != MP_OBJ_NULL) {
+        nlr_raise(comp->compile_error);
+    }
+    comp->is_continuation = true;
+
+    if (cs->num_rc >= cs->alloc_rc) {
+        cs->rc = m_renew(mp_raw_code_t *, cs->rc, cs->alloc_rc, cs->alloc_rc + 8);
+        cs->alloc_rc += 8;
+    }
+    cs->rc[cs->num_rc++] = rc;
+}
+
+// Run each group of statements in turn.
+STATIC mp_obj_t compile_stream_run(mp_obj_t funs_in) {
+    size_t n;
+    mp_obj_t *funs;
+    mp_obj_tuple_get(funs_in, &n, &funs);
+    for (size_t i = 0; i < n; i++) {
+        mp_call_function_0(funs[i]);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(compile_stream_run_obj, compile_stream_run);
+
+mp_obj_t mp_compile_stream(mp_lexer_t *lex) {
+    compile_stream_t cs = {0};
+    cs.source_file = lex->source_name;
+    mp_emit_common_init(&cs.comp.emit_common, cs.source_file);
+
+    mp_parse_tree_t parse_tree = mp_parse_stream(lex, compile_stream_statements, &cs);
+
+    // Compile what followed the last group, unless that was only the
+    // placeholder left by the parser.
+    mp_parse_node_t root = parse_tree.root;
+    if (cs.num_rc == 0 || !MP_PARSE_NODE_IS_STRUCT_KIND(root, PN_file_input)
+        || !MP_PARSE_NODE_IS_NULL(((mp_parse_node_struct_t *)root)->nodes[0])) {
+        compile_stream_statements(&cs, root);
+    }
+    mp_parse_tree_clear(&parse_tree);
+
+    mp_module_context_t *context = m_new_obj(mp_module_context_t);
+    context->module.globals = mp_globals_get();
+    mp_emit_common_populate_module_context(&cs.comp.emit_common, cs.source_file, context);
+
+    if (cs.num_rc == 1) {
+        mp_obj_t fun = mp_make_function_from_raw_code(cs.rc[0], context, NULL);
+        m_del(mp_raw_code_t *, cs.rc, cs.alloc_rc);
+        return fun;
+    }
+    mp_obj_t funs = mp_obj_new_tuple(cs.num_rc, NULL);
+    for (size_t i = 0; i < cs.num_rc; i++) {
+        ((mp_obj_tuple_t *)MP_OBJ_TO_PTR(funs))->items[i] = mp_make_function_from_raw_code(cs.rc[i], context, NULL);
+    }
+    m_del(mp_raw_code_t *, cs.rc, cs.alloc_rc);
+    return mp_obj_new_closure(MP_OBJ_FROM_PTR(&compile_stream_run_obj), 1, &funs);
+}
+#endif
+
 #endif // MICROPY_ENABLE_COMPILER
@@ -40,6 +40,16 @@ mp_obj_t mp_compile(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl)
 void mp_compile_to_raw_code(mp_parse_tree_t *parse_tree, qstr source_file, bool is_repl, mp_compiled_module_t *cm);
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_STREAMING
+// Parse and compile file input, compiling groups of top-level statements as
+// they are parsed so that their parse nodes can be freed early. The whole
+// input is compiled before this returns, so a syntax error anywhere is raised
+// before any of it runs. Returns a function that runs the module, using
+// mp_globals_get() for the context. The lexer is freed.
+mp_obj_t mp_compile_stream(mp_lexer_t *lex);
+#endif
+
 // this is implemented in runtime.c
 mp_obj_t mp_parse_compile_execute(mp_lexer_t *lex, mp_parse_input_kind_t parse_input_kind, mp_obj_dict_t *globals, mp_obj_dict_t *locals);
 
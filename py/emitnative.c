@@ -204,6 +204,19 @@ STATIC const uint8_t reg_local_table[MAX_REGS_FOR_LOCAL_VARS] = {REG_LOCAL_1, RE
 
 #define REG_LOCAL_LAST (reg_local_table[MAX_REGS_FOR_LOCAL_VARS - 1])
 
+// CIRCUITPY-CHANGE: choose which locals live in registers
+// The locals held in reg_local_table are chosen at the end of the stack-size pass,
+// preferring those accessed most often, with accesses inside loops counting more.
+#define REG_LOCAL_NO_LOCAL (0xffff)
+#define LOCAL_USE_LOOP_WEIGHT (8)
+#define LOCAL_USE_MAX_WEIGHT (8 * 8 * 8 * 8)
+
+typedef struct _local_use_t {
+    size_t code_pos;
+    uint16_t local_num;
+    uint16_t weight;
+} local_use_t;
+
 #define EMIT_NATIVE_VIPER_TYPE_ERROR(emit, ...) do { \
         *emit->error_slot = mp_obj_new_exception_msg_varg(&mp_type_ViperTypeError, __VA_ARGS__); \
 } while (0)
@@ -288,6 +301,13 @@ struct _emit_t {
     mp_uint_t local_vtype_alloc;
     vtype_kind_t *local_vtype;
 
+    // CIRCUITPY-CHANGE: which local each of reg_local_table holds, and the
+    // accesses to locals recorded during the stack-size pass to choose them
+    uint16_t reg_local_num[MAX_REGS_FOR_LOCAL_VARS];
+    size_t local_use_alloc;
+    size_t local_use_len;
+    local_use_t *local_use;
+
     mp_uint_t stack_info_alloc;
     stack_info_t *stack_info;
     vtype_kind_t saved_stack_vtype;
@@ -335,6 +355,7 @@ void EXPORT_FUN(free)(emit_t * emit) {
     m_del_obj(ASM_T, emit->as);
     m_del(exc_stack_entry_t, emit->exc_stack, emit->exc_stack_alloc);
     m_del(vtype_kind_t, emit->local_vtype, emit->local_vtype_alloc);
+    m_del(local_use_t, emit->local_use, emit->local_use_alloc);
     m_del(stack_info_t, emit->stack_info, emit->stack_info_alloc);
     m_del_obj(emit_t, emit);
 }
@@ -392,6 +413,100 @@ STATIC void emit_native_mov_reg_qstr_obj(emit_t *emit, int reg_dest, qstr qst) {
         emit_native_mov_state_reg((emit), (local_num), (reg_temp)); \
     } while (false)
 
+// CIRCUITPY-CHANGE: choose which locals live in registers
+// Returns the register holding the given local, or -1 if it lives on the stack.
+STATIC int emit_native_local_reg(emit_t *emit, mp_uint_t local_num) {
+    if (CAN_USE_REGS_FOR_LOCALS(emit)) {
+        for (int i = 0; i < MAX_REGS_FOR_LOCAL_VARS; ++i) {
+            if (emit->reg_local_num[i] == local_num) {
+                return reg_local_table[i];
+            }
+        }
+    }
+    return -1;
+}
+
+// Whether accesses to locals are recorded in this pass, which is only worth
+// doing when there are more locals than registers to hold them.
+STATIC bool emit_native_tracking_local_use(emit_t *emit) {
+    return emit->pass == MP_PASS_STACK_SIZE && CAN_USE_REGS_FOR_LOCALS(emit)
+           && emit->scope->num_locals > MAX_REGS_FOR_LOCAL_VARS;
+}
+
+STATIC void emit_native_note_local_use(emit_t *emit, mp_uint_t local_num) {
+    if (!emit_native_tracking_local_use(emit)) {
+        return;
+    }
+    if (emit->local_use_len >= emit->local_use_alloc) {
+        size_t new_alloc = emit->local_use_alloc + 32;
+        emit->local_use = m_renew(local_use_t, emit->local_use, emit->local_use_alloc, new_alloc);
+        emit->local_use_alloc = new_alloc;
+    }
+    local_use_t *use = &emit->local_use[emit->local_use_len++];
+    use->code_pos = mp_asm_base_get_code_pos(&emit->as->base);
+    use->local_num = local_num;
+    use->weight = 1;
+}
+
+// A jump to a label that is already assigned closes a loop: every access
+// since the label is inside that loop.
+STATIC void emit_native_note_jump(emit_t *emit, mp_uint_t label) {
+    if (!emit_native_tracking_local_use(emit)) {
+        return;
+    }
+    size_t target = emit->as->base.label_offsets[label];
+    if (target == (size_t)-1) {
+        return;
+    }
+    for (size_t i = emit->local_use_len; i > 0 && emit->local_use[i - 1].code_pos >= target; --i) {
+        local_use_t *use = &emit->local_use[i - 1];
+        if (use->weight < LOCAL_USE_MAX_WEIGHT) {
+            use->weight *= LOCAL_USE_LOOP_WEIGHT;
+        }
+    }
+}
+
+STATIC void emit_native_choose_reg_locals(emit_t *emit) {
+    if (!emit_native_tracking_local_use(emit)) {
+        return;
+    }
+    size_t num_locals = emit->scope->num_locals;
+    uint32_t *total = m_new0(uint32_t, num_locals);
+    for (size_t i = 0; i < emit->local_use_len; ++i) {
+        total[emit->local_use[i].local_num] += emit->local_use[i].weight;
+    }
+
+    // Pick the busiest locals, preferring lower numbers on a tie so that
+    // evenly used locals keep the first ones in registers, as before.
+    uint16_t best[MAX_REGS_FOR_LOCAL_VARS];
+    for (int i = 0; i < MAX_REGS_FOR_LOCAL_VARS; ++i) {
+        best[i] = REG_LOCAL_NO_LOCAL;
+        for (size_t j = 0; j < num_locals; ++j) {
+            bool taken = false;
+            for (int k = 0; k < i; ++k) {
+                taken |= best[k] == j;
+            }
+            if (!taken && (best[i] == REG_LOCAL_NO_LOCAL || total[j] > total[best[i]])) {
+                best[i] = j;
+            }
+        }
+    }
+
+    // Hand out the registers in local order, which for the first locals is
+    // the same assignment as without this choice.
+    for (int i = 0; i < MAX_REGS_FOR_LOCAL_VARS; ++i) {
+        for (int k = i + 1; k < MAX_REGS_FOR_LOCAL_VARS; ++k) {
+            if (best[k] < best[i]) {
+                uint16_t tmp = best[i];
+                best[i] = best[k];
+                best[k] = tmp;
+            }
+        }
+        emit->reg_local_num[i] = best[i];
+    }
+    m_del(uint32_t, total, num_locals);
+}
+
 STATIC void emit_native_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scope) {
     DEBUG_printf("start_pass(pass=%u, scope=%p)\n", pass, scope);
 
@@ -400,6 +515,16 @@ STATIC void emit_native_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scop
     emit->stack_size = 0;
     emit->scope = scope;
 
+    // CIRCUITPY-CHANGE: choose which locals live in registers
+    // Start each scope with the first locals in registers and record accesses
+    // to locals, from which emit_native_choose_reg_locals may pick others.
+    if (pass == MP_PASS_STACK_SIZE) {
+        for (int i = 0; i < MAX_REGS_FOR_LOCAL_VARS; ++i) {
+            emit->reg_local_num[i] = i < scope->num_locals ? i : REG_LOCAL_NO_LOCAL;
+        }
+        emit->local_use_len = 0;
+    }
+
     // allocate memory for keeping track of the types of locals
     if (emit->local_vtype_alloc < scope->num_locals) {
         emit->local_vtype = m_renew(vtype_kind_t, emit->local_vtype, emit->local_vtype_alloc, scope->num_locals);
@@ -460,16 +585,17 @@ STATIC void emit_native_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scop
         // Work out size of state (locals plus stack)
         // n_state counts all stack and locals, even those in registers
         emit->n_state = scope->num_locals + scope->stack_size;
+        // CIRCUITPY-CHANGE: choose which locals live in registers
+        // The stack slots of the first locals are not needed if those locals
+        // are all in registers.  The local in REG_LOCAL_LAST needs its slot
+        // if it is an argument other than the last (see below).
         int num_locals_in_regs = 0;
-        if (CAN_USE_REGS_FOR_LOCALS(emit)) {
-            num_locals_in_regs = scope->num_locals;
-            if (num_locals_in_regs > MAX_REGS_FOR_LOCAL_VARS) {
-                num_locals_in_regs = MAX_REGS_FOR_LOCAL_VARS;
-            }
-            // Need a spot for REG_LOCAL_LAST (see below)
-            if (scope->num_pos_args >= MAX_REGS_FOR_LOCAL_VARS + 1) {
-                --num_locals_in_regs;
+        while (num_locals_in_regs < (int)scope->num_locals) {
+            int reg = emit_native_local_reg(emit, num_locals_in_regs);
+            if (reg < 0 || (reg == REG_LOCAL_LAST && num_locals_in_regs < scope->num_pos_args - 1)) {
+                break;
             }
+            ++num_locals_in_regs;
         }
 
         // Work out where the locals and Python stack start within the C stack
@@ -532,15 +658,17 @@ STATIC void emit_native_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scop
                 r = REG_RET;
             }
             // REG_LOCAL_LAST points to the args array so be sure not to overwrite it if it's still needed
-            if (i < MAX_REGS_FOR_LOCAL_VARS && CAN_USE_REGS_FOR_LOCALS(emit) && (i != MAX_REGS_FOR_LOCAL_VARS - 1 || emit->scope->num_pos_args == MAX_REGS_FOR_LOCAL_VARS)) {
-                ASM_MOV_REG_REG(emit->as, reg_local_table[i], r);
+            int reg = emit_native_local_reg(emit, i);
+            if (reg >= 0 && (reg != REG_LOCAL_LAST || i == emit->scope->num_pos_args - 1)) {
+                ASM_MOV_REG_REG(emit->as, reg, r);
             } else {
                 emit_native_mov_state_reg(emit, LOCAL_IDX_LOCAL_VAR(emit, i), r);
             }
         }
         // Get local from the stack back into REG_LOCAL_LAST if this reg couldn't be written to above
-        if (emit->scope->num_pos_args >= MAX_REGS_FOR_LOCAL_VARS + 1 && CAN_USE_REGS_FOR_LOCALS(emit)) {
-            ASM_MOV_REG_LOCAL(emit->as, REG_LOCAL_LAST, LOCAL_IDX_LOCAL_VAR(emit, MAX_REGS_FOR_LOCAL_VARS - 1));
+        mp_uint_t last_local = emit->reg_local_num[MAX_REGS_FOR_LOCAL_VARS - 1];
+        if (CAN_USE_REGS_FOR_LOCALS(emit) && last_local + 1 < emit->scope->num_pos_args) {
+            ASM_MOV_REG_LOCAL(emit->as, REG_LOCAL_LAST, LOCAL_IDX_LOCAL_VAR(emit, last_local));
         }
 
         emit_native_global_exc_entry(emit);
@@ -646,8 +774,10 @@ STATIC void emit_native_start_pass(emit_t *emit, pass_kind_t pass, scope_t *scop
 
         // cache some locals in registers, but only if no exception handlers
         if (CAN_USE_REGS_FOR_LOCALS(emit)) {
-            for (int i = 0; i < MAX_REGS_FOR_LOCAL_VARS && i < scope->num_locals; ++i) {
-                ASM_MOV_REG_LOCAL(emit->as, reg_local_table[i], LOCAL_IDX_LOCAL_VAR(emit, i));
+            for (int i = 0; i < MAX_REGS_FOR_LOCAL_VARS; ++i) {
+                if (emit->reg_local_num[i] != REG_LOCAL_NO_LOCAL) {
+                    ASM_MOV_REG_LOCAL(emit->as, reg_local_table[i], LOCAL_IDX_LOCAL_VAR(emit, emit->reg_local_num[i]));
+                }
             }
         }
 
@@ -719,6 +849,9 @@ STATIC bool emit_native_end_pass(emit_t *emit) {
     assert(emit->stack_size == 0);
     assert(emit->exc_stack_size == 0);
 
+    // CIRCUITPY-CHANGE: choose which locals live in registers
+    emit_native_choose_reg_locals(emit);
+
     if (emit->pass == MP_PASS_EMIT) {
         void *f = mp_asm_base_get_code(&emit->as->base);
         mp_uint_t f_len = mp_asm_base_get_code_size(&emit->as->base);
@@ -1427,8 +1560,10 @@ STATIC void emit_native_load_fast(emit_t *emit, qstr qst, mp_uint_t local_num) {
         EMIT_NATIVE_VIPER_TYPE_ERROR(emit, MP_ERROR_TEXT("local '%q' used before type known"), qst);
     }
     emit_native_pre(emit);
-    if (local_num < MAX_REGS_FOR_LOCAL_VARS && CAN_USE_REGS_FOR_LOCALS(emit)) {
-        emit_post_push_reg(emit, vtype, reg_local_table[local_num]);
+    emit_native_note_local_use(emit, local_num);
+    int reg = emit_native_local_reg(emit, local_num);
+    if (reg >= 0) {
+        emit_post_push_reg(emit, vtype, reg);
     } else {
         need_reg_single(emit, REG_TEMP0, 0);
         emit_native_mov_reg_state(emit, REG_TEMP0, LOCAL_IDX_LOCAL_VAR(emit, local_num));
@@ -1619,13 +1754,26 @@ STATIC void emit_native_load_subscr(emit_t *emit) {
             switch (vtype_base) {
                 case VTYPE_PTR8: {
                     // pointer to 8-bit memory
-                    // TODO optimise to use thumb ldrb r1, [r2, r3]
+                    // CIRCUITPY-CHANGE: register-offset loads and stores for viper pointers
+                    #if N_THUMB
+                    asm_thumb_ldrb_rlo_rlo_rlo(emit->as, REG_RET, REG_ARG_1, reg_index);
+                    break;
+                    #endif
                     ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
                     ASM_LOAD8_REG_REG(emit->as, REG_RET, REG_ARG_1); // store value to (base+index)
                     break;
                 }
                 case VTYPE_PTR16: {
                     // pointer to 16-bit memory
+                    #if N_THUMB
+                    if (asm_thumb_allow_armv7m(emit->as)) {
+                        asm_thumb_load_store_reg_reg_reg_lsl(emit->as, ASM_THUMB_OP_LDRH_W_REG, REG_RET, REG_ARG_1, reg_index, 1);
+                    } else {
+                        ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
+                        asm_thumb_ldrh_rlo_rlo_rlo(emit->as, REG_RET, REG_ARG_1, reg_index); // load from (base+2*index)
+                    }
+                    break;
+                    #endif
                     ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
                     ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
                     ASM_LOAD16_REG_REG(emit->as, REG_RET, REG_ARG_1); // load from (base+2*index)
@@ -1633,6 +1781,17 @@ STATIC void emit_native_load_subscr(emit_t *emit) {
                 }
                 case VTYPE_PTR32: {
                     // pointer to word-size memory
+                    #if N_THUMB
+                    if (asm_thumb_allow_armv7m(emit->as)) {
+                        asm_thumb_load_store_reg_reg_reg_lsl(emit->as, ASM_THUMB_OP_LDR_W_REG, REG_RET, REG_ARG_1, reg_index, 2);
+                    } else {
+                        ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
+                        ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
+                        ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
+                        asm_thumb_ldr_rlo_rlo_rlo(emit->as, REG_RET, REG_ARG_1, reg_index); // load from (base+4*index)
+                    }
+                    break;
+                    #endif
                     ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
                     ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
                     ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
@@ -1651,8 +1810,10 @@ STATIC void emit_native_load_subscr(emit_t *emit) {
 
 STATIC void emit_native_store_fast(emit_t *emit, qstr qst, mp_uint_t local_num) {
     vtype_kind_t vtype;
-    if (local_num < MAX_REGS_FOR_LOCAL_VARS && CAN_USE_REGS_FOR_LOCALS(emit)) {
-        emit_pre_pop_reg(emit, &vtype, reg_local_table[local_num]);
+    emit_native_note_local_use(emit, local_num);
+    int reg = emit_native_local_reg(emit, local_num);
+    if (reg >= 0) {
+        emit_pre_pop_reg(emit, &vtype, reg);
     } else {
         emit_pre_pop_reg(emit, &vtype, REG_TEMP0);
         emit_native_mov_state_reg(emit, LOCAL_IDX_LOCAL_VAR(emit, local_num), REG_TEMP0);
@@ -1867,11 +2028,15 @@ STATIC void emit_native_store_subscr(emit_t *emit) {
             switch (vtype_base) {
                 case VTYPE_PTR8: {
                     // pointer to 8-bit memory
-                    // TODO optimise to use thumb strb r1, [r2, r3]
                     #if N_ARM
                     asm_arm_strb_reg_reg_reg(emit->as, reg_value, REG_ARG_1, reg_index);
                     break;
                     #endif
+                    // CIRCUITPY-CHANGE: register-offset loads and stores for viper pointers
+                    #if N_THUMB
+                    asm_thumb_strb_rlo_rlo_rlo(emit->as, reg_value, REG_ARG_1, reg_index);
+                    break;
+                    #endif
                     ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
                     ASM_STORE8_REG_REG(emit->as, reg_value, REG_ARG_1); // store value to (base+index)
                     break;
@@ -1882,6 +2047,15 @@ STATIC void emit_native_store_subscr(emit_t *emit) {
                     asm_arm_strh_reg_reg_reg(emit->as, reg_value, REG_ARG_1, reg_index);
                     break;
                     #endif
+                    #if N_THUMB
+                    if (asm_thumb_allow_armv7m(emit->as)) {
+                        asm_thumb_load_store_reg_reg_reg_lsl(emit->as, ASM_THUMB_OP_STRH_W_REG, reg_value, REG_ARG_1, reg_index, 1);
+                    } else {
+                        ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
+                        asm_thumb_strh_rlo_rlo_rlo(emit->as, reg_value, REG_ARG_1, reg_index); // store value to (base+2*index)
+                    }
+                    break;
+                    #endif
                     ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
                     ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
                     ASM_STORE16_REG_REG(emit->as, reg_value, REG_ARG_1); // store value to (base+2*index)
@@ -1893,6 +2067,17 @@ STATIC void emit_native_store_subscr(emit_t *emit) {
                     asm_arm_str_reg_reg_reg(emit->as, reg_value, REG_ARG_1, reg_index);
                     break;
                     #endif
+                    #if N_THUMB
+                    if (asm_thumb_allow_armv7m(emit->as)) {
+                        asm_thumb_load_store_reg_reg_reg_lsl(emit->as, ASM_THUMB_OP_STR_W_REG, reg_value, REG_ARG_1, reg_index, 2);
+                    } else {
+                        ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
+                        ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
+                        ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
+                        asm_thumb_str_rlo_rlo_rlo(emit->as, reg_value, REG_ARG_1, reg_index); // store value to (base+4*index)
+                    }
+                    break;
+                    #endif
                     ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
                     ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
                     ASM_ADD_REG_REG(emit->as, REG_ARG_1, reg_index); // add index to base
@@ -2003,6 +2188,7 @@ STATIC void emit_native_rot_three(emit_t *emit) {
 STATIC void emit_native_jump(emit_t *emit, mp_uint_t label) {
     DEBUG_printf("jump(label=" UINT_FMT ")\n", label);
     emit_native_pre(emit);
+    emit_native_note_jump(emit, label);
     // need to commit stack because we are jumping elsewhere
     need_stack_settled(emit);
     ASM_JUMP(emit->as, label);
@@ -2033,6 +2219,7 @@ STATIC void emit_native_jump_helper(emit_t *emit, bool cond, mp_uint_t label, bo
     if (!pop) {
         emit->saved_stack_vtype = vtype;
     }
+    emit_native_note_jump(emit, label);
     // need to commit stack because we may jump elsewhere
     need_stack_settled(emit);
     // Emit the jump
@@ -43,6 +43,22 @@
 #include "shared-module/memorymonitor/__init__.h"
 #endif
 
+#if MICROPY_GC_COMPACT
+#include "py/objlist.h"
+#endif
+
+#if MICROPY_GC_ALLOC_SITES
+#include "py/bc.h"
+#include "py/objfun.h"
+#endif
+
+#if MICROPY_GC_STATS
+#include "py/mphal.h"
+#if CIRCUITPY
+#include "supervisor/port.h"
+#endif
+#endif
+
 #if MICROPY_ENABLE_GC
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
@@ -103,6 +119,13 @@
 #define ATB_HEAD_TO_MARK(area, block) do { area->gc_alloc_table_start[(block) / BLOCKS_PER_ATB] |= (AT_MARK << BLOCK_SHIFT(block)); } while (0)
 #define ATB_MARK_TO_HEAD(area, block) do { area->gc_alloc_table_start[(block) / BLOCKS_PER_ATB] &= (~(AT_TAIL << BLOCK_SHIFT(block))); } while (0)
 
+#if MICROPY_GC_INCREMENTAL_SWEEP
+// Objects allocated ahead of a pending sweep stay marked until it reaches them.
+#define ATB_IS_LIVE_HEAD(area, block) (ATB_GET_KIND(area, block) == AT_HEAD || ATB_GET_KIND(area, block) == AT_MARK)
+#else
+#define ATB_IS_LIVE_HEAD(area, block) (ATB_GET_KIND(area, block) == AT_HEAD)
+#endif
+
 #define BLOCK_FROM_PTR(area, ptr) (((byte *)(ptr) - area->gc_pool_start) / BYTES_PER_BLOCK)
 #define PTR_FROM_BLOCK(area, block) (((block) * BYTES_PER_BLOCK + (uintptr_t)area->gc_pool_start))
 
@@ -121,6 +144,8 @@
 #define FTB_GET(area, block) ((area->gc_finaliser_table_start[(block) / BLOCKS_PER_FTB] >> ((block) & 7)) & 1)
 #define FTB_SET(area, block) do { area->gc_finaliser_table_start[(block) / BLOCKS_PER_FTB] |= (1 << ((block) & 7)); } while (0)
 #define FTB_CLEAR(area, block) do { area->gc_finaliser_table_start[(block) / BLOCKS_PER_FTB] &= (~(1 << ((block) & 7))); } while (0)
+#elif MICROPY_GC_DEFERRED_FINALISERS
+#error MICROPY_GC_DEFERRED_FINALISERS requires MICROPY_ENABLE_FINALISER
 #endif
 
 #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
@@ -143,13 +168,20 @@ void __attribute__ ((noinline)) gc_log_change(uint32_t start_block, uint32_t len
 #pragma GCC pop_options
 #endif
 
+#if MICROPY_GC_ALLOC_SITES
+#define SITE_BYTES_PER_ATB (BLOCKS_PER_ATB * sizeof(mp_gc_site_t))
+#else
+#define SITE_BYTES_PER_ATB (0)
+#endif
+
 // TODO waste less memory; currently requires that all entries in alloc_table have a corresponding block in pool
 STATIC void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
-    // calculate parameters for GC (T=total, A=alloc table, F=finaliser table, P=pool; all in bytes):
-    // T = A + F + P
+    // calculate parameters for GC (T=total, A=alloc table, F=finaliser table, S=site table, P=pool; all in bytes):
+    // T = A + F + S + P
     //     F = A * BLOCKS_PER_ATB / BLOCKS_PER_FTB
+    //     S = A * SITE_BYTES_PER_ATB
     //     P = A * BLOCKS_PER_ATB * BYTES_PER_BLOCK
-    // => T = A * (1 + BLOCKS_PER_ATB / BLOCKS_PER_FTB + BLOCKS_PER_ATB * BYTES_PER_BLOCK)
+    // => T = A * (1 + BLOCKS_PER_ATB / BLOCKS_PER_FTB + SITE_BYTES_PER_ATB + BLOCKS_PER_ATB * BYTES_PER_BLOCK)
     size_t total_byte_len = (byte *)end - (byte *)start;
     #if MICROPY_ENABLE_FINALISER
     area->gc_alloc_table_byte_len = (total_byte_len - ALLOC_TABLE_GAP_BYTE)
@@ -157,10 +189,11 @@ STATIC void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
         / (
             MP_BITS_PER_BYTE
             + MP_BITS_PER_BYTE * BLOCKS_PER_ATB / BLOCKS_PER_FTB
+            + MP_BITS_PER_BYTE * SITE_BYTES_PER_ATB
             + MP_BITS_PER_BYTE * BLOCKS_PER_ATB * BYTES_PER_BLOCK
             );
     #else
-    area->gc_alloc_table_byte_len = (total_byte_len - ALLOC_TABLE_GAP_BYTE) / (1 + MP_BITS_PER_BYTE / 2 * BYTES_PER_BLOCK);
+    area->gc_alloc_table_byte_len = (total_byte_len - ALLOC_TABLE_GAP_BYTE) / (1 + SITE_BYTES_PER_ATB + MP_BITS_PER_BYTE / 2 * BYTES_PER_BLOCK);
     #endif
 
     area->gc_alloc_table_start = (byte *)start;
@@ -174,6 +207,15 @@ STATIC void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     area->gc_pool_start = (byte *)end - gc_pool_block_len * BYTES_PER_BLOCK;
     area->gc_pool_end = end;
 
+    #if MICROPY_GC_ALLOC_SITES
+    // The site table goes just before the pool. It's written as blocks are
+    // allocated, so it doesn't need clearing.
+    area->gc_site_table_start = (mp_gc_site_t *)area->gc_pool_start - gc_pool_block_len;
+    #if MICROPY_ENABLE_FINALISER
+    assert((byte *)area->gc_site_table_start >= area->gc_finaliser_table_start + gc_finaliser_table_byte_len);
+    #endif
+    #endif
+
     #if MICROPY_ENABLE_FINALISER
     assert(area->gc_pool_start >= area->gc_finaliser_table_start + gc_finaliser_table_byte_len);
     #endif
@@ -189,10 +231,18 @@ STATIC void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
     area->gc_last_free_atb_index = 0;
     area->gc_last_used_block = 0;
 
+    #if MICROPY_GC_SIZE_CLASSES
+    memset(area->gc_size_class, 0, sizeof(area->gc_size_class));
+    #endif
+
     #if MICROPY_GC_SPLIT_HEAP
     area->next = NULL;
     #endif
 
+    #if MICROPY_GC_SPLIT_HEAP && MICROPY_GC_SLOW_AREAS
+    area->slow = MICROPY_GC_AREA_IS_SLOW(start, end);
+    #endif
+
     DEBUG_printf("GC layout:\n");
     DEBUG_printf("  alloc table at %p, length " UINT_FMT " bytes, "
         UINT_FMT " blocks\n",
@@ -227,12 +277,38 @@ void gc_init(void *start, void *end) {
     // allow auto collection
     MP_STATE_MEM(gc_auto_collect_enabled) = 1;
 
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    MP_STATE_MEM(gc_sweep).area = NULL;
+    MP_STATE_MEM(gc_sweep_defer) = false;
+    #endif
+
+    #if MICROPY_GC_DEFERRED_FINALISERS
+    MP_STATE_MEM(gc_finaliser_queue_len) = 0;
+    MP_STATE_MEM(gc_finaliser_defer) = false;
+    #endif
+
+    #if MICROPY_GC_ARENA
+    MP_STATE_MEM(gc_arena).area = NULL;
+    #endif
+
+    #if MICROPY_GC_ALLOC_SITES
+    MP_STATE_MEM(gc_census_active) = false;
+    #endif
+
     #if MICROPY_GC_ALLOC_THRESHOLD
     // by default, maxuint for gc threshold, effectively turning gc-by-threshold off
     MP_STATE_MEM(gc_alloc_threshold) = (size_t)-1;
     MP_STATE_MEM(gc_alloc_amount) = 0;
     #endif
 
+    #if MICROPY_GC_STATS
+    // The totals carry on across heaps, so soft reloads don't hide anything.
+    if (MP_STATE_MEM(gc_stats).since_us == 0) {
+        MP_STATE_MEM(gc_stats).since_us = MICROPY_GC_STATS_TICKS_US();
+    }
+    MP_STATE_MEM(gc_stats_collect_start_us) = 0;
+    #endif
+
     #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
     mp_thread_mutex_init(&MP_STATE_MEM(gc_mutex));
     #endif
@@ -398,6 +474,29 @@ STATIC inline mp_state_mem_area_t *gc_get_ptr_area(const void *ptr) {
     && ptr < (void *)MP_STATE_MEM(area).gc_pool_end         /* must be below end of pool */ \
     )
 
+#if MICROPY_GC_COMPACT
+// Count a pointer found by a collection against the storage that gc_compact
+// is considering moving. Pointers anywhere into the storage count, not just
+// ones to its start.
+STATIC void MP_NO_INSTRUMENT gc_compact_note(const void *ptr) {
+    mp_gc_compact_entry_t *entries = MP_STATE_MEM(gc_compact_entries);
+    for (size_t i = 0; i < MP_STATE_MEM(gc_compact_len); i++) {
+        mp_gc_compact_entry_t *e = &entries[i];
+        if ((uintptr_t)ptr >= PTR_FROM_BLOCK(e->area, e->block)
+            && (uintptr_t)ptr < PTR_FROM_BLOCK(e->area, e->block + e->n_blocks)) {
+            e->refs++;
+        }
+    }
+}
+#define GC_COMPACT_NOTE(ptr) do { \
+        if (MP_STATE_MEM(gc_compact_len) > 0) { \
+            gc_compact_note(ptr); \
+        } \
+} while (0)
+#else
+#define GC_COMPACT_NOTE(ptr)
+#endif
+
 #ifndef TRACE_MARK
 #if DEBUG_PRINT
 #define TRACE_MARK(block, ptr) DEBUG_printf("gc_mark(%p)\n", ptr)
@@ -438,6 +537,7 @@ STATIC void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
         for (size_t i = n_blocks * BYTES_PER_BLOCK / sizeof(void *); i > 0; i--, ptrs++) {
             MICROPY_GC_HOOK_LOOP(i);
             void *ptr = *ptrs;
+            GC_COMPACT_NOTE(ptr);
             // If this is a heap pointer that hasn't been marked, mark it and push
             // it's children to the stack.
             #if MICROPY_GC_SPLIT_HEAP
@@ -506,47 +606,196 @@ STATIC void gc_deal_with_stack_overflow(void) {
     }
 }
 
-STATIC void gc_sweep(void) {
+#if MICROPY_GC_SIZE_CLASSES
+// Free runs longer than this are left to the allocation table scan so small
+// objects don't get spread through the large free regions.
+#define GC_SIZE_CLASS_MAX_RUN (8)
+
+// Record a free run of blocks as holes in the size class lists, largest first.
+STATIC void gc_size_class_add_run(mp_state_mem_area_t *area, size_t block, size_t n_blocks) {
+    if (n_blocks > GC_SIZE_CLASS_MAX_RUN) {
+        return;
+    }
+    for (int c = MP_GC_SIZE_CLASS_COUNT - 1; c >= 0; c--) {
+        size_t class_blocks = 1 << c;
+        mp_gc_size_class_t *size_class = &area->gc_size_class[c];
+        while (n_blocks >= class_blocks && size_class->len < MICROPY_GC_SIZE_CLASS_ENTRIES) {
+            size_class->blocks[size_class->len++] = block;
+            block += class_blocks;
+            n_blocks -= class_blocks;
+        }
+    }
+}
+
+// Find a recorded hole of at least n_blocks free blocks. Holes that have since
+// been used by the allocation table scan are dropped.
+STATIC bool gc_size_class_take(size_t n_blocks, mp_state_mem_area_t **area_out, size_t *block_out) {
+    size_t c = n_blocks <= 1 ? 0 : (n_blocks <= 2 ? 1 : 2);
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        mp_gc_size_class_t *size_class = &area->gc_size_class[c];
+        while (size_class->next < size_class->len) {
+            size_t block = size_class->blocks[size_class->next++];
+            size_t n_free = 0;
+            while (n_free < n_blocks && ATB_GET_KIND(area, block + n_free) == AT_FREE) {
+                n_free++;
+            }
+            if (n_free == n_blocks) {
+                *area_out = area;
+                *block_out = block;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+#endif
+
+#if MICROPY_ENABLE_FINALISER
+// Call the __del__ method of a swept object, if it has one. The GC must be
+// locked so that the method can't allocate.
+STATIC void gc_call_finaliser(mp_obj_base_t *obj) {
+    if (obj->type == NULL) {
+        return;
+    }
+    // if the object has a type then see if it has a __del__ method
+    mp_obj_t dest[2];
+    mp_load_method_maybe(MP_OBJ_FROM_PTR(obj), MP_QSTR___del__, dest);
+    if (dest[0] != MP_OBJ_NULL) {
+        // load_method returned a method, execute it in a protected environment
+        #if MICROPY_ENABLE_SCHEDULER
+        mp_sched_lock();
+        #endif
+        mp_call_function_1_protected(dest[0], dest[1]);
+        #if MICROPY_ENABLE_SCHEDULER
+        mp_sched_unlock();
+        #endif
+    }
+}
+#endif
+
+#if MICROPY_GC_DEFERRED_FINALISERS
+// Run up to max_count of the finalisers queued by the sweep and free their
+// objects. The GC must not be entered.
+STATIC void gc_run_finalisers(size_t max_count) {
+    for (; max_count > 0; max_count--) {
+        GC_ENTER();
+        size_t len = MP_STATE_MEM(gc_finaliser_queue_len);
+        if (len == 0) {
+            GC_EXIT();
+            return;
+        }
+        mp_obj_base_t *obj = MP_STATE_MEM(gc_finaliser_queue)[--len];
+        MP_STATE_MEM(gc_finaliser_queue_len) = len;
+        GC_EXIT();
+
+        MP_STATE_THREAD(gc_lock_depth)++;
+        gc_call_finaliser(obj);
+        MP_STATE_THREAD(gc_lock_depth)--;
+        // Left for the next sweep if the GC is locked.
+        gc_free(obj);
+    }
+}
+#endif
+
+#if MICROPY_GC_DEFERRED_FINALISERS
+// Queue unreachable objects that have finalisers, before the sweep frees
+// anything. Each one is marked along with everything it references, so the
+// sweep keeps all of it for the finaliser, and its finaliser bit is cleared so
+// that it is only queued once. Once the queue is full the sweep finalises the
+// rest as it goes.
+STATIC void gc_queue_finalisers(void) {
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        size_t end_block = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+        for (size_t i = 0; i * BLOCKS_PER_FTB < end_block; i++) {
+            byte bits = area->gc_finaliser_table_start[i];
+            for (size_t block = i * BLOCKS_PER_FTB; bits != 0 && block < end_block; block++, bits >>= 1) {
+                MICROPY_GC_HOOK_LOOP(block);
+                if (!(bits & 1) || ATB_GET_KIND(area, block) != AT_HEAD) {
+                    continue;
+                }
+                mp_obj_base_t *obj = (mp_obj_base_t *)PTR_FROM_BLOCK(area, block);
+                if (obj->type == NULL) {
+                    continue;
+                }
+                if (MP_STATE_MEM(gc_finaliser_queue_len) >= MICROPY_GC_FINALISER_QUEUE_LEN) {
+                    gc_deal_with_stack_overflow();
+                    return;
+                }
+                FTB_CLEAR(area, block);
+                ATB_HEAD_TO_MARK(area, block);
+                #if MICROPY_GC_SPLIT_HEAP
+                gc_mark_subtree(area, block);
+                #else
+                gc_mark_subtree(block);
+                #endif
+                MP_STATE_MEM(gc_finaliser_queue)[MP_STATE_MEM(gc_finaliser_queue_len)++] = obj;
+                #if MICROPY_PY_GC_COLLECT_RETVAL
+                MP_STATE_MEM(gc_collected)++;
+                #endif
+            }
+        }
+    }
+    gc_deal_with_stack_overflow();
+}
+#endif
+
+// Start sweeping an area. The size class lists are rebuilt as it is swept.
+STATIC void gc_sweep_begin_area(mp_gc_sweep_t *sweep, mp_state_mem_area_t *area) {
+    sweep->area = area;
+    sweep->block = 0;
+    sweep->end_block = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+    if (area->gc_last_used_block < sweep->end_block) {
+        sweep->end_block = area->gc_last_used_block + 1;
+    }
+    sweep->last_used_block = 0;
+    sweep->free_run = 0;
+    sweep->allocated = false;
+
+    #if MICROPY_GC_SIZE_CLASSES
+    for (size_t c = 0; c < MP_GC_SIZE_CLASS_COUNT; c++) {
+        area->gc_size_class[c].len = 0;
+        area->gc_size_class[c].next = 0;
+    }
+    #endif
+}
+
+STATIC void gc_sweep_start(mp_gc_sweep_t *sweep) {
     #if MICROPY_PY_GC_COLLECT_RETVAL
     MP_STATE_MEM(gc_collected) = 0;
     #endif
-    // free unmarked heads and their tails
-    int free_tail = 0;
     #if MICROPY_GC_SPLIT_HEAP_AUTO
-    mp_state_mem_area_t *prev_area = NULL;
+    sweep->prev_area = NULL;
     #endif
-    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
-        size_t end_block = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
-        if (area->gc_last_used_block < end_block) {
-            end_block = area->gc_last_used_block + 1;
-        }
+    gc_sweep_begin_area(sweep, &MP_STATE_MEM(area));
+}
 
-        size_t last_used_block = 0;
+// Free unmarked heads and their tails. At most max_blocks blocks are swept,
+// and the sweep stops early once it has made a free run of want_blocks blocks
+// (0 to never stop early). Returns true once every area has been swept.
+STATIC bool gc_sweep_step(mp_gc_sweep_t *sweep, size_t max_blocks, size_t want_blocks) {
+    // A step only stops between objects, so any tail found where it resumes
+    // belongs to a live object that was grown in place since.
+    int free_tail = 0;
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    size_t n_swept = 0;
+    #else
+    (void)max_blocks;
+    (void)want_blocks;
+    #endif
+    while (sweep->area != NULL) {
+        mp_state_mem_area_t *area = sweep->area;
 
-        for (size_t block = 0; block < end_block; block++) {
+        while (sweep->block < sweep->end_block) {
+            size_t block = sweep->block++;
             MICROPY_GC_HOOK_LOOP(block);
             switch (ATB_GET_KIND(area, block)) {
                 case AT_HEAD:
                     #if MICROPY_ENABLE_FINALISER
                     if (FTB_GET(area, block)) {
                         mp_obj_base_t *obj = (mp_obj_base_t *)PTR_FROM_BLOCK(area, block);
-                        if (obj->type != NULL) {
-                            // if the object has a type then see if it has a __del__ method
-                            mp_obj_t dest[2];
-                            mp_load_method_maybe(MP_OBJ_FROM_PTR(obj), MP_QSTR___del__, dest);
-                            if (dest[0] != MP_OBJ_NULL) {
-                                // load_method returned a method, execute it in a protected environment
-                                #if MICROPY_ENABLE_SCHEDULER
-                                mp_sched_lock();
-                                #endif
-                                mp_call_function_1_protected(dest[0], dest[1]);
-                                #if MICROPY_ENABLE_SCHEDULER
-                                mp_sched_unlock();
-                                #endif
-                            }
-                        }
                         // clear finaliser flag
                         FTB_CLEAR(area, block);
+                        gc_call_finaliser(obj);
                     }
                     #endif
                     free_tail = 1;
@@ -563,37 +812,158 @@ STATIC void gc_sweep(void) {
                         #if CLEAR_ON_SWEEP
                         memset((void *)PTR_FROM_BLOCK(area, block), 0, BYTES_PER_BLOCK);
                         #endif
+                        #if MICROPY_GC_INCREMENTAL_SWEEP
+                        // Allocations may already have scanned past this block.
+                        #if MICROPY_GC_SPLIT_HEAP
+                        MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
+                        #endif
+                        if (block / BLOCKS_PER_ATB < area->gc_last_free_atb_index) {
+                            area->gc_last_free_atb_index = block / BLOCKS_PER_ATB;
+                        }
+                        #endif
                     } else {
-                        last_used_block = block;
+                        sweep->last_used_block = block;
                     }
                     break;
 
                 case AT_MARK:
                     ATB_MARK_TO_HEAD(area, block);
                     free_tail = 0;
-                    last_used_block = block;
+                    sweep->last_used_block = block;
                     break;
             }
+
+            #if MICROPY_GC_SIZE_CLASSES || MICROPY_GC_INCREMENTAL_SWEEP
+            // Runs that reach end_block are the open end of the heap and are
+            // not recorded.
+            if (ATB_GET_KIND(area, block) == AT_FREE) {
+                sweep->free_run++;
+            } else if (sweep->free_run > 0) {
+                #if MICROPY_GC_SIZE_CLASSES
+                gc_size_class_add_run(area, block - sweep->free_run, sweep->free_run);
+                #endif
+                sweep->free_run = 0;
+            }
+            #endif
+
+            #if MICROPY_GC_INCREMENTAL_SWEEP
+            if ((++n_swept >= max_blocks || (want_blocks > 0 && sweep->free_run >= want_blocks))
+                && sweep->block < sweep->end_block && ATB_GET_KIND(area, sweep->block) != AT_TAIL) {
+                return false;
+            }
+            #endif
         }
 
-        area->gc_last_used_block = last_used_block;
+        // Blocks allocated behind the sweep weren't seen by it, so in that
+        // case keep the high water mark gc_alloc has been maintaining.
+        if (!sweep->allocated) {
+            area->gc_last_used_block = sweep->last_used_block;
+        }
 
         #if MICROPY_GC_SPLIT_HEAP_AUTO
         // Free any empty area, aside from the first one
-        if (last_used_block == 0 && prev_area != NULL) {
+        if (area->gc_last_used_block == 0 && sweep->prev_area != NULL
+            #if MICROPY_GC_ARENA
+            && area != MP_STATE_MEM(gc_arena).area
+            #endif
+            ) {
             DEBUG_printf("gc_sweep free empty area %p\n", area);
-            NEXT_AREA(prev_area) = NEXT_AREA(area);
+            NEXT_AREA(sweep->prev_area) = NEXT_AREA(area);
+            #if MICROPY_GC_SPLIT_HEAP
+            if (MP_STATE_MEM(gc_last_free_area) == area) {
+                MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
+            }
+            #endif
             MP_PLAT_FREE_HEAP(area);
-            area = prev_area;
+            area = sweep->prev_area;
         }
-        prev_area = area;
+        sweep->prev_area = area;
         #endif
+
+        if (NEXT_AREA(area) == NULL) {
+            sweep->area = NULL;
+        } else {
+            gc_sweep_begin_area(sweep, NEXT_AREA(area));
+        }
+    }
+    return true;
+}
+
+#if MICROPY_GC_INCREMENTAL_SWEEP
+// Run the pending sweep, if there is one. The GC must already be entered.
+STATIC void gc_sweep_pending(size_t max_blocks, size_t want_blocks) {
+    if (MP_STATE_MEM(gc_sweep).area != NULL) {
+        // Finalisers run by the sweep must not be able to allocate.
+        MP_STATE_THREAD(gc_lock_depth)++;
+        gc_sweep_step(&MP_STATE_MEM(gc_sweep), max_blocks, want_blocks);
+        MP_STATE_THREAD(gc_lock_depth)--;
+    }
+}
+
+// Tell a pending sweep that blocks first_block to last_block have just been
+// allocated. Returns true if the sweep has still to reach them, in which case
+// the head has to be marked so that the sweep keeps the object.
+STATIC bool gc_sweep_claim(mp_state_mem_area_t *area, size_t first_block, size_t last_block) {
+    mp_gc_sweep_t *sweep = &MP_STATE_MEM(gc_sweep);
+    if (sweep->area == NULL) {
+        return false;
+    }
+    if (area != sweep->area) {
+        // Areas after the one being swept haven't been started yet.
+        for (mp_state_mem_area_t *a = NEXT_AREA(sweep->area); a != NULL; a = NEXT_AREA(a)) {
+            if (a == area) {
+                return true;
+            }
+        }
+        return false;
+    }
+    if (last_block >= sweep->block) {
+        sweep->end_block = MAX(sweep->end_block, last_block + 1);
+    }
+    if (first_block < sweep->block) {
+        sweep->allocated = true;
+        return false;
+    }
+    return true;
+}
+#endif
+
+// gc_sweep_all passes false: nothing is marked then, and the heap is about to
+// go, so any finalisers are called inline.
+STATIC void gc_sweep(bool queue_finalisers) {
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    mp_gc_sweep_t *sweep = &MP_STATE_MEM(gc_sweep);
+    #else
+    mp_gc_sweep_t sweep_state;
+    mp_gc_sweep_t *sweep = &sweep_state;
+    #endif
+    gc_sweep_start(sweep);
+    #if MICROPY_GC_DEFERRED_FINALISERS
+    if (queue_finalisers) {
+        gc_queue_finalisers();
+    }
+    #else
+    (void)queue_finalisers;
+    #endif
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    if (MP_STATE_MEM(gc_sweep_defer)) {
+        // gc_alloc sweeps as it needs to from here.
+        return;
     }
+    #endif
+    gc_sweep_step(sweep, SIZE_MAX, 0);
 }
 
 void gc_collect_start(void) {
     GC_ENTER();
     MP_STATE_THREAD(gc_lock_depth)++;
+    #if MICROPY_GC_STATS
+    MP_STATE_MEM(gc_stats_collect_start_us) = MICROPY_GC_STATS_TICKS_US() | 1;
+    #endif
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // Marking needs every head to start out unmarked.
+    gc_sweep_pending(SIZE_MAX, 0);
+    #endif
     #if MICROPY_GC_ALLOC_THRESHOLD
     MP_STATE_MEM(gc_alloc_amount) = 0;
     #endif
@@ -607,6 +977,12 @@ void gc_collect_start(void) {
     size_t root_end = offsetof(mp_state_ctx_t, vm.qstr_last_chunk);
     gc_collect_root(ptrs + root_start / sizeof(void *), (root_end - root_start) / sizeof(void *));
 
+    #if MICROPY_GC_DEFERRED_FINALISERS
+    // Objects still waiting for their finalisers are kept, with everything
+    // they reference.
+    gc_collect_root(MP_STATE_MEM(gc_finaliser_queue), MP_STATE_MEM(gc_finaliser_queue_len));
+    #endif
+
     #if MICROPY_ENABLE_PYSTACK
     // Trace root pointers from the Python stack.
     ptrs = (void **)(void *)MP_STATE_THREAD(pystack_start);
@@ -643,6 +1019,7 @@ void gc_collect_root(void **ptrs, size_t len) {
     for (size_t i = 0; i < len; i++) {
         MICROPY_GC_HOOK_LOOP(i);
         void *ptr = gc_get_ptr(ptrs, i);
+        GC_COMPACT_NOTE(ptr);
         #if MICROPY_GC_SPLIT_HEAP
         mp_state_mem_area_t *area = gc_get_ptr_area(ptr);
         if (!area) {
@@ -666,9 +1043,30 @@ void gc_collect_root(void **ptrs, size_t len) {
     }
 }
 
-void gc_collect_end(void) {
+#if MICROPY_GC_INCREMENTAL_SWEEP || MICROPY_GC_DEFERRED_FINALISERS
+// Collect, leaving the sweep and finalisers for gc_alloc to do as it goes.
+STATIC void gc_collect_deferring_sweep(void) {
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    MP_STATE_MEM(gc_sweep_defer) = true;
+    #endif
+    #if MICROPY_GC_DEFERRED_FINALISERS
+    MP_STATE_MEM(gc_finaliser_defer) = true;
+    #endif
+    gc_collect();
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    MP_STATE_MEM(gc_sweep_defer) = false;
+    #endif
+    #if MICROPY_GC_DEFERRED_FINALISERS
+    MP_STATE_MEM(gc_finaliser_defer) = false;
+    #endif
+}
+#else
+#define gc_collect_deferring_sweep() gc_collect()
+#endif
+
+STATIC void gc_collect_finish(bool queue_finalisers) {
     gc_deal_with_stack_overflow();
-    gc_sweep();
+    gc_sweep(queue_finalisers);
     #if MICROPY_GC_SPLIT_HEAP
     MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
     #endif
@@ -676,18 +1074,71 @@ void gc_collect_end(void) {
         area->gc_last_free_atb_index = 0;
     }
     MP_STATE_THREAD(gc_lock_depth)--;
+    #if MICROPY_GC_STATS
+    // gc_sweep_all ends a collection that gc_collect_start didn't begin.
+    if (MP_STATE_MEM(gc_stats_collect_start_us) != 0) {
+        mp_gc_stats_t *stats = &MP_STATE_MEM(gc_stats);
+        uint32_t pause_us = MICROPY_GC_STATS_TICKS_US() - MP_STATE_MEM(gc_stats_collect_start_us);
+        stats->collections++;
+        stats->total_pause_us += pause_us;
+        if (pause_us > stats->max_pause_us) {
+            stats->max_pause_us = pause_us;
+        }
+        MP_STATE_MEM(gc_stats_collect_start_us) = 0;
+    }
+    #endif
     GC_EXIT();
+    #if MICROPY_GC_DEFERRED_FINALISERS
+    if (!MP_STATE_MEM(gc_finaliser_defer)) {
+        gc_run_finalisers(SIZE_MAX);
+    }
+    #endif
+}
+
+void gc_collect_end(void) {
+    gc_collect_finish(true);
 }
 
 void gc_sweep_all(void) {
+    #if MICROPY_GC_DEFERRED_FINALISERS
+    // Nothing is marked, so objects still queued would be freed by the sweep.
+    gc_run_finalisers(SIZE_MAX);
+    #endif
     GC_ENTER();
     MP_STATE_THREAD(gc_lock_depth)++;
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_pending(SIZE_MAX, 0);
+    #endif
     MP_STATE_MEM(gc_stack_overflow) = 0;
-    gc_collect_end();
+    gc_collect_finish(false);
+}
+
+#if MICROPY_GC_STATS
+uint64_t gc_stats(mp_gc_stats_t *stats, bool reset) {
+    GC_ENTER();
+    uint64_t now = MICROPY_GC_STATS_TICKS_US();
+    *stats = MP_STATE_MEM(gc_stats);
+    if (reset) {
+        memset(&MP_STATE_MEM(gc_stats), 0, sizeof(mp_gc_stats_t));
+        MP_STATE_MEM(gc_stats).since_us = now;
+    }
+    GC_EXIT();
+    return now > stats->since_us ? now - stats->since_us : 1;
+}
+
+size_t gc_info_fragmentation(const gc_info_t *info) {
+    if (info->free == 0) {
+        return 0;
+    }
+    return 100 - info->max_free * BYTES_PER_BLOCK * 100 / info->free;
 }
+#endif
 
 void gc_info(gc_info_t *info) {
     GC_ENTER();
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_pending(SIZE_MAX, 0);
+    #endif
     info->total = 0;
     info->used = 0;
     info->free = 0;
@@ -759,6 +1210,374 @@ void gc_info(gc_info_t *info) {
     GC_EXIT();
 }
 
+#if MICROPY_GC_ALLOC_SITES
+// The site of an allocation made now. Allocations made for gc.census itself
+// are given the site "census" so that they can be left out of later ones.
+STATIC mp_gc_site_t gc_current_site(void) {
+    mp_gc_site_t site = { MP_QSTRnull, 0, 0 };
+    const mp_code_state_t *code_state = MP_STATE_THREAD(current_code_state);
+    if (MP_STATE_MEM(gc_census_active)) {
+        site.fun = MP_QSTR_census;
+    } else if (code_state != NULL) {
+        const byte *ip = code_state->fun_bc->bytecode;
+        MP_BC_PRELUDE_SIG_DECODE(ip);
+        MP_BC_PRELUDE_SIZE_DECODE(ip);
+        qstr fun = mp_decode_uint_value(ip);
+        #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+        fun = code_state->fun_bc->context->constants.qstr_table[fun];
+        #endif
+        site.fun = fun;
+        if (code_state->ip > code_state->fun_bc->bytecode) {
+            site.offset = MIN(code_state->ip - code_state->fun_bc->bytecode, 0x7fff);
+        }
+    }
+    return site;
+}
+
+void gc_site_set_is_obj(void *ptr) {
+    #if MICROPY_GC_SPLIT_HEAP
+    mp_state_mem_area_t *area = gc_get_ptr_area(ptr);
+    if (area == NULL) {
+        return;
+    }
+    #else
+    if (!VERIFY_PTR(ptr)) {
+        return;
+    }
+    mp_state_mem_area_t *area = &MP_STATE_MEM(area);
+    #endif
+    area->gc_site_table_start[BLOCK_FROM_PTR(area, ptr)].is_obj = 1;
+}
+
+// The type of the allocation at block, if it's an object of a type that can
+// be recognised without following a pointer that might not be one.
+STATIC const mp_obj_type_t *gc_census_type(mp_state_mem_area_t *area, size_t block) {
+    static const mp_obj_type_t *const known_types[] = {
+        &mp_type_type, &mp_type_list, &mp_type_dict, &mp_type_tuple, &mp_type_str,
+        &mp_type_bytes, &mp_type_int, &mp_type_fun_bc,
+        #if MICROPY_PY_BUILTINS_BYTEARRAY
+        &mp_type_bytearray,
+        #endif
+        #if MICROPY_PY_BUILTINS_SET
+        &mp_type_set,
+        #endif
+        #if MICROPY_PY_BUILTINS_FLOAT
+        &mp_type_float,
+        #endif
+    };
+    const mp_obj_type_t *type = *(const mp_obj_type_t **)PTR_FROM_BLOCK(area, block);
+    if (area->gc_site_table_start[block].is_obj) {
+        return type;
+    }
+    for (size_t i = 0; i < MP_ARRAY_SIZE(known_types); i++) {
+        if (type == known_types[i]) {
+            return type;
+        }
+    }
+    // Instances of classes defined in Python point to a type on the heap.
+    #if MICROPY_GC_SPLIT_HEAP
+    mp_state_mem_area_t *type_area = gc_get_ptr_area(type);
+    if (type_area == NULL) {
+        return NULL;
+    }
+    #else
+    if (!VERIFY_PTR(type)) {
+        return NULL;
+    }
+    mp_state_mem_area_t *type_area = area;
+    #endif
+    if (ATB_GET_KIND(type_area, BLOCK_FROM_PTR(type_area, type)) == AT_HEAD && type->base.type == &mp_type_type) {
+        return type;
+    }
+    return NULL;
+}
+
+size_t gc_census(gc_census_entry_t *entries, size_t max_entries) {
+    size_t len = 0;
+    GC_ENTER();
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_pending(SIZE_MAX, 0);
+    #endif
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        for (size_t block = 0; block < area->gc_alloc_table_byte_len * BLOCKS_PER_ATB; block++) {
+            if (ATB_GET_KIND(area, block) != AT_HEAD) {
+                continue;
+            }
+            size_t n_blocks = 1;
+            while (ATB_GET_KIND(area, block + n_blocks) == AT_TAIL) {
+                n_blocks++;
+            }
+            mp_gc_site_t site = area->gc_site_table_start[block];
+            if (site.fun == MP_QSTR_census) {
+                block += n_blocks - 1;
+                continue;
+            }
+            const mp_obj_type_t *type = gc_census_type(area, block);
+            gc_census_entry_t *e = entries;
+            while (e < entries + len && (e->type != type || e->fun != site.fun || e->offset != site.offset)) {
+                e++;
+            }
+            if (e == entries + len) {
+                if (len == max_entries) {
+                    e = &entries[max_entries - 1];
+                } else {
+                    if (len == max_entries - 1) {
+                        // Start the entry that takes the rest.
+                        type = NULL;
+                        site.fun = MP_QSTRnull;
+                        site.offset = 0;
+                    }
+                    e->type = type;
+                    e->fun = site.fun;
+                    e->offset = site.offset;
+                    e->count = 0;
+                    e->n_bytes = 0;
+                    len++;
+                }
+            }
+            e->count++;
+            e->n_bytes += n_blocks * BYTES_PER_BLOCK;
+            block += n_blocks - 1;
+        }
+    }
+    GC_EXIT();
+    return len;
+}
+#endif
+
+#if MICROPY_GC_ARENA
+bool gc_arena_begin(size_t n_bytes, mp_gc_arena_t *saved) {
+    size_t n_blocks = MAX(1, (n_bytes + BYTES_PER_BLOCK - 1) / BYTES_PER_BLOCK);
+    GC_ENTER();
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // Unswept garbage would otherwise break up the free runs.
+    gc_sweep_pending(SIZE_MAX, 0);
+    #endif
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        #if MICROPY_GC_SPLIT_HEAP && MICROPY_GC_NURSERY_MAX_BLOCKS
+        // Leave the nursery to allocations made outside the arena.
+        if (area == &MP_STATE_MEM(area) && NEXT_AREA(area) != NULL) {
+            continue;
+        }
+        #endif
+        size_t n_free = 0;
+        for (size_t block = 0; block < area->gc_alloc_table_byte_len * BLOCKS_PER_ATB; block++) {
+            if (ATB_GET_KIND(area, block) != AT_FREE) {
+                n_free = 0;
+            } else if (++n_free == n_blocks) {
+                *saved = MP_STATE_MEM(gc_arena);
+                MP_STATE_MEM(gc_arena).area = area;
+                MP_STATE_MEM(gc_arena).next_block = block + 1 - n_blocks;
+                MP_STATE_MEM(gc_arena).end_block = block + 1;
+                GC_EXIT();
+                return true;
+            }
+        }
+    }
+    GC_EXIT();
+    return false;
+}
+
+void gc_arena_end(const mp_gc_arena_t *saved) {
+    GC_ENTER();
+    MP_STATE_MEM(gc_arena) = *saved;
+    GC_EXIT();
+}
+
+// Take n_blocks free blocks from the active arena, moving on past them. Blocks
+// in the arena may also have been used by allocations that didn't fit in it,
+// or by objects outside it growing in place, so they are checked as it goes.
+STATIC bool gc_arena_take(size_t n_blocks, mp_state_mem_area_t **area_out, size_t *block_out) {
+    mp_gc_arena_t *arena = &MP_STATE_MEM(gc_arena);
+    size_t n_free = 0;
+    for (size_t block = arena->next_block; block < arena->end_block; block++) {
+        if (ATB_GET_KIND(arena->area, block) != AT_FREE) {
+            n_free = 0;
+        } else if (++n_free == n_blocks) {
+            *area_out = arena->area;
+            *block_out = block + 1 - n_blocks;
+            arena->next_block = block + 1;
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
+#if MICROPY_GC_COMPACT
+// Find storage that could be moved: the item arrays of lists and the tables of
+// dicts that have free blocks before them, taking those furthest into the
+// heap if there are too many. Owners are only
+// recognised by their type, so the owner and its storage also have to be
+// allocations of exactly the size that such objects use.
+STATIC size_t gc_compact_find(mp_gc_compact_entry_t *entries) {
+    size_t len = 0;
+    // Move the free index up to the first free block, to skip storage that has
+    // nothing free before it.
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        size_t i = area->gc_last_free_atb_index;
+        for (; i < area->gc_alloc_table_byte_len; i++) {
+            byte a = area->gc_alloc_table_start[i];
+            if (ATB_0_IS_FREE(a) || ATB_1_IS_FREE(a) || ATB_2_IS_FREE(a) || ATB_3_IS_FREE(a)) {
+                break;
+            }
+        }
+        area->gc_last_free_atb_index = i;
+    }
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        for (size_t block = 0; block < area->gc_alloc_table_byte_len * BLOCKS_PER_ATB; block++) {
+            if (ATB_GET_KIND(area, block) != AT_HEAD || ATB_GET_KIND(area, block + 1) == AT_TAIL) {
+                continue;
+            }
+            void **owner = (void **)PTR_FROM_BLOCK(area, block);
+            size_t owner_word;
+            size_t n_bytes;
+            if (owner[0] == &mp_type_list) {
+                owner_word = offsetof(mp_obj_list_t, items) / sizeof(void *);
+                n_bytes = ((mp_obj_list_t *)owner)->alloc * sizeof(mp_obj_t);
+            } else if (owner[0] == &mp_type_dict
+                       #if MICROPY_PY_COLLECTIONS_ORDEREDDICT
+                       || owner[0] == &mp_type_ordereddict
+                       #endif
+                       ) {
+                mp_map_t *map = &((mp_obj_dict_t *)owner)->map;
+                if (map->is_fixed) {
+                    continue;
+                }
+                owner_word = offsetof(mp_obj_dict_t, map.table) / sizeof(void *);
+                n_bytes = mp_map_table_nbytes(map);
+            } else {
+                continue;
+            }
+
+            void *ptr = owner[owner_word];
+            #if MICROPY_GC_SPLIT_HEAP
+            mp_state_mem_area_t *ptr_area = gc_get_ptr_area(ptr);
+            if (ptr_area == NULL) {
+                continue;
+            }
+            #else
+            if (!VERIFY_PTR(ptr)) {
+                continue;
+            }
+            mp_state_mem_area_t *ptr_area = area;
+            #endif
+            size_t ptr_block = BLOCK_FROM_PTR(ptr_area, ptr);
+            size_t n_blocks = (n_bytes + BYTES_PER_BLOCK - 1) / BYTES_PER_BLOCK;
+            if (n_blocks == 0 || ptr_block < ptr_area->gc_last_free_atb_index * BLOCKS_PER_ATB
+                || ATB_GET_KIND(ptr_area, ptr_block) != AT_HEAD
+                || ATB_GET_KIND(ptr_area, ptr_block + n_blocks) == AT_TAIL) {
+                continue;
+            }
+            size_t n = 1;
+            while (n < n_blocks && ATB_GET_KIND(ptr_area, ptr_block + n) == AT_TAIL) {
+                n++;
+            }
+            if (n != n_blocks) {
+                continue;
+            }
+
+            // Keep the storage that is furthest in when the table is full.
+            mp_gc_compact_entry_t *e = &entries[len];
+            if (len == MICROPY_GC_COMPACT_MAX_MOVES) {
+                e = &entries[0];
+                for (size_t i = 1; i < len; i++) {
+                    if (PTR_FROM_BLOCK(entries[i].area, entries[i].block) < PTR_FROM_BLOCK(e->area, e->block)) {
+                        e = &entries[i];
+                    }
+                }
+                if ((uintptr_t)ptr < PTR_FROM_BLOCK(e->area, e->block)) {
+                    continue;
+                }
+            } else {
+                len++;
+            }
+            e->area = ptr_area;
+            e->owner_area = area;
+            e->owner_block = block;
+            e->owner_word = owner_word;
+            e->block = ptr_block;
+            e->n_blocks = n_blocks;
+            e->refs = 0;
+        }
+    }
+    return len;
+}
+
+// Move the storage to the lowest free run in its area before it, if any.
+STATIC bool gc_compact_move(const mp_gc_compact_entry_t *e) {
+    mp_state_mem_area_t *area = e->area;
+    void **owner = (void **)PTR_FROM_BLOCK(e->owner_area, e->owner_block);
+    void *src = (void *)PTR_FROM_BLOCK(area, e->block);
+    if (ATB_GET_KIND(e->owner_area, e->owner_block) != AT_HEAD || owner[e->owner_word] != src) {
+        // The owner was collected, or has replaced its storage.
+        return false;
+    }
+    size_t n_free = 0;
+    for (size_t block = 0; block < e->block; block++) {
+        if (ATB_GET_KIND(area, block) != AT_FREE) {
+            n_free = 0;
+        } else if (++n_free == e->n_blocks) {
+            size_t dest_block = block + 1 - e->n_blocks;
+            void *dest = (void *)PTR_FROM_BLOCK(area, dest_block);
+            memcpy(dest, src, e->n_blocks * BYTES_PER_BLOCK);
+            #if MICROPY_GC_ALLOC_SITES
+            area->gc_site_table_start[dest_block] = area->gc_site_table_start[e->block];
+            #endif
+            ATB_FREE_TO_HEAD(area, dest_block);
+            for (size_t bl = 1; bl < e->n_blocks; bl++) {
+                ATB_FREE_TO_TAIL(area, dest_block + bl);
+            }
+            for (size_t bl = 0; bl < e->n_blocks; bl++) {
+                ATB_ANY_TO_FREE(area, e->block + bl);
+            }
+            owner[e->owner_word] = dest;
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t gc_compact(void) {
+    if (MP_STATE_THREAD(gc_lock_depth) > 0) {
+        return 0;
+    }
+
+    // With only live objects left, pick the storage to consider, then count
+    // every reference to it with a second collection. Storage referenced
+    // from its owner alone can be moved, as long as nothing outside the heap
+    // and its roots points into it.
+    mp_gc_compact_entry_t entries[MICROPY_GC_COMPACT_MAX_MOVES];
+    gc_collect();
+    GC_ENTER();
+    size_t len = gc_compact_find(entries);
+    GC_EXIT();
+    if (len == 0) {
+        return 0;
+    }
+    MP_STATE_MEM(gc_compact_entries) = entries;
+    MP_STATE_MEM(gc_compact_len) = len;
+    gc_collect();
+    MP_STATE_MEM(gc_compact_len) = 0;
+
+    GC_ENTER();
+    size_t moved = 0;
+    for (size_t i = 0; i < len; i++) {
+        if (entries[i].refs == 1 && gc_compact_move(&entries[i])) {
+            moved++;
+        }
+    }
+    #if MICROPY_GC_SPLIT_HEAP
+    MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
+    #endif
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        area->gc_last_free_atb_index = 0;
+    }
+    GC_EXIT();
+    return moved;
+}
+#endif
+
 // CIRCUITPY-CHANGE
 bool gc_alloc_possible(void) {
     #if MICROPY_GC_SPLIT_HEAP
@@ -783,6 +1602,10 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
         return NULL;
     }
 
+    #if MICROPY_GC_DEFERRED_FINALISERS
+    gc_run_finalisers(MICROPY_GC_FINALISER_BUDGET);
+    #endif
+
     GC_ENTER();
 
     mp_state_mem_area_t *area;
@@ -794,16 +1617,52 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
     #if MICROPY_GC_SPLIT_HEAP_AUTO
     bool added = false;
     #endif
+    #if MICROPY_GC_COMPACT
+    bool compacted = false;
+    #endif
+    #if MICROPY_GC_SPLIT_HEAP && MICROPY_GC_NURSERY_MAX_BLOCKS
+    bool use_nursery = n_blocks <= MICROPY_GC_NURSERY_MAX_BLOCKS || NEXT_AREA(&MP_STATE_MEM(area)) == NULL;
+    #endif
+    #if MICROPY_GC_SPLIT_HEAP && MICROPY_GC_SLOW_AREAS
+    bool want_fast = (alloc_flags & GC_ALLOC_FLAG_FAST) || n_blocks < MICROPY_GC_SLOW_AREA_MIN_BLOCKS;
+    // Only look at areas with the wanted speed until none of them has room.
+    bool placed = true;
+    #endif
+
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_pending(MICROPY_GC_SWEEP_STEP_BLOCKS, 0);
+    #endif
 
     #if MICROPY_GC_ALLOC_THRESHOLD
     if (!collected && MP_STATE_MEM(gc_alloc_amount) >= MP_STATE_MEM(gc_alloc_threshold)) {
         GC_EXIT();
-        gc_collect();
+        gc_collect_deferring_sweep();
         collected = 1;
         GC_ENTER();
     }
     #endif
 
+    #if MICROPY_GC_SPLIT_HEAP && MICROPY_GC_SLOW_AREAS
+    // The arena and size classes don't know which area they will return, so
+    // an explicitly fast allocation skips them.
+    if (!(alloc_flags & GC_ALLOC_FLAG_FAST))
+    #endif
+    {
+        #if MICROPY_GC_ARENA
+        if (MP_STATE_MEM(gc_arena).area != NULL && gc_arena_take(n_blocks, &area, &start_block)) {
+            end_block = start_block + n_blocks - 1;
+            goto claim;
+        }
+        #endif
+
+        #if MICROPY_GC_SIZE_CLASSES
+        if (n_blocks <= 4 && gc_size_class_take(n_blocks, &area, &start_block)) {
+            end_block = start_block + n_blocks - 1;
+            goto claim;
+        }
+        #endif
+    }
+
     for (;;) {
 
         #if MICROPY_GC_SPLIT_HEAP
@@ -819,6 +1678,16 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
 
         // look for a run of n_blocks available blocks
         for (; area != NULL; area = NEXT_AREA(area), i = 0) {
+            #if MICROPY_GC_SPLIT_HEAP && MICROPY_GC_NURSERY_MAX_BLOCKS
+            if (area == &MP_STATE_MEM(area) && !use_nursery) {
+                continue;
+            }
+            #endif
+            #if MICROPY_GC_SPLIT_HEAP && MICROPY_GC_SLOW_AREAS
+            if (placed && area->slow == want_fast) {
+                continue;
+            }
+            #endif
             n_free = 0;
             for (i = area->gc_last_free_atb_index; i < area->gc_alloc_table_byte_len; i++) {
                 MICROPY_GC_HOOK_LOOP(i);
@@ -841,9 +1710,47 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
             #endif
         }
 
+        #if MICROPY_GC_SPLIT_HEAP && MICROPY_GC_SLOW_AREAS
+        if (placed) {
+            // No area of the wanted speed has room, so try the others too.
+            placed = false;
+            continue;
+        }
+        #endif
+
+        #if MICROPY_GC_SPLIT_HEAP && MICROPY_GC_NURSERY_MAX_BLOCKS
+        if (!use_nursery) {
+            // Nowhere else has room, so try the nursery as well.
+            use_nursery = true;
+            MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
+            continue;
+        }
+        #endif
+
+        #if MICROPY_GC_SPLIT_HEAP && MICROPY_GC_SLOW_AREAS
+        // Freed or added space may have room of the wanted speed again.
+        placed = true;
+        #endif
+
+        #if MICROPY_GC_INCREMENTAL_SWEEP
+        if (MP_STATE_MEM(gc_sweep).area != NULL) {
+            // Sweep until there's a free run that might be long enough.
+            gc_sweep_pending(SIZE_MAX, n_blocks);
+            continue;
+        }
+        #endif
+
         GC_EXIT();
         // nothing found!
         if (collected) {
+            #if MICROPY_GC_DEFERRED_FINALISERS
+            if (MP_STATE_MEM(gc_finaliser_queue_len) > 0) {
+                // The objects waiting for finalisers may free enough.
+                gc_run_finalisers(SIZE_MAX);
+                GC_ENTER();
+                continue;
+            }
+            #endif
             #if MICROPY_GC_SPLIT_HEAP_AUTO
             if (!added && gc_try_add_heap(n_bytes)) {
                 added = true;
@@ -851,13 +1758,23 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
             }
             #endif
 
+            #if MICROPY_GC_COMPACT
+            if (!compacted && n_blocks > 1) {
+                compacted = true;
+                if (gc_compact() > 0) {
+                    GC_ENTER();
+                    continue;
+                }
+            }
+            #endif
+
             #if CIRCUITPY_DEBUG
             gc_dump_alloc_table(&mp_plat_print);
             #endif
             return NULL;
         }
         DEBUG_printf("gc_alloc(" UINT_FMT "): no free mem, triggering GC\n", n_bytes);
-        gc_collect();
+        gc_collect_deferring_sweep();
         collected = 1;
         GC_ENTER();
     }
@@ -880,6 +1797,10 @@ found:
         area->gc_last_free_atb_index = (i + 1) / BLOCKS_PER_ATB;
     }
 
+    #if MICROPY_GC_SIZE_CLASSES || MICROPY_GC_ARENA
+claim:
+    #endif
+
     // CIRCUITPY-CHANGE
     #ifdef LOG_HEAP_ACTIVITY
     gc_log_change(start_block, end_block - start_block + 1);
@@ -887,8 +1808,17 @@ found:
 
     area->gc_last_used_block = MAX(area->gc_last_used_block, end_block);
 
+    #if MICROPY_GC_ALLOC_SITES
+    area->gc_site_table_start[start_block] = gc_current_site();
+    #endif
+
     // mark first block as used head
     ATB_FREE_TO_HEAD(area, start_block);
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    if (gc_sweep_claim(area, start_block, end_block)) {
+        ATB_HEAD_TO_MARK(area, start_block);
+    }
+    #endif
 
     // mark rest of blocks as used tail
     // TODO for a run of many blocks can make this more efficient
@@ -905,6 +1835,11 @@ found:
     MP_STATE_MEM(gc_alloc_amount) += n_blocks;
     #endif
 
+    #if MICROPY_GC_STATS
+    MP_STATE_MEM(gc_stats).allocs++;
+    MP_STATE_MEM(gc_stats).alloc_bytes += n_bytes;
+    #endif
+
     GC_EXIT();
 
     #if MICROPY_GC_CONSERVATIVE_CLEAR
@@ -988,7 +1923,7 @@ void gc_free(void *ptr) {
     #endif
 
     size_t block = BLOCK_FROM_PTR(area, ptr);
-    assert(ATB_GET_KIND(area, block) == AT_HEAD);
+    assert(ATB_IS_LIVE_HEAD(area, block));
 
     #if MICROPY_ENABLE_FINALISER
     FTB_CLEAR(area, block);
@@ -1048,7 +1983,7 @@ size_t gc_nbytes(const void *ptr) {
 
     if (area) {
         size_t block = BLOCK_FROM_PTR(area, ptr);
-        if (ATB_GET_KIND(area, block) == AT_HEAD) {
+        if (ATB_IS_LIVE_HEAD(area, block)) {
             // work out number of consecutive blocks in the chain starting with this on
             size_t n_blocks = 0;
             do {
@@ -1123,7 +2058,7 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     area = &MP_STATE_MEM(area);
     #endif
     size_t block = BLOCK_FROM_PTR(area, ptr);
-    assert(ATB_GET_KIND(area, block) == AT_HEAD);
+    assert(ATB_IS_LIVE_HEAD(area, block));
 
     // compute number of new blocks that are requested
     size_t new_blocks = (n_bytes + BYTES_PER_BLOCK - 1) / BYTES_PER_BLOCK;
@@ -1207,6 +2142,9 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
         }
 
         area->gc_last_used_block = MAX(area->gc_last_used_block, end_block);
+        #if MICROPY_GC_INCREMENTAL_SWEEP
+        gc_sweep_claim(area, block + n_blocks, end_block - 1);
+        #endif
 
         GC_EXIT();
 
@@ -1276,6 +2214,9 @@ void gc_dump_info(const mp_print_t *print) {
 
 void gc_dump_alloc_table(const mp_print_t *print) {
     GC_ENTER();
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_pending(SIZE_MAX, 0);
+    #endif
     static const size_t DUMP_BYTES_PER_LINE = 64;
     for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
         #if !EXTENSIVE_HEAP_PROFILING
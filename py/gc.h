@@ -72,6 +72,10 @@ void gc_sweep_all(void);
 
 enum {
     GC_ALLOC_FLAG_HAS_FINALISER = 1,
+    #if MICROPY_GC_SPLIT_HEAP && MICROPY_GC_SLOW_AREAS
+    // Prefer fast memory whatever the size, see MICROPY_GC_SLOW_AREAS.
+    GC_ALLOC_FLAG_FAST = 2,
+    #endif
 };
 
 void *gc_alloc(size_t n_bytes, unsigned int alloc_flags);
@@ -80,6 +84,38 @@ size_t gc_nbytes(const void *ptr);
 bool gc_has_finaliser(const void *ptr);
 void *gc_realloc(void *ptr, size_t n_bytes, bool allow_move);
 
+#if MICROPY_GC_ARENA
+// Serve allocations from a free run of at least n_bytes first, until
+// gc_arena_end is called with the state saved here. Returns false if there is
+// no such run.
+bool gc_arena_begin(size_t n_bytes, mp_gc_arena_t *saved);
+void gc_arena_end(const mp_gc_arena_t *saved);
+#endif
+
+#if MICROPY_GC_ALLOC_SITES
+// Record that ptr, just allocated, is an object whose first word is its type.
+void gc_site_set_is_obj(void *ptr);
+
+typedef struct _gc_census_entry_t {
+    const mp_obj_type_t *type; // NULL if not known
+    qstr fun; // MP_QSTRnull if not made from Python code
+    size_t offset;
+    size_t count;
+    size_t n_bytes;
+} gc_census_entry_t;
+
+// Group the allocated heap by type and allocation site, returning the number
+// of entries used. If there are more than max_entries groups, the last entry
+// also takes the rest, with no type or site.
+size_t gc_census(gc_census_entry_t *entries, size_t max_entries);
+#endif
+
+#if MICROPY_GC_COMPACT
+// Run a collection and then move storage that only its owner refers to into
+// lower free blocks. Returns the number of allocations moved.
+size_t gc_compact(void);
+#endif
+
 // CIRCUITPY-CHANGE
 // Prevents a pointer from ever being freed because it establishes a permanent reference to it. Use
 // very sparingly because it can leak memory.
@@ -107,4 +143,12 @@ void gc_info(gc_info_t *info);
 void gc_dump_info(const mp_print_t *print);
 void gc_dump_alloc_table(const mp_print_t *print);
 
+#if MICROPY_GC_STATS
+// Copy the running totals, then restart them from now if reset is true.
+// Returns the microseconds the totals cover, at least 1.
+uint64_t gc_stats(mp_gc_stats_t *stats, bool reset);
+// Percentage of the free heap that lies outside its largest free run.
+size_t gc_info_fragmentation(const gc_info_t *info);
+#endif
+
 #endif // MICROPY_INCLUDED_PY_GC_H
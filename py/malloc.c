@@ -123,6 +123,23 @@ void *m_malloc_with_finaliser(size_t num_bytes) {
 }
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_ENABLE_GC && MICROPY_GC_SPLIT_HEAP && MICROPY_GC_SLOW_AREAS
+void *m_malloc_fast(size_t num_bytes) {
+    void *ptr = gc_alloc(num_bytes, GC_ALLOC_FLAG_FAST);
+    if (ptr == NULL && num_bytes != 0) {
+        m_malloc_fail(num_bytes);
+    }
+    #if MICROPY_MEM_STATS
+    MP_STATE_MEM(total_bytes_allocated) += num_bytes;
+    MP_STATE_MEM(current_bytes_allocated) += num_bytes;
+    UPDATE_PEAK();
+    #endif
+    DEBUG_printf("malloc %d : %p\n", num_bytes, ptr);
+    return ptr;
+}
+#endif
+
 void *m_malloc0(size_t num_bytes) {
     void *ptr = m_malloc(num_bytes);
     // If this config is set then the GC clears all memory, so we don't need to.
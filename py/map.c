@@ -61,6 +61,19 @@
 #define MAP_CACHE_SET(index, pos)
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_LOAD_GLOBAL_CACHE
+// Called when a key is added to map, or its table is freed. Removing a key
+// doesn't need it: mp_load_global checks that the cached slot still holds it.
+#define MAP_KEYS_CHANGED(map) do { \
+        if ((map)->is_watched) { \
+            mp_load_global_cache_invalidate(); \
+        } \
+} while (0)
+#else
+#define MAP_KEYS_CHANGED(map)
+#endif
+
 // This table of sizes is used to control the growth of hash tables.
 // The first set of sizes are chosen so the allocation fits exactly in a
 // 4-word GC block, and it's not so important for these small values to be
@@ -83,6 +96,135 @@ STATIC size_t get_hash_alloc_greater_or_equal_to(size_t x) {
     return (x + x / 2) | 1;
 }
 
+#if MICROPY_MAP_COMPACT
+// CIRCUITPY-CHANGE
+// The table of a map that is neither fixed nor ordered holds its entries
+// densely, in insertion order.  Entries that were removed keep the
+// MP_OBJ_SENTINEL key until the table is rehashed, and the unused entries at
+// the end have a NULL key.  Removed entries at the end are trimmed back to
+// unused ones.  Maps with more than MAP_LINEAR_MAX entries also have a hash
+// index after the entries, in the same allocation.  Each index slot holds
+// MAP_INDEX_EMPTY, MAP_INDEX_DELETED or 1 + the position of an entry, and is 1,
+// 2 or 4 bytes wide depending on the size of the table.  Smaller maps are
+// searched linearly.
+
+#define MAP_LINEAR_MAX (8)
+#define MAP_INDEX_EMPTY (0)
+#define MAP_INDEX_DELETED(width) ((size_t)0xffffffff >> (32 - 8 * (width)))
+
+typedef struct _map_index_t {
+    size_t filled; // number of entries in use or removed at the start of the table
+    size_t used; // number of slots that aren't empty
+    size_t mask; // number of slots - 1
+    byte slots[];
+} map_index_t;
+
+STATIC size_t map_index_len(size_t alloc) {
+    if (alloc <= MAP_LINEAR_MAX) {
+        return 0;
+    }
+    // A power of two so that probing can wrap with a mask, at least 1.5 times
+    // the number of entries so that probe sequences stay short.
+    size_t len = 16;
+    while (len < alloc + alloc / 2) {
+        len <<= 1;
+    }
+    return len;
+}
+
+STATIC size_t map_index_width(size_t alloc) {
+    // MAP_INDEX_DELETED must not be a valid entry position.
+    return alloc < 0xff ? 1 : alloc < 0xffff ? 2 : 4;
+}
+
+STATIC size_t map_table_nbytes(size_t alloc) {
+    size_t nbytes = alloc * sizeof(mp_map_elem_t);
+    size_t len = map_index_len(alloc);
+    if (len != 0) {
+        nbytes += sizeof(map_index_t) + len * map_index_width(alloc);
+    }
+    return nbytes;
+}
+
+static inline map_index_t *map_get_index(const mp_map_t *map) {
+    return (map_index_t *)&map->table[map->alloc];
+}
+
+STATIC size_t map_index_get(const byte *slots, size_t width, size_t pos) {
+    if (width == 1) {
+        return slots[pos];
+    } else if (width == 2) {
+        return ((const uint16_t *)slots)[pos];
+    } else {
+        return ((const uint32_t *)slots)[pos];
+    }
+}
+
+STATIC void map_index_set(byte *slots, size_t width, size_t pos, size_t value) {
+    if (width == 1) {
+        slots[pos] = value;
+    } else if (width == 2) {
+        ((uint16_t *)slots)[pos] = value;
+    } else {
+        ((uint32_t *)slots)[pos] = value;
+    }
+}
+
+STATIC mp_uint_t map_hash(mp_obj_t index) {
+    // fast path for common case of qstr
+    if (mp_obj_is_qstr(index)) {
+        return qstr_hash(MP_OBJ_QSTR_VALUE(index));
+    }
+    return MP_OBJ_SMALL_INT_VALUE(mp_unary_op(MP_UNARY_OP_HASH, index));
+}
+
+// Fill in the empty index of a map whose first n entries are all in use.
+STATIC void map_index_build(mp_map_t *map, size_t n) {
+    map_index_t *idx = map_get_index(map);
+    size_t width = map_index_width(map->alloc);
+    size_t mask = map_index_len(map->alloc) - 1;
+    idx->mask = mask;
+    for (size_t i = 0; i < n; i++) {
+        size_t pos = map_hash(map->table[i].key) % mask;
+        while (map_index_get(idx->slots, width, pos) != MAP_INDEX_EMPTY) {
+            pos = (pos + 1) & mask;
+        }
+        map_index_set(idx->slots, width, pos, i + 1);
+    }
+    idx->filled = n;
+    idx->used = n;
+}
+
+size_t mp_map_table_nbytes(const mp_map_t *map) {
+    // Fixed tables in ROM are always ordered. A frozen heap copy, such as an
+    // instance __dict__, keeps its index.
+    if (map->is_ordered) {
+        return map->alloc * sizeof(mp_map_elem_t);
+    }
+    return map_table_nbytes(map->alloc);
+}
+
+mp_map_elem_t *mp_map_last(mp_map_t *map) {
+    assert(!map->is_fixed && !map->is_ordered);
+    size_t n;
+    if (map->alloc > MAP_LINEAR_MAX) {
+        n = map_get_index(map)->filled;
+    } else {
+        for (n = 0; n < map->alloc && map->table[n].key != MP_OBJ_NULL; n++) {
+        }
+    }
+    // removed entries at the end are always trimmed, so this one is in use
+    return n == 0 ? NULL : &map->table[n - 1];
+}
+
+#else
+
+size_t mp_map_table_nbytes(const mp_map_t *map) {
+    return map->alloc * sizeof(mp_map_elem_t);
+}
+
+#endif
+
 /******************************************************************************/
 /* map                                                                        */
 
@@ -92,12 +234,21 @@ void mp_map_init(mp_map_t *map, size_t n) {
         map->table = NULL;
     } else {
         map->alloc = n;
+        // CIRCUITPY-CHANGE
+        #if MICROPY_MAP_COMPACT
+        map->table = m_malloc0(map_table_nbytes(n));
+        if (n > MAP_LINEAR_MAX) {
+            map_index_build(map, 0);
+        }
+        #else
         map->table = m_new0(mp_map_elem_t, map->alloc);
+        #endif
     }
     map->used = 0;
     map->all_keys_are_qstrs = 1;
     map->is_fixed = 0;
     map->is_ordered = 0;
+    map->is_watched = 0;
 }
 
 void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table) {
@@ -106,20 +257,23 @@ void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table) {
     map->all_keys_are_qstrs = 1;
     map->is_fixed = 1;
     map->is_ordered = 1;
+    map->is_watched = 0;
     map->table = (mp_map_elem_t *)table;
 }
 
 // Differentiate from mp_map_clear() - semantics is different
 void mp_map_deinit(mp_map_t *map) {
+    MAP_KEYS_CHANGED(map);
     if (!map->is_fixed) {
-        m_del(mp_map_elem_t, map->table, map->alloc);
+        m_del(byte, map->table, mp_map_table_nbytes(map));
     }
     map->used = map->alloc = 0;
 }
 
 void mp_map_clear(mp_map_t *map) {
+    MAP_KEYS_CHANGED(map);
     if (!map->is_fixed) {
-        m_del(mp_map_elem_t, map->table, map->alloc);
+        m_del(byte, map->table, mp_map_table_nbytes(map));
     }
     map->alloc = 0;
     map->used = 0;
@@ -128,6 +282,157 @@ void mp_map_clear(mp_map_t *map) {
     map->table = NULL;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_MAP_COMPACT
+STATIC void mp_map_rehash(mp_map_t *map) {
+    size_t old_alloc = map->alloc;
+    // Leave room for a quarter more entries than are in use, so that a table
+    // that is full of used and removed entries doesn't need compacting again
+    // straight away.
+    size_t new_alloc = get_hash_alloc_greater_or_equal_to(map->used + map->used / 4 + 1);
+    DEBUG_printf("mp_map_rehash(%p): " UINT_FMT " -> " UINT_FMT "\n", map, old_alloc, new_alloc);
+    mp_map_elem_t *old_table = map->table;
+    size_t old_nbytes = map_table_nbytes(old_alloc);
+    mp_map_elem_t *new_table = m_malloc0(map_table_nbytes(new_alloc));
+    // If we reach this point, table resizing succeeded, now we can edit the old map.
+    size_t n = 0;
+    map->all_keys_are_qstrs = 1;
+    for (size_t i = 0; i < old_alloc; i++) {
+        if (old_table[i].key != MP_OBJ_NULL && old_table[i].key != MP_OBJ_SENTINEL) {
+            if (!mp_obj_is_qstr(old_table[i].key)) {
+                map->all_keys_are_qstrs = 0;
+            }
+            new_table[n++] = old_table[i];
+        }
+    }
+    map->alloc = new_alloc;
+    map->table = new_table;
+    if (new_alloc > MAP_LINEAR_MAX) {
+        map_index_build(map, n);
+    }
+    m_del(byte, old_table, old_nbytes);
+}
+
+STATIC mp_map_elem_t *map_add_entry(mp_map_t *map, mp_map_elem_t *elem, mp_obj_t index) {
+    MAP_KEYS_CHANGED(map);
+    map->used++;
+    elem->key = index;
+    elem->value = MP_OBJ_NULL;
+    if (!mp_obj_is_qstr(index)) {
+        map->all_keys_are_qstrs = 0;
+    }
+    return elem;
+}
+
+// Remove an entry, keeping its value so that the caller can access it if needed.
+STATIC void map_remove_entry(mp_map_t *map, mp_map_elem_t *elem) {
+    map->used--;
+    elem->key = MP_OBJ_SENTINEL;
+    map_index_t *idx = NULL;
+    mp_map_elem_t *top = &map->table[map->alloc];
+    if (map->alloc > MAP_LINEAR_MAX) {
+        idx = map_get_index(map);
+        top = &map->table[idx->filled];
+    }
+    if (elem + 1 == top || elem[1].key == MP_OBJ_NULL) {
+        // This was the newest entry, so trim the removed entries at the end.
+        // Their index slots are all MAP_INDEX_DELETED so nothing refers to them.
+        top = elem + 1;
+        while (top > map->table && top[-1].key == MP_OBJ_SENTINEL) {
+            (--top)->key = MP_OBJ_NULL;
+        }
+        if (idx != NULL) {
+            idx->filled = top - map->table;
+        }
+    }
+}
+
+STATIC mp_map_elem_t *map_compact_lookup(mp_map_t *map, mp_obj_t index, mp_map_lookup_kind_t lookup_kind, bool compare_only_ptrs) {
+    if (map->alloc == 0) {
+        if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+            mp_map_rehash(map);
+        } else {
+            return NULL;
+        }
+    }
+
+    // A small map doesn't use the hash, but it must still be computed so that
+    // unhashable objects are rejected.
+    mp_uint_t hash = mp_obj_is_qstr(index) && map->alloc <= MAP_LINEAR_MAX ? 0 : map_hash(index);
+
+    for (;;) {
+        mp_map_elem_t *table = map->table;
+        if (map->alloc <= MAP_LINEAR_MAX) {
+            // small map, so search the entries linearly
+            mp_map_elem_t *elem = table;
+            for (mp_map_elem_t *top = &table[map->alloc]; elem < top && elem->key != MP_OBJ_NULL; elem++) {
+                if (elem->key == index || (!compare_only_ptrs && elem->key != MP_OBJ_SENTINEL && mp_obj_equal(elem->key, index))) {
+                    if (lookup_kind == MP_MAP_LOOKUP_REMOVE_IF_FOUND) {
+                        map_remove_entry(map, elem);
+                    }
+                    MAP_CACHE_SET(index, elem - table);
+                    return elem;
+                }
+            }
+            if (lookup_kind != MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+                return NULL;
+            }
+            if (elem < &table[map->alloc]) {
+                return map_add_entry(map, elem, index);
+            }
+        } else {
+            map_index_t *idx = map_get_index(map);
+            size_t width = map_index_width(map->alloc);
+            size_t mask = idx->mask;
+            size_t len = mask + 1;
+            size_t pos = hash % mask;
+            size_t avail_pos = len;
+            for (;;) {
+                size_t slot = map_index_get(idx->slots, width, pos);
+                if (slot == MAP_INDEX_EMPTY) {
+                    // index is not in table
+                    break;
+                } else if (slot == MAP_INDEX_DELETED(width)) {
+                    // found deleted slot, remember for later
+                    if (avail_pos == len) {
+                        avail_pos = pos;
+                    }
+                } else {
+                    mp_map_elem_t *elem = &table[slot - 1];
+                    if (elem->key == index || (!compare_only_ptrs && mp_obj_equal(elem->key, index))) {
+                        // Note: CPython does not replace the index; try x={True:'true'};x[1]='one';x
+                        if (lookup_kind == MP_MAP_LOOKUP_REMOVE_IF_FOUND) {
+                            map_index_set(idx->slots, width, pos, MAP_INDEX_DELETED(width));
+                            map_remove_entry(map, elem);
+                        }
+                        MAP_CACHE_SET(index, slot - 1);
+                        return elem;
+                    }
+                }
+                pos = (pos + 1) & mask;
+            }
+            if (lookup_kind != MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+                return NULL;
+            }
+            // Keeping at most alloc slots in use means there is always an empty
+            // one to end a search.
+            if (idx->filled < map->alloc && (avail_pos != len || idx->used < map->alloc)) {
+                if (avail_pos == len) {
+                    avail_pos = pos;
+                    idx->used++;
+                }
+                map_index_set(idx->slots, width, avail_pos, idx->filled + 1);
+                return map_add_entry(map, &table[idx->filled++], index);
+            }
+        }
+        // not enough room in table, or too many deleted slots in the index, so
+        // rehash it and restart the search for the new element
+        mp_map_rehash(map);
+        hash = map_hash(index);
+    }
+}
+
+#else
 STATIC void mp_map_rehash(mp_map_t *map) {
     size_t old_alloc = map->alloc;
     size_t new_alloc = get_hash_alloc_greater_or_equal_to(map->alloc + 1);
@@ -146,6 +451,7 @@ STATIC void mp_map_rehash(mp_map_t *map) {
     }
     m_del(mp_map_elem_t, old_table, old_alloc);
 }
+#endif
 
 // MP_MAP_LOOKUP behaviour:
 //  - returns NULL if not found, else the slot it was found in with key,value non-null
@@ -220,6 +526,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
             mp_seq_clear(map->table, map->used, map->alloc, sizeof(*map->table));
         }
         mp_map_elem_t *elem = map->table + map->used++;
+        MAP_KEYS_CHANGED(map);
         elem->key = index;
         elem->value = MP_OBJ_NULL;
         if (!mp_obj_is_qstr(index)) {
@@ -233,6 +540,11 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
 
     // map is a hash table (not an ordered array), so do a hash lookup
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_MAP_COMPACT
+    return map_compact_lookup(map, index, lookup_kind, compare_only_ptrs);
+    #else
+
     if (map->alloc == 0) {
         if (lookup_kind == MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
             mp_map_rehash(map);
@@ -261,6 +573,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
                 if (avail_slot == NULL) {
                     avail_slot = slot;
                 }
+                MAP_KEYS_CHANGED(map);
                 avail_slot->key = index;
                 avail_slot->value = MP_OBJ_NULL;
                 if (!mp_obj_is_qstr(index)) {
@@ -302,6 +615,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
                 if (avail_slot != NULL) {
                     // there was an available slot, so use that
                     map->used++;
+                    MAP_KEYS_CHANGED(map);
                     avail_slot->key = index;
                     avail_slot->value = MP_OBJ_NULL;
                     if (!mp_obj_is_qstr(index)) {
@@ -319,6 +633,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
             }
         }
     }
+    #endif
 }
 
 /******************************************************************************/
@@ -102,6 +102,11 @@ void *m_malloc(size_t num_bytes);
 void *m_malloc_maybe(size_t num_bytes);
 void *m_malloc_with_finaliser(size_t num_bytes);
 void *m_malloc0(size_t num_bytes);
+// CIRCUITPY-CHANGE
+#if MICROPY_ENABLE_GC && MICROPY_GC_SPLIT_HEAP && MICROPY_GC_SLOW_AREAS
+// Like m_malloc, but prefers fast memory whatever the size.
+void *m_malloc_fast(size_t num_bytes);
+#endif
 #if MICROPY_MALLOC_USES_ALLOCATED_SIZE
 void *m_realloc(void *ptr, size_t old_num_bytes, size_t new_num_bytes);
 void *m_realloc_maybe(void *ptr, size_t old_num_bytes, size_t new_num_bytes, bool allow_move);
@@ -24,13 +24,363 @@
  * THE SOFTWARE.
  */
 
+// CIRCUITPY-CHANGE
+#include <limits.h>
+#include <string.h>
+
+#include "py/binary.h"
 #include "py/builtin.h"
+#include "py/runtime.h"
 
 #if MICROPY_PY_ARRAY
 
+// CIRCUITPY-CHANGE: elementwise arithmetic, as typed C loops over the elements
+#if MICROPY_PY_ARRAY_VECTOR_OPS
+
+typedef struct {
+    void *buf;
+    size_t len;
+    char typecode;
+} array_vec_t;
+
+STATIC bool array_vec_get(mp_obj_t obj, array_vec_t *vec, mp_uint_t flags) {
+    mp_buffer_info_t bufinfo;
+    if (!mp_get_buffer(obj, &bufinfo, flags)) {
+        return false;
+    }
+    char typecode = bufinfo.typecode == BYTEARRAY_TYPECODE ? 'B' : bufinfo.typecode;
+    if (strchr("bBhHiIlLqQ"
+        #if MICROPY_PY_BUILTINS_FLOAT
+        "fd"
+        #endif
+        , typecode) == NULL || typecode == '\0') {
+        mp_raise_ValueError(MP_ERROR_TEXT("bad typecode"));
+    }
+    vec->buf = bufinfo.buf;
+    vec->len = bufinfo.len / mp_binary_get_size('@', typecode, NULL);
+    vec->typecode = typecode;
+    return true;
+}
+
+STATIC void array_vec_get_raise(mp_obj_t obj, array_vec_t *vec, mp_uint_t flags) {
+    if (!array_vec_get(obj, vec, flags)) {
+        // Let mp_get_buffer_raise give the usual error.
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(obj, &bufinfo, flags);
+    }
+}
+
+STATIC bool array_vec_is_float(const array_vec_t *vec) {
+    return vec->typecode == 'f' || vec->typecode == 'd';
+}
+
+STATIC long long array_vec_get_int(const array_vec_t *vec, size_t i) {
+    switch (vec->typecode) {
+        case 'b':
+            return ((signed char *)vec->buf)[i];
+        case 'B':
+            return ((unsigned char *)vec->buf)[i];
+        case 'h':
+            return ((short *)vec->buf)[i];
+        case 'H':
+            return ((unsigned short *)vec->buf)[i];
+        case 'i':
+            return ((int *)vec->buf)[i];
+        case 'I':
+            return ((unsigned int *)vec->buf)[i];
+        case 'l':
+            return ((long *)vec->buf)[i];
+        case 'L':
+            return ((unsigned long *)vec->buf)[i];
+        case 'q':
+            return ((long long *)vec->buf)[i];
+        case 'Q':
+            return ((unsigned long long *)vec->buf)[i];
+        #if MICROPY_PY_BUILTINS_FLOAT
+        case 'f':
+            return (long long)((float *)vec->buf)[i];
+        case 'd':
+            return (long long)((double *)vec->buf)[i];
+        #endif
+    }
+    return 0;
+}
+
+// The range of an integer typecode, limited to what long long can hold.
+STATIC void array_vec_int_range(char typecode, long long *lo, long long *hi) {
+    *lo = 0;
+    switch (typecode) {
+        case 'b':
+            *lo = SCHAR_MIN;
+            *hi = SCHAR_MAX;
+            break;
+        case 'B':
+            *hi = UCHAR_MAX;
+            break;
+        case 'h':
+            *lo = SHRT_MIN;
+            *hi = SHRT_MAX;
+            break;
+        case 'H':
+            *hi = USHRT_MAX;
+            break;
+        case 'i':
+            *lo = INT_MIN;
+            *hi = INT_MAX;
+            break;
+        case 'I':
+            *hi = UINT_MAX;
+            break;
+        case 'l':
+            *lo = LONG_MIN;
+            *hi = LONG_MAX;
+            break;
+        case 'L':
+            *hi = ULONG_MAX > LLONG_MAX ? LLONG_MAX : (long long)ULONG_MAX;
+            break;
+        case 'q':
+            *lo = LLONG_MIN;
+            *hi = LLONG_MAX;
+            break;
+        default:
+            *hi = LLONG_MAX;
+            break;
+    }
+}
+
+// Stores into an integer element, clipping to the range of its type.
+STATIC void array_vec_set_int(const array_vec_t *vec, size_t i, long long val) {
+    long long lo, hi;
+    array_vec_int_range(vec->typecode, &lo, &hi);
+    val = val < lo ? lo : val > hi ? hi : val;
+    switch (vec->typecode) {
+        case 'b':
+            ((signed char *)vec->buf)[i] = val;
+            break;
+        case 'B':
+            ((unsigned char *)vec->buf)[i] = val;
+            break;
+        case 'h':
+            ((short *)vec->buf)[i] = val;
+            break;
+        case 'H':
+            ((unsigned short *)vec->buf)[i] = val;
+            break;
+        case 'i':
+            ((int *)vec->buf)[i] = val;
+            break;
+        case 'I':
+            ((unsigned int *)vec->buf)[i] = val;
+            break;
+        case 'l':
+            ((long *)vec->buf)[i] = val;
+            break;
+        case 'L':
+            ((unsigned long *)vec->buf)[i] = val;
+            break;
+        case 'q':
+            ((long long *)vec->buf)[i] = val;
+            break;
+        case 'Q':
+            ((unsigned long long *)vec->buf)[i] = val;
+            break;
+    }
+}
+
+#if MICROPY_PY_BUILTINS_FLOAT
+STATIC mp_float_t array_vec_get_float(const array_vec_t *vec, size_t i) {
+    switch (vec->typecode) {
+        case 'f':
+            return ((float *)vec->buf)[i];
+        case 'd':
+            return ((double *)vec->buf)[i];
+        default:
+            return (mp_float_t)array_vec_get_int(vec, i);
+    }
+}
+
+// Stores into any element; integer elements get the value clipped and truncated.
+STATIC void array_vec_set_float(const array_vec_t *vec, size_t i, mp_float_t val) {
+    switch (vec->typecode) {
+        case 'f':
+            ((float *)vec->buf)[i] = (float)val;
+            break;
+        case 'd':
+            ((double *)vec->buf)[i] = val;
+            break;
+        default: {
+            long long lo, hi;
+            array_vec_int_range(vec->typecode, &lo, &hi);
+            if (val != val) {
+                val = 0;
+            }
+            array_vec_set_int(vec, i, val <= (mp_float_t)lo ? lo : val >= (mp_float_t)hi ? hi : (long long)val);
+            break;
+        }
+    }
+}
+#endif
+
+// target[i] = target[i] + other[i] (or * for mul), where other is an array or a number.
+STATIC void array_vec_inplace(mp_obj_t target_in, mp_obj_t other_in, bool mul) {
+    array_vec_t target, other;
+    array_vec_get_raise(target_in, &target, MP_BUFFER_WRITE);
+    bool scalar = !array_vec_get(other_in, &other, MP_BUFFER_READ);
+    if (!scalar) {
+        mp_arg_validate_length(other.len, target.len, MP_QSTR_other);
+    }
+
+    #if MICROPY_PY_BUILTINS_FLOAT
+    if (array_vec_is_float(&target) || (scalar ? mp_obj_is_float(other_in) : array_vec_is_float(&other))) {
+        mp_float_t s = scalar ? mp_obj_get_float(other_in) : 0;
+        for (size_t i = 0; i < target.len; i++) {
+            mp_float_t v = scalar ? s : array_vec_get_float(&other, i);
+            mp_float_t t = array_vec_get_float(&target, i);
+            array_vec_set_float(&target, i, mul ? t * v : t + v);
+        }
+        return;
+    }
+    #endif
+
+    long long s = scalar ? mp_obj_get_int(other_in) : 0;
+    for (size_t i = 0; i < target.len; i++) {
+        long long v = scalar ? s : array_vec_get_int(&other, i);
+        long long t = array_vec_get_int(&target, i);
+        array_vec_set_int(&target, i, mul ? t * v : t + v);
+    }
+}
+
+STATIC mp_obj_t array_vec_add(mp_obj_t target_in, mp_obj_t other_in) {
+    array_vec_inplace(target_in, other_in, false);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(array_vec_add_obj, array_vec_add);
+
+STATIC mp_obj_t array_vec_mul(mp_obj_t target_in, mp_obj_t other_in) {
+    array_vec_inplace(target_in, other_in, true);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(array_vec_mul_obj, array_vec_mul);
+
+STATIC mp_obj_t array_vec_sum(mp_obj_t a_in) {
+    array_vec_t a;
+    array_vec_get_raise(a_in, &a, MP_BUFFER_READ);
+    #if MICROPY_PY_BUILTINS_FLOAT
+    if (array_vec_is_float(&a)) {
+        mp_float_t total = 0;
+        for (size_t i = 0; i < a.len; i++) {
+            total += array_vec_get_float(&a, i);
+        }
+        return mp_obj_new_float(total);
+    }
+    #endif
+    long long total = 0;
+    for (size_t i = 0; i < a.len; i++) {
+        total += array_vec_get_int(&a, i);
+    }
+    return mp_obj_new_int_from_ll(total);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(array_vec_sum_obj, array_vec_sum);
+
+STATIC mp_obj_t array_vec_minmax(mp_obj_t a_in, bool want_max) {
+    array_vec_t a;
+    array_vec_get_raise(a_in, &a, MP_BUFFER_READ);
+    if (a.len == 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("arg is an empty sequence"));
+    }
+    size_t best = 0;
+    #if MICROPY_PY_BUILTINS_FLOAT
+    if (array_vec_is_float(&a)) {
+        mp_float_t best_val = array_vec_get_float(&a, 0);
+        for (size_t i = 1; i < a.len; i++) {
+            mp_float_t v = array_vec_get_float(&a, i);
+            if (want_max ? v > best_val : v < best_val) {
+                best = i;
+                best_val = v;
+            }
+        }
+    } else
+    #endif
+    {
+        long long best_val = array_vec_get_int(&a, 0);
+        for (size_t i = 1; i < a.len; i++) {
+            long long v = array_vec_get_int(&a, i);
+            if (want_max ? v > best_val : v < best_val) {
+                best = i;
+                best_val = v;
+            }
+        }
+    }
+    return mp_binary_get_val_array(a.typecode, a.buf, best);
+}
+
+STATIC mp_obj_t array_vec_min(mp_obj_t a_in) {
+    return array_vec_minmax(a_in, false);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(array_vec_min_obj, array_vec_min);
+
+STATIC mp_obj_t array_vec_max(mp_obj_t a_in) {
+    return array_vec_minmax(a_in, true);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(array_vec_max_obj, array_vec_max);
+
+STATIC mp_obj_t array_vec_dot(mp_obj_t a_in, mp_obj_t b_in) {
+    array_vec_t a, b;
+    array_vec_get_raise(a_in, &a, MP_BUFFER_READ);
+    array_vec_get_raise(b_in, &b, MP_BUFFER_READ);
+    mp_arg_validate_length(b.len, a.len, MP_QSTR_b);
+    #if MICROPY_PY_BUILTINS_FLOAT
+    if (array_vec_is_float(&a) || array_vec_is_float(&b)) {
+        mp_float_t total = 0;
+        for (size_t i = 0; i < a.len; i++) {
+            total += array_vec_get_float(&a, i) * array_vec_get_float(&b, i);
+        }
+        return mp_obj_new_float(total);
+    }
+    #endif
+    long long total = 0;
+    for (size_t i = 0; i < a.len; i++) {
+        total += array_vec_get_int(&a, i) * array_vec_get_int(&b, i);
+    }
+    return mp_obj_new_int_from_ll(total);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(array_vec_dot_obj, array_vec_dot);
+
+STATIC mp_obj_t array_vec_convert(mp_obj_t dest_in, mp_obj_t src_in) {
+    array_vec_t dest, src;
+    array_vec_get_raise(dest_in, &dest, MP_BUFFER_WRITE);
+    array_vec_get_raise(src_in, &src, MP_BUFFER_READ);
+    mp_arg_validate_length(src.len, dest.len, MP_QSTR_src);
+    #if MICROPY_PY_BUILTINS_FLOAT
+    if (array_vec_is_float(&dest) || array_vec_is_float(&src)) {
+        for (size_t i = 0; i < dest.len; i++) {
+            array_vec_set_float(&dest, i, array_vec_get_float(&src, i));
+        }
+        return mp_const_none;
+    }
+    #endif
+    for (size_t i = 0; i < dest.len; i++) {
+        array_vec_set_int(&dest, i, array_vec_get_int(&src, i));
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(array_vec_convert_obj, array_vec_convert);
+
+#endif // MICROPY_PY_ARRAY_VECTOR_OPS
+
 STATIC const mp_rom_map_elem_t mp_module_array_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_array) },
     { MP_ROM_QSTR(MP_QSTR_array), MP_ROM_PTR(&mp_type_array) },
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_ARRAY_VECTOR_OPS
+    { MP_ROM_QSTR(MP_QSTR_add), MP_ROM_PTR(&array_vec_add_obj) },
+    { MP_ROM_QSTR(MP_QSTR_mul), MP_ROM_PTR(&array_vec_mul_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sum), MP_ROM_PTR(&array_vec_sum_obj) },
+    { MP_ROM_QSTR(MP_QSTR_min), MP_ROM_PTR(&array_vec_min_obj) },
+    { MP_ROM_QSTR(MP_QSTR_max), MP_ROM_PTR(&array_vec_max_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dot), MP_ROM_PTR(&array_vec_dot_obj) },
+    { MP_ROM_QSTR(MP_QSTR_convert), MP_ROM_PTR(&array_vec_convert_obj) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_array_globals, mp_module_array_globals_table);
@@ -27,6 +27,8 @@
 #include "py/mpstate.h"
 #include "py/obj.h"
 #include "py/gc.h"
+// CIRCUITPY-CHANGE
+#include "py/runtime.h"
 
 #if MICROPY_PY_GC && MICROPY_ENABLE_GC
 
@@ -100,6 +102,161 @@ STATIC mp_obj_t gc_threshold(size_t n_args, const mp_obj_t *args) {
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_threshold_obj, 0, 1, gc_threshold);
 #endif
 
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_STATS
+// stats([reset]): return allocation and collection totals since the last
+// reset, with their rates and the current fragmentation of the heap
+STATIC mp_obj_t py_gc_stats(size_t n_args, const mp_obj_t *args) {
+    mp_gc_stats_t stats;
+    uint64_t elapsed_us = gc_stats(&stats, n_args > 0 && mp_obj_is_true(args[0]));
+    gc_info_t info;
+    gc_info(&info);
+    const struct {
+        qstr key;
+        uint64_t value;
+    } items[] = {
+        { MP_QSTR_elapsed_ms, elapsed_us / 1000 },
+        { MP_QSTR_allocs, stats.allocs },
+        { MP_QSTR_alloc_bytes, stats.alloc_bytes },
+        { MP_QSTR_allocs_per_s, stats.allocs * 1000000 / elapsed_us },
+        { MP_QSTR_bytes_per_s, stats.alloc_bytes * 1000000 / elapsed_us },
+        { MP_QSTR_collections, stats.collections },
+        { MP_QSTR_max_pause_us, stats.max_pause_us },
+        { MP_QSTR_avg_pause_us, stats.collections == 0 ? 0 : stats.total_pause_us / stats.collections },
+        { MP_QSTR_free, info.free },
+        { MP_QSTR_largest_free, info.max_free * MICROPY_BYTES_PER_GC_BLOCK },
+        { MP_QSTR_fragmentation, gc_info_fragmentation(&info) },
+    };
+    mp_obj_t dict = mp_obj_new_dict(MP_ARRAY_SIZE(items));
+    for (size_t i = 0; i < MP_ARRAY_SIZE(items); i++) {
+        mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(items[i].key), mp_obj_new_int_from_ull(items[i].value));
+    }
+    return dict;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_stats_obj, 0, 1, py_gc_stats);
+#endif
+
+#if MICROPY_GC_ALLOC_SITES
+STATIC mp_obj_t gc_census_dict(gc_census_entry_t *entries, size_t max_sites) {
+    size_t len = gc_census(entries, max_sites);
+    mp_obj_t dict = mp_obj_new_dict(len);
+    for (size_t i = 0; i < len; i++) {
+        gc_census_entry_t *e = &entries[i];
+        mp_obj_t key[3] = {
+            e->type == NULL ? mp_const_none : MP_OBJ_NEW_QSTR(e->type->name),
+            e->fun == MP_QSTRnull ? mp_const_none : MP_OBJ_NEW_QSTR(e->fun),
+            MP_OBJ_NEW_SMALL_INT(e->offset),
+        };
+        mp_obj_t value[2] = {
+            MP_OBJ_NEW_SMALL_INT(e->count),
+            mp_obj_new_int_from_uint(e->n_bytes),
+        };
+        mp_obj_dict_store(dict, mp_obj_new_tuple(3, key), mp_obj_new_tuple(2, value));
+    }
+    return dict;
+}
+
+// census([max_sites]): return the allocated heap as a dict mapping
+// (type name, function name, bytecode offset) to (count, bytes)
+STATIC mp_obj_t py_gc_census(size_t n_args, const mp_obj_t *args) {
+    size_t max_sites = 64;
+    if (n_args > 0) {
+        max_sites = mp_arg_validate_int_min(mp_obj_get_int(args[0]), 1, MP_QSTR_max_sites);
+    }
+    // Allocations made here are left out of this census and later ones, so
+    // that snapshots can be compared without seeing each other.
+    MP_STATE_MEM(gc_census_active) = true;
+    gc_census_entry_t *entries = NULL;
+    mp_obj_t dict;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        entries = m_new(gc_census_entry_t, max_sites);
+        dict = gc_census_dict(entries, max_sites);
+        nlr_pop();
+    } else {
+        MP_STATE_MEM(gc_census_active) = false;
+        nlr_jump(nlr.ret_val);
+    }
+    MP_STATE_MEM(gc_census_active) = false;
+    m_del(gc_census_entry_t, entries, max_sites);
+    return dict;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_census_obj, 0, 1, py_gc_census);
+#endif
+
+#if MICROPY_GC_COMPACT
+// compact(): move movable storage down into free holes, returning how many
+// allocations were moved
+STATIC mp_obj_t py_gc_compact(void) {
+    return MP_OBJ_NEW_SMALL_INT(gc_compact());
+}
+MP_DEFINE_CONST_FUN_OBJ_0(gc_compact_obj, py_gc_compact);
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_GC_ARENA
+// Arena(size): serve the allocations made inside a with block from a free run
+// of at least size bytes. Leaving the block runs a collection, which frees
+// everything in the arena that isn't referenced from outside it; objects that
+// escaped simply stay allocated, so leaving is never unsafe.
+typedef struct _mp_obj_gc_arena_t {
+    mp_obj_base_t base;
+    size_t size;
+    bool active;
+    mp_gc_arena_t saved;
+} mp_obj_gc_arena_t;
+
+STATIC mp_obj_t gc_arena_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 1, 1, false);
+    mp_obj_gc_arena_t *self = mp_obj_malloc(mp_obj_gc_arena_t, type);
+    self->size = mp_arg_validate_int_min(mp_obj_get_int(args[0]), 1, MP_QSTR_size);
+    self->active = false;
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC mp_obj_t gc_arena___enter__(mp_obj_t self_in) {
+    mp_obj_gc_arena_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->active) {
+        mp_raise_type(&mp_type_RuntimeError);
+    }
+    if (!gc_arena_begin(self->size, &self->saved)) {
+        gc_collect();
+        if (!gc_arena_begin(self->size, &self->saved)) {
+            m_malloc_fail(self->size);
+        }
+    }
+    self->active = true;
+    return self_in;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(gc_arena___enter___obj, gc_arena___enter__);
+
+STATIC mp_obj_t gc_arena___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    mp_obj_gc_arena_t *self = MP_OBJ_TO_PTR(args[0]);
+    if (self->active) {
+        gc_arena_end(&self->saved);
+        self->active = false;
+        gc_collect();
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(gc_arena___exit___obj, 4, 4, gc_arena___exit__);
+
+STATIC const mp_rom_map_elem_t gc_arena_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&gc_arena___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&gc_arena___exit___obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(gc_arena_locals_dict, gc_arena_locals_dict_table);
+
+STATIC MP_DEFINE_CONST_OBJ_TYPE(
+    gc_arena_type,
+    MP_QSTR_Arena,
+    MP_TYPE_FLAG_NONE,
+    make_new, gc_arena_make_new,
+    locals_dict, &gc_arena_locals_dict
+    );
+#endif
+
 STATIC const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_gc) },
     { MP_ROM_QSTR(MP_QSTR_collect), MP_ROM_PTR(&gc_collect_obj) },
@@ -111,6 +268,19 @@ STATIC const mp_rom_map_elem_t mp_module_gc_globals_table[] = {
     #if MICROPY_GC_ALLOC_THRESHOLD
     { MP_ROM_QSTR(MP_QSTR_threshold), MP_ROM_PTR(&gc_threshold_obj) },
     #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_COMPACT
+    { MP_ROM_QSTR(MP_QSTR_compact), MP_ROM_PTR(&gc_compact_obj) },
+    #endif
+    #if MICROPY_GC_ALLOC_SITES
+    { MP_ROM_QSTR(MP_QSTR_census), MP_ROM_PTR(&gc_census_obj) },
+    #endif
+    #if MICROPY_GC_STATS
+    { MP_ROM_QSTR(MP_QSTR_stats), MP_ROM_PTR(&gc_stats_obj) },
+    #endif
+    #if MICROPY_GC_ARENA
+    { MP_ROM_QSTR(MP_QSTR_Arena), MP_ROM_PTR(&gc_arena_type) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(mp_module_gc_globals, mp_module_gc_globals_table);
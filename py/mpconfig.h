@@ -195,6 +195,81 @@
 #define MICROPY_GC_ALLOC_THRESHOLD (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_CORE_FEATURES)
 #endif
 
+// Keep per-area lists of the free 1, 2 and 4 block holes found by the last
+// sweep so that small allocations don't have to scan the allocation table.
+#ifndef MICROPY_GC_SIZE_CLASSES
+#define MICROPY_GC_SIZE_CLASSES (0)
+#endif
+
+// Number of holes remembered for each size class.
+#ifndef MICROPY_GC_SIZE_CLASS_ENTRIES
+#define MICROPY_GC_SIZE_CLASS_ENTRIES (32)
+#endif
+
+// Let collections triggered by gc_alloc leave most of the sweep to later
+// allocations, which sweep MICROPY_GC_SWEEP_STEP_BLOCKS blocks each, so the
+// pause is mostly the time taken to mark. gc.collect() always sweeps fully.
+#ifndef MICROPY_GC_INCREMENTAL_SWEEP
+#define MICROPY_GC_INCREMENTAL_SWEEP (0)
+#endif
+
+#ifndef MICROPY_GC_SWEEP_STEP_BLOCKS
+#define MICROPY_GC_SWEEP_STEP_BLOCKS (256)
+#endif
+
+// Queue up to MICROPY_GC_FINALISER_QUEUE_LEN finalisers found by the sweep
+// instead of calling them as it goes. Collections triggered by gc_alloc leave
+// them for later allocations, which each run MICROPY_GC_FINALISER_BUDGET of
+// them. Other collections run them all once the sweep is done.
+#ifndef MICROPY_GC_DEFERRED_FINALISERS
+#define MICROPY_GC_DEFERRED_FINALISERS (0)
+#endif
+
+#ifndef MICROPY_GC_FINALISER_QUEUE_LEN
+#define MICROPY_GC_FINALISER_QUEUE_LEN (32)
+#endif
+
+#ifndef MICROPY_GC_FINALISER_BUDGET
+#define MICROPY_GC_FINALISER_BUDGET (4)
+#endif
+
+// Provide gc.Arena, which reserves a free run of the heap and serves the
+// allocations made inside a with block from it, keeping short lived objects
+// together so that they leave one hole rather than many when collected.
+#ifndef MICROPY_GC_ARENA
+#define MICROPY_GC_ARENA (0)
+#endif
+
+// Provide gc.compact(), which moves the item arrays of lists and the tables
+// of dicts down into free holes to join up free memory. Only storage that the
+// conservative scan finds referenced by its owner alone is moved, and
+// gc_alloc also tries a compaction before failing a multi-block allocation.
+#ifndef MICROPY_GC_COMPACT
+#define MICROPY_GC_COMPACT (0)
+#endif
+
+// Maximum number of blocks of storage moved by one compaction.
+#ifndef MICROPY_GC_COMPACT_MAX_MOVES
+#define MICROPY_GC_COMPACT_MAX_MOVES (32)
+#endif
+
+// Record the function and bytecode offset that allocated each heap block, in
+// a table of 4 bytes per block, and provide gc.census() to report the live
+// heap grouped by type and allocation site.
+#ifndef MICROPY_GC_ALLOC_SITES
+#define MICROPY_GC_ALLOC_SITES (0)
+#endif
+
+// Keep running totals of allocations, collections and collection pause times
+// for gc.stats(). MICROPY_GC_STATS_TICKS_US() is the clock used for timing.
+#ifndef MICROPY_GC_STATS
+#define MICROPY_GC_STATS (0)
+#endif
+
+#ifndef MICROPY_GC_STATS_TICKS_US
+#define MICROPY_GC_STATS_TICKS_US() mp_hal_ticks_us()
+#endif
+
 // Number of bytes to allocate initially when creating new chunks to store
 // interned string data.  Smaller numbers lead to more chunks being needed
 // and more wastage at the end of the chunk.  Larger numbers lead to wasted
@@ -203,6 +278,14 @@
 #define MICROPY_ALLOC_QSTR_CHUNK_INIT (128)
 #endif
 
+// CIRCUITPY-CHANGE
+// Keep an open addressing hash index of the dynamically allocated qstrs, so
+// that interning doesn't search every pool. Uses 2 to 4 bytes of heap per
+// interned qstr. The const pool is still searched linearly.
+#ifndef MICROPY_QSTR_INDEX
+#define MICROPY_QSTR_INDEX (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 // Initial amount for lexer indentation level
 #ifndef MICROPY_ALLOC_LEXER_INDENT_INIT
 #define MICROPY_ALLOC_LEXER_INDENT_INIT (10)
@@ -323,11 +406,44 @@
 #define MICROPY_PERSISTENT_CODE_LOAD (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether .mpy files in memory-mapped storage are used in place: bytecode, qstr
+// data and str/bytes constants are referenced directly instead of being copied
+// to the heap. This applies to mp_reader_new_mem readers created with
+// MP_READER_IS_ROM, and to VFS files that expose their data with the buffer
+// protocol outside the GC heap.
+#ifndef MICROPY_PERSISTENT_CODE_LOAD_XIP
+#define MICROPY_PERSISTENT_CODE_LOAD_XIP (0)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether importing a .py file saves its compiled code as a .mpy file in
+// MICROPY_MODULE_COMPILE_CACHE_DIR and loads that on later imports instead of
+// compiling again. Caching only happens when the directory exists. Requires
+// MICROPY_VFS, MICROPY_PERSISTENT_CODE_LOAD and MICROPY_ENABLE_COMPILER.
+#ifndef MICROPY_MODULE_COMPILE_CACHE
+#define MICROPY_MODULE_COMPILE_CACHE (0)
+#endif
+
+#ifndef MICROPY_MODULE_COMPILE_CACHE_DIR
+#define MICROPY_MODULE_COMPILE_CACHE_DIR "/.mpycache"
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether import keeps a listing of each directory it searches, so that a
+// module missing from a sys.path entry is ruled out without stat'ing it for
+// .py, .mpy and package forms. The listings are dropped on every change to
+// the filesystem. Requires MICROPY_VFS.
+#ifndef MICROPY_MODULE_IMPORT_DIR_CACHE
+#define MICROPY_MODULE_IMPORT_DIR_CACHE (0)
+#endif
+
 // Whether to support saving of persistent code, i.e. for mpy-cross to
 // generate .mpy files. Enabling this enables additional metadata on raw code
 // objects which is also required for sys.settrace.
+// CIRCUITPY-CHANGE: also required by the module compile cache.
 #ifndef MICROPY_PERSISTENT_CODE_SAVE
-#define MICROPY_PERSISTENT_CODE_SAVE (MICROPY_PY_SYS_SETTRACE)
+#define MICROPY_PERSISTENT_CODE_SAVE (MICROPY_PY_SYS_SETTRACE || MICROPY_MODULE_COMPILE_CACHE)
 #endif
 
 // Whether to support saving persistent code to a file via mp_raw_code_save_file
@@ -483,6 +599,21 @@
 #define MICROPY_COMP_RETURN_IF_EXPR (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether file input that is run straight away (imports, exec and pyexec) is
+// compiled a group of top-level statements at a time while it is parsed, so
+// the parse tree of the whole file is never held in memory at once. The whole
+// file is still compiled before any of it runs.
+#ifndef MICROPY_COMP_STREAMING
+#define MICROPY_COMP_STREAMING (0)
+#endif
+
+// Bytes of parse nodes to build up before compiling the statements so far.
+// Each group costs a small function object, so don't make this too small.
+#ifndef MICROPY_COMP_STREAMING_THRESHOLD
+#define MICROPY_COMP_STREAMING_THRESHOLD (1024)
+#endif
+
 /*****************************************************************************/
 /* Internal debugging stuff                                                  */
 
@@ -569,12 +700,81 @@
 #define MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE (128)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether dicts and other heap maps keep their entries densely in insertion
+// order, with a separate hash index of 1, 2 or 4 byte slots for maps of more
+// than 8 entries. Iteration follows insertion order, as in CPython, and
+// lookups probe a lightly loaded index instead of a full table. OrderedDict
+// keeps its own linear layout.
+#ifndef MICROPY_MAP_COMPACT
+#define MICROPY_MAP_COMPACT (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+// CIRCUITPY-CHANGE
+// Whether the VM handles comparisons, add, subtract and bitwise ops on two
+// small ints itself, and branches directly on a small int comparison that is
+// followed by a conditional jump. Increases code size by a few hundred bytes.
+#ifndef MICROPY_OPT_VM_SMALL_INT_FAST_PATH
+#define MICROPY_OPT_VM_SMALL_INT_FAST_PATH (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+// CIRCUITPY-CHANGE
+// Use extra RAM to remember which class in the hierarchy provides an attribute
+// of instances of a given type, so that method calls and class attribute loads
+// skip the search through the bases. The cache is cleared whenever a class is
+// created or a class attribute is stored or deleted.
+#ifndef MICROPY_OPT_CLASS_LOOKUP_CACHE
+#define MICROPY_OPT_CLASS_LOOKUP_CACHE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+// Number of sets in the class lookup cache, must be a power of 2. Each set
+// holds two entries of four words.
+#ifndef MICROPY_OPT_CLASS_LOOKUP_CACHE_SIZE
+#define MICROPY_OPT_CLASS_LOOKUP_CACHE_SIZE (32)
+#endif
+
+// CIRCUITPY-CHANGE
+// Use extra RAM to remember where global and builtin names were last found,
+// so that loading a builtin doesn't first miss in the globals dict every time.
+// Entries are checked against a version that is bumped when a key is added to
+// a dict that has been used as globals, or such a dict is cleared.
+#ifndef MICROPY_OPT_LOAD_GLOBAL_CACHE
+#define MICROPY_OPT_LOAD_GLOBAL_CACHE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
+// Number of entries in the global lookup cache, must be a power of 2. Each
+// entry is four words.
+#ifndef MICROPY_OPT_LOAD_GLOBAL_CACHE_SIZE
+#define MICROPY_OPT_LOAD_GLOBAL_CACHE_SIZE (32)
+#endif
+
+// CIRCUITPY-CHANGE
+// Share the args tuple of exceptions raised with the same fixed message, and
+// only decompress the message when it is used as a str. Exceptions raised with
+// the same message then allocate just the exception object.
+#ifndef MICROPY_OPT_CACHE_EXCEPTION_ARGS
+#define MICROPY_OPT_CACHE_EXCEPTION_ARGS (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES && MICROPY_ERROR_REPORTING != MICROPY_ERROR_REPORTING_NONE)
+#endif
+
+// Number of messages whose args tuple is kept. Each entry is two words.
+#ifndef MICROPY_OPT_CACHE_EXCEPTION_ARGS_SIZE
+#define MICROPY_OPT_CACHE_EXCEPTION_ARGS_SIZE (8)
+#endif
+
 // Whether to use fast versions of bitwise operations (and, or, xor) when the
 // arguments are both positive.  Increases Thumb2 code size by about 250 bytes.
 #ifndef MICROPY_OPT_MPZ_BITWISE
 #define MICROPY_OPT_MPZ_BITWISE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to use Karatsuba multiplication for large mpz, and Montgomery reduction
+// with a sliding window for 3-argument pow with an odd modulus.  Makes big number
+// arithmetic (eg RSA sized pow) much faster.  Increases code size by about 2k bytes.
+#ifndef MICROPY_OPT_MPZ_FAST_MUL
+#define MICROPY_OPT_MPZ_FAST_MUL (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
+#endif
+
 
 // Whether math.factorial is large, fast and recursive (1) or small and slow (0).
 #ifndef MICROPY_OPT_MATH_FACTORIAL
@@ -649,6 +849,32 @@
 #define MICROPY_GC_SPLIT_HEAP_AUTO (0)
 #endif
 
+// With a split heap, keep the first area as a nursery for allocations of at
+// most this many blocks, so short-lived small objects are packed together
+// and don't fragment the space used by large buffers. Larger allocations only
+// go in the first area when they don't fit anywhere else. 0 to disable.
+#ifndef MICROPY_GC_NURSERY_MAX_BLOCKS
+#define MICROPY_GC_NURSERY_MAX_BLOCKS (0)
+#endif
+
+// With a split heap, place allocations by the speed of the memory under each
+// area, such as internal SRAM versus PSRAM. Allocations of at least
+// MICROPY_GC_SLOW_AREA_MIN_BLOCKS blocks go in slow areas first and smaller
+// ones, or ones made with GC_ALLOC_FLAG_FAST, in fast areas first. Either
+// kind falls back to the other when it doesn't fit.
+#ifndef MICROPY_GC_SLOW_AREAS
+#define MICROPY_GC_SLOW_AREAS (0)
+#endif
+
+#ifndef MICROPY_GC_SLOW_AREA_MIN_BLOCKS
+#define MICROPY_GC_SLOW_AREA_MIN_BLOCKS (64)
+#endif
+
+// Whether the heap area from start to end is in slow memory.
+#ifndef MICROPY_GC_AREA_IS_SLOW
+#define MICROPY_GC_AREA_IS_SLOW(start, end) (false)
+#endif
+
 // Hook to run code during time consuming garbage collector operations
 // *i* is the loop index variable (e.g. can be used to run every x loops)
 #ifndef MICROPY_GC_HOOK_LOOP
@@ -1080,6 +1306,15 @@ typedef double mp_float_t;
 #define MICROPY_PY_BUILTINS_STR_UNICODE (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether indexing a long str remembers where the characters of the last str
+// indexed are: whether it is all ASCII, and otherwise the byte offset of every
+// 32nd character. Repeated indexing of the same str then doesn't walk its UTF-8
+// from the start each time.
+#ifndef MICROPY_PY_BUILTINS_STR_UNICODE_INDEX
+#define MICROPY_PY_BUILTINS_STR_UNICODE_INDEX (0)
+#endif
+
 // Whether to check for valid UTF-8 when converting bytes to str
 #ifndef MICROPY_PY_BUILTINS_STR_UNICODE_CHECK
 #define MICROPY_PY_BUILTINS_STR_UNICODE_CHECK (MICROPY_PY_BUILTINS_STR_UNICODE)
@@ -1308,6 +1543,13 @@ typedef double mp_float_t;
 #define MICROPY_PY_ARRAY_SLICE_ASSIGN (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether to provide elementwise arithmetic (add, mul, sum, min, max, dot, convert)
+// on arrays and memoryviews as functions in the array module.
+#ifndef MICROPY_PY_ARRAY_VECTOR_OPS
+#define MICROPY_PY_ARRAY_VECTOR_OPS (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
+#endif
+
 // Whether to support attrtuple type (MicroPython extension)
 // It provides space-efficient tuples with attribute access
 #ifndef MICROPY_PY_ATTRTUPLE
@@ -1500,6 +1742,14 @@ typedef double mp_float_t;
 #define MICROPY_PY_SYS_SETTRACE (0)
 #endif
 
+// CIRCUITPY-CHANGE
+// Whether the VM keeps MP_STATE_THREAD(current_code_state) pointing at the
+// innermost executing bytecode frame, linked through prev_state, so that a
+// sampling profiler can walk the Python call stack. Always on with settrace.
+#ifndef MICROPY_VM_TRACK_CURRENT_CODE_STATE
+#define MICROPY_VM_TRACK_CURRENT_CODE_STATE (MICROPY_PY_SYS_SETTRACE || MICROPY_GC_ALLOC_SITES)
+#endif
+
 // Whether to provide "sys.getsizeof" function
 #ifndef MICROPY_PY_SYS_GETSIZEOF
 #define MICROPY_PY_SYS_GETSIZEOF (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EVERYTHING)
@@ -87,6 +87,29 @@ typedef struct _mp_sched_item_t {
     mp_obj_t arg;
 } mp_sched_item_t;
 
+#if MICROPY_GC_SIZE_CLASSES
+// Free holes of a single size, filled in by gc_sweep and consumed by gc_alloc.
+// Entries are only hints and are checked against the allocation table on use.
+typedef struct _mp_gc_size_class_t {
+    MICROPY_GC_STACK_ENTRY_TYPE blocks[MICROPY_GC_SIZE_CLASS_ENTRIES];
+    uint16_t len;
+    uint16_t next;
+} mp_gc_size_class_t;
+
+#define MP_GC_SIZE_CLASS_COUNT (3)
+#endif
+
+#if MICROPY_GC_ALLOC_SITES
+// Where a heap allocation was made: the name of the Python function that was
+// running, or MP_QSTRnull, and the offset of its bytecode from the start of
+// the function (see MICROPY_GC_ALLOC_SITES).
+typedef struct _mp_gc_site_t {
+    qstr_short_t fun;
+    uint16_t offset : 15;
+    uint16_t is_obj : 1; // set by mp_obj_malloc, so the first word is the type
+} mp_gc_site_t;
+#endif
+
 // This structure holds information about a single contiguous area of
 // memory reserved for the memory manager.
 typedef struct _mp_state_mem_area_t {
@@ -99,13 +122,95 @@ typedef struct _mp_state_mem_area_t {
     #if MICROPY_ENABLE_FINALISER
     byte *gc_finaliser_table_start;
     #endif
+    #if MICROPY_GC_ALLOC_SITES
+    mp_gc_site_t *gc_site_table_start;
+    #endif
     byte *gc_pool_start;
     byte *gc_pool_end;
 
     size_t gc_last_free_atb_index;
     size_t gc_last_used_block; // The block ID of the highest block allocated in the area
+
+    #if MICROPY_GC_SIZE_CLASSES
+    // Holes of 1, 2 and 4 blocks.
+    mp_gc_size_class_t gc_size_class[MP_GC_SIZE_CLASS_COUNT];
+    #endif
+
+    #if MICROPY_GC_SPLIT_HEAP && MICROPY_GC_SLOW_AREAS
+    bool slow; // memory is slow, such as PSRAM, see MICROPY_GC_AREA_IS_SLOW
+    #endif
 } mp_state_mem_area_t;
 
+// Position of the sweep phase of a collection, which may be spread over
+// several calls to gc_alloc (see MICROPY_GC_INCREMENTAL_SWEEP).
+typedef struct _mp_gc_sweep_t {
+    mp_state_mem_area_t *area; // NULL once every area is swept
+    #if MICROPY_GC_SPLIT_HEAP_AUTO
+    mp_state_mem_area_t *prev_area;
+    #endif
+    size_t block;
+    size_t end_block;
+    size_t last_used_block;
+    size_t free_run;
+    bool allocated; // something was allocated behind the sweep in this area
+} mp_gc_sweep_t;
+
+// Running totals for gc.stats() (see MICROPY_GC_STATS). Times are in
+// microseconds from MICROPY_GC_STATS_TICKS_US().
+typedef struct _mp_gc_stats_t {
+    uint64_t since_us; // when the totals were last reset
+    uint64_t allocs;
+    uint64_t alloc_bytes;
+    uint64_t total_pause_us;
+    uint32_t max_pause_us;
+    uint32_t collections;
+} mp_gc_stats_t;
+
+// Run of blocks that gc_alloc serves first while a gc.Arena is active
+// (see MICROPY_GC_ARENA).
+typedef struct _mp_gc_arena_t {
+    mp_state_mem_area_t *area; // NULL when no arena is active
+    size_t next_block;
+    size_t end_block; // exclusive
+} mp_gc_arena_t;
+
+// Storage that gc_compact may move, with the number of references to it that
+// the collection run by gc_compact found (see MICROPY_GC_COMPACT). Blocks are
+// kept as indices so that the entries, which are on the C stack during that
+// collection, don't count as references themselves.
+typedef struct _mp_gc_compact_entry_t {
+    mp_state_mem_area_t *area;
+    mp_state_mem_area_t *owner_area;
+    size_t owner_block;
+    size_t owner_word; // index of the word in the owner that points to the storage
+    size_t block;
+    size_t n_blocks;
+    size_t refs;
+} mp_gc_compact_entry_t;
+
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_CLASS_LOOKUP_CACHE
+// Where attr of instances of type was found: in the locals of found_type.
+typedef struct _mp_class_lookup_cache_entry_t {
+    const mp_obj_type_t *type;
+    qstr attr;
+    const mp_obj_type_t *found_type;
+    mp_obj_t member;
+} mp_class_lookup_cache_entry_t;
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_LOAD_GLOBAL_CACHE
+// Where qst was found when loaded with globals as the globals map. Valid while
+// version matches and elem still holds qst.
+typedef struct _mp_load_global_cache_entry_t {
+    const mp_map_t *globals;
+    size_t version;
+    qstr qst;
+    mp_map_elem_t *elem;
+} mp_load_global_cache_entry_t;
+#endif
+
 // This structure hold information about the memory allocation system.
 typedef struct _mp_state_mem_t {
     #if MICROPY_MEM_STATS
@@ -128,6 +233,38 @@ typedef struct _mp_state_mem_t {
     // you can still allocate/free memory and also explicitly call gc_collect.
     uint16_t gc_auto_collect_enabled;
 
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    mp_gc_sweep_t gc_sweep;
+    bool gc_sweep_defer;
+    #endif
+
+    #if MICROPY_GC_DEFERRED_FINALISERS
+    // Unreachable objects kept, with what they reference, until their
+    // finalisers have run. gc_collect_start scans this as a root.
+    void *gc_finaliser_queue[MICROPY_GC_FINALISER_QUEUE_LEN];
+    size_t gc_finaliser_queue_len;
+    bool gc_finaliser_defer;
+    #endif
+
+    #if MICROPY_GC_ARENA
+    mp_gc_arena_t gc_arena;
+    #endif
+
+    #if MICROPY_GC_COMPACT
+    mp_gc_compact_entry_t *gc_compact_entries;
+    size_t gc_compact_len;
+    #endif
+
+    #if MICROPY_GC_ALLOC_SITES
+    bool gc_census_active;
+    #endif
+
+    #if MICROPY_GC_STATS
+    mp_gc_stats_t gc_stats;
+    // Start of the collection in progress, 0 if there isn't one.
+    uint64_t gc_stats_collect_start_us;
+    #endif
+
     #if MICROPY_GC_ALLOC_THRESHOLD
     size_t gc_alloc_amount;
     size_t gc_alloc_threshold;
@@ -162,6 +299,11 @@ typedef struct _mp_state_vm_t {
 
     qstr_pool_t *last_pool;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_QSTR_INDEX
+    qstr_short_t *qstr_index;
+    #endif
+
     #if MICROPY_TRACKED_ALLOC
     struct _m_tracked_node_t *m_tracked_head;
     #endif
@@ -219,6 +361,11 @@ typedef struct _mp_state_vm_t {
     size_t qstr_last_alloc;
     size_t qstr_last_used;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_QSTR_INDEX
+    size_t qstr_index_alloc;
+    #endif
+
     #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
     // This is a global mutex used to make qstr interning thread-safe.
     mp_thread_mutex_t qstr_mutex;
@@ -266,6 +413,22 @@ typedef struct _mp_state_vm_t {
     // See mp_map_lookup.
     uint8_t map_lookup_cache[MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE];
     #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_CLASS_LOOKUP_CACHE
+    // See mp_obj_instance_load_attr. Not scanned: members stay reachable from
+    // their class until removed, which clears the cache.
+    mp_class_lookup_cache_entry_t class_lookup_cache[MICROPY_OPT_CLASS_LOOKUP_CACHE_SIZE][2];
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_LOAD_GLOBAL_CACHE
+    // See mp_load_global. Not scanned: a map is only matched once it has been
+    // marked as watched, which bumps the version, so entries left behind by a
+    // collected map at the same address are never used.
+    mp_load_global_cache_entry_t load_global_cache[MICROPY_OPT_LOAD_GLOBAL_CACHE_SIZE];
+    size_t load_global_cache_version;
+    #endif
 } mp_state_vm_t;
 
 // This structure holds state that is specific to a given thread.
@@ -313,6 +476,9 @@ typedef struct _mp_state_thread_t {
     #if MICROPY_PY_SYS_SETTRACE
     mp_obj_t prof_trace_callback;
     bool prof_callback_is_executing;
+    #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_VM_TRACK_CURRENT_CODE_STATE
     struct _mp_code_state_t *current_code_state;
     #endif
 
@@ -427,12 +427,26 @@ STATIC size_t mpn_mul_dig_add_dig(mpz_dig_t *idig, size_t ilen, mpz_dig_t dmul,
     return idig - oidig;
 }
 
+// CIRCUITPY-CHANGE: Karatsuba multiplication for large operands
+#if MICROPY_OPT_MPZ_FAST_MUL
+// Below this many digits in either operand, schoolbook multiplication is faster.
+#define MPN_KARATSUBA_CUTOFF (32)
+STATIC size_t mpn_mul_karatsuba(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *kdig, size_t klen);
+#endif
+
 /* computes i = j * k
    returns number of digits in i
    assumes enough memory in i; assumes i is zeroed; assumes normalised j, k
    can have j, k point to same memory
 */
 STATIC size_t mpn_mul(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *kdig, size_t klen) {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_MPZ_FAST_MUL
+    if (jlen >= MPN_KARATSUBA_CUTOFF && klen >= MPN_KARATSUBA_CUTOFF) {
+        return mpn_mul_karatsuba(idig, jdig, jlen, kdig, klen);
+    }
+    #endif
+
     mpz_dig_t *oidig = idig;
     size_t ilen = 0;
 
@@ -461,6 +475,119 @@ STATIC size_t mpn_mul(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *
     return ilen;
 }
 
+// CIRCUITPY-CHANGE: Karatsuba multiplication and Montgomery products
+#if MICROPY_OPT_MPZ_FAST_MUL
+
+// Digits of scratch needed by mpn_karatsuba for n digit operands.
+STATIC size_t mpn_karatsuba_scratch(size_t n) {
+    size_t size = 0;
+    while (n >= MPN_KARATSUBA_CUTOFF) {
+        n = n - n / 2 + 1;
+        size += 4 * n;
+    }
+    return size;
+}
+
+/* computes r = a * b
+   r has 2n digits and need not be zeroed; a and b have n digits and need not be normalised
+   scratch has mpn_karatsuba_scratch(n) digits
+*/
+STATIC void mpn_karatsuba(mpz_dig_t *r, mpz_dig_t *a, mpz_dig_t *b, size_t n, mpz_dig_t *scratch) {
+    memset(r, 0, 2 * n * sizeof(mpz_dig_t));
+    if (n < MPN_KARATSUBA_CUTOFF) {
+        mpn_mul(r, a, n, b, n);
+        return;
+    }
+
+    // a = a1 * B**lo + a0, and the same for b
+    size_t lo = n / 2;
+    size_t hi = n - lo;
+
+    // z0 = a0 * b0 and z2 = a1 * b1 go straight into r
+    mpn_karatsuba(r, a, b, lo, scratch);
+    mpn_karatsuba(r + 2 * lo, a + lo, b + lo, hi, scratch);
+
+    // z1 = (a0 + a1) * (b0 + b1) - z0 - z2
+    mpz_dig_t *sa = scratch;
+    mpz_dig_t *sb = sa + hi + 1;
+    mpz_dig_t *z1 = sb + hi + 1;
+    sa[hi] = 0;
+    sb[hi] = 0;
+    mpn_add(sa, a + lo, hi, a, lo);
+    mpn_add(sb, b + lo, hi, b, lo);
+    mpn_karatsuba(z1, sa, sb, hi + 1, z1 + 2 * (hi + 1));
+    mpn_sub(z1, z1, 2 * (hi + 1), r, 2 * lo);
+    mpn_sub(z1, z1, 2 * (hi + 1), r + 2 * lo, 2 * hi);
+
+    // r += z1 * B**lo; the top digits of z1 are zero, and the sum fits in 2n digits
+    mpn_add(r + lo, r + lo, n + hi, z1, 2 * hi + 1);
+}
+
+/* computes i = j * k, as mpn_mul
+   assumes jlen, klen >= MPN_KARATSUBA_CUTOFF
+*/
+STATIC size_t mpn_mul_karatsuba(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *kdig, size_t klen) {
+    if (jlen < klen) {
+        mpz_dig_t *d = jdig;
+        jdig = kdig;
+        kdig = d;
+        size_t l = jlen;
+        jlen = klen;
+        klen = l;
+    }
+
+    // Multiply k by klen digit pieces of j and add them up.
+    size_t scratch_len = 3 * klen + mpn_karatsuba_scratch(klen);
+    mpz_dig_t *prod = m_new(mpz_dig_t, scratch_len);
+    mpz_dig_t *piece = prod + 2 * klen;
+    for (size_t off = 0; off < jlen; off += klen) {
+        size_t len = MIN(klen, jlen - off);
+        memcpy(piece, jdig + off, len * sizeof(mpz_dig_t));
+        memset(piece + len, 0, (klen - len) * sizeof(mpz_dig_t));
+        mpn_karatsuba(prod, piece, kdig, klen, piece + klen);
+        mpn_add(idig + off, idig + off, jlen + klen - off, prod, len + klen);
+    }
+    m_del(mpz_dig_t, prod, scratch_len);
+
+    return mpn_remove_trailing_zeros(idig, idig + jlen + klen);
+}
+
+/* computes i = j * k / B**n mod m, the Montgomery product
+   i, j, k have n digits, with j, k < m; m is normalised and odd, with n digits
+   minv = -1 / m mod B; t is scratch with 2n + 1 digits
+   can have i, j, k point to same memory
+*/
+STATIC void mpn_mont_mul(mpz_dig_t *idig, mpz_dig_t *jdig, mpz_dig_t *kdig, const mpz_dig_t *mdig, size_t n, mpz_dig_t minv, mpz_dig_t *t) {
+    memset(t, 0, (2 * n + 1) * sizeof(mpz_dig_t));
+    mpn_mul(t, jdig, n, kdig, n);
+
+    // Add multiples of m to clear the low n digits, then drop them.
+    for (size_t i = 0; i < n; ++i) {
+        mpz_dig_t u = ((mpz_dbl_dig_t)t[i] * minv) & DIG_MASK;
+        mpz_dbl_dig_t carry = 0;
+        mpz_dig_t *td = t + i;
+        for (size_t j = 0; j < n; ++j, ++td) {
+            carry += (mpz_dbl_dig_t)*td + (mpz_dbl_dig_t)u * (mpz_dbl_dig_t)mdig[j]; // will never overflow so long as DIG_SIZE <= 8*sizeof(mpz_dbl_dig_t)/2
+            *td = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+        for (; carry != 0; ++td) {
+            carry += *td;
+            *td = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+    }
+
+    // The result is less than 2m.
+    mpz_dig_t *res = t + n;
+    if (mpn_cmp(res, mpn_remove_trailing_zeros(res, res + n + 1), mdig, n) >= 0) {
+        mpn_sub(res, res, n + 1, mdig, n);
+    }
+    memcpy(idig, res, n * sizeof(mpz_dig_t));
+}
+
+#endif
+
 /* natural_div - quo * den + new_num = old_num (ie num is replaced with rem)
    assumes den != 0
    assumes num_dig has enough memory to be extended by 1 digit
@@ -1356,6 +1483,102 @@ void mpz_pow_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
     mpz_free(n);
 }
 
+// CIRCUITPY-CHANGE: Montgomery reduction with a sliding window for pow(a, b, m)
+#if MICROPY_OPT_MPZ_FAST_MUL
+STATIC bool mpz_bit(const mpz_t *z, size_t bit) {
+    return (z->dig[bit / DIG_SIZE] >> (bit % DIG_SIZE)) & 1;
+}
+
+/* computes dest = (lhs ** rhs) % mod
+   assumes rhs > 0 and mod > 1 is odd; mod can't be the same as dest
+*/
+STATIC void mpz_pow3_mont(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t *mod) {
+    size_t n = mod->len;
+
+    // -1 / m mod B, by Newton's iteration
+    mpz_dbl_dig_t inv = 1;
+    for (size_t bits = 1; bits < DIG_SIZE; bits *= 2) {
+        inv = (inv * ((2 - mod->dig[0] * inv) & DIG_MASK)) & DIG_MASK;
+    }
+    mpz_dig_t minv = (DIG_BASE - inv) & DIG_MASK;
+
+    size_t nbits = (rhs->len - 1) * DIG_SIZE;
+    for (mpz_dig_t d = rhs->dig[rhs->len - 1]; d != 0; d >>= 1) {
+        nbits++;
+    }
+    size_t window = nbits > 512 ? 5 : nbits > 128 ? 4 : nbits > 32 ? 3 : 1;
+    size_t table_len = (1 << (window - 1)) * n;
+
+    // x * B**n mod m, the Montgomery form of x
+    mpz_t x, quo;
+    mpz_init_zero(&x);
+    mpz_init_zero(&quo);
+    mpz_divmod_inpl(&quo, &x, lhs, mod);
+    if (x.len != 0) {
+        mpz_shl_inpl(&x, &x, n * DIG_SIZE);
+        mpz_divmod_inpl(&quo, &x, &x, mod);
+    }
+    mpz_deinit(&quo);
+
+    // odd powers x, x**3, x**5, ... up to the window size, then the accumulator and
+    // product scratch
+    size_t work_len = table_len + n + 2 * n + 1;
+    mpz_dig_t *table = m_new(mpz_dig_t, work_len);
+    mpz_dig_t *acc = table + table_len;
+    mpz_dig_t *t = acc + n;
+    memset(table, 0, n * sizeof(mpz_dig_t));
+    memcpy(table, x.dig, x.len * sizeof(mpz_dig_t));
+    mpz_deinit(&x);
+    if (table_len > n) {
+        mpn_mont_mul(acc, table, table, mod->dig, n, minv, t);
+        for (mpz_dig_t *p = table + n; p < acc; p += n) {
+            mpn_mont_mul(p, p - n, acc, mod->dig, n, minv, t);
+        }
+    }
+
+    // Left to right over the bits of rhs, multiplying in a window of up to
+    // `window` bits that ends with a 1 at a time.
+    bool started = false;
+    for (size_t i = nbits; i > 0;) {
+        if (!mpz_bit(rhs, i - 1)) {
+            mpn_mont_mul(acc, acc, acc, mod->dig, n, minv, t);
+            i--;
+            continue;
+        }
+        size_t len = MIN(window, i);
+        while (!mpz_bit(rhs, i - len)) {
+            len--;
+        }
+        size_t val = 0;
+        for (size_t b = 1; b <= len; b++) {
+            val = (val << 1) | mpz_bit(rhs, i - b);
+        }
+        mpz_dig_t *power = table + (val >> 1) * n;
+        if (started) {
+            for (size_t b = 0; b < len; b++) {
+                mpn_mont_mul(acc, acc, acc, mod->dig, n, minv, t);
+            }
+            mpn_mont_mul(acc, acc, power, mod->dig, n, minv, t);
+        } else {
+            memcpy(acc, power, n * sizeof(mpz_dig_t));
+            started = true;
+        }
+        i -= len;
+    }
+
+    // Out of Montgomery form, by a Montgomery product with 1.
+    memset(table, 0, n * sizeof(mpz_dig_t));
+    table[0] = 1;
+    mpn_mont_mul(acc, acc, table, mod->dig, n, minv, t);
+
+    mpz_need_dig(dest, n);
+    memcpy(dest->dig, acc, n * sizeof(mpz_dig_t));
+    dest->len = mpn_remove_trailing_zeros(dest->dig, dest->dig + n);
+    dest->neg = 0;
+    m_del(mpz_dig_t, table, work_len);
+}
+#endif
+
 /* computes dest = (lhs ** rhs) % mod
    can have dest, lhs, rhs the same; mod can't be the same as dest
 */
@@ -1365,6 +1588,14 @@ void mpz_pow3_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t
         return;
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_MPZ_FAST_MUL
+    if (rhs->len != 0 && !mod->neg && (mod->dig[0] & 1) != 0) {
+        mpz_pow3_mont(dest, lhs, rhs, mod);
+        return;
+    }
+    #endif
+
     mpz_set_from_int(dest, 1);
 
     if (rhs->len == 0) {
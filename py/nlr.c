@@ -45,6 +45,8 @@ unsigned int nlr_push_tail(nlr_buf_t *nlr) {
     return 0; // normal return
 }
 
+// CIRCUITPY-CHANGE: nlr_pop is usually inlined by the macro in nlr.h
+#undef nlr_pop
 void nlr_pop(void) {
     nlr_buf_t **top = &MP_STATE_THREAD(nlr_top);
     *top = (*top)->prev;
@@ -175,6 +175,12 @@ unsigned int nlr_push(nlr_buf_t *);
 
 unsigned int nlr_push_tail(nlr_buf_t *top);
 void nlr_pop(void);
+// CIRCUITPY-CHANGE: every nlr_push that doesn't raise is followed by this, so
+// inline it. The function is kept for the native code glue table.
+#define nlr_pop() do { \
+        nlr_buf_t **_nlr_top = &MP_STATE_THREAD(nlr_top); \
+        *_nlr_top = (*_nlr_top)->prev; \
+} while (0)
 NORETURN void nlr_jump(void *val);
 
 #if MICROPY_ENABLE_VM_ABORT
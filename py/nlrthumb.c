@@ -40,12 +40,11 @@
 __attribute__((naked, returns_twice)) unsigned int nlr_push(nlr_buf_t *nlr) {
 
     __asm volatile (
+        #if !defined(__thumb2__)
         "str    r4, [r0, #12]       \n" // store r4 into nlr_buf
         "str    r5, [r0, #16]       \n" // store r5 into nlr_buf
         "str    r6, [r0, #20]       \n" // store r6 into nlr_buf
         "str    r7, [r0, #24]       \n" // store r7 into nlr_buf
-
-        #if !defined(__thumb2__)
         "mov    r1, r8              \n"
         "str    r1, [r0, #28]       \n" // store r8 into nlr_buf
         "mov    r1, r9              \n"
@@ -59,10 +58,9 @@ __attribute__((naked, returns_twice)) unsigned int nlr_push(nlr_buf_t *nlr) {
         "mov    r1, lr              \n"
         "str    r1, [r0, #8]        \n" // store lr into nlr_buf
         #else
-        "str    r8, [r0, #28]       \n" // store r8 into nlr_buf
-        "str    r9, [r0, #32]       \n" // store r9 into nlr_buf
-        "str    r10, [r0, #36]      \n" // store r10 into nlr_buf
-        "str    r11, [r0, #40]      \n" // store r11 into nlr_buf
+        // CIRCUITPY-CHANGE: one stm for r4-r11 (sp can't be in the list)
+        "add    r1, r0, #12         \n"
+        "stm    r1, {r4-r11}        \n" // store r4-r11 into nlr_buf
         "str    r13, [r0, #44]      \n" // store r13=sp into nlr_buf
         #if MICROPY_NLR_NUM_REGS == 16
         "vstr   d8, [r0, #48]       \n" // store s16-s17 into nlr_buf
@@ -98,12 +96,12 @@ NORETURN void nlr_jump(void *val) {
 
     __asm volatile (
         "mov    r0, %0              \n" // r0 points to nlr_buf
+
+        #if !defined(__thumb2__)
         "ldr    r4, [r0, #12]       \n" // load r4 from nlr_buf
         "ldr    r5, [r0, #16]       \n" // load r5 from nlr_buf
         "ldr    r6, [r0, #20]       \n" // load r6 from nlr_buf
         "ldr    r7, [r0, #24]       \n" // load r7 from nlr_buf
-
-        #if !defined(__thumb2__)
         "ldr    r1, [r0, #28]       \n" // load r8 from nlr_buf
         "mov    r8, r1              \n"
         "ldr    r1, [r0, #32]       \n" // load r9 from nlr_buf
@@ -117,10 +115,9 @@ NORETURN void nlr_jump(void *val) {
         "ldr    r1, [r0, #8]        \n" // load lr from nlr_buf
         "mov    lr, r1              \n"
         #else
-        "ldr    r8, [r0, #28]       \n" // load r8 from nlr_buf
-        "ldr    r9, [r0, #32]       \n" // load r9 from nlr_buf
-        "ldr    r10, [r0, #36]      \n" // load r10 from nlr_buf
-        "ldr    r11, [r0, #40]      \n" // load r11 from nlr_buf
+        // CIRCUITPY-CHANGE: one ldm for r4-r11
+        "add    r1, r0, #12         \n"
+        "ldm    r1, {r4-r11}        \n" // load r4-r11 from nlr_buf
         "ldr    r13, [r0, #44]      \n" // load r13=sp from nlr_buf
         #if MICROPY_NLR_NUM_REGS == 16
         "vldr   d8, [r0, #48]       \n" // load s16-s17 from nlr_buf
@@ -30,6 +30,7 @@
 #include <assert.h>
 
 #include "shared/runtime/interrupt_char.h"
+#include "py/gc.h"
 #include "py/obj.h"
 #include "py/objtype.h"
 #include "py/objint.h"
@@ -45,6 +46,10 @@
 MP_NOINLINE void *mp_obj_malloc_helper(size_t num_bytes, const mp_obj_type_t *type) {
     mp_obj_base_t *base = (mp_obj_base_t *)m_malloc(num_bytes);
     base->type = type;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_GC_ALLOC_SITES
+    gc_site_set_is_obj(base);
+    #endif
     return base;
 }
 
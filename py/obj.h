@@ -492,7 +492,9 @@ typedef struct _mp_map_t {
     size_t all_keys_are_qstrs : 1;
     size_t is_fixed : 1;    // if set, table is fixed/read-only and can't be modified
     size_t is_ordered : 1;  // if set, table is an ordered array, not a hash map
-    size_t used : (8 * sizeof(size_t) - 3);
+    // CIRCUITPY-CHANGE
+    size_t is_watched : 1;  // if set, key changes invalidate the global lookup cache
+    size_t used : (8 * sizeof(size_t) - 4);
     size_t alloc;
     mp_map_elem_t *table;
 } mp_map_t;
@@ -517,6 +519,11 @@ void mp_map_deinit(mp_map_t *map);
 void mp_map_free(mp_map_t *map);
 mp_map_elem_t *mp_map_lookup(mp_map_t *map, mp_obj_t index, mp_map_lookup_kind_t lookup_kind);
 void mp_map_clear(mp_map_t *map);
+// CIRCUITPY-CHANGE
+size_t mp_map_table_nbytes(const mp_map_t *map);
+#if MICROPY_MAP_COMPACT
+mp_map_elem_t *mp_map_last(mp_map_t *map);
+#endif
 void mp_map_dump(mp_map_t *map);
 
 // Underlying set implementation (not set object)
@@ -1041,6 +1048,11 @@ extern uint64_t float_to_uint64(float f);
 #endif
 mp_obj_t mp_obj_new_exception(const mp_obj_type_t *exc_type);
 mp_obj_t mp_obj_new_exception_args(const mp_obj_type_t *exc_type, size_t n_args, const mp_obj_t *args);
+// CIRCUITPY-CHANGE
+mp_obj_t mp_obj_new_exception_errno(int errno_);
+#if MICROPY_OPT_CACHE_EXCEPTION_ARGS
+void mp_obj_exception_args_cache_clear(void);
+#endif
 #if MICROPY_ERROR_REPORTING == MICROPY_ERROR_REPORTING_NONE
 #define mp_obj_new_exception_msg(exc_type, msg) mp_obj_new_exception(exc_type)
 #define mp_obj_new_exception_msg_varg(exc_type, ...) mp_obj_new_exception(exc_type)
@@ -191,6 +191,20 @@ STATIC mp_obj_t array_make_new(const mp_obj_type_t *type_in, size_t n_args, size
 #if MICROPY_PY_BUILTINS_BYTEARRAY
 STATIC mp_obj_t bytearray_make_new(const mp_obj_type_t *type_in, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     (void)type_in;
+    // CIRCUITPY-CHANGE: bytearray(n, fast=True) places the items in fast memory
+    #if MICROPY_ENABLE_GC && MICROPY_GC_SPLIT_HEAP && MICROPY_GC_SLOW_AREAS
+    if (n_args == 1 && n_kw == 1 && mp_obj_is_int(args[0]) && args[1] == MP_OBJ_NEW_QSTR(MP_QSTR_fast)) {
+        mp_uint_t len = mp_obj_get_int(args[0]);
+        if (!mp_obj_is_true(args[2])) {
+            return bytearray_make_new(type_in, 1, 0, args);
+        }
+        mp_obj_array_t *o = array_new(BYTEARRAY_TYPECODE, 0);
+        o->len = len;
+        o->items = m_malloc_fast(len);
+        memset(o->items, 0, len);
+        return MP_OBJ_FROM_PTR(o);
+    }
+    #endif
     // Can take 2nd/3rd arg if constructs from str
     mp_arg_check_num(n_args, n_kw, 0, 3, false);
 
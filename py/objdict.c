@@ -152,7 +152,8 @@ STATIC mp_obj_t dict_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
             return MP_OBJ_NEW_SMALL_INT(self->map.used);
         #if MICROPY_PY_SYS_GETSIZEOF
         case MP_UNARY_OP_SIZEOF: {
-            size_t sz = sizeof(*self) + sizeof(*self->map.table) * self->map.alloc;
+            // CIRCUITPY-CHANGE
+            size_t sz = sizeof(*self) + mp_map_table_nbytes(&self->map);
             return MP_OBJ_NEW_SMALL_INT(sz);
         }
         #endif
@@ -283,7 +284,8 @@ mp_obj_t mp_obj_dict_copy(mp_obj_t self_in) {
     other->map.all_keys_are_qstrs = self->map.all_keys_are_qstrs;
     other->map.is_fixed = 0;
     other->map.is_ordered = self->map.is_ordered;
-    memcpy(other->map.table, self->map.table, self->map.alloc * sizeof(mp_map_elem_t));
+    // CIRCUITPY-CHANGE: copy the hash index that may follow the entries
+    memcpy(other->map.table, self->map.table, mp_map_table_nbytes(&self->map));
     return other_out;
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(dict_copy_obj, mp_obj_dict_copy);
@@ -374,6 +376,16 @@ STATIC mp_obj_t dict_popitem(mp_obj_t self_in) {
     if (self->map.used == 0) {
         mp_raise_msg_varg(&mp_type_KeyError, MP_ERROR_TEXT("pop from empty %q"), MP_QSTR_dict);
     }
+    // CIRCUITPY-CHANGE
+    #if MICROPY_MAP_COMPACT
+    if (!self->map.is_ordered) {
+        // Entries are kept in insertion order, so pop the newest one, as CPython does.
+        mp_map_elem_t *last = mp_map_last(&self->map);
+        mp_obj_t items[] = {last->key, last->value};
+        mp_map_lookup(&self->map, last->key, MP_MAP_LOOKUP_REMOVE_IF_FOUND)->value = MP_OBJ_NULL;
+        return mp_obj_new_tuple(2, items);
+    }
+    #endif
     size_t cur = 0;
     #if MICROPY_PY_COLLECTIONS_ORDEREDDICT
     if (self->map.is_ordered) {
@@ -126,7 +126,85 @@ mp_obj_exception_t *mp_obj_exception_get_native(mp_obj_t self_in) {
     }
 }
 
+// CIRCUITPY-CHANGE: moved up to be used by decompress_error_text_maybe
+#if MICROPY_ERROR_REPORTING != MICROPY_ERROR_REPORTING_NONE || MICROPY_OPT_CACHE_EXCEPTION_ARGS
+// The following struct and function implement a simple printer that conservatively
+// allocates memory and truncates the output data if no more memory can be obtained.
+// It leaves room for a null byte at the end of the buffer.
+
+struct _exc_printer_t {
+    bool allow_realloc;
+    size_t alloc;
+    size_t len;
+    byte *buf;
+};
+
+STATIC void exc_add_strn(void *data, const char *str, size_t len) {
+    struct _exc_printer_t *pr = data;
+    if (pr->len + len >= pr->alloc) {
+        // Not enough room for data plus a null byte so try to grow the buffer
+        if (pr->allow_realloc) {
+            size_t new_alloc = pr->alloc + len + 16;
+            byte *new_buf = m_renew_maybe(byte, pr->buf, pr->alloc, new_alloc, true);
+            if (new_buf == NULL) {
+                pr->allow_realloc = false;
+                len = pr->alloc - pr->len - 1;
+            } else {
+                pr->alloc = new_alloc;
+                pr->buf = new_buf;
+            }
+        } else {
+            len = pr->alloc - pr->len - 1;
+        }
+    }
+    memcpy(pr->buf + pr->len, str, len);
+    pr->len += len;
+}
+#endif
+
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_CACHE_EXCEPTION_ARGS
+// A str made by mp_obj_new_exception_msg holds the untranslated message in
+// data until it is first needed as a str; printing it doesn't need that.
+#define LAZY_ERROR_TEXT_HASH ((size_t)-1)
+
+STATIC mp_obj_str_t *lazy_error_text(mp_obj_exception_t *o) {
+    if (o->args->len == 1 && mp_obj_is_obj(o->args->items[0]) && mp_obj_is_exact_type(o->args->items[0], &mp_type_str)) {
+        mp_obj_str_t *o_str = MP_OBJ_TO_PTR(o->args->items[0]);
+        if (o_str->hash == LAZY_ERROR_TEXT_HASH) {
+            return o_str;
+        }
+    }
+    return NULL;
+}
+
+#endif
+
 STATIC void decompress_error_text_maybe(mp_obj_exception_t *o) {
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_CACHE_EXCEPTION_ARGS
+    mp_obj_str_t *lazy_str = lazy_error_text(o);
+    if (lazy_str != NULL) {
+        mp_rom_error_text_t msg = (mp_rom_error_text_t)lazy_str->data;
+        size_t alloc = decompress_length(msg);
+        byte *buf = m_new_maybe(byte, alloc);
+        if (buf == NULL) {
+            // The str is shared so leave it alone; this exception loses its message.
+            o->args = (mp_obj_tuple_t *)&mp_const_empty_tuple_obj;
+            return;
+        }
+        // Format rather than copy so that "%%" comes out the same as when raised.
+        struct _exc_printer_t exc_pr = {false, alloc, 0, buf};
+        mp_print_t print = {&exc_pr, exc_add_strn};
+        mp_cprintf(&print, msg);
+        buf[exc_pr.len] = '\0';
+        lazy_str->len = exc_pr.len;
+        lazy_str->data = buf;
+        lazy_str->hash = qstr_compute_hash(buf, exc_pr.len);
+        return;
+    }
+    #endif
+
     #if MICROPY_ROM_TEXT_COMPRESSION
     if (o->args->len == 1 && mp_obj_is_exact_type(o->args->items[0], &mp_type_str)) {
         mp_obj_str_t *o_str = MP_OBJ_TO_PTR(o->args->items[0]);
@@ -172,6 +250,17 @@ void mp_obj_exception_print(const mp_print_t *print, mp_obj_t o_in, mp_print_kin
         mp_print_str(print, ": ");
     }
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_CACHE_EXCEPTION_ARGS
+    if (k == PRINT_STR || k == PRINT_EXC) {
+        mp_obj_str_t *lazy_str = lazy_error_text(o);
+        if (lazy_str != NULL) {
+            mp_cprintf(print, (mp_rom_error_text_t)lazy_str->data);
+            return;
+        }
+    }
+    #endif
+
     decompress_error_text_maybe(o);
 
     if (k == PRINT_STR || k == PRINT_EXC) {
@@ -213,9 +302,9 @@ void mp_obj_exception_initialize0(mp_obj_exception_t *o_exc, const mp_obj_type_t
     mp_obj_exception_clear_traceback(o_exc);
 }
 
-mp_obj_t mp_obj_exception_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
-    mp_arg_check_num(n_args, n_kw, 0, MP_OBJ_FUN_ARGS_MAX, false);
-
+// CIRCUITPY-CHANGE: split out of mp_obj_exception_make_new so that an args
+// tuple that can be shared doesn't have to be copied.
+STATIC mp_obj_exception_t *exception_alloc(const mp_obj_type_t *type) {
     // Try to allocate memory for the exception, with fallback to emergency exception object
     mp_obj_exception_t *o_exc = m_new_obj_maybe(mp_obj_exception_t);
     if (o_exc == NULL) {
@@ -224,8 +313,15 @@ mp_obj_t mp_obj_exception_make_new(const mp_obj_type_t *type, size_t n_args, siz
 
     // Populate the exception object
     o_exc->base.type = type;
-    // CIRCUITPY-CHANGE
     o_exc->traceback = (mp_obj_traceback_t *)&mp_const_empty_traceback_obj;
+    return o_exc;
+}
+
+mp_obj_t mp_obj_exception_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
+    mp_arg_check_num(n_args, n_kw, 0, MP_OBJ_FUN_ARGS_MAX, false);
+
+    // CIRCUITPY-CHANGE
+    mp_obj_exception_t *o_exc = exception_alloc(type);
 
     mp_obj_tuple_t *o_tuple;
     if (n_args == 0) {
@@ -267,10 +363,11 @@ mp_obj_t mp_obj_exception_make_new(const mp_obj_type_t *type, size_t n_args, siz
 mp_obj_t mp_obj_exception_get_value(mp_obj_t self_in) {
     // CIRCUITPY-CHANGE
     mp_obj_exception_t *self = mp_obj_exception_get_native(self_in);
+    // CIRCUITPY-CHANGE: may drop the message if there's no memory for it
+    decompress_error_text_maybe(self);
     if (self->args->len == 0) {
         return mp_const_none;
     } else {
-        decompress_error_text_maybe(self);
         return self->args->items[0];
     }
 }
@@ -480,43 +577,96 @@ mp_obj_t mp_obj_new_exception_args(const mp_obj_type_t *exc_type, size_t n_args,
     return mp_obj_exception_make_new(exc_type, n_args, 0, args);
 }
 
-#if MICROPY_ERROR_REPORTING != MICROPY_ERROR_REPORTING_NONE
-mp_obj_t mp_obj_new_exception_msg(const mp_obj_type_t *exc_type, mp_rom_error_text_t msg) {
-    // CIRCUITPY-CHANGE: is different here and for many lines below.
-    return mp_obj_new_exception_msg_varg(exc_type, msg);
-}
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_CACHE_EXCEPTION_ARGS
+// Errors that code polls for get an args tuple that never needs allocating.
+STATIC const mp_rom_obj_tuple_t errno_eagain_args = {{&mp_type_tuple}, 1, {MP_ROM_INT(MP_EAGAIN)}};
+STATIC const mp_rom_obj_tuple_t errno_etimedout_args = {{&mp_type_tuple}, 1, {MP_ROM_INT(MP_ETIMEDOUT)}};
+STATIC const mp_rom_obj_tuple_t errno_einprogress_args = {{&mp_type_tuple}, 1, {MP_ROM_INT(MP_EINPROGRESS)}};
+#endif
 
-// The following struct and function implement a simple printer that conservatively
-// allocates memory and truncates the output data if no more memory can be obtained.
-// It leaves room for a null byte at the end of the buffer.
+// CIRCUITPY-CHANGE
+mp_obj_t mp_obj_new_exception_errno(int errno_) {
+    #if MICROPY_OPT_CACHE_EXCEPTION_ARGS
+    const mp_rom_obj_tuple_t *args = NULL;
+    if (errno_ == MP_EAGAIN) {
+        args = &errno_eagain_args;
+    } else if (errno_ == MP_ETIMEDOUT) {
+        args = &errno_etimedout_args;
+    } else if (errno_ == MP_EINPROGRESS) {
+        args = &errno_einprogress_args;
+    }
+    if (args != NULL) {
+        mp_obj_exception_t *o_exc = exception_alloc(&mp_type_OSError);
+        o_exc->args = (mp_obj_tuple_t *)args;
+        return MP_OBJ_FROM_PTR(o_exc);
+    }
+    #endif
+    mp_obj_t arg = MP_OBJ_NEW_SMALL_INT(errno_);
+    return mp_obj_exception_make_new(&mp_type_OSError, 1, 0, &arg);
+}
 
-struct _exc_printer_t {
-    bool allow_realloc;
-    size_t alloc;
-    size_t len;
-    byte *buf;
-};
+#if MICROPY_ERROR_REPORTING != MICROPY_ERROR_REPORTING_NONE
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_CACHE_EXCEPTION_ARGS
+// The args tuples of the most recently raised messages, most recent first.
+// Tuples are immutable, so exceptions raised with the same message share one.
+MP_REGISTER_ROOT_POINTER(const struct compressed_string *exception_args_cache_msg[MICROPY_OPT_CACHE_EXCEPTION_ARGS_SIZE]);
+MP_REGISTER_ROOT_POINTER(mp_obj_tuple_t *exception_args_cache[MICROPY_OPT_CACHE_EXCEPTION_ARGS_SIZE]);
+
+void mp_obj_exception_args_cache_clear(void) {
+    memset(MP_STATE_VM(exception_args_cache_msg), 0, sizeof(MP_STATE_VM(exception_args_cache_msg)));
+    memset(MP_STATE_VM(exception_args_cache), 0, sizeof(MP_STATE_VM(exception_args_cache)));
+}
 
-STATIC void exc_add_strn(void *data, const char *str, size_t len) {
-    struct _exc_printer_t *pr = data;
-    if (pr->len + len >= pr->alloc) {
-        // Not enough room for data plus a null byte so try to grow the buffer
-        if (pr->allow_realloc) {
-            size_t new_alloc = pr->alloc + len + 16;
-            byte *new_buf = m_renew_maybe(byte, pr->buf, pr->alloc, new_alloc, true);
-            if (new_buf == NULL) {
-                pr->allow_realloc = false;
-                len = pr->alloc - pr->len - 1;
-            } else {
-                pr->alloc = new_alloc;
-                pr->buf = new_buf;
-            }
-        } else {
-            len = pr->alloc - pr->len - 1;
+STATIC mp_obj_tuple_t *exception_args_for_msg(mp_rom_error_text_t msg) {
+    const struct compressed_string **keys = MP_STATE_VM(exception_args_cache_msg);
+    mp_obj_tuple_t **tuples = MP_STATE_VM(exception_args_cache);
+    size_t i = 0;
+    while (i < MICROPY_OPT_CACHE_EXCEPTION_ARGS_SIZE - 1 && keys[i] != msg) {
+        i++;
+    }
+    mp_obj_tuple_t *o_tuple = keys[i] == msg ? tuples[i] : NULL;
+    if (o_tuple == NULL) {
+        // Miss: evict the last entry (i is its index here) for a new tuple.
+        mp_obj_str_t *o_str = m_new_obj_maybe(mp_obj_str_t);
+        if (o_str == NULL) {
+            return NULL;
+        }
+        o_tuple = m_new_obj_var_maybe(mp_obj_tuple_t, mp_obj_t, 1);
+        if (o_tuple == NULL) {
+            m_del_obj(mp_obj_str_t, o_str);
+            return NULL;
         }
+        o_str->base.type = &mp_type_str;
+        o_str->hash = LAZY_ERROR_TEXT_HASH;
+        o_str->len = 0;
+        o_str->data = (const byte *)msg;
+        o_tuple->base.type = &mp_type_tuple;
+        o_tuple->len = 1;
+        o_tuple->items[0] = MP_OBJ_FROM_PTR(o_str);
     }
-    memcpy(pr->buf + pr->len, str, len);
-    pr->len += len;
+    // Move to the front.
+    memmove(&keys[1], &keys[0], i * sizeof(keys[0]));
+    memmove(&tuples[1], &tuples[0], i * sizeof(tuples[0]));
+    keys[0] = msg;
+    tuples[0] = o_tuple;
+    return o_tuple;
+}
+#endif
+
+mp_obj_t mp_obj_new_exception_msg(const mp_obj_type_t *exc_type, mp_rom_error_text_t msg) {
+    // CIRCUITPY-CHANGE: is different here and for many lines below.
+    #if MICROPY_OPT_CACHE_EXCEPTION_ARGS
+    assert(MP_OBJ_TYPE_GET_SLOT_OR_NULL(exc_type, make_new) == mp_obj_exception_make_new);
+    mp_obj_tuple_t *o_tuple = exception_args_for_msg(msg);
+    if (o_tuple != NULL) {
+        mp_obj_exception_t *o_exc = exception_alloc(exc_type);
+        o_exc->args = o_tuple;
+        return MP_OBJ_FROM_PTR(o_exc);
+    }
+    #endif
+    return mp_obj_new_exception_msg_varg(exc_type, msg);
 }
 
 mp_obj_t mp_obj_new_exception_msg_varg(const mp_obj_type_t *exc_type, mp_rom_error_text_t fmt, ...) {
@@ -301,39 +301,600 @@ STATIC mp_obj_t list_pop(size_t n_args, const mp_obj_t *args) {
     return mp_obj_list_pop(self, index);
 }
 
-STATIC void mp_quicksort(mp_obj_t *head, mp_obj_t *tail, mp_obj_t key_fn, mp_obj_t binop_less_result) {
+// CIRCUITPY-CHANGE: list.sort is a stable, adaptive merge sort after CPython's
+// Timsort. Runs already in order, ascending or strictly descending, are found
+// and merged, galloping through either run while it keeps winning. Merges copy
+// the shorter run to scratch, which starts on the C stack; if a larger scratch
+// can't be allocated, runs are merged in place by rotation, so sorting never
+// runs out of memory. With a key function, each element is sorted as a pair of
+// its key and itself, so the key is computed once per element.
+
+// Elements are sorted in scratch on the C stack up to this many.
+#define SORT_STACK_SCRATCH (16)
+// A merge gallops once a run wins this many comparisons in a row.
+#define SORT_MIN_GALLOP (7)
+
+typedef struct _sort_run_t {
+    mp_obj_t *base;
+    size_t len;
+} sort_run_t;
+
+// While a merge has elements in scratch, the slots they belong in. dest is
+// the first slot, or the last one when the merge works from the end.
+typedef struct _sort_hole_t {
+    mp_obj_t *dest;
+    mp_obj_t *src;
+    size_t len;
+    bool from_end;
+} sort_hole_t;
+
+typedef struct _sort_state_t {
+    nlr_jump_callback_node_t callback;
+    size_t width; // mp_obj_t per element; the first is the key.
+    bool reverse;
+    size_t min_gallop;
+    mp_obj_t *scratch;
+    size_t scratch_len; // In elements.
+    sort_hole_t hole;
+    size_t pending;
+    sort_run_t runs[sizeof(size_t) * 8];
+    mp_obj_t stack_scratch[SORT_STACK_SCRATCH * 2];
+} sort_state_t;
+
+#define SORT_AT(st, p, i) ((p) + (mp_int_t)(i) * (mp_int_t)(st)->width)
+
+static inline bool sort_less(sort_state_t *st, const mp_obj_t *a, const mp_obj_t *b) {
+    if (st->reverse) {
+        const mp_obj_t *t = a;
+        a = b;
+        b = t;
+    }
+    return mp_obj_is_true(mp_binary_op(MP_BINARY_OP_LESS, a[0], b[0]));
+}
+
+static inline void sort_move(sort_state_t *st, mp_obj_t *dest, const mp_obj_t *src, size_t n) {
+    memmove(dest, src, n * st->width * sizeof(mp_obj_t));
+}
+
+STATIC void sort_reverse(sort_state_t *st, mp_obj_t *lo, mp_obj_t *hi) {
+    // hi is the last element.
+    while (lo < hi) {
+        for (size_t i = 0; i < st->width; i++) {
+            mp_obj_t t = lo[i];
+            lo[i] = hi[i];
+            hi[i] = t;
+        }
+        lo += st->width;
+        hi -= st->width;
+    }
+}
+
+// An exception in a comparison leaves the elements in scratch unplaced.
+STATIC void sort_fill_hole(sort_state_t *st) {
+    sort_hole_t *h = &st->hole;
+    if (h->len > 0) {
+        mp_obj_t *dest = h->from_end ? SORT_AT(st, h->dest, 1 - (mp_int_t)h->len) : h->dest;
+        sort_move(st, dest, h->src, h->len);
+        h->len = 0;
+    }
+}
+
+STATIC void sort_restore(void *ctx) {
+    sort_state_t *st = ctx;
+    sort_fill_hole(st);
+}
+
+// Sorts n elements from a, of which the first start are already sorted.
+STATIC void sort_binary_insertion(sort_state_t *st, mp_obj_t *a, size_t n, size_t start) {
+    mp_obj_t pivot[2];
+    for (size_t i = start; i < n; i++) {
+        mp_obj_t *p = SORT_AT(st, a, i);
+        // Find the first element that the new one is less than, which keeps
+        // equal elements in order.
+        size_t lo = 0, hi = i;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (sort_less(st, p, SORT_AT(st, a, mid))) {
+                hi = mid;
+            } else {
+                lo = mid + 1;
+            }
+        }
+        if (lo < i) {
+            sort_move(st, pivot, p, 1);
+            sort_move(st, SORT_AT(st, a, lo + 1), SORT_AT(st, a, lo), i - lo);
+            sort_move(st, SORT_AT(st, a, lo), pivot, 1);
+        }
+    }
+}
+
+// Returns the length of the run at the start of a, reversing it if it's
+// strictly descending.
+STATIC size_t sort_count_run(sort_state_t *st, mp_obj_t *a, size_t n) {
+    if (n == 1) {
+        return 1;
+    }
+    size_t len = 2;
+    if (sort_less(st, SORT_AT(st, a, 1), a)) {
+        while (len < n && sort_less(st, SORT_AT(st, a, len), SORT_AT(st, a, len - 1))) {
+            len++;
+        }
+        sort_reverse(st, a, SORT_AT(st, a, len - 1));
+    } else {
+        while (len < n && !sort_less(st, SORT_AT(st, a, len), SORT_AT(st, a, len - 1))) {
+            len++;
+        }
+    }
+    return len;
+}
+
+// Returns where key goes among the n sorted elements of a, before any equal
+// ones, searching out from a[hint].
+STATIC size_t sort_gallop_left(sort_state_t *st, const mp_obj_t *key, mp_obj_t *a, size_t n, size_t hint) {
+    mp_int_t last = 0, ofs = 1;
+    if (sort_less(st, SORT_AT(st, a, hint), key)) {
+        // a[hint] < key: gallop right until a[hint + last] < key <= a[hint + ofs].
+        mp_int_t max = n - hint;
+        while (ofs < max && sort_less(st, SORT_AT(st, a, hint + ofs), key)) {
+            last = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        if (ofs > max) {
+            ofs = max;
+        }
+        last += hint;
+        ofs += hint;
+    } else {
+        // key <= a[hint]: gallop left until a[hint - ofs] < key <= a[hint - last].
+        mp_int_t max = hint + 1;
+        while (ofs < max && !sort_less(st, SORT_AT(st, a, hint - ofs), key)) {
+            last = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        if (ofs > max) {
+            ofs = max;
+        }
+        mp_int_t k = last;
+        last = hint - ofs;
+        ofs = hint - k;
+    }
+    // a[last] < key <= a[ofs], so binary search between them.
+    last++;
+    while (last < ofs) {
+        mp_int_t mid = last + ((ofs - last) >> 1);
+        if (sort_less(st, SORT_AT(st, a, mid), key)) {
+            last = mid + 1;
+        } else {
+            ofs = mid;
+        }
+    }
+    return ofs;
+}
+
+// Like sort_gallop_left, but key goes after any equal elements.
+STATIC size_t sort_gallop_right(sort_state_t *st, const mp_obj_t *key, mp_obj_t *a, size_t n, size_t hint) {
+    mp_int_t last = 0, ofs = 1;
+    if (sort_less(st, key, SORT_AT(st, a, hint))) {
+        // key < a[hint]: gallop left until a[hint - ofs] <= key < a[hint - last].
+        mp_int_t max = hint + 1;
+        while (ofs < max && sort_less(st, key, SORT_AT(st, a, hint - ofs))) {
+            last = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        if (ofs > max) {
+            ofs = max;
+        }
+        mp_int_t k = last;
+        last = hint - ofs;
+        ofs = hint - k;
+    } else {
+        // a[hint] <= key: gallop right until a[hint + last] <= key < a[hint + ofs].
+        mp_int_t max = n - hint;
+        while (ofs < max && !sort_less(st, key, SORT_AT(st, a, hint + ofs))) {
+            last = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        if (ofs > max) {
+            ofs = max;
+        }
+        last += hint;
+        ofs += hint;
+    }
+    last++;
+    while (last < ofs) {
+        mp_int_t mid = last + ((ofs - last) >> 1);
+        if (sort_less(st, key, SORT_AT(st, a, mid))) {
+            ofs = mid;
+        } else {
+            last = mid + 1;
+        }
+    }
+    return ofs;
+}
+
+// Makes room in scratch for n elements, returning false if there's no memory.
+STATIC bool sort_reserve(sort_state_t *st, size_t n) {
+    if (n <= st->scratch_len) {
+        return true;
+    }
+    mp_obj_t *scratch = m_new_maybe(mp_obj_t, n * st->width);
+    if (scratch == NULL) {
+        return false;
+    }
+    if (st->scratch != st->stack_scratch) {
+        m_del(mp_obj_t, st->scratch, st->scratch_len * st->width);
+    }
+    st->scratch = scratch;
+    st->scratch_len = n;
+    return true;
+}
+
+// Swaps the na elements at a with the nb following them.
+STATIC void sort_rotate(sort_state_t *st, mp_obj_t *a, size_t na, size_t nb) {
+    if (na == 0 || nb == 0) {
+        return;
+    }
+    mp_obj_t *b = SORT_AT(st, a, na);
+    sort_reverse(st, a, SORT_AT(st, b, -1));
+    sort_reverse(st, b, SORT_AT(st, b, nb - 1));
+    sort_reverse(st, a, SORT_AT(st, a, na + nb - 1));
+}
+
+// Merges the na elements at a with the nb following them without scratch, by
+// splitting the longer run, rotating the matching part of the other past it
+// and merging each side.
+STATIC void sort_merge_in_place(sort_state_t *st, mp_obj_t *a, size_t na, size_t nb) {
     MP_STACK_CHECK();
-    while (head < tail) {
-        mp_obj_t *h = head - 1;
-        mp_obj_t *t = tail;
-        mp_obj_t v = key_fn == MP_OBJ_NULL ? tail[0] : mp_call_function_1(key_fn, tail[0]); // get pivot using key_fn
-        for (;;) {
-            do {++h;
-            } while (h < t && mp_binary_op(MP_BINARY_OP_LESS, key_fn == MP_OBJ_NULL ? h[0] : mp_call_function_1(key_fn, h[0]), v) == binop_less_result);
-            do {--t;
-            } while (h < t && mp_binary_op(MP_BINARY_OP_LESS, v, key_fn == MP_OBJ_NULL ? t[0] : mp_call_function_1(key_fn, t[0])) == binop_less_result);
-            if (h >= t) {
-                break;
+    while (na > 0 && nb > 0) {
+        mp_obj_t *b = SORT_AT(st, a, na);
+        if (na + nb == 2) {
+            if (sort_less(st, b, a)) {
+                sort_rotate(st, a, 1, 1);
             }
-            mp_obj_t x = h[0];
-            h[0] = t[0];
-            t[0] = x;
-        }
-        mp_obj_t x = h[0];
-        h[0] = tail[0];
-        tail[0] = x;
-        // do the smaller recursive call first, to keep stack within O(log(N))
-        if (t - head < tail - h - 1) {
-            mp_quicksort(head, t, key_fn, binop_less_result);
-            head = h + 1;
+            return;
+        }
+        size_t cut_a, cut_b;
+        if (na > nb) {
+            cut_a = na / 2;
+            cut_b = sort_gallop_left(st, SORT_AT(st, a, cut_a), b, nb, 0);
         } else {
-            mp_quicksort(h + 1, tail, key_fn, binop_less_result);
-            tail = t;
+            cut_b = nb / 2;
+            cut_a = sort_gallop_right(st, SORT_AT(st, b, cut_b), a, na, 0);
+        }
+        sort_rotate(st, SORT_AT(st, a, cut_a), na - cut_a, cut_b);
+        // The first cut_a + cut_b elements merge among themselves, as do the
+        // rest. Recurse on the smaller part.
+        mp_obj_t *mid = SORT_AT(st, a, cut_a + cut_b);
+        size_t na2 = na - cut_a, nb2 = nb - cut_b;
+        if (cut_a + cut_b < na2 + nb2) {
+            sort_merge_in_place(st, a, cut_a, cut_b);
+            a = mid;
+            na = na2;
+            nb = nb2;
+        } else {
+            sort_merge_in_place(st, mid, na2, nb2);
+            na = cut_a;
+            nb = cut_b;
         }
     }
 }
 
-// TODO Python defines sort to be stable but ours is not
+// Merges na elements at a with the nb following them, where na <= nb, the
+// first of b goes before the first of a and the last of a goes after b.
+STATIC void sort_merge_lo(sort_state_t *st, mp_obj_t *a, size_t na, mp_obj_t *b, size_t nb) {
+    size_t w = st->width;
+    size_t min_gallop = st->min_gallop;
+    // The hole tracks the merge's destination and what's left of a, in scratch.
+    sort_hole_t *h = &st->hole;
+    sort_move(st, st->scratch, a, na);
+    h->dest = a;
+    h->src = st->scratch;
+    h->len = na;
+    h->from_end = false;
+
+    sort_move(st, h->dest, b, 1);
+    h->dest += w;
+    b += w;
+    if (--nb == 0) {
+        goto done;
+    }
+    if (h->len == 1) {
+        goto copy_b;
+    }
+    for (;;) {
+        size_t acount = 0, bcount = 0;
+        // Merge one at a time until one run wins min_gallop times in a row.
+        for (;;) {
+            if (sort_less(st, b, h->src)) {
+                sort_move(st, h->dest, b, 1);
+                h->dest += w;
+                b += w;
+                bcount++;
+                acount = 0;
+                if (--nb == 0) {
+                    goto done;
+                }
+                if (bcount >= min_gallop) {
+                    break;
+                }
+            } else {
+                sort_move(st, h->dest, h->src, 1);
+                h->dest += w;
+                h->src += w;
+                acount++;
+                bcount = 0;
+                if (--h->len == 1) {
+                    goto copy_b;
+                }
+                if (acount >= min_gallop) {
+                    break;
+                }
+            }
+        }
+        // Then gallop, moving whole stretches, for as long as that pays.
+        min_gallop++;
+        do {
+            min_gallop -= min_gallop > 1;
+            st->min_gallop = min_gallop;
+            size_t k = sort_gallop_right(st, b, h->src, h->len, 0);
+            acount = k;
+            if (k > 0) {
+                sort_move(st, h->dest, h->src, k);
+                h->dest += k * w;
+                h->src += k * w;
+                h->len -= k;
+                if (h->len == 1) {
+                    goto copy_b;
+                }
+                if (h->len == 0) {
+                    // Only when the comparisons are inconsistent.
+                    goto done;
+                }
+            }
+            sort_move(st, h->dest, b, 1);
+            h->dest += w;
+            b += w;
+            if (--nb == 0) {
+                goto done;
+            }
+            k = sort_gallop_left(st, h->src, b, nb, 0);
+            bcount = k;
+            if (k > 0) {
+                sort_move(st, h->dest, b, k);
+                h->dest += k * w;
+                b += k * w;
+                nb -= k;
+                if (nb == 0) {
+                    goto done;
+                }
+            }
+            sort_move(st, h->dest, h->src, 1);
+            h->dest += w;
+            h->src += w;
+            if (--h->len == 1) {
+                goto copy_b;
+            }
+        } while (acount >= SORT_MIN_GALLOP || bcount >= SORT_MIN_GALLOP);
+        min_gallop++;
+        st->min_gallop = min_gallop;
+    }
+copy_b:
+    // The last of a goes after the rest of b.
+    sort_move(st, h->dest, b, nb);
+    h->dest += nb * w;
+done:
+    sort_fill_hole(st);
+}
+
+// Like sort_merge_lo, but for nb <= na, so it merges from the end.
+STATIC void sort_merge_hi(sort_state_t *st, mp_obj_t *a, size_t na, mp_obj_t *b, size_t nb) {
+    size_t w = st->width;
+    size_t min_gallop = st->min_gallop;
+    // The hole tracks the merge's destination, from the end, and what's left
+    // of b, at the start of scratch.
+    sort_hole_t *h = &st->hole;
+    sort_move(st, st->scratch, b, nb);
+    h->dest = SORT_AT(st, b, nb - 1);
+    h->src = st->scratch;
+    h->len = nb;
+    h->from_end = true;
+    mp_obj_t *base_a = a;
+    mp_obj_t *pa = SORT_AT(st, a, na - 1);
+    #define PB SORT_AT(st, h->src, h->len - 1)
+
+    sort_move(st, h->dest, pa, 1);
+    h->dest -= w;
+    pa -= w;
+    if (--na == 0) {
+        goto done;
+    }
+    if (h->len == 1) {
+        goto copy_a;
+    }
+    for (;;) {
+        size_t acount = 0, bcount = 0;
+        for (;;) {
+            if (sort_less(st, PB, pa)) {
+                sort_move(st, h->dest, pa, 1);
+                h->dest -= w;
+                pa -= w;
+                acount++;
+                bcount = 0;
+                if (--na == 0) {
+                    goto done;
+                }
+                if (acount >= min_gallop) {
+                    break;
+                }
+            } else {
+                sort_move(st, h->dest, PB, 1);
+                h->dest -= w;
+                bcount++;
+                acount = 0;
+                if (--h->len == 1) {
+                    goto copy_a;
+                }
+                if (bcount >= min_gallop) {
+                    break;
+                }
+            }
+        }
+        min_gallop++;
+        do {
+            min_gallop -= min_gallop > 1;
+            st->min_gallop = min_gallop;
+            size_t k = na - sort_gallop_right(st, PB, base_a, na, na - 1);
+            acount = k;
+            if (k > 0) {
+                h->dest -= k * w;
+                pa -= k * w;
+                sort_move(st, h->dest + w, pa + w, k);
+                na -= k;
+                if (na == 0) {
+                    goto done;
+                }
+            }
+            sort_move(st, h->dest, PB, 1);
+            h->dest -= w;
+            if (--h->len == 1) {
+                goto copy_a;
+            }
+            k = h->len - sort_gallop_left(st, pa, h->src, h->len, h->len - 1);
+            bcount = k;
+            if (k > 0) {
+                h->dest -= k * w;
+                h->len -= k;
+                sort_move(st, h->dest + w, SORT_AT(st, h->src, h->len), k);
+                if (h->len == 1) {
+                    goto copy_a;
+                }
+                if (h->len == 0) {
+                    // Only when the comparisons are inconsistent.
+                    goto done;
+                }
+            }
+            sort_move(st, h->dest, pa, 1);
+            h->dest -= w;
+            pa -= w;
+            if (--na == 0) {
+                goto done;
+            }
+        } while (acount >= SORT_MIN_GALLOP || bcount >= SORT_MIN_GALLOP);
+        min_gallop++;
+        st->min_gallop = min_gallop;
+    }
+copy_a:
+    // The first of b goes before the rest of a.
+    h->dest -= na * w;
+    pa -= na * w;
+    sort_move(st, h->dest + w, pa + w, na);
+done:
+    sort_fill_hole(st);
+    #undef PB
+}
+
+// Merges runs i and i + 1 of the pending runs.
+STATIC void sort_merge_at(sort_state_t *st, size_t i) {
+    mp_obj_t *a = st->runs[i].base;
+    size_t na = st->runs[i].len;
+    mp_obj_t *b = st->runs[i + 1].base;
+    size_t nb = st->runs[i + 1].len;
+    st->runs[i].len = na + nb;
+    if (i == st->pending - 3) {
+        st->runs[i + 1] = st->runs[i + 2];
+    }
+    st->pending--;
+
+    // Elements of a before the first of b, and of b after the last of a, are
+    // already in place.
+    size_t k = sort_gallop_right(st, b, a, na, 0);
+    a = SORT_AT(st, a, k);
+    na -= k;
+    if (na == 0) {
+        return;
+    }
+    nb = sort_gallop_left(st, SORT_AT(st, a, na - 1), b, nb, nb - 1);
+    if (nb == 0) {
+        return;
+    }
+    if (!sort_reserve(st, MIN(na, nb))) {
+        sort_merge_in_place(st, a, na, nb);
+    } else if (na <= nb) {
+        sort_merge_lo(st, a, na, b, nb);
+    } else {
+        sort_merge_hi(st, a, na, b, nb);
+    }
+}
+
+// Merges pending runs until their lengths shrink faster than the Fibonacci
+// numbers going down the stack, which keeps merges balanced.
+STATIC void sort_merge_collapse(sort_state_t *st) {
+    sort_run_t *p = st->runs;
+    while (st->pending > 1) {
+        size_t n = st->pending - 2;
+        if ((n > 0 && p[n - 1].len <= p[n].len + p[n + 1].len) ||
+            (n > 1 && p[n - 2].len <= p[n - 1].len + p[n].len)) {
+            if (p[n - 1].len < p[n + 1].len) {
+                n--;
+            }
+        } else if (p[n].len > p[n + 1].len) {
+            break;
+        }
+        sort_merge_at(st, n);
+    }
+}
+
+// Sorts n elements of width mp_obj_t at a, comparing their first mp_obj_t.
+STATIC void mp_sort(mp_obj_t *a, size_t n, size_t width, bool reverse) {
+    sort_state_t st;
+    st.width = width;
+    st.reverse = reverse;
+    st.min_gallop = SORT_MIN_GALLOP;
+    st.scratch = st.stack_scratch;
+    st.scratch_len = SORT_STACK_SCRATCH;
+    st.hole.len = 0;
+    st.pending = 0;
+    nlr_push_jump_callback(&st.callback, sort_restore);
+
+    // Runs are made at least min_run long, which is 32 to 64 and chosen so that
+    // n / min_run is a power of two or just under, for balanced merges.
+    size_t min_run = n, r = 0;
+    while (min_run >= 64) {
+        r |= min_run & 1;
+        min_run >>= 1;
+    }
+    min_run += r;
+
+    mp_obj_t *lo = a;
+    size_t remaining = n;
+    while (remaining > 0) {
+        size_t len = sort_count_run(&st, lo, remaining);
+        if (len < min_run) {
+            size_t forced = MIN(min_run, remaining);
+            sort_binary_insertion(&st, lo, forced, len);
+            len = forced;
+        }
+        st.runs[st.pending].base = lo;
+        st.runs[st.pending].len = len;
+        st.pending++;
+        sort_merge_collapse(&st);
+        lo = SORT_AT(&st, lo, len);
+        remaining -= len;
+    }
+    while (st.pending > 1) {
+        size_t i = st.pending - 2;
+        if (i > 0 && st.runs[i - 1].len < st.runs[i + 1].len) {
+            i--;
+        }
+        sort_merge_at(&st, i);
+    }
+
+    nlr_pop_jump_callback(false);
+    if (st.scratch != st.stack_scratch) {
+        m_del(mp_obj_t, st.scratch, st.scratch_len * st.width);
+    }
+}
+
 mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_key, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_rom_obj = MP_ROM_NONE} },
@@ -350,10 +911,27 @@ mp_obj_t mp_obj_list_sort(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_
     mp_check_self(mp_obj_is_type(pos_args[0], &mp_type_list));
     mp_obj_list_t *self = native_list(pos_args[0]);
 
-    if (self->len > 1) {
-        mp_quicksort(self->items, self->items + self->len - 1,
-            args.key.u_obj == mp_const_none ? MP_OBJ_NULL : args.key.u_obj,
-            args.reverse.u_bool ? mp_const_false : mp_const_true);
+    size_t n = self->len;
+    if (n > 1) {
+        if (args.key.u_obj == mp_const_none) {
+            mp_sort(self->items, n, 1, args.reverse.u_bool);
+        } else {
+            // Sort (key, item) pairs, then put the items back.
+            mp_obj_t *pairs = m_new(mp_obj_t, 2 * n);
+            for (size_t i = 0; i < n; i++) {
+                pairs[2 * i + 1] = self->items[i];
+            }
+            for (size_t i = 0; i < n; i++) {
+                pairs[2 * i] = mp_call_function_1(args.key.u_obj, pairs[2 * i + 1]);
+            }
+            mp_sort(pairs, n, 2, args.reverse.u_bool);
+            // The key function may have changed the list.
+            size_t count = MIN(n, self->len);
+            for (size_t i = 0; i < count; i++) {
+                self->items[i] = pairs[2 * i + 1];
+            }
+            m_del(mp_obj_t, pairs, 2 * n);
+        }
     }
 
     return mp_const_none;
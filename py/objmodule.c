@@ -120,6 +120,11 @@ STATIC void module_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
             if (dict == &mp_module_builtins_globals) {
                 if (MP_STATE_VM(mp_module_builtins_override_dict) == NULL) {
                     MP_STATE_VM(mp_module_builtins_override_dict) = MP_OBJ_TO_PTR(mp_obj_new_dict(1));
+                    // CIRCUITPY-CHANGE
+                    #if MICROPY_OPT_LOAD_GLOBAL_CACHE
+                    // Builtins cached until now may become overridden.
+                    mp_load_global_cache_invalidate();
+                    #endif
                 }
                 dict = MP_STATE_VM(mp_module_builtins_override_dict);
             } else
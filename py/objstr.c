@@ -1012,9 +1012,22 @@ STATIC NORETURN void terse_str_format_value_error(void) {
 STATIC vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *arg_i, size_t n_args, const mp_obj_t *args, mp_map_t *kwargs) {
     vstr_t vstr;
     mp_print_t print;
-    vstr_init_print(&vstr, 16, &print);
+    // CIRCUITPY-CHANGE: the output is usually at least as long as the template,
+    // so start with that much space to avoid growing the buffer a few bytes at a time.
+    vstr_init_print(&vstr, MAX(16, (size_t)(top - str)), &print);
 
     for (; str < top; str++) {
+        // CIRCUITPY-CHANGE: copy runs of literal characters in one go
+        const char *lit = str;
+        while (str < top && *str != '{' && *str != '}') {
+            str++;
+        }
+        if (str > lit) {
+            vstr_add_strn(&vstr, lit, str - lit);
+            if (str >= top) {
+                break;
+            }
+        }
         if (*str == '}') {
             str++;
             if (str < top && *str == '}') {
@@ -1028,10 +1041,6 @@ STATIC vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
             mp_raise_ValueError_varg(MP_ERROR_TEXT("unmatched '%c' in format"), '}');
             #endif
         }
-        if (*str != '{') {
-            vstr_add_byte(&vstr, *str);
-            continue;
-        }
 
         str++;
         if (str < top && *str == '{') {
@@ -1173,6 +1182,12 @@ STATIC vstr_t mp_obj_str_format_helper(const char *str, const char *top, int *ar
                 assert(conversion == 'r');
                 print_kind = PRINT_REPR;
             }
+            // CIRCUITPY-CHANGE: with no format spec the converted value is
+            // emitted as-is, so print it straight into the output.
+            if (!format_spec) {
+                mp_obj_print_helper(&print, arg, print_kind);
+                continue;
+            }
             vstr_t arg_vstr;
             mp_print_t arg_print;
             vstr_init_print(&arg_vstr, 16, &arg_print);
@@ -1478,12 +1493,18 @@ STATIC mp_obj_t str_modulo_format(mp_obj_t pattern, size_t n_args, const mp_obj_
     size_t arg_i = 0;
     vstr_t vstr;
     mp_print_t print;
-    vstr_init_print(&vstr, 16, &print);
+    // CIRCUITPY-CHANGE: size the output from the template up front
+    vstr_init_print(&vstr, MAX(16, len), &print);
 
     for (const byte *top = str + len; str < top; str++) {
         mp_obj_t arg = MP_OBJ_NULL;
         if (*str != '%') {
-            vstr_add_byte(&vstr, *str);
+            // CIRCUITPY-CHANGE: copy runs of literal characters in one go
+            const byte *lit = str;
+            while (str + 1 < top && str[1] != '%') {
+                str++;
+            }
+            vstr_add_strn(&vstr, (const char *)lit, str + 1 - lit);
             continue;
         }
         if (++str >= top) {
@@ -1625,15 +1646,21 @@ STATIC mp_obj_t str_modulo_format(mp_obj_t pattern, size_t n_args, const mp_obj_
 
             case 'r':
             case 's': {
-                vstr_t arg_vstr;
-                mp_print_t arg_print;
-                vstr_init_print(&arg_vstr, 16, &arg_print);
                 mp_print_kind_t print_kind = (*str == 'r' ? PRINT_REPR : PRINT_STR);
                 if (print_kind == PRINT_STR && is_bytes && mp_obj_is_type(arg, &mp_type_bytes)) {
                     // If we have something like b"%s" % b"1", bytes arg should be
                     // printed undecorated.
                     print_kind = PRINT_RAW;
                 }
+                // CIRCUITPY-CHANGE: without width or precision there is nothing
+                // to pad or truncate, so print straight into the output.
+                if (width == 0 && prec < 0) {
+                    mp_obj_print_helper(&print, arg, print_kind);
+                    break;
+                }
+                vstr_t arg_vstr;
+                mp_print_t arg_print;
+                vstr_init_print(&arg_vstr, 16, &arg_print);
                 mp_obj_print_helper(&arg_print, arg, print_kind);
                 uint vlen = arg_vstr.len;
                 if (prec < 0) {
@@ -114,6 +114,59 @@ STATIC mp_obj_t uni_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
     }
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PY_BUILTINS_STR_UNICODE_INDEX
+
+// Shorter strings are quick enough to walk.
+#define STR_INDEX_MIN_LEN (64)
+// The index holds the byte offset of every this many characters.
+#define STR_INDEX_STRIDE (32)
+
+typedef struct _mp_str_unicode_index_t {
+    // Pointing at the data also keeps it from being freed and reused by
+    // another str while it is indexed.
+    const byte *data;
+    size_t len;
+    size_t charlen;
+    // Byte offsets of characters 0, STR_INDEX_STRIDE, ... Empty for ASCII.
+    size_t offsets[];
+} mp_str_unicode_index_t;
+
+// Returns the index of the given str data, building it if it isn't the str
+// last indexed. Returns NULL if there's no memory for it.
+STATIC const mp_str_unicode_index_t *str_unicode_index(const byte *data, size_t len) {
+    mp_str_unicode_index_t *index = MP_STATE_VM(str_unicode_index);
+    if (index != NULL && index->data == data && index->len == len) {
+        return index;
+    }
+    size_t charlen = utf8_charlen(data, len);
+    size_t count = charlen == len ? 0 : (charlen + STR_INDEX_STRIDE - 1) / STR_INDEX_STRIDE;
+    index = m_new_obj_var_maybe(mp_str_unicode_index_t, size_t, count);
+    if (index == NULL) {
+        return NULL;
+    }
+    index->data = data;
+    index->len = len;
+    index->charlen = charlen;
+    if (count > 0) {
+        size_t n = 0;
+        for (size_t i = 0; i < len; i++) {
+            if (!UTF8_IS_CONT(data[i])) {
+                if (n % STR_INDEX_STRIDE == 0) {
+                    index->offsets[n / STR_INDEX_STRIDE] = i;
+                }
+                n++;
+            }
+        }
+    }
+    MP_STATE_VM(str_unicode_index) = index;
+    return index;
+}
+
+MP_REGISTER_ROOT_POINTER(struct _mp_str_unicode_index_t *str_unicode_index);
+
+#endif
+
 // Convert an index into a pointer to its lead byte. Out of bounds indexing will raise IndexError or
 // be capped to the first/last character of the string, depending on is_slice.
 const byte *str_index_to_ptr(const mp_obj_type_t *type, const byte *self_data, size_t self_len,
@@ -140,6 +193,41 @@ const byte *str_index_to_ptr(const mp_obj_type_t *type, const byte *self_data, s
         mp_raise_msg_varg(&mp_type_TypeError, MP_ERROR_TEXT("string indices must be integers, not %s"), mp_obj_get_type_str(index));
     }
     const byte *s, *top = self_data + self_len;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_BUILTINS_STR_UNICODE_INDEX
+    const mp_str_unicode_index_t *str_index = NULL;
+    if (self_len >= STR_INDEX_MIN_LEN) {
+        str_index = str_unicode_index(self_data, self_len);
+    }
+    if (str_index != NULL) {
+        if (i < 0) {
+            i += str_index->charlen;
+            if (i < 0) {
+                if (is_slice) {
+                    return self_data;
+                }
+                mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("string index out of range"));
+            }
+        }
+        if ((size_t)i >= str_index->charlen) {
+            if (is_slice) {
+                return top;
+            }
+            mp_raise_msg(&mp_type_IndexError, MP_ERROR_TEXT("string index out of range"));
+        }
+        if (str_index->charlen == self_len) {
+            return self_data + i;
+        }
+        s = self_data + str_index->offsets[i / STR_INDEX_STRIDE];
+        for (i %= STR_INDEX_STRIDE; i > 0; i--) {
+            ++s;
+            while (UTF8_IS_CONT(*s)) {
+                ++s;
+            }
+        }
+        return s;
+    }
+    #endif
     if (i < 0) {
         // Negative indexing is performed by counting from the end of the string.
         for (s = top - 1; i; --s) {
@@ -159,6 +159,14 @@ struct class_lookup_data {
     size_t slot_offset;
     mp_obj_t *dest;
     bool is_type;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_CLASS_LOOKUP_CACHE
+    // Set when the result depends on the object, not just its type.
+    bool uncacheable;
+    // The class whose locals held the attribute, and the raw member.
+    const mp_obj_type_t *found_type;
+    mp_obj_t found_member;
+    #endif
 };
 
 STATIC void mp_obj_class_lookup(struct class_lookup_data *lookup, const mp_obj_type_t *type) {
@@ -196,12 +204,20 @@ STATIC void mp_obj_class_lookup(struct class_lookup_data *lookup, const mp_obj_t
                 } else if (mp_obj_is_type(elem->value, &mp_type_property)) {
                     // CIRCUITPY-CHANGE: CircuitPython uses properties on native classes, so we always return them.
                     lookup->dest[0] = elem->value;
+                    #if MICROPY_OPT_CLASS_LOOKUP_CACHE
+                    lookup->found_type = type;
+                    lookup->found_member = elem->value;
+                    #endif
                     return;
                 } else {
                     mp_obj_instance_t *obj = lookup->obj;
                     // CIRCUITPY-CHANGE: Pass object directly. MP passes the native object.
                     // This allows native code to lookup and call functions on Python subclasses.
                     mp_convert_member_lookup(obj, type, elem->value, lookup->dest);
+                    #if MICROPY_OPT_CLASS_LOOKUP_CACHE
+                    lookup->found_type = type;
+                    lookup->found_member = elem->value;
+                    #endif
                 }
                 #if DEBUG_PRINT
                 DEBUG_printf("mp_obj_class_lookup: Returning: ");
@@ -220,6 +236,9 @@ STATIC void mp_obj_class_lookup(struct class_lookup_data *lookup, const mp_obj_t
         // but some attributes of native types may be handled using .load_attr method,
         // so make sure we try to lookup those too.
         if (lookup->obj != NULL && !lookup->is_type && mp_obj_is_native_type(type) && type != &mp_type_object /* object is not a real type */) {
+            #if MICROPY_OPT_CLASS_LOOKUP_CACHE
+            lookup->uncacheable = true;
+            #endif
             mp_load_method_maybe(lookup->obj->subobj[0], lookup->attr, lookup->dest);
             if (lookup->dest[0] != MP_OBJ_NULL) {
                 return;
@@ -431,7 +450,8 @@ STATIC mp_obj_t instance_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
         size_t num_native_bases = instance_count_native_bases(mp_obj_get_type(self_in), &native_base);
 
         size_t sz = sizeof(*self) + sizeof(*self->subobj) * num_native_bases
-            + sizeof(*self->members.table) * self->members.alloc;
+            // CIRCUITPY-CHANGE
+            + mp_map_table_nbytes(&self->members);
         return MP_OBJ_NEW_SMALL_INT(sz);
     }
     #endif
@@ -601,6 +621,47 @@ STATIC mp_obj_t instance_binary_op(mp_binary_op_t op, mp_obj_t lhs_in, mp_obj_t
     return res;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_CLASS_LOOKUP_CACHE
+STATIC mp_class_lookup_cache_entry_t *class_lookup_cache_set(const mp_obj_type_t *type, qstr attr) {
+    size_t index = (((uintptr_t)type >> 3) ^ attr) & (MICROPY_OPT_CLASS_LOOKUP_CACHE_SIZE - 1);
+    return MP_STATE_VM(class_lookup_cache)[index];
+}
+
+void mp_obj_class_lookup_cache_clear(void) {
+    memset(MP_STATE_VM(class_lookup_cache), 0, sizeof(MP_STATE_VM(class_lookup_cache)));
+}
+
+// Returns true and fills dest like mp_obj_class_lookup when attr of instances
+// of self's type is known to come from a class's locals.
+STATIC bool class_lookup_cached(mp_obj_instance_t *self, qstr attr, mp_obj_t *dest) {
+    const mp_obj_type_t *type = self->base.type;
+    mp_class_lookup_cache_entry_t *set = class_lookup_cache_set(type, attr);
+    for (size_t i = 0; i < 2; i++) {
+        mp_class_lookup_cache_entry_t *entry = &set[i];
+        if (entry->type == type && entry->attr == attr) {
+            if (mp_obj_is_type(entry->member, &mp_type_property)) {
+                dest[0] = entry->member;
+            } else {
+                mp_convert_member_lookup(self, entry->found_type, entry->member, dest);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+STATIC void class_lookup_cache_store(const mp_obj_type_t *type, qstr attr, const struct class_lookup_data *lookup) {
+    // Keep the most recent entry first and push the older one out.
+    mp_class_lookup_cache_entry_t *set = class_lookup_cache_set(type, attr);
+    set[1] = set[0];
+    set[0].type = type;
+    set[0].attr = attr;
+    set[0].found_type = lookup->found_type;
+    set[0].member = lookup->found_member;
+}
+#endif
+
 STATIC void mp_obj_instance_load_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
     // logic: look in instance members then class locals
     assert(mp_obj_is_instance_type(mp_obj_get_type(self_in)));
@@ -626,14 +687,25 @@ STATIC void mp_obj_instance_load_attr(mp_obj_t self_in, qstr attr, mp_obj_t *des
         return;
     }
     #endif
-    struct class_lookup_data lookup = {
-        .obj = self,
-        .attr = attr,
-        .slot_offset = 0,
-        .dest = dest,
-        .is_type = false,
-    };
-    mp_obj_class_lookup(&lookup, self->base.type);
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_CLASS_LOOKUP_CACHE
+    if (!class_lookup_cached(self, attr, dest))
+    #endif
+    {
+        struct class_lookup_data lookup = {
+            .obj = self,
+            .attr = attr,
+            .slot_offset = 0,
+            .dest = dest,
+            .is_type = false,
+        };
+        mp_obj_class_lookup(&lookup, self->base.type);
+        #if MICROPY_OPT_CLASS_LOOKUP_CACHE
+        if (dest[0] != MP_OBJ_NULL && lookup.found_type != NULL && !lookup.uncacheable) {
+            class_lookup_cache_store(self->base.type, attr, &lookup);
+        }
+        #endif
+    }
     mp_obj_t member = dest[0];
     if (member != MP_OBJ_NULL) {
         if (!(self->base.type->flags & MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS)) {
@@ -1101,6 +1173,11 @@ STATIC void type_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
                 // can't apply delete/store to a fixed map
                 return;
             }
+            // CIRCUITPY-CHANGE
+            #if MICROPY_OPT_CLASS_LOOKUP_CACHE
+            // This class and its subclasses may now find attr elsewhere.
+            mp_obj_class_lookup_cache_clear();
+            #endif
             if (dest[1] == MP_OBJ_NULL) {
                 // delete attribute
                 mp_map_elem_t *elem = mp_map_lookup(locals_map, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP_REMOVE_IF_FOUND);
@@ -1193,6 +1270,11 @@ mp_obj_t mp_obj_new_type(qstr name, mp_obj_t bases_tuple, mp_obj_t locals_dict)
     // Note: mp_obj_type_t is (2 + 3 + #slots) words, so going from 11 to 12 slots
     // moves from 4 to 5 gc blocks.
     mp_obj_type_t *o = m_new_obj_var0(mp_obj_type_t, void *, 10 + (bases_len ? 1 : 0) + (base_protocol ? 1 : 0));
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_CLASS_LOOKUP_CACHE
+    // The new type may reuse the memory of a collected one that has entries.
+    mp_obj_class_lookup_cache_clear();
+    #endif
     o->base.type = &mp_type_type;
     o->flags = base_flags;
     o->name = name;
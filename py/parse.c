@@ -240,6 +240,12 @@ typedef struct _parser_t {
     #if MICROPY_COMP_CONST
     mp_map_t consts;
     #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_COMP_STREAMING
+    mp_parse_stream_fun_t stream_fun;
+    void *stream_ctx;
+    #endif
 } parser_t;
 
 STATIC void push_result_rule(parser_t *parser, size_t src_line, uint8_t rule_id, size_t num_args);
@@ -545,6 +551,38 @@ STATIC void push_result_node(parser_t *parser, mp_parse_node_t pn) {
     parser->result_stack[parser->result_stack_top++] = pn;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_STREAMING
+// Called between top-level statements. Once enough parse nodes have built up,
+// pass the completed statements to the stream function and then free all the
+// parse nodes, keeping the current chunk to allocate the next statements from.
+// Returns true if the statements were passed on, in which case a single null
+// node is left in their place on the result stack.
+STATIC bool parser_stream_statements(parser_t *parser, size_t src_line, size_t num_stmts) {
+    size_t used = parser->cur_chunk == NULL ? 0 : parser->cur_chunk->union_.used;
+    for (mp_parse_chunk_t *chunk = parser->tree.chunk; chunk != NULL; chunk = chunk->union_.next) {
+        used += chunk->alloc;
+    }
+    if (used < MICROPY_COMP_STREAMING_THRESHOLD) {
+        return false;
+    }
+
+    assert(parser->result_stack_top == num_stmts);
+    if (num_stmts > 1) {
+        push_result_rule(parser, src_line, RULE_file_input_2, num_stmts);
+    }
+    parser->stream_fun(parser->stream_ctx, pop_result(parser));
+
+    mp_parse_tree_clear(&parser->tree);
+    parser->tree.chunk = NULL;
+    if (parser->cur_chunk != NULL) {
+        parser->cur_chunk->union_.used = 0;
+    }
+    push_result_node(parser, MP_PARSE_NODE_NULL);
+    return true;
+}
+#endif
+
 STATIC mp_parse_node_t make_node_const_object(parser_t *parser, size_t src_line, mp_obj_t obj) {
     mp_parse_node_struct_t *pn = parser_alloc(parser, sizeof(mp_parse_node_struct_t) + sizeof(mp_obj_t));
     pn->source_line = src_line;
@@ -1027,7 +1065,12 @@ STATIC void push_result_rule(parser_t *parser, size_t src_line, uint8_t rule_id,
     push_result_node(parser, (mp_parse_node_t)pn);
 }
 
+// CIRCUITPY-CHANGE: shared by mp_parse and mp_parse_stream
+#if MICROPY_COMP_STREAMING
+STATIC mp_parse_tree_t parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind, mp_parse_stream_fun_t stream_fun, void *stream_ctx) {
+#else
 mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
+#endif
     // Set exception handler to free the lexer if an exception is raised.
     MP_DEFINE_NLR_JUMP_CALLBACK_FUNCTION_1(ctx, mp_lexer_free, lex);
     nlr_push_jump_callback(&ctx.callback, mp_call_function_1_from_nlr_jump_callback);
@@ -1074,6 +1117,12 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     mp_map_init(&parser.consts, 0);
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_COMP_STREAMING
+    parser.stream_fun = stream_fun;
+    parser.stream_ctx = stream_ctx;
+    #endif
+
     // work out the top-level rule to use, and push it on the stack
     size_t top_level_rule;
     switch (input_kind) {
@@ -1295,6 +1344,13 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
                         }
                     }
                 } else {
+                    // CIRCUITPY-CHANGE: pass on completed top-level statements
+                    #if MICROPY_COMP_STREAMING
+                    if (rule_id == RULE_file_input_2 && parser.stream_fun != NULL && i > 0
+                        && parser_stream_statements(&parser, rule_src_line, i)) {
+                        i = 1;
+                    }
+                    #endif
                     for (;;) {
                         size_t arg = rule_arg[i & 1 & n];
                         if ((arg & RULE_ARG_KIND_MASK) == RULE_ARG_TOK) {
@@ -1405,6 +1461,17 @@ mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
     return parser.tree;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_STREAMING
+mp_parse_tree_t mp_parse(mp_lexer_t *lex, mp_parse_input_kind_t input_kind) {
+    return parse(lex, input_kind, NULL, NULL);
+}
+
+mp_parse_tree_t mp_parse_stream(mp_lexer_t *lex, mp_parse_stream_fun_t fun, void *ctx) {
+    return parse(lex, MP_PARSE_FILE_INPUT, fun, ctx);
+}
+#endif
+
 void mp_parse_tree_clear(mp_parse_tree_t *tree) {
     mp_parse_chunk_t *chunk = tree->chunk;
     while (chunk != NULL) {
@@ -111,6 +111,16 @@ typedef struct _mp_parse_t {
 // the parser will raise an exception if an error occurred
 // the parser will free the lexer before it returns
 mp_parse_tree_t mp_parse(struct _mp_lexer_t *lex, mp_parse_input_kind_t input_kind);
+
+// CIRCUITPY-CHANGE
+#if MICROPY_COMP_STREAMING
+typedef void (*mp_parse_stream_fun_t)(void *ctx, mp_parse_node_t pn);
+
+// Parse file input, passing groups of completed top-level statements to fun
+// as it goes and then reusing the memory of their parse nodes. The returned
+// tree holds whatever follows the last group passed to fun.
+mp_parse_tree_t mp_parse_stream(struct _mp_lexer_t *lex, mp_parse_stream_fun_t fun, void *ctx);
+#endif
 void mp_parse_tree_clear(mp_parse_tree_t *tree);
 
 #endif // MICROPY_INCLUDED_PY_PARSE_H
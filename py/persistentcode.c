@@ -169,6 +169,14 @@ STATIC qstr load_qstr(mp_reader_t *reader) {
         return len >> 1;
     }
     len >>= 1;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+    const byte *rom_str = mp_reader_try_read_rom(reader, len + 1);
+    if (rom_str != NULL) {
+        // Reference the null-terminated string in place.
+        return qstr_from_strn_static((const char *)rom_str, len);
+    }
+    #endif
     char *str = m_new(char, len);
     read_bytes(reader, (byte *)str, len);
     read_byte(reader); // read and discard null terminator
@@ -204,6 +212,21 @@ STATIC mp_obj_t load_obj(mp_reader_t *reader) {
             }
             return MP_OBJ_FROM_PTR(tuple);
         }
+        // CIRCUITPY-CHANGE
+        #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+        if (obj_type == MP_PERSISTENT_OBJ_STR || obj_type == MP_PERSISTENT_OBJ_BYTES) {
+            const byte *data = mp_reader_try_read_rom(reader, len + 1);
+            if (data != NULL) {
+                // Make a str/bytes object whose data stays in ROM.
+                mp_obj_str_t *o = m_new_obj(mp_obj_str_t);
+                o->base.type = obj_type == MP_PERSISTENT_OBJ_STR ? &mp_type_str : &mp_type_bytes;
+                o->len = len;
+                o->hash = qstr_compute_hash(data, len);
+                o->data = data;
+                return MP_OBJ_FROM_PTR(o);
+            }
+        }
+        #endif
         vstr_t vstr;
         vstr_init_len(&vstr, len);
         read_bytes(reader, (byte *)vstr.buf, len);
@@ -245,10 +268,18 @@ STATIC mp_raw_code_t *load_raw_code(mp_reader_t *reader, mp_module_context_t *co
     #endif
 
     if (kind == MP_CODE_BYTECODE) {
-        // Allocate memory for the bytecode
-        fun_data = m_new(uint8_t, fun_data_len);
-        // Load bytecode
-        read_bytes(reader, fun_data, fun_data_len);
+        // CIRCUITPY-CHANGE
+        #if MICROPY_PERSISTENT_CODE_LOAD_XIP
+        // Bytecode is never modified, so it can be executed in place from ROM.
+        fun_data = (uint8_t *)mp_reader_try_read_rom(reader, fun_data_len);
+        if (fun_data == NULL)
+        #endif
+        {
+            // Allocate memory for the bytecode
+            fun_data = m_new(uint8_t, fun_data_len);
+            // Load bytecode
+            read_bytes(reader, fun_data, fun_data_len);
+        }
 
     #if MICROPY_EMIT_MACHINE_CODE
     } else {
@@ -125,6 +125,10 @@ extern const qstr_pool_t MICROPY_QSTR_EXTRA_POOL;
 void qstr_reset(void) {
     MP_STATE_VM(last_pool) = (qstr_pool_t *)&CONST_POOL; // we won't modify the const_pool since it has no allocated room left
     MP_STATE_VM(qstr_last_chunk) = NULL;
+    #if MICROPY_QSTR_INDEX
+    MP_STATE_VM(qstr_index) = NULL;
+    MP_STATE_VM(qstr_index_alloc) = 0;
+    #endif
 }
 
 void qstr_init(void) {
@@ -147,12 +151,82 @@ STATIC const qstr_pool_t *PLACE_IN_ITCM(find_qstr)(qstr *q) {
     return pool;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_QSTR_INDEX
+// The index covers the qstrs in the pools after CONST_POOL. An entry is the
+// offset of the qstr from the first of them plus one, so zero is an empty
+// slot. The index is either complete or absent, in which case every pool is
+// searched.
+#define QSTR_INDEX_BASE (CONST_POOL.total_prev_len + CONST_POOL.len)
+#define QSTR_INDEX_MIN_ALLOC (64)
+
+STATIC size_t qstr_index_slot(mp_uint_t hash, mp_uint_t len) {
+    return hash * 33 + len;
+}
+
+STATIC void qstr_index_insert(qstr_short_t *index, size_t alloc, mp_uint_t hash, mp_uint_t len, qstr q) {
+    size_t slot = qstr_index_slot(hash, len) & (alloc - 1);
+    while (index[slot] != 0) {
+        slot = (slot + 1) & (alloc - 1);
+    }
+    index[slot] = q - QSTR_INDEX_BASE + 1;
+}
+
+// Replace the index with one of alloc entries, or drop it if there isn't the
+// memory for one.
+STATIC void qstr_index_rebuild(size_t alloc) {
+    if (MP_STATE_VM(qstr_index) != NULL) {
+        m_del(qstr_short_t, MP_STATE_VM(qstr_index), MP_STATE_VM(qstr_index_alloc));
+        MP_STATE_VM(qstr_index) = NULL;
+        MP_STATE_VM(qstr_index_alloc) = 0;
+    }
+    qstr_short_t *index = alloc > 0 ? m_new_maybe(qstr_short_t, alloc) : NULL;
+    if (index == NULL) {
+        return;
+    }
+    memset(index, 0, alloc * sizeof(qstr_short_t));
+    for (const qstr_pool_t *pool = MP_STATE_VM(last_pool); pool != &CONST_POOL; pool = pool->prev) {
+        for (size_t at = 0; at < pool->len; at++) {
+            qstr_index_insert(index, alloc, pool->hashes[at], pool->lengths[at], pool->total_prev_len + at);
+        }
+    }
+    MP_STATE_VM(qstr_index) = index;
+    MP_STATE_VM(qstr_index_alloc) = alloc;
+}
+
+// Add a qstr that has just been put in the last pool. An index that couldn't
+// be allocated is only tried again along with a new pool, so that running low
+// on memory doesn't make every new qstr collect garbage.
+STATIC void qstr_index_add(mp_uint_t hash, mp_uint_t len, qstr q, bool new_pool) {
+    size_t n = q - QSTR_INDEX_BASE + 1;
+    if (n > (qstr_short_t)-1) {
+        if (MP_STATE_VM(qstr_index) != NULL) {
+            qstr_index_rebuild(0);
+        }
+        return;
+    }
+    if (MP_STATE_VM(qstr_index) != NULL && n * 2 <= MP_STATE_VM(qstr_index_alloc)) {
+        qstr_index_insert(MP_STATE_VM(qstr_index), MP_STATE_VM(qstr_index_alloc), hash, len, q);
+        return;
+    }
+    if (MP_STATE_VM(qstr_index) != NULL || new_pool) {
+        size_t alloc = QSTR_INDEX_MIN_ALLOC;
+        while (alloc < n * 4) {
+            alloc *= 2;
+        }
+        qstr_index_rebuild(alloc);
+    }
+}
+#endif
+
 // qstr_mutex must be taken while in this function
 STATIC qstr qstr_add(mp_uint_t hash, mp_uint_t len, const char *q_ptr) {
     DEBUG_printf("QSTR: add hash=%d len=%d data=%.*s\n", hash, len, len, q_ptr);
 
     // make sure we have room in the pool for a new qstr
-    if (MP_STATE_VM(last_pool)->len >= MP_STATE_VM(last_pool)->alloc) {
+    // CIRCUITPY-CHANGE
+    bool new_pool = MP_STATE_VM(last_pool)->len >= MP_STATE_VM(last_pool)->alloc;
+    if (new_pool) {
         size_t new_alloc = MP_STATE_VM(last_pool)->alloc * 2;
         #ifdef MICROPY_QSTR_EXTRA_POOL
         // Put a lower bound on the allocation size in case the extra qstr pool has few entries
@@ -188,6 +262,13 @@ STATIC qstr qstr_add(mp_uint_t hash, mp_uint_t len, const char *q_ptr) {
     MP_STATE_VM(last_pool)->qstrs[at] = q_ptr;
     MP_STATE_VM(last_pool)->len++;
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_QSTR_INDEX
+    qstr_index_add(hash, len, MP_STATE_VM(last_pool)->total_prev_len + at, new_pool);
+    #else
+    (void)new_pool;
+    #endif
+
     // return id for the newly-added qstr
     return MP_STATE_VM(last_pool)->total_prev_len + at;
 }
@@ -196,8 +277,29 @@ qstr qstr_find_strn(const char *str, size_t str_len) {
     // work out hash of str
     size_t str_hash = qstr_compute_hash((const byte *)str, str_len);
 
+    const qstr_pool_t *first_pool = MP_STATE_VM(last_pool);
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_QSTR_INDEX
+    // look the data up in the index, leaving only the const pools to search
+    if (MP_STATE_VM(qstr_index) != NULL) {
+        const qstr_short_t *index = MP_STATE_VM(qstr_index);
+        size_t mask = MP_STATE_VM(qstr_index_alloc) - 1;
+        for (size_t slot = qstr_index_slot(str_hash, str_len) & mask; index[slot] != 0; slot = (slot + 1) & mask) {
+            qstr q = QSTR_INDEX_BASE + index[slot] - 1;
+            size_t at = q;
+            const qstr_pool_t *pool = find_qstr(&at);
+            if (pool->hashes[at] == str_hash && pool->lengths[at] == str_len
+                && memcmp(pool->qstrs[at], str, str_len) == 0) {
+                return q;
+            }
+        }
+        first_pool = &CONST_POOL;
+    }
+    #endif
+
     // search pools for the data
-    for (const qstr_pool_t *pool = MP_STATE_VM(last_pool); pool != NULL; pool = pool->prev) {
+    for (const qstr_pool_t *pool = first_pool; pool != NULL; pool = pool->prev) {
         for (mp_uint_t at = 0, top = pool->len; at < top; at++) {
             if (pool->hashes[at] == str_hash && pool->lengths[at] == str_len
                 && memcmp(pool->qstrs[at], str, str_len) == 0) {
@@ -214,7 +316,8 @@ qstr qstr_from_str(const char *str) {
     return qstr_from_strn(str, strlen(str));
 }
 
-qstr qstr_from_strn(const char *str, size_t len) {
+// CIRCUITPY-CHANGE: data_is_static
+STATIC qstr qstr_from_strn_helper(const char *str, size_t len, bool data_is_static) {
     QSTR_ENTER();
     qstr q = qstr_find_strn(str, len);
     if (q == 0) {
@@ -226,6 +329,15 @@ qstr qstr_from_strn(const char *str, size_t len) {
             mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("Name too long"));
         }
 
+        // CIRCUITPY-CHANGE
+        if (data_is_static) {
+            // the string data is persistent so reference it directly
+            assert(str[len] == '\0');
+            q = qstr_add(qstr_compute_hash((const byte *)str, len), len, str);
+            QSTR_EXIT();
+            return q;
+        }
+
         // compute number of bytes needed to intern this string
         size_t n_bytes = len + 1;
 
@@ -276,6 +388,17 @@ qstr qstr_from_strn(const char *str, size_t len) {
     return q;
 }
 
+qstr qstr_from_strn(const char *str, size_t len) {
+    return qstr_from_strn_helper(str, len, false);
+}
+
+// CIRCUITPY-CHANGE
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP
+qstr qstr_from_strn_static(const char *str, size_t len) {
+    return qstr_from_strn_helper(str, len, true);
+}
+#endif
+
 mp_uint_t qstr_hash(qstr q) {
     const qstr_pool_t *pool = find_qstr(&q);
     return pool->hashes[q];
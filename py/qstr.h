@@ -87,6 +87,11 @@ qstr qstr_find_strn(const char *str, size_t str_len); // returns MP_QSTRnull if
 
 qstr qstr_from_str(const char *str);
 qstr qstr_from_strn(const char *str, size_t len);
+// CIRCUITPY-CHANGE
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP
+// str must be null terminated and stay valid for the life of the VM, e.g. be in flash.
+qstr qstr_from_strn_static(const char *str, size_t len);
+#endif
 
 mp_uint_t qstr_hash(qstr q);
 const char *qstr_str(qstr q);
@@ -33,6 +33,11 @@
 // it can be called again after returning MP_READER_EOF, and in that case must return MP_READER_EOF
 #define MP_READER_EOF ((mp_uint_t)(-1))
 
+// CIRCUITPY-CHANGE
+// Pass as free_len to mp_reader_new_mem when buf is persistent, memory-mapped
+// storage such as flash, so that data can be used in place instead of copied.
+#define MP_READER_IS_ROM ((size_t)(-1))
+
 typedef struct _mp_reader_t {
     void *data;
     mp_uint_t (*readbyte)(void *data);
@@ -43,4 +48,11 @@ void mp_reader_new_mem(mp_reader_t *reader, const byte *buf, size_t len, size_t
 void mp_reader_new_file(mp_reader_t *reader, const char *filename);
 void mp_reader_new_file_from_fd(mp_reader_t *reader, int fd, bool close_fd);
 
+// CIRCUITPY-CHANGE
+#if MICROPY_PERSISTENT_CODE_LOAD_XIP
+// If the reader is reading from ROM, return a pointer to the next len bytes
+// and skip over them. Otherwise return NULL and leave the reader unchanged.
+const byte *mp_reader_try_read_rom(mp_reader_t *reader, size_t len);
+#endif
+
 #endif // MICROPY_INCLUDED_PY_READER_H
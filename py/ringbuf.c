@@ -28,6 +28,8 @@
 
 // CIRCUITPY-CHANGE: thoroughly reworked
 
+#include <string.h>
+
 #include "ringbuf.h"
 
 bool ringbuf_init(ringbuf_t *r, uint8_t *buf, size_t size) {
@@ -122,24 +124,29 @@ size_t ringbuf_num_filled(ringbuf_t *r) {
 // If the ring buffer fills up, not all bytes will be written.
 // Returns how many bytes were successfully written.
 size_t ringbuf_put_n(ringbuf_t *r, const uint8_t *buf, size_t bufsize) {
-    for (size_t i = 0; i < bufsize; i++) {
-        if (ringbuf_put(r, buf[i]) < 0) {
-            // If ringbuf is full, give up and return how many bytes
-            // we wrote so far.
-            return i;
-        }
+    size_t n = MIN(bufsize, r->size - r->used);
+    // Copy in at most two pieces: up to the end of the storage, then from the start.
+    size_t first = MIN(n, r->size - r->next_write);
+    memcpy(r->buf + r->next_write, buf, first);
+    memcpy(r->buf, buf + first, n - first);
+    r->next_write += n;
+    if (r->next_write >= r->size) {
+        r->next_write -= r->size;
     }
-    return bufsize;
+    r->used += n;
+    return n;
 }
 
 // Returns how many bytes were fetched.
 size_t ringbuf_get_n(ringbuf_t *r, uint8_t *buf, size_t bufsize) {
-    for (size_t i = 0; i < bufsize; i++) {
-        int b = ringbuf_get(r);
-        if (b < 0) {
-            return i;
-        }
-        buf[i] = b;
+    size_t n = MIN(bufsize, r->used);
+    size_t first = MIN(n, r->size - r->next_read);
+    memcpy(buf, r->buf + r->next_read, first);
+    memcpy(buf + first, r->buf, n - first);
+    r->next_read += n;
+    if (r->next_read >= r->size) {
+        r->next_read -= r->size;
     }
-    return bufsize;
+    r->used -= n;
+    return n;
 }
@@ -112,6 +112,22 @@ void mp_init(void) {
     #endif
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_CLASS_LOOKUP_CACHE
+    // Types from a previous VM may have left entries behind.
+    mp_obj_class_lookup_cache_clear();
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_LOAD_GLOBAL_CACHE
+    memset(MP_STATE_VM(load_global_cache), 0, sizeof(MP_STATE_VM(load_global_cache)));
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_CACHE_EXCEPTION_ARGS
+    mp_obj_exception_args_cache_clear();
+    #endif
+
     // init global module dict
     mp_obj_dict_init(&MP_STATE_VM(mp_loaded_modules_dict), MICROPY_LOADED_MODULES_DICT_SIZE);
 
@@ -128,6 +144,16 @@ void mp_init(void) {
     MP_STATE_VM(mp_module_builtins_override_dict) = NULL;
     #endif
 
+    // CIRCUITPY-CHANGE
+    #if MICROPY_ENABLE_EXTERNAL_IMPORT && MICROPY_MODULE_IMPORT_DIR_CACHE
+    mp_import_dir_cache_invalidate();
+    #endif
+
+    // CIRCUITPY-CHANGE
+    #if MICROPY_PY_BUILTINS_STR_UNICODE && MICROPY_PY_BUILTINS_STR_UNICODE_INDEX
+    MP_STATE_VM(str_unicode_index) = NULL;
+    #endif
+
     #if MICROPY_PERSISTENT_CODE_TRACK_RELOC_CODE
     MP_STATE_VM(track_reloc_code_list) = MP_OBJ_NULL;
     #endif
@@ -170,6 +196,9 @@ void mp_init(void) {
     #if MICROPY_PY_SYS_SETTRACE
     MP_STATE_THREAD(prof_trace_callback) = MP_OBJ_NULL;
     MP_STATE_THREAD(prof_callback_is_executing) = false;
+    #endif
+    // CIRCUITPY-CHANGE
+    #if MICROPY_VM_TRACK_CURRENT_CODE_STATE
     MP_STATE_THREAD(current_code_state) = NULL;
     #endif
 
@@ -226,21 +255,60 @@ mp_obj_t MICROPY_WRAP_MP_LOAD_NAME(mp_load_name)(qstr qst) {
     return mp_load_global(qst);
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_LOAD_GLOBAL_CACHE
+void mp_load_global_cache_invalidate(void) {
+    if (++MP_STATE_VM(load_global_cache_version) == 0) {
+        // Wrapped around, so old entries could look current again.
+        memset(MP_STATE_VM(load_global_cache), 0, sizeof(MP_STATE_VM(load_global_cache)));
+        MP_STATE_VM(load_global_cache_version) = 1;
+    }
+}
+
+STATIC mp_load_global_cache_entry_t *load_global_cache_entry(const mp_map_t *globals, qstr qst) {
+    size_t index = (((uintptr_t)globals >> 4) ^ qst) & (MICROPY_OPT_LOAD_GLOBAL_CACHE_SIZE - 1);
+    return &MP_STATE_VM(load_global_cache)[index];
+}
+
+// Key additions to map must invalidate the cache from now on.
+STATIC void load_global_cache_watch(mp_map_t *map) {
+    if (!map->is_watched) {
+        map->is_watched = 1;
+        // The map may be at the address of one that entries still refer to.
+        mp_load_global_cache_invalidate();
+    }
+}
+#endif
+
 mp_obj_t MICROPY_WRAP_MP_LOAD_GLOBAL(mp_load_global)(qstr qst) {
     // logic: search globals, builtins
     DEBUG_OP_printf("load global %s\n", qstr_str(qst));
-    mp_map_elem_t *elem = mp_map_lookup(&mp_globals_get()->map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+    mp_map_t *globals = &mp_globals_get()->map;
+    // CIRCUITPY-CHANGE
+    #if MICROPY_OPT_LOAD_GLOBAL_CACHE
+    mp_load_global_cache_entry_t *entry = load_global_cache_entry(globals, qst);
+    if (entry->globals == globals && entry->qst == qst && globals->is_watched
+        && entry->version == MP_STATE_VM(load_global_cache_version)
+        && entry->elem->key == MP_OBJ_NEW_QSTR(qst)) {
+        return entry->elem->value;
+    }
+    #endif
+    mp_map_elem_t *elem = mp_map_lookup(globals, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
     if (elem == NULL) {
         #if MICROPY_CAN_OVERRIDE_BUILTINS
         if (MP_STATE_VM(mp_module_builtins_override_dict) != NULL) {
             // lookup in additional dynamic table of builtins first
-            elem = mp_map_lookup(&MP_STATE_VM(mp_module_builtins_override_dict)->map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
-            if (elem != NULL) {
-                return elem->value;
-            }
+            mp_map_t *override = &MP_STATE_VM(mp_module_builtins_override_dict)->map;
+            #if MICROPY_OPT_LOAD_GLOBAL_CACHE
+            load_global_cache_watch(override);
+            #endif
+            elem = mp_map_lookup(override, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
         }
+        if (elem == NULL)
         #endif
-        elem = mp_map_lookup((mp_map_t *)&mp_module_builtins_globals.map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+        {
+            elem = mp_map_lookup((mp_map_t *)&mp_module_builtins_globals.map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+        }
         if (elem == NULL) {
             #if MICROPY_ERROR_REPORTING <= MICROPY_ERROR_REPORTING_TERSE
             mp_raise_msg(&mp_type_NameError, MP_ERROR_TEXT("name not defined"));
@@ -249,6 +317,15 @@ mp_obj_t MICROPY_WRAP_MP_LOAD_GLOBAL(mp_load_global)(qstr qst) {
             #endif
         }
     }
+    #if MICROPY_OPT_LOAD_GLOBAL_CACHE
+    if (!globals->is_fixed) {
+        load_global_cache_watch(globals);
+        entry->globals = globals;
+        entry->version = MP_STATE_VM(load_global_cache_version);
+        entry->qst = qst;
+        entry->elem = elem;
+    }
+    #endif
     return elem->value;
 }
 
@@ -622,6 +699,16 @@ mp_obj_t MICROPY_WRAP_MP_BINARY_OP(mp_binary_op)(mp_binary_op_t op, mp_obj_t lhs
             }
         #endif
         }
+    #if MICROPY_PY_BUILTINS_FLOAT
+    // CIRCUITPY-CHANGE: float arithmetic is common in sensor code, so skip the
+    // type lookup and slot dispatch when both operands are plain numbers.  With
+    // object representation C this path is free of heap allocation.
+    } else if (mp_obj_is_float(lhs) && (mp_obj_is_float(rhs) || mp_obj_is_small_int(rhs))) {
+        mp_obj_t res = mp_obj_float_binary_op(op, mp_obj_float_get(lhs), rhs);
+        if (res != MP_OBJ_NULL) {
+            return res;
+        }
+    #endif
     }
 
     // Convert MP_BINARY_OP_IN to MP_BINARY_OP_CONTAINS with swapped args.
@@ -1713,9 +1800,18 @@ mp_obj_t mp_parse_compile_execute(mp_lexer_t *lex, mp_parse_input_kind_t parse_i
     // set exception handler to restore context if an exception is raised
     nlr_push_jump_callback(&ctx.callback, mp_globals_locals_set_from_nlr_jump_callback);
 
-    qstr source_name = lex->source_name;
-    mp_parse_tree_t parse_tree = mp_parse(lex, parse_input_kind);
-    mp_obj_t module_fun = mp_compile(&parse_tree, source_name, parse_input_kind == MP_PARSE_SINGLE_INPUT);
+    mp_obj_t module_fun;
+    // CIRCUITPY-CHANGE: compile file input that runs now as it is parsed
+    #if MICROPY_COMP_STREAMING
+    if (parse_input_kind == MP_PARSE_FILE_INPUT && globals != NULL) {
+        module_fun = mp_compile_stream(lex);
+    } else
+    #endif
+    {
+        qstr source_name = lex->source_name;
+        mp_parse_tree_t parse_tree = mp_parse(lex, parse_input_kind);
+        module_fun = mp_compile(&parse_tree, source_name, parse_input_kind == MP_PARSE_SINGLE_INPUT);
+    }
 
     mp_obj_t ret;
     if (MICROPY_PY_BUILTINS_COMPILE && globals == NULL) {
@@ -1917,7 +2013,8 @@ NORETURN void mp_raise_TypeError_int_conversion(mp_const_obj_t arg) {
 }
 
 NORETURN MP_COLD void mp_raise_OSError(int errno_) {
-    mp_raise_type_arg(&mp_type_OSError, MP_OBJ_NEW_SMALL_INT(errno_));
+    // CIRCUITPY-CHANGE
+    nlr_raise(mp_obj_new_exception_errno(errno_));
 }
 
 NORETURN MP_COLD void mp_raise_OSError_with_filename(int errno_, const char *filename) {
@@ -168,6 +168,10 @@ void mp_call_function_1_from_nlr_jump_callback(void *ctx_in);
 
 mp_obj_t mp_load_name(qstr qst);
 mp_obj_t mp_load_global(qstr qst);
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_LOAD_GLOBAL_CACHE
+void mp_load_global_cache_invalidate(void);
+#endif
 mp_obj_t mp_load_build_class(void);
 void mp_store_name(qstr qst, mp_obj_t obj);
 void mp_store_global(qstr qst, mp_obj_t obj);
@@ -274,6 +274,125 @@ STATIC mp_obj_t stream_write1_method(mp_obj_t self_in, mp_obj_t arg) {
 }
 MP_DEFINE_CONST_FUN_OBJ_2(mp_stream_write1_obj, stream_write1_method);
 
+// CIRCUITPY-CHANGE: vectored I/O, so that pieces of a message don't need to be
+// joined before writing.
+mp_uint_t mp_stream_writev(mp_obj_t stream, mp_buffer_info_t *bufs, size_t count, int *errcode) {
+    const mp_stream_p_t *stream_p = mp_get_stream(stream);
+    bool native = stream_p->ioctl != NULL;
+    *errcode = 0;
+    mp_uint_t done = 0;
+    while (count > 0) {
+        if (bufs->len == 0) {
+            bufs++;
+            count--;
+            continue;
+        }
+        mp_uint_t out_sz;
+        if (native) {
+            mp_stream_writev_t writev = { bufs, MIN(count, MP_STREAM_WRITEV_MAX) };
+            out_sz = stream_p->ioctl(stream, MP_STREAM_WRITEV, (uintptr_t)&writev, errcode);
+            if (out_sz == MP_STREAM_ERROR && *errcode == MP_EINVAL) {
+                native = false;
+                *errcode = 0;
+                continue;
+            }
+        } else {
+            out_sz = stream_p->write(stream, bufs->buf, bufs->len, errcode);
+        }
+        // As in mp_stream_rw().
+        if (out_sz == 0) {
+            return done;
+        }
+        if (out_sz == MP_STREAM_ERROR) {
+            if (mp_is_nonblocking_error(*errcode) && done != 0) {
+                *errcode = 0;
+            }
+            return done;
+        }
+        done += out_sz;
+        while (out_sz > 0) {
+            size_t n = MIN(out_sz, bufs->len);
+            bufs->buf = (byte *)bufs->buf + n;
+            bufs->len -= n;
+            out_sz -= n;
+            if (bufs->len == 0) {
+                bufs++;
+                count--;
+            }
+        }
+    }
+    return done;
+}
+
+// Get the buffers of a list or tuple of objects, advancing *index past them.
+STATIC size_t stream_get_buffers(mp_obj_t bufs_in, size_t *index, mp_buffer_info_t *bufs, mp_uint_t flags) {
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_get_array(bufs_in, &len, &items);
+    size_t count = 0;
+    while (*index < len && count < MP_STREAM_WRITEV_MAX) {
+        mp_get_buffer_raise(items[*index], &bufs[count], flags);
+        (*index)++;
+        count++;
+    }
+    return count;
+}
+
+STATIC mp_obj_t stream_writev(mp_obj_t self_in, mp_obj_t bufs_in) {
+    mp_get_stream_raise(self_in, MP_STREAM_OP_WRITE);
+    mp_buffer_info_t bufs[MP_STREAM_WRITEV_MAX];
+    size_t index = 0;
+    mp_uint_t total = 0;
+    size_t count;
+    while ((count = stream_get_buffers(bufs_in, &index, bufs, MP_BUFFER_READ)) > 0) {
+        size_t len = 0;
+        for (size_t i = 0; i < count; i++) {
+            len += bufs[i].len;
+        }
+        int error;
+        mp_uint_t out_sz = mp_stream_writev(self_in, bufs, count, &error);
+        if (error != 0) {
+            if (mp_is_nonblocking_error(error)) {
+                return total == 0 ? mp_const_none : mp_obj_new_int_from_uint(total);
+            }
+            mp_raise_OSError(error);
+        }
+        total += out_sz;
+        if (out_sz < len) {
+            break;
+        }
+    }
+    return mp_obj_new_int_from_uint(total);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(mp_stream_writev_obj, stream_writev);
+
+STATIC mp_obj_t stream_readv(mp_obj_t self_in, mp_obj_t bufs_in) {
+    mp_get_stream_raise(self_in, MP_STREAM_OP_READ);
+    mp_buffer_info_t bufs[MP_STREAM_WRITEV_MAX];
+    size_t index = 0;
+    mp_uint_t total = 0;
+    size_t count;
+    while ((count = stream_get_buffers(bufs_in, &index, bufs, MP_BUFFER_WRITE)) > 0) {
+        for (size_t i = 0; i < count; i++) {
+            int error;
+            mp_uint_t out_sz = mp_stream_read_exactly(self_in, bufs[i].buf, bufs[i].len, &error);
+            if (error != 0) {
+                if (mp_is_nonblocking_error(error)) {
+                    return total == 0 ? mp_const_none : mp_obj_new_int_from_uint(total);
+                }
+                mp_raise_OSError(error);
+            }
+            total += out_sz;
+            if (out_sz < bufs[i].len) {
+                // End of the stream.
+                return mp_obj_new_int_from_uint(total);
+            }
+        }
+    }
+    return mp_obj_new_int_from_uint(total);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(mp_stream_readv_obj, stream_readv);
+
 STATIC mp_obj_t stream_readinto(size_t n_args, const mp_obj_t *args) {
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
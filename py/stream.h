@@ -45,6 +45,10 @@
 #define MP_STREAM_GET_DATA_OPTS (8)  // Get data/message options
 #define MP_STREAM_SET_DATA_OPTS (9)  // Set data/message options
 #define MP_STREAM_GET_FILENO    (10) // Get fileno of underlying file
+// CIRCUITPY-CHANGE
+#define MP_STREAM_POLL_WAKE     (11) // Wake the main task when the poll flags may be ready
+// CIRCUITPY-CHANGE: gathered write of several buffers
+#define MP_STREAM_WRITEV        (12) // arg is mp_stream_writev_t *
 
 // These poll ioctl values are compatible with Linux
 #define MP_STREAM_POLL_RD       (0x0001)
@@ -62,6 +66,18 @@ struct mp_stream_seek_t {
     int whence;
 };
 
+// CIRCUITPY-CHANGE: argument for MP_STREAM_WRITEV. The ioctl writes bufs in
+// order and returns the number of bytes written, which may stop part way as for
+// write. Streams without a native version fail it with MP_EINVAL, and
+// mp_stream_writev() falls back to writing each buffer.
+typedef struct _mp_stream_writev_t {
+    const mp_buffer_info_t *bufs;
+    size_t count;
+} mp_stream_writev_t;
+
+// The most buffers passed to a single MP_STREAM_WRITEV.
+#define MP_STREAM_WRITEV_MAX (8)
+
 // seek ioctl "whence" values
 #define MP_SEEK_SET (0)
 #define MP_SEEK_CUR (1)
@@ -89,6 +105,9 @@ MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(mp_stream_unbuffered_readline_obj);
 MP_DECLARE_CONST_FUN_OBJ_1(mp_stream_unbuffered_readlines_obj);
 MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(mp_stream_write_obj);
 MP_DECLARE_CONST_FUN_OBJ_2(mp_stream_write1_obj);
+// CIRCUITPY-CHANGE
+MP_DECLARE_CONST_FUN_OBJ_2(mp_stream_readv_obj);
+MP_DECLARE_CONST_FUN_OBJ_2(mp_stream_writev_obj);
 MP_DECLARE_CONST_FUN_OBJ_1(mp_stream_close_obj);
 MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(mp_stream___exit___obj);
 MP_DECLARE_CONST_FUN_OBJ_VAR_BETWEEN(mp_stream_seek_obj);
@@ -122,6 +141,9 @@ mp_obj_t mp_stream_write(mp_obj_t self_in, const void *buf, size_t len, byte fla
 mp_uint_t mp_stream_rw(mp_obj_t stream, void *buf, mp_uint_t size, int *errcode, byte flags);
 #define mp_stream_write_exactly(stream, buf, size, err) mp_stream_rw(stream, (byte *)buf, size, err, MP_STREAM_RW_WRITE)
 #define mp_stream_read_exactly(stream, buf, size, err) mp_stream_rw(stream, buf, size, err, MP_STREAM_RW_READ)
+// CIRCUITPY-CHANGE: Write all of bufs, with the same error handling as mp_stream_rw().
+// The entries of bufs are advanced past what has been written.
+mp_uint_t mp_stream_writev(mp_obj_t stream, mp_buffer_info_t *bufs, size_t count, int *errcode);
 
 void mp_stream_write_adaptor(void *self, const char *buf, size_t len);
 // CIRCUITPY-CHANGE
@@ -34,6 +34,8 @@
 #include "py/objfun.h"
 #include "py/runtime.h"
 #include "py/bc0.h"
+// CIRCUITPY-CHANGE
+#include "py/smallint.h"
 #include "py/profile.h"
 
 // *FORMAT-OFF*
@@ -187,6 +189,25 @@
     } \
 } while(0)
 
+// CIRCUITPY-CHANGE
+#elif MICROPY_VM_TRACK_CURRENT_CODE_STATE
+
+// Only maintain the chain of active frames, for the sampling profiler.
+#define FRAME_SETUP() do { \
+    MP_STATE_THREAD(current_code_state) = code_state; \
+} while (0)
+
+#define FRAME_ENTER() do { \
+    code_state->prev_state = MP_STATE_THREAD(current_code_state); \
+} while (0)
+
+#define FRAME_LEAVE() do { \
+    MP_STATE_THREAD(current_code_state) = code_state->prev_state; \
+} while (0)
+
+#define FRAME_UPDATE()
+#define TRACE_TICK(current_ip, current_sp, is_exception)
+
 #else // MICROPY_PY_SYS_SETTRACE
 #define FRAME_SETUP()
 #define FRAME_ENTER()
@@ -205,6 +226,58 @@ STATIC mp_obj_t get_active_exception(mp_exc_stack_t *exc_sp, mp_exc_stack_t *exc
     return MP_OBJ_NULL;
 }
 
+// CIRCUITPY-CHANGE
+#if MICROPY_OPT_VM_SMALL_INT_FAST_PATH
+// Does the comparisons and cheap arithmetic that dominate loops directly when
+// both operands are small ints. Returns MP_OBJ_NULL for mp_binary_op to handle.
+static inline mp_obj_t vm_small_int_binary_op(mp_uint_t op, mp_obj_t lhs, mp_obj_t rhs) {
+    if (!mp_obj_is_small_int(lhs) || !mp_obj_is_small_int(rhs)) {
+        return MP_OBJ_NULL;
+    }
+    mp_int_t l = MP_OBJ_SMALL_INT_VALUE(lhs);
+    mp_int_t r = MP_OBJ_SMALL_INT_VALUE(rhs);
+    mp_int_t result;
+    switch (op) {
+        case MP_BINARY_OP_LESS:
+            return mp_obj_new_bool(l < r);
+        case MP_BINARY_OP_MORE:
+            return mp_obj_new_bool(l > r);
+        case MP_BINARY_OP_EQUAL:
+            return mp_obj_new_bool(l == r);
+        case MP_BINARY_OP_LESS_EQUAL:
+            return mp_obj_new_bool(l <= r);
+        case MP_BINARY_OP_MORE_EQUAL:
+            return mp_obj_new_bool(l >= r);
+        case MP_BINARY_OP_NOT_EQUAL:
+            return mp_obj_new_bool(l != r);
+        case MP_BINARY_OP_OR:
+        case MP_BINARY_OP_INPLACE_OR:
+            return MP_OBJ_NEW_SMALL_INT(l | r);
+        case MP_BINARY_OP_XOR:
+        case MP_BINARY_OP_INPLACE_XOR:
+            return MP_OBJ_NEW_SMALL_INT(l ^ r);
+        case MP_BINARY_OP_AND:
+        case MP_BINARY_OP_INPLACE_AND:
+            return MP_OBJ_NEW_SMALL_INT(l & r);
+        case MP_BINARY_OP_ADD:
+        case MP_BINARY_OP_INPLACE_ADD:
+            // Small ints are at least a bit narrower than mp_int_t so this can't overflow.
+            result = l + r;
+            break;
+        case MP_BINARY_OP_SUBTRACT:
+        case MP_BINARY_OP_INPLACE_SUBTRACT:
+            result = l - r;
+            break;
+        default:
+            return MP_OBJ_NULL;
+    }
+    if (!MP_SMALL_INT_FITS(result)) {
+        return MP_OBJ_NULL;
+    }
+    return MP_OBJ_NEW_SMALL_INT(result);
+}
+#endif
+
 // fastn has items in reverse order (fastn[0] is local[0], fastn[-1] is local[1], etc)
 // sp points to bottom of stack which grows up
 // returns:
@@ -1305,7 +1378,31 @@ yield:
                     MARK_EXC_IP_SELECTIVE();
                     mp_obj_t rhs = POP();
                     mp_obj_t lhs = TOP();
+                    // CIRCUITPY-CHANGE
+                    #if MICROPY_OPT_VM_SMALL_INT_FAST_PATH
+                    mp_uint_t op = ip[-1] - MP_BC_BINARY_OP_MULTI;
+                    mp_obj_t result = vm_small_int_binary_op(op, lhs, rhs);
+                    if (result != MP_OBJ_NULL) {
+                        #if !MICROPY_PY_SYS_SETTRACE
+                        // Branch on a comparison directly instead of pushing the
+                        // bool for the following conditional jump to pop again.
+                        if (op <= MP_BINARY_OP_NOT_EQUAL && (*ip == MP_BC_POP_JUMP_IF_FALSE || *ip == MP_BC_POP_JUMP_IF_TRUE)) {
+                            bool jump_if = *ip++ == MP_BC_POP_JUMP_IF_TRUE;
+                            DECODE_SLABEL;
+                            sp--;
+                            if ((result == mp_const_true) == jump_if) {
+                                ip += slab;
+                            }
+                            DISPATCH_WITH_PEND_EXC_CHECK();
+                        }
+                        #endif
+                        SET_TOP(result);
+                        DISPATCH();
+                    }
+                    SET_TOP(mp_binary_op(op, lhs, rhs));
+                    #else
                     SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
+                    #endif
                     DISPATCH();
                 }
 
@@ -1328,6 +1425,14 @@ yield:
                     } else if (ip[-1] < MP_BC_BINARY_OP_MULTI + MP_BC_BINARY_OP_MULTI_NUM) {
                         mp_obj_t rhs = POP();
                         mp_obj_t lhs = TOP();
+                        // CIRCUITPY-CHANGE
+                        #if MICROPY_OPT_VM_SMALL_INT_FAST_PATH
+                        mp_obj_t result = vm_small_int_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs);
+                        if (result != MP_OBJ_NULL) {
+                            SET_TOP(result);
+                            DISPATCH();
+                        }
+                        #endif
                         SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
                         DISPATCH();
                     } else
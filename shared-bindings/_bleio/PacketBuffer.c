@@ -172,6 +172,69 @@ STATIC mp_obj_t bleio_packet_buffer_write(mp_uint_t n_args, const mp_obj_t *pos_
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(bleio_packet_buffer_write_obj, 1, bleio_packet_buffer_write);
 
+//|     def write_many(self, data: ReadableBuffer, *, header: Optional[bytes] = None) -> int:
+//|         """Writes all bytes from data, split into as many outgoing packets as needed. Each packet
+//|         holds up to `outgoing_packet_length` bytes, including the bytes from header at its start.
+//|         Packets are handed to the BLE stack as soon as it has room for them, so several may be
+//|         sent in one connection event.
+//|
+//|         This blocks until all of the data is pending but does not wait until it is sent.
+//|
+//|         :return: number of bytes written, including header bytes.
+//|         :rtype: int"""
+//|         ...
+STATIC mp_obj_t bleio_packet_buffer_write_many(mp_uint_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_data, ARG_header };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_data,  MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_header, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none}},
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    bleio_packet_buffer_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+
+    mp_buffer_info_t data_bufinfo;
+    mp_get_buffer_raise(args[ARG_data].u_obj, &data_bufinfo, MP_BUFFER_READ);
+
+    mp_buffer_info_t header_bufinfo;
+    header_bufinfo.buf = NULL;
+    header_bufinfo.len = 0;
+    if (args[ARG_header].u_obj != mp_const_none) {
+        mp_get_buffer_raise(args[ARG_header].u_obj, &header_bufinfo, MP_BUFFER_READ);
+    }
+
+    mp_int_t packet_length = common_hal_bleio_packet_buffer_get_outgoing_packet_length(self);
+    if (packet_length < 0) {
+        // Not connected (yet). Match write() and report nothing written.
+        return MP_OBJ_NEW_SMALL_INT(0);
+    }
+    if ((size_t)packet_length <= header_bufinfo.len) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Total data to write is larger than %q"), MP_QSTR_outgoing_packet_length);
+    }
+    size_t chunk_size = packet_length - header_bufinfo.len;
+
+    const uint8_t *data = data_bufinfo.buf;
+    size_t remaining = data_bufinfo.len;
+    mp_int_t total_written = 0;
+    while (remaining > 0) {
+        size_t len = MIN(remaining, chunk_size);
+        mp_int_t num_bytes_written = common_hal_bleio_packet_buffer_write(
+            self, data, len, header_bufinfo.buf, header_bufinfo.len);
+        if (num_bytes_written < 0) {
+            // Disconnected part way through. See the note in write().
+            break;
+        }
+        total_written += num_bytes_written;
+        data += len;
+        remaining -= len;
+    }
+    return MP_OBJ_NEW_SMALL_INT(total_written);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(bleio_packet_buffer_write_many_obj, 1, bleio_packet_buffer_write_many);
+
 //|     def deinit(self) -> None:
 //|         """Disable permanently."""
 //|         ...
@@ -221,6 +284,7 @@ STATIC const mp_rom_map_elem_t bleio_packet_buffer_locals_dict_table[] = {
     // Standard stream methods.
     { MP_OBJ_NEW_QSTR(MP_QSTR_readinto),               MP_ROM_PTR(&bleio_packet_buffer_readinto_obj) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_write),                  MP_ROM_PTR(&bleio_packet_buffer_write_obj) },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_write_many),             MP_ROM_PTR(&bleio_packet_buffer_write_many_obj) },
 
     { MP_OBJ_NEW_QSTR(MP_QSTR_incoming_packet_length), MP_ROM_PTR(&bleio_packet_buffer_incoming_packet_length_obj) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_outgoing_packet_length), MP_ROM_PTR(&bleio_packet_buffer_outgoing_packet_length_obj) },
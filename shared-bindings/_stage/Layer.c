@@ -50,6 +50,10 @@
 //|         :param ~circuitpython_typing.ReadableBuffer palette: The color palette to be used.
 //|         :param ~circuitpython_typing.ReadableBuffer grid: The contents of the grid map.
 //|
+//|         The graphic is scanned here to find the tiles that have only
+//|         transparent colors, so that rendering can skip them. Changing its
+//|         pixels afterwards needs a new Layer for that to be seen.
+//|
 //|         This class is intended for internal use in the ``stage`` library and
 //|         it shouldn't be used on its own."""
 //|         ...
@@ -65,6 +69,10 @@ STATIC mp_obj_t layer_make_new(const mp_obj_type_t *type, size_t n_args,
     self->y = 0;
     self->frame = 0;
     self->rotation = false;
+    self->drawn_x = 0;
+    self->drawn_y = 0;
+    self->drawn_frame = 0;
+    self->drawn_rotation = 0;
 
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(args[2], &bufinfo, MP_BUFFER_READ);
@@ -72,6 +80,7 @@ STATIC mp_obj_t layer_make_new(const mp_obj_type_t *type, size_t n_args,
     if (bufinfo.len != 2048) {
         mp_raise_ValueError(MP_ERROR_TEXT("graphic must be 2048 bytes long"));
     }
+    layer_scan_tiles(self);
 
     mp_get_buffer_raise(args[3], &bufinfo, MP_BUFFER_READ);
     self->palette = bufinfo.buf;
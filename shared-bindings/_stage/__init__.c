@@ -103,12 +103,46 @@ STATIC mp_obj_t stage_render(size_t n_args, const mp_obj_t *args) {
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(stage_render_obj, 10, 10, stage_render);
 
+//| def dirty_areas(layers: List[Layer]) -> List[Tuple[int, int, int, int]]:
+//|     """Get the parts of the screen to render again because layers moved or
+//|     changed frame since the last call.
+//|
+//|     Each area is ``(x0, y0, x1, y1)`` and covers both where a layer was and
+//|     where it is now. Areas that overlap enough are merged, and there are
+//|     at most 8 of them. Changes to grid maps and to `Text` aren't tracked.
+//|
+//|     :param layers: A list of the :py:class:`~_stage.Layer` objects.
+//|     :type layers: list[Layer]"""
+//|
+STATIC mp_obj_t stage_dirty_areas_fn(mp_obj_t layers_in) {
+    size_t layers_size = 0;
+    mp_obj_t *layers;
+    mp_obj_get_array(layers_in, &layers_size, &layers);
+
+    displayio_area_t areas[STAGE_MAX_DIRTY_AREAS];
+    size_t areas_size = stage_dirty_areas(layers, layers_size, areas, STAGE_MAX_DIRTY_AREAS);
+
+    mp_obj_list_t *result = MP_OBJ_TO_PTR(mp_obj_new_list(areas_size, NULL));
+    for (size_t i = 0; i < areas_size; ++i) {
+        mp_obj_t coords[4] = {
+            MP_OBJ_NEW_SMALL_INT(areas[i].x1),
+            MP_OBJ_NEW_SMALL_INT(areas[i].y1),
+            MP_OBJ_NEW_SMALL_INT(areas[i].x2),
+            MP_OBJ_NEW_SMALL_INT(areas[i].y2),
+        };
+        result->items[i] = mp_obj_new_tuple(4, coords);
+    }
+    return MP_OBJ_FROM_PTR(result);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(stage_dirty_areas_obj, stage_dirty_areas_fn);
+
 
 STATIC const mp_rom_map_elem_t stage_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR__stage) },
     { MP_ROM_QSTR(MP_QSTR_Layer), MP_ROM_PTR(&mp_type_layer) },
     { MP_ROM_QSTR(MP_QSTR_Text), MP_ROM_PTR(&mp_type_text) },
     { MP_ROM_QSTR(MP_QSTR_render), MP_ROM_PTR(&stage_render_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dirty_areas), MP_ROM_PTR(&stage_dirty_areas_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(stage_module_globals, stage_module_globals_table);
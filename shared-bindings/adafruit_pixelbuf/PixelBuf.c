@@ -262,6 +262,57 @@ STATIC mp_obj_t pixelbuf_pixelbuf_fill(mp_obj_t self_in, mp_obj_t value) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(pixelbuf_pixelbuf_fill_obj, pixelbuf_pixelbuf_fill);
 
+//|     def set_from_buffer(
+//|         self, buffer: ReadableBuffer, start: int = 0, *, gamma: Optional[ReadableBuffer] = None
+//|     ) -> None:
+//|         """Sets consecutive pixels, starting at ``start``, from packed bytes.
+//|
+//|         The buffer holds `bpp` bytes for each pixel, in red, green, blue[, white] order whatever
+//|         the `byteorder` is, with the 4th byte being the brightness for DotStars. This is the same as
+//|         setting each pixel from a tuple of those values, but much faster for many pixels.
+//|
+//|         :param ~circuitpython_typing.ReadableBuffer buffer: The pixel values
+//|         :param int start: The first pixel to set
+//|         :param ~circuitpython_typing.ReadableBuffer gamma: 256 bytes that each red, green, blue and
+//|             white value is looked up in before it is stored, for gamma correction. DotStar brightness
+//|             is not looked up."""
+//|         ...
+//|
+STATIC mp_obj_t pixelbuf_pixelbuf_set_from_buffer(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_start, ARG_gamma };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_start, MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_gamma, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t self_in = pos_args[0];
+    size_t length = common_hal_adafruit_pixelbuf_pixelbuf_get_len(self_in);
+    size_t bpp = common_hal_adafruit_pixelbuf_pixelbuf_get_bpp(self_in);
+    size_t start = mp_arg_validate_int_range(args[ARG_start].u_int, 0, length, MP_QSTR_start);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
+    if (bufinfo.len % bpp != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_buffer);
+    }
+    size_t count = mp_arg_validate_length_max(bufinfo.len / bpp, length - start, MP_QSTR_buffer);
+
+    const uint8_t *gamma = NULL;
+    if (args[ARG_gamma].u_obj != mp_const_none) {
+        mp_buffer_info_t gamma_info;
+        mp_get_buffer_raise(args[ARG_gamma].u_obj, &gamma_info, MP_BUFFER_READ);
+        mp_arg_validate_length(gamma_info.len, 256, MP_QSTR_gamma);
+        gamma = gamma_info.buf;
+    }
+
+    common_hal_adafruit_pixelbuf_pixelbuf_set_pixels_from_buffer(self_in, start, bufinfo.buf, count, gamma);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(pixelbuf_pixelbuf_set_from_buffer_obj, 2, pixelbuf_pixelbuf_set_from_buffer);
+
 //|     @overload
 //|     def __getitem__(self, index: slice) -> PixelReturnSequence:
 //|         """Returns the pixel value at the given index as a tuple of (Red, Green, Blue[, White]) values
@@ -363,6 +414,7 @@ STATIC const mp_rom_map_elem_t pixelbuf_pixelbuf_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_byteorder), MP_ROM_PTR(&pixelbuf_pixelbuf_byteorder_str)},
     { MP_ROM_QSTR(MP_QSTR_show), MP_ROM_PTR(&pixelbuf_pixelbuf_show_obj)},
     { MP_ROM_QSTR(MP_QSTR_fill), MP_ROM_PTR(&pixelbuf_pixelbuf_fill_obj)},
+    { MP_ROM_QSTR(MP_QSTR_set_from_buffer), MP_ROM_PTR(&pixelbuf_pixelbuf_set_from_buffer_obj)},
 };
 
 STATIC MP_DEFINE_CONST_DICT(pixelbuf_pixelbuf_locals_dict, pixelbuf_pixelbuf_locals_dict_table);
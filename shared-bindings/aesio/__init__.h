@@ -27,7 +27,13 @@
 #ifndef MICROPY_INCLUDED_SHARED_BINDINGS_AESIO_H
 #define MICROPY_INCLUDED_SHARED_BINDINGS_AESIO_H
 
+#include "py/obj.h"
+
+#if CIRCUITPY_AESIO_TINYAES
 #include "shared-module/aesio/__init__.h"
+#else
+#include "common-hal/aesio/__init__.h"
+#endif
 
 extern const mp_obj_type_t aesio_aes_type;
 
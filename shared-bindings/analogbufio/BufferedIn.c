@@ -118,6 +118,18 @@ STATIC mp_obj_t analogbufio_bufferedin___exit__(size_t n_args, const mp_obj_t *a
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(analogbufio_bufferedin___exit___obj, 4, 4, analogbufio_bufferedin___exit__);
 
+STATIC uint8_t get_bytes_per_sample(mp_obj_t buffer_obj, mp_buffer_info_t *bufinfo, mp_uint_t flags, qstr arg_name) {
+    mp_get_buffer_raise(buffer_obj, bufinfo, flags);
+
+    // Bytes Per Sample
+    if (bufinfo->typecode == 'H') {
+        return 2;
+    } else if (bufinfo->typecode != 'B' && bufinfo->typecode != BYTEARRAY_TYPECODE) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be a bytearray or array of type 'H' or 'B'"), arg_name);
+    }
+    return 1;
+}
+
 //|     def readinto(self, buffer: WriteableBuffer) -> int:
 //|         """Fills the provided buffer with ADC voltage values.
 //|
@@ -127,6 +139,10 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(analogbufio_bufferedin___exit___obj,
 //|         The ADC most significant bits of the ADC are kept. (See
 //|         https://docs.circuitpython.org/en/latest/docs/library/array.html)
 //|
+//|         While capturing continuously, copies the samples captured since the previous
+//|         read without waiting for more and returns the number of samples copied. The
+//|         buffer typecode must match the ring buffer's.
+//|
 //|         :param ~circuitpython_typing.WriteableBuffer buffer: buffer: A buffer for samples"""
 //|         ...
 //|
@@ -136,28 +152,89 @@ STATIC mp_obj_t analogbufio_bufferedin_obj_readinto(mp_obj_t self_in, mp_obj_t b
 
     // Buffer defined and allocated by user
     mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(buffer_obj, &bufinfo, MP_BUFFER_READ);
-
-    uint8_t bytes_per_sample = 1;
-
-    // Bytes Per Sample
-    if (bufinfo.typecode == 'H') {
-        bytes_per_sample = 2;
-    } else if (bufinfo.typecode != 'B' && bufinfo.typecode != BYTEARRAY_TYPECODE) {
-        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be a bytearray or array of type 'H' or 'B'"), MP_QSTR_buffer);
-    }
+    uint8_t bytes_per_sample = get_bytes_per_sample(buffer_obj, &bufinfo, MP_BUFFER_WRITE, MP_QSTR_buffer);
 
     mp_uint_t captured = common_hal_analogbufio_bufferedin_readinto(self, bufinfo.buf, bufinfo.len, bytes_per_sample);
     return MP_OBJ_NEW_SMALL_INT(captured);
 }
 MP_DEFINE_CONST_FUN_OBJ_2(analogbufio_bufferedin_readinto_obj, analogbufio_bufferedin_obj_readinto);
 
+//|     def start_continuous(self, ring_buffer: WriteableBuffer) -> None:
+//|         """Start sampling continuously into ``ring_buffer`` in the background.
+//|
+//|         The ADC keeps running at the sample rate and wraps around ``ring_buffer``
+//|         without gaps. Use `readinto` to copy out newly captured samples. Samples that
+//|         are overwritten before they are read are counted in `overruns`. The ring
+//|         buffer must not be changed or resized until `stop_continuous` is called.
+//|
+//|         :param ~circuitpython_typing.WriteableBuffer ring_buffer: A bytearray or
+//|           array of type 'H' or 'B' that the samples are written to"""
+//|         ...
+//|
+STATIC mp_obj_t analogbufio_bufferedin_obj_start_continuous(mp_obj_t self_in, mp_obj_t ring_obj) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    uint8_t bytes_per_sample = get_bytes_per_sample(ring_obj, &bufinfo, MP_BUFFER_WRITE, MP_QSTR_ring_buffer);
+    mp_arg_validate_length_min(bufinfo.len / bytes_per_sample, 1, MP_QSTR_ring_buffer);
+
+    common_hal_analogbufio_bufferedin_start_continuous(self, ring_obj, bufinfo.buf, bufinfo.len, bytes_per_sample);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(analogbufio_bufferedin_start_continuous_obj, analogbufio_bufferedin_obj_start_continuous);
+
+//|     def stop_continuous(self) -> None:
+//|         """Stop continuous sampling started by `start_continuous`."""
+//|         ...
+//|
+STATIC mp_obj_t analogbufio_bufferedin_obj_stop_continuous(mp_obj_t self_in) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_analogbufio_bufferedin_stop_continuous(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(analogbufio_bufferedin_stop_continuous_obj, analogbufio_bufferedin_obj_stop_continuous);
+
+//|     sample_count: int
+//|     """The number of continuously captured samples returned by `readinto` or lost
+//|     to overruns so far. Divide by the sample rate to get the time of the next sample
+//|     `readinto` will return. (read-only)"""
+//|
+STATIC mp_obj_t analogbufio_bufferedin_obj_get_sample_count(mp_obj_t self_in) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_ull(common_hal_analogbufio_bufferedin_get_sample_count(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(analogbufio_bufferedin_get_sample_count_obj, analogbufio_bufferedin_obj_get_sample_count);
+
+MP_PROPERTY_GETTER(analogbufio_bufferedin_sample_count_obj,
+    (mp_obj_t)&analogbufio_bufferedin_get_sample_count_obj);
+
+//|     overruns: int
+//|     """The number of continuously captured samples that were overwritten before
+//|     `readinto` could return them. (read-only)"""
+//|
+STATIC mp_obj_t analogbufio_bufferedin_obj_get_overruns(mp_obj_t self_in) {
+    analogbufio_bufferedin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_analogbufio_bufferedin_get_overruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(analogbufio_bufferedin_get_overruns_obj, analogbufio_bufferedin_obj_get_overruns);
+
+MP_PROPERTY_GETTER(analogbufio_bufferedin_overruns_obj,
+    (mp_obj_t)&analogbufio_bufferedin_get_overruns_obj);
+
 STATIC const mp_rom_map_elem_t analogbufio_bufferedin_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___del__),    MP_ROM_PTR(&analogbufio_bufferedin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit),     MP_ROM_PTR(&analogbufio_bufferedin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__),  MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__),   MP_ROM_PTR(&analogbufio_bufferedin___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_readinto),       MP_ROM_PTR(&analogbufio_bufferedin_readinto_obj)},
+    { MP_ROM_QSTR(MP_QSTR_start_continuous), MP_ROM_PTR(&analogbufio_bufferedin_start_continuous_obj)},
+    { MP_ROM_QSTR(MP_QSTR_stop_continuous), MP_ROM_PTR(&analogbufio_bufferedin_stop_continuous_obj)},
+    { MP_ROM_QSTR(MP_QSTR_sample_count),   MP_ROM_PTR(&analogbufio_bufferedin_sample_count_obj)},
+    { MP_ROM_QSTR(MP_QSTR_overruns),       MP_ROM_PTR(&analogbufio_bufferedin_overruns_obj)},
 
 };
 
@@ -36,5 +36,10 @@ void common_hal_analogbufio_bufferedin_construct(analogbufio_bufferedin_obj_t *s
 void common_hal_analogbufio_bufferedin_deinit(analogbufio_bufferedin_obj_t *self);
 bool common_hal_analogbufio_bufferedin_deinited(analogbufio_bufferedin_obj_t *self);
 uint32_t common_hal_analogbufio_bufferedin_readinto(analogbufio_bufferedin_obj_t *self, uint8_t *buffer, uint32_t len, uint8_t bytes_per_sample);
+void common_hal_analogbufio_bufferedin_start_continuous(analogbufio_bufferedin_obj_t *self, mp_obj_t ring_obj, uint8_t *ring, uint32_t len, uint8_t bytes_per_sample);
+void common_hal_analogbufio_bufferedin_stop_continuous(analogbufio_bufferedin_obj_t *self);
+bool common_hal_analogbufio_bufferedin_get_continuous(analogbufio_bufferedin_obj_t *self);
+uint64_t common_hal_analogbufio_bufferedin_get_sample_count(analogbufio_bufferedin_obj_t *self);
+uint32_t common_hal_analogbufio_bufferedin_get_overruns(analogbufio_bufferedin_obj_t *self);
 
 #endif  // __MICROPY_INCLUDED_SHARED_BINDINGS_ANALOGBUFIO_BUFFEREDIN_H__
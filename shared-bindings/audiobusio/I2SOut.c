@@ -164,7 +164,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiobusio_i2sout___exit___obj, 4, 4,
 //|         """Plays the sample once when loop=False and continuously when loop=True.
 //|         Does not block. Use `playing` to block.
 //|
-//|         Sample must be an `audiocore.WaveFile`, `audiocore.RawSample`, `audiomixer.Mixer` or `audiomp3.MP3Decoder`.
+//|         Sample must be an `audiocore.WaveFile`, `audiocore.RawSample`, `audiocore.Resampler`, `audiomixer.Mixer` or `audiomp3.MP3Decoder`.
 //|
 //|         The sample itself should consist of 8 bit or 16 bit samples."""
 //|         ...
@@ -241,7 +241,6 @@ MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_i2sout_resume_obj, audiobusio_i2sout_obj_re
 
 //|     paused: bool
 //|     """True when playback is paused. (read-only)"""
-//|
 STATIC mp_obj_t audiobusio_i2sout_obj_get_paused(mp_obj_t self_in) {
     audiobusio_i2sout_obj_t *self = MP_OBJ_TO_PTR(self_in);
     check_for_deinit(self);
@@ -251,6 +250,30 @@ MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_i2sout_get_paused_obj, audiobusio_i2sout_ob
 
 MP_PROPERTY_GETTER(audiobusio_i2sout_paused_obj,
     (mp_obj_t)&audiobusio_i2sout_get_paused_obj);
+
+// Ports that don't count underruns report None.
+MP_WEAK mp_int_t common_hal_audiobusio_i2sout_get_underruns(audiobusio_i2sout_obj_t *self) {
+    return -1;
+}
+
+//|     underruns: Optional[int]
+//|     """The number of times the output ran out of samples to play, since the
+//|     last `play`. This happens when other work delays refilling the buffers.
+//|     None when the port doesn't count them. (read-only)"""
+//|
+STATIC mp_obj_t audiobusio_i2sout_obj_get_underruns(mp_obj_t self_in) {
+    audiobusio_i2sout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_int_t underruns = common_hal_audiobusio_i2sout_get_underruns(self);
+    if (underruns < 0) {
+        return mp_const_none;
+    }
+    return mp_obj_new_int_from_uint(underruns);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_i2sout_get_underruns_obj, audiobusio_i2sout_obj_get_underruns);
+
+MP_PROPERTY_GETTER(audiobusio_i2sout_underruns_obj,
+    (mp_obj_t)&audiobusio_i2sout_get_underruns_obj);
 #endif // CIRCUITPY_AUDIOBUSIO_I2SOUT
 
 STATIC const mp_rom_map_elem_t audiobusio_i2sout_locals_dict_table[] = {
@@ -268,6 +291,7 @@ STATIC const mp_rom_map_elem_t audiobusio_i2sout_locals_dict_table[] = {
     // Properties
     { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&audiobusio_i2sout_playing_obj) },
     { MP_ROM_QSTR(MP_QSTR_paused), MP_ROM_PTR(&audiobusio_i2sout_paused_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audiobusio_i2sout_underruns_obj) },
     #endif // CIRCUITPY_AUDIOBUSIO_I2SOUT
 };
 STATIC MP_DEFINE_CONST_DICT(audiobusio_i2sout_locals_dict, audiobusio_i2sout_locals_dict_table);
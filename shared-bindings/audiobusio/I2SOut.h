@@ -47,6 +47,7 @@ bool common_hal_audiobusio_i2sout_get_playing(audiobusio_i2sout_obj_t *self);
 void common_hal_audiobusio_i2sout_pause(audiobusio_i2sout_obj_t *self);
 void common_hal_audiobusio_i2sout_resume(audiobusio_i2sout_obj_t *self);
 bool common_hal_audiobusio_i2sout_get_paused(audiobusio_i2sout_obj_t *self);
+mp_int_t common_hal_audiobusio_i2sout_get_underruns(audiobusio_i2sout_obj_t *self);
 
 #endif // CIRCUITPY_AUDIOBUSIO_I2SOUT
 
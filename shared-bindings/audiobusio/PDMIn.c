@@ -89,6 +89,20 @@
 //|           b = array.array("H", [0] * 200)
 //|           with audiobusio.PDMIn(board.MICROPHONE_CLOCK, board.MICROPHONE_DATA, sample_rate=16000, bit_depth=16) as mic:
 //|               mic.record(b, len(b))
+//|
+//|         To record continuously, for example to a file::
+//|
+//|           import array
+//|           import audiobusio
+//|           import board
+//|
+//|           b = array.array("H", [0] * 512)
+//|           with audiobusio.PDMIn(board.MICROPHONE_CLOCK, board.MICROPHONE_DATA, sample_rate=16000, bit_depth=16) as mic:
+//|               mic.start_recording(4096)
+//|               with open("/recording.raw", "wb") as f:
+//|                   while True:
+//|                       n = mic.readinto(b)
+//|                       f.write(memoryview(b)[:n])
 //|         """
 //|     ...
 STATIC mp_obj_t audiobusio_pdmin_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
@@ -114,8 +128,10 @@ STATIC mp_obj_t audiobusio_pdmin_make_new(const mp_obj_type_t *type, size_t n_ar
     const mcu_pin_obj_t *clock_pin = validate_obj_is_free_pin(args[ARG_clock_pin].u_obj, MP_QSTR_clock_pin);
     const mcu_pin_obj_t *data_pin = validate_obj_is_free_pin(args[ARG_data_pin].u_obj, MP_QSTR_data_pin);
 
-    // create PDMIn object from the given pin
-    audiobusio_pdmin_obj_t *self = mp_obj_malloc(audiobusio_pdmin_obj_t, &audiobusio_pdmin_type);
+    // create PDMIn object from the given pin. The finaliser stops any background
+    // recording into the heap.
+    audiobusio_pdmin_obj_t *self = m_new_obj_with_finaliser(audiobusio_pdmin_obj_t);
+    self->base.type = &audiobusio_pdmin_type;
 
     uint32_t sample_rate = args[ARG_sample_rate].u_int;
     uint8_t bit_depth = args[ARG_bit_depth].u_int;
@@ -177,7 +193,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiobusio_pdmin___exit___obj, 4, 4,
 
 //|     def record(self, destination: WriteableBuffer, destination_length: int) -> None:
 //|         """Records destination_length bytes of samples to destination. This is
-//|         blocking.
+//|         blocking. Stops any recording started by `start_recording`.
 //|
 //|         An IOError may be raised when the destination is too slow to record the
 //|         audio at the given rate. For internal flash, writing all 1s to the file
@@ -186,6 +202,15 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiobusio_pdmin___exit___obj, 4, 4,
 //|         :return: The number of samples recorded. If this is less than ``destination_length``,
 //|           some samples were missed due to processing time."""
 //|         ...
+STATIC void validate_destination(audiobusio_pdmin_obj_t *self, mp_buffer_info_t *bufinfo) {
+    uint8_t bit_depth = common_hal_audiobusio_pdmin_get_bit_depth(self);
+    if (bufinfo->typecode != 'H' && bit_depth == 16) {
+        mp_raise_ValueError(MP_ERROR_TEXT("destination buffer must be an array of type 'H' for bit_depth = 16"));
+    } else if (bufinfo->typecode != 'B' && bufinfo->typecode != BYTEARRAY_TYPECODE && bit_depth == 8) {
+        mp_raise_ValueError(MP_ERROR_TEXT("destination buffer must be a bytearray or array of type 'B' for bit_depth = 8"));
+    }
+}
+
 STATIC mp_obj_t audiobusio_pdmin_obj_record(mp_obj_t self_obj, mp_obj_t destination, mp_obj_t destination_length) {
     audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_obj);
     check_for_deinit(self);
@@ -199,12 +224,7 @@ STATIC mp_obj_t audiobusio_pdmin_obj_record(mp_obj_t self_obj, mp_obj_t destinat
         if (bufinfo.len / mp_binary_get_size('@', bufinfo.typecode, NULL) < length) {
             mp_raise_ValueError(MP_ERROR_TEXT("Destination capacity is smaller than destination_length."));
         }
-        uint8_t bit_depth = common_hal_audiobusio_pdmin_get_bit_depth(self);
-        if (bufinfo.typecode != 'H' && bit_depth == 16) {
-            mp_raise_ValueError(MP_ERROR_TEXT("destination buffer must be an array of type 'H' for bit_depth = 16"));
-        } else if (bufinfo.typecode != 'B' && bufinfo.typecode != BYTEARRAY_TYPECODE && bit_depth == 8) {
-            mp_raise_ValueError(MP_ERROR_TEXT("destination buffer must be a bytearray or array of type 'B' for bit_depth = 8"));
-        }
+        validate_destination(self, &bufinfo);
         // length is the buffer length in slots, not bytes.
         uint32_t length_written =
             common_hal_audiobusio_pdmin_record_to_buffer(self, bufinfo.buf, length);
@@ -214,6 +234,74 @@ STATIC mp_obj_t audiobusio_pdmin_obj_record(mp_obj_t self_obj, mp_obj_t destinat
 }
 MP_DEFINE_CONST_FUN_OBJ_3(audiobusio_pdmin_record_obj, audiobusio_pdmin_obj_record);
 
+//|     def start_recording(self, buffer_length: int = 4096) -> None:
+//|         """Start recording continuously in the background. Use `readinto` to collect
+//|         the samples.
+//|
+//|         :param int buffer_length: The number of samples kept for `readinto`. Samples
+//|           that are not read in time are dropped and counted in `overruns`.
+//|
+//|         **Limitations:** Only available on RP2040 and nRF52840."""
+//|         ...
+STATIC mp_obj_t audiobusio_pdmin_obj_start_recording(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer_length };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer_length, MP_ARG_INT, {.u_int = 4096} },
+    };
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    uint32_t buffer_length = mp_arg_validate_int_min(args[ARG_buffer_length].u_int, 16, MP_QSTR_buffer_length);
+    common_hal_audiobusio_pdmin_start_recording(self, buffer_length);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(audiobusio_pdmin_start_recording_obj, 1, audiobusio_pdmin_obj_start_recording);
+
+//|     def stop_recording(self) -> None:
+//|         """Stop recording started by `start_recording`."""
+//|         ...
+STATIC mp_obj_t audiobusio_pdmin_obj_stop_recording(mp_obj_t self_in) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_audiobusio_pdmin_stop_recording(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_stop_recording_obj, audiobusio_pdmin_obj_stop_recording);
+
+//|     def readinto(self, buffer: WriteableBuffer) -> int:
+//|         """Copy the samples recorded in the background since the last call into
+//|         ``buffer``. This does not wait for more samples.
+//|
+//|         :return: The number of samples copied. 0 when not recording."""
+//|         ...
+STATIC mp_obj_t audiobusio_pdmin_obj_readinto(mp_obj_t self_in, mp_obj_t buffer) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_WRITE);
+    validate_destination(self, &bufinfo);
+    uint32_t length = bufinfo.len / mp_binary_get_size('@', bufinfo.typecode, NULL);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audiobusio_pdmin_readinto(self, bufinfo.buf, length));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiobusio_pdmin_readinto_obj, audiobusio_pdmin_obj_readinto);
+
+//|     overruns: int
+//|     """The number of samples recorded in the background that were dropped because
+//|     `readinto` wasn't called often enough."""
+//|
+STATIC mp_obj_t audiobusio_pdmin_obj_get_overruns(mp_obj_t self_in) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audiobusio_pdmin_get_overruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_get_overruns_obj, audiobusio_pdmin_obj_get_overruns);
+
+MP_PROPERTY_GETTER(audiobusio_pdmin_overruns_obj,
+    (mp_obj_t)&audiobusio_pdmin_get_overruns_obj);
+
 //|     sample_rate: int
 //|     """The actual sample_rate of the recording. This may not match the constructed
 //|     sample rate due to internal clock limitations."""
@@ -230,10 +318,15 @@ MP_PROPERTY_GETTER(audiobusio_pdmin_sample_rate_obj,
 
 STATIC const mp_rom_map_elem_t audiobusio_pdmin_locals_dict_table[] = {
     // Methods
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&audiobusio_pdmin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiobusio_pdmin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiobusio_pdmin___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_record), MP_ROM_PTR(&audiobusio_pdmin_record_obj) },
+    { MP_ROM_QSTR(MP_QSTR_start_recording), MP_ROM_PTR(&audiobusio_pdmin_start_recording_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop_recording), MP_ROM_PTR(&audiobusio_pdmin_stop_recording_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&audiobusio_pdmin_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_overruns), MP_ROM_PTR(&audiobusio_pdmin_overruns_obj) },
     { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audiobusio_pdmin_sample_rate_obj) }
 };
 STATIC MP_DEFINE_CONST_DICT(audiobusio_pdmin_locals_dict, audiobusio_pdmin_locals_dict_table);
@@ -0,0 +1,236 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+#include "shared-bindings/audiocore/Resampler.h"
+
+//| class Resampler:
+//|     """Converts another sample to a different sample rate and format while it plays"""
+//|
+//|     def __init__(
+//|         self,
+//|         sample: circuitpython_typing.AudioSample,
+//|         *,
+//|         sample_rate: int,
+//|         channel_count: Optional[int] = None,
+//|         bits_per_sample: int = 16,
+//|         samples_signed: bool = True,
+//|         buffer_size: int = 1024,
+//|         polyphase: bool = False,
+//|     ) -> None:
+//|         """Create a Resampler that plays ``sample`` at ``sample_rate`` in the given format. This
+//|         lets samples of different rates, bit depths and channel counts be played by the same
+//|         `audiomixer.Mixer`. Mono samples are copied to both channels of stereo output and
+//|         stereo samples are averaged for mono output.
+//|
+//|         The conversion is done a buffer at a time while the sample plays so the sample's own
+//|         `sample_rate` is read each time playback starts.
+//|
+//|         :param ~circuitpython_typing.AudioSample sample: The sample to convert. It must have
+//|           one or two channels of 8 or 16 bit samples.
+//|         :param int sample_rate: The sample rate to output
+//|         :param int channel_count: The number of channels to output. 1 = mono; 2 = stereo.
+//|           Defaults to the sample's channel count.
+//|         :param int bits_per_sample: The bits per sample to output
+//|         :param bool samples_signed: Output signed (True) or unsigned (False) samples
+//|         :param int buffer_size: The total size in bytes of the buffers to convert into
+//|         :param bool polyphase: Interpolate with a four tap polyphase filter instead of
+//|           linearly between neighbouring samples. This sounds cleaner, especially when
+//|           increasing the sample rate, but takes about twice as long.
+//|
+//|         Playing a 44.1kHz MP3 alongside a 22.05kHz synthesizer::
+//|
+//|           import audiocore
+//|           import audiomixer
+//|           import audiomp3
+//|           import audiopwmio
+//|           import board
+//|           import synthio
+//|
+//|           audio = audiopwmio.PWMAudioOut(board.A0)
+//|           mixer = audiomixer.Mixer(voice_count=2, sample_rate=22050, channel_count=1)
+//|           synth = synthio.Synthesizer(sample_rate=22050)
+//|           mp3 = audiomp3.MP3Decoder(open("music.mp3", "rb"))
+//|           audio.play(mixer)
+//|           mixer.voice[0].play(synth)
+//|           mixer.voice[1].play(audiocore.Resampler(mp3, sample_rate=22050, channel_count=1))
+//|           synth.press(64)"""
+//|         ...
+STATIC mp_obj_t audioio_resampler_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_sample, ARG_sample_rate, ARG_channel_count, ARG_bits_per_sample, ARG_samples_signed, ARG_buffer_size, ARG_polyphase };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY | MP_ARG_REQUIRED, {.u_int = 0} },
+        { MP_QSTR_channel_count, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_bits_per_sample, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 16} },
+        { MP_QSTR_samples_signed, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1024} },
+        { MP_QSTR_polyphase, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t sample = args[ARG_sample].u_obj;
+    mp_int_t sample_rate = mp_arg_validate_int_min(args[ARG_sample_rate].u_int, 1, MP_QSTR_sample_rate);
+    mp_int_t channel_count;
+    if (args[ARG_channel_count].u_obj == mp_const_none) {
+        channel_count = audiosample_channel_count(sample);
+    } else {
+        channel_count = mp_obj_get_int(args[ARG_channel_count].u_obj);
+    }
+    channel_count = mp_arg_validate_int_range(channel_count, 1, 2, MP_QSTR_channel_count);
+    mp_int_t bits_per_sample = args[ARG_bits_per_sample].u_int;
+    if (bits_per_sample != 8 && bits_per_sample != 16) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bits_per_sample must be 8 or 16"));
+    }
+    mp_int_t buffer_size = mp_arg_validate_int_min(args[ARG_buffer_size].u_int, 4, MP_QSTR_buffer_size);
+
+    audioio_resampler_obj_t *self = mp_obj_malloc(audioio_resampler_obj_t, &audioio_resampler_type);
+    common_hal_audioio_resampler_construct(self, sample, buffer_size, bits_per_sample,
+        args[ARG_samples_signed].u_bool, channel_count, sample_rate, args[ARG_polyphase].u_bool);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Resampler and releases its buffers. The wrapped sample is not
+//|         deinitialised."""
+//|         ...
+STATIC mp_obj_t audioio_resampler_deinit(mp_obj_t self_in) {
+    audioio_resampler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audioio_resampler_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(audioio_resampler_deinit_obj, audioio_resampler_deinit);
+
+STATIC void check_for_deinit(audioio_resampler_obj_t *self) {
+    if (common_hal_audioio_resampler_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def __enter__(self) -> Resampler:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the hardware when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+STATIC mp_obj_t audioio_resampler_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_audioio_resampler_deinit(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audioio_resampler___exit___obj, 4, 4, audioio_resampler_obj___exit__);
+
+//|     sample_rate: int
+//|     """The sample rate that the sample is converted to in Hertz. (read only)"""
+STATIC mp_obj_t audioio_resampler_obj_get_sample_rate(mp_obj_t self_in) {
+    audioio_resampler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audioio_resampler_get_sample_rate(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_resampler_get_sample_rate_obj, audioio_resampler_obj_get_sample_rate);
+
+MP_PROPERTY_GETTER(audioio_resampler_sample_rate_obj,
+    (mp_obj_t)&audioio_resampler_get_sample_rate_obj);
+
+//|     bits_per_sample: int
+//|     """Bits per sample of the converted output. (read only)"""
+STATIC mp_obj_t audioio_resampler_obj_get_bits_per_sample(mp_obj_t self_in) {
+    audioio_resampler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audioio_resampler_get_bits_per_sample(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_resampler_get_bits_per_sample_obj, audioio_resampler_obj_get_bits_per_sample);
+
+MP_PROPERTY_GETTER(audioio_resampler_bits_per_sample_obj,
+    (mp_obj_t)&audioio_resampler_get_bits_per_sample_obj);
+
+//|     channel_count: int
+//|     """Number of audio channels in the converted output. (read only)"""
+STATIC mp_obj_t audioio_resampler_obj_get_channel_count(mp_obj_t self_in) {
+    audioio_resampler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audioio_resampler_get_channel_count(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_resampler_get_channel_count_obj, audioio_resampler_obj_get_channel_count);
+
+MP_PROPERTY_GETTER(audioio_resampler_channel_count_obj,
+    (mp_obj_t)&audioio_resampler_get_channel_count_obj);
+
+//|     sample: circuitpython_typing.AudioSample
+//|     """The sample being converted. (read only)"""
+//|
+STATIC mp_obj_t audioio_resampler_obj_get_sample(mp_obj_t self_in) {
+    audioio_resampler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return common_hal_audioio_resampler_get_sample(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_resampler_get_sample_obj, audioio_resampler_obj_get_sample);
+
+MP_PROPERTY_GETTER(audioio_resampler_sample_obj,
+    (mp_obj_t)&audioio_resampler_get_sample_obj);
+
+STATIC const mp_rom_map_elem_t audioio_resampler_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioio_resampler_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audioio_resampler___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audioio_resampler_sample_rate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_bits_per_sample), MP_ROM_PTR(&audioio_resampler_bits_per_sample_obj) },
+    { MP_ROM_QSTR(MP_QSTR_channel_count), MP_ROM_PTR(&audioio_resampler_channel_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sample), MP_ROM_PTR(&audioio_resampler_sample_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audioio_resampler_locals_dict, audioio_resampler_locals_dict_table);
+
+STATIC const audiosample_p_t audioio_resampler_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .sample_rate = (audiosample_sample_rate_fun)common_hal_audioio_resampler_get_sample_rate,
+    .bits_per_sample = (audiosample_bits_per_sample_fun)common_hal_audioio_resampler_get_bits_per_sample,
+    .channel_count = (audiosample_channel_count_fun)common_hal_audioio_resampler_get_channel_count,
+    .reset_buffer = (audiosample_reset_buffer_fun)audioio_resampler_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audioio_resampler_get_buffer,
+    .get_buffer_structure = (audiosample_get_buffer_structure_fun)audioio_resampler_get_buffer_structure,
+};
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audioio_resampler_type,
+    MP_QSTR_Resampler,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audioio_resampler_make_new,
+    locals_dict, &audioio_resampler_locals_dict,
+    protocol, &audioio_resampler_proto
+    );
@@ -0,0 +1,45 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOCORE_RESAMPLER_H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOCORE_RESAMPLER_H
+
+#include "shared-module/audiocore/Resampler.h"
+
+extern const mp_obj_type_t audioio_resampler_type;
+
+void common_hal_audioio_resampler_construct(audioio_resampler_obj_t *self,
+    mp_obj_t sample, uint32_t buffer_size, uint8_t bits_per_sample, bool samples_signed,
+    uint8_t channel_count, uint32_t sample_rate, bool polyphase);
+
+void common_hal_audioio_resampler_deinit(audioio_resampler_obj_t *self);
+bool common_hal_audioio_resampler_deinited(audioio_resampler_obj_t *self);
+uint32_t common_hal_audioio_resampler_get_sample_rate(audioio_resampler_obj_t *self);
+uint8_t common_hal_audioio_resampler_get_bits_per_sample(audioio_resampler_obj_t *self);
+uint8_t common_hal_audioio_resampler_get_channel_count(audioio_resampler_obj_t *self);
+mp_obj_t common_hal_audioio_resampler_get_sample(audioio_resampler_obj_t *self);
+
+#endif // MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOCORE_RESAMPLER_H
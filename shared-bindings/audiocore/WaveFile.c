@@ -45,9 +45,11 @@
 //|
 //|         :param Union[str, typing.BinaryIO] file: The name of a wave file (preferred) or an already opened wave file
 //|         :param ~circuitpython_typing.WriteableBuffer buffer: Optional pre-allocated buffer,
-//|           that will be split in half and used for double-buffering of the data.
-//|           The buffer must be 8 to 1024 bytes long.
-//|           If not provided, two 256 byte buffers are initially allocated internally.
+//|           that will be split into buffers of up to 512 bytes. One is played while the
+//|           others are read ahead of playback in the background.
+//|           The buffer must be 8 to 4096 bytes long. Use a larger buffer when playing from
+//|           slow storage such as an SD card.
+//|           If not provided, the internal buffers are 256 or 512 bytes each, depending on the board.
 //|
 //|         Playing a wave file from flash::
 //|
@@ -88,7 +90,7 @@ STATIC mp_obj_t audioio_wavefile_make_new(const mp_obj_type_t *type, size_t n_ar
         mp_buffer_info_t bufinfo;
         mp_get_buffer_raise(args[1], &bufinfo, MP_BUFFER_WRITE);
         buffer = bufinfo.buf;
-        buffer_size = mp_arg_validate_length_range(bufinfo.len, 8, 1024, MP_QSTR_buffer);
+        buffer_size = mp_arg_validate_length_range(bufinfo.len, 8, 512 * AUDIOIO_WAVEFILE_MAX_BUFFERS, MP_QSTR_buffer);
     }
     common_hal_audioio_wavefile_construct(self, MP_OBJ_TO_PTR(arg),
         buffer, buffer_size);
@@ -175,6 +177,21 @@ MP_DEFINE_CONST_FUN_OBJ_1(audioio_wavefile_get_channel_count_obj, audioio_wavefi
 MP_PROPERTY_GETTER(audioio_wavefile_channel_count_obj,
     (mp_obj_t)&audioio_wavefile_get_channel_count_obj);
 
+//|     underruns: int
+//|     """Number of times the audio output needed data before it had been read ahead
+//|     from the file. Each one may be heard as a glitch. If this keeps increasing,
+//|     give the WaveFile a larger buffer. (read only)"""
+//|
+STATIC mp_obj_t audioio_wavefile_obj_get_underruns(mp_obj_t self_in) {
+    audioio_wavefile_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_audioio_wavefile_get_underruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_wavefile_get_underruns_obj, audioio_wavefile_obj_get_underruns);
+
+MP_PROPERTY_GETTER(audioio_wavefile_underruns_obj,
+    (mp_obj_t)&audioio_wavefile_get_underruns_obj);
+
 
 STATIC const mp_rom_map_elem_t audioio_wavefile_locals_dict_table[] = {
     // Methods
@@ -186,6 +203,7 @@ STATIC const mp_rom_map_elem_t audioio_wavefile_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audioio_wavefile_sample_rate_obj) },
     { MP_ROM_QSTR(MP_QSTR_bits_per_sample), MP_ROM_PTR(&audioio_wavefile_bits_per_sample_obj) },
     { MP_ROM_QSTR(MP_QSTR_channel_count), MP_ROM_PTR(&audioio_wavefile_channel_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audioio_wavefile_underruns_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(audioio_wavefile_locals_dict, audioio_wavefile_locals_dict_table);
 
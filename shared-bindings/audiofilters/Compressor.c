@@ -0,0 +1,243 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/audiofilters/Compressor.h"
+
+STATIC mp_float_t validate_threshold(mp_obj_t threshold_in, mp_float_t default_value) {
+    if (threshold_in == MP_OBJ_NULL) {
+        return default_value;
+    }
+    return mp_arg_validate_obj_float_range(threshold_in, 0, 1, MP_QSTR_threshold);
+}
+
+STATIC mp_float_t validate_ratio(mp_obj_t ratio_in, mp_float_t default_value) {
+    if (ratio_in == MP_OBJ_NULL) {
+        return default_value;
+    }
+    return mp_arg_validate_obj_float_range(ratio_in, 1, 100, MP_QSTR_ratio);
+}
+
+//| class Compressor:
+//|     """Turns down the loud parts of a sample"""
+//|
+//|     def __init__(
+//|         self,
+//|         sample: circuitpython_typing.AudioSample,
+//|         *,
+//|         threshold: float = 0.5,
+//|         ratio: float = 4.0,
+//|         attack_time: float = 0.005,
+//|         release_time: float = 0.1,
+//|         buffer_size: int = 512,
+//|     ) -> None:
+//|         """Create a Compressor that reduces how far ``sample`` goes over ``threshold`` by ``ratio``.
+//|
+//|         The level is followed with the peak of each 32 frames and
+//|         the gain changes smoothly over each of those blocks.
+//|
+//|         :param ~circuitpython_typing.AudioSample sample: The sample to process. It must have
+//|           one or two channels of 8 or 16 bit samples.
+//|         :param float threshold: The level above which the sample is compressed, from 0 to 1
+//|           of full scale
+//|         :param float ratio: How much the level over the threshold is divided by, from 1 to 100
+//|         :param float attack_time: The time in seconds to follow a rise in level
+//|         :param float release_time: The time in seconds to follow a fall in level
+//|         :param int buffer_size: The total size in bytes of the buffers to process into"""
+//|         ...
+STATIC mp_obj_t audiofilters_compressor_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_sample, ARG_threshold, ARG_ratio, ARG_attack_time, ARG_release_time, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_threshold, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_ratio, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_attack_time, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_release_time, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 512} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_float_t threshold = validate_threshold(args[ARG_threshold].u_obj, MICROPY_FLOAT_CONST(0.5));
+    mp_float_t ratio = validate_ratio(args[ARG_ratio].u_obj, MICROPY_FLOAT_CONST(4.0));
+    mp_float_t attack_time = mp_arg_validate_obj_float_non_negative(args[ARG_attack_time].u_obj, MICROPY_FLOAT_CONST(0.005), MP_QSTR_attack_time);
+    mp_float_t release_time = mp_arg_validate_obj_float_non_negative(args[ARG_release_time].u_obj, MICROPY_FLOAT_CONST(0.1), MP_QSTR_release_time);
+    mp_int_t buffer_size = mp_arg_validate_int_min(args[ARG_buffer_size].u_int, 4, MP_QSTR_buffer_size);
+
+    audiofilters_compressor_obj_t *self = mp_obj_malloc(audiofilters_compressor_obj_t, &audiofilters_compressor_type);
+    common_hal_audiofilters_compressor_construct(self, args[ARG_sample].u_obj, buffer_size,
+        threshold, ratio, attack_time, release_time);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Compressor and releases its buffers. The wrapped sample is not
+//|         deinitialised."""
+//|         ...
+//  Provided by audiofilters_effect_deinit_obj.
+
+//|     def __enter__(self) -> Compressor:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the hardware when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//  Provided by audiofilters_effect___exit___obj.
+
+//|     sample: circuitpython_typing.AudioSample
+//|     """The sample being processed. (read only)"""
+//  Provided by audiofilters_effect_sample_obj.
+
+//|     threshold: float
+//|     """The level above which the sample is compressed, from 0 to 1 of full scale."""
+STATIC mp_obj_t audiofilters_compressor_obj_get_threshold(mp_obj_t self_in) {
+    audiofilters_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_check_for_deinit(&self->effect);
+    return mp_obj_new_float(common_hal_audiofilters_compressor_get_threshold(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofilters_compressor_get_threshold_obj, audiofilters_compressor_obj_get_threshold);
+
+STATIC mp_obj_t audiofilters_compressor_obj_set_threshold(mp_obj_t self_in, mp_obj_t threshold_in) {
+    audiofilters_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_check_for_deinit(&self->effect);
+    common_hal_audiofilters_compressor_set_threshold(self, validate_threshold(threshold_in, 0));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofilters_compressor_set_threshold_obj, audiofilters_compressor_obj_set_threshold);
+
+MP_PROPERTY_GETSET(audiofilters_compressor_threshold_obj,
+    (mp_obj_t)&audiofilters_compressor_get_threshold_obj,
+    (mp_obj_t)&audiofilters_compressor_set_threshold_obj);
+
+//|     ratio: float
+//|     """How much the level over the threshold is divided by, from 1 to 100."""
+STATIC mp_obj_t audiofilters_compressor_obj_get_ratio(mp_obj_t self_in) {
+    audiofilters_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_check_for_deinit(&self->effect);
+    return mp_obj_new_float(common_hal_audiofilters_compressor_get_ratio(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofilters_compressor_get_ratio_obj, audiofilters_compressor_obj_get_ratio);
+
+STATIC mp_obj_t audiofilters_compressor_obj_set_ratio(mp_obj_t self_in, mp_obj_t ratio_in) {
+    audiofilters_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_check_for_deinit(&self->effect);
+    common_hal_audiofilters_compressor_set_ratio(self, validate_ratio(ratio_in, 0));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofilters_compressor_set_ratio_obj, audiofilters_compressor_obj_set_ratio);
+
+MP_PROPERTY_GETSET(audiofilters_compressor_ratio_obj,
+    (mp_obj_t)&audiofilters_compressor_get_ratio_obj,
+    (mp_obj_t)&audiofilters_compressor_set_ratio_obj);
+
+//|     attack_time: float
+//|     """The time in seconds to follow a rise in level."""
+STATIC mp_obj_t audiofilters_compressor_obj_get_attack_time(mp_obj_t self_in) {
+    audiofilters_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_check_for_deinit(&self->effect);
+    return mp_obj_new_float(common_hal_audiofilters_compressor_get_attack_time(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofilters_compressor_get_attack_time_obj, audiofilters_compressor_obj_get_attack_time);
+
+STATIC mp_obj_t audiofilters_compressor_obj_set_attack_time(mp_obj_t self_in, mp_obj_t attack_time_in) {
+    audiofilters_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_check_for_deinit(&self->effect);
+    common_hal_audiofilters_compressor_set_attack_time(self, mp_arg_validate_obj_float_non_negative(attack_time_in, 0, MP_QSTR_attack_time));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofilters_compressor_set_attack_time_obj, audiofilters_compressor_obj_set_attack_time);
+
+MP_PROPERTY_GETSET(audiofilters_compressor_attack_time_obj,
+    (mp_obj_t)&audiofilters_compressor_get_attack_time_obj,
+    (mp_obj_t)&audiofilters_compressor_set_attack_time_obj);
+
+//|     release_time: float
+//|     """The time in seconds to follow a fall in level."""
+STATIC mp_obj_t audiofilters_compressor_obj_get_release_time(mp_obj_t self_in) {
+    audiofilters_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_check_for_deinit(&self->effect);
+    return mp_obj_new_float(common_hal_audiofilters_compressor_get_release_time(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofilters_compressor_get_release_time_obj, audiofilters_compressor_obj_get_release_time);
+
+STATIC mp_obj_t audiofilters_compressor_obj_set_release_time(mp_obj_t self_in, mp_obj_t release_time_in) {
+    audiofilters_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_check_for_deinit(&self->effect);
+    common_hal_audiofilters_compressor_set_release_time(self, mp_arg_validate_obj_float_non_negative(release_time_in, 0, MP_QSTR_release_time));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofilters_compressor_set_release_time_obj, audiofilters_compressor_obj_set_release_time);
+
+MP_PROPERTY_GETSET(audiofilters_compressor_release_time_obj,
+    (mp_obj_t)&audiofilters_compressor_get_release_time_obj,
+    (mp_obj_t)&audiofilters_compressor_set_release_time_obj);
+
+//|     gain: float
+//|     """The gain being applied, from 0 to 1. 1 means the sample is not being compressed.
+//|     (read only)"""
+//|
+STATIC mp_obj_t audiofilters_compressor_obj_get_gain(mp_obj_t self_in) {
+    audiofilters_compressor_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_check_for_deinit(&self->effect);
+    return mp_obj_new_float(common_hal_audiofilters_compressor_get_gain(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofilters_compressor_get_gain_obj, audiofilters_compressor_obj_get_gain);
+
+MP_PROPERTY_GETTER(audiofilters_compressor_gain_obj,
+    (mp_obj_t)&audiofilters_compressor_get_gain_obj);
+
+STATIC const mp_rom_map_elem_t audiofilters_compressor_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiofilters_effect_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiofilters_effect___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_sample), MP_ROM_PTR(&audiofilters_effect_sample_obj) },
+    { MP_ROM_QSTR(MP_QSTR_threshold), MP_ROM_PTR(&audiofilters_compressor_threshold_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ratio), MP_ROM_PTR(&audiofilters_compressor_ratio_obj) },
+    { MP_ROM_QSTR(MP_QSTR_attack_time), MP_ROM_PTR(&audiofilters_compressor_attack_time_obj) },
+    { MP_ROM_QSTR(MP_QSTR_release_time), MP_ROM_PTR(&audiofilters_compressor_release_time_obj) },
+    { MP_ROM_QSTR(MP_QSTR_gain), MP_ROM_PTR(&audiofilters_compressor_gain_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audiofilters_compressor_locals_dict, audiofilters_compressor_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audiofilters_compressor_type,
+    MP_QSTR_Compressor,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audiofilters_compressor_make_new,
+    locals_dict, &audiofilters_compressor_locals_dict,
+    protocol, &audiofilters_effect_proto
+    );
@@ -0,0 +1,179 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/audiofilters/Echo.h"
+
+STATIC mp_float_t validate_delay(mp_obj_t delay_in, mp_float_t default_value, qstr arg_name) {
+    if (delay_in == MP_OBJ_NULL) {
+        return default_value;
+    }
+    return mp_arg_validate_obj_float_range(delay_in, 0, 10, arg_name);
+}
+
+STATIC mp_float_t validate_decay(mp_obj_t decay_in, mp_float_t default_value) {
+    if (decay_in == MP_OBJ_NULL) {
+        return default_value;
+    }
+    return mp_arg_validate_obj_float_range(decay_in, 0, 1, MP_QSTR_decay);
+}
+
+//| class Echo:
+//|     """Repeats a sample after a delay, quieter each time"""
+//|
+//|     def __init__(
+//|         self,
+//|         sample: circuitpython_typing.AudioSample,
+//|         *,
+//|         max_delay: float = 0.5,
+//|         delay: float = 0.25,
+//|         decay: float = 0.5,
+//|         buffer_size: int = 512,
+//|     ) -> None:
+//|         """Create an Echo that adds the output from ``delay`` seconds ago, scaled by ``decay``,
+//|         to ``sample``.
+//|
+//|         :param ~circuitpython_typing.AudioSample sample: The sample to process. It must have
+//|           one or two channels of 8 or 16 bit samples.
+//|         :param float max_delay: The longest delay in seconds. Two bytes of memory are used
+//|           for each sample in this time.
+//|         :param float delay: The delay in seconds
+//|         :param float decay: How loud each echo is compared to the one before, from 0 to 1
+//|         :param int buffer_size: The total size in bytes of the buffers to process into"""
+//|         ...
+STATIC mp_obj_t audiofilters_echo_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_sample, ARG_max_delay, ARG_delay, ARG_decay, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_max_delay, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_delay, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_decay, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 512} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_float_t max_delay = validate_delay(args[ARG_max_delay].u_obj, MICROPY_FLOAT_CONST(0.5), MP_QSTR_max_delay);
+    mp_float_t delay = validate_delay(args[ARG_delay].u_obj, MICROPY_FLOAT_CONST(0.25), MP_QSTR_delay);
+    mp_float_t decay = validate_decay(args[ARG_decay].u_obj, MICROPY_FLOAT_CONST(0.5));
+    mp_int_t buffer_size = mp_arg_validate_int_min(args[ARG_buffer_size].u_int, 4, MP_QSTR_buffer_size);
+
+    audiofilters_echo_obj_t *self = mp_obj_malloc(audiofilters_echo_obj_t, &audiofilters_echo_type);
+    common_hal_audiofilters_echo_construct(self, args[ARG_sample].u_obj, buffer_size, max_delay, delay, decay);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Echo and releases its buffers. The wrapped sample is not
+//|         deinitialised."""
+//|         ...
+//  Provided by audiofilters_effect_deinit_obj.
+
+//|     def __enter__(self) -> Echo:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the hardware when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//  Provided by audiofilters_effect___exit___obj.
+
+//|     sample: circuitpython_typing.AudioSample
+//|     """The sample being processed. (read only)"""
+//  Provided by audiofilters_effect_sample_obj.
+
+//|     delay: float
+//|     """The delay in seconds. It can't be longer than the ``max_delay`` given to the
+//|     constructor. Changing it clears the echoes so far."""
+STATIC mp_obj_t audiofilters_echo_obj_get_delay(mp_obj_t self_in) {
+    audiofilters_echo_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_check_for_deinit(&self->effect);
+    return mp_obj_new_float(common_hal_audiofilters_echo_get_delay(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofilters_echo_get_delay_obj, audiofilters_echo_obj_get_delay);
+
+STATIC mp_obj_t audiofilters_echo_obj_set_delay(mp_obj_t self_in, mp_obj_t delay_in) {
+    audiofilters_echo_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_check_for_deinit(&self->effect);
+    common_hal_audiofilters_echo_set_delay(self, validate_delay(delay_in, 0, MP_QSTR_delay));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofilters_echo_set_delay_obj, audiofilters_echo_obj_set_delay);
+
+MP_PROPERTY_GETSET(audiofilters_echo_delay_obj,
+    (mp_obj_t)&audiofilters_echo_get_delay_obj,
+    (mp_obj_t)&audiofilters_echo_set_delay_obj);
+
+//|     decay: float
+//|     """How loud each echo is compared to the one before, from 0 to 1."""
+//|
+STATIC mp_obj_t audiofilters_echo_obj_get_decay(mp_obj_t self_in) {
+    audiofilters_echo_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_check_for_deinit(&self->effect);
+    return mp_obj_new_float(common_hal_audiofilters_echo_get_decay(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofilters_echo_get_decay_obj, audiofilters_echo_obj_get_decay);
+
+STATIC mp_obj_t audiofilters_echo_obj_set_decay(mp_obj_t self_in, mp_obj_t decay_in) {
+    audiofilters_echo_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_check_for_deinit(&self->effect);
+    common_hal_audiofilters_echo_set_decay(self, validate_decay(decay_in, 0));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofilters_echo_set_decay_obj, audiofilters_echo_obj_set_decay);
+
+MP_PROPERTY_GETSET(audiofilters_echo_decay_obj,
+    (mp_obj_t)&audiofilters_echo_get_decay_obj,
+    (mp_obj_t)&audiofilters_echo_set_decay_obj);
+
+STATIC const mp_rom_map_elem_t audiofilters_echo_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiofilters_effect_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiofilters_effect___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_sample), MP_ROM_PTR(&audiofilters_effect_sample_obj) },
+    { MP_ROM_QSTR(MP_QSTR_delay), MP_ROM_PTR(&audiofilters_echo_delay_obj) },
+    { MP_ROM_QSTR(MP_QSTR_decay), MP_ROM_PTR(&audiofilters_echo_decay_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audiofilters_echo_locals_dict, audiofilters_echo_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audiofilters_echo_type,
+    MP_QSTR_Echo,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audiofilters_echo_make_new,
+    locals_dict, &audiofilters_echo_locals_dict,
+    protocol, &audiofilters_effect_proto
+    );
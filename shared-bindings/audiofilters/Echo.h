@@ -0,0 +1,40 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "shared-bindings/audiofilters/__init__.h"
+#include "shared-module/audiofilters/Echo.h"
+
+extern const mp_obj_type_t audiofilters_echo_type;
+
+void common_hal_audiofilters_echo_construct(audiofilters_echo_obj_t *self,
+    mp_obj_t sample, uint32_t buffer_size, mp_float_t max_delay, mp_float_t delay, mp_float_t decay);
+
+mp_float_t common_hal_audiofilters_echo_get_delay(audiofilters_echo_obj_t *self);
+void common_hal_audiofilters_echo_set_delay(audiofilters_echo_obj_t *self, mp_float_t delay);
+mp_float_t common_hal_audiofilters_echo_get_decay(audiofilters_echo_obj_t *self);
+void common_hal_audiofilters_echo_set_decay(audiofilters_echo_obj_t *self, mp_float_t decay);
@@ -0,0 +1,133 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/audiofilters/Filter.h"
+
+//| class Filter:
+//|     """Applies a biquad filter to a sample"""
+//|
+//|     def __init__(
+//|         self,
+//|         sample: circuitpython_typing.AudioSample,
+//|         *,
+//|         filter: Optional[synthio.Biquad] = None,
+//|         buffer_size: int = 512,
+//|     ) -> None:
+//|         """Create a Filter that passes ``sample`` through ``filter``. Each channel is filtered
+//|         separately.
+//|
+//|         :param ~circuitpython_typing.AudioSample sample: The sample to process. It must have
+//|           one or two channels of 8 or 16 bit samples.
+//|         :param Optional[synthio.Biquad] filter: The filter to apply, such as one from
+//|           `synthio.Synthesizer.low_pass_filter`. None passes the sample through unchanged.
+//|         :param int buffer_size: The total size in bytes of the buffers to process into"""
+//|         ...
+STATIC mp_obj_t audiofilters_filter_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_sample, ARG_filter, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_filter, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 512} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t buffer_size = mp_arg_validate_int_min(args[ARG_buffer_size].u_int, 4, MP_QSTR_buffer_size);
+
+    audiofilters_filter_obj_t *self = mp_obj_malloc(audiofilters_filter_obj_t, &audiofilters_filter_type);
+    common_hal_audiofilters_filter_construct(self, args[ARG_sample].u_obj, buffer_size, args[ARG_filter].u_obj);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the Filter and releases its buffers. The wrapped sample is not
+//|         deinitialised."""
+//|         ...
+//  Provided by audiofilters_effect_deinit_obj.
+
+//|     def __enter__(self) -> Filter:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the hardware when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//  Provided by audiofilters_effect___exit___obj.
+
+//|     sample: circuitpython_typing.AudioSample
+//|     """The sample being processed. (read only)"""
+//  Provided by audiofilters_effect_sample_obj.
+
+//|     filter: Optional[synthio.Biquad]
+//|     """The filter to apply, or None to pass the sample through unchanged."""
+//|
+STATIC mp_obj_t audiofilters_filter_obj_get_filter(mp_obj_t self_in) {
+    audiofilters_filter_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_check_for_deinit(&self->effect);
+    return common_hal_audiofilters_filter_get_filter(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofilters_filter_get_filter_obj, audiofilters_filter_obj_get_filter);
+
+STATIC mp_obj_t audiofilters_filter_obj_set_filter(mp_obj_t self_in, mp_obj_t filter_in) {
+    audiofilters_filter_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_check_for_deinit(&self->effect);
+    common_hal_audiofilters_filter_set_filter(self, filter_in);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofilters_filter_set_filter_obj, audiofilters_filter_obj_set_filter);
+
+MP_PROPERTY_GETSET(audiofilters_filter_filter_obj,
+    (mp_obj_t)&audiofilters_filter_get_filter_obj,
+    (mp_obj_t)&audiofilters_filter_set_filter_obj);
+
+STATIC const mp_rom_map_elem_t audiofilters_filter_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiofilters_effect_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiofilters_effect___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_sample), MP_ROM_PTR(&audiofilters_effect_sample_obj) },
+    { MP_ROM_QSTR(MP_QSTR_filter), MP_ROM_PTR(&audiofilters_filter_filter_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audiofilters_filter_locals_dict, audiofilters_filter_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audiofilters_filter_type,
+    MP_QSTR_Filter,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audiofilters_filter_make_new,
+    locals_dict, &audiofilters_filter_locals_dict,
+    protocol, &audiofilters_effect_proto
+    );
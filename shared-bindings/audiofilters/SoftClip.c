@@ -0,0 +1,137 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/audiofilters/SoftClip.h"
+
+STATIC mp_float_t validate_drive(mp_obj_t drive_in, mp_float_t default_value) {
+    if (drive_in == MP_OBJ_NULL) {
+        return default_value;
+    }
+    return mp_arg_validate_obj_float_range(drive_in, 0, 8, MP_QSTR_drive);
+}
+
+//| class SoftClip:
+//|     """Limits a sample to full scale with a gentle curve instead of harsh clipping"""
+//|
+//|     def __init__(
+//|         self, sample: circuitpython_typing.AudioSample, *, drive: float = 1.0, buffer_size: int = 512
+//|     ) -> None:
+//|         """Create a SoftClip that amplifies ``sample`` by ``drive`` and then bends it smoothly
+//|         into full scale. Quiet parts are amplified by ``drive`` and loud parts are rounded off
+//|         rather than clipped, which adds warm distortion as ``drive`` goes up.
+//|
+//|         :param ~circuitpython_typing.AudioSample sample: The sample to process. It must have
+//|           one or two channels of 8 or 16 bit samples.
+//|         :param float drive: The gain before clipping, from 0 to 8
+//|         :param int buffer_size: The total size in bytes of the buffers to process into"""
+//|         ...
+STATIC mp_obj_t audiofilters_softclip_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_sample, ARG_drive, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_drive, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 512} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_float_t drive = validate_drive(args[ARG_drive].u_obj, MICROPY_FLOAT_CONST(1.0));
+    mp_int_t buffer_size = mp_arg_validate_int_min(args[ARG_buffer_size].u_int, 4, MP_QSTR_buffer_size);
+
+    audiofilters_softclip_obj_t *self = mp_obj_malloc(audiofilters_softclip_obj_t, &audiofilters_softclip_type);
+    common_hal_audiofilters_softclip_construct(self, args[ARG_sample].u_obj, buffer_size, drive);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def deinit(self) -> None:
+//|         """Deinitialises the SoftClip and releases its buffers. The wrapped sample is not
+//|         deinitialised."""
+//|         ...
+//  Provided by audiofilters_effect_deinit_obj.
+
+//|     def __enter__(self) -> SoftClip:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically deinitializes the hardware when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+//  Provided by audiofilters_effect___exit___obj.
+
+//|     sample: circuitpython_typing.AudioSample
+//|     """The sample being processed. (read only)"""
+//  Provided by audiofilters_effect_sample_obj.
+
+//|     drive: float
+//|     """The gain before clipping, from 0 to 8."""
+//|
+STATIC mp_obj_t audiofilters_softclip_obj_get_drive(mp_obj_t self_in) {
+    audiofilters_softclip_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_check_for_deinit(&self->effect);
+    return mp_obj_new_float(common_hal_audiofilters_softclip_get_drive(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofilters_softclip_get_drive_obj, audiofilters_softclip_obj_get_drive);
+
+STATIC mp_obj_t audiofilters_softclip_obj_set_drive(mp_obj_t self_in, mp_obj_t drive_in) {
+    audiofilters_softclip_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_check_for_deinit(&self->effect);
+    common_hal_audiofilters_softclip_set_drive(self, validate_drive(drive_in, 0));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audiofilters_softclip_set_drive_obj, audiofilters_softclip_obj_set_drive);
+
+MP_PROPERTY_GETSET(audiofilters_softclip_drive_obj,
+    (mp_obj_t)&audiofilters_softclip_get_drive_obj,
+    (mp_obj_t)&audiofilters_softclip_set_drive_obj);
+
+STATIC const mp_rom_map_elem_t audiofilters_softclip_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiofilters_effect_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiofilters_effect___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_sample), MP_ROM_PTR(&audiofilters_effect_sample_obj) },
+    { MP_ROM_QSTR(MP_QSTR_drive), MP_ROM_PTR(&audiofilters_softclip_drive_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audiofilters_softclip_locals_dict, audiofilters_softclip_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    audiofilters_softclip_type,
+    MP_QSTR_SoftClip,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, audiofilters_softclip_make_new,
+    locals_dict, &audiofilters_softclip_locals_dict,
+    protocol, &audiofilters_effect_proto
+    );
@@ -0,0 +1,117 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/util.h"
+#include "shared-bindings/audiofilters/__init__.h"
+#include "shared-bindings/audiofilters/Compressor.h"
+#include "shared-bindings/audiofilters/Echo.h"
+#include "shared-bindings/audiofilters/Filter.h"
+#include "shared-bindings/audiofilters/SoftClip.h"
+
+//| """Audio effects that process another sample while it plays
+//|
+//| Each effect wraps an audio sample and changes each buffer of it in place, in
+//| the sample's own format. The wrapped sample can be another effect so that
+//| effects can be chained, or an `audiomixer.Mixer` to process everything it
+//| plays. The effects end when the wrapped sample does.
+//|
+//| Chaining a filter and an echo on a wave file::
+//|
+//|   import audiocore
+//|   import audiofilters
+//|   import audiopwmio
+//|   import board
+//|   import synthio
+//|
+//|   audio = audiopwmio.PWMAudioOut(board.A0)
+//|   wave = audiocore.WaveFile(open("drums.wav", "rb"))
+//|   synth = synthio.Synthesizer(sample_rate=wave.sample_rate)
+//|   lpf = audiofilters.Filter(wave, filter=synth.low_pass_filter(2000))
+//|   echo = audiofilters.Echo(lpf, delay=0.2, decay=0.4)
+//|   audio.play(echo)
+//| """
+
+STATIC mp_obj_t audiofilters_effect_obj_deinit(mp_obj_t self_in) {
+    audiofilters_effect_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_deinit(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofilters_effect_deinit_obj, audiofilters_effect_obj_deinit);
+
+void audiofilters_effect_check_for_deinit(audiofilters_effect_t *self) {
+    if (audiofilters_effect_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+STATIC mp_obj_t audiofilters_effect_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    audiofilters_effect_deinit(MP_OBJ_TO_PTR(args[0]));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiofilters_effect___exit___obj, 4, 4, audiofilters_effect_obj___exit__);
+
+STATIC mp_obj_t audiofilters_effect_obj_get_sample(mp_obj_t self_in) {
+    audiofilters_effect_t *self = MP_OBJ_TO_PTR(self_in);
+    audiofilters_effect_check_for_deinit(self);
+    return self->sample;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiofilters_effect_get_sample_obj, audiofilters_effect_obj_get_sample);
+
+MP_PROPERTY_GETTER(audiofilters_effect_sample_obj,
+    (mp_obj_t)&audiofilters_effect_get_sample_obj);
+
+const audiosample_p_t audiofilters_effect_proto = {
+    MP_PROTO_IMPLEMENT(MP_QSTR_protocol_audiosample)
+    .sample_rate = (audiosample_sample_rate_fun)audiofilters_effect_get_sample_rate,
+    .bits_per_sample = (audiosample_bits_per_sample_fun)audiofilters_effect_get_bits_per_sample,
+    .channel_count = (audiosample_channel_count_fun)audiofilters_effect_get_channel_count,
+    .reset_buffer = (audiosample_reset_buffer_fun)audiofilters_effect_reset_buffer,
+    .get_buffer = (audiosample_get_buffer_fun)audiofilters_effect_get_buffer,
+    .get_buffer_structure = (audiosample_get_buffer_structure_fun)audiofilters_effect_get_buffer_structure,
+};
+
+STATIC const mp_rom_map_elem_t audiofilters_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audiofilters) },
+    { MP_ROM_QSTR(MP_QSTR_Compressor), MP_ROM_PTR(&audiofilters_compressor_type) },
+    { MP_ROM_QSTR(MP_QSTR_Echo), MP_ROM_PTR(&audiofilters_echo_type) },
+    { MP_ROM_QSTR(MP_QSTR_Filter), MP_ROM_PTR(&audiofilters_filter_type) },
+    { MP_ROM_QSTR(MP_QSTR_SoftClip), MP_ROM_PTR(&audiofilters_softclip_type) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(audiofilters_module_globals, audiofilters_module_globals_table);
+
+const mp_obj_module_t audiofilters_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t *)&audiofilters_module_globals,
+};
+
+MP_REGISTER_MODULE(MP_QSTR_audiofilters, audiofilters_module);
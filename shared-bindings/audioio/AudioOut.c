@@ -152,7 +152,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audioio_audioout___exit___obj, 4, 4,
 //|         """Plays the sample once when loop=False and continuously when loop=True.
 //|         Does not block. Use `playing` to block.
 //|
-//|         Sample must be an `audiocore.WaveFile`, `audiocore.RawSample`, `audiomixer.Mixer` or `audiomp3.MP3Decoder`.
+//|         Sample must be an `audiocore.WaveFile`, `audiocore.RawSample`, `audiocore.Resampler`, `audiomixer.Mixer` or `audiomp3.MP3Decoder`.
 //|
 //|         The sample itself should consist of 16 bit samples. Microcontrollers with a lower output
 //|         resolution will use the highest order bits to output. For example, the SAMD21 has a 10 bit
@@ -231,7 +231,6 @@ MP_DEFINE_CONST_FUN_OBJ_1(audioio_audioout_resume_obj, audioio_audioout_obj_resu
 
 //|     paused: bool
 //|     """True when playback is paused. (read-only)"""
-//|
 STATIC mp_obj_t audioio_audioout_obj_get_paused(mp_obj_t self_in) {
     audioio_audioout_obj_t *self = MP_OBJ_TO_PTR(self_in);
     check_for_deinit(self);
@@ -242,6 +241,30 @@ MP_DEFINE_CONST_FUN_OBJ_1(audioio_audioout_get_paused_obj, audioio_audioout_obj_
 MP_PROPERTY_GETTER(audioio_audioout_paused_obj,
     (mp_obj_t)&audioio_audioout_get_paused_obj);
 
+// Ports that don't count underruns report None.
+MP_WEAK mp_int_t common_hal_audioio_audioout_get_underruns(audioio_audioout_obj_t *self) {
+    return -1;
+}
+
+//|     underruns: Optional[int]
+//|     """The number of times the output ran out of samples to play, since the
+//|     last `play`. This happens when other work delays refilling the buffers.
+//|     None when the port doesn't count them. (read-only)"""
+//|
+STATIC mp_obj_t audioio_audioout_obj_get_underruns(mp_obj_t self_in) {
+    audioio_audioout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_int_t underruns = common_hal_audioio_audioout_get_underruns(self);
+    if (underruns < 0) {
+        return mp_const_none;
+    }
+    return mp_obj_new_int_from_uint(underruns);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_audioout_get_underruns_obj, audioio_audioout_obj_get_underruns);
+
+MP_PROPERTY_GETTER(audioio_audioout_underruns_obj,
+    (mp_obj_t)&audioio_audioout_get_underruns_obj);
+
 STATIC const mp_rom_map_elem_t audioio_audioout_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioio_audioout_deinit_obj) },
@@ -255,6 +278,7 @@ STATIC const mp_rom_map_elem_t audioio_audioout_locals_dict_table[] = {
     // Properties
     { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&audioio_audioout_playing_obj) },
     { MP_ROM_QSTR(MP_QSTR_paused), MP_ROM_PTR(&audioio_audioout_paused_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audioio_audioout_underruns_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(audioio_audioout_locals_dict, audioio_audioout_locals_dict_table);
 
@@ -45,5 +45,6 @@ bool common_hal_audioio_audioout_get_playing(audioio_audioout_obj_t *self);
 void common_hal_audioio_audioout_pause(audioio_audioout_obj_t *self);
 void common_hal_audioio_audioout_resume(audioio_audioout_obj_t *self);
 bool common_hal_audioio_audioout_get_paused(audioio_audioout_obj_t *self);
+mp_int_t common_hal_audioio_audioout_get_underruns(audioio_audioout_obj_t *self);
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOIO_AUDIOOUT_H
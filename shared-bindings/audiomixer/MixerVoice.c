@@ -56,9 +56,10 @@ STATIC mp_obj_t audiomixer_mixervoice_make_new(const mp_obj_type_t *type, size_t
 //|         """Plays the sample once when ``loop=False``, and continuously when ``loop=True``.
 //|         Does not block. Use `playing` to block.
 //|
-//|         Sample must be an `audiocore.WaveFile`, `audiocore.RawSample`, `audiomixer.Mixer` or `audiomp3.MP3Decoder`.
+//|         Sample must be an `audiocore.WaveFile`, `audiocore.RawSample`, `audiocore.Resampler`, `audiomixer.Mixer` or `audiomp3.MP3Decoder`.
 //|
 //|         The sample must match the `audiomixer.Mixer`'s encoding settings given in the constructor.
+//|         Use an `audiocore.Resampler` to play a sample that doesn't.
 //|         """
 //|         ...
 STATIC mp_obj_t audiomixer_mixervoice_obj_play(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
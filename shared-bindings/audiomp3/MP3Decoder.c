@@ -43,10 +43,12 @@
 //|         https://learn.adafruit.com/Memory-saving-tips-for-CircuitPython/reducing-memory-fragmentation
 //|     """
 //|
-//|     def __init__(self, file: Union[str, typing.BinaryIO], buffer: WriteableBuffer) -> None:
+//|     def __init__(
+//|         self, file: Union[str, typing.BinaryIO, ReadableBuffer], buffer: WriteableBuffer
+//|     ) -> None:
 //|         """Load a .mp3 file for playback with `audioio.AudioOut` or `audiobusio.I2SOut`.
 //|
-//|         :param Union[str, typing.BinaryIO] file: The name of a mp3 file (preferred) or an already opened mp3 file
+//|         :param Union[str, typing.BinaryIO, ~circuitpython_typing.ReadableBuffer] file: The name of a mp3 file (preferred), an already opened mp3 file, or a buffer holding the whole mp3 file. A buffer, such as a `memorymap.AddressRange` over memory-mapped flash, is decoded in place without the 2kB input buffer or any file reads. On microcontrollers with a spare core, such as the RP2040, a buffer is also decoded on that core while it plays.
 //|         :param ~circuitpython_typing.WriteableBuffer buffer: Optional pre-allocated buffer, that will be split in half and used for double-buffering of the data. If not provided, two buffers are allocated internally.  The specific buffer size required depends on the mp3 file.
 //|
 //|         Playback of mp3 audio is CPU intensive, and the
@@ -86,6 +88,14 @@
 //|         """
 //|         ...
 
+STATIC void validate_source(mp_obj_t source) {
+    mp_buffer_info_t bufinfo;
+    if (!mp_obj_is_type(source, &mp_type_fileio) &&
+        !mp_get_buffer(source, &bufinfo, MP_BUFFER_READ)) {
+        mp_raise_TypeError(MP_ERROR_TEXT("file must be a file opened in byte mode"));
+    }
+}
+
 STATIC mp_obj_t audiomp3_mp3file_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
     mp_arg_check_num(n_args, n_kw, 1, 2, false);
     mp_obj_t arg = args[0];
@@ -94,10 +104,8 @@ STATIC mp_obj_t audiomp3_mp3file_make_new(const mp_obj_type_t *type, size_t n_ar
         arg = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_builtin_open_obj), arg, MP_ROM_QSTR(MP_QSTR_rb));
     }
 
+    validate_source(arg);
     audiomp3_mp3file_obj_t *self = mp_obj_malloc(audiomp3_mp3file_obj_t, &audiomp3_mp3file_type);
-    if (!mp_obj_is_type(arg, &mp_type_fileio)) {
-        mp_raise_TypeError(MP_ERROR_TEXT("file must be a file opened in byte mode"));
-    }
     uint8_t *buffer = NULL;
     size_t buffer_size = 0;
     if (n_args >= 2) {
@@ -106,8 +114,7 @@ STATIC mp_obj_t audiomp3_mp3file_make_new(const mp_obj_type_t *type, size_t n_ar
         buffer = bufinfo.buf;
         buffer_size = bufinfo.len;
     }
-    common_hal_audiomp3_mp3file_construct(self, MP_OBJ_TO_PTR(arg),
-        buffer, buffer_size);
+    common_hal_audiomp3_mp3file_construct(self, arg, buffer, buffer_size);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -144,21 +151,19 @@ STATIC mp_obj_t audiomp3_mp3file_obj___exit__(size_t n_args, const mp_obj_t *arg
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiomp3_mp3file___exit___obj, 4, 4, audiomp3_mp3file_obj___exit__);
 
-//|     file: typing.BinaryIO
-//|     """File to play back."""
+//|     file: Union[typing.BinaryIO, ReadableBuffer]
+//|     """File or buffer to play back."""
 STATIC mp_obj_t audiomp3_mp3file_obj_get_file(mp_obj_t self_in) {
     audiomp3_mp3file_obj_t *self = MP_OBJ_TO_PTR(self_in);
     check_for_deinit(self);
-    return self->file;
+    return self->source;
 }
 MP_DEFINE_CONST_FUN_OBJ_1(audiomp3_mp3file_get_file_obj, audiomp3_mp3file_obj_get_file);
 
 STATIC mp_obj_t audiomp3_mp3file_obj_set_file(mp_obj_t self_in, mp_obj_t file) {
     audiomp3_mp3file_obj_t *self = MP_OBJ_TO_PTR(self_in);
     check_for_deinit(self);
-    if (!mp_obj_is_type(file, &mp_type_fileio)) {
-        mp_raise_TypeError(MP_ERROR_TEXT("file must be a file opened in byte mode"));
-    }
+    validate_source(file);
     common_hal_audiomp3_mp3file_set_file(self, file);
     return mp_const_none;
 }
@@ -328,6 +328,7 @@ MAKE_ENUM_TYPE(bitmaptools, BlendMode, bitmaptools_blendmode);
 //|     blendmode: Optional[BlendMode] = BlendMode.Normal,
 //|     skip_source1_index: Union[int, None] = None,
 //|     skip_source2_index: Union[int, None] = None,
+//|     alpha_mask: Optional[displayio.Bitmap] = None,
 //| ) -> None:
 //|     """Alpha blend the two source bitmaps into the destination.
 //|
@@ -338,18 +339,19 @@ MAKE_ENUM_TYPE(bitmaptools, BlendMode, bitmaptools_blendmode);
 //|     :param bitmap source_bitmap_1: The first source bitmap
 //|     :param bitmap source_bitmap_2: The second source bitmap
 //|     :param float factor1: The proportion of bitmap 1 to mix in
-//|     :param float factor2: The proportion of bitmap 2 to mix in.  If specified as `None`, ``1-factor1`` is used.  Usually the proportions should sum to 1.
+//|     :param float factor2: The proportion of bitmap 2 to mix in.  If specified as `None`, ``1-factor1`` is used.  Usually the proportions should sum to 1.  Both factors are limited to the range 0 to 1 and used with a precision of 1/256.
 //|     :param displayio.Colorspace colorspace: The colorspace of the bitmaps. They must all have the same colorspace.  Only the following colorspaces are permitted:  ``L8``, ``RGB565``, ``RGB565_SWAPPED``, ``BGR565`` and ``BGR565_SWAPPED``.
 //|     :param bitmaptools.BlendMode blendmode: The blend mode to use. Default is Normal.
 //|     :param int skip_source1_index: Bitmap palette or luminance index in source_bitmap_1 that will not be blended, set to None to blend all pixels
 //|     :param int skip_source2_index: Bitmap palette or luminance index in source_bitmap_2 that will not be blended, set to None to blend all pixels
+//|     :param bitmap alpha_mask: A bitmap the size of the destination, with at most 8 bits per value. Where given, ``factor2`` is scaled at each pixel by the mask value divided by the largest value the mask can hold, so 0 shows only ``source_bitmap_1`` and the largest value blends as if there were no mask
 //|
 //|     For the L8 colorspace, the bitmaps must have a bits-per-value of 8.
 //|     For the RGB colorspaces, they must have a bits-per-value of 16."""
 //|
 
 STATIC mp_obj_t bitmaptools_alphablend(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum {ARG_dest_bitmap, ARG_source_bitmap_1, ARG_source_bitmap_2, ARG_colorspace, ARG_factor_1, ARG_factor_2, ARG_blendmode, ARG_skip_source1_index, ARG_skip_source2_index};
+    enum {ARG_dest_bitmap, ARG_source_bitmap_1, ARG_source_bitmap_2, ARG_colorspace, ARG_factor_1, ARG_factor_2, ARG_blendmode, ARG_skip_source1_index, ARG_skip_source2_index, ARG_alpha_mask};
 
     static const mp_arg_t allowed_args[] = {
         {MP_QSTR_dest_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = NULL}},
@@ -361,6 +363,7 @@ STATIC mp_obj_t bitmaptools_alphablend(size_t n_args, const mp_obj_t *pos_args,
         {MP_QSTR_blendmode, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = (void *)&bitmaptools_blendmode_Normal_obj}},
         {MP_QSTR_skip_source1_index, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
         {MP_QSTR_skip_source2_index, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        {MP_QSTR_alpha_mask, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -427,8 +430,19 @@ STATIC mp_obj_t bitmaptools_alphablend(size_t n_args, const mp_obj_t *pos_args,
         skip_source2_index_none = false;
     }
 
+    displayio_bitmap_t *alpha_mask = NULL;
+    if (args[ARG_alpha_mask].u_obj != mp_const_none) {
+        alpha_mask = MP_OBJ_TO_PTR(mp_arg_validate_type(args[ARG_alpha_mask].u_obj, &displayio_bitmap_type, MP_QSTR_alpha_mask));
+        if (alpha_mask->width != destination->width || alpha_mask->height != destination->height) {
+            mp_raise_ValueError(MP_ERROR_TEXT("bitmap sizes must match"));
+        }
+        if (alpha_mask->bits_per_value > 8) {
+            mp_raise_ValueError(MP_ERROR_TEXT("Invalid bits per value"));
+        }
+    }
+
     common_hal_bitmaptools_alphablend(destination, source1, source2, colorspace, factor1, factor2, blendmode, skip_source1_index,
-        skip_source1_index_none, skip_source2_index, skip_source2_index_none);
+        skip_source1_index_none, skip_source2_index, skip_source2_index_none, alpha_mask);
 
     return mp_const_none;
 }
@@ -850,12 +864,17 @@ MP_DEFINE_CONST_FUN_OBJ_KW(bitmaptools_readinto_obj, 0, bitmaptools_readinto);
 //|     FloydStenberg: "DitherAlgorithm"
 //|     """The Floyd-Stenberg dither"""
 //|
+//|     Ordered: "DitherAlgorithm"
+//|     """An ordered (Bayer matrix) dither. It is the fastest, and the pattern at each pixel does not depend on the rest of the image"""
+//|
 MAKE_ENUM_VALUE(bitmaptools_dither_algorithm_type, dither_algorithm, Atkinson, DITHER_ALGORITHM_ATKINSON);
 MAKE_ENUM_VALUE(bitmaptools_dither_algorithm_type, dither_algorithm, FloydStenberg, DITHER_ALGORITHM_FLOYD_STENBERG);
+MAKE_ENUM_VALUE(bitmaptools_dither_algorithm_type, dither_algorithm, Ordered, DITHER_ALGORITHM_ORDERED);
 
 MAKE_ENUM_MAP(bitmaptools_dither_algorithm) {
     MAKE_ENUM_MAP_ENTRY(dither_algorithm, Atkinson),
     MAKE_ENUM_MAP_ENTRY(dither_algorithm, FloydStenberg),
+    MAKE_ENUM_MAP_ENTRY(dither_algorithm, Ordered),
 };
 STATIC MP_DEFINE_CONST_DICT(bitmaptools_dither_algorithm_locals_dict, bitmaptools_dither_algorithm_locals_table);
 
@@ -36,7 +36,7 @@
 #include "extmod/vfs_fat.h"
 
 typedef enum {
-    DITHER_ALGORITHM_ATKINSON, DITHER_ALGORITHM_FLOYD_STENBERG,
+    DITHER_ALGORITHM_ATKINSON, DITHER_ALGORITHM_FLOYD_STENBERG, DITHER_ALGORITHM_ORDERED,
 } bitmaptools_dither_algorithm_t;
 
 extern const mp_obj_type_t bitmaptools_dither_algorithm_type;
@@ -87,7 +87,8 @@ void common_hal_bitmaptools_arrayblit(displayio_bitmap_t *self, void *data, int
 void common_hal_bitmaptools_dither(displayio_bitmap_t *dest_bitmap, displayio_bitmap_t *source_bitmap, displayio_colorspace_t colorspace, bitmaptools_dither_algorithm_t algorithm);
 
 void common_hal_bitmaptools_alphablend(displayio_bitmap_t *destination, displayio_bitmap_t *source1, displayio_bitmap_t *source2, displayio_colorspace_t colorspace, mp_float_t factor1, mp_float_t factor2,
-    bitmaptools_blendmode_t blendmode, uint32_t skip_source1_index, bool skip_source1_index_none, uint32_t skip_source2_index, bool skip_source2_index_none);
+    bitmaptools_blendmode_t blendmode, uint32_t skip_source1_index, bool skip_source1_index_none, uint32_t skip_source2_index, bool skip_source2_index_none,
+    displayio_bitmap_t *alpha_mask);
 
 typedef struct {
     union {
@@ -29,11 +29,13 @@
 #include <stdint.h>
 
 #include "shared/runtime/context_manager_helpers.h"
+#include "extmod/modasyncio.h"
 #include "py/binary.h"
 #include "py/objproperty.h"
 #include "py/objtype.h"
 #include "py/runtime.h"
 #include "shared-bindings/displayio/Group.h"
+#include "shared-bindings/displayio/TileGrid.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/util.h"
 #include "shared-module/displayio/__init__.h"
@@ -85,7 +87,8 @@
 //|         auto_refresh: bool = True,
 //|         native_frames_per_second: int = 60,
 //|         backlight_on_high: bool = True,
-//|         SH1107_addressing: bool = False
+//|         SH1107_addressing: bool = False,
+//|         area_buffer_size: int = 512
 //|     ) -> None:
 //|         r"""Create a Display object on the given display bus (`FourWire`, `ParallelBus` or `I2CDisplayBus`).
 //|
@@ -143,6 +146,7 @@
 //|         :param bool SH1107_addressing: Special quirk for SH1107, use upper/lower column set and page set
 //|         :param int set_vertical_scroll: This parameter is accepted but ignored for backwards compatibility. It will be removed in a future release.
 //|         :param int backlight_pwm_frequency: The frequency to use to drive the PWM for backlight brightness control. Default is 50000.
+//|         :param int area_buffer_size: Size in bytes of the buffer used to render each piece of a refresh area before it is sent. Larger buffers mean fewer, longer bus transfers at the cost of RAM held for as long as the display exists. Must be from 64 to 4096. Rounded down to a multiple of 4.
 //|         """
 //|         ...
 STATIC mp_obj_t busdisplay_busdisplay_make_new(const mp_obj_type_t *type, size_t n_args,
@@ -154,7 +158,7 @@ STATIC mp_obj_t busdisplay_busdisplay_make_new(const mp_obj_type_t *type, size_t
            ARG_set_vertical_scroll, ARG_backlight_pin, ARG_brightness_command,
            ARG_brightness, ARG_single_byte_bounds, ARG_data_as_commands,
            ARG_auto_refresh, ARG_native_frames_per_second, ARG_backlight_on_high,
-           ARG_SH1107_addressing, ARG_backlight_pwm_frequency };
+           ARG_SH1107_addressing, ARG_backlight_pwm_frequency, ARG_area_buffer_size };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_display_bus, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_init_sequence, MP_ARG_REQUIRED | MP_ARG_OBJ },
@@ -182,7 +186,8 @@ STATIC mp_obj_t busdisplay_busdisplay_make_new(const mp_obj_type_t *type, size_t
         { MP_QSTR_native_frames_per_second, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 60} },
         { MP_QSTR_backlight_on_high, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
         { MP_QSTR_SH1107_addressing, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
-        { MP_QSTR_backlight_pwm_frequency, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 50000} }
+        { MP_QSTR_backlight_pwm_frequency, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 50000} },
+        { MP_QSTR_area_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = CIRCUITPY_BUSDISPLAY_AREA_BUFFER_SIZE} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -208,6 +213,9 @@ STATIC mp_obj_t busdisplay_busdisplay_make_new(const mp_obj_type_t *type, size_t
         mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be 1 when %q is True"), MP_QSTR_color_depth, MP_QSTR_SH1107_addressing);
     }
 
+    const mp_int_t area_buffer_size =
+        mp_arg_validate_int_range(args[ARG_area_buffer_size].u_int, 64, CIRCUITPY_BUSDISPLAY_AREA_BUFFER_MAX_SIZE, MP_QSTR_area_buffer_size);
+
     primary_display_t *disp = allocate_display_or_raise();
     busdisplay_busdisplay_obj_t *self = &disp->display;
 
@@ -234,6 +242,7 @@ STATIC mp_obj_t busdisplay_busdisplay_make_new(const mp_obj_type_t *type, size_t
         sh1107_addressing,
         args[ARG_backlight_pwm_frequency].u_int
         );
+    common_hal_busdisplay_busdisplay_set_area_buffer_size(self, area_buffer_size);
 
     return self;
 }
@@ -307,6 +316,54 @@ STATIC mp_obj_t busdisplay_busdisplay_obj_refresh(size_t n_args, const mp_obj_t
 
 MP_DEFINE_CONST_FUN_OBJ_KW(busdisplay_busdisplay_refresh_obj, 1, busdisplay_busdisplay_obj_refresh);
 
+#if CIRCUITPY_BUSDISPLAY_REFRESH_SLICE_MS && MICROPY_PY_ASYNCIO
+typedef struct {
+    mp_obj_base_t base;
+    busdisplay_busdisplay_obj_t *display;
+    bool started;
+} busdisplay_refresh_async_obj_t;
+
+// Each step sends one slice and then lets the other asyncio tasks run.
+STATIC mp_obj_t busdisplay_refresh_async_iternext(mp_obj_t self_in) {
+    busdisplay_refresh_async_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_busdisplay_busdisplay_refresh_slice(self->display, &self->started)) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    mp_asyncio_reschedule_current_task();
+    return mp_const_none;
+}
+
+STATIC const mp_rom_map_elem_t busdisplay_refresh_async_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___await__), MP_ROM_PTR(&mp_identity_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(busdisplay_refresh_async_locals_dict, busdisplay_refresh_async_locals_dict_table);
+
+STATIC MP_DEFINE_CONST_OBJ_TYPE(
+    busdisplay_refresh_async_type,
+    MP_QSTR_refresh_async,
+    MP_TYPE_FLAG_ITER_IS_ITERNEXT,
+    iter, busdisplay_refresh_async_iternext,
+    locals_dict, &busdisplay_refresh_async_locals_dict
+    );
+
+//|     def refresh_async(self) -> Awaitable[None]:
+//|         """Refreshes the display like `refresh` with no frame rate limit, sending it a
+//|         few milliseconds at a time so that other asyncio tasks run in between.
+//|         Use as ``await display.refresh_async()`` from an asyncio task. Content changed while
+//|         the refresh is in flight is shown by the next refresh.
+//|
+//|         Only available on builds that send refreshes in slices."""
+//|         ...
+STATIC mp_obj_t busdisplay_busdisplay_obj_refresh_async(mp_obj_t self_in) {
+    busdisplay_busdisplay_obj_t *self = native_display(self_in);
+    busdisplay_refresh_async_obj_t *awaitable = mp_obj_malloc(busdisplay_refresh_async_obj_t, &busdisplay_refresh_async_type);
+    awaitable->display = self;
+    awaitable->started = false;
+    return MP_OBJ_FROM_PTR(awaitable);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busdisplay_busdisplay_refresh_async_obj, busdisplay_busdisplay_obj_refresh_async);
+#endif
+
 //|     auto_refresh: bool
 //|     """True when the display is refreshed automatically."""
 STATIC mp_obj_t busdisplay_busdisplay_obj_get_auto_refresh(mp_obj_t self_in) {
@@ -497,10 +554,56 @@ STATIC mp_obj_t busdisplay_busdisplay_obj_fill_row(size_t n_args, const mp_obj_t
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(busdisplay_busdisplay_fill_row_obj, 1, busdisplay_busdisplay_obj_fill_row);
 
+//|     def set_vertical_scroll(
+//|         self, tile_grid: Optional[displayio.TileGrid], *, memory_lines: int = 320
+//|     ) -> None:
+//|         """Scroll ``tile_grid`` vertically with the panel's own scrolling, using the
+//|         MIPI DCS ``VSCRDEF`` and ``VSCRSADD`` commands found on controllers such as the
+//|         ST7789 and ILI9341. When the grid scrolls up, as it does under a `terminalio.Terminal`,
+//|         the panel's scroll start is moved and just the rows scrolled into view are sent.
+//|
+//|         The panel scrolls whole rows, so the grid must span the width of the display,
+//|         be unscaled and untransposed, and nothing else may be drawn over it. When it
+//|         isn't, it is redrawn as usual. Pass ``None`` to stop.
+//|
+//|         :param Optional[displayio.TileGrid] tile_grid: The grid to scroll
+//|         :param int memory_lines: Rows of the panel's frame memory, including any it doesn't show
+//|         """
+//|         ...
+//|
+STATIC mp_obj_t busdisplay_busdisplay_obj_set_vertical_scroll(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_tile_grid, ARG_memory_lines };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_tile_grid, MP_ARG_OBJ | MP_ARG_REQUIRED, {} },
+        { MP_QSTR_memory_lines, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 320} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    busdisplay_busdisplay_obj_t *self = native_display(pos_args[0]);
+
+    displayio_tilegrid_t *tile_grid = NULL;
+    if (args[ARG_tile_grid].u_obj != mp_const_none) {
+        tile_grid = mp_arg_validate_type(args[ARG_tile_grid].u_obj, &displayio_tilegrid_type, MP_QSTR_tile_grid);
+        // Scrolled rows are sent in pieces, so rows must be whole bytes in a plain address window.
+        if (self->core.colorspace.depth < 8 || self->bus.SH1107_addressing || self->bus.data_as_commands) {
+            mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_tile_grid);
+        }
+    }
+    uint16_t memory_lines = mp_arg_validate_int_range(args[ARG_memory_lines].u_int, 1, 0xffff, MP_QSTR_memory_lines);
+
+    common_hal_busdisplay_busdisplay_set_vertical_scroll(self, tile_grid, memory_lines);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(busdisplay_busdisplay_set_vertical_scroll_obj, 1, busdisplay_busdisplay_obj_set_vertical_scroll);
+
 STATIC const mp_rom_map_elem_t busdisplay_busdisplay_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_show), MP_ROM_PTR(&busdisplay_busdisplay_show_obj) },
     { MP_ROM_QSTR(MP_QSTR_refresh), MP_ROM_PTR(&busdisplay_busdisplay_refresh_obj) },
+    #if CIRCUITPY_BUSDISPLAY_REFRESH_SLICE_MS && MICROPY_PY_ASYNCIO
+    { MP_ROM_QSTR(MP_QSTR_refresh_async), MP_ROM_PTR(&busdisplay_busdisplay_refresh_async_obj) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_fill_row), MP_ROM_PTR(&busdisplay_busdisplay_fill_row_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_vertical_scroll), MP_ROM_PTR(&busdisplay_busdisplay_set_vertical_scroll_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_auto_refresh), MP_ROM_PTR(&busdisplay_busdisplay_auto_refresh_obj) },
 
@@ -47,6 +47,9 @@ void common_hal_busdisplay_busdisplay_construct(busdisplay_busdisplay_obj_t *sel
     bool backlight_on_high, bool SH1107_addressing, uint16_t backlight_pwm_frequency);
 
 bool common_hal_busdisplay_busdisplay_refresh(busdisplay_busdisplay_obj_t *self, uint32_t target_ms_per_frame, uint32_t maximum_ms_per_real_frame);
+// Send up to CIRCUITPY_BUSDISPLAY_REFRESH_SLICE_MS of a refresh, starting it
+// first when *started is false. Returns true once it has all been sent.
+bool common_hal_busdisplay_busdisplay_refresh_slice(busdisplay_busdisplay_obj_t *self, bool *started);
 
 bool common_hal_busdisplay_busdisplay_get_auto_refresh(busdisplay_busdisplay_obj_t *self);
 void common_hal_busdisplay_busdisplay_set_auto_refresh(busdisplay_busdisplay_obj_t *self, bool auto_refresh);
@@ -55,6 +58,7 @@ uint16_t common_hal_busdisplay_busdisplay_get_width(busdisplay_busdisplay_obj_t
 uint16_t common_hal_busdisplay_busdisplay_get_height(busdisplay_busdisplay_obj_t *self);
 uint16_t common_hal_busdisplay_busdisplay_get_rotation(busdisplay_busdisplay_obj_t *self);
 void common_hal_busdisplay_busdisplay_set_rotation(busdisplay_busdisplay_obj_t *self, int rotation);
+void common_hal_busdisplay_busdisplay_set_area_buffer_size(busdisplay_busdisplay_obj_t *self, uint16_t area_buffer_size);
 
 bool common_hal_busdisplay_busdisplay_get_dither(busdisplay_busdisplay_obj_t *self);
 void common_hal_busdisplay_busdisplay_set_dither(busdisplay_busdisplay_obj_t *self, bool dither);
@@ -65,3 +69,4 @@ bool common_hal_busdisplay_busdisplay_set_brightness(busdisplay_busdisplay_obj_t
 mp_obj_t common_hal_busdisplay_busdisplay_get_bus(busdisplay_busdisplay_obj_t *self);
 mp_obj_t common_hal_busdisplay_busdisplay_get_root_group(busdisplay_busdisplay_obj_t *self);
 mp_obj_t common_hal_busdisplay_busdisplay_set_root_group(busdisplay_busdisplay_obj_t *self, displayio_group_t *root_group);
+void common_hal_busdisplay_busdisplay_set_vertical_scroll(busdisplay_busdisplay_obj_t *self, displayio_tilegrid_t *tile_grid, uint16_t memory_lines);
@@ -34,6 +34,7 @@
 #include "shared/runtime/buffer_helper.h"
 #include "shared/runtime/context_manager_helpers.h"
 #include "py/binary.h"
+#include "py/objproperty.h"
 #include "py/runtime.h"
 
 //| class I2C:
@@ -187,7 +188,19 @@ MP_DEFINE_CONST_FUN_OBJ_1(busio_i2c_unlock_obj, busio_i2c_obj_unlock);
 //|         :param int start: beginning of buffer slice
 //|         :param int end: end of buffer slice; if not specified, use ``len(buffer)``"""
 //|         ...
-STATIC mp_obj_t busio_i2c_readfrom_into(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+#if CIRCUITPY_BUSIO_I2C_ASYNC
+STATIC void busio_i2c_start_async(busio_i2c_obj_t *self, mp_int_t address,
+    const uint8_t *out_data, size_t out_len, uint8_t *in_data, size_t in_len) {
+    // Report how the previous transfer went before starting the next.
+    uint8_t status = common_hal_busio_i2c_wait(self);
+    if (status != 0) {
+        mp_raise_OSError(status);
+    }
+    common_hal_busio_i2c_write_read_async(self, address, out_data, out_len, in_data, in_len);
+}
+#endif
+
+STATIC mp_obj_t busio_i2c_readfrom_into_impl(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args, bool in_background) {
     enum { ARG_address, ARG_buffer, ARG_start, ARG_end };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_address,    MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
@@ -217,6 +230,13 @@ STATIC mp_obj_t busio_i2c_readfrom_into(size_t n_args, const mp_obj_t *pos_args,
     start *= stride_in_bytes;
     length *= stride_in_bytes;
 
+    #if CIRCUITPY_BUSIO_I2C_ASYNC
+    if (in_background) {
+        busio_i2c_start_async(self, args[ARG_address].u_int, NULL, 0, ((uint8_t *)bufinfo.buf) + start, length);
+        return mp_const_none;
+    }
+    #endif
+
     uint8_t status =
         common_hal_busio_i2c_read(self, args[ARG_address].u_int, ((uint8_t *)bufinfo.buf) + start, length);
     if (status != 0) {
@@ -225,6 +245,10 @@ STATIC mp_obj_t busio_i2c_readfrom_into(size_t n_args, const mp_obj_t *pos_args,
 
     return mp_const_none;
 }
+
+STATIC mp_obj_t busio_i2c_readfrom_into(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return busio_i2c_readfrom_into_impl(n_args, pos_args, kw_args, false);
+}
 MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_readfrom_into_obj, 1, busio_i2c_readfrom_into);
 
 //|     import sys
@@ -247,7 +271,7 @@ MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_readfrom_into_obj, 1, busio_i2c_readfrom_in
 //|         :param int end: end of buffer slice; if not specified, use ``len(buffer)``
 //|         """
 //|         ...
-STATIC mp_obj_t busio_i2c_writeto(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+STATIC mp_obj_t busio_i2c_writeto_impl(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args, bool in_background) {
     enum { ARG_address, ARG_buffer, ARG_start, ARG_end };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_address,    MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
@@ -276,6 +300,13 @@ STATIC mp_obj_t busio_i2c_writeto(size_t n_args, const mp_obj_t *pos_args, mp_ma
     start *= stride_in_bytes;
     length *= stride_in_bytes;
 
+    #if CIRCUITPY_BUSIO_I2C_ASYNC
+    if (in_background) {
+        busio_i2c_start_async(self, args[ARG_address].u_int, ((uint8_t *)bufinfo.buf) + start, length, NULL, 0);
+        return mp_const_none;
+    }
+    #endif
+
     // do the transfer
     uint8_t status =
         common_hal_busio_i2c_write(self, args[ARG_address].u_int, ((uint8_t *)bufinfo.buf) + start, length);
@@ -286,6 +317,10 @@ STATIC mp_obj_t busio_i2c_writeto(size_t n_args, const mp_obj_t *pos_args, mp_ma
 
     return mp_const_none;
 }
+
+STATIC mp_obj_t busio_i2c_writeto(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return busio_i2c_writeto_impl(n_args, pos_args, kw_args, false);
+}
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_writeto_obj, 1, busio_i2c_writeto);
 
 //|     import sys
@@ -322,7 +357,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_writeto_obj, 1, busio_i2c_writeto);
 //|         """
 //|         ...
 //|
-STATIC mp_obj_t busio_i2c_writeto_then_readfrom(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+STATIC mp_obj_t busio_i2c_writeto_then_readfrom_impl(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args, bool in_background) {
     enum { ARG_address, ARG_out_buffer, ARG_in_buffer, ARG_out_start, ARG_out_end, ARG_in_start, ARG_in_end };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_address,    MP_ARG_REQUIRED | MP_ARG_INT, {.u_int = 0} },
@@ -362,6 +397,14 @@ STATIC mp_obj_t busio_i2c_writeto_then_readfrom(size_t n_args, const mp_obj_t *p
     in_start *= in_stride_in_bytes;
     in_length *= in_stride_in_bytes;
 
+    #if CIRCUITPY_BUSIO_I2C_ASYNC
+    if (in_background) {
+        busio_i2c_start_async(self, args[ARG_address].u_int,
+            ((uint8_t *)out_bufinfo.buf) + out_start, out_length, ((uint8_t *)in_bufinfo.buf) + in_start, in_length);
+        return mp_const_none;
+    }
+    #endif
+
     uint8_t status = common_hal_busio_i2c_write_read(self, args[ARG_address].u_int,
         ((uint8_t *)out_bufinfo.buf) + out_start, out_length, ((uint8_t *)in_bufinfo.buf) + in_start, in_length);
     if (status != 0) {
@@ -370,8 +413,96 @@ STATIC mp_obj_t busio_i2c_writeto_then_readfrom(size_t n_args, const mp_obj_t *p
 
     return mp_const_none;
 }
+
+STATIC mp_obj_t busio_i2c_writeto_then_readfrom(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return busio_i2c_writeto_then_readfrom_impl(n_args, pos_args, kw_args, false);
+}
 MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_writeto_then_readfrom_obj, 1, busio_i2c_writeto_then_readfrom);
 
+#if CIRCUITPY_BUSIO_I2C_ASYNC
+//|     import sys
+//|     def readfrom_into_async(
+//|         self, address: int, buffer: WriteableBuffer, *, start: int = 0, end: int = sys.maxsize
+//|     ) -> None:
+//|         """Start reading from the device selected by ``address`` into ``buffer``, as
+//|         `readfrom_into` does, and return without waiting for the transfer to finish.
+//|
+//|         The transfer continues in the background while `pending` is ``True``. Keep ``buffer``
+//|         and do not change its size until then. Call `wait` to find out whether it succeeded.
+//|         Starting another transfer first waits for this one, and raises its error if it failed.
+//|
+//|         In `asyncio` code, ``while i2c.pending: await asyncio.sleep(0)`` lets other tasks run
+//|         while the transfer finishes.
+//|
+//|         **Limitations:** The ``_async`` methods, `wait` and `pending` are only available on RP2040.
+//|         """
+//|         ...
+STATIC mp_obj_t busio_i2c_readfrom_into_async(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return busio_i2c_readfrom_into_impl(n_args, pos_args, kw_args, true);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_readfrom_into_async_obj, 1, busio_i2c_readfrom_into_async);
+
+//|     import sys
+//|     def writeto_async(
+//|         self, address: int, buffer: ReadableBuffer, *, start: int = 0, end: int = sys.maxsize
+//|     ) -> None:
+//|         """Start writing ``buffer`` to the device selected by ``address``, as `writeto` does,
+//|         and return without waiting for the transfer to finish. See `readfrom_into_async`."""
+//|         ...
+STATIC mp_obj_t busio_i2c_writeto_async(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return busio_i2c_writeto_impl(n_args, pos_args, kw_args, true);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_writeto_async_obj, 1, busio_i2c_writeto_async);
+
+//|     import sys
+//|     def writeto_then_readfrom_async(
+//|         self,
+//|         address: int,
+//|         out_buffer: ReadableBuffer,
+//|         in_buffer: WriteableBuffer,
+//|         *,
+//|         out_start: int = 0,
+//|         out_end: int = sys.maxsize,
+//|         in_start: int = 0,
+//|         in_end: int = sys.maxsize
+//|     ) -> None:
+//|         """Start a write then a read, as `writeto_then_readfrom` does, and return without waiting
+//|         for the transfer to finish. See `readfrom_into_async`."""
+//|         ...
+STATIC mp_obj_t busio_i2c_writeto_then_readfrom_async(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return busio_i2c_writeto_then_readfrom_impl(n_args, pos_args, kw_args, true);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(busio_i2c_writeto_then_readfrom_async_obj, 1, busio_i2c_writeto_then_readfrom_async);
+
+//|     def wait(self) -> None:
+//|         """Wait for the transfer started by one of the ``_async`` methods to finish, and raise
+//|         `OSError` if it failed. Returns right away if it has already finished."""
+//|         ...
+STATIC mp_obj_t busio_i2c_wait(mp_obj_t self_in) {
+    busio_i2c_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    uint8_t status = common_hal_busio_i2c_wait(self);
+    if (status != 0) {
+        mp_raise_OSError(status);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busio_i2c_wait_obj, busio_i2c_wait);
+
+//|     pending: bool
+//|     """``True`` while a transfer started by one of the ``_async`` methods is in progress. (read-only)"""
+//|
+STATIC mp_obj_t busio_i2c_obj_get_pending(mp_obj_t self_in) {
+    busio_i2c_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_bool(common_hal_busio_i2c_get_pending(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(busio_i2c_get_pending_obj, busio_i2c_obj_get_pending);
+
+MP_PROPERTY_GETTER(busio_i2c_pending_obj,
+    (mp_obj_t)&busio_i2c_get_pending_obj);
+#endif
+
 STATIC const mp_rom_map_elem_t busio_i2c_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&busio_i2c_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
@@ -384,6 +515,14 @@ STATIC const mp_rom_map_elem_t busio_i2c_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readfrom_into), MP_ROM_PTR(&busio_i2c_readfrom_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_writeto), MP_ROM_PTR(&busio_i2c_writeto_obj) },
     { MP_ROM_QSTR(MP_QSTR_writeto_then_readfrom), MP_ROM_PTR(&busio_i2c_writeto_then_readfrom_obj) },
+
+    #if CIRCUITPY_BUSIO_I2C_ASYNC
+    { MP_ROM_QSTR(MP_QSTR_readfrom_into_async), MP_ROM_PTR(&busio_i2c_readfrom_into_async_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writeto_async), MP_ROM_PTR(&busio_i2c_writeto_async_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writeto_then_readfrom_async), MP_ROM_PTR(&busio_i2c_writeto_then_readfrom_async_obj) },
+    { MP_ROM_QSTR(MP_QSTR_wait), MP_ROM_PTR(&busio_i2c_wait_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pending), MP_ROM_PTR(&busio_i2c_pending_obj) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(busio_i2c_locals_dict, busio_i2c_locals_dict_table);
@@ -391,7 +530,7 @@ STATIC MP_DEFINE_CONST_DICT(busio_i2c_locals_dict, busio_i2c_locals_dict_table);
 MP_DEFINE_CONST_OBJ_TYPE(
     busio_i2c_type,
     MP_QSTR_I2C,
-    MP_TYPE_FLAG_NONE,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
     make_new, busio_i2c_make_new,
     locals_dict, &busio_i2c_locals_dict
     );
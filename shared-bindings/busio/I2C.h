@@ -72,6 +72,19 @@ extern uint8_t common_hal_busio_i2c_read(busio_i2c_obj_t *self, uint16_t address
 uint8_t common_hal_busio_i2c_write_read(busio_i2c_obj_t *self, uint16_t address,
     uint8_t *out_data, size_t out_len, uint8_t *in_data, size_t in_len);
 
+// Start a write and then a read, as common_hal_busio_i2c_write_read() does, and return
+// without waiting for them. Either length may be zero. The buffers must stay valid until
+// the transfer finishes.
+extern void common_hal_busio_i2c_write_read_async(busio_i2c_obj_t *self, uint16_t address,
+    const uint8_t *out_data, size_t out_len, uint8_t *in_data, size_t in_len);
+
+// Whether an asynchronous transfer is still in progress.
+extern bool common_hal_busio_i2c_get_pending(busio_i2c_obj_t *self);
+
+// Wait for the asynchronous transfer to finish and return its status, as
+// common_hal_busio_i2c_write() would.
+extern uint8_t common_hal_busio_i2c_wait(busio_i2c_obj_t *self);
+
 // This is used by the supervisor to claim I2C devices indefinitely.
 extern void common_hal_busio_i2c_never_reset(busio_i2c_obj_t *self);
 
@@ -31,6 +31,9 @@
 
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/busio/SPI.h"
+#if CIRCUITPY_DIGITALIO
+#include "shared-bindings/digitalio/DigitalInOut.h"
+#endif
 #include "shared-bindings/util.h"
 
 #include "shared/runtime/buffer_helper.h"
@@ -454,6 +457,126 @@ STATIC mp_obj_t busio_spi_write_readinto(size_t n_args, const mp_obj_t *pos_args
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(busio_spi_write_readinto_obj, 1, busio_spi_write_readinto);
 
+// One step of a transfer_list(): a pin change when pin is set, otherwise a transfer
+// with either buffer possibly NULL.
+typedef struct {
+    const uint8_t *data_out;
+    uint8_t *data_in;
+    size_t len;
+    #if CIRCUITPY_DIGITALIO
+    digitalio_digitalinout_obj_t *pin;
+    #endif
+    bool value;
+} busio_spi_transfer_step_t;
+
+STATIC void busio_spi_parse_transfer_step(mp_obj_t item, busio_spi_transfer_step_t *step) {
+    memset(step, 0, sizeof(*step));
+    mp_buffer_info_t bufinfo;
+    if (mp_get_buffer(item, &bufinfo, MP_BUFFER_READ)) {
+        step->data_out = bufinfo.buf;
+        step->len = bufinfo.len;
+        return;
+    }
+
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_get_array(item, &len, &items);
+    mp_arg_validate_length(len, 2, MP_QSTR_transfers);
+
+    #if CIRCUITPY_DIGITALIO
+    if (mp_obj_is_type(items[0], &digitalio_digitalinout_type)) {
+        step->pin = MP_OBJ_TO_PTR(items[0]);
+        if (common_hal_digitalio_digitalinout_deinited(step->pin)) {
+            raise_deinited_error();
+        }
+        if (common_hal_digitalio_digitalinout_get_direction(step->pin) == DIRECTION_INPUT) {
+            mp_raise_AttributeError(MP_ERROR_TEXT("Cannot set value when direction is input."));
+        }
+        step->value = mp_obj_is_true(items[1]);
+        return;
+    }
+    #endif
+
+    mp_get_buffer_raise(items[1], &bufinfo, MP_BUFFER_WRITE);
+    step->data_in = bufinfo.buf;
+    step->len = bufinfo.len;
+    if (items[0] != mp_const_none) {
+        mp_get_buffer_raise(items[0], &bufinfo, MP_BUFFER_READ);
+        if (bufinfo.len != step->len) {
+            mp_raise_ValueError(MP_ERROR_TEXT("buffer slices must be of equal length"));
+        }
+        step->data_out = bufinfo.buf;
+    }
+}
+
+//|     def transfer_list(
+//|         self,
+//|         transfers: Sequence[
+//|             Union[
+//|                 ReadableBuffer,
+//|                 Tuple[Optional[ReadableBuffer], WriteableBuffer],
+//|                 Tuple[digitalio.DigitalInOut, bool],
+//|             ]
+//|         ],
+//|     ) -> None:
+//|         """Run a list of transfers in one call, to save the overhead of a call for each.
+//|         The SPI object must be locked.
+//|
+//|         Each item of ``transfers`` is done in order, and is one of:
+//|
+//|         * a buffer, which is written, as by `write`
+//|         * an ``(out_buffer, in_buffer)`` tuple, as given to `write_readinto`. When ``out_buffer``
+//|           is ``None``, zeros are written while reading, as by `readinto`
+//|         * a ``(digitalinout, value)`` tuple, which sets the value of an output, such as a chip
+//|           select or data/command pin
+//|
+//|         Every item is checked before any is done, so a bad item does not leave a transaction half done.
+//|
+//|         :param Sequence transfers: the transfers to do
+//|         """
+//|         ...
+
+STATIC mp_obj_t busio_spi_transfer_list(mp_obj_t self_in, mp_obj_t transfers_in) {
+    busio_spi_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    check_lock(self);
+
+    size_t count;
+    mp_obj_t *transfers;
+    mp_obj_get_array(transfers_in, &count, &transfers);
+
+    busio_spi_transfer_step_t step;
+    for (size_t i = 0; i < count; i++) {
+        busio_spi_parse_transfer_step(transfers[i], &step);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        busio_spi_parse_transfer_step(transfers[i], &step);
+        #if CIRCUITPY_DIGITALIO
+        if (step.pin) {
+            common_hal_digitalio_digitalinout_set_value(step.pin, step.value);
+            continue;
+        }
+        #endif
+        if (step.len == 0) {
+            continue;
+        }
+        bool ok;
+        if (step.data_in == NULL) {
+            ok = common_hal_busio_spi_write(self, step.data_out, step.len);
+        } else if (step.data_out == NULL) {
+            ok = common_hal_busio_spi_read(self, step.data_in, step.len, 0);
+        } else {
+            ok = common_hal_busio_spi_transfer(self, step.data_out, step.data_in, step.len);
+        }
+        if (!ok) {
+            mp_raise_OSError(MP_EIO);
+        }
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(busio_spi_transfer_list_obj, busio_spi_transfer_list);
+
 //|     frequency: int
 //|     """The actual SPI bus frequency. This may not match the frequency requested
 //|     due to internal limitations."""
@@ -484,6 +607,7 @@ STATIC const mp_rom_map_elem_t busio_spi_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&busio_spi_readinto_obj) },
     { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&busio_spi_write_obj) },
     { MP_ROM_QSTR(MP_QSTR_write_readinto), MP_ROM_PTR(&busio_spi_write_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_transfer_list), MP_ROM_PTR(&busio_spi_transfer_list_obj) },
     { MP_ROM_QSTR(MP_QSTR_frequency), MP_ROM_PTR(&busio_spi_frequency_obj) }
     #endif // CIRCUITPY_BUSIO_SPI
 };
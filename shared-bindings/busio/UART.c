@@ -293,6 +293,11 @@ STATIC mp_uint_t busio_uart_write(mp_obj_t self_in, const void *buf_in, mp_uint_
     return common_hal_busio_uart_write(self, buf, size, errcode);
 }
 
+// Ports whose UART can't wake the main task are polled by select.
+MP_WEAK bool common_hal_busio_uart_wake_when_ready(busio_uart_obj_t *self, mp_uint_t flags) {
+    return false;
+}
+
 STATIC mp_uint_t busio_uart_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t arg, int *errcode) {
     busio_uart_obj_t *self = native_uart(self_in);
     check_for_deinit(self);
@@ -306,6 +311,12 @@ STATIC mp_uint_t busio_uart_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t
         if ((flags & MP_STREAM_POLL_WR) && common_hal_busio_uart_ready_to_tx(self)) {
             ret |= MP_STREAM_POLL_WR;
         }
+    } else if (request == MP_STREAM_POLL_WAKE) {
+        ret = 0;
+        if (!common_hal_busio_uart_wake_when_ready(self, arg)) {
+            *errcode = MP_EINVAL;
+            ret = MP_STREAM_ERROR;
+        }
     } else {
         *errcode = MP_EINVAL;
         ret = MP_STREAM_ERROR;
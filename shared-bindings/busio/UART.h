@@ -68,6 +68,11 @@ extern uint32_t common_hal_busio_uart_rx_characters_available(busio_uart_obj_t *
 extern void common_hal_busio_uart_clear_rx_buffer(busio_uart_obj_t *self);
 extern bool common_hal_busio_uart_ready_to_tx(busio_uart_obj_t *self);
 
+// Arrange for the main task to be woken when the UART may become ready for the
+// given MP_STREAM_POLL_* flags. Returns false if the port can't do that, or if
+// the UART is ready already.
+extern bool common_hal_busio_uart_wake_when_ready(busio_uart_obj_t *self, mp_uint_t flags);
+
 extern void common_hal_busio_uart_never_reset(busio_uart_obj_t *self);
 
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_BUSIO_UART_H
@@ -63,6 +63,33 @@ STATIC mp_obj_t canio_listener_receive(mp_obj_t self_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(canio_listener_receive_obj, canio_listener_receive);
 
+//|     def receive_into(self, buffer: WriteableBuffer) -> int:
+//|         """Reads messages into ``buffer`` without allocating, after waiting
+//|         up to ``self.timeout`` seconds for the first one
+//|
+//|         Each message is stored as a 16-byte record that can be unpacked
+//|         with ``struct.unpack_from("<IBBxx8s", buffer, 16 * i)`` into its
+//|         id, length, flags and data.  Bit 0 of flags is set for an extended
+//|         id and bit 1 for a remote transmission request.
+//|
+//|         Messages that are already waiting are stored until ``buffer`` is
+//|         full, so a busy bus can be drained with one call.
+//|
+//|         :return: the number of messages stored, 0 if none arrived in time
+//|         :rtype: int"""
+//|         ...
+STATIC mp_obj_t canio_listener_receive_into(mp_obj_t self_in, mp_obj_t buffer_in) {
+    canio_listener_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_canio_listener_check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+
+    size_t count = common_hal_canio_listener_receive_into(self, bufinfo.buf, bufinfo.len / CANIO_LISTENER_RECORD_SIZE);
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(canio_listener_receive_into_obj, canio_listener_receive_into);
+
 //|     def in_waiting(self) -> int:
 //|         """Returns the number of messages (including remote
 //|         transmission requests) waiting"""
@@ -162,6 +189,7 @@ STATIC const mp_rom_map_elem_t canio_listener_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&canio_listener_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR_in_waiting), MP_ROM_PTR(&canio_listener_in_waiting_obj) },
     { MP_ROM_QSTR(MP_QSTR_receive), MP_ROM_PTR(&canio_listener_receive_obj) },
+    { MP_ROM_QSTR(MP_QSTR_receive_into), MP_ROM_PTR(&canio_listener_receive_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_timeout), MP_ROM_PTR(&canio_listener_timeout_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(canio_listener_locals_dict, canio_listener_locals_dict_table);
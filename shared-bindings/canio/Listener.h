@@ -32,12 +32,19 @@
 
 extern const mp_obj_type_t canio_listener_type;
 
+// Size of one frame record stored by receive_into: a uint32 id, a uint8 length,
+// a uint8 of CANIO_LISTENER_RECORD_* flags, two reserved bytes and 8 data bytes.
+#define CANIO_LISTENER_RECORD_SIZE (16)
+#define CANIO_LISTENER_RECORD_EXTENDED (1 << 0)
+#define CANIO_LISTENER_RECORD_RTR (1 << 1)
+
 typedef struct canio_listener_obj canio_listener_obj_t;
 
 void common_hal_canio_listener_construct(canio_listener_obj_t *self, canio_can_obj_t *can, size_t nmatch, canio_match_obj_t **matches, float timeout);
 void common_hal_canio_listener_check_for_deinit(canio_listener_obj_t *self);
 void common_hal_canio_listener_deinit(canio_listener_obj_t *self);
 mp_obj_t common_hal_canio_listener_receive(canio_listener_obj_t *self);
+size_t common_hal_canio_listener_receive_into(canio_listener_obj_t *self, uint8_t *records, size_t max_records);
 int common_hal_canio_listener_in_waiting(canio_listener_obj_t *self);
 float common_hal_canio_listener_get_timeout(canio_listener_obj_t *self);
 void common_hal_canio_listener_set_timeout(canio_listener_obj_t *self, float timeout);
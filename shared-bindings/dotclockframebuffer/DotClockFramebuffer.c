@@ -63,6 +63,8 @@
 //|         pclk_active_high: bool,
 //|         pclk_idle_high: bool,
 //|         overscan_left: int = 0,
+//|         bounce_buffer_rows: int = 0,
+//|         double_buffer: bool = False,
 //|     ) -> None:
 //|         """Create a DotClockFramebuffer object associated with the given pins.
 //|
@@ -108,6 +110,17 @@
 //|         :param bool pclk_idle_high: True if the dclk stays at high level in IDLE phase
 //|
 //|         :param int overscan_left: Allocate additional non-visible columns left of the first display column
+//|
+//|         Memory parameters:
+//|
+//|         :param int bounce_buffer_rows: When non-zero, the display is sent from two internal RAM
+//|             buffers of this many rows each, which are refilled from the framebuffer in PSRAM as they
+//|             are sent. This keeps the display steady when Wi-Fi or flash access compete for PSRAM, at
+//|             the cost of some internal RAM and CPU time. ``height`` must be a multiple of twice this value.
+//|         :param bool double_buffer: Allocate two framebuffers. The display shows one while the other
+//|             is drawn into; `refresh` switches them at the start of the next frame, so drawing never
+//|             shows up mid-frame. This doubles the PSRAM needed. The buffer protocol gives the buffer
+//|             to draw into, which changes after each `refresh`.
 //|         """
 //|         #:param int overscan_top: Allocate additional non-visible rows above the first display row
 //|         #:param int overscan_right: Allocate additional non-visible columns right of the last display column
@@ -119,7 +132,7 @@ STATIC mp_obj_t dotclockframebuffer_framebuffer_make_new(const mp_obj_type_t *ty
            ARG_hsync_pulse_width, ARG_hsync_back_porch, ARG_hsync_front_porch, ARG_hsync_idle_low,
            ARG_vsync_pulse_width, ARG_vsync_back_porch, ARG_vsync_front_porch, ARG_vsync_idle_low,
            ARG_de_idle_high, ARG_pclk_active_high, ARG_pclk_idle_high,
-           ARG_overscan_left};
+           ARG_overscan_left, ARG_bounce_buffer_rows, ARG_double_buffer};
 
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_de, MP_ARG_OBJ | MP_ARG_KW_ONLY | MP_ARG_REQUIRED, {.u_obj = mp_const_none } },
@@ -149,6 +162,8 @@ STATIC mp_obj_t dotclockframebuffer_framebuffer_make_new(const mp_obj_type_t *ty
         { MP_QSTR_pclk_idle_high, MP_ARG_BOOL | MP_ARG_KW_ONLY | MP_ARG_REQUIRED, {.u_bool = false } },
 
         { MP_QSTR_overscan_left, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0 } },
+        { MP_QSTR_bounce_buffer_rows, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0 } },
+        { MP_QSTR_double_buffer, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false } },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -177,7 +192,9 @@ STATIC mp_obj_t dotclockframebuffer_framebuffer_make_new(const mp_obj_type_t *ty
         args[ARG_de_idle_high].u_bool,
         args[ARG_pclk_active_high].u_bool,
         args[ARG_pclk_idle_high].u_bool,
-        args[ARG_overscan_left].u_int
+        args[ARG_overscan_left].u_int,
+        mp_arg_validate_int_min(args[ARG_bounce_buffer_rows].u_int, 0, MP_QSTR_bounce_buffer_rows),
+        args[ARG_double_buffer].u_bool
         );
 
     return self;
@@ -194,6 +211,9 @@ static void check_for_deinit(dotclockframebuffer_framebuffer_obj_t *self) {
 //|         they are shown.
 //|
 //|         If this function is not called, the results are unpredictable; updates may be partially shown.
+//|
+//|         With ``double_buffer``, this waits for the display to start showing the buffer that was
+//|         drawn into, then copies it into the other buffer so drawing can carry on from it.
 //|         """
 //|         ...
 STATIC mp_obj_t dotclockframebuffer_framebuffer_refresh(mp_obj_t self_in) {
@@ -301,9 +321,8 @@ STATIC mp_int_t dotclockframebuffer_framebuffer_get_buffer(mp_obj_t self_in, mp_
 // These version exists so that the prototype matches the protocol,
 // avoiding a type cast that can hide errors
 STATIC void dotclockframebuffer_framebuffer_swapbuffers(mp_obj_t self_in, uint8_t *dirty_row_bitmap) {
-    (void)dirty_row_bitmap;
     dotclockframebuffer_framebuffer_obj_t *self = (dotclockframebuffer_framebuffer_obj_t *)self_in;
-    common_hal_dotclockframebuffer_framebuffer_refresh(self);
+    common_hal_dotclockframebuffer_framebuffer_swapbuffers(self, dirty_row_bitmap);
 }
 
 STATIC void dotclockframebuffer_framebuffer_deinit_proto(mp_obj_t self_in) {
@@ -46,7 +46,7 @@ void common_hal_dotclockframebuffer_framebuffer_construct(dotclockframebuffer_fr
     int hsync_pulse_width, int hsync_back_porch, int hsync_front_porch, bool hsync_idle_low,
     int vsync_pulse_width, int vsync_back_porch, int vsync_front_porch, bool vsync_idle_low,
     bool de_idle_high, bool pclk_active_high, bool pclk_idle_high,
-    int overscan_left);
+    int overscan_left, int bounce_buffer_rows, bool double_buffer);
 
 void common_hal_dotclockframebuffer_framebuffer_deinit(dotclockframebuffer_framebuffer_obj_t *self);
 bool common_hal_dotclockframebuffer_framebuffer_deinitialized(dotclockframebuffer_framebuffer_obj_t *self);
@@ -58,3 +58,4 @@ mp_int_t common_hal_dotclockframebuffer_framebuffer_get_refresh_rate(dotclockfra
 mp_int_t common_hal_dotclockframebuffer_framebuffer_get_row_stride(dotclockframebuffer_framebuffer_obj_t *self);
 mp_int_t common_hal_dotclockframebuffer_framebuffer_get_first_pixel_offset(dotclockframebuffer_framebuffer_obj_t *self);
 void common_hal_dotclockframebuffer_framebuffer_refresh(dotclockframebuffer_framebuffer_obj_t *self);
+void common_hal_dotclockframebuffer_framebuffer_swapbuffers(dotclockframebuffer_framebuffer_obj_t *self, const uint8_t *dirty_row_bitmap);
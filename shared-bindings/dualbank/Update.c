@@ -0,0 +1,218 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/dualbank/__init__.h"
+#include "shared-bindings/dualbank/Update.h"
+#include "shared-bindings/util.h"
+#include "shared/runtime/buffer_helper.h"
+#include "shared/runtime/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+
+//| class Update:
+//|     """Streams a firmware image into the next-update partition.
+//|
+//|     Data can be written in chunks of any size straight from a network buffer, and a SHA-256 of
+//|     the image is computed as it is written. If the connection drops, reconnect and continue
+//|     from `offset`, for example with an HTTP ``Range`` request. Nothing changes what boots
+//|     until `finish` succeeds and `dualbank.switch` is called.
+//|
+//|     .. code-block:: python
+//|
+//|         import dualbank
+//|
+//|         buf = bytearray(4096)
+//|         with dualbank.Update(sha256=expected_digest) as update:
+//|             while update.offset < image_size:
+//|                 n = sock.recv_into(buf)
+//|                 update.write(buf, end=n)
+//|             update.finish()
+//|         dualbank.switch()
+//|     """
+//|
+//|     def __init__(self, *, sha256: Optional[ReadableBuffer] = None) -> None:
+//|         """Starts an update. Only one update, or sequence of `dualbank.flash` calls, can be in
+//|         progress at a time.
+//|
+//|         :param ~circuitpython_typing.ReadableBuffer sha256: The expected 32 byte SHA-256 digest of the
+//|             whole image. If given, `finish` checks it before accepting the image.
+//|         """
+//|         ...
+STATIC mp_obj_t dualbank_update_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_sha256 };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sha256, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    #if CIRCUITPY_STORAGE_EXTEND
+    dualbank_raise_error_if_storage_extended();
+    #endif
+
+    const uint8_t *expected_sha256 = NULL;
+    if (args[ARG_sha256].u_obj != mp_const_none) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(args[ARG_sha256].u_obj, &bufinfo, MP_BUFFER_READ);
+        mp_arg_validate_length(bufinfo.len, 32, MP_QSTR_sha256);
+        expected_sha256 = bufinfo.buf;
+    }
+
+    dualbank_update_obj_t *self = m_new_obj_with_finaliser(dualbank_update_obj_t);
+    self->base.type = &dualbank_update_type;
+    common_hal_dualbank_update_construct(self, expected_sha256);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+STATIC void check_for_deinit(dualbank_update_obj_t *self) {
+    if (common_hal_dualbank_update_deinited(self)) {
+        raise_deinited_error();
+    }
+}
+
+//|     def deinit(self) -> None:
+//|         """Abandons the update if it has not been finished."""
+//|         ...
+STATIC mp_obj_t dualbank_update_deinit(mp_obj_t self_in) {
+    dualbank_update_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_dualbank_update_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(dualbank_update_deinit_obj, dualbank_update_deinit);
+
+//|     def __enter__(self) -> Update:
+//|         """No-op used by Context Managers."""
+//|         ...
+//  Provided by context manager helper.
+
+//|     def __exit__(self) -> None:
+//|         """Automatically abandons an unfinished update when exiting a context. See
+//|         :ref:`lifetime-and-contextmanagers` for more info."""
+//|         ...
+STATIC mp_obj_t dualbank_update_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_dualbank_update_deinit(MP_OBJ_TO_PTR(args[0]));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(dualbank_update___exit___obj, 4, 4, dualbank_update_obj___exit__);
+
+//|     def write(self, buffer: ReadableBuffer, *, start: int = 0, end: int = sys.maxsize) -> None:
+//|         """Appends ``buffer[start:end]`` to the image at `offset`. The slice is written without
+//|         being copied.
+//|
+//|         If the image is for the same firmware version as the one running, or one that previously
+//|         failed, the update is abandoned and `RuntimeError` is raised once its header is written.
+//|
+//|         :param ~circuitpython_typing.ReadableBuffer buffer: The next part of the image.
+//|         :param int start: Beginning of the slice of ``buffer`` to write.
+//|         :param int end: End of the slice; this index is not included. Defaults to ``len(buffer)``.
+//|         """
+//|         ...
+STATIC mp_obj_t dualbank_update_write(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_start, ARG_end };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_start, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_end, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = INT_MAX} },
+    };
+    dualbank_update_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
+
+    int32_t start = args[ARG_start].u_int;
+    size_t length = bufinfo.len;
+    normalize_buffer_bounds(&start, args[ARG_end].u_int, &length);
+
+    if (length > 0) {
+        common_hal_dualbank_update_write(self, ((const uint8_t *)bufinfo.buf) + start, length);
+    }
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(dualbank_update_write_obj, 1, dualbank_update_write);
+
+//|     def finish(self) -> None:
+//|         """Checks the SHA-256 given to the constructor, if any, and validates the image. Call
+//|         `dualbank.switch` afterwards to boot from it. The update is over either way; if the
+//|         image is rejected, `RuntimeError` is raised and a new `Update` must be started."""
+//|         ...
+STATIC mp_obj_t dualbank_update_finish(mp_obj_t self_in) {
+    dualbank_update_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_dualbank_update_finish(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(dualbank_update_finish_obj, dualbank_update_finish);
+
+//|     offset: int
+//|     """Number of bytes written so far, which is where the next `write` goes. (read-only)"""
+STATIC mp_obj_t dualbank_update_get_offset(mp_obj_t self_in) {
+    dualbank_update_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_dualbank_update_get_offset(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(dualbank_update_get_offset_obj, dualbank_update_get_offset);
+
+MP_PROPERTY_GETTER(dualbank_update_offset_obj,
+    (mp_obj_t)&dualbank_update_get_offset_obj);
+
+//|     sha256: bytes
+//|     """SHA-256 digest of the bytes written so far. (read-only)"""
+//|
+STATIC mp_obj_t dualbank_update_get_sha256(mp_obj_t self_in) {
+    dualbank_update_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    uint8_t digest[32];
+    common_hal_dualbank_update_get_sha256(self, digest);
+    return mp_obj_new_bytes(digest, sizeof(digest));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(dualbank_update_get_sha256_obj, dualbank_update_get_sha256);
+
+MP_PROPERTY_GETTER(dualbank_update_sha256_obj,
+    (mp_obj_t)&dualbank_update_get_sha256_obj);
+
+STATIC const mp_rom_map_elem_t dualbank_update_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&dualbank_update_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___del__), MP_ROM_PTR(&dualbank_update_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&dualbank_update___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&dualbank_update_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_finish), MP_ROM_PTR(&dualbank_update_finish_obj) },
+    { MP_ROM_QSTR(MP_QSTR_offset), MP_ROM_PTR(&dualbank_update_offset_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sha256), MP_ROM_PTR(&dualbank_update_sha256_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(dualbank_update_locals_dict, dualbank_update_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    dualbank_update_type,
+    MP_QSTR_Update,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, dualbank_update_make_new,
+    locals_dict, &dualbank_update_locals_dict
+    );
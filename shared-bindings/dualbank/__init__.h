@@ -29,6 +29,10 @@
 
 #include "py/runtime.h"
 
+#if CIRCUITPY_STORAGE_EXTEND
+void dualbank_raise_error_if_storage_extended(void);
+#endif
+
 extern void common_hal_dualbank_switch(void);
 extern void common_hal_dualbank_flash(const void *buf, const size_t len, const size_t offset);
 
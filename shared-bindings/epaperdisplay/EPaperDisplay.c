@@ -40,6 +40,25 @@
 
 //| from busdisplay import _DisplayBus
 //|
+
+// A single command byte or a byte-packed command sequence, as a sequence.
+STATIC size_t get_command_sequence(mp_obj_t command_obj, bool two_byte_sequence_length, const uint8_t **sequence, qstr arg_name) {
+    mp_buffer_info_t bufinfo;
+    mp_int_t command;
+    if (mp_obj_get_int_maybe(command_obj, &command)) {
+        uint8_t *command_buf = m_malloc(3);
+        command_buf[0] = command;
+        command_buf[1] = 0;
+        command_buf[2] = 0;
+        *sequence = command_buf;
+        return two_byte_sequence_length? 3: 2;
+    } else if (mp_get_buffer(command_obj, &bufinfo, MP_BUFFER_READ)) {
+        *sequence = bufinfo.buf;
+        return bufinfo.len;
+    }
+    mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), arg_name);
+}
+
 //| class EPaperDisplay:
 //|     """Manage updating an epaper display over a display bus
 //|
@@ -82,7 +101,9 @@
 //|         advanced_color_epaper: bool = False,
 //|         two_byte_sequence_length: bool = False,
 //|         start_up_time: float = 0,
-//|         address_little_endian: bool = False
+//|         address_little_endian: bool = False,
+//|         partial_refresh_display_command: Optional[Union[int, circuitpython_typing.ReadableBuffer]] = None,
+//|         full_refresh_interval: int = 10
 //|     ) -> None:
 //|         """Create a EPaperDisplay object on the given display bus (`fourwire.FourWire` or `paralleldisplaybus.ParallelBus`).
 //|
@@ -125,6 +146,8 @@
 //|         :param bool two_byte_sequence_length: When true, use two bytes to define sequence length
 //|         :param float start_up_time: Time to wait after reset before sending commands
 //|         :param bool address_little_endian: Send the least significant byte (not bit) of multi-byte addresses first. Ignored when ram is addressed with one byte
+//|         :param int partial_refresh_display_command: Command used to update only the changed parts of the display, such as a fast or partial waveform. Single int or byte-packed command sequence. Requires ``set_row_window_command``. When `None`, every refresh is a full one
+//|         :param int full_refresh_interval: With ``partial_refresh_display_command``, every this many refreshes is a full one to clear ghosting
 //|         """
 //|         ...
 STATIC mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
@@ -135,7 +158,8 @@ STATIC mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
            ARG_write_color_ram_command, ARG_color_bits_inverted, ARG_highlight_color,
            ARG_refresh_display_command,  ARG_refresh_time, ARG_busy_pin, ARG_busy_state,
            ARG_seconds_per_frame, ARG_always_toggle_chip_select, ARG_grayscale, ARG_advanced_color_epaper,
-           ARG_two_byte_sequence_length, ARG_start_up_time, ARG_address_little_endian };
+           ARG_two_byte_sequence_length, ARG_start_up_time, ARG_address_little_endian,
+           ARG_partial_refresh_display_command, ARG_full_refresh_interval };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_display_bus, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_start_sequence, MP_ARG_REQUIRED | MP_ARG_OBJ },
@@ -167,6 +191,8 @@ STATIC mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
         { MP_QSTR_two_byte_sequence_length, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
         { MP_QSTR_start_up_time, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NEW_SMALL_INT(0)} },
         { MP_QSTR_address_little_endian, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+        { MP_QSTR_partial_refresh_display_command, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_full_refresh_interval, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 10} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -201,24 +227,17 @@ STATIC mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
 
     bool two_byte_sequence_length = args[ARG_two_byte_sequence_length].u_bool;
 
-    mp_obj_t refresh_obj = args[ARG_refresh_display_command].u_obj;
     const uint8_t *refresh_buf;
-    mp_buffer_info_t refresh_bufinfo;
-    size_t refresh_buf_len = 0;
-    mp_int_t refresh_command;
-    if (mp_obj_get_int_maybe(refresh_obj, &refresh_command)) {
-        uint8_t *command_buf = m_malloc(3);
-        command_buf[0] = refresh_command;
-        command_buf[1] = 0;
-        command_buf[2] = 0;
-        refresh_buf = command_buf;
-        refresh_buf_len = two_byte_sequence_length? 3: 2;
-    } else if (mp_get_buffer(refresh_obj, &refresh_bufinfo, MP_BUFFER_READ)) {
-        refresh_buf = refresh_bufinfo.buf;
-        refresh_buf_len = refresh_bufinfo.len;
-    } else {
-        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_refresh_display_command);
+    size_t refresh_buf_len = get_command_sequence(args[ARG_refresh_display_command].u_obj, two_byte_sequence_length,
+        &refresh_buf, MP_QSTR_refresh_display_command);
+
+    const uint8_t *partial_refresh_buf = NULL;
+    size_t partial_refresh_buf_len = 0;
+    if (args[ARG_partial_refresh_display_command].u_obj != mp_const_none) {
+        partial_refresh_buf_len = get_command_sequence(args[ARG_partial_refresh_display_command].u_obj,
+            two_byte_sequence_length, &partial_refresh_buf, MP_QSTR_partial_refresh_display_command);
     }
+    mp_int_t full_refresh_interval = mp_arg_validate_int_range(args[ARG_full_refresh_interval].u_int, 1, 0xffff, MP_QSTR_full_refresh_interval);
 
     self->base.type = &epaperdisplay_epaperdisplay_type;
     common_hal_epaperdisplay_epaperdisplay_construct(
@@ -235,6 +254,8 @@ STATIC mp_obj_t epaperdisplay_epaperdisplay_make_new(const mp_obj_type_t *type,
         args[ARG_always_toggle_chip_select].u_bool, args[ARG_grayscale].u_bool, args[ARG_advanced_color_epaper].u_bool,
         two_byte_sequence_length, args[ARG_address_little_endian].u_bool
         );
+    common_hal_epaperdisplay_epaperdisplay_set_partial_refresh(self, partial_refresh_buf, partial_refresh_buf_len,
+        full_refresh_interval);
 
     return self;
 }
@@ -306,7 +327,9 @@ MP_PROPERTY_GETTER(epaperdisplay_epaperdisplay_time_to_refresh_obj,
 
 //|     busy: bool
 //|     """True when the display is refreshing. This uses the ``busy_pin`` when available or the
-//|        ``refresh_time`` otherwise."""
+//|        ``refresh_time`` otherwise. `refresh` returns once the frame is sent, so code can keep
+//|        running or sleep while the panel updates. With a ``busy_pin``, the board isn't woken
+//|        to watch it, and the panel is put to sleep when this or `refresh` next finds it done."""
 STATIC mp_obj_t epaperdisplay_epaperdisplay_obj_get_busy(mp_obj_t self_in) {
     epaperdisplay_epaperdisplay_obj_t *self = native_display(self_in);
     return mp_obj_new_bool(common_hal_epaperdisplay_epaperdisplay_get_busy(self));
@@ -357,6 +380,28 @@ MP_PROPERTY_GETSET(epaperdisplay_epaperdisplay_rotation_obj,
     (mp_obj_t)&epaperdisplay_epaperdisplay_get_rotation_obj,
     (mp_obj_t)&epaperdisplay_epaperdisplay_set_rotation_obj);
 
+//|     dither: bool
+//|     """True when a black and white display dithers the shades of its content as it
+//|     refreshes. Otherwise each pixel is black or white by its brightness. Grayscale,
+//|     tricolor and advanced color displays ignore it. Changing it redraws the whole
+//|     display on the next refresh."""
+STATIC mp_obj_t epaperdisplay_epaperdisplay_obj_get_dither(mp_obj_t self_in) {
+    epaperdisplay_epaperdisplay_obj_t *self = native_display(self_in);
+    return mp_obj_new_bool(common_hal_epaperdisplay_epaperdisplay_get_dither(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(epaperdisplay_epaperdisplay_get_dither_obj, epaperdisplay_epaperdisplay_obj_get_dither);
+
+STATIC mp_obj_t epaperdisplay_epaperdisplay_obj_set_dither(mp_obj_t self_in, mp_obj_t dither) {
+    epaperdisplay_epaperdisplay_obj_t *self = native_display(self_in);
+    common_hal_epaperdisplay_epaperdisplay_set_dither(self, mp_obj_is_true(dither));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(epaperdisplay_epaperdisplay_set_dither_obj, epaperdisplay_epaperdisplay_obj_set_dither);
+
+MP_PROPERTY_GETSET(epaperdisplay_epaperdisplay_dither_obj,
+    (mp_obj_t)&epaperdisplay_epaperdisplay_get_dither_obj,
+    (mp_obj_t)&epaperdisplay_epaperdisplay_set_dither_obj);
+
 //|     bus: _DisplayBus
 //|     """The bus being used by the display"""
 //|
@@ -405,6 +450,7 @@ STATIC const mp_rom_map_elem_t epaperdisplay_epaperdisplay_locals_dict_table[] =
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&epaperdisplay_epaperdisplay_width_obj) },
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&epaperdisplay_epaperdisplay_height_obj) },
     { MP_ROM_QSTR(MP_QSTR_rotation), MP_ROM_PTR(&epaperdisplay_epaperdisplay_rotation_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dither), MP_ROM_PTR(&epaperdisplay_epaperdisplay_dither_obj) },
     { MP_ROM_QSTR(MP_QSTR_bus), MP_ROM_PTR(&epaperdisplay_epaperdisplay_bus_obj) },
     { MP_ROM_QSTR(MP_QSTR_busy), MP_ROM_PTR(&epaperdisplay_epaperdisplay_busy_obj) },
     { MP_ROM_QSTR(MP_QSTR_time_to_refresh), MP_ROM_PTR(&epaperdisplay_epaperdisplay_time_to_refresh_obj) },
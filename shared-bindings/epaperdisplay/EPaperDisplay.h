@@ -49,6 +49,9 @@ void common_hal_epaperdisplay_epaperdisplay_construct(epaperdisplay_epaperdispla
     bool always_toggle_chip_select, bool grayscale, bool acep, bool two_byte_sequence_length,
     bool address_little_endian);
 
+void common_hal_epaperdisplay_epaperdisplay_set_partial_refresh(epaperdisplay_epaperdisplay_obj_t *self,
+    const uint8_t *partial_refresh_sequence, uint16_t partial_refresh_sequence_len, uint16_t full_refresh_interval);
+
 bool common_hal_epaperdisplay_epaperdisplay_refresh(epaperdisplay_epaperdisplay_obj_t *self);
 
 mp_obj_t common_hal_epaperdisplay_epaperdisplay_get_root_group(epaperdisplay_epaperdisplay_obj_t *self);
@@ -63,4 +66,7 @@ uint16_t common_hal_epaperdisplay_epaperdisplay_get_height(epaperdisplay_epaperd
 uint16_t common_hal_epaperdisplay_epaperdisplay_get_rotation(epaperdisplay_epaperdisplay_obj_t *self);
 void common_hal_epaperdisplay_epaperdisplay_set_rotation(epaperdisplay_epaperdisplay_obj_t *self, int rotation);
 
+bool common_hal_epaperdisplay_epaperdisplay_get_dither(epaperdisplay_epaperdisplay_obj_t *self);
+void common_hal_epaperdisplay_epaperdisplay_set_dither(epaperdisplay_epaperdisplay_obj_t *self, bool dither);
+
 mp_obj_t common_hal_epaperdisplay_epaperdisplay_get_bus(epaperdisplay_epaperdisplay_obj_t *self);
@@ -77,6 +77,10 @@ MP_DEFINE_CONST_FUN_OBJ_KW(floppyio_flux_readinto_obj, 0, floppyio_flux_readinto
 //|
 //|     The track is assumed to consist of 512-byte sectors.
 //|
+//|     Sectors are decoded as the flux transitions arrive, so no flux buffer is
+//|     needed and a track takes about one revolution per pass. Use `flux_readinto`
+//|     instead to get the raw timings, for example to decode other formats.
+//|
 //|     The function returns when all sectors have been successfully read, or
 //|     a number of index pulses have occurred.  Due to technical limitations, this
 //|     process may not be interruptible by KeyboardInterrupt.
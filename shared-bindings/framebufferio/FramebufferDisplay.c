@@ -209,6 +209,27 @@ MP_PROPERTY_GETSET(framebufferio_framebufferdisplay_brightness_obj,
     (mp_obj_t)&framebufferio_framebufferdisplay_get_brightness_obj,
     (mp_obj_t)&framebufferio_framebufferdisplay_set_brightness_obj);
 
+//|     dither: bool
+//|     """True when a one bit grayscale display dithers the shades of its content as it
+//|     refreshes. Otherwise each pixel is black or white by its brightness. Changing it
+//|     redraws the whole display."""
+STATIC mp_obj_t framebufferio_framebufferdisplay_obj_get_dither(mp_obj_t self_in) {
+    framebufferio_framebufferdisplay_obj_t *self = native_display(self_in);
+    return mp_obj_new_bool(common_hal_framebufferio_framebufferdisplay_get_dither(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(framebufferio_framebufferdisplay_get_dither_obj, framebufferio_framebufferdisplay_obj_get_dither);
+
+STATIC mp_obj_t framebufferio_framebufferdisplay_obj_set_dither(mp_obj_t self_in, mp_obj_t dither) {
+    framebufferio_framebufferdisplay_obj_t *self = native_display(self_in);
+    common_hal_framebufferio_framebufferdisplay_set_dither(self, mp_obj_is_true(dither));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(framebufferio_framebufferdisplay_set_dither_obj, framebufferio_framebufferdisplay_obj_set_dither);
+
+MP_PROPERTY_GETSET(framebufferio_framebufferdisplay_dither_obj,
+    (mp_obj_t)&framebufferio_framebufferdisplay_get_dither_obj,
+    (mp_obj_t)&framebufferio_framebufferdisplay_set_dither_obj);
+
 //|     width: int
 //|     """Gets the width of the framebuffer"""
 STATIC mp_obj_t framebufferio_framebufferdisplay_obj_get_width(mp_obj_t self_in) {
@@ -362,6 +383,7 @@ STATIC const mp_rom_map_elem_t framebufferio_framebufferdisplay_locals_dict_tabl
     { MP_ROM_QSTR(MP_QSTR_auto_refresh), MP_ROM_PTR(&framebufferio_framebufferdisplay_auto_refresh_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_brightness), MP_ROM_PTR(&framebufferio_framebufferdisplay_brightness_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dither), MP_ROM_PTR(&framebufferio_framebufferdisplay_dither_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&framebufferio_framebufferdisplay_width_obj) },
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&framebufferio_framebufferdisplay_height_obj) },
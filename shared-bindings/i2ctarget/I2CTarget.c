@@ -135,7 +135,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(i2ctarget_i2c_target___exit___obj, 4,
 //|         :param float timeout: Timeout in seconds. Zero means wait forever, a negative value means check once
 //|         :return: I2CTargetRequest or None if timeout=-1 and there's no request
 //|         :rtype: ~i2ctarget.I2CTargetRequest"""
-//|
+//|         ...
 STATIC mp_obj_t i2ctarget_i2c_target_request(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     mp_check_self(mp_obj_is_type(pos_args[0], &i2ctarget_i2c_target_type));
     i2ctarget_i2c_target_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
@@ -204,11 +204,64 @@ STATIC mp_obj_t i2ctarget_i2c_target_request(size_t n_args, const mp_obj_t *pos_
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(i2ctarget_i2c_target_request_obj, 1, i2ctarget_i2c_target_request);
 
+// Ports that can't serve registers without Python raise NotImplementedError.
+MP_WEAK void common_hal_i2ctarget_i2c_target_serve_registers(i2ctarget_i2c_target_obj_t *self, mp_obj_t registers) {
+    mp_raise_NotImplementedError(NULL);
+}
+
+MP_WEAK bool common_hal_i2ctarget_i2c_target_take_changed_registers(i2ctarget_i2c_target_obj_t *self, size_t *start, size_t *end) {
+    return false;
+}
+
+//|     def serve_registers(self, registers: Optional[ReadableBuffer]) -> None:
+//|         """Answer the controller from ``registers`` without involving Python,
+//|         like a typical sensor. Pass None to stop.
+//|
+//|         The first byte of each write selects a register. The rest are stored
+//|         from there on, and reads return bytes from there on, moving to the next
+//|         register after each byte and wrapping around at the end. Writes are
+//|         ignored when ``registers`` is read-only.
+//|
+//|         While registers are served, `request` doesn't see any transfers.
+//|
+//|         :param ~circuitpython_typing.ReadableBuffer registers: up to 256 bytes, used in place"""
+//|         ...
+STATIC mp_obj_t i2ctarget_i2c_target_serve_registers(mp_obj_t self_in, mp_obj_t registers) {
+    i2ctarget_i2c_target_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_i2ctarget_i2c_target_deinited(self)) {
+        raise_deinited_error();
+    }
+    common_hal_i2ctarget_i2c_target_serve_registers(self, registers);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(i2ctarget_i2c_target_serve_registers_obj, i2ctarget_i2c_target_serve_registers);
+
+//|     def changed_registers(self) -> Optional[Tuple[int, int]]:
+//|         """Get the ``(start, end)`` range of the registers written by the controller
+//|         since the last call, or None when there weren't any."""
+//|
+STATIC mp_obj_t i2ctarget_i2c_target_changed_registers(mp_obj_t self_in) {
+    i2ctarget_i2c_target_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_i2ctarget_i2c_target_deinited(self)) {
+        raise_deinited_error();
+    }
+    size_t start;
+    size_t end;
+    if (!common_hal_i2ctarget_i2c_target_take_changed_registers(self, &start, &end)) {
+        return mp_const_none;
+    }
+    mp_obj_t range[2] = { MP_OBJ_NEW_SMALL_INT(start), MP_OBJ_NEW_SMALL_INT(end) };
+    return mp_obj_new_tuple(2, range);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(i2ctarget_i2c_target_changed_registers_obj, i2ctarget_i2c_target_changed_registers);
+
 STATIC const mp_rom_map_elem_t i2ctarget_i2c_target_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&i2ctarget_i2c_target_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&i2ctarget_i2c_target___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_request), MP_ROM_PTR(&i2ctarget_i2c_target_request_obj) },
+    { MP_ROM_QSTR(MP_QSTR_serve_registers), MP_ROM_PTR(&i2ctarget_i2c_target_serve_registers_obj) },
+    { MP_ROM_QSTR(MP_QSTR_changed_registers), MP_ROM_PTR(&i2ctarget_i2c_target_changed_registers_obj) },
 
 };
 
@@ -56,5 +56,8 @@ extern int common_hal_i2ctarget_i2c_target_read_byte(i2ctarget_i2c_target_obj_t
 extern int common_hal_i2ctarget_i2c_target_write_byte(i2ctarget_i2c_target_obj_t *self, uint8_t data);
 extern void common_hal_i2ctarget_i2c_target_ack(i2ctarget_i2c_target_obj_t *self, bool ack);
 extern void common_hal_i2ctarget_i2c_target_close(i2ctarget_i2c_target_obj_t *self);
+extern void common_hal_i2ctarget_i2c_target_serve_registers(i2ctarget_i2c_target_obj_t *self, mp_obj_t registers);
+extern bool common_hal_i2ctarget_i2c_target_take_changed_registers(i2ctarget_i2c_target_obj_t *self,
+    size_t *start, size_t *end);
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_BUSIO_I2C_TARGET_H
@@ -125,6 +125,20 @@ STATIC mp_obj_t imagecapture_parallelimagecapture_continuous_capture_get_frame(m
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(imagecapture_parallelimagecapture_continuous_capture_get_frame_obj, imagecapture_parallelimagecapture_continuous_capture_get_frame);
 
+//|     def continuous_capture_latest_frame(self) -> Optional[WriteableBuffer]:
+//|         """Return the most recent complete frame, one of the two buffers passed to
+//|         `continuous_capture_start`, without waiting. Returns `None` if no frame has been
+//|         completed since the last one was returned.
+//|
+//|         The returned buffer will be captured into again once the other buffer is complete,
+//|         so process it within about one frame time."""
+//|         ...
+STATIC mp_obj_t imagecapture_parallelimagecapture_continuous_capture_latest_frame(mp_obj_t self_in) {
+    imagecapture_parallelimagecapture_obj_t *self = (imagecapture_parallelimagecapture_obj_t *)self_in;
+    return common_hal_imagecapture_parallelimagecapture_continuous_capture_latest_frame(self);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(imagecapture_parallelimagecapture_continuous_capture_latest_frame_obj, imagecapture_parallelimagecapture_continuous_capture_latest_frame);
+
 
 
 //|     def continuous_capture_stop(self) -> None:
@@ -184,6 +198,7 @@ STATIC const mp_rom_map_elem_t imagecapture_parallelimagecapture_locals_dict_tab
     { MP_ROM_QSTR(MP_QSTR_continuous_capture_start), MP_ROM_PTR(&imagecapture_parallelimagecapture_continuous_capture_start_obj) },
     { MP_ROM_QSTR(MP_QSTR_continuous_capture_stop), MP_ROM_PTR(&imagecapture_parallelimagecapture_continuous_capture_stop_obj) },
     { MP_ROM_QSTR(MP_QSTR_continuous_capture_get_frame), MP_ROM_PTR(&imagecapture_parallelimagecapture_continuous_capture_get_frame_obj) },
+    { MP_ROM_QSTR(MP_QSTR_continuous_capture_latest_frame), MP_ROM_PTR(&imagecapture_parallelimagecapture_continuous_capture_latest_frame_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(imagecapture_parallelimagecapture_locals_dict, imagecapture_parallelimagecapture_locals_dict_table);
@@ -46,4 +46,5 @@ void common_hal_is31fl3741_send_reset(is31fl3741_IS31FL3741_obj_t *self);
 void common_hal_is31fl3741_set_current(is31fl3741_IS31FL3741_obj_t *self, uint8_t current);
 uint8_t common_hal_is31fl3741_get_current(is31fl3741_IS31FL3741_obj_t *self);
 void common_hal_is31fl3741_set_led(is31fl3741_IS31FL3741_obj_t *self, uint16_t led, uint8_t level, uint8_t page);
+void common_hal_is31fl3741_write_leds(is31fl3741_IS31FL3741_obj_t *self, uint16_t first, const uint8_t *levels, uint16_t count, uint8_t page);
 void common_hal_is31fl3741_draw_pixel(is31fl3741_IS31FL3741_obj_t *self, int16_t x, int16_t y, uint32_t color, uint16_t *mapping, uint8_t display_height);
@@ -26,10 +26,14 @@
 
 #include "py/obj.h"
 #include "py/builtin.h"
+#include "py/objtype.h"
 #include "py/runtime.h"
 
 #include "shared-bindings/bitmaptools/__init__.h"
 #include "shared-bindings/displayio/Bitmap.h"
+#if CIRCUITPY_BUSDISPLAY
+#include "shared-bindings/busdisplay/BusDisplay.h"
+#endif
 #include "shared-bindings/jpegio/JpegDecoder.h"
 #include "shared-module/jpegio/JpegDecoder.h"
 #include "shared-module/displayio/Bitmap.h"
@@ -105,7 +109,7 @@ MP_DEFINE_CONST_FUN_OBJ_2(jpegio_jpegdecoder_open_obj, jpegio_jpegdecoder_open);
 
 //|     def decode(
 //|         self,
-//|         bitmap: displayio.Bitmap,
+//|         bitmap: Union[displayio.Bitmap, busdisplay.BusDisplay],
 //|         scale: int = 0,
 //|         x: int = 0,
 //|         y: int = 0,
@@ -136,7 +140,20 @@ MP_DEFINE_CONST_FUN_OBJ_2(jpegio_jpegdecoder_open_obj, jpegio_jpegdecoder_open);
 //|         possible to repeatedly ``decode`` the same jpeg data, even if it is to
 //|         select different scales or crop regions from it.
 //|
-//|         :param Bitmap bitmap: Optional output buffer
+//|         The bitmap may also be a `busdisplay.BusDisplay`. Each block of the
+//|         image is then sent straight to the display as it is decoded, so no
+//|         bitmap is needed to hold it. ``x`` and ``y`` place it on the display.
+//|         This bypasses the display's ``root_group``, so set ``auto_refresh`` to
+//|         ``False`` first; the next refresh draws over the image. The display
+//|         must use 16 bit color and ``rotation=0``. ``skip_source_index`` and
+//|         ``skip_dest_index`` are not supported with a display.
+//|
+//|         Only the parts of the image that are cropped in and land inside the
+//|         bitmap or display are color converted, and decoding stops after the
+//|         last row that is needed. Combined with ``scale``, this lets a small
+//|         region of a large image be shown quickly.
+//|
+//|         :param Bitmap bitmap: Output bitmap or display
 //|         :param int scale: Scale factor from 0 to 3, inclusive.
 //|         :param int x: Horizontal pixel location in bitmap where source_bitmap upper-left
 //|                       corner will be placed
@@ -168,13 +185,32 @@ STATIC mp_obj_t jpegio_jpegdecoder_decode(mp_uint_t n_args, const mp_obj_t *pos_
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
+    int scale = args[ARG_scale].u_int;
+    mp_arg_validate_int_range(scale, 0, 3, MP_QSTR_scale);
+
     mp_obj_t bitmap_in = args[ARG_bitmap].u_obj;
+    #if CIRCUITPY_BUSDISPLAY
+    mp_obj_t native_display = mp_obj_cast_to_native_base(bitmap_in, &busdisplay_busdisplay_type);
+    if (native_display != MP_OBJ_NULL) {
+        mp_obj_assert_native_inited(native_display);
+        busdisplay_busdisplay_obj_t *display = MP_OBJ_TO_PTR(native_display);
+        if (!busdisplay_busdisplay_can_write_rgb565(display) ||
+            args[ARG_skip_source_index].u_obj != mp_const_none ||
+            args[ARG_skip_dest_index].u_obj != mp_const_none) {
+            mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_bitmap);
+        }
+        int width = common_hal_busdisplay_busdisplay_get_width(display);
+        int height = common_hal_busdisplay_busdisplay_get_height(display);
+        int x = mp_arg_validate_int_range(args[ARG_x].u_int, 0, width, MP_QSTR_x);
+        int y = mp_arg_validate_int_range(args[ARG_y].u_int, 0, height, MP_QSTR_y);
+        bitmaptools_rect_t lim = bitmaptools_validate_coord_range_pair(&args[ARG_x1], width, height);
+        common_hal_jpegio_jpegdecoder_decode_to_display(self, display, scale, x, y, &lim);
+        return mp_const_none;
+    }
+    #endif
     mp_arg_validate_type(bitmap_in, &displayio_bitmap_type, MP_QSTR_bitmap);
     displayio_bitmap_t *bitmap = MP_OBJ_TO_PTR(args[ARG_bitmap].u_obj);
 
-    int scale = args[ARG_scale].u_int;
-    mp_arg_validate_int_range(scale, 0, 3, MP_QSTR_scale);
-
     int x = mp_arg_validate_int_range(args[ARG_x].u_int, 0, bitmap->width, MP_QSTR_x);
     int y = mp_arg_validate_int_range(args[ARG_y].u_int, 0, bitmap->height, MP_QSTR_y);
     bitmaptools_rect_t lim = bitmaptools_validate_coord_range_pair(&args[ARG_x1], bitmap->width, bitmap->height);
@@ -28,6 +28,9 @@
 #include "py/stream.h"
 #include "shared-module/displayio/Bitmap.h"
 #include "shared-bindings/bitmaptools/__init__.h"
+#if CIRCUITPY_BUSDISPLAY
+#include "shared-module/busdisplay/BusDisplay.h"
+#endif
 
 extern const mp_obj_type_t jpegio_jpegdecoder_type;
 
@@ -43,3 +46,9 @@ void common_hal_jpegio_jpegdecoder_decode_into(
     bitmaptools_rect_t *lim,
     uint32_t skip_source_index, bool skip_source_index_none,
     uint32_t skip_dest_index, bool skip_dest_index_none);
+#if CIRCUITPY_BUSDISPLAY
+void common_hal_jpegio_jpegdecoder_decode_to_display(
+    jpegio_jpegdecoder_obj_t *self,
+    busdisplay_busdisplay_obj_t *display, int scale, int16_t x, int16_t y,
+    bitmaptools_rect_t *lim);
+#endif
@@ -84,6 +84,31 @@ STATIC mp_obj_t keypad_eventqueue_get_into(mp_obj_t self_in, mp_obj_t event_in)
 }
 MP_DEFINE_CONST_FUN_OBJ_2(keypad_eventqueue_get_into_obj, keypad_eventqueue_get_into);
 
+//|     def get_many(self, buffer: WriteableBuffer) -> int:
+//|         """Store as many of the next key transition events as fit in ``buffer``,
+//|         oldest first, and return how many were stored.
+//|
+//|         Each event takes three 32-bit values: the key number, 1 if the key was pressed or 0 if
+//|         it was released, and the timestamp, as `Event.timestamp` would give it. An
+//|         ``array.array("L")`` three times as long as the number of events wanted is a good fit.
+//|
+//|         Like ``get_into()``, this does not allocate storage, and it fetches many events
+//|         per call.
+//|
+//|         :return: the number of events stored
+//|         :rtype: int
+//|         """
+//|         ...
+STATIC mp_obj_t keypad_eventqueue_get_many(mp_obj_t self_in, mp_obj_t buffer_in) {
+    keypad_eventqueue_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_keypad_eventqueue_get_many(self, bufinfo.buf, bufinfo.len / KEYPAD_EVENTQUEUE_RECORD_SIZE));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(keypad_eventqueue_get_many_obj, keypad_eventqueue_get_many);
+
 //|     def clear(self) -> None:
 //|         """Clear any queued key transition events. Also sets `overflowed` to ``False``."""
 //|         ...
@@ -134,6 +159,7 @@ STATIC const mp_rom_map_elem_t keypad_eventqueue_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_clear),      MP_ROM_PTR(&keypad_eventqueue_clear_obj) },
     { MP_ROM_QSTR(MP_QSTR_get),        MP_ROM_PTR(&keypad_eventqueue_get_obj) },
     { MP_ROM_QSTR(MP_QSTR_get_into),   MP_ROM_PTR(&keypad_eventqueue_get_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_get_many),   MP_ROM_PTR(&keypad_eventqueue_get_many_obj) },
     { MP_ROM_QSTR(MP_QSTR_overflowed), MP_ROM_PTR(&keypad_eventqueue_overflowed_obj) },
 };
 
@@ -152,6 +178,14 @@ STATIC mp_uint_t eventqueue_ioctl(mp_obj_t self_in, mp_uint_t request, uintptr_t
             }
             return ret;
         }
+        case MP_STREAM_POLL_WAKE:
+            // Events are queued by background scanning, which wakes the main
+            // task. If one is already queued, there's no need to sleep.
+            if (common_hal_keypad_eventqueue_get_length(self)) {
+                *errcode = MP_EAGAIN;
+                return MP_STREAM_ERROR;
+            }
+            return 0;
         default:
             *errcode = MP_EINVAL;
             return MP_STREAM_ERROR;
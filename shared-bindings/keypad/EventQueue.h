@@ -38,6 +38,9 @@ void common_hal_keypad_eventqueue_clear(keypad_eventqueue_obj_t *self);
 size_t common_hal_keypad_eventqueue_get_length(keypad_eventqueue_obj_t *self);
 mp_obj_t common_hal_keypad_eventqueue_get(keypad_eventqueue_obj_t *self);
 bool common_hal_keypad_eventqueue_get_into(keypad_eventqueue_obj_t *self, keypad_event_obj_t *event);
+// Each record is three uint32_t: key number, pressed, timestamp.
+#define KEYPAD_EVENTQUEUE_RECORD_SIZE (3 * sizeof(uint32_t))
+size_t common_hal_keypad_eventqueue_get_many(keypad_eventqueue_obj_t *self, uint8_t *records, size_t max_events);
 
 bool common_hal_keypad_eventqueue_get_overflowed(keypad_eventqueue_obj_t *self);
 void common_hal_keypad_eventqueue_set_overflowed(keypad_eventqueue_obj_t *self, bool overflowed);
@@ -141,6 +141,11 @@ MP_PROPERTY_GETSET(mdns_server_instance_name_obj,
 //|         This doesn't allow for direct hostname lookup. To do that, use
 //|         `socketpool.SocketPool.getaddrinfo()`.
 //|
+//|         On the Pico W, services found in the last two minutes, or within their
+//|         record TTL if that is shorter, are returned straight away without
+//|         waiting for ``timeout``. A query then runs in the background to update
+//|         them for later calls.
+//|
 //|         :param str service_type: The service type such as "_http"
 //|         :param str protocol: The service protocol such as "_tcp"
 //|         :param float/int timeout: Time to wait for responses"""
@@ -0,0 +1,126 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/runtime.h"
+#include "shared-bindings/msgpack/Unpacker.h"
+
+//| class Unpacker:
+//|     """Incrementally unpack objects from msgpack data that arrives in pieces,
+//|     such as from a socket.
+//|
+//|     Data is added with `feed`, and iterating over the Unpacker returns each object
+//|     as soon as all of its bytes have arrived. An object may be split anywhere,
+//|     including inside nested arrays and maps.
+//|
+//|     Example::
+//|
+//|        import msgpack
+//|
+//|        unpacker = msgpack.Unpacker()
+//|        while True:
+//|            unpacker.feed(sock.recv(64))
+//|            for obj in unpacker:
+//|                print(obj)
+//|     """
+//|
+//|     def __init__(
+//|         self,
+//|         *,
+//|         ext_hook: Union[Callable[[int, bytes], object], None] = None,
+//|         use_list: bool = True,
+//|         use_memoryview: bool = False
+//|     ) -> None:
+//|         """
+//|         :param Optional[~circuitpython_typing.Callable[[int, bytes], object]] ext_hook: function called for objects in
+//|                msgpack ext format.
+//|         :param bool use_list: return array as list or tuple (use_list=False).
+//|         :param bool use_memoryview: return bin objects as read-only memoryviews of the
+//|                Unpacker's internal buffer instead of copying them into new bytes.
+//|                The views stay valid after more data is fed.
+//|         """
+//|         ...
+STATIC mp_obj_t mod_msgpack_unpacker_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_ext_hook, ARG_use_list, ARG_use_memoryview };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_ext_hook, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
+        { MP_QSTR_use_list, MP_ARG_KW_ONLY | MP_ARG_BOOL, { .u_bool = true } },
+        { MP_QSTR_use_memoryview, MP_ARG_KW_ONLY | MP_ARG_BOOL, { .u_bool = false } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t hook = args[ARG_ext_hook].u_obj;
+    if (hook != mp_const_none && !mp_obj_is_callable(hook)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("ext_hook is not a function"));
+    }
+
+    msgpack_unpacker_obj_t *self = mp_obj_malloc(msgpack_unpacker_obj_t, &mod_msgpack_unpacker_type);
+    common_hal_msgpack_unpacker_construct(self, hook, args[ARG_use_list].u_bool, args[ARG_use_memoryview].u_bool);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     def feed(self, data: ReadableBuffer) -> None:
+//|         """Add data to the end of the Unpacker's internal buffer. The data is copied."""
+//|         ...
+STATIC mp_obj_t mod_msgpack_unpacker_feed(mp_obj_t self_in, mp_obj_t data) {
+    msgpack_unpacker_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    common_hal_msgpack_unpacker_feed(self, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_msgpack_unpacker_feed_obj, mod_msgpack_unpacker_feed);
+
+//|     def __iter__(self) -> Iterator[object]:
+//|         """Returns itself since it is the iterator."""
+//|         ...
+//|     def __next__(self) -> object:
+//|         """Returns the next complete object. Raises `StopIteration` when the data fed so
+//|         far doesn't hold another one; iteration can resume after more is fed."""
+//|         ...
+//|
+STATIC mp_obj_t mod_msgpack_unpacker_iternext(mp_obj_t self_in) {
+    msgpack_unpacker_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_t obj = common_hal_msgpack_unpacker_next(self);
+    if (obj == MP_OBJ_NULL) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    return obj;
+}
+
+STATIC const mp_rom_map_elem_t mod_msgpack_unpacker_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_feed), MP_ROM_PTR(&mod_msgpack_unpacker_feed_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(mod_msgpack_unpacker_locals_dict, mod_msgpack_unpacker_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    mod_msgpack_unpacker_type,
+    MP_QSTR_Unpacker,
+    MP_TYPE_FLAG_ITER_IS_ITERNEXT,
+    make_new, mod_msgpack_unpacker_make_new,
+    locals_dict, &mod_msgpack_unpacker_locals_dict,
+    iter, mod_msgpack_unpacker_iternext
+    );
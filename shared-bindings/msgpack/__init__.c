@@ -30,6 +30,7 @@
 #include "shared-bindings/msgpack/__init__.h"
 #include "shared-module/msgpack/__init__.h"
 #include "shared-bindings/msgpack/ExtType.h"
+#include "shared-bindings/msgpack/Unpacker.h"
 
 #define MP_OBJ_IS_METH(o) (mp_obj_is_obj(o) && (((mp_obj_base_t *)MP_OBJ_TO_PTR(o))->type->name == MP_QSTR_bound_method))
 
@@ -122,6 +123,52 @@ STATIC mp_obj_t mod_msgpack_pack(size_t n_args, const mp_obj_t *pos_args, mp_map
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(mod_msgpack_pack_obj, 0, mod_msgpack_pack);
 
+//| def pack_into(
+//|     obj: object,
+//|     buffer: WriteableBuffer,
+//|     offset: int = 0,
+//|     *,
+//|     default: Union[Callable[[object], None], None] = None
+//| ) -> int:
+//|     """Write object to buffer in msgpack format, starting at offset, without going
+//|     through a stream. Raises `ValueError` if the packed object doesn't fit.
+//|
+//|     :param object obj: Object to convert to msgpack format.
+//|     :param ~circuitpython_typing.WriteableBuffer buffer: buffer to write to
+//|     :param int offset: index in buffer of the first byte written
+//|     :param Optional[~circuitpython_typing.Callable[[object], None]] default:
+//|           function called for python objects that do not have
+//|           a representation in msgpack format.
+//|
+//|     :return int: the number of bytes written.
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t mod_msgpack_pack_into(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_obj, ARG_buffer, ARG_offset, ARG_default };
+    STATIC const mp_arg_t allowed_args[] = {
+        { MP_QSTR_obj, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_offset, MP_ARG_INT, { .u_int = 0 } },
+        { MP_QSTR_default, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_obj = mp_const_none } },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t handler = args[ARG_default].u_obj;
+    if (handler != mp_const_none && !mp_obj_is_fun(handler) && !MP_OBJ_IS_METH(handler)) {
+        mp_raise_ValueError(MP_ERROR_TEXT("default is not a function"));
+    }
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_WRITE);
+    size_t offset = mp_arg_validate_int_range(args[ARG_offset].u_int, 0, bufinfo.len, MP_QSTR_offset);
+
+    size_t written = common_hal_msgpack_pack_into(args[ARG_obj].u_obj, (uint8_t *)bufinfo.buf + offset, bufinfo.len - offset, handler);
+    return MP_OBJ_NEW_SMALL_INT(written);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(mod_msgpack_pack_into_obj, 0, mod_msgpack_pack_into);
+
 
 //| def unpack(
 //|     stream: circuitpython_typing.ByteStream,
@@ -163,7 +210,9 @@ MP_DEFINE_CONST_FUN_OBJ_KW(mod_msgpack_unpack_obj, 0, mod_msgpack_unpack);
 STATIC const mp_rom_map_elem_t msgpack_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_msgpack) },
     { MP_ROM_QSTR(MP_QSTR_ExtType), MP_ROM_PTR(&mod_msgpack_exttype_type) },
+    { MP_ROM_QSTR(MP_QSTR_Unpacker), MP_ROM_PTR(&mod_msgpack_unpacker_type) },
     { MP_ROM_QSTR(MP_QSTR_pack), MP_ROM_PTR(&mod_msgpack_pack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pack_into), MP_ROM_PTR(&mod_msgpack_pack_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_unpack), MP_ROM_PTR(&mod_msgpack_unpack_obj) },
 };
 
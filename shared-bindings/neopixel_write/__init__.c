@@ -104,32 +104,117 @@ STATIC void check_for_deinit(digitalio_digitalinout_obj_t *self) {
 //|
 //| """
 //|
-//| def neopixel_write(digitalinout: digitalio.DigitalInOut, buf: ReadableBuffer) -> None:
+//| def neopixel_write(digitalinout: digitalio.DigitalInOut, buf: ReadableBuffer, *, background: bool = False) -> None:
 //|     """Write buf out on the given DigitalInOut.
 //|
 //|     :param ~digitalio.DigitalInOut digitalinout: the DigitalInOut to output with
 //|     :param ~circuitpython_typing.ReadableBuffer buf: The bytes to clock out. No assumption is made about color order
+//|     :param bool background: Return as soon as sending has started, on ports that can send in the background.
+//|       The data is copied first, so buf may be changed right away. Do not use or deinitialize
+//|       the DigitalInOut until `wait` returns or the next write starts.
 //|     """
 //|     ...
 //|
-STATIC mp_obj_t neopixel_write_neopixel_write_(mp_obj_t digitalinout_obj, mp_obj_t buf) {
-    const digitalio_digitalinout_obj_t *digitalinout =
-        mp_arg_validate_type(digitalinout_obj, &digitalio_digitalinout_type, MP_QSTR_digitalinout);
+STATIC mp_obj_t neopixel_write_neopixel_write_(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_digitalinout, ARG_buf, ARG_background };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_digitalinout, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_buf, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_background, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    digitalio_digitalinout_obj_t *digitalinout =
+        mp_arg_validate_type(args[ARG_digitalinout].u_obj, &digitalio_digitalinout_type, MP_QSTR_digitalinout);
 
     // Check to see if the NeoPixel has been deinited before writing to it.
-    check_for_deinit(digitalinout_obj);
+    check_for_deinit(digitalinout);
 
     mp_buffer_info_t bufinfo;
-    mp_get_buffer_raise(buf, &bufinfo, MP_BUFFER_READ);
+    mp_get_buffer_raise(args[ARG_buf].u_obj, &bufinfo, MP_BUFFER_READ);
+    #if CIRCUITPY_NEOPIXEL_WRITE_PARALLEL
+    if (args[ARG_background].u_bool) {
+        common_hal_neopixel_write_parallel(&digitalinout, 1, bufinfo.buf, bufinfo.len, true);
+        return mp_const_none;
+    }
+    #endif
     // Call platform's neopixel write function with provided buffer and options.
     common_hal_neopixel_write(digitalinout, (uint8_t *)bufinfo.buf, bufinfo.len);
     return mp_const_none;
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_2(neopixel_write_neopixel_write_obj, neopixel_write_neopixel_write_);
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(neopixel_write_neopixel_write_obj, 2, neopixel_write_neopixel_write_);
+
+#if CIRCUITPY_NEOPIXEL_WRITE_PARALLEL
+//| def neopixel_write_parallel(
+//|     digitalinouts: Sequence[digitalio.DigitalInOut], buf: ReadableBuffer, *, background: bool = False
+//| ) -> None:
+//|     """Write buf out to up to 8 strands at once.
+//|
+//|     The strands all take the same number of bytes, interleaved in buf: the first byte of each strand
+//|     in the order of ``digitalinouts``, then the second byte of each, and so on. For example, the
+//|     first pixel of the second of 3 RGB strands is ``buf[1]``, ``buf[4]`` and ``buf[7]``.
+//|
+//|     :param Sequence[~digitalio.DigitalInOut] digitalinouts: the DigitalInOuts to output with.
+//|       Some ports need their pins to be consecutive, in order.
+//|     :param ~circuitpython_typing.ReadableBuffer buf: The bytes to clock out. Its length must
+//|       be a multiple of the number of strands
+//|     :param bool background: Return as soon as sending has started, as in `neopixel_write`
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t neopixel_write_neopixel_write_parallel(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_digitalinouts, ARG_buf, ARG_background };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_digitalinouts, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_buf, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_background, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    size_t count;
+    mp_obj_t *items;
+    mp_obj_get_array(args[ARG_digitalinouts].u_obj, &count, &items);
+    mp_arg_validate_length_range(count, 1, NEOPIXEL_WRITE_MAX_STRANDS, MP_QSTR_digitalinouts);
+
+    digitalio_digitalinout_obj_t *digitalinouts[NEOPIXEL_WRITE_MAX_STRANDS];
+    for (size_t i = 0; i < count; i++) {
+        digitalinouts[i] = mp_arg_validate_type(items[i], &digitalio_digitalinout_type, MP_QSTR_digitalinouts);
+        check_for_deinit(digitalinouts[i]);
+    }
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buf].u_obj, &bufinfo, MP_BUFFER_READ);
+    if (bufinfo.len % count != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("Invalid %q"), MP_QSTR_buf);
+    }
+
+    common_hal_neopixel_write_parallel(digitalinouts, count, bufinfo.buf, bufinfo.len, args[ARG_background].u_bool);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(neopixel_write_neopixel_write_parallel_obj, 2, neopixel_write_neopixel_write_parallel);
+#endif
+
+//| def wait() -> None:
+//|     """Wait for a background write to finish. Returns right away if there isn't one."""
+//|     ...
+//|
+STATIC mp_obj_t neopixel_write_wait(void) {
+    #if CIRCUITPY_NEOPIXEL_WRITE_PARALLEL
+    common_hal_neopixel_write_wait();
+    #endif
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_0(neopixel_write_wait_obj, neopixel_write_wait);
 
 STATIC const mp_rom_map_elem_t neopixel_write_module_globals_table[] = {
     { MP_OBJ_NEW_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(MP_QSTR_neopixel_write) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_neopixel_write), (mp_obj_t)&neopixel_write_neopixel_write_obj },
+    #if CIRCUITPY_NEOPIXEL_WRITE_PARALLEL
+    { MP_OBJ_NEW_QSTR(MP_QSTR_neopixel_write_parallel), (mp_obj_t)&neopixel_write_neopixel_write_parallel_obj },
+    #endif
+    { MP_OBJ_NEW_QSTR(MP_QSTR_wait), (mp_obj_t)&neopixel_write_wait_obj },
 };
 
 STATIC MP_DEFINE_CONST_DICT(neopixel_write_module_globals, neopixel_write_module_globals_table);
@@ -27,6 +27,7 @@
 #ifndef MICROPY_INCLUDED_SHARED_BINDINGS_NEOPIXEL_WRITE_H
 #define MICROPY_INCLUDED_SHARED_BINDINGS_NEOPIXEL_WRITE_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -34,4 +35,12 @@
 
 extern void common_hal_neopixel_write(const digitalio_digitalinout_obj_t *gpio, uint8_t *pixels, uint32_t numBytes);
 
+#define NEOPIXEL_WRITE_MAX_STRANDS (8)
+
+// Sends pixels interleaved byte by byte to count strands, and returns as soon as it has
+// started when background is true. Waits for any earlier write first.
+extern void common_hal_neopixel_write_parallel(digitalio_digitalinout_obj_t *const *gpios, size_t count,
+    const uint8_t *pixels, uint32_t numBytes, bool background);
+extern void common_hal_neopixel_write_wait(void);
+
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_NEOPIXEL_WRITE_H
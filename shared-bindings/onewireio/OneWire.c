@@ -130,7 +130,6 @@ MP_DEFINE_CONST_FUN_OBJ_1(onewireio_onewire_read_bit_obj, onewireio_onewire_obj_
 //|     def write_bit(self, value: bool) -> None:
 //|         """Write out a bit based on value."""
 //|         ...
-//|
 STATIC mp_obj_t onewireio_onewire_obj_write_bit(mp_obj_t self_in, mp_obj_t bool_obj) {
     onewireio_onewire_obj_t *self = MP_OBJ_TO_PTR(self_in);
     check_for_deinit(self);
@@ -140,6 +139,118 @@ STATIC mp_obj_t onewireio_onewire_obj_write_bit(mp_obj_t self_in, mp_obj_t bool_
 }
 MP_DEFINE_CONST_FUN_OBJ_2(onewireio_onewire_write_bit_obj, onewireio_onewire_obj_write_bit);
 
+//|     def write(self, buffer: ReadableBuffer) -> None:
+//|         """Write out every byte in buffer, least significant bit first."""
+//|         ...
+STATIC mp_obj_t onewireio_onewire_obj_write(mp_obj_t self_in, mp_obj_t buffer_obj) {
+    onewireio_onewire_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_obj, &bufinfo, MP_BUFFER_READ);
+    common_hal_onewireio_onewire_write(self, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(onewireio_onewire_write_obj, onewireio_onewire_obj_write);
+
+//|     def readinto(self, buffer: WriteableBuffer) -> None:
+//|         """Read bytes into buffer until it is full, least significant bit first."""
+//|         ...
+STATIC mp_obj_t onewireio_onewire_obj_readinto(mp_obj_t self_in, mp_obj_t buffer_obj) {
+    onewireio_onewire_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_obj, &bufinfo, MP_BUFFER_WRITE);
+    common_hal_onewireio_onewire_readinto(self, bufinfo.buf, bufinfo.len);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(onewireio_onewire_readinto_obj, onewireio_onewire_obj_readinto);
+
+//|     def search(self, *, max_devices: int = 16) -> List[bytes]:
+//|         """Find the ROM codes of the devices on the bus. Codes with a bad CRC are left out.
+//|
+//|         :param int max_devices: Stop after finding this many devices
+//|         :returns: An 8 byte ROM code for each device found
+//|         :rtype: List[bytes]"""
+//|         ...
+STATIC mp_obj_t onewireio_onewire_obj_search(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_max_devices };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_max_devices, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 16} },
+    };
+    onewireio_onewire_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    size_t max_devices = (size_t)mp_arg_validate_int_range(args[ARG_max_devices].u_int, 1, 256, MP_QSTR_max_devices);
+
+    uint8_t *roms = m_new(uint8_t, max_devices * 8);
+    size_t found = common_hal_onewireio_onewire_search(self, roms, max_devices);
+    mp_obj_t list = mp_obj_new_list(found, NULL);
+    for (size_t i = 0; i < found; i++) {
+        mp_obj_list_store(list, MP_OBJ_NEW_SMALL_INT(i), mp_obj_new_bytes(roms + i * 8, 8));
+    }
+    m_del(uint8_t, roms, max_devices * 8);
+    return list;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(onewireio_onewire_search_obj, 1, onewireio_onewire_obj_search);
+
+//|     def read_scratchpads(
+//|         self, roms: Sequence[ReadableBuffer], *, command: int = 0xBE, length: int = 9
+//|     ) -> List[Optional[bytearray]]:
+//|         """Address each device in turn with MATCH ROM, send it ``command`` and read
+//|         ``length`` bytes back. This reads a whole bus of sensors in one call::
+//|
+//|           onewire.reset()
+//|           onewire.write(b"\\xcc\\x44")  # SKIP ROM, CONVERT T on every device
+//|           time.sleep(0.75)
+//|           for rom, data in zip(roms, onewire.read_scratchpads(roms)):
+//|               print(rom.hex(), data)
+//|
+//|         :param Sequence[ReadableBuffer] roms: 8 byte ROM codes, such as those from `search`
+//|         :param int command: Function command to send after the ROM code
+//|         :param int length: Number of bytes to read from each device
+//|         :returns: The bytes read from each device, or None when no device answered the reset
+//|         :rtype: List[Optional[bytearray]]"""
+//|         ...
+//|
+STATIC mp_obj_t onewireio_onewire_obj_read_scratchpads(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_roms, ARG_command, ARG_length };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_roms, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_command, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0xbe} },
+        { MP_QSTR_length, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 9} },
+    };
+    onewireio_onewire_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    const uint8_t command = (uint8_t)mp_arg_validate_int_range(args[ARG_command].u_int, 0, 255, MP_QSTR_command);
+    const size_t length = (size_t)mp_arg_validate_int_range(args[ARG_length].u_int, 0, 255, MP_QSTR_length);
+
+    size_t rom_count;
+    mp_obj_t *rom_objs;
+    mp_obj_get_array(args[ARG_roms].u_obj, &rom_count, &rom_objs);
+
+    mp_obj_t list = mp_obj_new_list(rom_count, NULL);
+    for (size_t i = 0; i < rom_count; i++) {
+        mp_buffer_info_t rominfo;
+        mp_get_buffer_raise(rom_objs[i], &rominfo, MP_BUFFER_READ);
+        mp_arg_validate_length(rominfo.len, 8, MP_QSTR_roms);
+
+        mp_obj_t data = mp_obj_new_bytearray(length, NULL);
+        mp_buffer_info_t datainfo;
+        mp_get_buffer_raise(data, &datainfo, MP_BUFFER_WRITE);
+        if (!common_hal_onewireio_onewire_transact(self, rominfo.buf, &command, 1, datainfo.buf, length)) {
+            data = mp_const_none;
+        }
+        mp_obj_list_store(list, MP_OBJ_NEW_SMALL_INT(i), data);
+    }
+    return list;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(onewireio_onewire_read_scratchpads_obj, 1, onewireio_onewire_obj_read_scratchpads);
+
 STATIC const mp_rom_map_elem_t onewireio_onewire_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&onewireio_onewire_deinit_obj) },
@@ -148,6 +259,10 @@ STATIC const mp_rom_map_elem_t onewireio_onewire_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_reset), MP_ROM_PTR(&onewireio_onewire_reset_obj) },
     { MP_ROM_QSTR(MP_QSTR_read_bit), MP_ROM_PTR(&onewireio_onewire_read_bit_obj) },
     { MP_ROM_QSTR(MP_QSTR_write_bit), MP_ROM_PTR(&onewireio_onewire_write_bit_obj) },
+    { MP_ROM_QSTR(MP_QSTR_write), MP_ROM_PTR(&onewireio_onewire_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&onewireio_onewire_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_search), MP_ROM_PTR(&onewireio_onewire_search_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_scratchpads), MP_ROM_PTR(&onewireio_onewire_read_scratchpads_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(onewireio_onewire_locals_dict, onewireio_onewire_locals_dict_table);
 
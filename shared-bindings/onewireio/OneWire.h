@@ -39,5 +39,10 @@ extern bool common_hal_onewireio_onewire_deinited(onewireio_onewire_obj_t *self)
 extern bool common_hal_onewireio_onewire_reset(onewireio_onewire_obj_t *self);
 extern bool common_hal_onewireio_onewire_read_bit(onewireio_onewire_obj_t *self);
 extern void common_hal_onewireio_onewire_write_bit(onewireio_onewire_obj_t *self, bool bit);
+extern void common_hal_onewireio_onewire_write(onewireio_onewire_obj_t *self, const uint8_t *data, size_t len);
+extern void common_hal_onewireio_onewire_readinto(onewireio_onewire_obj_t *self, uint8_t *data, size_t len);
+extern size_t common_hal_onewireio_onewire_search(onewireio_onewire_obj_t *self, uint8_t *roms, size_t max_roms);
+extern bool common_hal_onewireio_onewire_transact(onewireio_onewire_obj_t *self, const uint8_t *rom,
+    const uint8_t *command, size_t command_len, uint8_t *data, size_t data_len);
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_ONEWIREIO_ONEWIRE_H
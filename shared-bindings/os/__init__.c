@@ -36,6 +36,7 @@
 #include "py/objstr.h"
 #include "py/runtime.h"
 #include "shared-bindings/os/__init__.h"
+#include "shared-bindings/os/DirEntry.h"
 
 //| """functions that an OS normally provides
 //|
@@ -141,6 +142,27 @@ STATIC mp_obj_t os_listdir(size_t n_args, const mp_obj_t *args) {
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(os_listdir_obj, 0, 1, os_listdir);
 
+//| def scandir(path: Optional[str] = None) -> Iterator[DirEntry]:
+//|     """Return an iterator of `os.DirEntry` objects for the entries in the given
+//|     directory, or in the current directory if none is given.
+//|
+//|     Entries are read one at a time as the iterator advances, so no list of the
+//|     whole directory is built. On FAT filesystems each entry already knows its
+//|     type, size and modification time, which makes this much faster than calling
+//|     `os.stat()` on each name from `os.listdir()`."""
+//|     ...
+//|
+STATIC mp_obj_t os_scandir(size_t n_args, const mp_obj_t *args) {
+    const char *path;
+    if (n_args == 1 && args[0] != mp_const_none) {
+        path = mp_obj_str_get_str(args[0]);
+    } else {
+        path = mp_obj_str_get_str(common_hal_os_getcwd());
+    }
+    return common_hal_os_scandir(path);
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(os_scandir_obj, 0, 1, os_scandir);
+
 //| def mkdir(path: str) -> None:
 //|     """Create a new directory."""
 //|     ...
@@ -289,6 +311,8 @@ STATIC const mp_rom_map_elem_t os_module_globals_table[] = {
 
     { MP_ROM_QSTR(MP_QSTR_uname), MP_ROM_PTR(&os_uname_obj) },
 
+    { MP_ROM_QSTR(MP_QSTR_DirEntry), MP_ROM_PTR(&os_direntry_type) },
+
     { MP_ROM_QSTR(MP_QSTR_chdir), MP_ROM_PTR(&os_chdir_obj) },
     { MP_ROM_QSTR(MP_QSTR_getcwd), MP_ROM_PTR(&os_getcwd_obj) },
     { MP_ROM_QSTR(MP_QSTR_getenv), MP_ROM_PTR(&os_getenv_obj) },
@@ -297,6 +321,7 @@ STATIC const mp_rom_map_elem_t os_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_remove), MP_ROM_PTR(&os_remove_obj) },
     { MP_ROM_QSTR(MP_QSTR_rename), MP_ROM_PTR(&os_rename_obj) },
     { MP_ROM_QSTR(MP_QSTR_rmdir), MP_ROM_PTR(&os_rmdir_obj) },
+    { MP_ROM_QSTR(MP_QSTR_scandir), MP_ROM_PTR(&os_scandir_obj) },
     { MP_ROM_QSTR(MP_QSTR_stat), MP_ROM_PTR(&os_stat_obj) },
     { MP_ROM_QSTR(MP_QSTR_statvfs), MP_ROM_PTR(&os_statvfs_obj) },
     { MP_ROM_QSTR(MP_QSTR_unlink), MP_ROM_PTR(&os_remove_obj) }, // unlink aliases to remove
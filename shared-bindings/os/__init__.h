@@ -41,6 +41,7 @@ mp_obj_t common_hal_os_getenv(const char *key, mp_obj_t default_);
 mp_obj_t common_hal_os_getenv_path(const char *path, const char *key, mp_obj_t default_);
 
 mp_obj_t common_hal_os_listdir(const char *path);
+mp_obj_t common_hal_os_scandir(const char *path);
 void common_hal_os_mkdir(const char *path);
 void common_hal_os_remove(const char *path);
 void common_hal_os_rename(const char *old_path, const char *new_path);
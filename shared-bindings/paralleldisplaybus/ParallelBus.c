@@ -60,6 +60,8 @@
 //|         :py:func:`displayio.release_displays` first, otherwise it will error after the first code.py run.
 //|
 //|         :param microcontroller.Pin data_pins: A list of data pins.  Specify exactly one of ``data_pins`` or ``data0``.
+//|           Some ports also accept a list of 16 data pins. Data bytes are then sent two per write with
+//|           the first byte on the upper eight pins, and commands are sent one byte per write on the lower eight.
 //|         :param microcontroller.Pin data0: The first data pin. The rest are implied
 //|         :param microcontroller.Pin command: Data or command pin
 //|         :param microcontroller.Pin chip_select: Chip select pin
@@ -27,6 +27,7 @@
 #include <stdint.h>
 
 #include "shared/runtime/context_manager_helpers.h"
+#include "py/binary.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
 #include "py/runtime0.h"
@@ -189,6 +190,32 @@ STATIC mp_obj_t pulseio_pulsein_obj_popleft(mp_obj_t self_in) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(pulseio_pulsein_popleft_obj, pulseio_pulsein_obj_popleft);
 
+//|     def readinto(self, buffer: WriteableBuffer) -> int:
+//|         """Removes the oldest read pulses and stores them in ``buffer``, which is typically
+//|         an ``array.array`` of type ``'H'``. This drains many pulses with one call instead
+//|         of one `popleft` per pulse.
+//|
+//|         :return: the number of pulses stored, which may be less than the length of ``buffer``
+//|         :rtype: int"""
+//|         ...
+STATIC mp_obj_t pulseio_pulsein_obj_readinto(mp_obj_t self_in, mp_obj_t buffer_in) {
+    pulseio_pulsein_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+    size_t capacity = bufinfo.len / mp_binary_get_size('@', bufinfo.typecode, NULL);
+
+    size_t count = 0;
+    while (count < capacity && common_hal_pulseio_pulsein_get_len(self) > 0) {
+        mp_binary_set_val_array(bufinfo.typecode, bufinfo.buf, count,
+            MP_OBJ_NEW_SMALL_INT(common_hal_pulseio_pulsein_popleft(self)));
+        count++;
+    }
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(pulseio_pulsein_readinto_obj, pulseio_pulsein_obj_readinto);
+
 //|     maxlen: int
 //|     """The maximum length of the PulseIn. When len() is equal to maxlen,
 //|     it is unclear which pulses are active and which are idle."""
@@ -282,6 +309,7 @@ STATIC const mp_rom_map_elem_t pulseio_pulsein_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_resume), MP_ROM_PTR(&pulseio_pulsein_resume_obj) },
     { MP_ROM_QSTR(MP_QSTR_clear), MP_ROM_PTR(&pulseio_pulsein_clear_obj) },
     { MP_ROM_QSTR(MP_QSTR_popleft), MP_ROM_PTR(&pulseio_pulsein_popleft_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&pulseio_pulsein_readinto_obj) },
 
     // Properties
     { MP_ROM_QSTR(MP_QSTR_maxlen), MP_ROM_PTR(&pulseio_pulsein_maxlen_obj) },
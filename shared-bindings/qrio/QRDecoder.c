@@ -69,17 +69,33 @@ STATIC void verify_buffer_size(qrio_qrdecoder_obj_t *self, mp_obj_t *buffer, siz
     mp_get_index(mp_obj_get_type(*buffer), len, MP_OBJ_NEW_SMALL_INT(sz - 1), false);
 }
 
+STATIC int validate_downscale(mp_int_t downscale) {
+    if (downscale != 1 && downscale != 2 && downscale != 4) {
+        mp_arg_error_invalid(MP_QSTR_downscale);
+    }
+    return downscale;
+}
+
 //|     def decode(
-//|         self, buffer: ReadableBuffer, pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE
+//|         self,
+//|         buffer: ReadableBuffer,
+//|         pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE,
+//|         *,
+//|         downscale: int = 1,
 //|     ) -> List[QRInfo]:
-//|         """Decode zero or more QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`."""
+//|         """Decode zero or more QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`.
+//|
+//|         With a ``downscale`` of 2 or 4, codes are located in an image averaged down by
+//|         that factor, which is several times faster. Any that can't be read at the lower
+//|         resolution are decoded again from just their region of the full image."""
 STATIC mp_obj_t qrio_qrdecoder_decode(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
 
-    enum { ARG_buffer, ARG_pixel_policy };
+    enum { ARG_buffer, ARG_pixel_policy, ARG_downscale };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_int = 0} },
         { MP_QSTR_pixel_policy, MP_ARG_OBJ, {.u_obj = MP_ROM_PTR((mp_obj_t *)&qrio_pixel_policy_EVERY_BYTE_obj)} },
+        { MP_QSTR_downscale, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -89,22 +105,32 @@ STATIC mp_obj_t qrio_qrdecoder_decode(size_t n_args, const mp_obj_t *pos_args, m
     qrio_pixel_policy_t policy = cp_enum_value(&qrio_pixel_policy_type, args[ARG_pixel_policy].u_obj, MP_QSTR_pixel_policy);
     verify_buffer_size(self, &args[ARG_buffer].u_obj, bufinfo.len, policy);
 
-    return shared_module_qrio_qrdecoder_decode(self, &bufinfo, policy);
+    int downscale = validate_downscale(args[ARG_downscale].u_int);
+
+    return shared_module_qrio_qrdecoder_decode(self, &bufinfo, policy, downscale);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(qrio_qrdecoder_decode_obj, 1, qrio_qrdecoder_decode);
 
 
 //|     def find(
-//|         self, buffer: ReadableBuffer, pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE
+//|         self,
+//|         buffer: ReadableBuffer,
+//|         pixel_policy: PixelPolicy = PixelPolicy.EVERY_BYTE,
+//|         *,
+//|         downscale: int = 1,
 //|     ) -> List[QRPosition]:
-//|         """Find all visible QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`."""
+//|         """Find all visible QR codes from the given image.  The size of the buffer must be at least ``length``×``width`` bytes for `EVERY_BYTE`, and 2×``length``×``width`` bytes for `EVEN_BYTES` or `ODD_BYTES`.
+//|
+//|         With a ``downscale`` of 2 or 4, codes are located in an image averaged down by
+//|         that factor. Positions are still given in pixels of the full image."""
 STATIC mp_obj_t qrio_qrdecoder_find(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     qrio_qrdecoder_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
 
-    enum { ARG_buffer, ARG_pixel_policy };
+    enum { ARG_buffer, ARG_pixel_policy, ARG_downscale };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_buffer, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_int = 0} },
         { MP_QSTR_pixel_policy, MP_ARG_OBJ, {.u_obj = MP_ROM_PTR((mp_obj_t *)&qrio_pixel_policy_EVERY_BYTE_obj)} },
+        { MP_QSTR_downscale, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -114,7 +140,9 @@ STATIC mp_obj_t qrio_qrdecoder_find(size_t n_args, const mp_obj_t *pos_args, mp_
     qrio_pixel_policy_t policy = cp_enum_value(&qrio_pixel_policy_type, args[ARG_pixel_policy].u_obj, MP_QSTR_pixel_policy);
     verify_buffer_size(self, &args[ARG_buffer].u_obj, bufinfo.len, policy);
 
-    return shared_module_qrio_qrdecoder_find(self, &bufinfo, policy);
+    int downscale = validate_downscale(args[ARG_downscale].u_int);
+
+    return shared_module_qrio_qrdecoder_find(self, &bufinfo, policy, downscale);
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(qrio_qrdecoder_find_obj, 1, qrio_qrdecoder_find);
 
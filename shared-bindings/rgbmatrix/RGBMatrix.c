@@ -382,8 +382,14 @@ STATIC void rgbmatrix_rgbmatrix_get_bufinfo(mp_obj_t self_in, mp_buffer_info_t *
 // These version exists so that the prototype matches the protocol,
 // avoiding a type cast that can hide errors
 STATIC void rgbmatrix_rgbmatrix_swapbuffers(mp_obj_t self_in, uint8_t *dirty_row_bitmap) {
-    (void)dirty_row_bitmap;
-    common_hal_rgbmatrix_rgbmatrix_refresh(self_in);
+    // Protomatter converts whole frames, so only skip frames with no changed rows.
+    int row_count = common_hal_rgbmatrix_rgbmatrix_get_height(self_in);
+    for (int i = 0; i < (row_count + 7) / 8; i++) {
+        if (dirty_row_bitmap[i] != 0) {
+            common_hal_rgbmatrix_rgbmatrix_refresh(self_in);
+            return;
+        }
+    }
 }
 
 STATIC void rgbmatrix_rgbmatrix_deinit_proto(mp_obj_t self_in) {
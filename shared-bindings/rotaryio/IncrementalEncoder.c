@@ -32,8 +32,16 @@
 #include "py/runtime0.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/rotaryio/IncrementalEncoder.h"
+#include "shared-bindings/time/__init__.h"
 #include "shared-bindings/util.h"
 
+// Start velocity over from the current position.
+STATIC void velocity_restart(rotaryio_incrementalencoder_obj_t *self) {
+    self->velocity.position = common_hal_rotaryio_incrementalencoder_get_position(self);
+    self->velocity.time_ns = common_hal_time_monotonic_ns();
+    self->velocity.counts_per_second = 0;
+}
+
 //| class IncrementalEncoder:
 //|     """IncrementalEncoder determines the relative rotational position based on two series of pulses.
 //|	   It assumes that the encoder's common pin(s) are connected to ground,and enables pull-ups on
@@ -82,6 +90,8 @@ STATIC mp_obj_t rotaryio_incrementalencoder_make_new(const mp_obj_type_t *type,
 
     common_hal_rotaryio_incrementalencoder_construct(self, pin_a, pin_b);
     common_hal_rotaryio_incrementalencoder_set_divisor(self, args[ARG_divisor].u_int);
+    self->velocity.window_ms = 100;
+    velocity_restart(self);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -147,7 +157,6 @@ MP_PROPERTY_GETSET(rotaryio_incrementalencoder_divisor_obj,
 //|     position: int
 //|     """The current position in terms of pulses. The number of pulses per rotation is defined by the
 //|     specific hardware and by the divisor."""
-//|
 STATIC mp_obj_t rotaryio_incrementalencoder_obj_get_position(mp_obj_t self_in) {
     rotaryio_incrementalencoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
     check_for_deinit(self);
@@ -161,6 +170,7 @@ STATIC mp_obj_t rotaryio_incrementalencoder_obj_set_position(mp_obj_t self_in, m
     check_for_deinit(self);
 
     common_hal_rotaryio_incrementalencoder_set_position(self, mp_obj_get_int(new_position));
+    velocity_restart(self);
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_2(rotaryio_incrementalencoder_set_position_obj, rotaryio_incrementalencoder_obj_set_position);
@@ -169,6 +179,57 @@ MP_PROPERTY_GETSET(rotaryio_incrementalencoder_position_obj,
     (mp_obj_t)&rotaryio_incrementalencoder_get_position_obj,
     (mp_obj_t)&rotaryio_incrementalencoder_set_position_obj);
 
+//|     velocity: float
+//|     """The speed in `position` counts per second, averaged over at least
+//|     `velocity_window`. It is updated when read, once the window has passed since
+//|     the last update, and is 0 until then. (read-only)"""
+STATIC mp_obj_t rotaryio_incrementalencoder_obj_get_velocity(mp_obj_t self_in) {
+    rotaryio_incrementalencoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    uint64_t now = common_hal_time_monotonic_ns();
+    uint64_t elapsed = now - self->velocity.time_ns;
+    if (elapsed >= (uint64_t)self->velocity.window_ms * 1000000) {
+        mp_int_t position = common_hal_rotaryio_incrementalencoder_get_position(self);
+        self->velocity.counts_per_second =
+            (mp_float_t)(position - self->velocity.position) * MICROPY_FLOAT_CONST(1e9) / (mp_float_t)elapsed;
+        self->velocity.position = position;
+        self->velocity.time_ns = now;
+    }
+    return mp_obj_new_float(self->velocity.counts_per_second);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rotaryio_incrementalencoder_get_velocity_obj, rotaryio_incrementalencoder_obj_get_velocity);
+
+MP_PROPERTY_GETTER(rotaryio_incrementalencoder_velocity_obj,
+    (mp_obj_t)&rotaryio_incrementalencoder_get_velocity_obj);
+
+//|     velocity_window: float
+//|     """The shortest time, in seconds, that `velocity` is measured over. Longer
+//|     windows give steadier readings of slow movement. Defaults to 0.1."""
+//|
+STATIC mp_obj_t rotaryio_incrementalencoder_obj_get_velocity_window(mp_obj_t self_in) {
+    rotaryio_incrementalencoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    return mp_obj_new_float(self->velocity.window_ms / MICROPY_FLOAT_CONST(1000.0));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(rotaryio_incrementalencoder_get_velocity_window_obj, rotaryio_incrementalencoder_obj_get_velocity_window);
+
+STATIC mp_obj_t rotaryio_incrementalencoder_obj_set_velocity_window(mp_obj_t self_in, mp_obj_t window_in) {
+    rotaryio_incrementalencoder_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+
+    mp_float_t window = mp_arg_validate_obj_float_range(window_in, 0, 60, MP_QSTR_velocity_window);
+    self->velocity.window_ms = (uint32_t)(window * 1000);
+    velocity_restart(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(rotaryio_incrementalencoder_set_velocity_window_obj, rotaryio_incrementalencoder_obj_set_velocity_window);
+
+MP_PROPERTY_GETSET(rotaryio_incrementalencoder_velocity_window_obj,
+    (mp_obj_t)&rotaryio_incrementalencoder_get_velocity_window_obj,
+    (mp_obj_t)&rotaryio_incrementalencoder_set_velocity_window_obj);
+
 STATIC const mp_rom_map_elem_t rotaryio_incrementalencoder_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&rotaryio_incrementalencoder_deinit_obj) },
@@ -176,6 +237,8 @@ STATIC const mp_rom_map_elem_t rotaryio_incrementalencoder_locals_dict_table[] =
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&rotaryio_incrementalencoder___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_position), MP_ROM_PTR(&rotaryio_incrementalencoder_position_obj) },
+    { MP_ROM_QSTR(MP_QSTR_velocity), MP_ROM_PTR(&rotaryio_incrementalencoder_velocity_obj) },
+    { MP_ROM_QSTR(MP_QSTR_velocity_window), MP_ROM_PTR(&rotaryio_incrementalencoder_velocity_window_obj) },
     { MP_ROM_QSTR(MP_QSTR_divisor), MP_ROM_PTR(&rotaryio_incrementalencoder_divisor_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(rotaryio_incrementalencoder_locals_dict, rotaryio_incrementalencoder_locals_dict_table);
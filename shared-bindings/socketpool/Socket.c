@@ -30,8 +30,10 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "py/binary.h"
 #include "py/mperrno.h"
 #include "py/objlist.h"
+#include "py/objproperty.h"
 #include "py/objtuple.h"
 #include "py/runtime.h"
 #include "py/stream.h"
@@ -172,7 +174,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_listen_obj, socketpool_socket
 //|
 //|         :param object buffer: buffer to read into"""
 //|         ...
-STATIC mp_obj_t socketpool_socket_recvfrom_into(mp_obj_t self_in, mp_obj_t data_in) {
+STATIC mp_obj_t _socketpool_socket_recvfrom_into(mp_obj_t self_in, mp_obj_t data_in) {
     socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(data_in, &bufinfo, MP_BUFFER_WRITE);
@@ -186,7 +188,66 @@ STATIC mp_obj_t socketpool_socket_recvfrom_into(mp_obj_t self_in, mp_obj_t data_
     tuple_contents[1] = netutils_format_inet_addr(ip, port, NETUTILS_BIG);
     return mp_obj_new_tuple(2, tuple_contents);
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_recvfrom_into_obj, socketpool_socket_recvfrom_into);
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_recvfrom_into_obj, _socketpool_socket_recvfrom_into);
+
+// Datagram i of a batch uses slot i of the buffer, lengths[i] and 6 bytes of addresses.
+STATIC size_t socketpool_socket_get_batch(mp_obj_t buffer_in, mp_obj_t lengths_in, mp_obj_t addresses_in,
+    mp_uint_t buffer_flags, mp_buffer_info_t *buffer, mp_buffer_info_t *lengths, mp_buffer_info_t *addresses) {
+    mp_get_buffer_raise(buffer_in, buffer, buffer_flags);
+    mp_get_buffer_raise(lengths_in, lengths, buffer_flags);
+    mp_get_buffer_raise(addresses_in, addresses, buffer_flags);
+    size_t n = lengths->len / mp_binary_get_size('@', lengths->typecode, NULL);
+    mp_arg_validate_length_min(addresses->len, 6 * n, MP_QSTR_addresses);
+    return n;
+}
+
+//|     def recvfrom_into_many(
+//|         self, buffer: WriteableBuffer, lengths: WriteableBuffer, addresses: WriteableBuffer
+//|     ) -> int:
+//|         """Reads several datagrams at once, without allocating anything for each one.
+//|
+//|         ``buffer`` is split into ``len(lengths)`` slots of equal size. The ``i``-th
+//|         datagram is read into slot ``i``, its length is stored in ``lengths[i]`` and the
+//|         address it came from in ``addresses[6 * i:6 * i + 6]``, as the four bytes of the
+//|         IPv4 address followed by the port in network byte order.
+//|
+//|         Waits for the first datagram as `recvfrom_into` does, then takes only the ones
+//|         that have already arrived.
+//|
+//|         Suits sockets of type SOCK_DGRAM
+//|         Returns the number of datagrams read.
+//|
+//|         :param WriteableBuffer buffer: buffer to read into
+//|         :param WriteableBuffer lengths: array of integers to store the lengths in, such as ``array.array("H", ...)``
+//|         :param WriteableBuffer addresses: buffer of at least ``6 * len(lengths)`` bytes for the addresses"""
+//|         ...
+STATIC mp_obj_t socketpool_socket_recvfrom_into_many(size_t n_args, const mp_obj_t *args) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_buffer_info_t buffer, lengths, addresses;
+    size_t n = socketpool_socket_get_batch(args[1], args[2], args[3], MP_BUFFER_WRITE, &buffer, &lengths, &addresses);
+    if (n == 0) {
+        return MP_OBJ_NEW_SMALL_INT(0);
+    }
+    size_t slot_len = buffer.len / n;
+    uint8_t *addr = addresses.buf;
+
+    uint32_t port;
+    mp_int_t received = common_hal_socketpool_socket_recvfrom_into(self, buffer.buf, slot_len, addr, &port);
+    size_t i = 0;
+    do {
+        mp_binary_set_val_array_from_int(lengths.typecode, lengths.buf, i, received);
+        addr[4] = port >> 8;
+        addr[5] = port;
+        addr += 6;
+        if (++i == n) {
+            break;
+        }
+        received = socketpool_socket_recvfrom_into(self, (uint8_t *)buffer.buf + i * slot_len, slot_len, addr, &port);
+    } while (received >= 0);
+
+    return MP_OBJ_NEW_SMALL_INT(i);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(socketpool_socket_recvfrom_into_many_obj, 4, 4, socketpool_socket_recvfrom_into_many);
 
 //|     def recv_into(self, buffer: WriteableBuffer, bufsize: int) -> int:
 //|         """Reads some bytes from the connected remote address, writing
@@ -258,6 +319,45 @@ STATIC mp_obj_t _socketpool_socket_send(mp_obj_t self_in, mp_obj_t buf_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_send_obj, _socketpool_socket_send);
 
+//|     def send_buffer(self, buffer: ReadableBuffer) -> int:
+//|         """Send some bytes to the connected remote address without copying them.
+//|         Suits sockets of type SOCK_STREAM
+//|
+//|         Only ``bytes`` and read-only `memoryview` objects, such as slices of
+//|         ``bytes``, are sent without copying, because they can't change while
+//|         they are being sent. Other buffers are copied as by `send`.
+//|
+//|         The socket keeps a reference to ``buffer`` and sends straight from it
+//|         until the remote end has acknowledged the bytes. The socket polls as not
+//|         writable until that happens and only holds one buffer at a time, so a
+//|         second call waits for the first buffer as `send` waits for room. Closing
+//|         the socket before the bytes are acknowledged resets the connection.
+//|
+//|         Pass a `memoryview` slice to send the rest of a buffer after a partial send.
+//|         Ports that can't send without copying behave as `send`.
+//|
+//|         :param ~circuitpython_typing.ReadableBuffer buffer: bytes to send
+//|         :return: the number of bytes queued"""
+//|         ...
+STATIC mp_obj_t _socketpool_socket_send_buffer(mp_obj_t self_in, mp_obj_t buf_in) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (common_hal_socketpool_socket_get_closed(self)) {
+        // Bad file number.
+        mp_raise_OSError(MP_EBADF);
+    }
+    if (!common_hal_socketpool_socket_get_connected(self)) {
+        mp_raise_BrokenPipeError();
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buf_in, &bufinfo, MP_BUFFER_READ);
+    mp_int_t ret = common_hal_socketpool_socket_send_buffer(self, buf_in, bufinfo.buf, bufinfo.len);
+    if (ret == -1) {
+        mp_raise_BrokenPipeError();
+    }
+    return mp_obj_new_int_from_uint(ret);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_send_buffer_obj, _socketpool_socket_send_buffer);
+
 //|     def sendall(self, bytes: ReadableBuffer) -> None:
 //|         """Send some bytes to the connected remote address.
 //|         Suits sockets of type SOCK_STREAM
@@ -298,6 +398,16 @@ STATIC mp_obj_t _socketpool_socket_sendall(mp_obj_t self_in, mp_obj_t buf_in) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_sendall_obj, _socketpool_socket_sendall);
 
+//|     def writev(self, bufs: Sequence[ReadableBuffer]) -> Optional[int]:
+//|         """Send each buffer in ``bufs`` in order, as if they had been joined into one,
+//|         without joining them in Python first. Stream sockets hand the pieces to the
+//|         network stack together; datagram sockets send one datagram per piece.
+//|
+//|         :return: the total number of bytes sent, or ``None`` if a non-blocking socket
+//|           couldn't send anything
+//|         :rtype: int"""
+//|         ...
+
 //|     def sendto(self, bytes: ReadableBuffer, address: Tuple[str, int]) -> int:
 //|         """Send some bytes to a specific address.
 //|         Suits sockets of type SOCK_DGRAM
@@ -305,7 +415,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_sendall_obj, _socketpool_sock
 //|         :param ~bytes bytes: some bytes to send
 //|         :param ~tuple address: tuple of (remote_address, remote_port)"""
 //|         ...
-STATIC mp_obj_t socketpool_socket_sendto(mp_obj_t self_in, mp_obj_t data_in, mp_obj_t addr_in) {
+STATIC mp_obj_t _socketpool_socket_sendto(mp_obj_t self_in, mp_obj_t data_in, mp_obj_t addr_in) {
     socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
 
     // get the data
@@ -326,7 +436,54 @@ STATIC mp_obj_t socketpool_socket_sendto(mp_obj_t self_in, mp_obj_t data_in, mp_
 
     return mp_obj_new_int_from_uint(ret);
 }
-STATIC MP_DEFINE_CONST_FUN_OBJ_3(socketpool_socket_sendto_obj, socketpool_socket_sendto);
+STATIC MP_DEFINE_CONST_FUN_OBJ_3(socketpool_socket_sendto_obj, _socketpool_socket_sendto);
+
+//|     def sendto_many(
+//|         self, buffer: ReadableBuffer, lengths: ReadableBuffer, addresses: ReadableBuffer
+//|     ) -> int:
+//|         """Sends several datagrams at once, laid out as `recvfrom_into_many` reads them.
+//|
+//|         ``buffer`` is split into ``len(lengths)`` slots of equal size. The ``i``-th
+//|         datagram is the first ``lengths[i]`` bytes of slot ``i``, sent to the address in
+//|         ``addresses[6 * i:6 * i + 6]``.
+//|
+//|         Stops at the first datagram that can't be sent. If that is the first one, raises
+//|         `OSError` as `sendto` does.
+//|
+//|         Suits sockets of type SOCK_DGRAM
+//|         Returns the number of datagrams sent.
+//|
+//|         :param ReadableBuffer buffer: the datagrams to send
+//|         :param ReadableBuffer lengths: array of the lengths of the datagrams
+//|         :param ReadableBuffer addresses: buffer of at least ``6 * len(lengths)`` bytes of addresses"""
+//|         ...
+STATIC mp_obj_t socketpool_socket_sendto_many(size_t n_args, const mp_obj_t *args) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    mp_buffer_info_t buffer, lengths, addresses;
+    size_t n = socketpool_socket_get_batch(args[1], args[2], args[3], MP_BUFFER_READ, &buffer, &lengths, &addresses);
+    if (n == 0) {
+        return MP_OBJ_NEW_SMALL_INT(0);
+    }
+    size_t slot_len = buffer.len / n;
+    const uint8_t *addr = addresses.buf;
+
+    size_t i = 0;
+    for (; i < n; i++, addr += 6) {
+        mp_int_t len = mp_obj_get_int(mp_binary_get_val_array(lengths.typecode, lengths.buf, i));
+        mp_arg_validate_int_range(len, 0, slot_len, MP_QSTR_lengths);
+        uint32_t port = (addr[4] << 8) | addr[5];
+        int sent = socketpool_socket_sendto(self, addr, port, (const uint8_t *)buffer.buf + i * slot_len, len);
+        if (sent < 0) {
+            if (i == 0) {
+                mp_raise_OSError(-sent);
+            }
+            break;
+        }
+    }
+
+    return MP_OBJ_NEW_SMALL_INT(i);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(socketpool_socket_sendto_many_obj, 4, 4, socketpool_socket_sendto_many);
 
 //|     def setblocking(self, flag: bool) -> Optional[int]:
 //|         """Set the blocking behaviour of this socket.
@@ -401,6 +558,23 @@ STATIC mp_obj_t socketpool_socket_settimeout(mp_obj_t self_in, mp_obj_t timeout_
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(socketpool_socket_settimeout_obj, socketpool_socket_settimeout);
 
+//|     datagrams_dropped: Optional[int]
+//|     """The number of datagrams that arrived while too many were waiting to be read, and so
+//|     were thrown away. ``None`` if the port can't tell. (read-only)"""
+//|
+STATIC mp_obj_t socketpool_socket_get_datagrams_dropped(mp_obj_t self_in) {
+    socketpool_socket_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_int_t dropped = common_hal_socketpool_socket_get_datagrams_dropped(self);
+    if (dropped < 0) {
+        return mp_const_none;
+    }
+    return mp_obj_new_int_from_uint(dropped);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(socketpool_socket_get_datagrams_dropped_obj, socketpool_socket_get_datagrams_dropped);
+
+MP_PROPERTY_GETTER(socketpool_socket_datagrams_dropped_obj,
+    (mp_obj_t)&socketpool_socket_get_datagrams_dropped_obj);
+
 STATIC const mp_rom_map_elem_t socketpool_socket_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&socketpool_socket___exit___obj) },
@@ -410,15 +584,20 @@ STATIC const mp_rom_map_elem_t socketpool_socket_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_bind), MP_ROM_PTR(&socketpool_socket_bind_obj) },
     { MP_ROM_QSTR(MP_QSTR_close), MP_ROM_PTR(&socketpool_socket_close_obj) },
     { MP_ROM_QSTR(MP_QSTR_connect), MP_ROM_PTR(&socketpool_socket_connect_obj) },
+    { MP_ROM_QSTR(MP_QSTR_datagrams_dropped), MP_ROM_PTR(&socketpool_socket_datagrams_dropped_obj) },
     { MP_ROM_QSTR(MP_QSTR_listen), MP_ROM_PTR(&socketpool_socket_listen_obj) },
     { MP_ROM_QSTR(MP_QSTR_recvfrom_into), MP_ROM_PTR(&socketpool_socket_recvfrom_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recvfrom_into_many), MP_ROM_PTR(&socketpool_socket_recvfrom_into_many_obj) },
     { MP_ROM_QSTR(MP_QSTR_recv_into), MP_ROM_PTR(&socketpool_socket_recv_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_send), MP_ROM_PTR(&socketpool_socket_send_obj) },
+    { MP_ROM_QSTR(MP_QSTR_send_buffer), MP_ROM_PTR(&socketpool_socket_send_buffer_obj) },
     { MP_ROM_QSTR(MP_QSTR_sendall), MP_ROM_PTR(&socketpool_socket_sendall_obj) },
     { MP_ROM_QSTR(MP_QSTR_sendto), MP_ROM_PTR(&socketpool_socket_sendto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sendto_many), MP_ROM_PTR(&socketpool_socket_sendto_many_obj) },
     { MP_ROM_QSTR(MP_QSTR_setblocking), MP_ROM_PTR(&socketpool_socket_setblocking_obj) },
     { MP_ROM_QSTR(MP_QSTR_setsockopt), MP_ROM_PTR(&socketpool_socket_setsockopt_obj) },
     { MP_ROM_QSTR(MP_QSTR_settimeout), MP_ROM_PTR(&socketpool_socket_settimeout_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writev), MP_ROM_PTR(&mp_stream_writev_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(socketpool_socket_locals_dict, socketpool_socket_locals_dict_table);
@@ -455,6 +634,21 @@ STATIC mp_uint_t socket_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t arg
         if ((flags & MP_STREAM_POLL_WR) && common_hal_socketpool_writable(self)) {
             ret |= MP_STREAM_POLL_WR;
         }
+    } else if (request == MP_STREAM_POLL_WAKE) {
+        ret = 0;
+        if (!common_hal_socketpool_socket_wake_when_ready(self, arg)) {
+            *errcode = MP_EINVAL;
+            ret = MP_STREAM_ERROR;
+        }
+    } else if (request == MP_STREAM_WRITEV) {
+        const mp_stream_writev_t *v = (const mp_stream_writev_t *)arg;
+        int sent = socketpool_socket_sendv(self, v->bufs, v->count);
+        if (sent < 0) {
+            *errcode = -sent;
+            ret = MP_STREAM_ERROR;
+        } else {
+            ret = sent;
+        }
     } else {
         *errcode = MP_EINVAL;
         ret = MP_STREAM_ERROR;
@@ -38,24 +38,40 @@ void common_hal_socketpool_socket_connect(socketpool_socket_obj_t *self, const c
 bool common_hal_socketpool_socket_get_closed(socketpool_socket_obj_t *self);
 bool common_hal_socketpool_socket_get_connected(socketpool_socket_obj_t *self);
 mp_uint_t common_hal_socketpool_socket_get_timeout(socketpool_socket_obj_t *self);
+// Returns -1 if the port doesn't count dropped datagrams.
+mp_int_t common_hal_socketpool_socket_get_datagrams_dropped(socketpool_socket_obj_t *self);
 bool common_hal_socketpool_socket_listen(socketpool_socket_obj_t *self, int backlog);
 mp_uint_t common_hal_socketpool_socket_recvfrom_into(socketpool_socket_obj_t *self,
     uint8_t *buf, uint32_t len, uint8_t *ip, uint32_t *port);
 mp_uint_t common_hal_socketpool_socket_recv_into(socketpool_socket_obj_t *self, const uint8_t *buf, uint32_t len);
 mp_uint_t common_hal_socketpool_socket_send(socketpool_socket_obj_t *self, const uint8_t *buf, uint32_t len);
+// Like send but may keep referring to buf, which is part of buffer, after returning.
+mp_uint_t common_hal_socketpool_socket_send_buffer(socketpool_socket_obj_t *self, mp_obj_t buffer, const uint8_t *buf, uint32_t len);
 mp_uint_t common_hal_socketpool_socket_sendto(socketpool_socket_obj_t *self,
     const char *host, size_t hostlen, uint32_t port, const uint8_t *buf, uint32_t len);
 void common_hal_socketpool_socket_settimeout(socketpool_socket_obj_t *self, uint32_t timeout_ms);
 int common_hal_socketpool_socket_setsockopt(socketpool_socket_obj_t *self, int level, int optname, const void *value, size_t optlen);
 bool common_hal_socketpool_readable(socketpool_socket_obj_t *self);
 bool common_hal_socketpool_writable(socketpool_socket_obj_t *self);
+// Arrange for the main task to be woken when the socket may be ready for the
+// given MP_STREAM_POLL_* flags. Returns false if the port can't do that.
+bool common_hal_socketpool_socket_wake_when_ready(socketpool_socket_obj_t *self, mp_uint_t flags);
 
 // Non-allocating versions for internal use.
 int socketpool_socket_accept(socketpool_socket_obj_t *self, uint8_t *ip, uint32_t *port, socketpool_socket_obj_t *accepted);
 void socketpool_socket_close(socketpool_socket_obj_t *self);
 int socketpool_socket_send(socketpool_socket_obj_t *self, const uint8_t *buf, uint32_t len);
+// Gathered send for MP_STREAM_WRITEV. Returns -MP_EINVAL if the socket type can
+// only send the pieces separately.
+int socketpool_socket_sendv(socketpool_socket_obj_t *self, const mp_buffer_info_t *bufs, size_t count);
 int socketpool_socket_recv_into(socketpool_socket_obj_t *self,
     const uint8_t *buf, uint32_t len);
+// Datagram versions that take a 4 byte IPv4 address and never wait. They return
+// a negative errno, -MP_EAGAIN when no datagram has arrived.
+int socketpool_socket_recvfrom_into(socketpool_socket_obj_t *self,
+    uint8_t *buf, uint32_t len, uint8_t *ip, uint32_t *port);
+int socketpool_socket_sendto(socketpool_socket_obj_t *self,
+    const uint8_t *ip, uint32_t port, const uint8_t *buf, uint32_t len);
 
 // Moves self to sock without closing the real socket. self will think its closed afterwards.
 void socketpool_socket_move(socketpool_socket_obj_t *self, socketpool_socket_obj_t *sock);
@@ -168,6 +168,31 @@ MP_PROPERTY_GETSET(ssl_sslcontext_check_hostname_obj,
     (mp_obj_t)&ssl_sslcontext_get_check_hostname_obj,
     (mp_obj_t)&ssl_sslcontext_set_check_hostname_obj);
 
+//|     session_cache: bool
+//|     """Whether client sockets resume the TLS session from the last connection to
+//|     the same server hostname, which is much quicker than a full handshake.
+//|     The sessions are kept across soft reloads, for a few servers at most.
+//|     Defaults to ``False``."""
+
+STATIC mp_obj_t ssl_sslcontext_get_session_cache(mp_obj_t self_in) {
+    ssl_sslcontext_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return mp_obj_new_bool(common_hal_ssl_sslcontext_get_session_cache(self));
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(ssl_sslcontext_get_session_cache_obj, ssl_sslcontext_get_session_cache);
+
+STATIC mp_obj_t ssl_sslcontext_set_session_cache(mp_obj_t self_in, mp_obj_t value) {
+    ssl_sslcontext_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    common_hal_ssl_sslcontext_set_session_cache(self, mp_obj_is_true(value));
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(ssl_sslcontext_set_session_cache_obj, ssl_sslcontext_set_session_cache);
+
+MP_PROPERTY_GETSET(ssl_sslcontext_session_cache_obj,
+    (mp_obj_t)&ssl_sslcontext_get_session_cache_obj,
+    (mp_obj_t)&ssl_sslcontext_set_session_cache_obj);
+
 //|     def wrap_socket(
 //|         self,
 //|         sock: socketpool.Socket,
@@ -212,6 +237,7 @@ STATIC const mp_rom_map_elem_t ssl_sslcontext_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_load_verify_locations), MP_ROM_PTR(&ssl_sslcontext_load_verify_locations_obj) },
     { MP_ROM_QSTR(MP_QSTR_set_default_verify_paths), MP_ROM_PTR(&ssl_sslcontext_set_default_verify_paths_obj) },
     { MP_ROM_QSTR(MP_QSTR_check_hostname), MP_ROM_PTR(&ssl_sslcontext_check_hostname_obj) },
+    { MP_ROM_QSTR(MP_QSTR_session_cache), MP_ROM_PTR(&ssl_sslcontext_session_cache_obj) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(ssl_sslcontext_locals_dict, ssl_sslcontext_locals_dict_table);
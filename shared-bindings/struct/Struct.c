@@ -0,0 +1,261 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/objlist.h"
+#include "py/objproperty.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+#include "shared-bindings/struct/Struct.h"
+
+//| class Struct:
+//|     """A format string compiled once, for packing and unpacking many records.
+//|
+//|     Use a `Struct` instead of the module level functions when the same format is
+//|     used repeatedly, as the format is only parsed when the `Struct` is created."""
+//|
+//|     def __init__(self, format: str) -> None:
+//|         """Compile ``format``, using the same syntax as the module level functions.
+//|
+//|         :param str format: the format string"""
+//|         ...
+STATIC mp_obj_t struct_struct_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_format };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_format, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t format = mp_arg_validate_type_string(args[ARG_format].u_obj, MP_QSTR_format);
+    size_t max_ops = common_hal_struct_struct_max_ops(format);
+    struct_struct_obj_t *self = mp_obj_malloc_var(struct_struct_obj_t, struct_struct_op_t, max_ops, &struct_struct_type);
+    common_hal_struct_struct_construct(self, format);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+// Returns the start of a record of self->size bytes at offset in buffer. A negative
+// offset counts from the end of the buffer.
+STATIC byte *struct_struct_get_record(struct_struct_obj_t *self, mp_obj_t buffer, mp_int_t offset, mp_uint_t flags, bool exact_size) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, flags);
+    size_t size = common_hal_struct_struct_get_size(self);
+
+    if (exact_size) {
+        if (bufinfo.len != size) {
+            mp_raise_RuntimeError(MP_ERROR_TEXT("buffer size must match format"));
+        }
+        return bufinfo.buf;
+    }
+    if (offset < 0) {
+        offset = (mp_int_t)bufinfo.len + offset;
+    }
+    if (offset < 0 || (size_t)offset + size > bufinfo.len) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("buffer too small"));
+    }
+    return (byte *)bufinfo.buf + offset;
+}
+
+//|     format: str
+//|     """The format string used to construct this object. (read-only)"""
+STATIC mp_obj_t struct_struct_get_format(mp_obj_t self_in) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_struct_struct_get_format(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(struct_struct_get_format_obj, struct_struct_get_format);
+
+MP_PROPERTY_GETTER(struct_struct_format_obj,
+    (mp_obj_t)&struct_struct_get_format_obj);
+
+//|     size: int
+//|     """The number of bytes in one packed record, as returned by `struct.calcsize`. (read-only)"""
+STATIC mp_obj_t struct_struct_get_size(mp_obj_t self_in) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_struct_struct_get_size(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(struct_struct_get_size_obj, struct_struct_get_size);
+
+MP_PROPERTY_GETTER(struct_struct_size_obj,
+    (mp_obj_t)&struct_struct_get_size_obj);
+
+//|     def pack(self, *values: Any) -> bytes:
+//|         """Pack the values according to the format. The return value is a bytes object
+//|         encoding the values."""
+//|         ...
+STATIC mp_obj_t struct_struct_pack(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    size_t size = common_hal_struct_struct_get_size(self);
+    vstr_t vstr;
+    vstr_init_len(&vstr, size);
+    memset(vstr.buf, 0, size);
+    common_hal_struct_struct_pack_into(self, (byte *)vstr.buf, n_args - 1, &args[1]);
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_pack_obj, 1, MP_OBJ_FUN_ARGS_MAX, struct_struct_pack);
+
+//|     def pack_into(self, buffer: WriteableBuffer, offset: int, *values: Any) -> None:
+//|         """Pack the values according to the format into a buffer starting at offset.
+//|         offset may be negative to count from the end of buffer."""
+//|         ...
+STATIC mp_obj_t struct_struct_pack_into(size_t n_args, const mp_obj_t *args) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(args[0]);
+    byte *p = struct_struct_get_record(self, args[1], mp_obj_get_int(args[2]), MP_BUFFER_WRITE, false);
+    common_hal_struct_struct_pack_into(self, p, n_args - 3, &args[3]);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(struct_struct_pack_into_obj, 3, MP_OBJ_FUN_ARGS_MAX, struct_struct_pack_into);
+
+STATIC mp_obj_t struct_struct_new_tuple(struct_struct_obj_t *self, byte *p) {
+    mp_obj_tuple_t *res = MP_OBJ_TO_PTR(mp_obj_new_tuple(common_hal_struct_struct_get_num_items(self), NULL));
+    common_hal_struct_struct_unpack_into(self, p, res->items);
+    return MP_OBJ_FROM_PTR(res);
+}
+
+//|     def unpack(self, data: ReadableBuffer) -> Tuple[Any, ...]:
+//|         """Unpack from the data according to the format. The return value is a tuple of
+//|         the unpacked values. The buffer size must match `size`."""
+//|         ...
+STATIC mp_obj_t struct_struct_unpack(mp_obj_t self_in, mp_obj_t data) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return struct_struct_new_tuple(self, struct_struct_get_record(self, data, 0, MP_BUFFER_READ, true));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(struct_struct_unpack_obj, struct_struct_unpack);
+
+//|     def unpack_from(self, data: ReadableBuffer, offset: int = 0) -> Tuple[Any, ...]:
+//|         """Unpack from the data starting at offset according to the format. offset may
+//|         be negative to count from the end of buffer. The return value is a tuple of the
+//|         unpacked values. The buffer must hold at least `size` bytes after offset."""
+//|         ...
+STATIC mp_obj_t struct_struct_unpack_from(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_offset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_offset, MP_ARG_INT, {.u_int = 0} },
+    };
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    byte *p = struct_struct_get_record(self, args[ARG_buffer].u_obj, args[ARG_offset].u_int, MP_BUFFER_READ, false);
+    return struct_struct_new_tuple(self, p);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(struct_struct_unpack_from_obj, 1, struct_struct_unpack_from);
+
+//|     def unpack_from_into(self, items: List[Any], data: ReadableBuffer, offset: int = 0) -> None:
+//|         """Unpack from the data starting at offset, like `unpack_from`, but store the values
+//|         in the existing list ``items`` instead of allocating a new tuple. ``items`` must
+//|         already have one element for each unpacked value."""
+//|         ...
+STATIC mp_obj_t struct_struct_unpack_from_into(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_items, ARG_buffer, ARG_offset };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_items, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_offset, MP_ARG_INT, {.u_int = 0} },
+    };
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_list_t *items = MP_OBJ_TO_PTR(mp_arg_validate_type(args[ARG_items].u_obj, &mp_type_list, MP_QSTR_items));
+    (void)mp_arg_validate_length(items->len, common_hal_struct_struct_get_num_items(self), MP_QSTR_items);
+
+    byte *p = struct_struct_get_record(self, args[ARG_buffer].u_obj, args[ARG_offset].u_int, MP_BUFFER_READ, false);
+    common_hal_struct_struct_unpack_into(self, p, items->items);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(struct_struct_unpack_from_into_obj, 1, struct_struct_unpack_from_into);
+
+typedef struct {
+    mp_obj_base_t base;
+    struct_struct_obj_t *parent;
+    mp_obj_t buffer;
+    size_t offset;
+} struct_struct_iter_obj_t;
+
+STATIC mp_obj_t struct_struct_iter_iternext(mp_obj_t self_in) {
+    struct_struct_iter_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    // Look the buffer up again each time: a bytearray may have been resized.
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(self->buffer, &bufinfo, MP_BUFFER_READ);
+    size_t size = common_hal_struct_struct_get_size(self->parent);
+    if (self->offset + size > bufinfo.len) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    byte *p = (byte *)bufinfo.buf + self->offset;
+    self->offset += size;
+    return struct_struct_new_tuple(self->parent, p);
+}
+
+STATIC MP_DEFINE_CONST_OBJ_TYPE(
+    struct_struct_iter_type,
+    MP_QSTR_iterator,
+    MP_TYPE_FLAG_ITER_IS_ITERNEXT,
+    iter, struct_struct_iter_iternext
+    );
+
+//|     def iter_unpack(self, data: ReadableBuffer) -> Iterator[Tuple[Any, ...]]:
+//|         """Return an iterator that unpacks consecutive records from the start of data.
+//|         The buffer size must be a multiple of `size`."""
+//|         ...
+//|
+STATIC mp_obj_t struct_struct_iter_unpack(mp_obj_t self_in, mp_obj_t data) {
+    struct_struct_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    size_t size = mp_arg_validate_int_min(common_hal_struct_struct_get_size(self), 1, MP_QSTR_size);
+    if (bufinfo.len % size != 0) {
+        mp_raise_ValueError(MP_ERROR_TEXT("buffer size must be a multiple of element size"));
+    }
+
+    struct_struct_iter_obj_t *iter = mp_obj_malloc(struct_struct_iter_obj_t, &struct_struct_iter_type);
+    iter->parent = self;
+    iter->buffer = data;
+    iter->offset = 0;
+    return MP_OBJ_FROM_PTR(iter);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(struct_struct_iter_unpack_obj, struct_struct_iter_unpack);
+
+STATIC const mp_rom_map_elem_t struct_struct_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_format), MP_ROM_PTR(&struct_struct_format_obj) },
+    { MP_ROM_QSTR(MP_QSTR_size), MP_ROM_PTR(&struct_struct_size_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pack), MP_ROM_PTR(&struct_struct_pack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pack_into), MP_ROM_PTR(&struct_struct_pack_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack), MP_ROM_PTR(&struct_struct_unpack_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_from), MP_ROM_PTR(&struct_struct_unpack_from_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unpack_from_into), MP_ROM_PTR(&struct_struct_unpack_from_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_iter_unpack), MP_ROM_PTR(&struct_struct_iter_unpack_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(struct_struct_locals_dict, struct_struct_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    struct_struct_type,
+    MP_QSTR_Struct,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, struct_struct_make_new,
+    locals_dict, &struct_struct_locals_dict
+    );
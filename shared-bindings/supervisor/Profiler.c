@@ -0,0 +1,147 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/obj.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/supervisor/Profiler.h"
+
+//| class Profiler:
+//|     """Statistical profiler that periodically records which Python functions are running.
+//|
+//|     Each sample records the stack of Python functions that was executing when it was
+//|     taken, so the functions that show up in the most samples are where the time goes.
+//|     Samples are taken from the supervisor tick, so the program being profiled runs at
+//|     close to full speed.
+//|
+//|     Usage::
+//|
+//|        import supervisor
+//|
+//|        supervisor.profile.start()
+//|        main_loop()
+//|        supervisor.profile.dump()
+//|     """
+//|
+
+//|     def __init__(self) -> None:
+//|         """You cannot create an instance of `supervisor.Profiler`.
+//|         Use `supervisor.profile` to access the sole instance available."""
+//|         ...
+
+//|     def start(self, *, interval: int = 10, samples: int = 256, depth: int = 8) -> None:
+//|         """Discard any previous samples and start sampling.
+//|
+//|         :param int interval: Milliseconds between samples, from 1 to 1000
+//|         :param int samples: Number of samples kept. Once full, the oldest samples are replaced.
+//|         :param int depth: Number of innermost frames recorded for each sample, from 1 to 64
+//|
+//|         The sample buffer takes ``samples * (1 + 2 * depth) * 2`` bytes of heap."""
+//|         ...
+STATIC mp_obj_t supervisor_profiler_start(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_interval, ARG_samples, ARG_depth };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_interval, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 10} },
+        { MP_QSTR_samples, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 256} },
+        { MP_QSTR_depth, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 8} },
+    };
+    supervisor_profiler_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t interval = mp_arg_validate_int_range(args[ARG_interval].u_int, 1, 1000, MP_QSTR_interval);
+    mp_int_t samples = mp_arg_validate_int_min(args[ARG_samples].u_int, 1, MP_QSTR_samples);
+    mp_int_t depth = mp_arg_validate_int_range(args[ARG_depth].u_int, 1, 64, MP_QSTR_depth);
+
+    shared_module_supervisor_profiler_start(self, interval, samples, depth);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(supervisor_profiler_start_obj, 1, supervisor_profiler_start);
+
+//|     def stop(self) -> None:
+//|         """Stop sampling. The samples taken so far are kept until the next `start()`."""
+//|         ...
+STATIC mp_obj_t supervisor_profiler_stop(mp_obj_t self_in) {
+    supervisor_profiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    shared_module_supervisor_profiler_stop(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_profiler_stop_obj, supervisor_profiler_stop);
+
+//|     def dump(self) -> None:
+//|         """Stop sampling and print the samples as folded stacks, one line per distinct stack::
+//|
+//|             code.py:<module>;code.py:main_loop;code.py:draw 42
+//|
+//|         Each frame is ``file:function``, outermost first, followed by the number of samples
+//|         of that stack. This is the input format of ``flamegraph.pl`` and similar tools."""
+//|         ...
+STATIC mp_obj_t supervisor_profiler_dump(mp_obj_t self_in) {
+    supervisor_profiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    shared_module_supervisor_profiler_dump(self, MP_PYTHON_PRINTER);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_profiler_dump_obj, supervisor_profiler_dump);
+
+//|     running: bool
+//|     """``True`` while samples are being taken. (read-only)"""
+STATIC mp_obj_t supervisor_profiler_get_running(mp_obj_t self_in) {
+    supervisor_profiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(shared_module_supervisor_profiler_get_running(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_profiler_get_running_obj, supervisor_profiler_get_running);
+
+MP_PROPERTY_GETTER(supervisor_profiler_running_obj,
+    (mp_obj_t)&supervisor_profiler_get_running_obj);
+
+//|     sample_count: int
+//|     """Number of samples currently stored. (read-only)"""
+//|
+STATIC mp_obj_t supervisor_profiler_get_sample_count(mp_obj_t self_in) {
+    supervisor_profiler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(shared_module_supervisor_profiler_get_sample_count(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(supervisor_profiler_get_sample_count_obj, supervisor_profiler_get_sample_count);
+
+MP_PROPERTY_GETTER(supervisor_profiler_sample_count_obj,
+    (mp_obj_t)&supervisor_profiler_get_sample_count_obj);
+
+STATIC const mp_rom_map_elem_t supervisor_profiler_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_start), MP_ROM_PTR(&supervisor_profiler_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&supervisor_profiler_stop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dump), MP_ROM_PTR(&supervisor_profiler_dump_obj) },
+    { MP_ROM_QSTR(MP_QSTR_running), MP_ROM_PTR(&supervisor_profiler_running_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sample_count), MP_ROM_PTR(&supervisor_profiler_sample_count_obj) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(supervisor_profiler_locals_dict, supervisor_profiler_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    supervisor_profiler_type,
+    MP_QSTR_Profiler,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    locals_dict, &supervisor_profiler_locals_dict
+    );
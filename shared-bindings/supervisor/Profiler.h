@@ -0,0 +1,43 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_SUPERVISOR_PROFILER_H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_SUPERVISOR_PROFILER_H
+
+#include <stdbool.h>
+#include "py/obj.h"
+#include "shared-module/supervisor/Profiler.h"
+
+extern const mp_obj_type_t supervisor_profiler_type;
+extern supervisor_profiler_obj_t shared_module_supervisor_profiler_obj;
+
+void shared_module_supervisor_profiler_start(supervisor_profiler_obj_t *self, mp_int_t interval_ms, mp_int_t samples, mp_int_t depth);
+void shared_module_supervisor_profiler_stop(supervisor_profiler_obj_t *self);
+bool shared_module_supervisor_profiler_get_running(supervisor_profiler_obj_t *self);
+mp_int_t shared_module_supervisor_profiler_get_sample_count(supervisor_profiler_obj_t *self);
+void shared_module_supervisor_profiler_dump(supervisor_profiler_obj_t *self, const mp_print_t *print);
+
+#endif // MICROPY_INCLUDED_SHARED_BINDINGS_SUPERVISOR_PROFILER_H
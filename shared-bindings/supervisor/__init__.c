@@ -46,6 +46,18 @@
 #include "shared-bindings/supervisor/Runtime.h"
 #include "shared-bindings/supervisor/StatusBar.h"
 
+#if CIRCUITPY_SUPERVISOR_PROFILE
+#include "shared-bindings/supervisor/Profiler.h"
+#endif
+
+#if CIRCUITPY_SUPERVISOR_BOOT_TIMELINE
+#include "supervisor/shared/boot_timeline.h"
+#endif
+
+#if CIRCUITPY_SUPERVISOR_MEMORY_STATS
+#include "supervisor/shared/memory_stats.h"
+#endif
+
 //| """Supervisor settings"""
 
 //| runtime: Runtime
@@ -61,6 +73,12 @@
 //| This object is the sole instance of `supervisor.StatusBar`."""
 //|
 
+//| profile: Profiler
+//| """The sampling profiler, which records where Python code spends its time.
+//| Only available on builds with ``CIRCUITPY_SUPERVISOR_PROFILE`` enabled.
+//| This object is the sole instance of `supervisor.Profiler`."""
+//|
+
 //| def reload() -> None:
 //|     """Reload the main Python code and run it (equivalent to hitting Ctrl-D at the REPL)."""
 //|     ...
@@ -155,11 +173,11 @@ STATIC mp_obj_t supervisor_set_next_code_file(size_t n_args, const mp_obj_t *pos
     size_t len;
     const char *filename = mp_obj_str_get_data(args.filename.u_obj, &len);
     if (next_code_configuration != NULL) {
-        port_free(next_code_configuration);
+        port_free_tagged(next_code_configuration, PORT_HEAP_TAG_SUPERVISOR);
         next_code_configuration = NULL;
     }
     if (options != 0 || len != 0) {
-        next_code_configuration = port_malloc(sizeof(supervisor_next_code_info_t) + len + 1, false);
+        next_code_configuration = port_malloc_tagged(sizeof(supervisor_next_code_info_t) + len + 1, false, PORT_HEAP_TAG_SUPERVISOR);
         if (next_code_configuration == NULL) {
             m_malloc_fail(sizeof(supervisor_next_code_info_t) + len + 1);
         }
@@ -219,6 +237,42 @@ mp_obj_t supervisor_ticks_ms(void) {
 }
 MP_DEFINE_CONST_FUN_OBJ_0(supervisor_ticks_ms_obj, supervisor_ticks_ms);
 
+//| def ticks_us() -> int:
+//|     """Return the time in microseconds since an unspecified reference point, wrapping after
+//|     2**29us (about 9 minutes). Like `ticks_ms`, the value never needs a long int and the
+//|     first overflow happens soon after power-on.
+//|
+//|     On boards with a high resolution timer, such as the ESP32 family and the RP2040, the
+//|     value is accurate to a microsecond. Elsewhere it comes from the same clock as
+//|     `ticks_ms` and only changes every 30.5us or so.
+//|
+//|     Use `ticks_diff` to find the time between two ``ticks_us`` values::
+//|
+//|         start = supervisor.ticks_us()
+//|         do_work()
+//|         print(supervisor.ticks_diff(supervisor.ticks_us(), start), "us")
+//|
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t supervisor_ticks_us(void) {
+    uint64_t ticks_us = port_get_raw_ticks_us();
+    return MP_OBJ_NEW_SMALL_INT((ticks_us + 0x1fff0000) % (1 << 29));
+}
+MP_DEFINE_CONST_FUN_OBJ_0(supervisor_ticks_us_obj, supervisor_ticks_us);
+
+//| def ticks_diff(ticks1: int, ticks2: int) -> int:
+//|     """Return the signed difference ``ticks1 - ticks2`` between two `ticks_ms` or two
+//|     `ticks_us` values, taking wraparound into account. The values must be less than
+//|     2**28 ticks apart."""
+//|     ...
+//|
+STATIC mp_obj_t supervisor_ticks_diff(mp_obj_t ticks1_in, mp_obj_t ticks2_in) {
+    mp_uint_t diff = (mp_obj_get_int(ticks1_in) - mp_obj_get_int(ticks2_in)) & ((1 << 29) - 1);
+    return MP_OBJ_NEW_SMALL_INT((mp_int_t)((diff + (1 << 28)) & ((1 << 29) - 1)) - (1 << 28));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(supervisor_ticks_diff_obj, supervisor_ticks_diff);
+
 //| def get_previous_traceback() -> Optional[str]:
 //|     """If the last vm run ended with an exception (including the KeyboardInterrupt caused by
 //|     CTRL-C), returns the traceback as a string.
@@ -294,7 +348,7 @@ STATIC mp_obj_t supervisor_set_usb_identification(size_t n_args, const mp_obj_t
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, (mp_arg_val_t *)&args);
 
     if (custom_usb_identification == NULL) {
-        custom_usb_identification = port_malloc(sizeof(usb_identification_t), false);
+        custom_usb_identification = port_malloc_tagged(sizeof(usb_identification_t), false, PORT_HEAP_TAG_USB);
     }
 
     mp_arg_validate_int_range(args.vid.u_int, -1, (1 << 16) - 1, MP_QSTR_vid);
@@ -329,6 +383,82 @@ STATIC mp_obj_t supervisor_set_usb_identification(size_t n_args, const mp_obj_t
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(supervisor_set_usb_identification_obj, 0, supervisor_set_usb_identification);
 
+//| def boot_timeline() -> Tuple[Tuple[str, float], ...]:
+//|     """Returns when fixed points in startup were reached, as ``(event, milliseconds)`` tuples,
+//|     earliest first. Times are measured from when the port's tick counter started, which is
+//|     at or shortly after reset.
+//|
+//|     Events are recorded the first time they happen after a hard reset, so soft reloads don't
+//|     change them. Events that haven't happened, such as ``"wifi_connected"`` when Wi-Fi
+//|     isn't configured, are left out. The possible events, in their usual order, are
+//|     ``"port_init"``, ``"filesystem_init"``, ``"board_init"``, ``"boot_py_start"``,
+//|     ``"boot_py_done"``, ``"usb_init"``, ``"settings_read"``, ``"wifi_connect_start"``,
+//|     ``"wifi_connected"``, ``"web_workflow_start"``, ``"workflow_start"`` and
+//|     ``"code_py_start"``.
+//|
+//|     To see how long the imports at the top of code.py take, compare
+//|     ``time.monotonic() * 1000`` after them with ``"code_py_start"``.
+//|
+//|     Not available on all boards."""
+//|     ...
+//|
+STATIC mp_obj_t supervisor_boot_timeline(void) {
+    #if CIRCUITPY_SUPERVISOR_BOOT_TIMELINE
+    supervisor_boot_event_t events[SUPERVISOR_BOOT_EVENT_COUNT];
+    size_t count = supervisor_boot_timeline_events(events);
+    mp_obj_tuple_t *timeline = MP_OBJ_TO_PTR(mp_obj_new_tuple(count, NULL));
+    for (size_t i = 0; i < count; i++) {
+        const char *name = supervisor_boot_timeline_name(events[i]);
+        mp_obj_t items[2] = {
+            mp_obj_new_str(name, strlen(name)),
+            mp_obj_new_float(supervisor_boot_timeline_time_ms(events[i])),
+        };
+        timeline->items[i] = mp_obj_new_tuple(2, items);
+    }
+    return MP_OBJ_FROM_PTR(timeline);
+    #else
+    mp_raise_NotImplementedError(NULL);
+    #endif
+}
+MP_DEFINE_CONST_FUN_OBJ_0(supervisor_boot_timeline_obj, supervisor_boot_timeline);
+
+//| def memory_stats() -> Dict[str, Tuple[int, int, int]]:
+//|     """Returns how much of the memory outside the VM heap each part of CircuitPython holds.
+//|     This memory is used for the VM heap itself, display buffers, flash caches, USB descriptors
+//|     and native code, and can fill up or fragment across soft reloads.
+//|
+//|     Each value is a ``(bytes_in_use, peak_bytes, blocks)`` tuple. The peak is the most held at
+//|     once since the last hard reset. The keys are ``"vm"``, ``"supervisor"``, ``"display"``,
+//|     ``"flash_cache"``, ``"usb"`` and ``"native_code"``. The ``"largest_free"`` key holds the
+//|     largest block that can currently be allocated, as a plain `int`.
+//|
+//|     Memory used directly by the port SDK, such as for Wi-Fi or BLE stacks, is not included.
+//|
+//|     Not available on all boards."""
+//|     ...
+//|
+STATIC mp_obj_t supervisor_memory_stats(void) {
+    #if CIRCUITPY_SUPERVISOR_MEMORY_STATS
+    mp_obj_t result = mp_obj_new_dict(PORT_HEAP_TAG_COUNT + 1);
+    for (port_heap_tag_t tag = 0; tag < PORT_HEAP_TAG_COUNT; tag++) {
+        const supervisor_memory_stats_t *stats = supervisor_memory_stats(tag);
+        const char *name = supervisor_memory_stats_name(tag);
+        mp_obj_t items[3] = {
+            mp_obj_new_int_from_uint(stats->in_use),
+            mp_obj_new_int_from_uint(stats->peak),
+            mp_obj_new_int_from_uint(stats->blocks),
+        };
+        mp_obj_dict_store(result, mp_obj_new_str(name, strlen(name)), mp_obj_new_tuple(3, items));
+    }
+    mp_obj_dict_store(result, MP_OBJ_NEW_QSTR(MP_QSTR_largest_free),
+        mp_obj_new_int_from_uint(port_heap_get_largest_free_size()));
+    return result;
+    #else
+    mp_raise_NotImplementedError(NULL);
+    #endif
+}
+MP_DEFINE_CONST_FUN_OBJ_0(supervisor_memory_stats_obj, supervisor_memory_stats);
+
 STATIC const mp_rom_map_elem_t supervisor_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_supervisor) },
     { MP_ROM_QSTR(MP_QSTR_runtime),  MP_ROM_PTR(&common_hal_supervisor_runtime_obj) },
@@ -341,10 +471,18 @@ STATIC const mp_rom_map_elem_t supervisor_module_globals_table[] = {
     #endif
     { MP_ROM_QSTR(MP_QSTR_set_next_code_file),  MP_ROM_PTR(&supervisor_set_next_code_file_obj) },
     { MP_ROM_QSTR(MP_QSTR_ticks_ms),  MP_ROM_PTR(&supervisor_ticks_ms_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ticks_us),  MP_ROM_PTR(&supervisor_ticks_us_obj) },
+    { MP_ROM_QSTR(MP_QSTR_ticks_diff),  MP_ROM_PTR(&supervisor_ticks_diff_obj) },
     { MP_ROM_QSTR(MP_QSTR_get_previous_traceback),  MP_ROM_PTR(&supervisor_get_previous_traceback_obj) },
     { MP_ROM_QSTR(MP_QSTR_reset_terminal),  MP_ROM_PTR(&supervisor_reset_terminal_obj) },
     { MP_ROM_QSTR(MP_QSTR_set_usb_identification),  MP_ROM_PTR(&supervisor_set_usb_identification_obj) },
+    { MP_ROM_QSTR(MP_QSTR_boot_timeline),  MP_ROM_PTR(&supervisor_boot_timeline_obj) },
+    { MP_ROM_QSTR(MP_QSTR_memory_stats),  MP_ROM_PTR(&supervisor_memory_stats_obj) },
     { MP_ROM_QSTR(MP_QSTR_status_bar),  MP_ROM_PTR(&shared_module_supervisor_status_bar_obj) },
+    #if CIRCUITPY_SUPERVISOR_PROFILE
+    { MP_ROM_QSTR(MP_QSTR_Profiler),  MP_ROM_PTR(&supervisor_profiler_type) },
+    { MP_ROM_QSTR(MP_QSTR_profile),  MP_ROM_PTR(&shared_module_supervisor_profiler_obj) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(supervisor_module_globals, supervisor_module_globals_table);
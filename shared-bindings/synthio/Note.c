@@ -56,7 +56,7 @@ static const mp_arg_t note_properties[] = {
 //|         *,
 //|         frequency: float,
 //|         panning: BlockInput = 0.0,
-//|         waveform: Optional[ReadableBuffer] = None,
+//|         waveform: Optional[ReadableBuffer | Wavetable] = None,
 //|         waveform_loop_start: int = 0,
 //|         waveform_loop_end: int = waveform_max_length,
 //|         envelope: Optional[Envelope] = None,
@@ -200,8 +200,10 @@ MP_PROPERTY_GETSET(synthio_note_bend_obj,
     (mp_obj_t)&synthio_note_get_bend_obj,
     (mp_obj_t)&synthio_note_set_bend_obj);
 
-//|     waveform: Optional[ReadableBuffer]
-//|     """The waveform of this note. Setting the waveform to a buffer of a different size resets the note's phase."""
+//|     waveform: Optional[ReadableBuffer | Wavetable]
+//|     """The waveform of this note. Setting the waveform to a buffer of a different size resets the note's phase.
+//|
+//|     A `Wavetable` plays band-limited and interpolated, and ignores the loop points."""
 STATIC mp_obj_t synthio_note_get_waveform(mp_obj_t self_in) {
     synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
     return common_hal_synthio_note_get_waveform_obj(self);
@@ -167,6 +167,70 @@ STATIC mp_obj_t synthio_synthesizer_change(mp_uint_t n_args, const mp_obj_t *pos
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_KW(synthio_synthesizer_change_obj, 1, synthio_synthesizer_change);
 
+//|     def schedule(
+//|         self,
+//|         frame: int,
+//|         *,
+//|         release: NoteOrNoteSequence = (),
+//|         press: NoteOrNoteSequence = (),
+//|         retrigger: LFOOrLFOSequence = (),
+//|         set: Sequence[Tuple[Note, str, Any]] = (),
+//|     ) -> None:
+//|         """Like `change`, but takes effect exactly at the given output frame
+//|         instead of at the start of the next block of output.
+//|
+//|         ``frame`` is compared with `frame`, so ``synth.schedule(synth.frame + synth.sample_rate, press=note)``
+//|         presses ``note`` one second of output from now. A frame that has
+//|         already been output takes effect at the start of the next block.
+//|
+//|         ``set`` is a sequence of ``(note, attribute_name, value)`` tuples, such
+//|         as ``(note, "frequency", 440)``. These attributes are set before the
+//|         notes are released and pressed. A value that the note rejects is
+//|         ignored.
+//|
+//|         Changes scheduled for the same frame happen in the order they were
+//|         scheduled. At most 32 changes (each note, LFO or attribute counts as
+//|         one) can be waiting at once; beyond that, `RuntimeError` is raised and
+//|         none of this call's changes are scheduled.
+//|
+//|         :param int frame: The output frame at which to make the change.
+//|         :param NoteOrNoteSequence release: Any sequence of notes.
+//|         :param NoteOrNoteSequence press: Any sequence of notes.
+//|         :param LFOOrLFOSequence retrigger: Any sequence of LFOs.
+//|         :param Sequence[Tuple[Note,str,Any]] set: Note attributes to change."""
+STATIC mp_obj_t synthio_synthesizer_schedule(mp_uint_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_frame, ARG_release, ARG_press, ARG_retrigger, ARG_set };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_frame, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL } },
+        { MP_QSTR_release, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_empty_tuple } },
+        { MP_QSTR_press, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_empty_tuple } },
+        { MP_QSTR_retrigger, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_empty_tuple } },
+        { MP_QSTR_set, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_empty_tuple } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    check_for_deinit(self);
+    // Frames count modulo 2**32, like the frame property.
+    uint32_t frame = mp_obj_get_int_truncated(args[ARG_frame].u_obj);
+    common_hal_synthio_synthesizer_schedule(self, frame, args[ARG_set].u_obj,
+        args[ARG_release].u_obj, args[ARG_press].u_obj, args[ARG_retrigger].u_obj);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(synthio_synthesizer_schedule_obj, 1, synthio_synthesizer_schedule);
+
+//|     def cancel_scheduled(self) -> None:
+//|         """Discard all changes that `schedule` has not made yet."""
+STATIC mp_obj_t synthio_synthesizer_cancel_scheduled(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_synthio_synthesizer_cancel_scheduled(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_cancel_scheduled_obj, synthio_synthesizer_cancel_scheduled);
+
 //
 //|     def release_all_then_press(self, /, press: NoteOrNoteSequence) -> None:
 //|         """Turn any currently-playing notes off, then turn on the given notes
@@ -254,6 +318,20 @@ MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_sample_rate_obj, synthio_synth
 MP_PROPERTY_GETTER(synthio_synthesizer_sample_rate_obj,
     (mp_obj_t)&synthio_synthesizer_get_sample_rate_obj);
 
+//|     frame: int
+//|     """The number of frames output since the synthesizer was created, modulo 2**32 (read-only).
+//|
+//|     It advances only while the synthesizer is playing. Use it as the time base for `schedule`."""
+STATIC mp_obj_t synthio_synthesizer_obj_get_frame(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return mp_obj_new_int_from_uint(common_hal_synthio_synthesizer_get_frame(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_frame_obj, synthio_synthesizer_obj_get_frame);
+
+MP_PROPERTY_GETTER(synthio_synthesizer_frame_obj,
+    (mp_obj_t)&synthio_synthesizer_get_frame_obj);
+
 //|     pressed: NoteSequence
 //|     """A sequence of the currently pressed notes (read-only property).
 //|
@@ -303,6 +381,43 @@ MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_blocks_obj, synthio_synthesize
 MP_PROPERTY_GETTER(synthio_synthesizer_blocks_obj,
     (mp_obj_t)&synthio_synthesizer_get_blocks_obj);
 
+//|     control_rate: Optional[float]
+//|     """How many times per second block inputs such as `LFO` and `Math` are updated, or `None` to update them once per block of output.
+//|
+//|     A lower rate spends less time on blocks, which helps patches with many LFOs. Note loudness is
+//|     always ramped smoothly from one block of output to the next. The rate is rounded to a whole
+//|     number of frames, and must be from 1 to `sample_rate`."""
+//|
+STATIC mp_obj_t synthio_synthesizer_obj_get_control_rate(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    uint32_t period = common_hal_synthio_synthesizer_get_control_period(self);
+    if (!period) {
+        return mp_const_none;
+    }
+    return mp_obj_new_float((mp_float_t)common_hal_synthio_synthesizer_get_sample_rate(self) / period);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_control_rate_obj, synthio_synthesizer_obj_get_control_rate);
+
+STATIC mp_obj_t synthio_synthesizer_obj_set_control_rate(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    uint32_t period = 0;
+    if (arg != mp_const_none) {
+        uint32_t sample_rate = common_hal_synthio_synthesizer_get_sample_rate(self);
+        mp_float_t rate = mp_arg_validate_obj_float_range(arg, 1, sample_rate, MP_QSTR_control_rate);
+        period = (uint32_t)(sample_rate / rate + MICROPY_FLOAT_CONST(0.5));
+        period = MAX(1, period);
+    }
+    common_hal_synthio_synthesizer_set_control_period(self, period);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_synthesizer_set_control_rate_obj, synthio_synthesizer_obj_set_control_rate);
+
+MP_PROPERTY_GETSET(synthio_synthesizer_control_rate_obj,
+    (mp_obj_t)&synthio_synthesizer_get_control_rate_obj,
+    (mp_obj_t)&synthio_synthesizer_set_control_rate_obj);
+
 //|     max_polyphony: int
 //|     """Maximum polyphony of the synthesizer (read-only class property)"""
 //|
@@ -423,6 +538,8 @@ STATIC const mp_rom_map_elem_t synthio_synthesizer_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_change), MP_ROM_PTR(&synthio_synthesizer_change_obj) },
     { MP_ROM_QSTR(MP_QSTR_release_then_press), MP_ROM_PTR(&synthio_synthesizer_change_obj) },
     { MP_ROM_QSTR(MP_QSTR_release_all_then_press), MP_ROM_PTR(&synthio_synthesizer_release_all_then_press_obj) },
+    { MP_ROM_QSTR(MP_QSTR_schedule), MP_ROM_PTR(&synthio_synthesizer_schedule_obj) },
+    { MP_ROM_QSTR(MP_QSTR_cancel_scheduled), MP_ROM_PTR(&synthio_synthesizer_cancel_scheduled_obj) },
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&synthio_synthesizer_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&synthio_synthesizer___exit___obj) },
@@ -433,6 +550,8 @@ STATIC const mp_rom_map_elem_t synthio_synthesizer_locals_dict_table[] = {
     // Properties
     { MP_ROM_QSTR(MP_QSTR_envelope), MP_ROM_PTR(&synthio_synthesizer_envelope_obj) },
     { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&synthio_synthesizer_sample_rate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_frame), MP_ROM_PTR(&synthio_synthesizer_frame_obj) },
+    { MP_ROM_QSTR(MP_QSTR_control_rate), MP_ROM_PTR(&synthio_synthesizer_control_rate_obj) },
     { MP_ROM_QSTR(MP_QSTR_max_polyphony), MP_ROM_INT(CIRCUITPY_SYNTHIO_MAX_CHANNELS) },
     { MP_ROM_QSTR(MP_QSTR_pressed), MP_ROM_PTR(&synthio_synthesizer_pressed_obj) },
     { MP_ROM_QSTR(MP_QSTR_note_info), MP_ROM_PTR(&synthio_synthesizer_note_info_obj) },
@@ -45,4 +45,10 @@ void common_hal_synthio_synthesizer_retrigger(synthio_synthesizer_obj_t *self, m
 void common_hal_synthio_synthesizer_release_all(synthio_synthesizer_obj_t *self);
 mp_obj_t common_hal_synthio_synthesizer_get_pressed_notes(synthio_synthesizer_obj_t *self);
 mp_obj_t common_hal_synthio_synthesizer_get_blocks(synthio_synthesizer_obj_t *self);
+uint32_t common_hal_synthio_synthesizer_get_frame(synthio_synthesizer_obj_t *self);
+uint32_t common_hal_synthio_synthesizer_get_control_period(synthio_synthesizer_obj_t *self);
+void common_hal_synthio_synthesizer_set_control_period(synthio_synthesizer_obj_t *self, uint32_t period);
+void common_hal_synthio_synthesizer_schedule(synthio_synthesizer_obj_t *self, uint32_t frame,
+    mp_obj_t set, mp_obj_t release, mp_obj_t press, mp_obj_t retrigger);
+void common_hal_synthio_synthesizer_cancel_scheduled(synthio_synthesizer_obj_t *self);
 envelope_state_e common_hal_synthio_synthesizer_note_info(synthio_synthesizer_obj_t *self, mp_obj_t note, mp_float_t *vol_out);
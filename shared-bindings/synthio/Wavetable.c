@@ -0,0 +1,127 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/obj.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/synthio/Wavetable.h"
+#include "shared-module/synthio/Wavetable.h"
+
+//| class Wavetable:
+//|     """A band-limited wavetable oscillator
+//|
+//|     A Wavetable can be used as the `Note.waveform` of any number of notes.
+//|     Each single-cycle waveform is converted once, at construction, into a
+//|     set of tables holding fewer harmonics for each higher octave. Notes
+//|     play from the table whose harmonics all stay below half the sample
+//|     rate, so bright waveforms do not alias at high pitches. Samples are
+//|     linearly interpolated.
+//|
+//|     When more than one waveform is given, `morph` selects between them,
+//|     crossfading between neighbouring waveforms at fractional positions.
+//|
+//|     All waveforms must have the same length, up to 1024 samples. The loop
+//|     points of a `Note` do not apply to a Wavetable."""
+//|
+//|     def __init__(
+//|         self,
+//|         waveforms: ReadableBuffer | Sequence[ReadableBuffer],
+//|         *,
+//|         morph: BlockInput = 0.0,
+//|     ) -> None:
+//|         """Create a wavetable from one single-cycle waveform or a sequence of them
+//|
+//|         :param ReadableBuffer waveforms: A single-cycle waveform in signed 16-bit format, or a sequence of them
+//|         :param BlockInput morph: The position between the waveforms, from 0 to ``frame_count-1``
+//|         """
+STATIC mp_obj_t synthio_wavetable_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    enum { ARG_waveforms, ARG_morph };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_waveforms, MP_ARG_OBJ | MP_ARG_REQUIRED, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_morph, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(0)} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    synthio_wavetable_obj_t *self = mp_obj_malloc(synthio_wavetable_obj_t, &synthio_wavetable_type);
+    common_hal_synthio_wavetable_set_morph(self, args[ARG_morph].u_obj);
+    common_hal_synthio_wavetable_construct(self, args[ARG_waveforms].u_obj);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|     morph: BlockInput
+//|     """The position between the waveforms, from 0 to ``frame_count-1``. Values outside this range are clamped."""
+STATIC mp_obj_t synthio_wavetable_get_morph(mp_obj_t self_in) {
+    synthio_wavetable_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_synthio_wavetable_get_morph(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_wavetable_get_morph_obj, synthio_wavetable_get_morph);
+
+STATIC mp_obj_t synthio_wavetable_set_morph(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_wavetable_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_wavetable_set_morph(self, arg);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_wavetable_set_morph_obj, synthio_wavetable_set_morph);
+MP_PROPERTY_GETSET(synthio_wavetable_morph_obj,
+    (mp_obj_t)&synthio_wavetable_get_morph_obj,
+    (mp_obj_t)&synthio_wavetable_set_morph_obj);
+
+//|     frame_count: int
+//|     """The number of waveforms (read-only)"""
+STATIC mp_obj_t synthio_wavetable_get_frame_count(mp_obj_t self_in) {
+    synthio_wavetable_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_synthio_wavetable_get_frame_count(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_wavetable_get_frame_count_obj, synthio_wavetable_get_frame_count);
+MP_PROPERTY_GETTER(synthio_wavetable_frame_count_obj,
+    (mp_obj_t)&synthio_wavetable_get_frame_count_obj);
+
+//|     length: int
+//|     """The length of the longest band-limited table, the waveform length rounded up to a power of two (read-only)"""
+//|
+STATIC mp_obj_t synthio_wavetable_get_length(mp_obj_t self_in) {
+    synthio_wavetable_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_synthio_wavetable_get_length(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_wavetable_get_length_obj, synthio_wavetable_get_length);
+MP_PROPERTY_GETTER(synthio_wavetable_length_obj,
+    (mp_obj_t)&synthio_wavetable_get_length_obj);
+
+STATIC const mp_rom_map_elem_t synthio_wavetable_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_morph), MP_ROM_PTR(&synthio_wavetable_morph_obj) },
+    { MP_ROM_QSTR(MP_QSTR_frame_count), MP_ROM_PTR(&synthio_wavetable_frame_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_length), MP_ROM_PTR(&synthio_wavetable_length_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(synthio_wavetable_locals_dict, synthio_wavetable_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    synthio_wavetable_type,
+    MP_QSTR_Wavetable,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    make_new, synthio_wavetable_make_new,
+    locals_dict, &synthio_wavetable_locals_dict
+    );
@@ -204,6 +204,29 @@ STATIC mp_obj_t usb_core_device_read(size_t n_args, const mp_obj_t *pos_args, mp
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(usb_core_device_read_obj, 2, usb_core_device_read);
 
+//|     def read_into(self, endpoint: int, buffer: WriteableBuffer) -> int:
+//|         """Copy data that has already arrived on an IN endpoint into ``buffer`` without waiting.
+//|
+//|         The first call starts reading the endpoint in the background into an internal
+//|         buffer, so no data is lost between calls. While that buffer is full the device
+//|         is held off until data is read.
+//|
+//|         :param int endpoint: the bEndpointAddress you want to communicate with.
+//|         :param WriteableBuffer buffer: the buffer to read data into.
+//|         :returns: the number of bytes read, possibly 0
+//|         """
+//|         ...
+STATIC mp_obj_t usb_core_device_read_into(mp_obj_t self_in, mp_obj_t endpoint_in, mp_obj_t buffer_in) {
+    usb_core_device_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_int_t endpoint = mp_obj_get_int(endpoint_in);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_usb_core_device_read_into(self, endpoint, bufinfo.buf, bufinfo.len));
+}
+MP_DEFINE_CONST_FUN_OBJ_3(usb_core_device_read_into_obj, usb_core_device_read_into);
+
 //|     def ctrl_transfer(
 //|         self,
 //|         bmRequestType: int,
@@ -322,6 +345,7 @@ STATIC const mp_rom_map_elem_t usb_core_device_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_set_configuration), MP_ROM_PTR(&usb_core_device_set_configuration_obj) },
     { MP_ROM_QSTR(MP_QSTR_write),            MP_ROM_PTR(&usb_core_device_write_obj) },
     { MP_ROM_QSTR(MP_QSTR_read),             MP_ROM_PTR(&usb_core_device_read_obj) },
+    { MP_ROM_QSTR(MP_QSTR_read_into),        MP_ROM_PTR(&usb_core_device_read_into_obj) },
     { MP_ROM_QSTR(MP_QSTR_ctrl_transfer),    MP_ROM_PTR(&usb_core_device_ctrl_transfer_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_is_kernel_driver_active), MP_ROM_PTR(&usb_core_device_is_kernel_driver_active_obj) },
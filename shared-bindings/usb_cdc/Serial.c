@@ -80,9 +80,29 @@
 //|         :rtype: list"""
 //|         ...
 //|     def write(self, buf: ReadableBuffer) -> int:
-//|         """Write as many bytes as possible from the buffer of bytes.
+//|         """Write as many bytes as possible from the buffer of bytes. If `write_timeout`
+//|         is 0, return immediately after queuing what fits.
 //|
-//|         :return: the number of bytes written
+//|         On boards with a transmit buffer for `usb_cdc.data`, bytes that don't fit in
+//|         the USB FIFO are held in the buffer and sent in the background. Use
+//|         ``select.poll`` (or ``asyncio``) to wait until the stream is writable again.
+//|
+//|         :return: the number of bytes written or queued
+//|         :rtype: int"""
+//|         ...
+//|     def writev(self, bufs: Sequence[ReadableBuffer]) -> int:
+//|         """Write each buffer in ``bufs`` in order, as if they had been joined into one.
+//|         The pieces are queued together before being sent, so small pieces share USB
+//|         packets instead of each going out in its own. `write_timeout` applies as for
+//|         `write()`.
+//|
+//|         :return: the total number of bytes written or queued
+//|         :rtype: int"""
+//|         ...
+//|     def readv(self, bufs: Sequence[WriteableBuffer]) -> int:
+//|         """Fill each buffer in ``bufs`` in order. Stops early if `timeout` expires.
+//|
+//|         :return: the total number of bytes read
 //|         :rtype: int"""
 //|         ...
 //|     def flush(self) -> None:
@@ -119,7 +139,7 @@ STATIC mp_uint_t usb_cdc_serial_ioctl_stream(mp_obj_t self_in, mp_uint_t request
             if ((flags & MP_STREAM_POLL_RD) && common_hal_usb_cdc_serial_get_in_waiting(self) > 0) {
                 ret |= MP_STREAM_POLL_RD;
             }
-            if ((flags & MP_STREAM_POLL_WR) && common_hal_usb_cdc_serial_get_out_waiting(self) == 0) {
+            if ((flags & MP_STREAM_POLL_WR) && common_hal_usb_cdc_serial_get_out_available(self) > 0) {
                 ret |= MP_STREAM_POLL_WR;
             }
             break;
@@ -129,6 +149,12 @@ STATIC mp_uint_t usb_cdc_serial_ioctl_stream(mp_obj_t self_in, mp_uint_t request
             common_hal_usb_cdc_serial_flush(self);
             break;
 
+        case MP_STREAM_WRITEV: {
+            const mp_stream_writev_t *v = (const mp_stream_writev_t *)arg;
+            ret = common_hal_usb_cdc_serial_writev(self, v->bufs, v->count, errcode);
+            break;
+        }
+
         default:
             *errcode = MP_EINVAL;
             ret = MP_STREAM_ERROR;
@@ -249,6 +275,8 @@ STATIC const mp_rom_map_elem_t usb_cdc_serial_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_readline),     MP_ROM_PTR(&mp_stream_unbuffered_readline_obj)},
     { MP_ROM_QSTR(MP_QSTR_readlines),    MP_ROM_PTR(&mp_stream_unbuffered_readlines_obj)},
     { MP_OBJ_NEW_QSTR(MP_QSTR_write),    MP_ROM_PTR(&mp_stream_write_obj) },
+    { MP_ROM_QSTR(MP_QSTR_writev),       MP_ROM_PTR(&mp_stream_writev_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readv),        MP_ROM_PTR(&mp_stream_readv_obj) },
 
     // Other pyserial-inspired attributes.
     { MP_OBJ_NEW_QSTR(MP_QSTR_in_waiting),          MP_ROM_PTR(&usb_cdc_serial_in_waiting_obj) },
@@ -162,19 +162,30 @@ STATIC mp_obj_t usb_hid_device_make_new(const mp_obj_type_t *type, size_t n_args
 }
 
 
-//|     def send_report(self, report: ReadableBuffer, report_id: Optional[int] = None) -> None:
+//|     def send_report(
+//|         self, report: ReadableBuffer, report_id: Optional[int] = None, *, block: bool = True
+//|     ) -> bool:
 //|         """Send an HID report. If the device descriptor specifies zero or one report id's,
 //|         you can supply `None` (the default) as the value of ``report_id``.
 //|         Otherwise you must specify which report id to use when sending the report.
+//|
+//|         If ``block`` is ``True``, wait until the report can be sent, and raise `OSError`
+//|         if the host does not take it within two seconds.
+//|         If ``block`` is ``False``, queue the report to be sent in the background after
+//|         any reports already queued, and return ``False`` instead if the queue is full.
+//|         Reports are sent in order whether or not they were queued.
+//|
+//|         :return: ``True`` if the report was sent or queued
 //|         """
 //|         ...
 STATIC mp_obj_t usb_hid_device_send_report(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     usb_hid_device_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
 
-    enum { ARG_report, ARG_report_id };
+    enum { ARG_report, ARG_report_id, ARG_block };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_report, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_report_id, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_block, MP_ARG_KW_ONLY | MP_ARG_BOOL, {.u_bool = true} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -190,8 +201,7 @@ STATIC mp_obj_t usb_hid_device_send_report(size_t n_args, const mp_obj_t *pos_ar
     }
     const uint8_t report_id = common_hal_usb_hid_device_validate_report_id(self, report_id_arg);
 
-    common_hal_usb_hid_device_send_report(self, ((uint8_t *)bufinfo.buf), bufinfo.len, report_id);
-    return mp_const_none;
+    return mp_obj_new_bool(common_hal_usb_hid_device_send_report(self, ((uint8_t *)bufinfo.buf), bufinfo.len, report_id, args[ARG_block].u_bool));
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(usb_hid_device_send_report_obj, 1, usb_hid_device_send_report);
 
@@ -28,6 +28,7 @@
 
 #include "shared-bindings/usb_midi/PortIn.h"
 #include "shared-bindings/util.h"
+#include "shared-module/usb_midi/__init__.h"
 
 #include "py/stream.h"
 #include "py/objproperty.h"
@@ -62,7 +63,30 @@
 //|         :return: number of bytes read and stored into ``buf``
 //|         :rtype: bytes or None"""
 //|         ...
+//|     def read_messages(self, buffer: WriteableBuffer) -> int:
+//|         """Read whole MIDI messages into ``buffer`` without allocating.
 //|
+//|         Each message is stored as an 8-byte record: the status byte, two data
+//|         bytes (zero when unused), a reserved zero byte, and a little-endian
+//|         32-bit timestamp in `supervisor.ticks_ms()` units taken when the message was
+//|         read. System exclusive messages are skipped. The records can be unpacked
+//|         with ``struct.unpack_from("<BBBxI", buffer, 8 * i)``.
+//|
+//|         Don't mix this with `read` or `readinto` on the same port, because they
+//|         consume the same incoming data.
+//|
+//|         :return: the number of messages stored, at most ``len(buffer) // 8``
+//|         :rtype: int"""
+//|         ...
+//|
+STATIC mp_obj_t usb_midi_portin_read_messages(mp_obj_t self_in, mp_obj_t buffer_in) {
+    usb_midi_portin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+    size_t count = common_hal_usb_midi_portin_read_messages(self, bufinfo.buf, bufinfo.len / sizeof(usb_midi_message_t));
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(usb_midi_portin_read_messages_obj, usb_midi_portin_read_messages);
 
 // These three methods are used by the shared stream methods.
 STATIC mp_uint_t usb_midi_portin_read(mp_obj_t self_in, void *buf_in, mp_uint_t size, int *errcode) {
@@ -97,6 +121,8 @@ STATIC const mp_rom_map_elem_t usb_midi_portin_locals_dict_table[] = {
     // Standard stream methods.
     { MP_OBJ_NEW_QSTR(MP_QSTR_read),     MP_ROM_PTR(&mp_stream_read_obj) },
     { MP_OBJ_NEW_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_read_messages), MP_ROM_PTR(&usb_midi_portin_read_messages_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(usb_midi_portin_locals_dict, usb_midi_portin_locals_dict_table);
 
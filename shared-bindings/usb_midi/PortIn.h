@@ -36,6 +36,7 @@ extern size_t common_hal_usb_midi_portin_read(usb_midi_portin_obj_t *self,
     uint8_t *data, size_t len, int *errcode);
 
 extern uint32_t common_hal_usb_midi_portin_bytes_available(usb_midi_portin_obj_t *self);
+extern size_t common_hal_usb_midi_portin_read_messages(usb_midi_portin_obj_t *self, uint8_t *buffer, size_t max_count);
 extern void common_hal_usb_midi_portin_clear_buffer(usb_midi_portin_obj_t *self);
 
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_USB_MIDI_PORTIN_H
@@ -28,6 +28,7 @@
 
 #include "shared-bindings/usb_midi/PortOut.h"
 #include "shared-bindings/util.h"
+#include "shared-module/usb_midi/__init__.h"
 
 #include "py/stream.h"
 #include "py/objproperty.h"
@@ -51,6 +52,23 @@
 //|         :return: the number of bytes written
 //|         :rtype: int or None"""
 //|         ...
+//|     def write_messages(self, buffer: ReadableBuffer) -> int:
+//|         """Send whole MIDI messages from ``buffer`` without allocating.
+//|
+//|         ``buffer`` holds 8-byte records in the format produced by
+//|         `PortIn.read_messages`: the status byte, two data bytes, a reserved byte,
+//|         and a little-endian 32-bit timestamp in `supervisor.ticks_ms()` units.
+//|         Messages whose timestamps have passed are sent right away. Later ones
+//|         are held and sent in the background when they are due, with
+//|         millisecond resolution, so records need not be in time order.
+//|
+//|         System exclusive messages can't be sent this way; use `write` instead.
+//|
+//|         :return: the number of messages accepted. This is less than the number
+//|           of records when too many messages are already waiting; send the rest
+//|           later.
+//|         :rtype: int"""
+//|         ...
 //|
 
 STATIC mp_uint_t usb_midi_portout_write(mp_obj_t self_in, const void *buf_in, mp_uint_t size, int *errcode) {
@@ -60,6 +78,15 @@ STATIC mp_uint_t usb_midi_portout_write(mp_obj_t self_in, const void *buf_in, mp
     return common_hal_usb_midi_portout_write(self, buf, size, errcode);
 }
 
+STATIC mp_obj_t usb_midi_portout_write_messages(mp_obj_t self_in, mp_obj_t buffer_in) {
+    usb_midi_portout_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_READ);
+    size_t count = common_hal_usb_midi_portout_write_messages(self, bufinfo.buf, bufinfo.len / sizeof(usb_midi_message_t));
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(usb_midi_portout_write_messages_obj, usb_midi_portout_write_messages);
+
 STATIC mp_uint_t usb_midi_portout_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t arg, int *errcode) {
     usb_midi_portout_obj_t *self = MP_OBJ_TO_PTR(self_in);
     mp_uint_t ret;
@@ -79,6 +106,8 @@ STATIC mp_uint_t usb_midi_portout_ioctl(mp_obj_t self_in, mp_uint_t request, mp_
 STATIC const mp_rom_map_elem_t usb_midi_portout_locals_dict_table[] = {
     // Standard stream methods.
     { MP_OBJ_NEW_QSTR(MP_QSTR_write),    MP_ROM_PTR(&mp_stream_write_obj) },
+
+    { MP_ROM_QSTR(MP_QSTR_write_messages), MP_ROM_PTR(&usb_midi_portout_write_messages_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(usb_midi_portout_locals_dict, usb_midi_portout_locals_dict_table);
 
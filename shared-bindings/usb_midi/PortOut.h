@@ -36,5 +36,6 @@ extern size_t common_hal_usb_midi_portout_write(usb_midi_portout_obj_t *self,
     const uint8_t *data, size_t len, int *errcode);
 
 extern bool common_hal_usb_midi_portout_ready_to_tx(usb_midi_portout_obj_t *self);
+extern size_t common_hal_usb_midi_portout_write_messages(usb_midi_portout_obj_t *self, const uint8_t *buffer, size_t count);
 
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_USB_MIDI_PORTOUT_H
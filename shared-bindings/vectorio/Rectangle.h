@@ -11,6 +11,7 @@ void common_hal_vectorio_rectangle_construct(vectorio_rectangle_t *self, uint32_
 void common_hal_vectorio_rectangle_set_on_dirty(vectorio_rectangle_t *self, vectorio_event_t on_dirty);
 
 uint32_t common_hal_vectorio_rectangle_get_pixel(void *rectangle, int16_t x, int16_t y);
+int common_hal_vectorio_rectangle_get_row_spans(void *rectangle, int16_t y, int16_t x1, int16_t x2, int16_t *spans, int max_spans, uint32_t *pixel);
 
 void common_hal_vectorio_rectangle_get_area(void *rectangle, displayio_area_t *out_area);
 
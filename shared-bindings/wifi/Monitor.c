@@ -36,19 +36,25 @@
 //|     """For monitoring WiFi packets."""
 //|
 
-//|     def __init__(self, channel: Optional[int] = 1, queue: Optional[int] = 128) -> None:
+//|     def __init__(
+//|         self, channel: Optional[int] = 1, queue: Optional[int] = 128, payload: bool = True
+//|     ) -> None:
 //|         """Initialize `wifi.Monitor` singleton.
 //|
 //|         :param int channel: The WiFi channel to scan.
 //|         :param int queue: The queue size for buffering the packet.
+//|         :param bool payload: Whether to keep whole frames for `packet`. When False, only
+//|           the first 24 bytes, the MAC header, are kept, which is all `get_packets_into`
+//|           returns and saves copying every frame.
 //|
 //|         """
 //|         ...
 STATIC mp_obj_t wifi_monitor_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_channel, ARG_queue };
+    enum { ARG_channel, ARG_queue, ARG_payload };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_channel, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
         { MP_QSTR_queue, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 128} },
+        { MP_QSTR_payload, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -60,7 +66,7 @@ STATIC mp_obj_t wifi_monitor_make_new(const mp_obj_type_t *type, size_t n_args,
     wifi_monitor_obj_t *self = MP_STATE_VM(wifi_monitor_singleton);
     if (common_hal_wifi_monitor_deinited()) {
         self = mp_obj_malloc(wifi_monitor_obj_t, &wifi_monitor_type);
-        common_hal_wifi_monitor_construct(self, channel, queue);
+        common_hal_wifi_monitor_construct(self, channel, queue, args[ARG_payload].u_bool);
         MP_STATE_VM(wifi_monitor_singleton) = self;
     }
 
@@ -138,6 +144,88 @@ STATIC mp_obj_t wifi_monitor_obj_get_packet(mp_obj_t self_in) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(wifi_monitor_packet_obj, wifi_monitor_obj_get_packet);
 
+//|     def set_filter(
+//|         self,
+//|         *,
+//|         subtypes: Optional[Sequence[int]] = None,
+//|         addresses: ReadableBuffer = b"",
+//|         min_rssi: int = -128,
+//|     ) -> None:
+//|         """Chooses which frames are queued. Frames are checked as they arrive, so those
+//|         that don't match neither take space in the queue nor count as lost.
+//|
+//|         :param Sequence[int] subtypes: the kinds of frame to keep, each as ``type << 4 | subtype``
+//|           from the frame control field, such as ``0x04`` for probe requests and ``0x08``
+//|           for beacons. ``None`` keeps all management frames, the default.
+//|         :param ReadableBuffer addresses: transmitter addresses to keep frames from, six bytes
+//|           each, back to back. Empty keeps frames from anyone. At most 8 addresses.
+//|         :param int min_rssi: the weakest signal strength to keep, in dBm
+//|         """
+//|         ...
+STATIC mp_obj_t wifi_monitor_obj_set_filter(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_subtypes, ARG_addresses, ARG_min_rssi };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_subtypes, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_addresses, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_empty_bytes} },
+        { MP_QSTR_min_rssi, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = -128} },
+    };
+    wifi_monitor_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    if (common_hal_wifi_monitor_deinited()) {
+        raise_deinited_error();
+    }
+
+    uint64_t subtypes = 0xffff;
+    if (args[ARG_subtypes].u_obj != mp_const_none) {
+        subtypes = 0;
+        mp_obj_iter_buf_t iter_buf;
+        mp_obj_t iterable = mp_getiter(args[ARG_subtypes].u_obj, &iter_buf);
+        mp_obj_t item;
+        while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+            subtypes |= 1ULL << mp_arg_validate_int_range(mp_obj_get_int(item), 0, 63, MP_QSTR_subtypes);
+        }
+    }
+
+    mp_buffer_info_t addresses;
+    mp_get_buffer_raise(args[ARG_addresses].u_obj, &addresses, MP_BUFFER_READ);
+    if (addresses.len % 6 != 0) {
+        mp_raise_ValueError_varg(MP_ERROR_TEXT("%q must be a multiple of %d bytes"), MP_QSTR_addresses, 6);
+    }
+
+    mp_int_t min_rssi = mp_arg_validate_int_range(args[ARG_min_rssi].u_int, -128, 127, MP_QSTR_min_rssi);
+
+    common_hal_wifi_monitor_set_filter(self, subtypes, addresses.buf, addresses.len / 6, min_rssi);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(wifi_monitor_set_filter_obj, 1, wifi_monitor_obj_set_filter);
+
+//|     def get_packets_into(self, buffer: WriteableBuffer) -> int:
+//|         """Moves queued frames into ``buffer`` without allocating, as many as fit, as
+//|         records of 32 bytes each:
+//|
+//|         * byte 0: the channel
+//|         * byte 1: the signal strength in dBm, signed
+//|         * bytes 2-3: the frame length, little endian
+//|         * bytes 4-7: the receive time in microseconds, little endian
+//|         * bytes 8-31: the start of the frame, which holds the MAC header, padded
+//|           with zeros if the frame is shorter
+//|
+//|         Returns the number of records written."""
+//|         ...
+//|
+STATIC mp_obj_t wifi_monitor_obj_get_packets_into(mp_obj_t self_in, mp_obj_t buffer_in) {
+    if (common_hal_wifi_monitor_deinited()) {
+        raise_deinited_error();
+    }
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer_in, &bufinfo, MP_BUFFER_WRITE);
+    size_t count = common_hal_wifi_monitor_get_packets_into(self_in, bufinfo.buf, bufinfo.len / WIFI_MONITOR_RECORD_LEN);
+    return MP_OBJ_NEW_SMALL_INT(count);
+}
+MP_DEFINE_CONST_FUN_OBJ_2(wifi_monitor_get_packets_into_obj, wifi_monitor_obj_get_packets_into);
+
 STATIC const mp_rom_map_elem_t wifi_monitor_locals_dict_table[] = {
     // properties
     { MP_ROM_QSTR(MP_QSTR_channel), MP_ROM_PTR(&wifi_monitor_channel_obj) },
@@ -148,6 +236,8 @@ STATIC const mp_rom_map_elem_t wifi_monitor_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_lost),    MP_ROM_PTR(&wifi_monitor_lost_obj) },
     { MP_ROM_QSTR(MP_QSTR_queued),  MP_ROM_PTR(&wifi_monitor_queued_obj) },
     { MP_ROM_QSTR(MP_QSTR_packet),  MP_ROM_PTR(&wifi_monitor_packet_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_filter), MP_ROM_PTR(&wifi_monitor_set_filter_obj) },
+    { MP_ROM_QSTR(MP_QSTR_get_packets_into), MP_ROM_PTR(&wifi_monitor_get_packets_into_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(wifi_monitor_locals_dict, wifi_monitor_locals_dict_table);
 
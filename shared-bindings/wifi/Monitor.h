@@ -31,8 +31,13 @@
 
 extern const mp_obj_type_t wifi_monitor_type;
 
+// Bytes of each frame kept when payloads aren't, enough for the MAC header.
+#define WIFI_MONITOR_HEADER_LEN (24)
+// Bytes per frame written by get_packets_into: channel, rssi, length, timestamp, header.
+#define WIFI_MONITOR_RECORD_LEN (8 + WIFI_MONITOR_HEADER_LEN)
+
 void common_hal_wifi_monitor_construct(wifi_monitor_obj_t *self,
-    uint8_t channel, size_t queue);
+    uint8_t channel, size_t queue, bool payload);
 void common_hal_wifi_monitor_deinit(wifi_monitor_obj_t *self);
 bool common_hal_wifi_monitor_deinited(void);
 
@@ -47,4 +52,10 @@ mp_obj_t common_hal_wifi_monitor_get_queued(wifi_monitor_obj_t *self);
 
 mp_obj_t common_hal_wifi_monitor_get_packet(wifi_monitor_obj_t *self);
 
+// Bit (type << 4 | subtype) of subtypes selects each kind of frame to keep.
+void common_hal_wifi_monitor_set_filter(wifi_monitor_obj_t *self, uint64_t subtypes,
+    const uint8_t *addresses, size_t address_count, int8_t min_rssi);
+// Writes up to count WIFI_MONITOR_RECORD_LEN byte records to buf and returns how many.
+size_t common_hal_wifi_monitor_get_packets_into(wifi_monitor_obj_t *self, uint8_t *buf, size_t count);
+
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_WIFI_MONITOR_H
@@ -103,6 +103,11 @@ extern void common_hal_wifi_radio_start_dhcp_server(wifi_radio_obj_t *self);
 extern void common_hal_wifi_radio_stop_dhcp_server(wifi_radio_obj_t *self);
 
 extern wifi_radio_error_t common_hal_wifi_radio_connect(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, mp_float_t timeout, uint8_t *bssid, size_t bssid_len);
+// Begin connecting without waiting for the result. If an attempt to the same network is already
+// under way, it is left to continue. Poll common_hal_wifi_radio_connect_finished() for the result.
+extern wifi_radio_error_t common_hal_wifi_radio_connect_start(wifi_radio_obj_t *self, uint8_t *ssid, size_t ssid_len, uint8_t *password, size_t password_len, uint8_t channel, uint8_t *bssid, size_t bssid_len);
+// Returns true once the current connection attempt has succeeded or failed, and sets *error.
+extern bool common_hal_wifi_radio_connect_finished(wifi_radio_obj_t *self, wifi_radio_error_t *error);
 extern bool common_hal_wifi_radio_get_connected(wifi_radio_obj_t *self);
 
 extern mp_obj_t common_hal_wifi_radio_get_ap_info(wifi_radio_obj_t *self);
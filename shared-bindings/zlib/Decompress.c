@@ -0,0 +1,154 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/zlib/Decompress.h"
+
+//| class Decompress:
+//|     """A stream decompressor, returned by `zlib.decompressobj`. Compressed data can be
+//|     passed in pieces of any size, and only the DEFLATE window (its size set by
+//|     *wbits*) is kept between calls, so large data doesn't have to fit in memory at once."""
+//|
+
+//|     def decompress(self, data: ReadableBuffer, max_length: int = 0) -> bytes:
+//|         """Decompress *data*, returning the bytes it produced so far. Input that ends
+//|         partway through is kept until the next call.
+//|
+//|         If *max_length* is not zero, at most *max_length* bytes are returned and the
+//|         input that wasn't used is available as `unconsumed_tail`, to be passed to
+//|         a later call."""
+//|         ...
+STATIC mp_obj_t zlib_decompress_decompress(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_data, ARG_max_length };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_data, MP_ARG_REQUIRED | MP_ARG_OBJ, {} },
+        { MP_QSTR_max_length, MP_ARG_INT, {.u_int = 0} },
+    };
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_data].u_obj, &bufinfo, MP_BUFFER_READ);
+    mp_int_t max_length = mp_arg_validate_int_min(args[ARG_max_length].u_int, 0, MP_QSTR_max_length);
+
+    vstr_t vstr;
+    vstr_init(&vstr, max_length > 0 ? (size_t)max_length : bufinfo.len * 2);
+    common_hal_zlib_decompress_decompress(self, bufinfo.buf, bufinfo.len, &vstr, max_length);
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(zlib_decompress_decompress_obj, 1, zlib_decompress_decompress);
+
+//|     def decompress_into(self, data: ReadableBuffer, buffer: WriteableBuffer) -> int:
+//|         """Decompress *data* like `decompress`, but write the output into *buffer*
+//|         instead of allocating new bytes. Returns the number of bytes written. Input
+//|         that didn't fit is available as `unconsumed_tail`."""
+//|         ...
+STATIC mp_obj_t zlib_decompress_decompress_into(mp_obj_t self_in, mp_obj_t data, mp_obj_t buffer) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data, &bufinfo, MP_BUFFER_READ);
+    mp_buffer_info_t outinfo;
+    mp_get_buffer_raise(buffer, &outinfo, MP_BUFFER_WRITE);
+    mp_arg_validate_length_min(outinfo.len, 1, MP_QSTR_buffer);
+
+    vstr_t vstr;
+    vstr_init_fixed_buf(&vstr, outinfo.len, outinfo.buf);
+    common_hal_zlib_decompress_decompress(self, bufinfo.buf, bufinfo.len, &vstr, outinfo.len);
+    return MP_OBJ_NEW_SMALL_INT(vstr.len);
+}
+MP_DEFINE_CONST_FUN_OBJ_3(zlib_decompress_decompress_into_obj, zlib_decompress_decompress_into);
+
+//|     def flush(self) -> bytes:
+//|         """Decompress what is left in `unconsumed_tail` and return it."""
+//|         ...
+STATIC mp_obj_t zlib_decompress_flush(mp_obj_t self_in) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_obj_t tail = common_hal_zlib_decompress_get_unconsumed_tail(self);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(tail, &bufinfo, MP_BUFFER_READ);
+
+    vstr_t vstr;
+    vstr_init(&vstr, bufinfo.len * 2);
+    common_hal_zlib_decompress_decompress(self, bufinfo.buf, bufinfo.len, &vstr, 0);
+    return mp_obj_new_bytes_from_vstr(&vstr);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(zlib_decompress_flush_obj, zlib_decompress_flush);
+
+//|     eof: bool
+//|     """True once the end of the compressed stream has been reached. (read-only)"""
+STATIC mp_obj_t zlib_decompress_get_eof(mp_obj_t self_in) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_zlib_decompress_get_eof(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(zlib_decompress_get_eof_obj, zlib_decompress_get_eof);
+
+MP_PROPERTY_GETTER(zlib_decompress_eof_obj,
+    (mp_obj_t)&zlib_decompress_get_eof_obj);
+
+//|     unconsumed_tail: bytes
+//|     """Input from the last call that wasn't used because the output limit was
+//|     reached. (read-only)"""
+STATIC mp_obj_t zlib_decompress_get_unconsumed_tail(mp_obj_t self_in) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_zlib_decompress_get_unconsumed_tail(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(zlib_decompress_get_unconsumed_tail_obj, zlib_decompress_get_unconsumed_tail);
+
+MP_PROPERTY_GETTER(zlib_decompress_unconsumed_tail_obj,
+    (mp_obj_t)&zlib_decompress_get_unconsumed_tail_obj);
+
+//|     unused_data: bytes
+//|     """Input found after the end of the compressed stream. (read-only)"""
+//|
+STATIC mp_obj_t zlib_decompress_get_unused_data(mp_obj_t self_in) {
+    zlib_decompress_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return common_hal_zlib_decompress_get_unused_data(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(zlib_decompress_get_unused_data_obj, zlib_decompress_get_unused_data);
+
+MP_PROPERTY_GETTER(zlib_decompress_unused_data_obj,
+    (mp_obj_t)&zlib_decompress_get_unused_data_obj);
+
+STATIC const mp_rom_map_elem_t zlib_decompress_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_decompress), MP_ROM_PTR(&zlib_decompress_decompress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_decompress_into), MP_ROM_PTR(&zlib_decompress_decompress_into_obj) },
+    { MP_ROM_QSTR(MP_QSTR_flush), MP_ROM_PTR(&zlib_decompress_flush_obj) },
+    { MP_ROM_QSTR(MP_QSTR_eof), MP_ROM_PTR(&zlib_decompress_eof_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unconsumed_tail), MP_ROM_PTR(&zlib_decompress_unconsumed_tail_obj) },
+    { MP_ROM_QSTR(MP_QSTR_unused_data), MP_ROM_PTR(&zlib_decompress_unused_data_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(zlib_decompress_locals_dict, zlib_decompress_locals_dict_table);
+
+MP_DEFINE_CONST_OBJ_TYPE(
+    zlib_decompress_type,
+    MP_QSTR_Decompress,
+    MP_TYPE_FLAG_HAS_SPECIAL_ACCESSORS,
+    locals_dict, &zlib_decompress_locals_dict
+    );
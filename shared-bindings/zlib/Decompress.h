@@ -0,0 +1,42 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_ZLIB_DECOMPRESS_H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_ZLIB_DECOMPRESS_H
+
+#include "py/misc.h"
+#include "shared-module/zlib/Decompress.h"
+
+extern const mp_obj_type_t zlib_decompress_type;
+
+void common_hal_zlib_decompress_construct(zlib_decompress_obj_t *self, mp_int_t wbits, mp_obj_t window);
+// Inflate data, appending to out until it holds max_length bytes (0 for no limit).
+void common_hal_zlib_decompress_decompress(zlib_decompress_obj_t *self, const uint8_t *data, size_t len, vstr_t *out, size_t max_length);
+bool common_hal_zlib_decompress_get_eof(zlib_decompress_obj_t *self);
+mp_obj_t common_hal_zlib_decompress_get_unconsumed_tail(zlib_decompress_obj_t *self);
+mp_obj_t common_hal_zlib_decompress_get_unused_data(zlib_decompress_obj_t *self);
+
+#endif // MICROPY_INCLUDED_SHARED_BINDINGS_ZLIB_DECOMPRESS_H
@@ -38,6 +38,7 @@
 #include "py/parsenum.h"
 
 #include "shared-bindings/zlib/__init__.h"
+#include "shared-bindings/zlib/Decompress.h"
 
 //| """zlib decompression functionality
 //|
@@ -78,9 +79,46 @@ STATIC mp_obj_t zlib_decompress(size_t n_args, const mp_obj_t *args) {
 }
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(zlib_decompress_obj, 1, 3, zlib_decompress);
 
+//| def decompressobj(wbits: int = 15, *, window: Optional[WriteableBuffer] = None) -> Decompress:
+//|     """Return a `Decompress` object for decompressing a stream that arrives in pieces.
+//|
+//|     *wbits* chooses the format and window size as for `decompress`: 8 to 15 for zlib
+//|     (0 to take the window size from the zlib header), -8 to -15 for raw DEFLATE and
+//|     24 to 31 for gzip. The window takes ``2 ** (wbits & 15)`` bytes, so a smaller
+//|     *wbits* saves memory for data compressed with a smaller window.
+//|
+//|     :param int wbits: format and window size, see above
+//|     :param WriteableBuffer window: buffer to use as the window instead of allocating one.
+//|       It must hold at least the window size.
+//|     """
+//|     ...
+//|
+STATIC mp_obj_t zlib_decompressobj(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_wbits, ARG_window };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_wbits, MP_ARG_INT, {.u_int = 15} },
+        { MP_QSTR_window, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t wbits = args[ARG_wbits].u_int;
+    mp_int_t bits = wbits < 0 ? -wbits : wbits >= 16 ? wbits - 16 : wbits;
+    if (wbits != 0 && (bits < 8 || bits > 15)) {
+        mp_arg_error_invalid(MP_QSTR_wbits);
+    }
+
+    zlib_decompress_obj_t *self = mp_obj_malloc(zlib_decompress_obj_t, &zlib_decompress_type);
+    common_hal_zlib_decompress_construct(self, wbits, args[ARG_window].u_obj);
+    return MP_OBJ_FROM_PTR(self);
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_KW(zlib_decompressobj_obj, 0, zlib_decompressobj);
+
 STATIC const mp_rom_map_elem_t zlib_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_zlib) },
     { MP_ROM_QSTR(MP_QSTR_decompress), MP_ROM_PTR(&zlib_decompress_obj) },
+    { MP_ROM_QSTR(MP_QSTR_decompressobj), MP_ROM_PTR(&zlib_decompressobj_obj) },
+    { MP_ROM_QSTR(MP_QSTR_Decompress), MP_ROM_PTR(&zlib_decompress_type) },
 };
 
 STATIC MP_DEFINE_CONST_DICT(zlib_globals, zlib_globals_table);
@@ -34,15 +34,52 @@
 #include "shared-bindings/_bleio/ScanEntry.h"
 #include "shared-bindings/_bleio/ScanResults.h"
 
-bleio_scanresults_obj_t *shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t *prefixes, size_t prefixes_len, mp_int_t minimum_rssi) {
+bleio_scanresults_obj_t *shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t *prefixes, size_t prefixes_len, mp_int_t minimum_rssi, mp_float_t duplicate_timeout) {
     bleio_scanresults_obj_t *self = mp_obj_malloc(bleio_scanresults_obj_t, &bleio_scanresults_type);
     ringbuf_alloc(&self->buf, buffer_size);
     self->prefixes = prefixes;
     self->prefix_length = prefixes_len;
     self->minimum_rssi = minimum_rssi;
+    self->duplicate_timeout_ms = (uint32_t)(duplicate_timeout * 1000);
+    self->seen = NULL;
+    if (self->duplicate_timeout_ms > 0) {
+        // Allocated up front because entries are appended from the BLE event handler.
+        self->seen = m_new(bleio_scanresults_seen_t, BLEIO_SCAN_DUPLICATE_TABLE_SIZE);
+        memset(self->seen, 0xff, sizeof(bleio_scanresults_seen_t) * BLEIO_SCAN_DUPLICATE_TABLE_SIZE);
+    }
     return self;
 }
 
+// FNV-1a, which is small and good enough to notice changed advertising data.
+STATIC uint32_t scan_hash(uint32_t hash, const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ data[i]) * 16777619;
+    }
+    return hash;
+}
+
+// Returns true when the same device sent the same data within the duplicate timeout. Otherwise
+// the device is remembered as just returned. Colliding devices evict each other, so the table can
+// only let extra duplicates through and never drops new data.
+STATIC bool scan_is_duplicate(bleio_scanresults_obj_t *self, uint32_t ticks_ms, bool scan_response,
+    const uint8_t *peer_addr, uint8_t addr_type, const uint8_t *data, uint16_t len) {
+    uint8_t kind = (addr_type & 0x7f) | (scan_response ? 0x80 : 0);
+    uint32_t addr_hash = scan_hash(scan_hash(2166136261, &kind, 1), peer_addr, NUM_BLEIO_ADDRESS_BYTES);
+    uint32_t data_hash = scan_hash(2166136261, data, len);
+    bleio_scanresults_seen_t *slot = &self->seen[addr_hash & (BLEIO_SCAN_DUPLICATE_TABLE_SIZE - 1)];
+    if (slot->kind == kind &&
+        memcmp(slot->addr, peer_addr, NUM_BLEIO_ADDRESS_BYTES) == 0 &&
+        slot->data_hash == data_hash &&
+        ticks_ms - slot->ticks_ms < self->duplicate_timeout_ms) {
+        return true;
+    }
+    memcpy(slot->addr, peer_addr, NUM_BLEIO_ADDRESS_BYTES);
+    slot->kind = kind;
+    slot->data_hash = data_hash;
+    slot->ticks_ms = ticks_ms;
+    return false;
+}
+
 mp_obj_t common_hal_bleio_scanresults_next(bleio_scanresults_obj_t *self) {
     while (ringbuf_num_filled(&self->buf) == 0 && !self->done && !mp_hal_is_interrupted()) {
         RUN_BACKGROUND_TASKS;
@@ -108,6 +145,13 @@ void shared_module_bleio_scanresults_append(bleio_scanresults_obj_t *self,
     if (!bleio_scanentry_data_matches(data, len, self->prefixes, self->prefix_length, true)) {
         return;
     }
+
+    // Drop repeats before they take up buffer space and become ScanEntry objects.
+    if (self->seen != NULL &&
+        scan_is_duplicate(self, (uint32_t)ticks_ms, scan_response, peer_addr, addr_type, data, len)) {
+        return;
+    }
+
     uint8_t type = 0;
     if (connectable) {
         type |= 1 << 0;
@@ -32,6 +32,20 @@
 
 #include "py/obj.h"
 #include "py/ringbuf.h"
+#include "shared-module/_bleio/Address.h"
+
+// Number of recently returned devices remembered when duplicate_timeout is set. Must be a power of 2.
+#ifndef BLEIO_SCAN_DUPLICATE_TABLE_SIZE
+#define BLEIO_SCAN_DUPLICATE_TABLE_SIZE (64)
+#endif
+
+typedef struct {
+    uint8_t addr[NUM_BLEIO_ADDRESS_BYTES];
+    // Address type plus the scan response flag in bit 7. 0xff marks an unused slot.
+    uint8_t kind;
+    uint32_t data_hash;
+    uint32_t ticks_ms;
+} bleio_scanresults_seen_t;
 
 typedef struct {
     mp_obj_base_t base;
@@ -42,11 +56,14 @@ typedef struct {
     uint8_t *prefixes;
     size_t prefix_length;
     mp_int_t minimum_rssi;
+    // Hashed by address. Only allocated when duplicate_timeout_ms is non-zero.
+    bleio_scanresults_seen_t *seen;
+    uint32_t duplicate_timeout_ms;
     bool active;
     bool done;
 } bleio_scanresults_obj_t;
 
-bleio_scanresults_obj_t *shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t *prefixes, size_t prefixes_len, mp_int_t minimum_rssi);
+bleio_scanresults_obj_t *shared_module_bleio_new_scanresults(size_t buffer_size, uint8_t *prefixes, size_t prefixes_len, mp_int_t minimum_rssi, mp_float_t duplicate_timeout);
 
 bool shared_module_bleio_scanresults_get_done(bleio_scanresults_obj_t *self);
 void shared_module_bleio_scanresults_set_done(bleio_scanresults_obj_t *self, bool done);
@@ -55,6 +55,11 @@ uint16_t get_layer_pixel(layer_obj_t *layer, int16_t x, int16_t y) {
         }
     }
 
+    // Skip tiles with only transparent pixels.
+    if (frame < 16 && !(layer->tile_colors[frame] & layer->opaque_colors)) {
+        return TRANSPARENT;
+    }
+
     // Get the position within the tile.
     x &= 0x0f;
     y &= 0x0f;
@@ -103,3 +108,62 @@ uint16_t get_layer_pixel(layer_obj_t *layer, int16_t x, int16_t y) {
     // Convert to 16-bit color using the palette.
     return layer->palette[pixel << 1] | layer->palette[(pixel << 1) + 1] << 8;
 }
+
+// Find the palette entries used by each tile, so that empty tiles can be
+// skipped without looking at their pixels.
+void layer_scan_tiles(layer_obj_t *layer) {
+    for (size_t tile = 0; tile < 16; ++tile) {
+        uint16_t colors = 0;
+        const uint8_t *pixels = layer->graphic + (tile << 7);
+        for (size_t i = 0; i < 128; ++i) {
+            colors |= (1 << (pixels[i] >> 4)) | (1 << (pixels[i] & 0x0f));
+        }
+        layer->tile_colors[tile] = colors;
+    }
+}
+
+// The palette may change between renders, so this is done at the start of each.
+void layer_update_opaque_colors(layer_obj_t *layer) {
+    uint16_t colors = 0;
+    for (size_t i = 0; i < 16; ++i) {
+        uint16_t c = layer->palette[i << 1] | layer->palette[(i << 1) + 1] << 8;
+        if (c != TRANSPARENT) {
+            colors |= 1 << i;
+        }
+    }
+    layer->opaque_colors = colors;
+}
+
+// Get the area covered by the layer, returning false when it is empty.
+bool layer_get_area(layer_obj_t *layer, displayio_area_t *area) {
+    area->x1 = layer->x;
+    area->y1 = layer->y;
+    area->x2 = layer->x + (layer->width << 4);
+    area->y2 = layer->y + (layer->height << 4);
+    area->next = NULL;
+    return !displayio_area_empty(area);
+}
+
+// Get the area that needs redrawing since the last call, covering both where
+// the layer was and where it is now. Returns false when nothing changed.
+bool layer_take_dirty_area(layer_obj_t *layer, displayio_area_t *area) {
+    if (layer->x == layer->drawn_x && layer->y == layer->drawn_y &&
+        layer->frame == layer->drawn_frame && layer->rotation == layer->drawn_rotation) {
+        return false;
+    }
+    displayio_area_t now;
+    layer_get_area(layer, &now);
+    area->x1 = layer->drawn_x;
+    area->y1 = layer->drawn_y;
+    area->x2 = layer->drawn_x + (layer->width << 4);
+    area->y2 = layer->drawn_y + (layer->height << 4);
+    area->next = NULL;
+    if (layer->x != layer->drawn_x || layer->y != layer->drawn_y) {
+        displayio_area_union(area, &now, area);
+    }
+    layer->drawn_x = layer->x;
+    layer->drawn_y = layer->y;
+    layer->drawn_frame = layer->frame;
+    layer->drawn_rotation = layer->rotation;
+    return !displayio_area_empty(area);
+}
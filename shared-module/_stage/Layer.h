@@ -31,6 +31,7 @@
 #include <stdbool.h>
 
 #include "py/obj.h"
+#include "shared-module/displayio/area.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -41,8 +42,20 @@ typedef struct {
     uint8_t width, height;
     uint8_t frame;
     uint8_t rotation;
+    // Where the layer was when its dirty area was last taken.
+    int16_t drawn_x, drawn_y;
+    uint8_t drawn_frame;
+    uint8_t drawn_rotation;
+    // Bit n is set when the tile uses palette entry n.
+    uint16_t tile_colors[16];
+    // Bit n is set when palette entry n isn't transparent.
+    uint16_t opaque_colors;
 } layer_obj_t;
 
 uint16_t get_layer_pixel(layer_obj_t *layer, int16_t x, int16_t y);
+void layer_scan_tiles(layer_obj_t *layer);
+void layer_update_opaque_colors(layer_obj_t *layer);
+bool layer_get_area(layer_obj_t *layer, displayio_area_t *area);
+bool layer_take_dirty_area(layer_obj_t *layer, displayio_area_t *area);
 
 #endif  // MICROPY_INCLUDED_SHARED_MODULE__STAGE_LAYER
@@ -30,6 +30,31 @@
 #include "shared-bindings/_stage/Layer.h"
 #include "shared-bindings/_stage/Text.h"
 
+// Layers wholly outside the rendered fragment are left out up to this many
+// layers; with more, every layer is checked for every pixel.
+#ifndef STAGE_MAX_RENDER_LAYERS
+#define STAGE_MAX_RENDER_LAYERS (32)
+#endif
+
+// Whether a layer or text has any pixels inside the area.
+static bool stage_layer_overlaps(mp_obj_t layer_obj, const displayio_area_t *area) {
+    displayio_area_t layer_area;
+    if (mp_obj_is_type(layer_obj, &mp_type_layer)) {
+        layer_obj_t *layer = MP_OBJ_TO_PTR(layer_obj);
+        layer_update_opaque_colors(layer);
+        layer_get_area(layer, &layer_area);
+    } else if (mp_obj_is_type(layer_obj, &mp_type_text)) {
+        text_obj_t *text = MP_OBJ_TO_PTR(layer_obj);
+        layer_area.x1 = text->x;
+        layer_area.y1 = text->y;
+        layer_area.x2 = text->x + (text->width << 3);
+        layer_area.y2 = text->y + (text->height << 3);
+    } else {
+        return false;
+    }
+    displayio_area_t overlap;
+    return displayio_area_compute_overlap(&layer_area, area, &overlap);
+}
 
 void render_stage(
     uint16_t x0, uint16_t y0,
@@ -40,6 +65,27 @@ void render_stage(
     busdisplay_busdisplay_obj_t *display,
     uint8_t scale, uint16_t background) {
 
+    // Only look at the layers that can show up in this fragment.
+    mp_obj_t visible[STAGE_MAX_RENDER_LAYERS];
+    size_t visible_size = 0;
+    bool all_visible_fit = true;
+    displayio_area_t fragment = {
+        .x1 = x0 + vx, .y1 = y0 + vy, .x2 = x1 + vx, .y2 = y1 + vy, .next = NULL
+    };
+    for (size_t layer = 0; layer < layers_size; ++layer) {
+        if (!stage_layer_overlaps(layers[layer], &fragment)) {
+            continue;
+        }
+        if (visible_size == STAGE_MAX_RENDER_LAYERS) {
+            all_visible_fit = false;
+        } else {
+            visible[visible_size++] = layers[layer];
+        }
+    }
+    if (all_visible_fit) {
+        layers = visible;
+        layers_size = visible_size;
+    }
 
     displayio_area_t area;
     area.x1 = x0 * scale;
@@ -96,3 +142,45 @@ void render_stage(
 
     displayio_display_bus_end_transaction(&display->bus);
 }
+
+// Add an area to the list, merging it with the areas it overlaps enough that
+// drawing them together is cheaper than drawing them apart.
+static size_t stage_add_dirty_area(displayio_area_t *areas, size_t areas_size,
+    size_t max_areas, displayio_area_t *area) {
+    size_t i = 0;
+    while (i < areas_size) {
+        if (displayio_area_should_merge(&areas[i], area, 0)) {
+            displayio_area_union(&areas[i], area, area);
+            // The merged area may now overlap ones checked before.
+            areas[i] = areas[--areas_size];
+            i = 0;
+        } else {
+            ++i;
+        }
+    }
+    if (areas_size == max_areas) {
+        // Out of room, so grow the last one.
+        displayio_area_union(&areas[areas_size - 1], area, &areas[areas_size - 1]);
+        return areas_size;
+    }
+    areas[areas_size] = *area;
+    areas[areas_size].next = NULL;
+    return areas_size + 1;
+}
+
+// Collect the areas of the layers that moved or changed frame since the last
+// call, so that only those need to be rendered.
+size_t stage_dirty_areas(mp_obj_t *layers, size_t layers_size,
+    displayio_area_t *areas, size_t max_areas) {
+    size_t areas_size = 0;
+    for (size_t layer = 0; layer < layers_size; ++layer) {
+        if (!mp_obj_is_type(layers[layer], &mp_type_layer)) {
+            continue;
+        }
+        displayio_area_t area;
+        if (layer_take_dirty_area(MP_OBJ_TO_PTR(layers[layer]), &area)) {
+            areas_size = stage_add_dirty_area(areas, areas_size, max_areas, &area);
+        }
+    }
+    return areas_size;
+}
@@ -33,6 +33,9 @@
 
 #define TRANSPARENT (0x1ff8)
 
+// The most separate areas returned by stage_dirty_areas.
+#define STAGE_MAX_DIRTY_AREAS (8)
+
 void render_stage(
     uint16_t x0, uint16_t y0,
     uint16_t x1, uint16_t y1,
@@ -41,3 +44,5 @@ void render_stage(
     uint16_t *buffer, size_t buffer_size,
     busdisplay_busdisplay_obj_t *display,
     uint8_t scale, uint16_t background);
+size_t stage_dirty_areas(mp_obj_t *layers, size_t layers_size,
+    displayio_area_t *areas, size_t max_areas);
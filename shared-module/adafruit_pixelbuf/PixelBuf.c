@@ -29,6 +29,7 @@
 #include "py/objstr.h"
 #include "py/objtype.h"
 #include "py/runtime.h"
+#include "py/binary.h"
 #include "shared-bindings/adafruit_pixelbuf/PixelBuf.h"
 #include <string.h>
 #include <math.h>
@@ -253,9 +254,85 @@ STATIC void _pixelbuf_set_pixel(pixelbuf_pixelbuf_obj_t *self, size_t index, mp_
     common_hal_adafruit_pixelbuf_pixelbuf_set_pixel_color(self, index, r, g, b, w);
 }
 
+// Set count pixels from packed R, G, B[, W] bytes, one pixel's worth of bytes
+// per pixel, as if each was set from a tuple of them. Each value is looked up
+// in gamma first, when given, and the brightness is applied with a table
+// built once for all of them.
+static void pixelbuf_set_pixels_from_bytes(pixelbuf_pixelbuf_obj_t *self, size_t start, mp_int_t step, size_t count,
+    const uint8_t *data, const uint8_t *gamma) {
+    uint8_t unscaled_lut[256], scaled_lut[256];
+    for (int i = 0; i < 256; i++) {
+        unscaled_lut[i] = gamma ? gamma[i] : i;
+        scaled_lut[i] = (unscaled_lut[i] * self->scaled_brightness) / 256;
+    }
+
+    pixelbuf_rgbw_t *rgbw_order = &self->byteorder.byteorder;
+    uint8_t bpp = self->byteorder.bpp;
+    bool dotstar = self->byteorder.is_dotstar;
+    bool has_w = self->bytes_per_pixel == 4;
+    mp_int_t stride = step * self->bytes_per_pixel;
+    uint8_t *unscaled = self->post_brightness_buffer + start * self->bytes_per_pixel;
+    uint8_t *scaled = NULL;
+    if (self->pre_brightness_buffer) {
+        scaled = unscaled;
+        unscaled = self->pre_brightness_buffer + start * self->bytes_per_pixel;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        uint8_t r = data[PIXEL_R], g = data[PIXEL_G], b = data[PIXEL_B];
+        unscaled[rgbw_order->r] = unscaled_lut[r];
+        unscaled[rgbw_order->g] = unscaled_lut[g];
+        unscaled[rgbw_order->b] = unscaled_lut[b];
+        if (scaled) {
+            scaled[rgbw_order->r] = scaled_lut[r];
+            scaled[rgbw_order->g] = scaled_lut[g];
+            scaled[rgbw_order->b] = scaled_lut[b];
+        }
+        if (has_w) {
+            uint8_t w;
+            if (dotstar) {
+                // The brightness of each DotStar is set by the top five bits
+                // of its start byte, and not scaled.
+                w = DOTSTAR_LED_START | ((bpp == 4 ? data[PIXEL_W] : 255) >> 3);
+                unscaled[rgbw_order->w] = w;
+            } else {
+                w = data[PIXEL_W];
+                unscaled[rgbw_order->w] = unscaled_lut[w];
+                w = scaled_lut[w];
+            }
+            if (scaled) {
+                scaled[rgbw_order->w] = w;
+            }
+        }
+        data += bpp;
+        unscaled += stride;
+        if (scaled) {
+            scaled += stride;
+        }
+    }
+}
+
+void common_hal_adafruit_pixelbuf_pixelbuf_set_pixels_from_buffer(mp_obj_t self_in, size_t start, const uint8_t *data, size_t count, const uint8_t *gamma) {
+    pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    pixelbuf_set_pixels_from_bytes(self, start, 1, count, data, gamma);
+    if (self->auto_write) {
+        common_hal_adafruit_pixelbuf_pixelbuf_show(self_in);
+    }
+}
+
 void common_hal_adafruit_pixelbuf_pixelbuf_set_pixels(mp_obj_t self_in, size_t start, mp_int_t step, size_t slice_len, mp_obj_t *values,
     mp_obj_tuple_t *flatten_to) {
     pixelbuf_pixelbuf_obj_t *self = native_pixelbuf(self_in);
+    mp_buffer_info_t bufinfo;
+    if (flatten_to != mp_const_none && mp_get_buffer(values, &bufinfo, MP_BUFFER_READ) &&
+        mp_binary_get_size('@', bufinfo.typecode, NULL) == 1) {
+        // Bytes of every component of every pixel, so skip building tuples.
+        pixelbuf_set_pixels_from_bytes(self, start, step, slice_len, bufinfo.buf, NULL);
+        if (self->auto_write) {
+            common_hal_adafruit_pixelbuf_pixelbuf_show(self_in);
+        }
+        return;
+    }
     mp_obj_iter_buf_t iter_buf;
     mp_obj_t iterable = mp_getiter(values, &iter_buf);
     mp_obj_t item;
@@ -0,0 +1,120 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-module/audiobusio/__init__.h"
+
+// A windowed sinc filter for 44 khz, 64 samples. It is also good enough for lower
+// sample rates. Rather than testing every PDM bit, each 4-bit group of the input
+// window looks up the sum of the taps for its set bits, so each output sample
+// takes 16 table lookups instead of 64 branches. The tables are built at compile
+// time from these taps:
+//
+//     0, 2, 9, 21, 39, 63, 94, 132,
+//     179, 236, 302, 379, 467, 565, 674, 792,
+//     920, 1055, 1196, 1341, 1487, 1633, 1776, 1913,
+//     2042, 2159, 2263, 2352, 2422, 2474, 2506, 2516,
+//     2506, 2474, 2422, 2352, 2263, 2159, 2042, 1913,
+//     1776, 1633, 1487, 1341, 1196, 1055, 920, 792,
+//     674, 565, 467, 379, 302, 236, 179, 132,
+//     94, 63, 39, 21, 9, 2, 0, 0
+//
+// The taps sum to 65502 so the result always fits in 16 bits.
+
+// Sums of the taps a, b, c, d selected by each value of a nibble, where a goes
+// with bit 0.
+#define NIBBLE_SUMS(a, b, c, d) { \
+        0, a, b, a + b, c, a + c, b + c, a + b + c, \
+        d, a + d, b + d, a + b + d, c + d, a + c + d, b + c + d, a + b + c + d \
+}
+
+// Row n covers taps 4n to 4n + 3 with tap 4n in bit 0.
+static const uint16_t lsb_first_sums[AUDIOBUSIO_PDM_OVERSAMPLING / 4][16] = {
+    NIBBLE_SUMS(0, 2, 9, 21),
+    NIBBLE_SUMS(39, 63, 94, 132),
+    NIBBLE_SUMS(179, 236, 302, 379),
+    NIBBLE_SUMS(467, 565, 674, 792),
+    NIBBLE_SUMS(920, 1055, 1196, 1341),
+    NIBBLE_SUMS(1487, 1633, 1776, 1913),
+    NIBBLE_SUMS(2042, 2159, 2263, 2352),
+    NIBBLE_SUMS(2422, 2474, 2506, 2516),
+    NIBBLE_SUMS(2506, 2474, 2422, 2352),
+    NIBBLE_SUMS(2263, 2159, 2042, 1913),
+    NIBBLE_SUMS(1776, 1633, 1487, 1341),
+    NIBBLE_SUMS(1196, 1055, 920, 792),
+    NIBBLE_SUMS(674, 565, 467, 379),
+    NIBBLE_SUMS(302, 236, 179, 132),
+    NIBBLE_SUMS(94, 63, 39, 21),
+    NIBBLE_SUMS(9, 2, 0, 0),
+};
+
+// Row n covers taps 4n to 4n + 3 with tap 4n in bit 3.
+static const uint16_t msb_first_sums[AUDIOBUSIO_PDM_OVERSAMPLING / 4][16] = {
+    NIBBLE_SUMS(21, 9, 2, 0),
+    NIBBLE_SUMS(132, 94, 63, 39),
+    NIBBLE_SUMS(379, 302, 236, 179),
+    NIBBLE_SUMS(792, 674, 565, 467),
+    NIBBLE_SUMS(1341, 1196, 1055, 920),
+    NIBBLE_SUMS(1913, 1776, 1633, 1487),
+    NIBBLE_SUMS(2352, 2263, 2159, 2042),
+    NIBBLE_SUMS(2516, 2506, 2474, 2422),
+    NIBBLE_SUMS(2352, 2422, 2474, 2506),
+    NIBBLE_SUMS(1913, 2042, 2159, 2263),
+    NIBBLE_SUMS(1341, 1487, 1633, 1776),
+    NIBBLE_SUMS(792, 920, 1055, 1196),
+    NIBBLE_SUMS(379, 467, 565, 674),
+    NIBBLE_SUMS(132, 179, 236, 302),
+    NIBBLE_SUMS(21, 39, 63, 94),
+    NIBBLE_SUMS(0, 0, 2, 9),
+};
+
+uint16_t audiobusio_pdm_filter_lsb_first(const uint32_t pdm_words[2]) {
+    uint16_t running_sum = 0;
+    const uint16_t (*sums)[16] = lsb_first_sums;
+    for (uint8_t i = 0; i < 2; i++) {
+        uint32_t pdm_word = pdm_words[i];
+        for (uint8_t j = 0; j < 8; j++) {
+            running_sum += (*sums)[pdm_word & 0xf];
+            sums++;
+            pdm_word >>= 4;
+        }
+    }
+    return running_sum;
+}
+
+uint16_t audiobusio_pdm_filter_msb_first_halfwords(const uint32_t pdm_words[4]) {
+    uint16_t running_sum = 0;
+    const uint16_t (*sums)[16] = msb_first_sums;
+    for (uint8_t i = 0; i < 4; i++) {
+        // The other channel is in the upper halfword. Ignore it.
+        uint32_t pdm_word = pdm_words[i];
+        for (uint8_t j = 0; j < 4; j++) {
+            running_sum += (*sums)[(pdm_word >> 12) & 0xf];
+            sums++;
+            pdm_word <<= 4;
+        }
+    }
+    return running_sum;
+}
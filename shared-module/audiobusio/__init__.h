@@ -0,0 +1,43 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_AUDIOBUSIO__INIT__H
+#define MICROPY_INCLUDED_SHARED_MODULE_AUDIOBUSIO__INIT__H
+
+#include <stdint.h>
+
+// The windowed sinc filter used to decimate 64x oversampled PDM data to PCM.
+#define AUDIOBUSIO_PDM_OVERSAMPLING 64
+
+// Filters one 64-bit window of PDM data down to one unsigned 16-bit sample. The
+// oldest bit is the least significant bit of pdm_words[0].
+uint16_t audiobusio_pdm_filter_lsb_first(const uint32_t pdm_words[2]);
+
+// Same as audiobusio_pdm_filter_lsb_first but the data is in the low halfword of
+// each of four words with the oldest bit the most significant bit of pdm_words[0].
+uint16_t audiobusio_pdm_filter_msb_first_halfwords(const uint32_t pdm_words[4]);
+
+#endif  // MICROPY_INCLUDED_SHARED_MODULE_AUDIOBUSIO__INIT__H
@@ -0,0 +1,360 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audiocore/Resampler.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-module/audiocore/Resampler.h"
+
+// Four tap Lanczos (a = 2) kernel in 32 phases, scaled so each phase sums to
+// 1 << 14. Tap k of phase p weighs the source frame k - 1 frames from the one
+// being interpolated from, at p / 32 of the way to the next frame.
+STATIC const int16_t resampler_phases[32][AUDIOCORE_RESAMPLER_MAX_TAPS] = {
+    {0, 16384, 0, 0}, {-306, 16348, 346, -4},
+    {-570, 16238, 733, -17}, {-795, 16059, 1159, -39},
+    {-981, 15813, 1622, -70}, {-1130, 15503, 2122, -111},
+    {-1244, 15133, 2657, -162}, {-1324, 14707, 3223, -222},
+    {-1374, 14231, 3817, -290}, {-1397, 13710, 4438, -367},
+    {-1394, 13147, 5082, -451}, {-1370, 12550, 5745, -541},
+    {-1327, 11922, 6424, -635}, {-1268, 11270, 7114, -732},
+    {-1196, 10599, 7812, -831}, {-1114, 9912, 8515, -929},
+    {-1024, 9216, 9216, -1024}, {-929, 8515, 9912, -1114},
+    {-831, 7812, 10599, -1196}, {-732, 7114, 11270, -1268},
+    {-635, 6423, 11923, -1327}, {-541, 5745, 12550, -1370},
+    {-451, 5082, 13147, -1394}, {-367, 4439, 13709, -1397},
+    {-290, 3817, 14231, -1374}, {-222, 3223, 14707, -1324},
+    {-162, 2657, 15133, -1244}, {-111, 2122, 15503, -1130},
+    {-70, 1622, 15813, -981}, {-39, 1158, 16060, -795},
+    {-17, 732, 16239, -570}, {-4, 347, 16347, -306},
+};
+
+#define STAGED_CAPACITY (AUDIOCORE_RESAMPLER_MAX_TAPS - 1 + AUDIOCORE_RESAMPLER_CHUNK_FRAMES)
+
+void common_hal_audioio_resampler_construct(audioio_resampler_obj_t *self,
+    mp_obj_t sample,
+    uint32_t buffer_size,
+    uint8_t bits_per_sample,
+    bool samples_signed,
+    uint8_t channel_count,
+    uint32_t sample_rate,
+    bool polyphase) {
+    uint8_t source_channel_count = audiosample_channel_count(sample);
+    mp_arg_validate_int_range(source_channel_count, 1, 2, MP_QSTR_channel_count);
+    uint8_t source_bits_per_sample = audiosample_bits_per_sample(sample);
+    if (source_bits_per_sample != 8 && source_bits_per_sample != 16) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bits_per_sample must be 8 or 16"));
+    }
+    bool single_buffer;
+    uint32_t max_buffer_length;
+    uint8_t spacing;
+    audiosample_get_buffer_structure(sample, false, &single_buffer, &self->source_signed,
+        &max_buffer_length, &spacing);
+
+    // Keep whole frames in a multiple of four bytes so that the output can be
+    // mixed a word at a time.
+    uint32_t frame_size = bits_per_sample / 8 * channel_count;
+    uint32_t frames = (buffer_size & ~3) / frame_size;
+    if (frames == 0) {
+        frames = 4 / frame_size;
+    }
+    self->len = frames * frame_size;
+    // Frames are interpolated as signed 16 bit with the source's channels and
+    // converted in place, so the buffers need room for the wider of the two.
+    size_t buffer_bytes = frames * MAX(channel_count, source_channel_count) * sizeof(int16_t);
+    self->first_buffer = m_malloc(buffer_bytes);
+    self->second_buffer = m_malloc(buffer_bytes);
+
+    self->sample = sample;
+    self->sample_rate = sample_rate;
+    self->bits_per_sample = bits_per_sample;
+    self->samples_signed = samples_signed;
+    self->channel_count = channel_count;
+    self->polyphase = polyphase;
+    self->source_bits_per_sample = source_bits_per_sample;
+    self->source_channel_count = source_channel_count;
+    self->use_first_buffer = true;
+    audioio_resampler_reset_buffer(self, false, 0);
+}
+
+void common_hal_audioio_resampler_deinit(audioio_resampler_obj_t *self) {
+    self->first_buffer = NULL;
+    self->second_buffer = NULL;
+    self->sample = MP_OBJ_NULL;
+}
+
+bool common_hal_audioio_resampler_deinited(audioio_resampler_obj_t *self) {
+    return self->first_buffer == NULL;
+}
+
+uint32_t common_hal_audioio_resampler_get_sample_rate(audioio_resampler_obj_t *self) {
+    return self->sample_rate;
+}
+
+uint8_t common_hal_audioio_resampler_get_bits_per_sample(audioio_resampler_obj_t *self) {
+    return self->bits_per_sample;
+}
+
+uint8_t common_hal_audioio_resampler_get_channel_count(audioio_resampler_obj_t *self) {
+    return self->channel_count;
+}
+
+mp_obj_t common_hal_audioio_resampler_get_sample(audioio_resampler_obj_t *self) {
+    return self->sample;
+}
+
+STATIC uint8_t resampler_taps(audioio_resampler_obj_t *self) {
+    return self->polyphase ? AUDIOCORE_RESAMPLER_MAX_TAPS : 2;
+}
+
+void audioio_resampler_reset_buffer(audioio_resampler_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+    if (single_channel_output && channel == 1) {
+        return;
+    }
+    audiosample_reset_buffer(self->sample, false, 0);
+    // Read the rate now because a RawSample's can change between plays.
+    uint32_t step = ((uint64_t)audiosample_sample_rate(self->sample) << 16) / self->sample_rate;
+    self->step = MAX(step, 1u);
+    self->position = 0;
+    // Pad the start with silence so the first output frame lands on the first
+    // source frame.
+    self->staged_frames = resampler_taps(self) / 2 - 1;
+    memset(self->staged, 0, sizeof(self->staged));
+    self->source_buffer = NULL;
+    self->source_remaining = 0;
+    self->source_done = false;
+    self->flushed = false;
+    self->done = false;
+    self->buffer_length = 0;
+    self->read_count = 0;
+    self->left_read_count = 0;
+    self->right_read_count = 0;
+}
+
+STATIC bool resampler_next_source_buffer(audioio_resampler_obj_t *self) {
+    while (self->source_remaining == 0) {
+        if (self->source_done) {
+            return false;
+        }
+        uint8_t *buffer;
+        uint32_t buffer_length;
+        audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, &buffer, &buffer_length);
+        if (result == GET_BUFFER_ERROR) {
+            buffer_length = 0;
+        }
+        self->source_done = result != GET_BUFFER_MORE_DATA;
+        self->source_buffer = buffer;
+        self->source_remaining = buffer_length / (self->source_bits_per_sample / 8 * self->source_channel_count);
+    }
+    return true;
+}
+
+// Drop the staged frames that have been interpolated past and convert more from
+// the source. Returns false once the source is used up.
+STATIC bool resampler_refill(audioio_resampler_obj_t *self) {
+    uint8_t channels = self->source_channel_count;
+    uint32_t consumed = self->position >> 16;
+    self->position &= 0xffff;
+    if (consumed < self->staged_frames) {
+        memmove(self->staged, self->staged + consumed * channels,
+            (self->staged_frames - consumed) * channels * sizeof(int16_t));
+        self->staged_frames -= consumed;
+        consumed = 0;
+    } else {
+        consumed -= self->staged_frames;
+        self->staged_frames = 0;
+    }
+    uint32_t source_frame_size = self->source_bits_per_sample / 8 * channels;
+    // Skip source frames that are stepped over entirely when downsampling a lot.
+    while (consumed > 0 && resampler_next_source_buffer(self)) {
+        uint32_t n = MIN(consumed, self->source_remaining);
+        self->source_buffer += n * source_frame_size;
+        self->source_remaining -= n;
+        consumed -= n;
+    }
+    if (!resampler_next_source_buffer(self)) {
+        if (self->flushed) {
+            return false;
+        }
+        uint32_t n = resampler_taps(self) / 2;
+        memset(self->staged + self->staged_frames * channels, 0, n * channels * sizeof(int16_t));
+        self->staged_frames += n;
+        self->flushed = true;
+        return true;
+    }
+    uint32_t n = MIN(self->source_remaining, (uint32_t)(STAGED_CAPACITY - self->staged_frames));
+    audiosample_convert_to_s16(self->staged + self->staged_frames * channels, self->source_buffer,
+        n * channels, self->source_bits_per_sample, self->source_signed);
+    self->source_buffer += n * source_frame_size;
+    self->source_remaining -= n;
+    self->staged_frames += n;
+    return true;
+}
+
+STATIC void resampler_linear(audioio_resampler_obj_t *self, int16_t *out, uint32_t n) {
+    uint8_t channels = self->source_channel_count;
+    uint32_t position = self->position;
+    for (; n--; position += self->step) {
+        const int16_t *frame = self->staged + (position >> 16) * channels;
+        // 15 bits of the fraction keep the product within 32 bits.
+        int32_t fraction = (position & 0xffff) >> 1;
+        for (uint8_t c = 0; c < channels; c++) {
+            int32_t a = frame[c];
+            *out++ = a + (((frame[c + channels] - a) * fraction) >> 15);
+        }
+    }
+    self->position = position;
+}
+
+STATIC void resampler_polyphase(audioio_resampler_obj_t *self, int16_t *out, uint32_t n) {
+    uint8_t channels = self->source_channel_count;
+    uint32_t position = self->position;
+    for (; n--; position += self->step) {
+        const int16_t *frame = self->staged + (position >> 16) * channels;
+        const int16_t *phase = resampler_phases[(position >> 11) & 31];
+        for (uint8_t c = 0; c < channels; c++) {
+            int32_t sum = phase[0] * frame[c] +
+                phase[1] * frame[c + channels] +
+                phase[2] * frame[c + 2 * channels] +
+                phase[3] * frame[c + 3 * channels];
+            *out++ = MIN(MAX(sum >> 14, INT16_MIN), INT16_MAX);
+        }
+    }
+    self->position = position;
+}
+
+// The first position that doesn't have all of its taps staged.
+STATIC uint32_t resampler_limit(audioio_resampler_obj_t *self) {
+    uint8_t taps = resampler_taps(self);
+    if (self->staged_frames < taps) {
+        return 0;
+    }
+    return (uint32_t)(self->staged_frames - taps + 1) << 16;
+}
+
+STATIC bool resampler_exhausted(audioio_resampler_obj_t *self) {
+    return self->flushed && self->position >= resampler_limit(self);
+}
+
+// Interpolate up to frames output frames into out with the source's channels.
+// Returns how many were made, fewer at the end of the source.
+STATIC uint32_t resampler_fill(audioio_resampler_obj_t *self, int16_t *out, uint32_t frames) {
+    uint32_t done = 0;
+    while (done < frames) {
+        uint32_t limit = resampler_limit(self);
+        if (self->position >= limit) {
+            if (!resampler_refill(self)) {
+                break;
+            }
+            continue;
+        }
+        uint32_t n = MIN((limit - self->position + self->step - 1) / self->step, frames - done);
+        if (self->polyphase) {
+            resampler_polyphase(self, out + done * self->source_channel_count, n);
+        } else {
+            resampler_linear(self, out + done * self->source_channel_count, n);
+        }
+        done += n;
+    }
+    return done;
+}
+
+// Convert frames of signed 16 bit samples with the source's channels to the
+// output format, in place.
+STATIC void resampler_convert_output(audioio_resampler_obj_t *self, int16_t *buffer, uint32_t frames) {
+    if (self->source_channel_count == 1 && self->channel_count == 2) {
+        // Work backwards so nothing is overwritten before it is read.
+        for (uint32_t i = frames; i--;) {
+            buffer[2 * i] = buffer[2 * i + 1] = buffer[i];
+        }
+    } else if (self->source_channel_count == 2 && self->channel_count == 1) {
+        for (uint32_t i = 0; i < frames; i++) {
+            buffer[i] = (buffer[2 * i] + buffer[2 * i + 1]) >> 1;
+        }
+    }
+    audiosample_convert_from_s16(buffer, frames * self->channel_count, self->bits_per_sample, self->samples_signed);
+}
+
+audioio_get_buffer_result_t audioio_resampler_get_buffer(audioio_resampler_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length) {
+    if (!single_channel_output) {
+        channel = 0;
+    }
+
+    uint32_t channel_read_count = self->left_read_count;
+    if (channel == 1) {
+        channel_read_count = self->right_read_count;
+    }
+
+    if (self->read_count == channel_read_count) {
+        int16_t *out = self->use_first_buffer ? self->first_buffer : self->second_buffer;
+        self->use_first_buffer = !self->use_first_buffer;
+        uint32_t frame_size = self->bits_per_sample / 8 * self->channel_count;
+        uint32_t frames = self->len / frame_size;
+        uint32_t filled = resampler_fill(self, out, frames);
+        if (filled < frames) {
+            // Pad the last buffer with silence to word align it.
+            uint32_t aligned = ((filled * frame_size + 3) & ~3) / frame_size;
+            memset(out + filled * self->source_channel_count, 0,
+                (aligned - filled) * self->source_channel_count * sizeof(int16_t));
+            filled = aligned;
+        }
+        resampler_convert_output(self, out, filled);
+        self->buffer_length = filled * frame_size;
+        self->done = filled < frames || resampler_exhausted(self);
+        self->read_count += 1;
+    }
+
+    *buffer = (uint8_t *)(self->use_first_buffer ? self->second_buffer : self->first_buffer);
+    *buffer_length = self->buffer_length;
+    if (channel == 0) {
+        self->left_read_count += 1;
+    } else if (channel == 1) {
+        self->right_read_count += 1;
+        *buffer = *buffer + self->bits_per_sample / 8;
+    }
+    return self->done ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+}
+
+void audioio_resampler_get_buffer_structure(audioio_resampler_obj_t *self, bool single_channel_output,
+    bool *single_buffer, bool *samples_signed,
+    uint32_t *max_buffer_length, uint8_t *spacing) {
+    *single_buffer = false;
+    *samples_signed = self->samples_signed;
+    *max_buffer_length = self->len;
+    if (single_channel_output) {
+        *spacing = self->channel_count;
+    } else {
+        *spacing = 1;
+    }
+}
@@ -0,0 +1,95 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_AUDIOCORE_RESAMPLER_H
+#define MICROPY_INCLUDED_SHARED_MODULE_AUDIOCORE_RESAMPLER_H
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+// Source frames converted at a time, not counting the interpolation history.
+#define AUDIOCORE_RESAMPLER_CHUNK_FRAMES (128)
+// Taps used by the polyphase filter. Linear interpolation uses two.
+#define AUDIOCORE_RESAMPLER_MAX_TAPS (4)
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t sample;
+    int16_t *first_buffer;
+    int16_t *second_buffer;
+    uint32_t len; // in bytes
+    uint32_t sample_rate;
+    uint8_t bits_per_sample;
+    bool samples_signed;
+    uint8_t channel_count;
+    bool use_first_buffer;
+    bool polyphase;
+
+    // The last buffer made, which is handed to the second channel too.
+    uint32_t buffer_length;
+    bool done;
+
+    uint32_t read_count;
+    uint32_t left_read_count;
+    uint32_t right_read_count;
+
+    uint8_t source_bits_per_sample;
+    bool source_signed;
+    uint8_t source_channel_count;
+    bool source_done;
+    // Silence has been staged after the end of the source so its last frames
+    // can be interpolated.
+    bool flushed;
+    // The rest of the source buffer that hasn't been converted yet.
+    const uint8_t *source_buffer;
+    uint32_t source_remaining; // in frames
+
+    // Source position of the first tap in frames, 16.16 fixed point, and the
+    // source frames advanced per output frame.
+    uint32_t position;
+    uint32_t step;
+    // Converted source frames as signed 16 bit, with the source's channels
+    // interleaved.
+    uint16_t staged_frames;
+    int16_t staged[(AUDIOCORE_RESAMPLER_MAX_TAPS - 1 + AUDIOCORE_RESAMPLER_CHUNK_FRAMES) * 2];
+} audioio_resampler_obj_t;
+
+
+// These are not available from Python because it may be called in an interrupt.
+void audioio_resampler_reset_buffer(audioio_resampler_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel);
+audioio_get_buffer_result_t audioio_resampler_get_buffer(audioio_resampler_obj_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length);                                                      // length in bytes
+void audioio_resampler_get_buffer_structure(audioio_resampler_obj_t *self, bool single_channel_output,
+    bool *single_buffer, bool *samples_signed,
+    uint32_t *max_buffer_length, uint8_t *spacing);
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_AUDIOCORE_RESAMPLER_H
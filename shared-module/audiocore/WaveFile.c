@@ -50,6 +50,7 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     size_t buffer_size) {
     // Load the wave
     self->file = file;
+    vfs_fat_file_drop_buffer(file);
     uint8_t chunk_header[16];
     f_rewind(&self->file->fp);
     UINT bytes_read;
@@ -109,31 +110,27 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t *self,
     self->file_length = data_length;
     self->data_start = self->file->fp.fptr;
 
-    // Try to allocate two buffers, one will be loaded from file and the other
-    // DMAed to DAC.
+    // Split the buffer into buffers of at most one sector. One is being played
+    // while the others are read ahead from the file.
     if (buffer_size) {
-        self->len = buffer_size / 2;
+        self->len = MIN(buffer_size / 2, 512) & ~3;
+        self->buffer_count = MIN(buffer_size / self->len, AUDIOIO_WAVEFILE_MAX_BUFFERS);
         self->buffer = buffer;
-        self->second_buffer = buffer + self->len;
     } else {
-        self->len = 256;
-        self->buffer = m_malloc(self->len);
+        self->len = CIRCUITPY_AUDIOCORE_WAVEFILE_BUFFER_SIZE;
+        self->buffer_count = CIRCUITPY_AUDIOCORE_WAVEFILE_BUFFER_COUNT;
+        self->buffer = m_malloc(self->len * self->buffer_count);
         if (self->buffer == NULL) {
             common_hal_audioio_wavefile_deinit(self);
-            m_malloc_fail(self->len);
-        }
-
-        self->second_buffer = m_malloc(self->len);
-        if (self->second_buffer == NULL) {
-            common_hal_audioio_wavefile_deinit(self);
-            m_malloc_fail(self->len);
+            m_malloc_fail(self->len * self->buffer_count);
         }
     }
+    self->first_buffer = 0;
+    self->underruns = 0;
 }
 
 void common_hal_audioio_wavefile_deinit(audioio_wavefile_obj_t *self) {
     self->buffer = NULL;
-    self->second_buffer = NULL;
 }
 
 bool common_hal_audioio_wavefile_deinited(audioio_wavefile_obj_t *self) {
@@ -157,19 +154,96 @@ uint8_t common_hal_audioio_wavefile_get_channel_count(audioio_wavefile_obj_t *se
     return self->channel_count;
 }
 
+uint32_t common_hal_audioio_wavefile_get_underruns(audioio_wavefile_obj_t *self) {
+    return self->underruns;
+}
+
+STATIC uint8_t wavefile_slot(audioio_wavefile_obj_t *self, uint32_t buffer_number) {
+    return (self->first_buffer + buffer_number) % self->buffer_count;
+}
+
+// Read the next buffer from the file.
+STATIC bool wavefile_load_buffer(audioio_wavefile_obj_t *self) {
+    uint8_t slot = wavefile_slot(self, self->fill_count);
+    uint8_t *buffer = self->buffer + slot * self->len;
+    uint32_t num_bytes_to_load = self->len;
+    if (self->len % 512 == 0) {
+        // Stop at a sector boundary so that the following reads are whole sectors
+        // that FatFs reads directly into the buffer.
+        num_bytes_to_load = (self->len - self->file->fp.fptr % 512) & ~3;
+    }
+    if (num_bytes_to_load > self->bytes_remaining) {
+        num_bytes_to_load = self->bytes_remaining;
+    }
+    UINT length_read;
+    if (f_read(&self->file->fp, buffer, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
+        return false;
+    }
+    self->bytes_remaining -= length_read;
+    // Pad the last buffer to word align it.
+    if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
+        uint32_t pad = length_read % sizeof(uint32_t);
+        length_read += pad;
+        if (self->bits_per_sample == 8) {
+            for (uint32_t i = 0; i < pad; i++) {
+                buffer[length_read / sizeof(uint8_t) - i - 1] = 0x80;
+            }
+        } else if (self->bits_per_sample == 16) {
+            // We know the buffer is aligned because each one is a multiple of four bytes.
+            #pragma GCC diagnostic push
+            #pragma GCC diagnostic ignored "-Wcast-align"
+            ((int16_t *)buffer)[length_read / sizeof(int16_t) - 1] = 0;
+            #pragma GCC diagnostic pop
+        }
+    }
+    self->buffer_lengths[slot] = length_read;
+    self->fill_count += 1;
+    return true;
+}
+
+#if CIRCUITPY_AUDIOCORE_WAVEFILE_READ_AHEAD
+STATIC void wavefile_fill_cb(void *self_in) {
+    audioio_wavefile_obj_t *self = self_in;
+    if (common_hal_audioio_wavefile_deinited(self)) {
+        return;
+    }
+    // The last buffer handed out to each channel may still be playing. Fill the
+    // rest.
+    uint32_t consumed = self->left_read_count;
+    if (self->right_read_count > 0 && self->right_read_count < consumed) {
+        consumed = self->right_read_count;
+    }
+    while (self->bytes_remaining > 0 && self->fill_count < consumed + self->buffer_count - 1) {
+        if (!wavefile_load_buffer(self)) {
+            // get_buffer will try again and report the error.
+            return;
+        }
+    }
+}
+#endif
+
 void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t *self,
     bool single_channel_output,
     uint8_t channel) {
     if (single_channel_output && channel == 1) {
         return;
     }
-    // We don't reset the buffer index in case we're looping and we have an odd number of buffer
-    // loads
+    #if CIRCUITPY_AUDIOCORE_WAVEFILE_READ_AHEAD
+    background_callback_begin_critical_section();
+    #endif
+    // We don't restart at the first buffer in case we're looping and the last
+    // buffer is still being played.
+    self->first_buffer = wavefile_slot(self, self->read_count);
     self->bytes_remaining = self->file_length;
     f_lseek(&self->file->fp, self->data_start);
     self->read_count = 0;
+    self->fill_count = 0;
     self->left_read_count = 0;
     self->right_read_count = 0;
+    #if CIRCUITPY_AUDIOCORE_WAVEFILE_READ_AHEAD
+    background_callback_end_critical_section();
+    background_callback_add(&self->fill_cb, wavefile_fill_cb, self);
+    #endif
 }
 
 audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *self,
@@ -186,63 +260,33 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *
         channel_read_count = self->right_read_count;
     }
 
-    bool need_more_data = self->read_count == channel_read_count;
-
-    if (self->bytes_remaining == 0 && need_more_data) {
-        *buffer = NULL;
-        *buffer_length = 0;
-        return GET_BUFFER_DONE;
-    }
-
-    if (need_more_data) {
-        uint32_t num_bytes_to_load = self->len;
-        if (num_bytes_to_load > self->bytes_remaining) {
-            num_bytes_to_load = self->bytes_remaining;
-        }
-        UINT length_read;
-        if (self->buffer_index % 2 == 1) {
-            *buffer = self->second_buffer;
-        } else {
-            *buffer = self->buffer;
-        }
-        if (f_read(&self->file->fp, *buffer, num_bytes_to_load, &length_read) != FR_OK || length_read != num_bytes_to_load) {
-            return GET_BUFFER_ERROR;
-        }
-        self->bytes_remaining -= length_read;
-        // Pad the last buffer to word align it.
-        if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
-            uint32_t pad = length_read % sizeof(uint32_t);
-            length_read += pad;
-            if (self->bits_per_sample == 8) {
-                for (uint32_t i = 0; i < pad; i++) {
-                    ((uint8_t *)(*buffer))[length_read / sizeof(uint8_t) - i - 1] = 0x80;
-                }
-            } else if (self->bits_per_sample == 16) {
-                // We know the buffer is aligned because we allocated it onto the heap ourselves.
-                #pragma GCC diagnostic push
-                #pragma GCC diagnostic ignored "-Wcast-align"
-                ((int16_t *)(*buffer))[length_read / sizeof(int16_t) - 1] = 0;
-                #pragma GCC diagnostic pop
+    if (channel_read_count == self->read_count) {
+        // This channel needs the next buffer.
+        if (self->fill_count == self->read_count) {
+            if (self->bytes_remaining == 0) {
+                *buffer = NULL;
+                *buffer_length = 0;
+                return GET_BUFFER_DONE;
+            }
+            // Reading ahead didn't keep up so read it now.
+            #if CIRCUITPY_AUDIOCORE_WAVEFILE_READ_AHEAD
+            if (self->read_count > 0) {
+                self->underruns++;
+            }
+            #endif
+            if (!wavefile_load_buffer(self)) {
+                return GET_BUFFER_ERROR;
             }
         }
-        *buffer_length = length_read;
-        if (self->buffer_index % 2 == 1) {
-            self->second_buffer_length = length_read;
-        } else {
-            self->buffer_length = length_read;
-        }
-        self->buffer_index += 1;
         self->read_count += 1;
+        #if CIRCUITPY_AUDIOCORE_WAVEFILE_READ_AHEAD
+        background_callback_add(&self->fill_cb, wavefile_fill_cb, self);
+        #endif
     }
 
-    uint32_t buffers_back = self->read_count - 1 - channel_read_count;
-    if ((self->buffer_index - buffers_back) % 2 == 0) {
-        *buffer = self->second_buffer;
-        *buffer_length = self->second_buffer_length;
-    } else {
-        *buffer = self->buffer;
-        *buffer_length = self->buffer_length;
-    }
+    uint8_t slot = wavefile_slot(self, channel_read_count);
+    *buffer = self->buffer + slot * self->len;
+    *buffer_length = self->buffer_lengths[slot];
 
     if (channel == 0) {
         self->left_read_count += 1;
@@ -251,7 +295,8 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t *
         *buffer = *buffer + self->bits_per_sample / 8;
     }
 
-    return self->bytes_remaining == 0 ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+    bool last_buffer = self->bytes_remaining == 0 && channel_read_count + 1 == self->fill_count;
+    return last_buffer ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
 }
 
 void audioio_wavefile_get_buffer_structure(audioio_wavefile_obj_t *self, bool single_channel_output,
@@ -31,18 +31,22 @@
 #include "py/obj.h"
 
 #include "shared-module/audiocore/__init__.h"
+#if CIRCUITPY_AUDIOCORE_WAVEFILE_READ_AHEAD
+#include "supervisor/background_callback.h"
+#endif
+
+#define AUDIOIO_WAVEFILE_MAX_BUFFERS (8)
 
 typedef struct {
     mp_obj_base_t base;
-    uint8_t *buffer;
-    uint32_t buffer_length;
-    uint8_t *second_buffer;
-    uint32_t second_buffer_length;
+    uint8_t *buffer; // buffer_count buffers of len bytes each
+    uint16_t buffer_lengths[AUDIOIO_WAVEFILE_MAX_BUFFERS];
+    uint8_t buffer_count;
+    uint8_t first_buffer; // Where buffer 0 of this pass through the file is
     uint32_t file_length; // In bytes
     uint16_t data_start; // Where the data values start
     uint8_t bits_per_sample;
-    uint16_t buffer_index;
-    uint32_t bytes_remaining;
+    uint32_t bytes_remaining; // Not read from the file yet
 
     uint8_t channel_count;
     uint32_t sample_rate;
@@ -50,9 +54,14 @@ typedef struct {
     uint32_t len;
     pyb_file_obj_t *file;
 
-    uint32_t read_count;
+    uint32_t read_count; // Buffers handed out
+    uint32_t fill_count; // Buffers read from the file
     uint32_t left_read_count;
     uint32_t right_read_count;
+    uint32_t underruns;
+    #if CIRCUITPY_AUDIOCORE_WAVEFILE_READ_AHEAD
+    background_callback_t fill_cb;
+    #endif
 } audioio_wavefile_obj_t;
 
 // These are not available from Python because it may be called in an interrupt.
@@ -24,6 +24,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "shared-module/audioio/__init__.h"
 
 #include "py/obj.h"
@@ -130,3 +132,42 @@ void audiosample_convert_s16m_s16s(int16_t *buffer_out, const int16_t *buffer_in
         *buffer_out++ = sample;
     }
 }
+
+void audiosample_convert_to_s16(int16_t *buffer_out, const uint8_t *buffer_in, size_t count, uint8_t bits_per_sample, bool samples_signed) {
+    if (bits_per_sample == 16) {
+        // Sample buffers are always 16 bit aligned.
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wcast-align"
+        const int16_t *in = (const int16_t *)buffer_in;
+        #pragma GCC diagnostic pop
+        if (samples_signed) {
+            memcpy(buffer_out, in, count * sizeof(int16_t));
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                buffer_out[i] = in[i] ^ 0x8000;
+            }
+        }
+    } else {
+        uint8_t sign_flip = samples_signed ? 0 : 0x80;
+        for (size_t i = 0; i < count; i++) {
+            buffer_out[i] = (int8_t)(buffer_in[i] ^ sign_flip) << 8;
+        }
+    }
+}
+
+void audiosample_convert_from_s16(int16_t *buffer, size_t count, uint8_t bits_per_sample, bool samples_signed) {
+    if (bits_per_sample == 16) {
+        if (!samples_signed) {
+            for (size_t i = 0; i < count; i++) {
+                buffer[i] ^= 0x8000;
+            }
+        }
+    } else {
+        // Each byte is written at or before the sample it comes from.
+        uint8_t *bytes = (uint8_t *)buffer;
+        uint8_t sign_flip = samples_signed ? 0 : 0x80;
+        for (size_t i = 0; i < count; i++) {
+            bytes[i] = (buffer[i] >> 8) ^ sign_flip;
+        }
+    }
+}
@@ -82,4 +82,8 @@ void audiosample_convert_u16m_s16s(int16_t *buffer_out, const uint16_t *buffer_i
 void audiosample_convert_u16s_s16s(int16_t *buffer_out, const uint16_t *buffer_in, size_t nframes);
 void audiosample_convert_s16m_s16s(int16_t *buffer_out, const int16_t *buffer_in, size_t nframes);
 
+// Convert count samples of the given format to signed 16 bit, and back in place.
+void audiosample_convert_to_s16(int16_t *buffer_out, const uint8_t *buffer_in, size_t count, uint8_t bits_per_sample, bool samples_signed);
+void audiosample_convert_from_s16(int16_t *buffer, size_t count, uint8_t bits_per_sample, bool samples_signed);
+
 #endif  // MICROPY_INCLUDED_SHARED_MODULE_AUDIOCORE__INIT__H
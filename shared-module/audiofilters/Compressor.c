@@ -0,0 +1,145 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "shared-bindings/audiofilters/Compressor.h"
+
+STATIC void compressor_process(audiofilters_effect_t *effect, int16_t *buffer, uint32_t frames) {
+    audiofilters_compressor_obj_t *self = (audiofilters_compressor_obj_t *)effect;
+    uint8_t channels = effect->channel_count;
+    while (frames > 0) {
+        uint32_t n = MIN(frames, AUDIOFILTERS_COMPRESSOR_BLOCK_FRAMES);
+        uint32_t count = n * channels;
+
+        // Follow the block's peak level.
+        int32_t peak = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            peak = MAX(peak, abs(buffer[i]));
+        }
+        int32_t envelope = self->envelope;
+        int32_t coefficient = peak > envelope ? self->attack_coefficient : self->release_coefficient;
+        envelope += ((peak - envelope) * coefficient) >> 15;
+        self->envelope = envelope;
+
+        // Reduce the level above the threshold by the ratio.
+        int32_t target = 1 << 15;
+        int32_t threshold = self->threshold_scaled;
+        if (envelope > threshold) {
+            int32_t level = threshold + (((envelope - threshold) * self->slope) >> 15);
+            target = (level << 15) / envelope;
+        }
+
+        // Ramp to the new gain over the block so that it doesn't click.
+        int32_t gain = self->gain;
+        int32_t step = (target - gain) / (int32_t)n;
+        for (uint32_t i = 0; i < count; i += channels) {
+            gain += step;
+            for (uint8_t c = 0; c < channels; c++) {
+                buffer[i + c] = (buffer[i + c] * gain) >> 15;
+            }
+        }
+        self->gain = target;
+
+        buffer += count;
+        frames -= n;
+    }
+}
+
+// The fraction of the way to a new level that the envelope moves each block.
+STATIC int32_t compressor_coefficient(audiofilters_compressor_obj_t *self, mp_float_t time) {
+    if (time <= 0) {
+        return 1 << 15;
+    }
+    mp_float_t block_time = (mp_float_t)AUDIOFILTERS_COMPRESSOR_BLOCK_FRAMES / self->effect.sample_rate;
+    return (int32_t)((1 - MICROPY_FLOAT_C_FUN(exp)(-block_time / time)) * (1 << 15));
+}
+
+STATIC void compressor_update(audiofilters_compressor_obj_t *self) {
+    self->threshold_scaled = (int32_t)(self->threshold * (1 << 15));
+    self->slope = (int32_t)((1 << 15) / self->ratio);
+    self->attack_coefficient = compressor_coefficient(self, self->attack_time);
+    self->release_coefficient = compressor_coefficient(self, self->release_time);
+}
+
+STATIC void compressor_reset(audiofilters_effect_t *effect) {
+    audiofilters_compressor_obj_t *self = (audiofilters_compressor_obj_t *)effect;
+    // The sample rate may have changed.
+    compressor_update(self);
+    self->envelope = 0;
+    self->gain = 1 << 15;
+}
+
+void common_hal_audiofilters_compressor_construct(audiofilters_compressor_obj_t *self, mp_obj_t sample,
+    uint32_t buffer_size, mp_float_t threshold, mp_float_t ratio, mp_float_t attack_time, mp_float_t release_time) {
+    audiofilters_effect_construct(&self->effect, sample, buffer_size, compressor_process, compressor_reset);
+    self->threshold = threshold;
+    self->ratio = ratio;
+    self->attack_time = attack_time;
+    self->release_time = release_time;
+    compressor_reset(&self->effect);
+}
+
+mp_float_t common_hal_audiofilters_compressor_get_threshold(audiofilters_compressor_obj_t *self) {
+    return self->threshold;
+}
+
+void common_hal_audiofilters_compressor_set_threshold(audiofilters_compressor_obj_t *self, mp_float_t threshold) {
+    self->threshold = threshold;
+    compressor_update(self);
+}
+
+mp_float_t common_hal_audiofilters_compressor_get_ratio(audiofilters_compressor_obj_t *self) {
+    return self->ratio;
+}
+
+void common_hal_audiofilters_compressor_set_ratio(audiofilters_compressor_obj_t *self, mp_float_t ratio) {
+    self->ratio = ratio;
+    compressor_update(self);
+}
+
+mp_float_t common_hal_audiofilters_compressor_get_attack_time(audiofilters_compressor_obj_t *self) {
+    return self->attack_time;
+}
+
+void common_hal_audiofilters_compressor_set_attack_time(audiofilters_compressor_obj_t *self, mp_float_t attack_time) {
+    self->attack_time = attack_time;
+    compressor_update(self);
+}
+
+mp_float_t common_hal_audiofilters_compressor_get_release_time(audiofilters_compressor_obj_t *self) {
+    return self->release_time;
+}
+
+void common_hal_audiofilters_compressor_set_release_time(audiofilters_compressor_obj_t *self, mp_float_t release_time) {
+    self->release_time = release_time;
+    compressor_update(self);
+}
+
+mp_float_t common_hal_audiofilters_compressor_get_gain(audiofilters_compressor_obj_t *self) {
+    return (mp_float_t)self->gain / (1 << 15);
+}
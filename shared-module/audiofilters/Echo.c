@@ -0,0 +1,92 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "shared-bindings/audiofilters/Echo.h"
+
+STATIC void echo_process(audiofilters_effect_t *effect, int16_t *buffer, uint32_t frames) {
+    audiofilters_echo_obj_t *self = (audiofilters_echo_obj_t *)effect;
+    uint8_t channels = effect->channel_count;
+    int32_t decay = self->decay_scaled;
+    uint32_t remaining = frames * channels;
+    while (remaining > 0) {
+        // delay may have been shortened from Python while playing.
+        if (self->position >= self->delay_frames) {
+            self->position = 0;
+        }
+        // Work up to where the ring wraps. The buffer and the ring both hold
+        // interleaved frames so they can be walked together.
+        int16_t *line = self->delay_line + self->position * channels;
+        uint32_t n = MIN(remaining, (self->delay_frames - self->position) * channels);
+        for (uint32_t i = 0; i < n; i++) {
+            int32_t output = buffer[i] + ((line[i] * decay) >> 15);
+            output = MIN(MAX(output, INT16_MIN), INT16_MAX);
+            line[i] = output;
+            buffer[i] = output;
+        }
+        buffer += n;
+        remaining -= n;
+        self->position += n / channels;
+    }
+}
+
+STATIC void echo_reset(audiofilters_effect_t *effect) {
+    audiofilters_echo_obj_t *self = (audiofilters_echo_obj_t *)effect;
+    uint32_t delay_frames = (uint32_t)(self->delay * effect->sample_rate);
+    self->delay_frames = MIN(MAX(delay_frames, 1u), self->max_delay_frames);
+    self->position = 0;
+    memset(self->delay_line, 0, self->max_delay_frames * effect->channel_count * sizeof(int16_t));
+}
+
+void common_hal_audiofilters_echo_construct(audiofilters_echo_obj_t *self, mp_obj_t sample,
+    uint32_t buffer_size, mp_float_t max_delay, mp_float_t delay, mp_float_t decay) {
+    audiofilters_effect_construct(&self->effect, sample, buffer_size, echo_process, echo_reset);
+    self->max_delay_frames = MAX((uint32_t)(max_delay * self->effect.sample_rate), 1u);
+    self->delay_line = m_malloc(self->max_delay_frames * self->effect.channel_count * sizeof(int16_t));
+    self->delay = delay;
+    common_hal_audiofilters_echo_set_decay(self, decay);
+    echo_reset(&self->effect);
+}
+
+mp_float_t common_hal_audiofilters_echo_get_delay(audiofilters_echo_obj_t *self) {
+    return self->delay;
+}
+
+void common_hal_audiofilters_echo_set_delay(audiofilters_echo_obj_t *self, mp_float_t delay) {
+    self->delay = delay;
+    // The echoes so far no longer line up, so start the ring over.
+    echo_reset(&self->effect);
+}
+
+mp_float_t common_hal_audiofilters_echo_get_decay(audiofilters_echo_obj_t *self) {
+    return self->decay;
+}
+
+void common_hal_audiofilters_echo_set_decay(audiofilters_echo_obj_t *self, mp_float_t decay) {
+    self->decay = decay;
+    self->decay_scaled = (int16_t)(decay * 32767);
+}
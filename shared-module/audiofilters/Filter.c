@@ -0,0 +1,92 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "shared-bindings/audiofilters/Filter.h"
+
+STATIC void filter_process(audiofilters_effect_t *effect, int16_t *buffer, uint32_t frames) {
+    audiofilters_filter_obj_t *self = (audiofilters_filter_obj_t *)effect;
+    if (self->filter == mp_const_none) {
+        return;
+    }
+    uint8_t channels = effect->channel_count;
+    int16_t *end = buffer + frames * channels;
+    for (uint8_t c = 0; c < channels; c++) {
+        biquad_filter_state *st = &self->state[c];
+        int32_t a1 = st->a1;
+        int32_t a2 = st->a2;
+        int32_t b0 = st->b0;
+        int32_t b1 = st->b1;
+        int32_t b2 = st->b2;
+
+        int32_t x0 = st->x[0];
+        int32_t x1 = st->x[1];
+        int32_t y0 = st->y[0];
+        int32_t y1 = st->y[1];
+
+        for (int16_t *sample = buffer + c; sample < end; sample += channels) {
+            int32_t input = *sample;
+            int32_t output = (b0 * input + b1 * x0 + b2 * x1 - a1 * y0 - a2 * y1 + (1 << (BIQUAD_SHIFT - 1))) >> BIQUAD_SHIFT;
+            output = MIN(MAX(output, INT16_MIN), INT16_MAX);
+
+            x1 = x0;
+            x0 = input;
+            y1 = y0;
+            y0 = output;
+            *sample = output;
+        }
+        st->x[0] = x0;
+        st->x[1] = x1;
+        st->y[0] = y0;
+        st->y[1] = y1;
+    }
+}
+
+STATIC void filter_reset(audiofilters_effect_t *effect) {
+    audiofilters_filter_obj_t *self = (audiofilters_filter_obj_t *)effect;
+    for (size_t c = 0; c < MP_ARRAY_SIZE(self->state); c++) {
+        synthio_biquad_filter_reset(&self->state[c]);
+    }
+}
+
+void common_hal_audiofilters_filter_construct(audiofilters_filter_obj_t *self, mp_obj_t sample,
+    uint32_t buffer_size, mp_obj_t filter) {
+    audiofilters_effect_construct(&self->effect, sample, buffer_size, filter_process, filter_reset);
+    common_hal_audiofilters_filter_set_filter(self, filter);
+    filter_reset(&self->effect);
+}
+
+mp_obj_t common_hal_audiofilters_filter_get_filter(audiofilters_filter_obj_t *self) {
+    return self->filter;
+}
+
+void common_hal_audiofilters_filter_set_filter(audiofilters_filter_obj_t *self, mp_obj_t filter) {
+    for (size_t c = 0; c < MP_ARRAY_SIZE(self->state); c++) {
+        synthio_biquad_filter_assign(&self->state[c], filter);
+    }
+    self->filter = filter;
+}
@@ -0,0 +1,59 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audiofilters/SoftClip.h"
+
+STATIC void softclip_process(audiofilters_effect_t *effect, int16_t *buffer, uint32_t frames) {
+    audiofilters_softclip_obj_t *self = (audiofilters_softclip_obj_t *)effect;
+    int32_t drive = self->drive_scaled;
+    for (uint32_t i = frames * effect->channel_count; i--; buffer++) {
+        // Amplify by 2/3 of drive, limit to full scale and then bend with
+        // y = (3x - x^3) / 2. That meets full scale with a slope of zero and
+        // gives quiet samples a gain of drive.
+        int32_t x = (*buffer * drive) >> 12;
+        x = MIN(MAX(x, -32767), 32767);
+        int32_t cube = (((x * x) >> 15) * x) >> 15;
+        *buffer = MIN((3 * x - cube) >> 1, INT16_MAX);
+    }
+}
+
+STATIC void softclip_reset(audiofilters_effect_t *effect) {
+}
+
+void common_hal_audiofilters_softclip_construct(audiofilters_softclip_obj_t *self, mp_obj_t sample,
+    uint32_t buffer_size, mp_float_t drive) {
+    audiofilters_effect_construct(&self->effect, sample, buffer_size, softclip_process, softclip_reset);
+    common_hal_audiofilters_softclip_set_drive(self, drive);
+}
+
+mp_float_t common_hal_audiofilters_softclip_get_drive(audiofilters_softclip_obj_t *self) {
+    return self->drive;
+}
+
+void common_hal_audiofilters_softclip_set_drive(audiofilters_softclip_obj_t *self, mp_float_t drive) {
+    self->drive = drive;
+    self->drive_scaled = (int32_t)(drive * (2 << 12) / 3);
+}
@@ -0,0 +1,192 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-module/audiofilters/__init__.h"
+
+void audiofilters_effect_construct(audiofilters_effect_t *self, mp_obj_t sample, uint32_t buffer_size,
+    audiofilters_process_fun process, audiofilters_reset_fun reset) {
+    uint8_t channel_count = audiosample_channel_count(sample);
+    mp_arg_validate_int_range(channel_count, 1, 2, MP_QSTR_channel_count);
+    uint8_t bits_per_sample = audiosample_bits_per_sample(sample);
+    if (bits_per_sample != 8 && bits_per_sample != 16) {
+        mp_raise_ValueError(MP_ERROR_TEXT("bits_per_sample must be 8 or 16"));
+    }
+    bool single_buffer;
+    uint32_t max_buffer_length;
+    uint8_t spacing;
+    audiosample_get_buffer_structure(sample, false, &single_buffer, &self->samples_signed,
+        &max_buffer_length, &spacing);
+
+    // Keep whole frames in a multiple of four bytes so that the output can be
+    // mixed a word at a time.
+    uint32_t frame_size = bits_per_sample / 8 * channel_count;
+    self->len = MAX((buffer_size & ~3) / frame_size, 4 / frame_size);
+    // Samples are processed as signed 16 bit and converted back in place.
+    self->first_buffer = m_malloc(self->len * channel_count * sizeof(int16_t));
+    self->second_buffer = m_malloc(self->len * channel_count * sizeof(int16_t));
+
+    self->sample = sample;
+    self->process = process;
+    self->reset = reset;
+    self->bits_per_sample = bits_per_sample;
+    self->channel_count = channel_count;
+    self->sample_rate = audiosample_sample_rate(sample);
+    self->use_first_buffer = true;
+}
+
+void audiofilters_effect_deinit(audiofilters_effect_t *self) {
+    self->first_buffer = NULL;
+    self->second_buffer = NULL;
+    self->sample = MP_OBJ_NULL;
+}
+
+bool audiofilters_effect_deinited(audiofilters_effect_t *self) {
+    return self->first_buffer == NULL;
+}
+
+uint32_t audiofilters_effect_get_sample_rate(audiofilters_effect_t *self) {
+    return audiosample_sample_rate(self->sample);
+}
+
+uint8_t audiofilters_effect_get_bits_per_sample(audiofilters_effect_t *self) {
+    return self->bits_per_sample;
+}
+
+uint8_t audiofilters_effect_get_channel_count(audiofilters_effect_t *self) {
+    return self->channel_count;
+}
+
+void audiofilters_effect_reset_buffer(audiofilters_effect_t *self,
+    bool single_channel_output,
+    uint8_t channel) {
+    if (single_channel_output && channel == 1) {
+        return;
+    }
+    audiosample_reset_buffer(self->sample, false, 0);
+    // A RawSample's rate can change between plays.
+    self->sample_rate = audiosample_sample_rate(self->sample);
+    self->reset(self);
+    self->source_buffer = NULL;
+    self->source_remaining = 0;
+    self->source_done = false;
+    self->done = false;
+    self->buffer_length = 0;
+    self->read_count = 0;
+    self->left_read_count = 0;
+    self->right_read_count = 0;
+}
+
+// Copy up to frames frames from the sample into out as signed 16 bit. Returns
+// how many were copied, fewer at the end of the sample.
+STATIC uint32_t effect_fill(audiofilters_effect_t *self, int16_t *out, uint32_t frames) {
+    uint32_t frame_size = self->bits_per_sample / 8 * self->channel_count;
+    uint32_t filled = 0;
+    while (filled < frames) {
+        if (self->source_remaining == 0) {
+            if (self->source_done) {
+                break;
+            }
+            uint8_t *buffer;
+            uint32_t buffer_length;
+            audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0, &buffer, &buffer_length);
+            if (result == GET_BUFFER_ERROR) {
+                buffer_length = 0;
+            }
+            self->source_done = result != GET_BUFFER_MORE_DATA;
+            self->source_buffer = buffer;
+            self->source_remaining = buffer_length / frame_size;
+            continue;
+        }
+        uint32_t n = MIN(self->source_remaining, frames - filled);
+        audiosample_convert_to_s16(out + filled * self->channel_count, self->source_buffer,
+            n * self->channel_count, self->bits_per_sample, self->samples_signed);
+        self->source_buffer += n * frame_size;
+        self->source_remaining -= n;
+        filled += n;
+    }
+    return filled;
+}
+
+audioio_get_buffer_result_t audiofilters_effect_get_buffer(audiofilters_effect_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length) {
+    if (!single_channel_output) {
+        channel = 0;
+    }
+
+    uint32_t channel_read_count = self->left_read_count;
+    if (channel == 1) {
+        channel_read_count = self->right_read_count;
+    }
+
+    if (self->read_count == channel_read_count) {
+        int16_t *out = self->use_first_buffer ? self->first_buffer : self->second_buffer;
+        self->use_first_buffer = !self->use_first_buffer;
+        uint32_t frame_size = self->bits_per_sample / 8 * self->channel_count;
+        uint32_t filled = effect_fill(self, out, self->len);
+        if (filled < self->len) {
+            // Pad the last buffer with silence to word align it.
+            uint32_t aligned = ((filled * frame_size + 3) & ~3) / frame_size;
+            memset(out + filled * self->channel_count, 0, (aligned - filled) * self->channel_count * sizeof(int16_t));
+            filled = aligned;
+        }
+        if (filled > 0) {
+            self->process(self, out, filled);
+        }
+        audiosample_convert_from_s16(out, filled * self->channel_count, self->bits_per_sample, self->samples_signed);
+        self->buffer_length = filled * frame_size;
+        self->done = self->source_done && self->source_remaining == 0;
+        self->read_count += 1;
+    }
+
+    *buffer = (uint8_t *)(self->use_first_buffer ? self->second_buffer : self->first_buffer);
+    *buffer_length = self->buffer_length;
+    if (channel == 0) {
+        self->left_read_count += 1;
+    } else if (channel == 1) {
+        self->right_read_count += 1;
+        *buffer = *buffer + self->bits_per_sample / 8;
+    }
+    return self->done ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+}
+
+void audiofilters_effect_get_buffer_structure(audiofilters_effect_t *self, bool single_channel_output,
+    bool *single_buffer, bool *samples_signed,
+    uint32_t *max_buffer_length, uint8_t *spacing) {
+    *single_buffer = false;
+    *samples_signed = self->samples_signed;
+    *max_buffer_length = self->len * self->bits_per_sample / 8 * self->channel_count;
+    if (single_channel_output) {
+        *spacing = self->channel_count;
+    } else {
+        *spacing = 1;
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "py/obj.h"
+
+#include "shared-module/audiocore/__init__.h"
+
+typedef struct audiofilters_effect audiofilters_effect_t;
+
+// Process frames of interleaved, signed 16 bit samples in place.
+typedef void (*audiofilters_process_fun)(audiofilters_effect_t *self, int16_t *buffer, uint32_t frames);
+// Forget any state carried from one buffer to the next.
+typedef void (*audiofilters_reset_fun)(audiofilters_effect_t *self);
+
+// The start of every effect. It plays the wrapped sample in its own format and
+// runs process on each buffer before handing it on.
+struct audiofilters_effect {
+    mp_obj_base_t base;
+    mp_obj_t sample;
+    audiofilters_process_fun process;
+    audiofilters_reset_fun reset;
+    int16_t *first_buffer;
+    int16_t *second_buffer;
+    uint32_t len; // in frames
+    uint32_t buffer_length; // in bytes
+    uint32_t sample_rate;
+    uint8_t bits_per_sample;
+    bool samples_signed;
+    uint8_t channel_count;
+    bool use_first_buffer;
+    bool done;
+    bool source_done;
+    // The rest of the sample's buffer that hasn't been processed yet.
+    const uint8_t *source_buffer;
+    uint32_t source_remaining; // in frames
+
+    uint32_t read_count;
+    uint32_t left_read_count;
+    uint32_t right_read_count;
+};
+
+void audiofilters_effect_construct(audiofilters_effect_t *self, mp_obj_t sample, uint32_t buffer_size,
+    audiofilters_process_fun process, audiofilters_reset_fun reset);
+void audiofilters_effect_deinit(audiofilters_effect_t *self);
+bool audiofilters_effect_deinited(audiofilters_effect_t *self);
+uint32_t audiofilters_effect_get_sample_rate(audiofilters_effect_t *self);
+uint8_t audiofilters_effect_get_bits_per_sample(audiofilters_effect_t *self);
+uint8_t audiofilters_effect_get_channel_count(audiofilters_effect_t *self);
+
+// These are not available from Python because it may be called in an interrupt.
+void audiofilters_effect_reset_buffer(audiofilters_effect_t *self,
+    bool single_channel_output,
+    uint8_t channel);
+audioio_get_buffer_result_t audiofilters_effect_get_buffer(audiofilters_effect_t *self,
+    bool single_channel_output,
+    uint8_t channel,
+    uint8_t **buffer,
+    uint32_t *buffer_length);                                                      // length in bytes
+void audiofilters_effect_get_buffer_structure(audiofilters_effect_t *self, bool single_channel_output,
+    bool *single_buffer, bool *samples_signed,
+    uint32_t *max_buffer_length, uint8_t *spacing);
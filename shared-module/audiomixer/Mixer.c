@@ -38,6 +38,16 @@
 #include "cmsis_compiler.h"
 #endif
 
+// Cortex-M4, M7 and M33 (with the DSP extension) have packed 16-bit arithmetic.
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#define MIXER_HAS_DSP (1)
+#else
+#define MIXER_HAS_DSP (0)
+#endif
+
+// Voice level that leaves samples unchanged.
+#define MIXER_UNITY_LEVEL (1 << 15)
+
 void common_hal_audiomixer_mixer_construct(audiomixer_mixer_obj_t *self,
     uint8_t voice_count,
     uint32_t buffer_size,
@@ -106,7 +116,7 @@ void audiomixer_mixer_reset_buffer(audiomixer_mixer_obj_t *self,
 
 __attribute__((always_inline))
 static inline uint32_t add16signed(uint32_t a, uint32_t b) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_HAS_DSP
     return __QADD16(a, b);
     #else
     uint32_t result = 0;
@@ -127,7 +137,7 @@ static inline uint32_t add16signed(uint32_t a, uint32_t b) {
 
 __attribute__((always_inline))
 static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_HAS_DSP
     mul <<= 16;
     int32_t hi, lo;
     enum { bits = 16 }; // saturate to 16 bits
@@ -139,11 +149,11 @@ static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
     asm volatile ("pkhbt %0, %1, %2, lsl #16" : "=r" (val) : "r" (lo), "r" (hi)); // pack
     return val;
     #else
+    // Integer only: cores without the DSP extension usually have no FPU either.
     uint32_t result = 0;
-    float mod_mul = (float)mul / (float)((1 << 15) - 1);
     for (int8_t i = 0; i < 2; i++) {
         int16_t ai = (val >> (sizeof(uint16_t) * 8 * i));
-        int32_t intermediate = (int32_t)(ai * mod_mul);
+        int32_t intermediate = (ai * mul) >> 15;
         if (intermediate > SHRT_MAX) {
             intermediate = SHRT_MAX;
         } else if (intermediate < SHRT_MIN) {
@@ -157,7 +167,7 @@ static inline uint32_t mult16signed(uint32_t val, int32_t mul) {
 }
 
 static inline uint32_t tounsigned8(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_HAS_DSP
     return __UADD8(val, 0x80808080);
     #else
     return val ^ 0x80808080;
@@ -165,7 +175,7 @@ static inline uint32_t tounsigned8(uint32_t val) {
 }
 
 static inline uint32_t tounsigned16(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_HAS_DSP
     return __UADD16(val, 0x80008000);
     #else
     return val ^ 0x80008000;
@@ -173,7 +183,7 @@ static inline uint32_t tounsigned16(uint32_t val) {
 }
 
 static inline uint32_t tosigned16(uint32_t val) {
-    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    #if MIXER_HAS_DSP
     return __UADD16(val, 0x80008000);
     #else
     return val ^ 0x80008000;
@@ -191,6 +201,7 @@ static inline uint32_t pack8(uint32_t val) {
 static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
     audiomixer_mixervoice_obj_t *voice, bool voices_active,
     uint32_t *word_buffer, uint32_t length) {
+    uint32_t sign_flip = self->samples_signed ? 0 : 0x80008000;
     while (length != 0) {
         if (voice->buffer_length == 0) {
             if (!voice->more_data) {
@@ -214,56 +225,49 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
         uint32_t *src = voice->remaining_buffer;
         uint16_t level = voice->level;
 
-        // First active voice gets copied over verbatim.
-        if (!voices_active) {
-            if (MP_LIKELY(self->bits_per_sample == 16)) {
-                if (MP_LIKELY(self->samples_signed)) {
+        // Each case gets its own loop so that nothing is decided per word.
+        // Unsigned samples are converted by flipping the sign bit of each half.
+        if (MP_LIKELY(self->bits_per_sample == 16)) {
+            if (!voices_active) {
+                // First active voice gets copied over verbatim.
+                if (level == MIXER_UNITY_LEVEL) {
                     for (uint32_t i = 0; i < n; i++) {
-                        uint32_t v = src[i];
-                        word_buffer[i] = mult16signed(v, level);
+                        word_buffer[i] = src[i] ^ sign_flip;
                     }
                 } else {
                     for (uint32_t i = 0; i < n; i++) {
-                        uint32_t v = src[i];
-                        v = tosigned16(v);
-                        word_buffer[i] = mult16signed(v, level);
+                        word_buffer[i] = mult16signed(src[i] ^ sign_flip, level);
                     }
                 }
             } else {
-                uint16_t *hword_buffer = (uint16_t *)word_buffer;
-                uint16_t *hsrc = (uint16_t *)src;
-                for (uint32_t i = 0; i < n * 2; i++) {
-                    uint32_t word = unpack8(hsrc[i]);
-                    if (MP_LIKELY(!self->samples_signed)) {
-                        word = tosigned16(word);
-                    }
-                    word = mult16signed(word, level);
-                    hword_buffer[i] = pack8(word);
-                }
-            }
-        } else {
-            if (MP_LIKELY(self->bits_per_sample == 16)) {
-                if (MP_LIKELY(self->samples_signed)) {
+                if (level == MIXER_UNITY_LEVEL) {
                     for (uint32_t i = 0; i < n; i++) {
-                        uint32_t word = src[i];
-                        word_buffer[i] = add16signed(mult16signed(word, level), word_buffer[i]);
+                        word_buffer[i] = add16signed(src[i] ^ sign_flip, word_buffer[i]);
                     }
                 } else {
                     for (uint32_t i = 0; i < n; i++) {
-                        uint32_t word = src[i];
-                        word = tosigned16(word);
-                        word_buffer[i] = add16signed(mult16signed(word, level), word_buffer[i]);
+                        word_buffer[i] = add16signed(mult16signed(src[i] ^ sign_flip, level), word_buffer[i]);
+                    }
+                }
+            }
+        } else {
+            uint16_t *hword_buffer = (uint16_t *)word_buffer;
+            uint16_t *hsrc = (uint16_t *)src;
+            bool scale = level != MIXER_UNITY_LEVEL;
+            if (!voices_active) {
+                for (uint32_t i = 0; i < n * 2; i++) {
+                    uint32_t word = unpack8(hsrc[i]) ^ sign_flip;
+                    if (scale) {
+                        word = mult16signed(word, level);
                     }
+                    hword_buffer[i] = pack8(word);
                 }
             } else {
-                uint16_t *hword_buffer = (uint16_t *)word_buffer;
-                uint16_t *hsrc = (uint16_t *)src;
                 for (uint32_t i = 0; i < n * 2; i++) {
-                    uint32_t word = unpack8(hsrc[i]);
-                    if (MP_LIKELY(!self->samples_signed)) {
-                        word = tosigned16(word);
+                    uint32_t word = unpack8(hsrc[i]) ^ sign_flip;
+                    if (scale) {
+                        word = mult16signed(word, level);
                     }
-                    word = mult16signed(word, level);
                     word = add16signed(word, unpack8(hword_buffer[i]));
                     hword_buffer[i] = pack8(word);
                 }
@@ -39,6 +39,7 @@
 #include "lib/mp3/src/mp3common.h"
 
 #define MAX_BUFFER_LEN (MAX_NSAMP * MAX_NGRAN * MAX_NCHAN * sizeof(int16_t))
+#define FILE_INBUF_LEN (2048)
 
 /** Fill the input buffer unconditionally.
  *
@@ -48,7 +49,8 @@
  *
  * Raises OSError if f_read fails.
  *
- * Sets self->eof if any read of the file returns 0 bytes
+ * Sets self->eof if any read of the file returns 0 bytes.  A buffer source
+ * is entirely "read" up front, so eof is always set and this does nothing.
  */
 STATIC bool mp3file_update_inbuf_always(audiomp3_mp3file_obj_t *self) {
     // If we didn't previously reach the end of file, we can try reading now
@@ -139,7 +141,11 @@ STATIC void mp3file_skip_id3v2(audiomp3_mp3file_obj_t *self) {
     size -= to_consume;
 
     // Next, seek in the file after the header
-    f_lseek(&self->file->fp, f_tell(&self->file->fp) + size);
+    if (self->file) {
+        f_lseek(&self->file->fp, f_tell(&self->file->fp) + size);
+    } else {
+        CONSUME(self, MIN(size, BYTES_LEFT(self)));
+    }
     return;
 }
 
@@ -155,7 +161,9 @@ STATIC bool mp3file_find_sync_word(audiomp3_mp3file_obj_t *self) {
             mp3file_update_inbuf_half(self);
             return true;
         }
-        CONSUME(self, MAX(0, BYTES_LEFT(self) - 16));
+        if (BYTES_LEFT(self) > 16) {
+            CONSUME(self, BYTES_LEFT(self) - 16);
+        }
     } while (!self->eof);
     return false;
 }
@@ -163,6 +171,10 @@ STATIC bool mp3file_find_sync_word(audiomp3_mp3file_obj_t *self) {
 STATIC bool mp3file_get_next_frame_info(audiomp3_mp3file_obj_t *self, MP3FrameInfo *fi) {
     int err;
     do {
+        // The header is 4 bytes; a buffer source has no zero padding past its end
+        if (BYTES_LEFT(self) < 4) {
+            return false;
+        }
         err = MP3GetNextFrameInfo(self->decoder, fi, READ_PTR(self));
         if (err == ERR_MP3_NONE) {
             break;
@@ -173,8 +185,120 @@ STATIC bool mp3file_get_next_frame_info(audiomp3_mp3file_obj_t *self, MP3FrameIn
     return err == ERR_MP3_NONE;
 }
 
+// Decode the next frame into buffer, setting *length to the bytes decoded.
+// Only touches the input buffer, so for a buffer source this may run on the
+// worker core.
+STATIC audioio_get_buffer_result_t mp3file_decode_frame(audiomp3_mp3file_obj_t *self,
+    int16_t *buffer, uint32_t *length) {
+    *length = 0;
+    mp3file_skip_id3v2(self);
+    if (!mp3file_find_sync_word(self)) {
+        return self->eof ? GET_BUFFER_DONE : GET_BUFFER_ERROR;
+    }
+    int bytes_left = BYTES_LEFT(self);
+    uint8_t *inbuf = READ_PTR(self);
+    int err = MP3Decode(self->decoder, &inbuf, &bytes_left, buffer, 0);
+    CONSUME(self, BYTES_LEFT(self) - bytes_left);
+
+    if (err) {
+        return GET_BUFFER_DONE;
+    }
+
+    *length = self->frame_buffer_size;
+    mp3file_skip_id3v2(self);
+    return mp3file_find_sync_word(self) ? GET_BUFFER_MORE_DATA : GET_BUFFER_DONE;
+}
+
+#if CIRCUITPY_AUDIOMP3_MULTICORE
+// Set by the worker core while it may be touching the bound decoder.
+STATIC volatile bool _worker_busy;
+
+void audiomp3_mp3file_worker_poll(void) {
+    _worker_busy = true;
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    audiomp3_mp3file_obj_t *self = MP_STATE_VM(audiomp3_worker_decoder);
+    // One buffer always belongs to get_buffer, as the frame being played.
+    while (self != NULL && !self->worker_done &&
+           (uint8_t)(self->frames_written - self->frames_read) < AUDIOMP3_BUFFER_COUNT - 1) {
+        uint8_t index = self->frames_written % AUDIOMP3_BUFFER_COUNT;
+        uint32_t length;
+        audioio_get_buffer_result_t result = mp3file_decode_frame(self, self->buffers[index], &length);
+        self->frame_result[index] = result;
+        self->frame_length[index] = length;
+        self->worker_done = result != GET_BUFFER_MORE_DATA;
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+        self->frames_written++;
+    }
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    _worker_busy = false;
+}
+
+void audiomp3_mp3file_worker_release(void) {
+    MP_STATE_VM(audiomp3_worker_decoder) = NULL;
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    while (_worker_busy) {
+    }
+}
+
+STATIC void mp3file_stop_worker(audiomp3_mp3file_obj_t *self) {
+    if (MP_STATE_VM(audiomp3_worker_decoder) == self) {
+        audiomp3_mp3file_worker_release();
+    }
+}
+
+// Hand decoding over to the worker core.  File sources stay on this core
+// because FatFs may only be used from the VM.
+STATIC void mp3file_start_worker(audiomp3_mp3file_obj_t *self) {
+    if (self->file != NULL || !audiomp3_port_worker_start()) {
+        return;
+    }
+    // Another decoder loses the worker and goes back to decoding inline.
+    audiomp3_mp3file_worker_release();
+    self->frames_written = 0;
+    self->frames_read = 0;
+    self->worker_done = false;
+    // The buffer get_buffer owns before the first frame is queued.
+    self->buffer_index = AUDIOMP3_BUFFER_COUNT - 1;
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    MP_STATE_VM(audiomp3_worker_decoder) = self;
+    audiomp3_port_worker_wake();
+}
+
+STATIC audioio_get_buffer_result_t mp3file_get_queued_buffer(audiomp3_mp3file_obj_t *self,
+    uint8_t channel, uint8_t **bufptr, uint32_t *buffer_length) {
+    if (self->frames_written == self->frames_read) {
+        if (self->worker_done) {
+            *buffer_length = 0;
+            return GET_BUFFER_DONE;
+        }
+        // Underrun: play silence from the frame we already own.
+        memset(self->buffers[self->buffer_index], 0, self->frame_buffer_size);
+        *bufptr = (uint8_t *)self->buffers[self->buffer_index];
+        self->other_channel = 1 - channel;
+        self->other_buffer_index = self->buffer_index;
+        return GET_BUFFER_MORE_DATA;
+    }
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    uint8_t index = self->frames_read % AUDIOMP3_BUFFER_COUNT;
+    audioio_get_buffer_result_t result = self->frame_result[index];
+    *buffer_length = self->frame_length[index];
+    self->buffer_index = index;
+    self->other_channel = 1 - channel;
+    self->other_buffer_index = index;
+    *bufptr = (uint8_t *)self->buffers[index];
+    self->samples_decoded += *buffer_length / sizeof(int16_t);
+    // Releases the previous frame's buffer to the worker.
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    self->frames_read++;
+    audiomp3_port_worker_wake();
+    return result;
+}
+
+MP_REGISTER_ROOT_POINTER(struct _audiomp3_mp3file_obj_t *audiomp3_worker_decoder);
+#endif
+
 void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t *self,
-    pyb_file_obj_t *file,
+    mp_obj_t source,
     uint8_t *buffer,
     size_t buffer_size) {
     // XXX Adafruit_MP3 uses a 2kB input buffer and two 4kB output buffers.
@@ -186,14 +310,10 @@ void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t *self,
     // frame size; this is typically 2304 * 2 bytes, so a little bit bigger
     // than the two 4kB output buffers, except that the alignment allows to
     // never allocate that extra frame buffer.
+    //
+    // The input buffer is only allocated for file sources: a buffer source
+    // (such as a memorymap.AddressRange over XIP flash) is decoded in place.
 
-    self->inbuf_length = 2048;
-    self->inbuf_offset = self->inbuf_length;
-    self->inbuf = m_malloc(self->inbuf_length);
-    if (self->inbuf == NULL) {
-        common_hal_audiomp3_mp3file_deinit(self);
-        m_malloc_fail(self->inbuf_length);
-    }
     self->decoder = MP3InitDecoder();
     if (self->decoder == NULL) {
         common_hal_audiomp3_mp3file_deinit(self);
@@ -222,16 +342,54 @@ void common_hal_audiomp3_mp3file_construct(audiomp3_mp3file_obj_t *self,
         }
     }
 
-    common_hal_audiomp3_mp3file_set_file(self, file);
+    common_hal_audiomp3_mp3file_set_file(self, source);
 }
 
-void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t *self, pyb_file_obj_t *file) {
+// Rewind to the start of the source.  Must be called with background
+// callbacks blocked.
+STATIC void mp3file_rewind(audiomp3_mp3file_obj_t *self) {
+    if (self->file) {
+        f_lseek(&self->file->fp, 0);
+        self->inbuf_offset = self->inbuf_length;
+        self->eof = 0;
+    } else {
+        self->inbuf_offset = 0;
+        self->eof = 1;
+    }
+}
+
+void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t *self, mp_obj_t source) {
+    #if CIRCUITPY_AUDIOMP3_MULTICORE
+    mp3file_stop_worker(self);
+    #endif
+    pyb_file_obj_t *file = NULL;
+    mp_buffer_info_t bufinfo = { 0 };
+    if (mp_obj_is_type(source, &mp_type_fileio)) {
+        file = MP_OBJ_TO_PTR(source);
+        if (self->file_inbuf == NULL) {
+            self->file_inbuf = m_malloc(FILE_INBUF_LEN);
+            if (self->file_inbuf == NULL) {
+                m_malloc_fail(FILE_INBUF_LEN);
+            }
+        }
+    } else {
+        mp_get_buffer_raise(source, &bufinfo, MP_BUFFER_READ);
+    }
+
     background_callback_begin_critical_section();
 
+    self->source = source;
     self->file = file;
-    f_lseek(&self->file->fp, 0);
-    self->inbuf_offset = self->inbuf_length;
-    self->eof = 0;
+    if (file) {
+        vfs_fat_file_drop_buffer(file);
+        self->inbuf = self->file_inbuf;
+        self->inbuf_length = FILE_INBUF_LEN;
+    } else {
+        // The decoder never writes through its input pointer.
+        self->inbuf = bufinfo.buf;
+        self->inbuf_length = bufinfo.len;
+    }
+    mp3file_rewind(self);
     self->other_channel = -1;
     mp3file_update_inbuf_half(self);
     mp3file_find_sync_word(self);
@@ -258,11 +416,16 @@ void common_hal_audiomp3_mp3file_set_file(audiomp3_mp3file_obj_t *self, pyb_file
 }
 
 void common_hal_audiomp3_mp3file_deinit(audiomp3_mp3file_obj_t *self) {
+    #if CIRCUITPY_AUDIOMP3_MULTICORE
+    mp3file_stop_worker(self);
+    #endif
     MP3FreeDecoder(self->decoder);
     self->decoder = NULL;
     self->inbuf = NULL;
+    self->file_inbuf = NULL;
     self->buffers[0] = NULL;
     self->buffers[1] = NULL;
+    self->source = MP_OBJ_NULL;
     self->file = NULL;
     self->samples_decoded = 0;
 }
@@ -296,16 +459,20 @@ void audiomp3_mp3file_reset_buffer(audiomp3_mp3file_obj_t *self,
     }
     // We don't reset the buffer index in case we're looping and we have an odd number of buffer
     // loads
+    #if CIRCUITPY_AUDIOMP3_MULTICORE
+    mp3file_stop_worker(self);
+    #endif
     background_callback_begin_critical_section();
-    f_lseek(&self->file->fp, 0);
-    self->inbuf_offset = self->inbuf_length;
-    self->eof = 0;
+    mp3file_rewind(self);
     self->samples_decoded = 0;
     self->other_channel = -1;
     mp3file_update_inbuf_half(self);
     mp3file_skip_id3v2(self);
     mp3file_find_sync_word(self);
     background_callback_end_critical_section();
+    #if CIRCUITPY_AUDIOMP3_MULTICORE
+    mp3file_start_worker(self);
+    #endif
 }
 
 audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t *self,
@@ -330,6 +497,11 @@ audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t *
         return GET_BUFFER_MORE_DATA;
     }
 
+    #if CIRCUITPY_AUDIOMP3_MULTICORE
+    if (MP_STATE_VM(audiomp3_worker_decoder) == self) {
+        return mp3file_get_queued_buffer(self, channel, bufptr, buffer_length);
+    }
+    #endif
 
     self->buffer_index = !self->buffer_index;
     self->other_channel = 1 - channel;
@@ -337,27 +509,14 @@ audioio_get_buffer_result_t audiomp3_mp3file_get_buffer(audiomp3_mp3file_obj_t *
     int16_t *buffer = (int16_t *)(void *)self->buffers[self->buffer_index];
     *bufptr = (uint8_t *)buffer;
 
-    mp3file_skip_id3v2(self);
-    if (!mp3file_find_sync_word(self)) {
-        *buffer_length = 0;
-        return self->eof ? GET_BUFFER_DONE : GET_BUFFER_ERROR;
-    }
-    int bytes_left = BYTES_LEFT(self);
-    uint8_t *inbuf = READ_PTR(self);
-    int err = MP3Decode(self->decoder, &inbuf, &bytes_left, buffer, 0);
-    CONSUME(self, BYTES_LEFT(self) - bytes_left);
-
-    if (err) {
-        *buffer_length = 0;
-        return GET_BUFFER_DONE;
+    audioio_get_buffer_result_t result = mp3file_decode_frame(self, buffer, buffer_length);
+    if (*buffer_length == 0) {
+        return result;
     }
 
     self->samples_decoded += *buffer_length / sizeof(int16_t);
 
-    mp3file_skip_id3v2(self);
-    int result = mp3file_find_sync_word(self) ? GET_BUFFER_MORE_DATA : GET_BUFFER_DONE;
-
-    if (self->inbuf_offset >= 512) {
+    if (self->file && self->inbuf_offset >= 512) {
         background_callback_add(
             &self->inbuf_fill_cb,
             mp3file_update_inbuf_cb,
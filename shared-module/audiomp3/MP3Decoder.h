@@ -34,18 +34,26 @@
 
 #include "shared-module/audiocore/__init__.h"
 
-typedef struct {
+#define AUDIOMP3_BUFFER_COUNT (2)
+
+typedef struct _audiomp3_mp3file_obj_t {
     mp_obj_base_t base;
     struct _MP3DecInfo *decoder;
     background_callback_t inbuf_fill_cb;
+    // Points either at file_inbuf or directly at the data of a buffer source
     uint8_t *inbuf;
+    // Allocated the first time a file is played; unused for buffer sources
+    uint8_t *file_inbuf;
     uint32_t inbuf_length;
     uint32_t inbuf_offset;
-    int16_t *buffers[2];
+    int16_t *buffers[AUDIOMP3_BUFFER_COUNT];
     uint32_t len;
     uint32_t frame_buffer_size;
 
     uint32_t sample_rate;
+    // The file or buffer object being played
+    mp_obj_t source;
+    // NULL when playing from a buffer
     pyb_file_obj_t *file;
 
     uint8_t buffer_index;
@@ -56,6 +64,16 @@ typedef struct {
     int8_t other_buffer_index;
 
     uint32_t samples_decoded;
+
+    #if CIRCUITPY_AUDIOMP3_MULTICORE
+    // Frames decoded ahead by the worker core. Only the worker advances
+    // frames_written and only get_buffer advances frames_read.
+    volatile uint8_t frames_written;
+    volatile uint8_t frames_read;
+    volatile bool worker_done;
+    uint8_t frame_result[AUDIOMP3_BUFFER_COUNT];
+    uint32_t frame_length[AUDIOMP3_BUFFER_COUNT];
+    #endif
 } audiomp3_mp3file_obj_t;
 
 // These are not available from Python because it may be called in an interrupt.
@@ -75,4 +93,17 @@ float audiomp3_mp3file_get_rms_level(audiomp3_mp3file_obj_t *self);
 
 uint32_t common_hal_audiomp3_mp3file_get_samples_decoded(audiomp3_mp3file_obj_t *self);
 
+#if CIRCUITPY_AUDIOMP3_MULTICORE
+// Ports with a spare core decode buffer sources there. The port starts a
+// worker that calls audiomp3_mp3file_worker_poll() each time it is woken.
+bool audiomp3_port_worker_start(void);
+void audiomp3_port_worker_wake(void);
+
+// Called on the worker core: decode frames until the queue is full.
+void audiomp3_mp3file_worker_poll(void);
+// Take the worker away from its decoder. Once this returns, the worker will
+// not touch any decoder until one is started again.
+void audiomp3_mp3file_worker_release(void);
+#endif
+
 #endif // MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO_MP3FILE_H
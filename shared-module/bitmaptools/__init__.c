@@ -30,6 +30,7 @@
 #include "shared-bindings/displayio/Palette.h"
 #include "shared-bindings/displayio/ColorConverter.h"
 #include "shared-module/displayio/Bitmap.h"
+#include "shared-module/displayio/dither.h"
 
 #include "py/mperrno.h"
 #include "py/runtime.h"
@@ -43,6 +44,45 @@
 #define BITMAP_DEBUG(...) (void)0
 // #define BITMAP_DEBUG(...) mp_printf(&mp_plat_print, __VA_ARGS__)
 
+STATIC int64_t floor_div(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    if ((a % b != 0) && ((a < 0) != (b < 0))) {
+        q--;
+    }
+    return q;
+}
+
+STATIC int64_t ceil_div(int64_t a, int64_t b) {
+    return -floor_div(-a, b);
+}
+
+// Narrows [*first, *last] to the steps k for which the 16.16 coordinate
+// start + k * step is within [clip0, clip1).
+STATIC void clip_span(int64_t start, int64_t step, int16_t clip0, int16_t clip1, int32_t *first, int32_t *last) {
+    const int64_t lo = (int64_t)clip0 << 16;
+    const int64_t hi = ((int64_t)clip1 << 16) - 1;
+    int64_t k0, k1;
+    if (step == 0) {
+        if (start < lo || start > hi) {
+            *first = 1;
+            *last = 0;
+        }
+        return;
+    } else if (step > 0) {
+        k0 = ceil_div(lo - start, step);
+        k1 = floor_div(hi - start, step);
+    } else {
+        k0 = ceil_div(hi - start, step);
+        k1 = floor_div(lo - start, step);
+    }
+    if (k0 > *first) {
+        *first = MIN(k0, INT32_MAX);
+    }
+    if (k1 < *last) {
+        *last = MAX(k1, INT32_MIN + 1);
+    }
+}
+
 void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16_t oy,
     int16_t dest_clip0_x, int16_t dest_clip0_y,
     int16_t dest_clip1_x, int16_t dest_clip1_y,
@@ -200,27 +240,44 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     mp_float_t startu = px - (ox * dvCol + oy * duCol);
     mp_float_t startv = py - (ox * dvRow + oy * duRow);
 
-    mp_float_t rowu = startu + miny * duCol;
-    mp_float_t rowv = startv + miny * dvCol;
-
     displayio_area_t dirty_area = {minx, miny, maxx + 1, maxy + 1, NULL};
     displayio_bitmap_set_dirty_area(self, &dirty_area);
 
-    for (y = miny; y <= maxy; y++) {
-        mp_float_t u = rowu + minx * duRow;
-        mp_float_t v = rowv + minx * dvRow;
-        for (x = minx; x <= maxx; x++) {
-            if (u >= source_clip0_x && u < source_clip1_x && v >= source_clip0_y && v < source_clip1_y) {
-                uint32_t c = common_hal_displayio_bitmap_get_pixel(source, (int)u, (int)v);
-                if ((skip_index_none) || (c != skip_index)) {
-                    displayio_bitmap_write_pixel(self, x, y, c);
-                }
+    if (maxx < minx) {
+        return;
+    }
+
+    // Walk the destination in 16.16 fixed point. The source position is linear
+    // along a row, so the part of each row that samples the source clip window
+    // can be solved for directly and only that span is visited.
+    const int64_t fixed_duCol = (int64_t)(duCol * 65536);
+    const int64_t fixed_dvCol = (int64_t)(dvCol * 65536);
+    const int64_t fixed_duRow = (int64_t)(duRow * 65536);
+    const int64_t fixed_dvRow = (int64_t)(dvRow * 65536);
+    int64_t rowu = (int64_t)((startu + miny * duCol + minx * duRow) * 65536);
+    int64_t rowv = (int64_t)((startv + miny * dvCol + minx * dvRow) * 65536);
+
+    const int32_t width = maxx - minx + 1;
+    for (y = miny; y <= maxy; y++, rowu += fixed_duCol, rowv += fixed_dvCol) {
+        int32_t first = 0;
+        int32_t last = width - 1;
+        clip_span(rowu, fixed_duRow, source_clip0_x, source_clip1_x, &first, &last);
+        clip_span(rowv, fixed_dvRow, source_clip0_y, source_clip1_y, &first, &last);
+        if (first > last) {
+            continue;
+        }
+
+        // Within the span both coordinates fit in an int32.
+        int32_t u = rowu + first * fixed_duRow;
+        int32_t v = rowv + first * fixed_dvRow;
+        const int32_t du = fixed_duRow;
+        const int32_t dv = fixed_dvRow;
+        for (x = minx + first; x <= minx + last; x++, u += du, v += dv) {
+            uint32_t c = common_hal_displayio_bitmap_get_pixel(source, u >> 16, v >> 16);
+            if ((skip_index_none) || (c != skip_index)) {
+                displayio_bitmap_write_pixel(self, x, y, c);
             }
-            u += duRow;
-            v += dvRow;
         }
-        rowu += duCol;
-        rowv += dvCol;
     }
 }
 
@@ -241,155 +298,185 @@ void common_hal_bitmaptools_fill_region(displayio_bitmap_t *destination,
     // update the dirty rectangle
     displayio_bitmap_set_dirty_area(destination, &area);
 
-    int16_t x, y;
-    for (x = area.x1; x < area.x2; x++) {
-        for (y = area.y1; y < area.y2; y++) {
-            displayio_bitmap_write_pixel(destination, x, y, value);
-        }
-    }
-}
-
-void common_hal_bitmaptools_boundary_fill(displayio_bitmap_t *destination,
-    int16_t x, int16_t y,
-    uint32_t fill_color_value, uint32_t replaced_color_value) {
-
-    if (fill_color_value == replaced_color_value) {
-        // There is nothing to do
+    if (area.x2 <= area.x1) {
         return;
     }
-
-    uint32_t current_point_color_value;
-
-    // the list of points that we'll check
-    mp_obj_t fill_area = mp_obj_new_list(0, NULL);
-
-    // first point is the one user passed in
-    mp_obj_t point[] = { mp_obj_new_int(x), mp_obj_new_int(y) };
-    mp_obj_list_append(
-        fill_area,
-        mp_obj_new_tuple(2, point)
-        );
-
-    int16_t minx = x;
-    int16_t miny = y;
-    int16_t maxx = x;
-    int16_t maxy = y;
-
-    if (replaced_color_value == INT_MAX) {
-        current_point_color_value = common_hal_displayio_bitmap_get_pixel(
-            destination,
-            mp_obj_get_int(point[0]),
-            mp_obj_get_int(point[1]));
-        replaced_color_value = (uint32_t)current_point_color_value;
+    for (int16_t y = area.y1; y < area.y2; y++) {
+        displayio_bitmap_fill_row(destination, area.x1, y, area.x2 - area.x1, value);
     }
+}
 
-    mp_obj_t *fill_points;
-    size_t list_length = 0;
-    mp_obj_list_get(fill_area, &list_length, &fill_points);
-
-    mp_obj_t current_point;
-
-    size_t tuple_len = 0;
-    mp_obj_t *tuple_items;
+// Spans of pixels still to be scanned for boundary_fill. A few live on the C
+// stack; more come from one bounded heap buffer, and when that is full too spans
+// are dropped and found again by rescanning around the filled area.
+#define FILL_STACK_SPANS (32)
+#define FILL_SCRATCH_SPANS (512)
 
-    int cur_x, cur_y;
+typedef struct {
+    int16_t x1;
+    int16_t x2;
+    int16_t y;
+    int8_t dy;
+} fill_span_t;
 
-    // while there are still points to check
-    while (list_length > 0) {
-        mp_obj_list_get(fill_area, &list_length, &fill_points);
-        current_point = mp_obj_list_pop(fill_area, 0);
-        mp_obj_tuple_get(current_point, &tuple_len, &tuple_items);
-        current_point_color_value = common_hal_displayio_bitmap_get_pixel(
-            destination,
-            mp_obj_get_int(tuple_items[0]),
-            mp_obj_get_int(tuple_items[1]));
+typedef struct {
+    displayio_bitmap_t *bitmap;
+    uint32_t fill_color_value;
+    uint32_t replaced_color_value;
+    fill_span_t *spans;
+    fill_span_t *scratch;
+    size_t len;
+    size_t cap;
+    bool dropped;
+    displayio_area_t filled;
+} fill_state_t;
+
+STATIC bool fill_inside(fill_state_t *state, int16_t x, int16_t y) {
+    return x >= 0 && x < state->bitmap->width &&
+           common_hal_displayio_bitmap_get_pixel(state->bitmap, x, y) == state->replaced_color_value;
+}
 
-        // if the current point is not background color ignore it
-        if (current_point_color_value != replaced_color_value) {
-            mp_obj_list_get(fill_area, &list_length, &fill_points);
-            continue;
+STATIC void fill_push(fill_state_t *state, int16_t x1, int16_t x2, int16_t y, int8_t dy) {
+    if (y < 0 || y >= state->bitmap->height) {
+        return;
+    }
+    if (state->len == state->cap && state->scratch == NULL) {
+        state->scratch = m_new_maybe(fill_span_t, FILL_SCRATCH_SPANS);
+        if (state->scratch != NULL) {
+            memcpy(state->scratch, state->spans, state->len * sizeof(fill_span_t));
+            state->spans = state->scratch;
+            state->cap = FILL_SCRATCH_SPANS;
         }
+    }
+    if (state->len == state->cap) {
+        state->dropped = true;
+        return;
+    }
+    state->spans[state->len++] = (fill_span_t) { x1, x2, y, dy };
+}
 
-        cur_x = mp_obj_int_get_checked(tuple_items[0]);
-        cur_y = mp_obj_int_get_checked(tuple_items[1]);
+// Fill the pixels from x1 up to (not including) x2 on row y.
+STATIC void fill_run(fill_state_t *state, int16_t x1, int16_t x2, int16_t y) {
+    displayio_bitmap_fill_row(state->bitmap, x1, y, x2 - x1, state->fill_color_value);
+    displayio_area_t *filled = &state->filled;
+    filled->x1 = MIN(filled->x1, x1);
+    filled->x2 = MAX(filled->x2, x2);
+    filled->y1 = MIN(filled->y1, y);
+    filled->y2 = MAX(filled->y2, y + 1);
+}
 
-        if (cur_x < minx) {
-            minx = (int16_t)cur_x;
-        }
-        if (cur_x > maxx) {
-            maxx = (int16_t)cur_x;
+// Scanline fill: each span is a run on row y, reached from row y - dy, whose
+// pixels may start runs to fill. Runs that overhang the span on either side are
+// also followed back towards the row they came from.
+STATIC bool fill_spans(fill_state_t *state) {
+    while (state->len > 0) {
+        fill_span_t span = state->spans[--state->len];
+        int16_t x1 = span.x1;
+        int16_t x = x1;
+        int16_t y = span.y;
+        if (fill_inside(state, x, y)) {
+            while (fill_inside(state, x - 1, y)) {
+                x--;
+            }
+            if (x < x1) {
+                fill_run(state, x, x1, y);
+                fill_push(state, x, x1 - 1, y - span.dy, -span.dy);
+            }
         }
-        if (cur_y < miny) {
-            miny = (int16_t)cur_y;
+        while (x1 <= span.x2) {
+            int16_t run = x1;
+            while (fill_inside(state, x1, y)) {
+                x1++;
+            }
+            if (x1 > run) {
+                fill_run(state, run, x1, y);
+            }
+            if (x1 > x) {
+                fill_push(state, x, x1 - 1, y + span.dy, span.dy);
+            }
+            if (x1 - 1 > span.x2) {
+                fill_push(state, span.x2 + 1, x1 - 1, y - span.dy, -span.dy);
+            }
+            x1++;
+            while (x1 < span.x2 && !fill_inside(state, x1, y)) {
+                x1++;
+            }
+            x = x1;
         }
-        if (cur_y > maxy) {
-            maxy = (int16_t)cur_y;
+        RUN_BACKGROUND_TASKS;
+        if (mp_hal_is_interrupted()) {
+            return false;
         }
+    }
+    return true;
+}
 
-        // fill the current point with fill color
-        displayio_bitmap_write_pixel(
-            destination,
-            mp_obj_get_int(tuple_items[0]),
-            mp_obj_get_int(tuple_items[1]),
-            fill_color_value);
-
-        // add all 4 surrounding points to the list to check
-
-        // ignore points outside of the bitmap
-        if (mp_obj_int_get_checked(tuple_items[1]) - 1 >= 0) {
-            mp_obj_t above_point[] = {
-                tuple_items[0],
-                MP_OBJ_NEW_SMALL_INT(mp_obj_int_get_checked(tuple_items[1]) - 1)
-            };
-            mp_obj_list_append(
-                fill_area,
-                mp_obj_new_tuple(2, above_point));
+// After spans were dropped, restart from every pixel still to be replaced that
+// touches the filled area.
+STATIC void fill_reseed(fill_state_t *state) {
+    displayio_bitmap_t *bitmap = state->bitmap;
+    const displayio_area_t *filled = &state->filled;
+    int16_t y1 = MAX(0, filled->y1 - 1);
+    int16_t y2 = MIN(bitmap->height, filled->y2 + 1);
+    int16_t x1 = MAX(0, filled->x1 - 1);
+    int16_t x2 = MIN(bitmap->width, filled->x2 + 1);
+    state->dropped = false;
+    for (int16_t y = y1; y < y2; y++) {
+        for (int16_t x = x1; x < x2; x++) {
+            if (!fill_inside(state, x, y)) {
+                continue;
+            }
+            uint32_t fill = state->fill_color_value;
+            if ((x > 0 && common_hal_displayio_bitmap_get_pixel(bitmap, x - 1, y) == fill) ||
+                (x + 1 < bitmap->width && common_hal_displayio_bitmap_get_pixel(bitmap, x + 1, y) == fill) ||
+                (y > 0 && common_hal_displayio_bitmap_get_pixel(bitmap, x, y - 1) == fill) ||
+                (y + 1 < bitmap->height && common_hal_displayio_bitmap_get_pixel(bitmap, x, y + 1) == fill)) {
+                fill_push(state, x, x, y, 1);
+                fill_push(state, x, x, y - 1, -1);
+            }
         }
+    }
+}
 
-        // ignore points outside of the bitmap
-        if (mp_obj_int_get_checked(tuple_items[0]) - 1 >= 0) {
-            mp_obj_t left_point[] = {
-                MP_OBJ_NEW_SMALL_INT(mp_obj_int_get_checked(tuple_items[0]) - 1),
-                tuple_items[1]
-            };
-            mp_obj_list_append(
-                fill_area,
-                mp_obj_new_tuple(2, left_point));
-        }
+void common_hal_bitmaptools_boundary_fill(displayio_bitmap_t *destination,
+    int16_t x, int16_t y,
+    uint32_t fill_color_value, uint32_t replaced_color_value) {
 
-        // ignore points outside of the bitmap
-        if (mp_obj_int_get_checked(tuple_items[0]) + 1 < destination->width) {
-            mp_obj_t right_point[] = {
-                MP_OBJ_NEW_SMALL_INT(mp_obj_int_get_checked(tuple_items[0]) + 1),
-                tuple_items[1]
-            };
-            mp_obj_list_append(
-                fill_area,
-                mp_obj_new_tuple(2, right_point));
-        }
+    if (replaced_color_value == INT_MAX) {
+        replaced_color_value = common_hal_displayio_bitmap_get_pixel(destination, x, y);
+    }
 
-        // ignore points outside of the bitmap
-        if (mp_obj_int_get_checked(tuple_items[1]) + 1 < destination->height) {
-            mp_obj_t below_point[] = {
-                tuple_items[0],
-                MP_OBJ_NEW_SMALL_INT(mp_obj_int_get_checked(tuple_items[1]) + 1)
-            };
-            mp_obj_list_append(
-                fill_area,
-                mp_obj_new_tuple(2, below_point));
-        }
+    if (fill_color_value == replaced_color_value) {
+        // There is nothing to do
+        return;
+    }
 
-        mp_obj_list_get(fill_area, &list_length, &fill_points);
-        RUN_BACKGROUND_TASKS;
-        if (mp_hal_is_interrupted()) {
-            return;
-        }
+    fill_span_t stack_spans[FILL_STACK_SPANS];
+    fill_state_t state = {
+        .bitmap = destination,
+        .fill_color_value = fill_color_value,
+        .replaced_color_value = replaced_color_value,
+        .spans = stack_spans,
+        .cap = FILL_STACK_SPANS,
+        .filled = { x, y, x, y, NULL },
+    };
+
+    // first point is the one user passed in
+    fill_push(&state, x, x, y, 1);
+    fill_push(&state, x, x, y - 1, -1);
+
+    while (fill_spans(&state) && state.dropped) {
+        fill_reseed(&state);
     }
 
-    // set dirty the area so displayio will draw
-    displayio_area_t area = { minx, miny, maxx + 1, maxy + 1, NULL};
-    displayio_bitmap_set_dirty_area(destination, &area);
+    if (state.scratch != NULL) {
+        m_del(fill_span_t, state.scratch, FILL_SCRATCH_SPANS);
+    }
 
+    // set dirty the area so displayio will draw
+    if (state.filled.x2 > state.filled.x1) {
+        displayio_bitmap_set_dirty_area(destination, &state.filled);
+    }
 }
 
 STATIC void draw_line(displayio_bitmap_t *destination,
@@ -578,6 +665,70 @@ void common_hal_bitmaptools_arrayblit(displayio_bitmap_t *self, void *data, int
     displayio_bitmap_set_dirty_area(self, &area);
 }
 
+#if MP_ENDIANNESS_LITTLE
+// Reverses the order of the pixels in each byte of word.
+STATIC uint32_t reverse_pixels_in_bytes(uint32_t word, int bits_per_pixel) {
+    word = ((word >> 4) & 0x0f0f0f0f) | ((word & 0x0f0f0f0f) << 4);
+    if (bits_per_pixel < 4) {
+        word = ((word >> 2) & 0x33333333) | ((word & 0x33333333) << 2);
+    }
+    if (bits_per_pixel < 2) {
+        word = ((word >> 1) & 0x55555555) | ((word & 0x55555555) << 1);
+    }
+    return word;
+}
+
+// Reads file data with as many bits per pixel as the bitmap straight into its
+// storage, a whole row or the whole bitmap at a time, and then rearranges it in
+// place a word at a time. The bitmap keeps its first pixel in the most
+// significant bits of a word, so rows of small pixels are byte swapped.
+STATIC void readinto_direct(displayio_bitmap_t *self, mp_obj_t *file, size_t rowsize, int element_size, int bits_per_pixel, bool reverse_pixels_in_element, bool swap_bytes, bool reverse_rows) {
+    bool swap_halves = swap_bytes && element_size == 2;
+    bool swap_words = (swap_bytes && element_size == 4) != (bits_per_pixel < 8);
+    bool reverse_pixels = bits_per_pixel < 8 && !reverse_pixels_in_element;
+    size_t row_words = self->stride;
+
+    // Rows of the file are rows of the bitmap when they fill whole words.
+    size_t rows_per_read = 1;
+    if (!reverse_rows && rowsize == row_words * sizeof(uint32_t)) {
+        rows_per_read = self->height;
+    }
+
+    for (int y = 0; y < self->height; y += rows_per_read) {
+        const int y_draw = reverse_rows ? (self->height) - 1 - y : y;
+        uint32_t *data = self->data + y_draw * row_words;
+
+        int error = 0;
+        size_t size = rows_per_read == 1 ? rowsize : rowsize * rows_per_read;
+        mp_uint_t bytes_read = mp_stream_read_exactly(file, data, size, &error);
+        if (error) {
+            mp_raise_OSError(error);
+        }
+        if (bytes_read != size) {
+            mp_raise_msg(&mp_type_EOFError, NULL);
+        }
+
+        if (!swap_halves && !swap_words && !reverse_pixels) {
+            continue;
+        }
+        size_t words = (size + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+        for (size_t i = 0; i < words; i++) {
+            uint32_t word = data[i];
+            if (swap_halves) {
+                word = ((word >> 8) & 0x00ff00ff) | ((word & 0x00ff00ff) << 8);
+            }
+            if (swap_words) {
+                word = __builtin_bswap32(word);
+            }
+            if (reverse_pixels) {
+                word = reverse_pixels_in_bytes(word, bits_per_pixel);
+            }
+            data[i] = word;
+        }
+    }
+}
+#endif
+
 void common_hal_bitmaptools_readinto(displayio_bitmap_t *self, mp_obj_t *file, int element_size, int bits_per_pixel, bool reverse_pixels_in_element, bool swap_bytes, bool reverse_rows) {
     uint32_t mask = (1 << common_hal_displayio_bitmap_get_bits_per_value(self)) - 1;
 
@@ -588,6 +739,17 @@ void common_hal_bitmaptools_readinto(displayio_bitmap_t *self, mp_obj_t *file, i
 
     size_t elements_per_row = (self->width * bits_per_pixel + element_size * 8 - 1) / (element_size * 8);
     size_t rowsize = element_size * elements_per_row;
+
+    #if MP_ENDIANNESS_LITTLE
+    if (bits_per_pixel == (int)common_hal_displayio_bitmap_get_bits_per_value(self)) {
+        if (self->read_only) {
+            mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
+        }
+        readinto_direct(self, file, rowsize, element_size, bits_per_pixel, reverse_pixels_in_element, swap_bytes, reverse_rows);
+        return;
+    }
+    #endif
+
     size_t rowsize_in_u32 = (rowsize + sizeof(uint32_t) - 1) / sizeof(uint32_t);
     size_t rowsize_in_u16 = (rowsize + sizeof(uint16_t) - 1) / sizeof(uint16_t);
 
@@ -668,59 +830,14 @@ void common_hal_bitmaptools_readinto(displayio_bitmap_t *self, mp_obj_t *file, i
     }
 }
 
-typedef struct {
-    uint8_t count; // The number of items in terms[]
-    uint8_t mx; // the maximum of the absolute value of the dx values
-    uint8_t dl; // the scaled dither value applied to the pixel at distance [1,0]
-    struct { // dl is the scaled dither values applied to the pixel at [dx,dy]
-        int8_t dx, dy, dl;
-    } terms[];
-} bitmaptools_dither_algorithm_info_t;
-
-static bitmaptools_dither_algorithm_info_t atkinson = {
-    4, 2, 256 / 8, {
-        {2, 0, 256 / 8},
-        {-1, 1, 256 / 8},
-        {0, 1, 256 / 8},
-        {0, 2, 256 / 8},
-    }
-};
-
-static bitmaptools_dither_algorithm_info_t floyd_stenberg = {
-    3, 1, 7 * 256 / 16,
-    {
-        {-1, 1, 3 * 256 / 16},
-        {0, 1, 5 * 256 / 16},
-        {1, 1, 1 * 256 / 16},
-    }
-};
-
-bitmaptools_dither_algorithm_info_t *algorithms[] = {
-    [DITHER_ALGORITHM_ATKINSON] = &atkinson,
-    [DITHER_ALGORITHM_FLOYD_STENBERG] = &floyd_stenberg,
-};
-
 enum {
     SWAP_BYTES = 1 << 0,
     SWAP_RB = 1 << 1,
 };
 
-STATIC void fill_row(displayio_bitmap_t *bitmap, int swap, int16_t *luminance_data, int y, int mx) {
-    if (y >= bitmap->height) {
-        return;
-    }
-
-    // zero out padding area
-    for (int i = 0; i < mx; i++) {
-        luminance_data[-mx + i] = 0;
-        luminance_data[bitmap->width + i] = 0;
-    }
-
+STATIC void fill_row(displayio_bitmap_t *bitmap, int swap, uint8_t *luminance_data, int y) {
     if (bitmap->bits_per_value == 8) {
-        uint8_t *pixel_data = (uint8_t *)(bitmap->data + bitmap->stride * y);
-        for (int x = 0; x < bitmap->width; x++) {
-            *luminance_data++ = *pixel_data++;
-        }
+        memcpy(luminance_data, bitmap->data + bitmap->stride * y, bitmap->width);
     } else {
         uint16_t *pixel_data = (uint16_t *)(bitmap->data + bitmap->stride * y);
         for (int x = 0; x < bitmap->width; x++) {
@@ -750,23 +867,19 @@ STATIC void fill_row(displayio_bitmap_t *bitmap, int swap, int16_t *luminance_da
     }
 }
 
-static void write_pixels(displayio_bitmap_t *bitmap, int y, bool *data) {
+// data holds the row as packed bits, most significant first, padded to whole
+// 32-bit words.
+STATIC void write_pixels(displayio_bitmap_t *bitmap, int y, const uint8_t *data) {
     if (bitmap->bits_per_value == 1) {
         uint32_t *pixel_data = (uint32_t *)(bitmap->data + bitmap->stride * y);
-        for (int i = 0; i < bitmap->width; i++) {
-            uint32_t p = 0;
-            for (int j = 0; j < 32; j++) {
-                p = (p << 1);
-                if (*data++) {
-                    p |= 1;
-                }
-            }
-            *pixel_data++ = p;
+        for (int i = 0; i < bitmap->width; i += 32) {
+            *pixel_data++ = (uint32_t)data[0] << 24 | data[1] << 16 | data[2] << 8 | data[3];
+            data += 4;
         }
     } else {
         uint16_t *pixel_data = (uint16_t *)(bitmap->data + bitmap->stride * y);
         for (int i = 0; i < bitmap->width; i++) {
-            *pixel_data++ = *data++ ? 65535 : 0;
+            *pixel_data++ = (data[i >> 3] & (0x80 >> (i & 7))) ? 65535 : 0;
         }
     }
 }
@@ -782,214 +895,268 @@ void common_hal_bitmaptools_dither(displayio_bitmap_t *dest_bitmap, displayio_bi
         swap |= SWAP_RB;
     }
 
-    bitmaptools_dither_algorithm_info_t *info = algorithms[algorithm];
-    // rowdata holds 3 rows of data.  Each one is larger than the input
-    // bitmap's width, because `mx` extra pixels are allocated at the start and
-    // end of the row so that no conditionals are needed when storing the error data.
-    int16_t rowdata[(width + 2 * info->mx) * 3];
-    int16_t *rows[3] = {
-        rowdata + info->mx, rowdata + width + info->mx * 3, rowdata + 2 * width + info->mx * 5
-    };
-    // out holds one output row of pixels, and is padded to be a multiple of 32 so that the 1bpp storage loop can be simplified
-    bool out[(width + 31) / 32 * 32];
-
-    fill_row(source_bitmap, swap, rows[0], 0, info->mx);
-    fill_row(source_bitmap, swap, rows[1], 1, info->mx);
-    fill_row(source_bitmap, swap, rows[2], 2, info->mx);
+    displayio_dither_kernel_t kernel = DISPLAYIO_DITHER_ATKINSON;
+    if (algorithm == DITHER_ALGORITHM_FLOYD_STENBERG) {
+        kernel = DISPLAYIO_DITHER_FLOYD_STEINBERG;
+    } else if (algorithm == DITHER_ALGORITHM_ORDERED) {
+        kernel = DISPLAYIO_DITHER_ORDERED;
+    }
 
-    int16_t err = 0;
+    // One row of luminance in, one row of bits out (padded to a multiple of 32
+    // pixels so whole words can be stored), and the error carried between rows.
+    uint8_t luminance[width];
+    uint8_t out[(width + 31) / 32 * 4];
+    int16_t error[DISPLAYIO_DITHER_ERROR_LENGTH(width)];
+    displayio_dither_t dither;
+    displayio_dither_init(&dither, kernel, width, error);
+    memset(out, 0, sizeof(out));
 
     for (int y = 0; y < height; y++) {
+        fill_row(source_bitmap, swap, luminance, y);
+        displayio_dither_row(&dither, luminance, 0, y, out, false);
+        write_pixels(dest_bitmap, y, out);
+    }
 
-        // Serpentine dither.  Going left-to-right...
-        for (int x = 0; x < width; x++) {
-            int32_t pixel_in = rows[0][x] + err;
-            bool pixel_out = pixel_in >= 128;
-            out[x] = pixel_out;
+    displayio_area_t a = { 0, 0, width, height, NULL };
+    displayio_bitmap_set_dirty_area(dest_bitmap, &a);
+}
 
-            err = pixel_in - (pixel_out ? 255 : 0);
+// Blend weights, out of 256, for one pair of source alphas.
+typedef struct {
+    // Multipliers of source 1 and 2 for a normal blend; they sum to 256 (or 0).
+    int16_t weight1;
+    int16_t weight2;
+    // The source alphas and the alpha of their composite, for the other cases.
+    int16_t factor1;
+    int16_t factor2;
+    int16_t factor_blend;
+} alphablend_weights_t;
 
-            for (int i = 0; i < info->count; i++) {
-                int x1 = x + info->terms[i].dx;
-                int dy = info->terms[i].dy;
+typedef struct {
+    bitmaptools_blendmode_t blendmode;
+    uint32_t skip_source1_index;
+    uint32_t skip_source2_index;
+    bool skip_source1_index_none;
+    bool skip_source2_index_none;
+    bool swap;
+    // One entry per alpha mask value, or a single one without a mask.
+    const alphablend_weights_t *weights;
+} alphablend_t;
+
+STATIC void alphablend_weights(alphablend_weights_t *w, int ifactor1, int ifactor2) {
+    // Blend based on the SVG alpha compositing specs
+    // https://dev.w3.org/SVG/modules/compositing/master/#alphaCompositing
+    // Normal (src-over) is Sca + Dca × (1 - Sa), which divided by the result
+    // alpha is a fixed mix of the two sources, so the division is done here once.
+    int ifactor_blend = ifactor1 + ifactor2 - ifactor1 * ifactor2 / 256;
+    w->factor1 = ifactor1;
+    w->factor2 = ifactor2;
+    w->factor_blend = ifactor_blend;
+    if (ifactor_blend == 0) {
+        w->weight1 = w->weight2 = 0;
+    } else {
+        w->weight2 = (ifactor2 * 256 + ifactor_blend / 2) / ifactor_blend;
+        w->weight1 = 256 - w->weight2;
+    }
+}
 
-                rows[dy][x1] = ((info->terms[i].dl * err) / 256) + rows[dy][x1];
-            }
-            err = (err * info->dl) / 256;
-        }
-        write_pixels(dest_bitmap, y, out);
+// Mix two RGB565 pixels with weights out of 256 that sum to at most 256. Red and
+// blue share one 32-bit multiply, red moved up far enough that they cannot carry
+// into each other; green takes a second one.
+static inline uint32_t rgb565_mix(uint32_t spix1, int weight1, uint32_t spix2, int weight2) {
+    uint32_t rb1 = ((spix1 & 0xf800) << 5) | (spix1 & 0x001f);
+    uint32_t rb2 = ((spix2 & 0xf800) << 5) | (spix2 & 0x001f);
+    uint32_t rb = (rb1 * weight1 + rb2 * weight2 + 0x00800080) >> 8;
+    uint32_t g = ((spix1 & 0x07e0) * weight1 + (spix2 & 0x07e0) * weight2 + (0x80 << 5)) >> 8;
+    return ((rb >> 5) & 0xf800) | (g & 0x07e0) | (rb & 0x001f);
+}
 
-        // Cycle the rows by shuffling pointers, this is faster than copying the data.
-        int16_t *tmp = rows[0];
-        rows[0] = rows[1];
-        rows[1] = rows[2];
-        rows[2] = tmp;
+STATIC uint32_t rgb565_screen(uint32_t spix1, uint32_t spix2, const alphablend_weights_t *w) {
+    const int r_mask = 0xf800; // (or b mask, if BGR)
+    const int g_mask = 0x07e0;
+    const int b_mask = 0x001f; // (or r mask, if BGR)
 
-        y++;
-        if (y == height) {
-            break;
-        }
+    if (w->factor_blend == 0) {
+        return 0;
+    }
+
+    // Premultiply the colors by the alpha factor
+    int red_dca = ((spix1 & r_mask) >> 8) * w->factor1;
+    int grn_dca = ((spix1 & g_mask) >> 3) * w->factor1;
+    int blu_dca = ((spix1 & b_mask) << 3) * w->factor1;
 
-        fill_row(source_bitmap, swap, rows[2], y + 2, info->mx);
+    int red_sca = ((spix2 & r_mask) >> 8) * w->factor2;
+    int grn_sca = ((spix2 & g_mask) >> 3) * w->factor2;
+    int blu_sca = ((spix2 & b_mask) << 3) * w->factor2;
 
-        // Serpentine dither.   Going right-to-left...
-        for (int x = width; x--;) {
-            int16_t pixel_in = rows[0][x] + err;
-            bool pixel_out = pixel_in >= 128;
-            out[x] = pixel_out;
-            err = pixel_in - (pixel_out ? 255 : 0);
+    // Perform a screen blend Sca + Dca - Sca × Dca
+    int red_blend = red_sca + red_dca - (red_sca * red_dca / 65536);
+    int grn_blend = grn_sca + grn_dca - (grn_sca * grn_dca / 65536);
+    int blu_blend = blu_sca + blu_dca - (blu_sca * blu_dca / 65536);
 
-            for (int i = 0; i < info->count; i++) {
-                int x1 = x - info->terms[i].dx;
-                int dy = info->terms[i].dy;
+    // Divide by the alpha factor
+    int r = ((red_blend / w->factor_blend) << 8) & r_mask;
+    int g = ((grn_blend / w->factor_blend) << 3) & g_mask;
+    int b = ((blu_blend / w->factor_blend) >> 3) & b_mask;
 
-                rows[dy][x1] = ((info->terms[i].dl * err) / 256) + rows[dy][x1];
+    return r | g | b;
+}
+
+STATIC void alphablend_row_l8(const alphablend_t *blend, uint8_t *dptr, const uint8_t *sptr1, const uint8_t *sptr2,
+    const uint8_t *mask, int width) {
+    const alphablend_weights_t *w = blend->weights;
+    for (int x = 0; x < width; x++) {
+        if (mask) {
+            w = &blend->weights[mask[x]];
+        }
+        int spix1 = sptr1[x];
+        int spix2 = sptr2[x];
+        bool blend_source1 = blend->skip_source1_index_none || spix1 != (uint8_t)blend->skip_source1_index;
+        bool blend_source2 = blend->skip_source2_index_none || spix2 != (uint8_t)blend->skip_source2_index;
+        int pixel;
+        if (blend_source1 && blend_source2) {
+            if (blend->blendmode == BITMAPTOOLS_BLENDMODE_SCREEN) {
+                // Premultiply by the alpha factor
+                int sda = spix1 * w->factor1;
+                int sca = spix2 * w->factor2;
+                int screen = sca + sda - (sca * sda / 65536);
+                // Divide by the alpha factor
+                pixel = w->factor_blend ? screen / w->factor_blend : 0;
+            } else {
+                pixel = (spix1 * w->weight1 + spix2 * w->weight2 + 128) >> 8;
             }
-            err = (err * info->dl) / 256;
+        } else if (blend_source1) {
+            // Apply iFactor1 to source1 only
+            pixel = (spix1 * w->factor1 + 128) >> 8;
+        } else if (blend_source2) {
+            // Apply iFactor2 to source2 only
+            pixel = (spix2 * w->factor2 + 128) >> 8;
+        } else {
+            // Use the destination value
+            pixel = dptr[x];
         }
-        write_pixels(dest_bitmap, y, out);
+        dptr[x] = MIN(255, pixel);
+    }
+}
 
-        tmp = rows[0];
-        rows[0] = rows[1];
-        rows[1] = rows[2];
-        rows[2] = tmp;
+STATIC void alphablend_row_rgb565(const alphablend_t *blend, uint16_t *dptr, const uint16_t *sptr1, const uint16_t *sptr2,
+    const uint8_t *mask, int width) {
+    const alphablend_weights_t *w = blend->weights;
+    bool swap = blend->swap;
 
-        fill_row(source_bitmap, swap, rows[2], y + 3, info->mx);
+    if (!mask && blend->skip_source1_index_none && blend->skip_source2_index_none &&
+        blend->blendmode == BITMAPTOOLS_BLENDMODE_NORMAL) {
+        // The usual cross-fade: the same mix for every pixel.
+        int weight1 = w->weight1;
+        int weight2 = w->weight2;
+        for (int x = 0; x < width; x++) {
+            uint32_t spix1 = sptr1[x];
+            uint32_t spix2 = sptr2[x];
+            if (swap) {
+                spix1 = __builtin_bswap16(spix1);
+                spix2 = __builtin_bswap16(spix2);
+            }
+            uint32_t pixel = rgb565_mix(spix1, weight1, spix2, weight2);
+            dptr[x] = swap ? __builtin_bswap16(pixel) : pixel;
+        }
+        return;
     }
 
-    displayio_area_t a = { 0, 0, width, height, NULL };
-    displayio_bitmap_set_dirty_area(dest_bitmap, &a);
-}
+    for (int x = 0; x < width; x++) {
+        if (mask) {
+            w = &blend->weights[mask[x]];
+        }
+        uint32_t spix1 = sptr1[x];
+        uint32_t spix2 = sptr2[x];
 
-void common_hal_bitmaptools_alphablend(displayio_bitmap_t *dest, displayio_bitmap_t *source1, displayio_bitmap_t *source2, displayio_colorspace_t colorspace, mp_float_t factor1, mp_float_t factor2,
-    bitmaptools_blendmode_t blendmode, uint32_t skip_source1_index, bool skip_source1_index_none, uint32_t skip_source2_index, bool skip_source2_index_none) {
-    displayio_area_t a = {0, 0, dest->width, dest->height, NULL};
-    displayio_bitmap_set_dirty_area(dest, &a);
+        // The skip indices are values as stored in the bitmaps.
+        bool blend_source1 = blend->skip_source1_index_none || spix1 != blend->skip_source1_index;
+        bool blend_source2 = blend->skip_source2_index_none || spix2 != blend->skip_source2_index;
 
-    int ifactor1 = (int)(factor1 * 256);
-    int ifactor2 = (int)(factor2 * 256);
-    bool blend_source1, blend_source2;
+        if (swap) {
+            spix1 = __builtin_bswap16(spix1);
+            spix2 = __builtin_bswap16(spix2);
+        }
 
-    if (colorspace == DISPLAYIO_COLORSPACE_L8) {
-        for (int y = 0; y < dest->height; y++) {
-            uint8_t *dptr = (uint8_t *)(dest->data + y * dest->stride);
-            uint8_t *sptr1 = (uint8_t *)(source1->data + y * source1->stride);
-            uint8_t *sptr2 = (uint8_t *)(source2->data + y * source2->stride);
-            int pixel;
-            for (int x = 0; x < dest->width; x++) {
-                blend_source1 = skip_source1_index_none || *sptr1 != (uint8_t)skip_source1_index;
-                blend_source2 = skip_source2_index_none || *sptr2 != (uint8_t)skip_source2_index;
-                if (blend_source1 && blend_source2) {
-                    // Premultiply by the alpha factor
-                    int sda = *sptr1++ *ifactor1;
-                    int sca = *sptr2++ *ifactor2;
-                    // Blend
-                    int blend;
-                    if (blendmode == BITMAPTOOLS_BLENDMODE_SCREEN) {
-                        blend = sca + sda - (sca * sda / 65536);
-                    } else {
-                        blend = sca + sda * (256 - ifactor2) / 256;
-                    }
-                    // Divide by the alpha factor
-                    pixel = (blend / (ifactor1 + ifactor2 - ifactor1 * ifactor2 / 256));
-                } else if (blend_source1) {
-                    // Apply iFactor1 to source1 only
-                    pixel = *sptr1++ *ifactor1 / 256;
-                } else if (blend_source2) {
-                    // Apply iFactor2 to source1 only
-                    pixel = *sptr2++ *ifactor2 / 256;
-                } else {
-                    // Use the destination value
-                    pixel = *dptr;
-                }
-                *dptr++ = MIN(255, MAX(0, pixel));
+        uint32_t pixel;
+        if (blend_source1 && blend_source2) {
+            if (blend->blendmode == BITMAPTOOLS_BLENDMODE_SCREEN) {
+                pixel = rgb565_screen(spix1, spix2, w);
+            } else {
+                pixel = rgb565_mix(spix1, w->weight1, spix2, w->weight2);
             }
+        } else if (blend_source1) {
+            // Apply iFactor1 to source1 only
+            pixel = rgb565_mix(spix1, w->factor1, 0, 0);
+        } else if (blend_source2) {
+            // Apply iFactor2 to source2 only
+            pixel = rgb565_mix(0, 0, spix2, w->factor2);
+        } else {
+            // Use the destination value
+            continue;
         }
-    } else {
-        bool swap = (colorspace == DISPLAYIO_COLORSPACE_RGB565_SWAPPED) || (colorspace == DISPLAYIO_COLORSPACE_BGR565_SWAPPED);
-        uint16_t pixel;
-        for (int y = 0; y < dest->height; y++) {
-            uint16_t *dptr = (uint16_t *)(dest->data + y * dest->stride);
-            uint16_t *sptr1 = (uint16_t *)(source1->data + y * source1->stride);
-            uint16_t *sptr2 = (uint16_t *)(source2->data + y * source2->stride);
-            for (int x = 0; x < dest->width; x++) {
-                int spix1 = *sptr1++;
-                int spix2 = *sptr2++;
 
-                if (swap) {
-                    spix1 = __builtin_bswap16(spix1);
-                    spix2 = __builtin_bswap16(spix2);
-                }
-                const int r_mask = 0xf800; // (or b mask, if BGR)
-                const int g_mask = 0x07e0;
-                const int b_mask = 0x001f; // (or r mask, if BGR)
-
-                blend_source1 = skip_source1_index_none || spix1 != (int)skip_source1_index;
-                blend_source2 = skip_source2_index_none || spix2 != (int)skip_source2_index;
-
-                if (blend_source1 && blend_source2) {
-                    // Blend based on the SVG alpha compositing specs
-                    // https://dev.w3.org/SVG/modules/compositing/master/#alphaCompositing
-
-                    int ifactor_blend = ifactor1 + ifactor2 - ifactor1 * ifactor2 / 256;
-
-                    // Premultiply the colors by the alpha factor
-                    int red_dca = ((spix1 & r_mask) >> 8) * ifactor1;
-                    int grn_dca = ((spix1 & g_mask) >> 3) * ifactor1;
-                    int blu_dca = ((spix1 & b_mask) << 3) * ifactor1;
-
-                    int red_sca = ((spix2 & r_mask) >> 8) * ifactor2;
-                    int grn_sca = ((spix2 & g_mask) >> 3) * ifactor2;
-                    int blu_sca = ((spix2 & b_mask) << 3) * ifactor2;
-
-                    int red_blend, grn_blend, blu_blend;
-                    if (blendmode == BITMAPTOOLS_BLENDMODE_SCREEN) {
-                        // Perform a screen blend Sca + Dca - Sca × Dca
-                        red_blend = red_sca + red_dca - (red_sca * red_dca / 65536);
-                        grn_blend = grn_sca + grn_dca - (grn_sca * grn_dca / 65536);
-                        blu_blend = blu_sca + blu_dca - (blu_sca * blu_dca / 65536);
-                    } else {
-                        // Perform a normal (src-over) blend
-                        red_blend = red_sca + red_dca * (256 - ifactor2) / 256;
-                        grn_blend = grn_sca + grn_dca * (256 - ifactor2) / 256;
-                        blu_blend = blu_sca + blu_dca * (256 - ifactor2) / 256;
-                    }
+        dptr[x] = swap ? __builtin_bswap16(pixel) : pixel;
+    }
+}
 
-                    // Divide by the alpha factor
-                    int r = ((red_blend / ifactor_blend) << 8) & r_mask;
-                    int g = ((grn_blend / ifactor_blend) << 3) & g_mask;
-                    int b = ((blu_blend / ifactor_blend) >> 3) & b_mask;
+void common_hal_bitmaptools_alphablend(displayio_bitmap_t *dest, displayio_bitmap_t *source1, displayio_bitmap_t *source2, displayio_colorspace_t colorspace, mp_float_t factor1, mp_float_t factor2,
+    bitmaptools_blendmode_t blendmode, uint32_t skip_source1_index, bool skip_source1_index_none, uint32_t skip_source2_index, bool skip_source2_index_none,
+    displayio_bitmap_t *alpha_mask) {
+    displayio_area_t a = {0, 0, dest->width, dest->height, NULL};
+    displayio_bitmap_set_dirty_area(dest, &a);
 
-                    // Clamp to the appropriate range
-                    r = MIN(r_mask, MAX(0, r)) & r_mask;
-                    g = MIN(g_mask, MAX(0, g)) & g_mask;
-                    b = MIN(b_mask, MAX(0, b)) & b_mask;
+    int ifactor1 = MIN(256, MAX(0, (int)(factor1 * 256)));
+    int ifactor2 = MIN(256, MAX(0, (int)(factor2 * 256)));
 
-                    pixel = r | g | b;
+    alphablend_t blend = {
+        .blendmode = blendmode,
+        .skip_source1_index = skip_source1_index,
+        .skip_source2_index = skip_source2_index,
+        .skip_source1_index_none = skip_source1_index_none,
+        .skip_source2_index_none = skip_source2_index_none,
+        .swap = (colorspace == DISPLAYIO_COLORSPACE_RGB565_SWAPPED) || (colorspace == DISPLAYIO_COLORSPACE_BGR565_SWAPPED),
+    };
 
-                    if (swap) {
-                        pixel = __builtin_bswap16(pixel);
-                    }
-                } else if (blend_source1) {
-                    // Apply iFactor1 to source1 only
-                    int r = (spix1 & r_mask) * ifactor1 / 256;
-                    int g = (spix1 & g_mask) * ifactor1 / 256;
-                    int b = (spix1 & b_mask) * ifactor1 / 256;
-                    pixel = r | g | b;
-                } else if (blend_source2) {
-                    // Apply iFactor2 to source1 only
-                    int r = (spix2 & r_mask) * ifactor2 / 256;
-                    int g = (spix2 & g_mask) * ifactor2 / 256;
-                    int b = (spix2 & b_mask) * ifactor2 / 256;
-                    pixel = r | g | b;
-                } else {
-                    // Use the destination value
-                    pixel = *dptr;
-                }
+    alphablend_weights_t weights;
+    alphablend_weights_t *mask_weights = NULL;
+    uint8_t *mask_row = NULL;
+    size_t mask_values = 0;
+    if (alpha_mask) {
+        // factor2 is scaled by the mask, so precompute the weights for every mask
+        // value and read the mask a row at a time.
+        mask_values = 1 << alpha_mask->bits_per_value;
+        mask_weights = m_new(alphablend_weights_t, mask_values);
+        mask_row = m_new(uint8_t, dest->width);
+        for (size_t i = 0; i < mask_values; i++) {
+            alphablend_weights(&mask_weights[i], ifactor1, ifactor2 * i / (mask_values - 1));
+        }
+        blend.weights = mask_weights;
+    } else {
+        alphablend_weights(&weights, ifactor1, ifactor2);
+        blend.weights = &weights;
+    }
 
-                *dptr++ = pixel;
+    for (int y = 0; y < dest->height; y++) {
+        if (alpha_mask) {
+            for (int x = 0; x < dest->width; x++) {
+                mask_row[x] = common_hal_displayio_bitmap_get_pixel(alpha_mask, x, y);
             }
         }
+        if (colorspace == DISPLAYIO_COLORSPACE_L8) {
+            alphablend_row_l8(&blend, (uint8_t *)(dest->data + y * dest->stride),
+                (uint8_t *)(source1->data + y * source1->stride),
+                (uint8_t *)(source2->data + y * source2->stride), mask_row, dest->width);
+        } else {
+            alphablend_row_rgb565(&blend, (uint16_t *)(dest->data + y * dest->stride),
+                (uint16_t *)(source1->data + y * source1->stride),
+                (uint16_t *)(source2->data + y * source2->stride), mask_row, dest->width);
+        }
+    }
+
+    if (alpha_mask) {
+        m_del(alphablend_weights_t, mask_weights, mask_values);
+        m_del(uint8_t, mask_row, dest->width);
     }
 }
 
@@ -1079,45 +1246,70 @@ void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitm
     displayio_area_t a = { x, y, dirty_x_max, dirty_y_max, NULL};
     displayio_bitmap_set_dirty_area(destination, &a);
 
-    bool x_reverse = false;
-    bool y_reverse = false;
-
-    // Add reverse direction option to protect blitting of destination bitmap back into destination bitmap
-    if (x > x1) {
-        x_reverse = true;
-    }
-    if (y > y1) {
-        y_reverse = true;
+    // Only copy the part that lands within the destination.
+    int16_t clip_left = MAX(0, -x);
+    int16_t clip_top = MAX(0, -y);
+    int16_t width = MIN(x2 - x1, destination->width - x) - clip_left;
+    int16_t height = MIN(y2 - y1, destination->height - y) - clip_top;
+    if (width <= 0 || height <= 0) {
+        return;
     }
+    x1 += clip_left;
+    x += clip_left;
+    y1 += clip_top;
+    y += clip_top;
+
+    // Walk rows and columns away from the destination so that blitting a
+    // bitmap into itself reads each source pixel before it is overwritten.
+    const bool x_reverse = x > x1;
+    const bool y_reverse = y > y1;
+
+    // Whole rows can be moved when nothing is skipped and values match in size.
+    // Source pixels past the source's edge read as 0 so those need the slow way.
+    const bool move_rows = skip_source_index_none && skip_dest_index_none &&
+        source->bits_per_value == destination->bits_per_value && source->bits_per_value >= 8 &&
+        x1 + width <= source->width && y1 + height <= source->height;
+    const uint8_t bytes_per_value = source->bits_per_value / 8;
+
+    uint32_t values[32];
+    uint32_t dest_values[32];
+    for (int16_t j = 0; j < height; j++) {
+        const int16_t row = y_reverse ? height - j - 1 : j;
+        const int16_t ys_index = y1 + row;
+        const int16_t yd_index = y + row;
+
+        if (move_rows) {
+            // memmove copes with the source and destination overlapping in a row.
+            uint8_t *src = (uint8_t *)(source->data + ys_index * source->stride) + x1 * bytes_per_value;
+            uint8_t *dest = (uint8_t *)(destination->data + yd_index * destination->stride) + x * bytes_per_value;
+            memmove(dest, src, width * bytes_per_value);
+            continue;
+        }
 
-    // simplest version - use internal functions for get/set pixels
-    for (int16_t i = 0; i < (x2 - x1); i++) {
-
-        const int xs_index = x_reverse ? ((x2) - i - 1) : x1 + i; // x-index into the source bitmap
-        const int xd_index = x_reverse ? ((x + (x2 - x1)) - i - 1) : x + i; // x-index into the destination bitmap
-
-        if ((xd_index >= 0) && (xd_index < destination->width)) {
-            for (int16_t j = 0; j < (y2 - y1); j++) {
-
-                const int ys_index = y_reverse ? ((y2) - j - 1) : y1 + j;  // y-index into the source bitmap
-                const int yd_index = y_reverse ? ((y + (y2 - y1)) - j - 1) : y + j; // y-index into the destination bitmap
+        for (int16_t done = 0; done < width; ) {
+            const uint16_t count = MIN(width - done, (int16_t)MP_ARRAY_SIZE(values));
+            const int16_t offset = x_reverse ? width - done - count : done;
+            done += count;
 
-                if ((yd_index >= 0) && (yd_index < destination->height)) {
-                    uint32_t value = common_hal_displayio_bitmap_get_pixel(source, xs_index, ys_index);
-                    if (skip_dest_index_none) { // if skip_dest_index is none, then only check source skip
-                        if ((skip_source_index_none) || (value != skip_source_index)) {   // write if skip_value_none is True
-                            displayio_bitmap_write_pixel(destination, xd_index, yd_index, value);
-                        }
-                    } else { // check dest_value index against skip_dest_index and skip if they match
-                        uint32_t dest_value = common_hal_displayio_bitmap_get_pixel(destination, xd_index, yd_index);
-                        if (dest_value != skip_dest_index) {
-                            if ((skip_source_index_none) || (value != skip_source_index)) {   // write if skip_value_none is True
-                                displayio_bitmap_write_pixel(destination, xd_index, yd_index, value);
-                            }
-                        }
+            int16_t in_source = ys_index < source->height ? MIN(count, source->width - (x1 + offset)) : 0;
+            if (in_source > 0) {
+                displayio_bitmap_get_row_pixels(source, x1 + offset, ys_index, in_source, values);
+            } else {
+                in_source = 0;
+            }
+            for (uint16_t i = in_source; i < count; i++) {
+                values[i] = 0;
+            }
+            if (!skip_source_index_none || !skip_dest_index_none) {
+                displayio_bitmap_get_row_pixels(destination, x + offset, yd_index, count, dest_values);
+                for (uint16_t i = 0; i < count; i++) {
+                    if ((!skip_dest_index_none && dest_values[i] == skip_dest_index) ||
+                        (!skip_source_index_none && values[i] == skip_source_index)) {
+                        values[i] = dest_values[i];
                     }
                 }
             }
+            displayio_bitmap_set_row_pixels(destination, x + offset, yd_index, count, values);
         }
     }
 }
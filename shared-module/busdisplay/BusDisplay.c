@@ -26,6 +26,7 @@
 
 #include "shared-bindings/busdisplay/BusDisplay.h"
 
+#include "py/gc.h"
 #include "py/runtime.h"
 #if CIRCUITPY_FOURWIRE
 #include "shared-bindings/fourwire/FourWire.h"
@@ -40,6 +41,7 @@
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
 #include "shared-module/displayio/display_core.h"
+#include "supervisor/port_heap.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/tick.h"
 #include "supervisor/usb.h"
@@ -49,6 +51,21 @@
 
 #define DELAY 0x80
 
+// Approximate cost, in pixels, of the commands that set the update window for
+// each refresh area. Used to decide when to merge nearby areas.
+#define AREA_COMMAND_OVERHEAD (64)
+
+// MIPI DCS vertical scrolling commands
+#define VERTICAL_SCROLLING_DEFINITION (0x33)
+#define VERTICAL_SCROLLING_START_ADDRESS (0x37)
+
+STATIC void _release_area_buffer(busdisplay_busdisplay_obj_t *self) {
+    if (self->area_buffer != NULL) {
+        port_free_tagged(self->area_buffer, PORT_HEAP_TAG_DISPLAY);
+        self->area_buffer = NULL;
+    }
+}
+
 void common_hal_busdisplay_busdisplay_construct(busdisplay_busdisplay_obj_t *self,
     mp_obj_t bus, uint16_t width, uint16_t height, int16_t colstart, int16_t rowstart,
     uint16_t rotation, uint16_t color_depth, bool grayscale, bool pixels_in_byte_share_row,
@@ -80,6 +97,14 @@ void common_hal_busdisplay_busdisplay_construct(busdisplay_busdisplay_obj_t *sel
 
     self->native_frames_per_second = native_frames_per_second;
     self->native_ms_per_frame = 1000 / native_frames_per_second;
+    #if CIRCUITPY_BUSDISPLAY_REFRESH_SLICE_MS
+    self->pending_area = NULL;
+    #endif
+    common_hal_busdisplay_busdisplay_set_area_buffer_size(self, CIRCUITPY_BUSDISPLAY_AREA_BUFFER_SIZE);
+    self->scroll_tile_grid = NULL;
+    self->scroll_area.x1 = self->scroll_area.x2 = self->scroll_area.y1 = self->scroll_area.y2 = 0;
+    self->scroll_offset = 0;
+    self->scroll_memory_lines = 0;
 
     uint32_t i = 0;
     while (i < init_sequence_len) {
@@ -218,7 +243,8 @@ STATIC const displayio_area_t *_get_refresh_areas(busdisplay_busdisplay_obj_t *s
         self->core.area.next = NULL;
         return &self->core.area;
     } else if (self->core.current_group != NULL) {
-        return displayio_group_get_refresh_areas(self->core.current_group, NULL);
+        const displayio_area_t *first = displayio_group_get_refresh_areas(self->core.current_group, NULL);
+        return displayio_display_core_coalesce_areas(&self->core, first, AREA_COMMAND_OVERHEAD);
     }
     return NULL;
 }
@@ -230,8 +256,138 @@ STATIC void _send_pixels(busdisplay_busdisplay_obj_t *self, uint8_t *pixels, uin
     self->bus.send(self->bus.bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, pixels, length);
 }
 
-STATIC bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_area_t *area) {
-    uint16_t buffer_size = 128; // In uint32_ts
+STATIC void _send_command(busdisplay_busdisplay_obj_t *self, uint8_t command, const uint8_t *data, uint8_t length) {
+    displayio_display_bus_begin_transaction(&self->bus);
+    self->bus.send(self->bus.bus, DISPLAY_COMMAND, CHIP_SELECT_TOGGLE_EVERY_BYTE, &command, 1);
+    self->bus.send(self->bus.bus, DISPLAY_DATA, CHIP_SELECT_UNTOUCHED, data, length);
+    displayio_display_bus_end_transaction(&self->bus);
+}
+
+// Scroll the given rows, or all of memory when they are empty, starting
+// offset rows into them.
+STATIC void _define_vertical_scroll(busdisplay_busdisplay_obj_t *self, const displayio_area_t *rows, uint16_t offset) {
+    uint16_t fixed_top = 0;
+    uint16_t scrolled = self->scroll_memory_lines;
+    if (rows->y1 < rows->y2) {
+        fixed_top = rows->y1 + self->bus.rowstart;
+        scrolled = rows->y2 - rows->y1;
+    }
+    uint16_t fixed_bottom = self->scroll_memory_lines - fixed_top - scrolled;
+    uint8_t data[6] = {
+        fixed_top >> 8, fixed_top & 0xff,
+        scrolled >> 8, scrolled & 0xff,
+        fixed_bottom >> 8, fixed_bottom & 0xff
+    };
+    _send_command(self, VERTICAL_SCROLLING_DEFINITION, data, 6);
+    uint16_t start = fixed_top + offset;
+    data[0] = start >> 8;
+    data[1] = start & 0xff;
+    _send_command(self, VERTICAL_SCROLLING_START_ADDRESS, data, 2);
+}
+
+// Find the rows the panel can scroll for the scroll TileGrid. They are empty
+// when it can't follow the grid.
+STATIC void _get_scroll_rows(busdisplay_busdisplay_obj_t *self, displayio_area_t *rows) {
+    displayio_tilegrid_t *grid = self->scroll_tile_grid;
+    rows->x1 = rows->x2 = rows->y1 = rows->y2 = 0;
+    if (grid == NULL || grid->absolute_transform == NULL || !grid->in_group ||
+        grid->hidden || grid->hidden_by_parent ||
+        grid->transpose_xy || grid->absolute_transform->transpose_xy || grid->absolute_transform->scale != 1) {
+        return;
+    }
+    // The panel scrolls whole rows so the grid must fill them.
+    displayio_area_t clipped;
+    if (!displayio_display_core_clip_area(&self->core, &grid->current_area, &clipped) ||
+        !displayio_area_equal(&clipped, &grid->current_area) ||
+        clipped.x1 != self->core.area.x1 || clipped.x2 != self->core.area.x2 ||
+        clipped.y2 + self->bus.rowstart > self->scroll_memory_lines) {
+        return;
+    }
+    displayio_area_copy(&clipped, rows);
+}
+
+// Move the panel's scroll start by however far the scroll TileGrid has
+// scrolled, before its newly exposed rows are drawn.
+STATIC void _update_vertical_scroll(busdisplay_busdisplay_obj_t *self) {
+    displayio_tilegrid_t *grid = self->scroll_tile_grid;
+    if (grid == NULL && self->scroll_memory_lines == 0) {
+        return;
+    }
+    displayio_area_t rows;
+    _get_scroll_rows(self, &rows);
+    uint16_t height = rows.y2 - rows.y1;
+    if (rows.y1 != self->scroll_area.y1 || rows.y2 != self->scroll_area.y2 || grid == NULL) {
+        if (self->scroll_offset != 0 || (grid != NULL && grid->scrolled_y != 0)) {
+            // What the panel shows no longer matches its memory layout.
+            self->core.full_refresh = true;
+        }
+        _define_vertical_scroll(self, &rows, 0);
+        displayio_area_copy(&rows, &self->scroll_area);
+        self->scroll_offset = 0;
+        if (grid == NULL) {
+            // Back to the panel's own layout, so nothing is left to restore.
+            self->scroll_memory_lines = 0;
+        }
+    } else if (height > 0 && grid->scrolled_y != 0) {
+        uint16_t moved = grid->scrolled_y % height;
+        // Rows run the other way in memory when the grid is drawn upside down.
+        if ((grid->absolute_transform->dy < 0) != grid->flip_y) {
+            moved = (height - moved) % height;
+        }
+        self->scroll_offset = (self->scroll_offset + moved) % height;
+        uint16_t start = rows.y1 + self->bus.rowstart + self->scroll_offset;
+        uint8_t data[2] = { start >> 8, start & 0xff };
+        _send_command(self, VERTICAL_SCROLLING_START_ADDRESS, data, 2);
+    } else if (height == 0 && grid->scrolled_y != 0) {
+        grid->full_change = true;
+    }
+    if (grid != NULL) {
+        grid->scrolled_y = 0;
+    }
+}
+
+// Set the update region and send the pixels of area. Rows in the scrolled
+// part of the panel are sent to where they currently sit in its memory,
+// which can split the area in two where the memory wraps.
+STATIC void _send_scrolled_area(busdisplay_busdisplay_obj_t *self, const displayio_area_t *area, uint8_t *pixels) {
+    uint32_t row_bytes = displayio_area_width(area) * (self->core.colorspace.depth / 8);
+    int16_t top = self->scroll_area.y1;
+    int16_t bottom = self->scroll_area.y2;
+    int16_t wrap = bottom - self->scroll_offset;
+    displayio_area_t part = *area;
+    while (part.y1 < area->y2) {
+        int16_t shift = 0;
+        part.y2 = area->y2;
+        if (part.y1 < top) {
+            part.y2 = MIN(part.y2, top);
+        } else if (part.y1 < wrap) {
+            part.y2 = MIN(part.y2, wrap);
+            shift = self->scroll_offset;
+        } else if (part.y1 < bottom) {
+            part.y2 = MIN(part.y2, bottom);
+            shift = self->scroll_offset - (bottom - top);
+        }
+        displayio_area_t in_memory = {
+            .x1 = part.x1,
+            .y1 = part.y1 + shift,
+            .x2 = part.x2,
+            .y2 = part.y2 + shift
+        };
+        displayio_display_bus_set_region_to_update(&self->bus, &self->core, &in_memory);
+        uint32_t length = displayio_area_height(&part) * row_bytes;
+        displayio_display_bus_begin_transaction(&self->bus);
+        _send_pixels(self, pixels, length);
+        displayio_display_bus_end_transaction(&self->bus);
+        pixels += length;
+        part.y1 = part.y2;
+    }
+}
+
+// Send the area starting from subrectangle *next. When deadline is non-zero,
+// stop once it has passed. Returns false, with the subrectangle to resume from
+// in *next, when stopped early or the bus is busy.
+STATIC bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_area_t *area, uint16_t *next, uint64_t deadline) {
+    uint16_t buffer_size = self->area_buffer_size; // In uint32_ts
 
     displayio_area_t clipped;
     // Clip the area to the display by overlapping the areas. If there is no overlap then we're done.
@@ -239,58 +395,74 @@ STATIC bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
         return true;
     }
     uint16_t rows_per_buffer = displayio_area_height(&clipped);
+    uint16_t columns_per_buffer = displayio_area_width(&clipped);
     uint8_t pixels_per_word = (sizeof(uint32_t) * 8) / self->core.colorspace.depth;
     uint16_t pixels_per_buffer = displayio_area_size(&clipped);
 
     uint16_t subrectangles = 1;
+    uint16_t subrectangles_per_row = 1;
     // for SH1107 and other boundary constrained controllers
     //      write one single row at a time
     if (self->bus.SH1107_addressing) {
         subrectangles = rows_per_buffer / 8;  // page addressing mode writes 8 rows at a time
         rows_per_buffer = 8;
+        pixels_per_buffer = rows_per_buffer * columns_per_buffer;
+        buffer_size = (pixels_per_buffer + pixels_per_word - 1) / pixels_per_word;
     } else if (displayio_area_size(&clipped) > buffer_size * pixels_per_word) {
+        // If pixels are packed by column then rows must stay on a byte boundary.
+        uint8_t min_rows = 1;
+        if (self->core.colorspace.depth < 8 && !self->core.colorspace.pixels_in_byte_share_row) {
+            min_rows = 8 / self->core.colorspace.depth;
+        }
         rows_per_buffer = buffer_size * pixels_per_word / displayio_area_width(&clipped);
+        rows_per_buffer -= rows_per_buffer % min_rows;
         if (rows_per_buffer == 0) {
-            rows_per_buffer = 1;
-        }
-        // If pixels are packed by column then ensure rows_per_buffer is on a byte boundary.
-        if (self->core.colorspace.depth < 8 && !self->core.colorspace.pixels_in_byte_share_row) {
-            uint8_t pixels_per_byte = 8 / self->core.colorspace.depth;
-            if (rows_per_buffer % pixels_per_byte != 0) {
-                rows_per_buffer -= rows_per_buffer % pixels_per_byte;
+            // Rows wider than the buffer are sent in pieces. The buffer holds a
+            // whole number of words, so pieces stay on byte boundaries.
+            rows_per_buffer = min_rows;
+            columns_per_buffer = buffer_size * pixels_per_word / rows_per_buffer;
+            subrectangles_per_row = displayio_area_width(&clipped) / columns_per_buffer;
+            if (displayio_area_width(&clipped) % columns_per_buffer != 0) {
+                subrectangles_per_row++;
             }
         }
         subrectangles = displayio_area_height(&clipped) / rows_per_buffer;
         if (displayio_area_height(&clipped) % rows_per_buffer != 0) {
             subrectangles++;
         }
-        pixels_per_buffer = rows_per_buffer * displayio_area_width(&clipped);
+        subrectangles *= subrectangles_per_row;
+        pixels_per_buffer = rows_per_buffer * columns_per_buffer;
         buffer_size = pixels_per_buffer / pixels_per_word;
         if (pixels_per_buffer % pixels_per_word) {
             buffer_size += 1;
         }
     }
 
-    // Allocated and shared as a uint32_t array so the compiler knows the
-    // alignment everywhere.
-    uint32_t buffer[buffer_size];
+    // Allocated as a uint32_t array so the compiler knows the alignment everywhere.
+    uint32_t *buffer = self->area_buffer;
+    self->area_buffer_in_use = true;
     uint32_t mask_length = (pixels_per_buffer / 32) + 1;
     uint32_t mask[mask_length];
-    uint16_t remaining_rows = displayio_area_height(&clipped);
 
-    for (uint16_t j = 0; j < subrectangles; j++) {
+    for (uint16_t j = *next; j < subrectangles; j++) {
+        if (deadline != 0 && j > *next && supervisor_ticks_ms64() >= deadline) {
+            *next = j;
+            self->area_buffer_in_use = false;
+            return false;
+        }
+        uint16_t row = j / subrectangles_per_row;
+        uint16_t column = j % subrectangles_per_row;
         displayio_area_t subrectangle = {
-            .x1 = clipped.x1,
-            .y1 = clipped.y1 + rows_per_buffer * j,
-            .x2 = clipped.x2,
-            .y2 = clipped.y1 + rows_per_buffer * (j + 1)
+            .x1 = clipped.x1 + columns_per_buffer * column,
+            .y1 = clipped.y1 + rows_per_buffer * row,
+            .x2 = MIN(clipped.x2, clipped.x1 + columns_per_buffer * (column + 1)),
+            .y2 = MIN(clipped.y2, clipped.y1 + rows_per_buffer * (row + 1))
         };
-        if (remaining_rows < rows_per_buffer) {
-            subrectangle.y2 = subrectangle.y1 + remaining_rows;
-        }
-        remaining_rows -= rows_per_buffer;
 
-        displayio_display_bus_set_region_to_update(&self->bus, &self->core, &subrectangle);
+        bool scrolled = self->scroll_offset != 0;
+        if (!scrolled) {
+            displayio_display_bus_set_region_to_update(&self->bus, &self->core, &subrectangle);
+        }
 
         uint16_t subrectangle_size_bytes;
         if (self->core.colorspace.depth >= 8) {
@@ -306,12 +478,18 @@ STATIC bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
 
         // Can't acquire display bus; skip the rest of the data.
         if (!displayio_display_bus_is_free(&self->bus)) {
+            *next = j;
+            self->area_buffer_in_use = false;
             return false;
         }
 
-        displayio_display_bus_begin_transaction(&self->bus);
-        _send_pixels(self, (uint8_t *)buffer, subrectangle_size_bytes);
-        displayio_display_bus_end_transaction(&self->bus);
+        if (scrolled) {
+            _send_scrolled_area(self, &subrectangle, (uint8_t *)buffer);
+        } else {
+            displayio_display_bus_begin_transaction(&self->bus);
+            _send_pixels(self, (uint8_t *)buffer, subrectangle_size_bytes);
+            displayio_display_bus_end_transaction(&self->bus);
+        }
 
         // TODO(tannewt): Make refresh displays faster so we don't starve other
         // background tasks.
@@ -319,23 +497,61 @@ STATIC bool _refresh_area(busdisplay_busdisplay_obj_t *self, const displayio_are
         usb_background();
         #endif
     }
+    self->area_buffer_in_use = false;
     return true;
 }
 
 STATIC void _refresh_display(busdisplay_busdisplay_obj_t *self) {
-    if (!displayio_display_bus_is_free(&self->bus)) {
+    if (!displayio_display_bus_is_free(&self->bus) || self->area_buffer_in_use) {
         // A refresh on this bus is already in progress.  Try next display.
         return;
     }
     displayio_display_core_start_refresh(&self->core);
+    _update_vertical_scroll(self);
     const displayio_area_t *current_area = _get_refresh_areas(self);
     while (current_area != NULL) {
-        _refresh_area(self, current_area);
+        uint16_t next = 0;
+        _refresh_area(self, current_area, &next, 0);
         current_area = current_area->next;
     }
     displayio_display_core_finish_refresh(&self->core);
 }
 
+#if CIRCUITPY_BUSDISPLAY_REFRESH_SLICE_MS
+// Send the pending refresh until deadline, or completely when it is zero.
+// Returns true once nothing is pending.
+STATIC bool _continue_refresh(busdisplay_busdisplay_obj_t *self, uint64_t deadline) {
+    while (self->pending_area != NULL) {
+        if (!displayio_display_bus_is_free(&self->bus) || self->area_buffer_in_use) {
+            return false;
+        }
+        if (!_refresh_area(self, self->pending_area, &self->pending_subrectangle, deadline)) {
+            return false;
+        }
+        self->pending_area = self->pending_area->next;
+        self->pending_subrectangle = 0;
+    }
+    return true;
+}
+
+// Capture the areas to refresh and mark the group tree as refreshed straight
+// away. The areas are then sent over as many background calls as it takes,
+// using whatever the groups hold at the time, and anything that changes in
+// the meantime is dirty again for the next refresh. Returns false if the bus
+// is busy.
+STATIC bool _start_sliced_refresh(busdisplay_busdisplay_obj_t *self) {
+    if (!displayio_display_bus_is_free(&self->bus)) {
+        return false;
+    }
+    displayio_display_core_start_refresh(&self->core);
+    _update_vertical_scroll(self);
+    self->pending_area = _get_refresh_areas(self);
+    self->pending_subrectangle = 0;
+    displayio_display_core_finish_refresh(&self->core);
+    return true;
+}
+#endif
+
 void common_hal_busdisplay_busdisplay_set_rotation(busdisplay_busdisplay_obj_t *self, int rotation) {
     bool transposed = (self->core.rotation == 90 || self->core.rotation == 270);
     bool will_transposed = (rotation == 90 || rotation == 270);
@@ -358,6 +574,28 @@ uint16_t common_hal_busdisplay_busdisplay_get_rotation(busdisplay_busdisplay_obj
     return self->core.rotation;
 }
 
+void common_hal_busdisplay_busdisplay_set_area_buffer_size(busdisplay_busdisplay_obj_t *self, uint16_t area_buffer_size) {
+    uint16_t words = area_buffer_size / sizeof(uint32_t);
+    if (self->area_buffer != NULL && self->area_buffer_size == words) {
+        return;
+    }
+    // SH1107 pages are always 8 rows of the full width, so make room for one
+    // in either rotation.
+    size_t allocated_words = words;
+    if (self->bus.SH1107_addressing) {
+        uint8_t pixels_per_word = (sizeof(uint32_t) * 8) / self->core.colorspace.depth;
+        size_t page_pixels = 8 * MAX(self->core.width, self->core.height);
+        allocated_words = MAX(allocated_words, (page_pixels + pixels_per_word - 1) / pixels_per_word);
+    }
+    _release_area_buffer(self);
+    // The buses may send straight from this buffer.
+    self->area_buffer = port_malloc_tagged(allocated_words * sizeof(uint32_t), true, PORT_HEAP_TAG_DISPLAY);
+    if (self->area_buffer == NULL) {
+        m_malloc_fail(allocated_words * sizeof(uint32_t));
+    }
+    self->area_buffer_size = words;
+}
+
 
 bool common_hal_busdisplay_busdisplay_refresh(busdisplay_busdisplay_obj_t *self, uint32_t target_ms_per_frame, uint32_t maximum_ms_per_real_frame) {
     if (!self->auto_refresh && !self->first_manual_refresh && (target_ms_per_frame != NO_FPS_LIMIT)) {
@@ -380,10 +618,33 @@ bool common_hal_busdisplay_busdisplay_refresh(busdisplay_busdisplay_obj_t *self,
         }
     }
     self->first_manual_refresh = false;
+    #if CIRCUITPY_BUSDISPLAY_REFRESH_SLICE_MS
+    // An explicit refresh shows everything, including any unfinished background refresh.
+    _continue_refresh(self, 0);
+    #endif
     _refresh_display(self);
     return true;
 }
 
+#if CIRCUITPY_BUSDISPLAY_REFRESH_SLICE_MS
+bool common_hal_busdisplay_busdisplay_refresh_slice(busdisplay_busdisplay_obj_t *self, bool *started) {
+    uint64_t deadline = supervisor_ticks_ms64() + CIRCUITPY_BUSDISPLAY_REFRESH_SLICE_MS;
+    // Anything already pending, including a background refresh, goes out first.
+    if (!_continue_refresh(self, deadline)) {
+        return false;
+    }
+    if (*started) {
+        return true;
+    }
+    if (!_start_sliced_refresh(self)) {
+        return false;
+    }
+    self->first_manual_refresh = false;
+    *started = true;
+    return _continue_refresh(self, deadline);
+}
+#endif
+
 bool common_hal_busdisplay_busdisplay_get_auto_refresh(busdisplay_busdisplay_obj_t *self) {
     return self->auto_refresh;
 }
@@ -409,15 +670,75 @@ mp_obj_t common_hal_busdisplay_busdisplay_set_root_group(busdisplay_busdisplay_o
     return mp_const_none;
 }
 
+void common_hal_busdisplay_busdisplay_set_vertical_scroll(busdisplay_busdisplay_obj_t *self, displayio_tilegrid_t *tile_grid, uint16_t memory_lines) {
+    if (self->scroll_tile_grid != NULL) {
+        self->scroll_tile_grid->hardware_scroll = false;
+        if (self->scroll_tile_grid->scrolled_y != 0) {
+            self->scroll_tile_grid->full_change = true;
+        }
+    }
+    self->scroll_tile_grid = tile_grid;
+    if (tile_grid != NULL) {
+        self->scroll_memory_lines = memory_lines;
+        tile_grid->hardware_scroll = true;
+        tile_grid->scrolled_y = 0;
+    }
+    // Forget the current region so the next refresh defines it again.
+    self->scroll_area.y1 = self->scroll_area.y2 = -1;
+}
+
+bool busdisplay_busdisplay_can_write_rgb565(busdisplay_busdisplay_obj_t *self) {
+    return self->core.colorspace.depth == 16 && !self->core.colorspace.grayscale &&
+           self->core.rotation == 0 && !self->bus.data_as_commands;
+}
+
+void busdisplay_busdisplay_write_rgb565(busdisplay_busdisplay_obj_t *self, const displayio_area_t *area, uint8_t *pixels) {
+    uint32_t length = displayio_area_size(area) * 2;
+    if (!self->core.colorspace.reverse_bytes_in_word) {
+        uint16_t *words = (uint16_t *)(void *)pixels;
+        for (uint32_t i = 0; i < length / 2; i++) {
+            words[i] = __builtin_bswap16(words[i]);
+        }
+    }
+    while (!displayio_display_bus_is_free(&self->bus)) {
+        RUN_BACKGROUND_TASKS;
+    }
+    if (self->scroll_offset != 0) {
+        _send_scrolled_area(self, area, pixels);
+        return;
+    }
+    displayio_area_t region = *area;
+    displayio_display_bus_set_region_to_update(&self->bus, &self->core, &region);
+    displayio_display_bus_begin_transaction(&self->bus);
+    _send_pixels(self, pixels, length);
+    displayio_display_bus_end_transaction(&self->bus);
+}
+
 void busdisplay_busdisplay_background(busdisplay_busdisplay_obj_t *self) {
+    #if CIRCUITPY_BUSDISPLAY_REFRESH_SLICE_MS
+    uint64_t deadline = supervisor_ticks_ms64() + CIRCUITPY_BUSDISPLAY_REFRESH_SLICE_MS;
+    if (!_continue_refresh(self, deadline)) {
+        return;
+    }
+    if (self->auto_refresh && (supervisor_ticks_ms64() - self->core.last_refresh) > self->native_ms_per_frame) {
+        _start_sliced_refresh(self);
+        _continue_refresh(self, deadline);
+    }
+    #else
     if (self->auto_refresh && (supervisor_ticks_ms64() - self->core.last_refresh) > self->native_ms_per_frame) {
         _refresh_display(self);
     }
+    #endif
 }
 
 void release_busdisplay(busdisplay_busdisplay_obj_t *self) {
     common_hal_busdisplay_busdisplay_set_auto_refresh(self, false);
+    self->scroll_tile_grid = NULL;
+    #if CIRCUITPY_BUSDISPLAY_REFRESH_SLICE_MS
+    self->pending_area = NULL;
+    #endif
     release_display_core(&self->core);
+    _release_area_buffer(self);
     #if (CIRCUITPY_PWMIO)
     if (self->backlight_pwm.base.type == &pwmio_pwmout_type) {
         common_hal_pwmio_pwmout_deinit(&self->backlight_pwm);
@@ -431,6 +752,12 @@ void release_busdisplay(busdisplay_busdisplay_obj_t *self) {
 
 void reset_busdisplay(busdisplay_busdisplay_obj_t *self) {
     common_hal_busdisplay_busdisplay_set_auto_refresh(self, true);
+    // The scrolled TileGrid was on the heap. Restore the panel's own scrolling
+    // on the next refresh.
+    if (self->scroll_tile_grid != NULL) {
+        self->scroll_tile_grid = NULL;
+        self->scroll_area.y1 = self->scroll_area.y2 = -1;
+    }
     circuitpython_splash.x = 0; // reset position in case someone moved it.
     circuitpython_splash.y = 0;
     supervisor_start_terminal(self->core.width, self->core.height);
@@ -441,5 +768,6 @@ void reset_busdisplay(busdisplay_busdisplay_obj_t *self) {
 
 void busdisplay_busdisplay_collect_ptrs(busdisplay_busdisplay_obj_t *self) {
     displayio_display_core_collect_ptrs(&self->core);
+    gc_collect_ptr(self->scroll_tile_grid);
     displayio_display_bus_collect_ptrs(&self->bus);
 }
@@ -28,6 +28,7 @@
 
 #include "shared-bindings/digitalio/DigitalInOut.h"
 #include "shared-bindings/displayio/Group.h"
+#include "shared-bindings/displayio/TileGrid.h"
 #if CIRCUITPY_PWMIO
 #include "shared-bindings/pwmio/PWMOut.h"
 #endif
@@ -51,13 +52,37 @@ typedef struct {
     uint16_t brightness_command;
     uint16_t native_frames_per_second;
     uint16_t native_ms_per_frame;
+    // Subrectangles are rendered here before they are sent.
+    uint32_t *area_buffer;
+    uint16_t area_buffer_size; // In uint32_ts
+    #if CIRCUITPY_BUSDISPLAY_REFRESH_SLICE_MS
+    // Remainder of a refresh that is being sent over several background calls.
+    const displayio_area_t *pending_area;
+    uint16_t pending_subrectangle;
+    #endif
+    // TileGrid scrolled by the panel and the rows the panel currently scrolls,
+    // with how far their content has moved up in the panel's memory.
+    displayio_tilegrid_t *scroll_tile_grid;
+    displayio_area_t scroll_area;
+    uint16_t scroll_offset;
+    uint16_t scroll_memory_lines;
     uint8_t write_ram_command;
     bool auto_refresh;
     bool first_manual_refresh;
     bool backlight_on_high;
+    // Sending can run background tasks, which may refresh this display again.
+    bool area_buffer_in_use;
 } busdisplay_busdisplay_obj_t;
 
 void busdisplay_busdisplay_background(busdisplay_busdisplay_obj_t *self);
 void release_busdisplay(busdisplay_busdisplay_obj_t *self);
 void reset_busdisplay(busdisplay_busdisplay_obj_t *self);
 void busdisplay_busdisplay_collect_ptrs(busdisplay_busdisplay_obj_t *self);
+
+// Whether pixels can be written straight to the panel's memory, bypassing the
+// root group. That needs an unrotated 16 bit color display.
+bool busdisplay_busdisplay_can_write_rgb565(busdisplay_busdisplay_obj_t *self);
+// Send big-endian RGB565 pixels, row after row, to area of the panel. They are
+// byteswapped in place when the panel takes the other order. The next refresh
+// that covers area draws over them.
+void busdisplay_busdisplay_write_rgb565(busdisplay_busdisplay_obj_t *self, const displayio_area_t *area, uint8_t *pixels);
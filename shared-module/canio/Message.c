@@ -25,6 +25,7 @@
  */
 
 #include "shared-module/canio/Message.h"
+#include "shared-bindings/canio/Listener.h"
 #include "shared-bindings/canio/Message.h"
 
 #include <string.h>
@@ -68,3 +69,16 @@ bool common_hal_canio_message_get_extended(const canio_message_obj_t *self) {
 void common_hal_canio_message_set_extended(canio_message_obj_t *self, bool extended) {
     self->extended = extended;
 }
+
+// Store a received message as a CANIO_LISTENER_RECORD_SIZE record for Listener.receive_into.
+void canio_message_pack_record(const canio_message_obj_t *self, bool rtr, uint8_t *record) {
+    uint32_t id = self->id;
+    memcpy(record, &id, sizeof(id));
+    record[4] = self->size;
+    record[5] = (self->extended ? CANIO_LISTENER_RECORD_EXTENDED : 0) | (rtr ? CANIO_LISTENER_RECORD_RTR : 0);
+    record[6] = record[7] = 0;
+    memset(record + 8, 0, 8);
+    if (!rtr) {
+        memcpy(record + 8, self->data, MIN(self->size, sizeof(self->data)));
+    }
+}
@@ -35,3 +35,5 @@ typedef struct {
     size_t size : 4;
     bool extended : 1;
 } canio_message_obj_t;
+
+void canio_message_pack_record(const canio_message_obj_t *self, bool rtr, uint8_t *record);
@@ -76,10 +76,11 @@ void common_hal_displayio_bitmap_construct_from_buffer(displayio_bitmap_t *self,
     self->x_mask = (1u << self->x_shift) - 1u; // Used as a modulus on the x value
     self->bitmask = (1u << bits_per_value) - 1u;
 
-    self->dirty_area.x1 = 0;
-    self->dirty_area.x2 = width;
-    self->dirty_area.y1 = 0;
-    self->dirty_area.y2 = height;
+    self->dirty_areas[0].x1 = 0;
+    self->dirty_areas[0].x2 = width;
+    self->dirty_areas[0].y1 = 0;
+    self->dirty_areas[0].y2 = height;
+    self->dirty_area_count = 1;
 }
 
 void common_hal_displayio_bitmap_deinit(displayio_bitmap_t *self) {
@@ -128,6 +129,119 @@ uint32_t common_hal_displayio_bitmap_get_pixel(displayio_bitmap_t *self, int16_t
     return 0;
 }
 
+// Reads count consecutive values from row y starting at x. The span must be
+// within the bitmap.
+void displayio_bitmap_get_row_pixels(displayio_bitmap_t *self, int16_t x, int16_t y, uint16_t count, uint32_t *values) {
+    uint32_t *row = self->data + y * self->stride;
+    switch (self->bits_per_value) {
+        case 8:
+            for (uint16_t i = 0; i < count; i++) {
+                values[i] = ((uint8_t *)row)[x + i];
+            }
+            break;
+        case 16:
+            for (uint16_t i = 0; i < count; i++) {
+                values[i] = ((uint16_t *)row)[x + i];
+            }
+            break;
+        case 32:
+            memcpy(values, row + x, count * sizeof(uint32_t));
+            break;
+        default: {
+            uint32_t word = row[x >> self->x_shift];
+            for (uint16_t i = 0; i < count; i++, x++) {
+                if (i > 0 && (x & self->x_mask) == 0) {
+                    word = row[x >> self->x_shift];
+                }
+                values[i] = (word >> (sizeof(uint32_t) * 8 - ((x & self->x_mask) + 1) * self->bits_per_value)) & self->bitmask;
+            }
+            break;
+        }
+    }
+}
+
+// Writes count consecutive values to row y starting at x. The span must be
+// within the bitmap and the caller must update the dirty area.
+void displayio_bitmap_set_row_pixels(displayio_bitmap_t *self, int16_t x, int16_t y, uint16_t count, const uint32_t *values) {
+    uint32_t *row = self->data + y * self->stride;
+    switch (self->bits_per_value) {
+        case 8:
+            for (uint16_t i = 0; i < count; i++) {
+                ((uint8_t *)row)[x + i] = values[i];
+            }
+            break;
+        case 16:
+            for (uint16_t i = 0; i < count; i++) {
+                ((uint16_t *)row)[x + i] = values[i];
+            }
+            break;
+        case 32:
+            memcpy(row + x, values, count * sizeof(uint32_t));
+            break;
+        default: {
+            uint32_t index = x >> self->x_shift;
+            uint32_t word = row[index];
+            for (uint16_t i = 0; i < count; i++, x++) {
+                if (i > 0 && (x & self->x_mask) == 0) {
+                    row[index] = word;
+                    index = x >> self->x_shift;
+                    word = row[index];
+                }
+                uint32_t bit_position = (sizeof(uint32_t) * 8 - ((x & self->x_mask) + 1) * self->bits_per_value);
+                word &= ~(self->bitmask << bit_position);
+                word |= (values[i] & self->bitmask) << bit_position;
+            }
+            row[index] = word;
+            break;
+        }
+    }
+}
+
+// Sets count consecutive pixels of row y starting at x to value. The span must
+// be within the bitmap and the caller must update the dirty area.
+void displayio_bitmap_fill_row(displayio_bitmap_t *self, int16_t x, int16_t y, uint16_t count, uint32_t value) {
+    uint32_t *row = self->data + y * self->stride;
+    switch (self->bits_per_value) {
+        case 8:
+            memset((uint8_t *)row + x, value, count);
+            break;
+        case 16: {
+            uint16_t *pixels = (uint16_t *)row + x;
+            for (uint16_t i = 0; i < count; i++) {
+                pixels[i] = value;
+            }
+            break;
+        }
+        case 32:
+            for (uint16_t i = 0; i < count; i++) {
+                row[x + i] = value;
+            }
+            break;
+        default: {
+            const uint8_t bits = self->bits_per_value;
+            const uint32_t per_word = self->x_mask + 1;
+            uint32_t packed = 0;
+            for (uint32_t i = 0; i < per_word; i++) {
+                packed |= (value & self->bitmask) << (32 - ((i + 1) * bits));
+            }
+            uint32_t end = x + count;
+            uint32_t first_word = x >> self->x_shift;
+            uint32_t last_word = (end - 1) >> self->x_shift;
+            for (uint32_t index = first_word; index <= last_word; index++) {
+                // Pixels [start, stop) of this word are in the span.
+                uint32_t start = index == first_word ? (x & self->x_mask) : 0;
+                uint32_t stop = index == last_word ? end - (index << self->x_shift) : per_word;
+                uint32_t mask = start == 0 ? 0xffffffff : 0xffffffff >> (start * bits);
+                if (stop < per_word) {
+                    mask &= ~(0xffffffff >> (stop * bits));
+                }
+                row[index] = (row[index] & ~mask) | (packed & mask);
+            }
+            break;
+        }
+    }
+}
+
 void displayio_bitmap_set_dirty_area(displayio_bitmap_t *self, const displayio_area_t *dirty_area) {
     if (self->read_only) {
         mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
@@ -135,9 +249,14 @@ void displayio_bitmap_set_dirty_area(displayio_bitmap_t *self, const displayio_a
 
     displayio_area_t area = *dirty_area;
     displayio_area_canon(&area);
-    displayio_area_union(&area, &self->dirty_area, &area);
     displayio_area_t bitmap_area = {0, 0, self->width, self->height, NULL};
-    displayio_area_compute_overlap(&area, &bitmap_area, &self->dirty_area);
+    if (!displayio_area_compute_overlap(&area, &bitmap_area, &area)) {
+        return;
+    }
+    // Refreshes merge the areas again with the display's own overhead, so only
+    // merge here when it costs no extra pixels.
+    self->dirty_area_count = displayio_area_add_merged(self->dirty_areas, self->dirty_area_count,
+        CIRCUITPY_DISPLAYIO_BITMAP_DIRTY_AREAS, &area, 0);
 }
 
 void displayio_bitmap_write_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value) {
@@ -188,19 +307,21 @@ void common_hal_displayio_bitmap_set_pixel(displayio_bitmap_t *self, int16_t x,
 }
 
 displayio_area_t *displayio_bitmap_get_refresh_areas(displayio_bitmap_t *self, displayio_area_t *tail) {
-    if (self->dirty_area.x1 == self->dirty_area.x2 || self->read_only) {
+    if (self->read_only) {
         return tail;
     }
-    self->dirty_area.next = tail;
-    return &self->dirty_area;
+    for (size_t i = self->dirty_area_count; i > 0; i--) {
+        self->dirty_areas[i - 1].next = tail;
+        tail = &self->dirty_areas[i - 1];
+    }
+    return tail;
 }
 
 void displayio_bitmap_finish_refresh(displayio_bitmap_t *self) {
     if (self->read_only) {
         return;
     }
-    self->dirty_area.x1 = 0;
-    self->dirty_area.x2 = 0;
+    self->dirty_area_count = 0;
 }
 
 void common_hal_displayio_bitmap_fill(displayio_bitmap_t *self, uint32_t value) {
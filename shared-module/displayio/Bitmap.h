@@ -33,6 +33,12 @@
 #include "py/obj.h"
 #include "shared-module/displayio/area.h"
 
+// Ports that don't include circuitpy_mpconfig.h (such as unix) get the same
+// default here.
+#ifndef CIRCUITPY_DISPLAYIO_BITMAP_DIRTY_AREAS
+#define CIRCUITPY_DISPLAYIO_BITMAP_DIRTY_AREAS (4)
+#endif
+
 typedef struct {
     mp_obj_base_t base;
     uint16_t width;
@@ -42,7 +48,8 @@ typedef struct {
     uint8_t bits_per_value;
     uint8_t x_shift;
     size_t x_mask;
-    displayio_area_t dirty_area;
+    displayio_area_t dirty_areas[CIRCUITPY_DISPLAYIO_BITMAP_DIRTY_AREAS];
+    uint8_t dirty_area_count;
     uint16_t bitmask;
     bool read_only;
     bool data_alloc; // did bitmap allocate data or someone else
@@ -51,6 +58,9 @@ typedef struct {
 void displayio_bitmap_finish_refresh(displayio_bitmap_t *self);
 displayio_area_t *displayio_bitmap_get_refresh_areas(displayio_bitmap_t *self, displayio_area_t *tail);
 void displayio_bitmap_set_dirty_area(displayio_bitmap_t *self, const displayio_area_t *area);
+void displayio_bitmap_get_row_pixels(displayio_bitmap_t *self, int16_t x, int16_t y, uint16_t count, uint32_t *values);
+void displayio_bitmap_set_row_pixels(displayio_bitmap_t *self, int16_t x, int16_t y, uint16_t count, const uint32_t *values);
+void displayio_bitmap_fill_row(displayio_bitmap_t *self, int16_t x, int16_t y, uint16_t count, uint32_t value);
 void displayio_bitmap_write_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value);
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_BITMAP_H
@@ -359,7 +359,142 @@ void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _d
     }
 }
 
+// Converts count contiguous input colors in values to packed RGB565 without
+// going through RGB888 and the per pixel struct.
+STATIC void _convert_span_rgb565(displayio_colorspace_t input_colorspace, bool swap, uint32_t *values, size_t count) {
+    switch (input_colorspace) {
+        case DISPLAYIO_COLORSPACE_RGB565_SWAPPED:
+            // Swapped input to swapped output is a copy.
+            swap = !swap;
+            MP_FALLTHROUGH;
+        case DISPLAYIO_COLORSPACE_RGB565:
+            if (swap) {
+                for (size_t i = 0; i < count; i++) {
+                    values[i] = __builtin_bswap16(values[i]);
+                }
+            } else {
+                for (size_t i = 0; i < count; i++) {
+                    values[i] &= 0xffff;
+                }
+            }
+            return;
+
+        case DISPLAYIO_COLORSPACE_BGR565_SWAPPED:
+        case DISPLAYIO_COLORSPACE_BGR565:
+            for (size_t i = 0; i < count; i++) {
+                uint32_t pixel = values[i] & 0xffff;
+                if (input_colorspace == DISPLAYIO_COLORSPACE_BGR565_SWAPPED) {
+                    pixel = __builtin_bswap16(pixel);
+                }
+                values[i] = (pixel & 0x1f) << 11 | (pixel & 0x07e0) | pixel >> 11;
+            }
+            break;
+
+        case DISPLAYIO_COLORSPACE_RGB555_SWAPPED:
+        case DISPLAYIO_COLORSPACE_RGB555:
+        case DISPLAYIO_COLORSPACE_BGR555_SWAPPED:
+        case DISPLAYIO_COLORSPACE_BGR555: {
+            bool swapped_input = input_colorspace == DISPLAYIO_COLORSPACE_RGB555_SWAPPED ||
+                input_colorspace == DISPLAYIO_COLORSPACE_BGR555_SWAPPED;
+            bool bgr = input_colorspace == DISPLAYIO_COLORSPACE_BGR555 ||
+                input_colorspace == DISPLAYIO_COLORSPACE_BGR555_SWAPPED;
+            for (size_t i = 0; i < count; i++) {
+                uint32_t pixel = values[i] & 0xffff;
+                if (swapped_input) {
+                    pixel = __builtin_bswap16(pixel);
+                }
+                uint32_t hi5 = (pixel >> 10) & 0x1f;
+                uint32_t g6 = ((pixel >> 5) & 0x1f) << 1;
+                uint32_t lo5 = pixel & 0x1f;
+                values[i] = bgr ? (lo5 << 11 | g6 << 5 | hi5) : (hi5 << 11 | g6 << 5 | lo5);
+            }
+            break;
+        }
+
+        case DISPLAYIO_COLORSPACE_L8:
+            for (size_t i = 0; i < count; i++) {
+                values[i] = displayio_colorconverter_compute_rgb565((values[i] & 0xff) * 0x010101);
+            }
+            break;
+
+        default:
+        case DISPLAYIO_COLORSPACE_RGB888:
+            for (size_t i = 0; i < count; i++) {
+                values[i] = displayio_colorconverter_compute_rgb565(values[i]);
+            }
+            break;
+    }
+    if (swap) {
+        for (size_t i = 0; i < count; i++) {
+            values[i] = __builtin_bswap16(values[i]);
+        }
+    }
+}
+
+// Converts count contiguous input colors in values to grayscale in place.
+STATIC void _convert_span_luma(displayio_colorspace_t input_colorspace, const _displayio_colorspace_t *colorspace, uint32_t *values, size_t count) {
+    const uint32_t bitmask = (1 << colorspace->depth) - 1;
+    const uint8_t shift = colorspace->grayscale_bit;
+    if (input_colorspace == DISPLAYIO_COLORSPACE_L8) {
+        // The luma weights sum to 255 so a gray's luma is its level.
+        for (size_t i = 0; i < count; i++) {
+            values[i] = ((values[i] & 0xff) >> shift) & bitmask;
+        }
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        uint32_t rgb888 = displayio_colorconverter_convert_pixel(input_colorspace, values[i]);
+        values[i] = (displayio_colorconverter_compute_luma(rgb888) >> shift) & bitmask;
+    }
+}
+
+// Converts count contiguous, non-transparent input colors in values in place.
+// Returns false, leaving values unchanged, when the conversion depends on pixel
+// position (dithering) or the output colorspace has no span conversion.
+bool displayio_colorconverter_convert_span(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, uint32_t *values, size_t count) {
+    if (self->dither) {
+        return false;
+    }
+    if (colorspace->depth == 16) {
+        _convert_span_rgb565(self->input_colorspace, colorspace->reverse_bytes_in_word, values, count);
+        return true;
+    }
+    if (!colorspace->tricolor && colorspace->grayscale && colorspace->depth <= 8) {
+        _convert_span_luma(self->input_colorspace, colorspace, values, count);
+        return true;
+    }
+    return false;
+}
+
+// Converts count input colors in values in place. Returns a bit mask with bit
+// i set when values[i] is opaque. count must be at most 32 and the converter
+// must not dither because dithering depends on pixel position.
+uint32_t displayio_colorconverter_get_colors(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, uint32_t *values, uint16_t count) {
+    uint32_t opaque = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        if (values[i] != self->transparent_color) {
+            opaque |= 1u << i;
+        }
+    }
+    // Transparent values are converted too but their bits stay clear.
+    if (displayio_colorconverter_convert_span(self, colorspace, values, count)) {
+        return opaque;
+    }
 
+    opaque = 0;
+    displayio_input_pixel_t input_pixel = {0};
+    displayio_output_pixel_t output_pixel;
+    for (uint16_t i = 0; i < count; i++) {
+        input_pixel.pixel = values[i];
+        output_pixel.opaque = true;
+        displayio_colorconverter_convert(self, colorspace, &input_pixel, &output_pixel);
+        if (output_pixel.opaque) {
+            opaque |= 1u << i;
+            values[i] = output_pixel.pixel;
+        }
+    }
+    return opaque;
+}
 
 // Currently no refresh logic is needed for a ColorConverter.
 bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self) {
@@ -49,6 +49,8 @@ typedef struct displayio_colorconverter {
 bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self);
 void displayio_colorconverter_finish_refresh(displayio_colorconverter_t *self);
 void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color);
+uint32_t displayio_colorconverter_get_colors(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, uint32_t *values, uint16_t count);
+bool displayio_colorconverter_convert_span(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, uint32_t *values, size_t count);
 
 uint32_t displayio_colorconverter_dither_noise_1(uint32_t n);
 uint32_t displayio_colorconverter_dither_noise_2(uint32_t x, uint32_t y);
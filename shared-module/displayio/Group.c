@@ -26,6 +26,7 @@
 
 #include "shared-bindings/displayio/Group.h"
 
+#include "py/gc.h"
 #include "py/runtime.h"
 #include "py/objlist.h"
 #include "shared-bindings/displayio/TileGrid.h"
@@ -34,12 +35,89 @@
 #include "shared-bindings/vectorio/VectorShape.h"
 #endif
 
+STATIC void _resolve_child(mp_obj_t member, displayio_group_child_t *child) {
+    child->native = mp_obj_cast_to_native_base(member, &displayio_tilegrid_type);
+    if (child->native != MP_OBJ_NULL) {
+        child->kind = DISPLAYIO_GROUP_CHILD_TILEGRID;
+        return;
+    }
+    child->native = mp_obj_cast_to_native_base(member, &displayio_group_type);
+    if (child->native != MP_OBJ_NULL) {
+        child->kind = DISPLAYIO_GROUP_CHILD_GROUP;
+        return;
+    }
+    #if CIRCUITPY_VECTORIO
+    const vectorio_draw_protocol_t *draw_protocol = mp_proto_get(MP_QSTR_protocol_draw, member);
+    if (draw_protocol != NULL) {
+        child->native = draw_protocol->draw_get_protocol_self(member);
+        child->draw_impl = draw_protocol->draw_protocol_impl;
+        child->kind = DISPLAYIO_GROUP_CHILD_VECTORIO;
+        return;
+    }
+    #endif
+    child->kind = DISPLAYIO_GROUP_CHILD_NONE;
+}
+
+// Returns member i resolved, from the cache when it is up to date or else
+// into scratch.
+STATIC const displayio_group_child_t *_child(displayio_group_t *self, size_t i, displayio_group_child_t *scratch) {
+    if (self->children_len == self->members->len) {
+        return &self->children[i];
+    }
+    _resolve_child(self->members->items[i], scratch);
+    return scratch;
+}
+
+// Rebuilds the cache of resolved members. Call it after anything changes them.
+// Groups outside the heap, like the supervisor's, and groups whose cache can't
+// be allocated resolve their members as they go instead.
+void displayio_group_update_children(displayio_group_t *self) {
+    size_t len = self->members->len;
+    self->children_len = SIZE_MAX;
+    if (gc_nbytes(self) == 0) {
+        return;
+    }
+    if (len > self->children_alloc) {
+        size_t alloc = self->members->alloc;
+        displayio_group_child_t *children = m_renew_maybe(displayio_group_child_t,
+            self->children, self->children_alloc, alloc, true);
+        if (children == NULL) {
+            return;
+        }
+        self->children = children;
+        self->children_alloc = alloc;
+    }
+    for (size_t i = 0; i < len; i++) {
+        _resolve_child(self->members->items[i], &self->children[i]);
+    }
+    self->children_len = len;
+}
 
 void common_hal_displayio_group_construct(displayio_group_t *self, uint32_t scale, mp_int_t x, mp_int_t y) {
     mp_obj_list_t *members = mp_obj_new_list(0, NULL);
     displayio_group_construct(self, members, scale, x, y);
 }
 
+STATIC void _set_children_hidden_by_parent(displayio_group_t *self, bool hidden) {
+    for (size_t i = 0; i < self->members->len; i++) {
+        displayio_group_child_t scratch;
+        const displayio_group_child_t *child = _child(self, i, &scratch);
+        switch (child->kind) {
+            case DISPLAYIO_GROUP_CHILD_TILEGRID:
+                displayio_tilegrid_set_hidden_by_parent(child->native, hidden);
+                break;
+            case DISPLAYIO_GROUP_CHILD_GROUP:
+                displayio_group_set_hidden_by_parent(child->native, hidden);
+                break;
+            #if CIRCUITPY_VECTORIO
+            case DISPLAYIO_GROUP_CHILD_VECTORIO:
+                child->draw_impl->draw_set_dirty(child->native);
+                break;
+            #endif
+        }
+    }
+}
+
 bool common_hal_displayio_group_get_hidden(displayio_group_t *self) {
     return self->hidden;
 }
@@ -52,29 +130,7 @@ void common_hal_displayio_group_set_hidden(displayio_group_t *self, bool hidden)
     if (self->hidden_by_parent) {
         return;
     }
-    for (size_t i = 0; i < self->members->len; i++) {
-        mp_obj_t layer;
-        layer = mp_obj_cast_to_native_base(
-            self->members->items[i], &displayio_tilegrid_type);
-        if (layer != MP_OBJ_NULL) {
-            displayio_tilegrid_set_hidden_by_parent(layer, hidden);
-            continue;
-        }
-        layer = mp_obj_cast_to_native_base(
-            self->members->items[i], &displayio_group_type);
-        if (layer != MP_OBJ_NULL) {
-            displayio_group_set_hidden_by_parent(layer, hidden);
-            continue;
-        }
-        #if CIRCUITPY_VECTORIO
-        const vectorio_draw_protocol_t *draw_protocol = mp_proto_get(MP_QSTR_protocol_draw, self->members->items[i]);
-        if (draw_protocol != NULL) {
-            layer = draw_protocol->draw_get_protocol_self(self->members->items[i]);
-            draw_protocol->draw_protocol_impl->draw_set_dirty(layer);
-            continue;
-        }
-        #endif
-    }
+    _set_children_hidden_by_parent(self, hidden);
 }
 
 void displayio_group_set_hidden_by_parent(displayio_group_t *self, bool hidden) {
@@ -86,29 +142,7 @@ void displayio_group_set_hidden_by_parent(displayio_group_t *self, bool hidden)
     if (self->hidden) {
         return;
     }
-    for (size_t i = 0; i < self->members->len; i++) {
-        mp_obj_t layer;
-        layer = mp_obj_cast_to_native_base(
-            self->members->items[i], &displayio_tilegrid_type);
-        if (layer != MP_OBJ_NULL) {
-            displayio_tilegrid_set_hidden_by_parent(layer, hidden);
-            continue;
-        }
-        layer = mp_obj_cast_to_native_base(
-            self->members->items[i], &displayio_group_type);
-        if (layer != MP_OBJ_NULL) {
-            displayio_group_set_hidden_by_parent(layer, hidden);
-            continue;
-        }
-        #if CIRCUITPY_VECTORIO
-        const vectorio_draw_protocol_t *draw_protocol = mp_proto_get(MP_QSTR_protocol_draw, self->members->items[i]);
-        if (draw_protocol != NULL) {
-            layer = draw_protocol->draw_get_protocol_self(self->members->items[i]);
-            draw_protocol->draw_protocol_impl->draw_set_dirty(layer);
-            continue;
-        }
-        #endif
-    }
+    _set_children_hidden_by_parent(self, hidden);
 }
 
 uint32_t common_hal_displayio_group_get_scale(displayio_group_t *self) {
@@ -118,22 +152,25 @@ uint32_t common_hal_displayio_group_get_scale(displayio_group_t *self) {
 bool displayio_group_get_previous_area(displayio_group_t *self, displayio_area_t *area) {
     bool first = true;
     for (size_t i = 0; i < self->members->len; i++) {
-        mp_obj_t layer;
+        displayio_group_child_t scratch;
+        const displayio_group_child_t *child = _child(self, i, &scratch);
         displayio_area_t layer_area;
-        layer = mp_obj_cast_to_native_base(
-            self->members->items[i], &displayio_tilegrid_type);
-        if (layer != MP_OBJ_NULL) {
-            if (!displayio_tilegrid_get_previous_area(layer, &layer_area)) {
-                continue;
-            }
-        } else {
-            layer = mp_obj_cast_to_native_base(
-                self->members->items[i], &displayio_group_type);
-            if (layer != MP_OBJ_NULL) {
-                if (!displayio_group_get_previous_area(layer, &layer_area)) {
-                    continue;
-                }
-            }
+        bool rendered = false;
+        switch (child->kind) {
+            case DISPLAYIO_GROUP_CHILD_TILEGRID:
+                rendered = displayio_tilegrid_get_previous_area(child->native, &layer_area);
+                break;
+            case DISPLAYIO_GROUP_CHILD_GROUP:
+                rendered = displayio_group_get_previous_area(child->native, &layer_area);
+                break;
+            #if CIRCUITPY_VECTORIO
+            case DISPLAYIO_GROUP_CHILD_VECTORIO:
+                rendered = child->draw_impl->draw_get_dirty_area(child->native, &layer_area);
+                break;
+            #endif
+        }
+        if (!rendered) {
+            continue;
         }
         if (first) {
             displayio_area_copy(&layer_area, area);
@@ -158,26 +195,20 @@ static void _update_child_transforms(displayio_group_t *self) {
         return;
     }
     for (size_t i = 0; i < self->members->len; i++) {
-        mp_obj_t layer;
-        #if CIRCUITPY_VECTORIO
-        const vectorio_draw_protocol_t *draw_protocol = mp_proto_get(MP_QSTR_protocol_draw, self->members->items[i]);
-        if (draw_protocol != NULL) {
-            layer = draw_protocol->draw_get_protocol_self(self->members->items[i]);
-            draw_protocol->draw_protocol_impl->draw_update_transform(layer, &self->absolute_transform);
-            continue;
-        }
-        #endif
-        layer = mp_obj_cast_to_native_base(
-            self->members->items[i], &displayio_tilegrid_type);
-        if (layer != MP_OBJ_NULL) {
-            displayio_tilegrid_update_transform(layer, &self->absolute_transform);
-            continue;
-        }
-        layer = mp_obj_cast_to_native_base(
-            self->members->items[i], &displayio_group_type);
-        if (layer != MP_OBJ_NULL) {
-            displayio_group_update_transform(layer, &self->absolute_transform);
-            continue;
+        displayio_group_child_t scratch;
+        const displayio_group_child_t *child = _child(self, i, &scratch);
+        switch (child->kind) {
+            case DISPLAYIO_GROUP_CHILD_TILEGRID:
+                displayio_tilegrid_update_transform(child->native, &self->absolute_transform);
+                break;
+            case DISPLAYIO_GROUP_CHILD_GROUP:
+                displayio_group_update_transform(child->native, &self->absolute_transform);
+                break;
+            #if CIRCUITPY_VECTORIO
+            case DISPLAYIO_GROUP_CHILD_VECTORIO:
+                child->draw_impl->draw_update_transform(child->native, &self->absolute_transform);
+                break;
+            #endif
         }
     }
 }
@@ -336,11 +367,14 @@ static void _remove_layer(displayio_group_t *self, size_t index) {
 void common_hal_displayio_group_insert(displayio_group_t *self, size_t index, mp_obj_t layer) {
     _add_layer(self, layer);
     mp_obj_list_insert(self->members, index, layer);
+    displayio_group_update_children(self);
 }
 
 mp_obj_t common_hal_displayio_group_pop(displayio_group_t *self, size_t index) {
     _remove_layer(self, index);
-    return mp_obj_list_pop(self->members, index);
+    mp_obj_t layer = mp_obj_list_pop(self->members, index);
+    displayio_group_update_children(self);
+    return layer;
 }
 
 mp_int_t common_hal_displayio_group_index(displayio_group_t *self, mp_obj_t layer) {
@@ -362,6 +396,7 @@ void common_hal_displayio_group_set(displayio_group_t *self, size_t index, mp_ob
     _add_layer(self, layer);
     _remove_layer(self, index);
     mp_obj_list_store(self->members, MP_OBJ_NEW_SMALL_INT(index), layer);
+    displayio_group_update_children(self);
 }
 
 void displayio_group_construct(displayio_group_t *self, mp_obj_list_t *members, uint32_t scale, mp_int_t x, mp_int_t y) {
@@ -371,40 +406,64 @@ void displayio_group_construct(displayio_group_t *self, mp_obj_list_t *members,
     self->item_removed = false;
     self->scale = scale;
     self->in_group = false;
+    self->children = NULL;
+    self->children_alloc = 0;
+    displayio_group_update_children(self);
+}
+
+// True when every pixel of area has been drawn by the layers above.
+STATIC bool _area_fully_masked(const displayio_area_t *area, const uint32_t *mask) {
+    uint32_t pixels = displayio_area_size(area);
+    for (uint32_t i = 0; i < pixels / 32; i++) {
+        if (mask[i] != 0xffffffff) {
+            return false;
+        }
+    }
+    uint32_t remainder = pixels % 32;
+    return remainder == 0 || (mask[pixels / 32] | (0xffffffff << remainder)) == 0xffffffff;
 }
 
 bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
     // Track if any of the layers finishes filling in the given area. We can ignore any remaining
     // layers at that point.
     if (self->hidden == false) {
+        // Whether a layer may have drawn since the mask was last checked.
+        bool drawn = false;
         for (int32_t i = self->members->len - 1; i >= 0; i--) {
-            mp_obj_t layer;
-            #if CIRCUITPY_VECTORIO
-            const vectorio_draw_protocol_t *draw_protocol = mp_proto_get(MP_QSTR_protocol_draw, self->members->items[i]);
-            if (draw_protocol != NULL) {
-                layer = draw_protocol->draw_get_protocol_self(self->members->items[i]);
-                if (draw_protocol->draw_protocol_impl->draw_fill_area(layer, colorspace, area, mask, buffer)) {
-                    return true;
-                }
-                continue;
+            // Several layers can cover the area between them without any one
+            // of them covering it all, and then nothing below is visible.
+            if (drawn && _area_fully_masked(area, mask)) {
+                return true;
             }
-            #endif
-            layer = mp_obj_cast_to_native_base(
-                self->members->items[i], &displayio_tilegrid_type);
-            if (layer != MP_OBJ_NULL) {
-                if (displayio_tilegrid_fill_area(layer, colorspace, area, mask, buffer)) {
-                    return true;
+            displayio_group_child_t scratch;
+            const displayio_group_child_t *child = _child(self, i, &scratch);
+            bool filled = false;
+            switch (child->kind) {
+                case DISPLAYIO_GROUP_CHILD_TILEGRID: {
+                    // Skip TileGrids away from the area without a call.
+                    const displayio_tilegrid_t *tilegrid = child->native;
+                    displayio_area_t overlap;
+                    if (!displayio_area_compute_overlap(area, &tilegrid->current_area, &overlap)) {
+                        continue;
+                    }
+                    filled = displayio_tilegrid_fill_area(child->native, colorspace, area, mask, buffer);
+                    break;
                 }
-                continue;
+                case DISPLAYIO_GROUP_CHILD_GROUP:
+                    filled = displayio_group_fill_area(child->native, colorspace, area, mask, buffer);
+                    break;
+                #if CIRCUITPY_VECTORIO
+                case DISPLAYIO_GROUP_CHILD_VECTORIO:
+                    filled = child->draw_impl->draw_fill_area(child->native, colorspace, area, mask, buffer);
+                    break;
+                #endif
+                default:
+                    continue;
             }
-            layer = mp_obj_cast_to_native_base(
-                self->members->items[i], &displayio_group_type);
-            if (layer != MP_OBJ_NULL) {
-                if (displayio_group_fill_area(layer, colorspace, area, mask, buffer)) {
-                    return true;
-                }
-                continue;
+            if (filled) {
+                return true;
             }
+            drawn = true;
         }
     }
     return false;
@@ -413,26 +472,20 @@ bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorsp
 void displayio_group_finish_refresh(displayio_group_t *self) {
     self->item_removed = false;
     for (int32_t i = self->members->len - 1; i >= 0; i--) {
-        mp_obj_t layer;
-        #if CIRCUITPY_VECTORIO
-        const vectorio_draw_protocol_t *draw_protocol = mp_proto_get(MP_QSTR_protocol_draw, self->members->items[i]);
-        if (draw_protocol != NULL) {
-            layer = draw_protocol->draw_get_protocol_self(self->members->items[i]);
-            draw_protocol->draw_protocol_impl->draw_finish_refresh(layer);
-            continue;
-        }
-        #endif
-        layer = mp_obj_cast_to_native_base(
-            self->members->items[i], &displayio_tilegrid_type);
-        if (layer != MP_OBJ_NULL) {
-            displayio_tilegrid_finish_refresh(layer);
-            continue;
-        }
-        layer = mp_obj_cast_to_native_base(
-            self->members->items[i], &displayio_group_type);
-        if (layer != MP_OBJ_NULL) {
-            displayio_group_finish_refresh(layer);
-            continue;
+        displayio_group_child_t scratch;
+        const displayio_group_child_t *child = _child(self, i, &scratch);
+        switch (child->kind) {
+            case DISPLAYIO_GROUP_CHILD_TILEGRID:
+                displayio_tilegrid_finish_refresh(child->native);
+                break;
+            case DISPLAYIO_GROUP_CHILD_GROUP:
+                displayio_group_finish_refresh(child->native);
+                break;
+            #if CIRCUITPY_VECTORIO
+            case DISPLAYIO_GROUP_CHILD_VECTORIO:
+                child->draw_impl->draw_finish_refresh(child->native);
+                break;
+            #endif
         }
     }
 }
@@ -444,28 +497,22 @@ displayio_area_t *displayio_group_get_refresh_areas(displayio_group_t *self, dis
     }
 
     for (int32_t i = self->members->len - 1; i >= 0; i--) {
-        mp_obj_t layer;
-        #if CIRCUITPY_VECTORIO
-        const vectorio_draw_protocol_t *draw_protocol = mp_proto_get(MP_QSTR_protocol_draw, self->members->items[i]);
-        if (draw_protocol != NULL) {
-            layer = draw_protocol->draw_get_protocol_self(self->members->items[i]);
-            tail = draw_protocol->draw_protocol_impl->draw_get_refresh_areas(layer, tail);
-            continue;
-        }
-        #endif
-        layer = mp_obj_cast_to_native_base(
-            self->members->items[i], &displayio_tilegrid_type);
-        if (layer != MP_OBJ_NULL) {
-            if (!displayio_tilegrid_get_rendered_hidden(layer)) {
-                tail = displayio_tilegrid_get_refresh_areas(layer, tail);
-            }
-            continue;
-        }
-        layer = mp_obj_cast_to_native_base(
-            self->members->items[i], &displayio_group_type);
-        if (layer != MP_OBJ_NULL) {
-            tail = displayio_group_get_refresh_areas(layer, tail);
-            continue;
+        displayio_group_child_t scratch;
+        const displayio_group_child_t *child = _child(self, i, &scratch);
+        switch (child->kind) {
+            case DISPLAYIO_GROUP_CHILD_TILEGRID:
+                if (!displayio_tilegrid_get_rendered_hidden(child->native)) {
+                    tail = displayio_tilegrid_get_refresh_areas(child->native, tail);
+                }
+                break;
+            case DISPLAYIO_GROUP_CHILD_GROUP:
+                tail = displayio_group_get_refresh_areas(child->native, tail);
+                break;
+            #if CIRCUITPY_VECTORIO
+            case DISPLAYIO_GROUP_CHILD_VECTORIO:
+                tail = child->draw_impl->draw_get_refresh_areas(child->native, tail);
+                break;
+            #endif
         }
     }
 
@@ -35,9 +35,34 @@
 #include "shared-module/displayio/area.h"
 #include "shared-module/displayio/Palette.h"
 
+#if CIRCUITPY_VECTORIO
+#include "shared-bindings/vectorio/__init__.h"
+#endif
+
+enum {
+    DISPLAYIO_GROUP_CHILD_NONE,
+    DISPLAYIO_GROUP_CHILD_TILEGRID,
+    DISPLAYIO_GROUP_CHILD_GROUP,
+    DISPLAYIO_GROUP_CHILD_VECTORIO,
+};
+
+// A member resolved to its native object so that refreshes don't look up its
+// type every frame.
+typedef struct {
+    void *native;
+    #if CIRCUITPY_VECTORIO
+    const vectorio_draw_protocol_impl_t *draw_impl;
+    #endif
+    uint8_t kind;
+} displayio_group_child_t;
+
 typedef struct {
     mp_obj_base_t base;
     mp_obj_list_t *members;
+    // Resolved members, only used while children_len matches the member count.
+    displayio_group_child_t *children;
+    size_t children_len;
+    size_t children_alloc;
     displayio_buffer_transform_t absolute_transform;
     displayio_area_t dirty_area; // Catch all for changed area
     int16_t x;
@@ -51,6 +76,7 @@ typedef struct {
 } displayio_group_t;
 
 void displayio_group_construct(displayio_group_t *self, mp_obj_list_t *members, uint32_t scale, mp_int_t x, mp_int_t y);
+void displayio_group_update_children(displayio_group_t *self);
 void displayio_group_set_hidden_by_parent(displayio_group_t *self, bool hidden);
 bool displayio_group_get_previous_area(displayio_group_t *group, displayio_area_t *area);
 bool displayio_group_fill_area(displayio_group_t *group, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer);
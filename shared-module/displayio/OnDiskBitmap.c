@@ -39,9 +39,26 @@ static uint32_t read_word(uint16_t *bmp_header, uint16_t index) {
     return bmp_header[index] | bmp_header[index + 1] << 16;
 }
 
+static uint32_t pixel_from_16bit(displayio_ondiskbitmap_t *self, uint32_t pixel_data) {
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+    if (self->g_bitmask == 0x07e0) { // 565
+        red = ((pixel_data & self->r_bitmask) >> 11);
+        green = ((pixel_data & self->g_bitmask) >> 5);
+        blue = ((pixel_data & self->b_bitmask) >> 0);
+    } else { // 555
+        red = ((pixel_data & self->r_bitmask) >> 10);
+        green = ((pixel_data & self->g_bitmask) >> 4);
+        blue = ((pixel_data & self->b_bitmask) >> 0);
+    }
+    return red << 19 | green << 10 | blue << 3;
+}
+
 void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self, pyb_file_obj_t *file) {
     // Load the wave
     self->file = file;
+    vfs_fat_file_drop_buffer(file);
     uint16_t bmp_header[69];
     f_rewind(&self->file->fp);
     UINT bytes_read;
@@ -146,6 +163,75 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
         self->stride = (bit_stride / 8);
     }
 
+    self->row_cache = NULL;
+    self->row_cache_count = 0;
+    #if CIRCUITPY_ONDISKBITMAP_CACHE_SIZE > 0
+    uint16_t rows = MIN(self->height, MAX(1, CIRCUITPY_ONDISKBITMAP_CACHE_SIZE / self->stride));
+    // Without a cache we still work, just with a read per pixel.
+    self->row_cache = m_malloc_maybe(rows * self->stride);
+    self->row_cache_capacity = self->row_cache != NULL ? rows : 0;
+    #endif
+}
+
+// Returns the file data for row y, loading it and the rows above it into the
+// cache when needed. Displays refresh top to bottom, which walks the file
+// backwards, so the window ends at the requested row. Returns NULL if the
+// cache is unavailable or the read failed.
+static const uint8_t *get_row(displayio_ondiskbitmap_t *self, int16_t y) {
+    if (self->row_cache == NULL) {
+        return NULL;
+    }
+    uint16_t file_row = self->height - y - 1;
+    if ((uint16_t)(file_row - self->row_cache_first) < self->row_cache_count) {
+        return self->row_cache + (file_row - self->row_cache_first) * self->stride;
+    }
+    uint16_t first = file_row + 1 > self->row_cache_capacity ? file_row + 1 - self->row_cache_capacity : 0;
+    uint32_t length = (file_row - first + 1) * self->stride;
+    self->row_cache_count = 0;
+    UINT bytes_read;
+    if (f_lseek(&self->file->fp, self->data_offset + first * self->stride) != FR_OK ||
+        f_read(&self->file->fp, self->row_cache, length, &bytes_read) != FR_OK) {
+        return NULL;
+    }
+    // A truncated file reads as zeros.
+    memset(self->row_cache + bytes_read, 0, length - bytes_read);
+    self->row_cache_first = first;
+    self->row_cache_count = file_row - first + 1;
+    return self->row_cache + (file_row - first) * self->stride;
+}
+
+static uint32_t decode_pixel(displayio_ondiskbitmap_t *self, const uint8_t *row, int16_t x) {
+    uint8_t bytes_per_pixel = (self->bits_per_pixel / 8)  ? (self->bits_per_pixel / 8) : 1;
+    if (bytes_per_pixel == 1) {
+        uint8_t pixels_per_byte = 8 / self->bits_per_pixel;
+        uint8_t offset = (x % pixels_per_byte) * self->bits_per_pixel;
+        uint8_t mask = (1 << self->bits_per_pixel) - 1;
+        return (row[x / pixels_per_byte] >> ((8 - self->bits_per_pixel) - offset)) & mask;
+    }
+    const uint8_t *p = row + x * bytes_per_pixel;
+    if (bytes_per_pixel == 2) {
+        return pixel_from_16bit(self, p[0] | p[1] << 8);
+    } else if (bytes_per_pixel == 3) {
+        return p[0] | p[1] << 8 | p[2] << 16;
+    }
+    uint32_t pixel_data = p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+    if (self->bitfield_compressed) {
+        return pixel_data & 0x00FFFFFF;
+    }
+    return pixel_data;
+}
+
+void displayio_ondiskbitmap_get_row_pixels(displayio_ondiskbitmap_t *self, int16_t x, int16_t y, uint16_t count, uint32_t *values) {
+    const uint8_t *row = get_row(self, y);
+    if (row == NULL) {
+        for (uint16_t i = 0; i < count; i++) {
+            values[i] = common_hal_displayio_ondiskbitmap_get_pixel(self, x + i, y);
+        }
+        return;
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        values[i] = decode_pixel(self, row, x + i);
+    }
 }
 
 
@@ -155,6 +241,11 @@ uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *s
         return 0;
     }
 
+    const uint8_t *row = get_row(self, y);
+    if (row != NULL) {
+        return decode_pixel(self, row, x);
+    }
+
     uint32_t location;
     uint8_t bytes_per_pixel = (self->bits_per_pixel / 8)  ? (self->bits_per_pixel / 8) : 1;
     uint8_t pixels_per_byte = 8 / self->bits_per_pixel;
@@ -163,33 +254,19 @@ uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *s
     } else {
         location = self->data_offset + (self->height - y - 1) * self->stride + x / pixels_per_byte;
     }
-    // We don't cache here because the underlying FS caches sectors.
+    // Uncached fallback. The underlying FS caches sectors.
     f_lseek(&self->file->fp, location);
     UINT bytes_read;
     uint32_t pixel_data = 0;
     uint32_t result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
     if (result == FR_OK) {
-        uint32_t tmp = 0;
-        uint8_t red;
-        uint8_t green;
-        uint8_t blue;
         if (bytes_per_pixel == 1) {
             uint8_t offset = (x % pixels_per_byte) * self->bits_per_pixel;
             uint8_t mask = (1 << self->bits_per_pixel) - 1;
 
             return (pixel_data >> ((8 - self->bits_per_pixel) - offset)) & mask;
         } else if (bytes_per_pixel == 2) {
-            if (self->g_bitmask == 0x07e0) { // 565
-                red = ((pixel_data & self->r_bitmask) >> 11);
-                green = ((pixel_data & self->g_bitmask) >> 5);
-                blue = ((pixel_data & self->b_bitmask) >> 0);
-            } else { // 555
-                red = ((pixel_data & self->r_bitmask) >> 10);
-                green = ((pixel_data & self->g_bitmask) >> 4);
-                blue = ((pixel_data & self->b_bitmask) >> 0);
-            }
-            tmp = (red << 19 | green << 10 | blue << 3);
-            return tmp;
+            return pixel_from_16bit(self, pixel_data);
         } else if ((bytes_per_pixel == 4) && (self->bitfield_compressed)) {
             return pixel_data & 0x00FFFFFF;
         } else {
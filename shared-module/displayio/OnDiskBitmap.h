@@ -49,8 +49,18 @@ typedef struct {
         struct displayio_palette *palette;
         struct displayio_colorconverter *colorconverter;
     };
+    // Consecutive rows in file order, which is bottom-up. NULL when not cached.
+    uint8_t *row_cache;
+    uint16_t row_cache_capacity; // In rows
+    uint16_t row_cache_first; // File row of row_cache[0]
+    uint16_t row_cache_count; // Valid rows
     bool bitfield_compressed;
     uint8_t bits_per_pixel;
 } displayio_ondiskbitmap_t;
 
+// Reads count consecutive values from row y starting at x, decoded as
+// common_hal_displayio_ondiskbitmap_get_pixel does. The span must be within
+// the bitmap.
+void displayio_ondiskbitmap_get_row_pixels(displayio_ondiskbitmap_t *self, int16_t x, int16_t y, uint16_t count, uint32_t *values);
+
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_ONDISKBITMAP_H
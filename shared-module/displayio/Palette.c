@@ -65,7 +65,7 @@ void common_hal_displayio_palette_set_color(displayio_palette_t *self, uint32_t
         return;
     }
     self->colors[palette_index].rgb888 = color;
-    self->colors[palette_index].cached_colorspace = NULL;
+    self->colors[palette_index].cached = 0;
     self->needs_refresh = true;
 }
 
@@ -73,6 +73,30 @@ uint32_t common_hal_displayio_palette_get_color(displayio_palette_t *self, uint3
     return self->colors[palette_index].rgb888;
 }
 
+// Returns the index of the cached colors for colorspace, taking over the
+// oldest cache when the colorspace hasn't been seen. The grayscale settings are
+// compared too because EPaperDisplay changes them on the same object.
+STATIC uint8_t _get_cache(displayio_palette_t *self, const _displayio_colorspace_t *colorspace) {
+    for (uint8_t i = 0; i < CIRCUITPY_DISPLAYIO_PALETTE_CACHE_COLORSPACES; i++) {
+        _displayio_palette_cache_t *cache = &self->caches[i];
+        if (cache->colorspace == colorspace &&
+            cache->grayscale_bit == colorspace->grayscale_bit &&
+            cache->grayscale == colorspace->grayscale) {
+            return i;
+        }
+    }
+    uint8_t i = self->next_cache;
+    self->next_cache = (i + 1) % CIRCUITPY_DISPLAYIO_PALETTE_CACHE_COLORSPACES;
+    self->caches[i].colorspace = colorspace;
+    self->caches[i].grayscale_bit = colorspace->grayscale_bit;
+    self->caches[i].grayscale = colorspace->grayscale;
+    const uint8_t keep = ~(1 << i);
+    for (uint32_t j = 0; j < self->color_count; j++) {
+        self->colors[j].cached &= keep;
+    }
+    return i;
+}
+
 void displayio_palette_get_color(displayio_palette_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
     uint32_t palette_index = input_pixel->pixel;
     if (palette_index > self->color_count || self->colors[palette_index].transparent) {
@@ -80,27 +104,57 @@ void displayio_palette_get_color(displayio_palette_t *self, const _displayio_col
         return;
     }
 
-    // Cache results when not dithering.
     _displayio_color_t *color = &self->colors[palette_index];
-    // Check the grayscale settings because EPaperDisplay will change them on
-    // the same object.
-    if (!self->dither &&
-        color->cached_colorspace == colorspace &&
-        color->cached_colorspace_grayscale_bit == colorspace->grayscale_bit &&
-        color->cached_colorspace_grayscale == colorspace->grayscale) {
-        output_color->pixel = self->colors[palette_index].cached_color;
+    displayio_input_pixel_t rgb888_pixel = *input_pixel;
+    rgb888_pixel.pixel = color->rgb888;
+    if (self->dither) {
+        // Dithered colors depend on the pixel position so they aren't cached.
+        displayio_convert_color(colorspace, true, &rgb888_pixel, output_color);
         return;
     }
 
-    displayio_input_pixel_t rgb888_pixel = *input_pixel;
-    rgb888_pixel.pixel = self->colors[palette_index].rgb888;
-    displayio_convert_color(colorspace, self->dither, &rgb888_pixel, output_color);
-    if (!self->dither) {
-        color->cached_colorspace = colorspace;
-        color->cached_color = output_color->pixel;
-        color->cached_colorspace_grayscale = colorspace->grayscale;
-        color->cached_colorspace_grayscale_bit = colorspace->grayscale_bit;
+    uint8_t cache = _get_cache(self, colorspace);
+    if ((color->cached & (1 << cache)) != 0) {
+        output_color->pixel = color->cached_color[cache];
+        return;
+    }
+
+    displayio_convert_color(colorspace, false, &rgb888_pixel, output_color);
+    color->cached_color[cache] = output_color->pixel;
+    color->cached |= 1 << cache;
+}
+
+// Converts count palette indices in values into colors in place. Returns a bit
+// mask with bit i set when values[i] is opaque. count must be at most 32 and
+// the palette must not dither because dithering depends on pixel position.
+uint32_t displayio_palette_get_colors(displayio_palette_t *self, const _displayio_colorspace_t *colorspace, uint32_t *values, uint16_t count) {
+    uint32_t opaque = 0;
+    displayio_input_pixel_t input_pixel = {0};
+    displayio_output_pixel_t output_pixel;
+    const uint8_t cache = _get_cache(self, colorspace);
+    const uint8_t cache_bit = 1 << cache;
+    for (uint16_t i = 0; i < count; i++) {
+        uint32_t palette_index = values[i];
+        if (palette_index >= self->color_count || self->colors[palette_index].transparent) {
+            continue;
+        }
+        opaque |= 1u << i;
+        _displayio_color_t *color = &self->colors[palette_index];
+        if ((color->cached & cache_bit) != 0) {
+            values[i] = color->cached_color[cache];
+            continue;
+        }
+        input_pixel.pixel = color->rgb888;
+        output_pixel.opaque = true;
+        displayio_convert_color(colorspace, false, &input_pixel, &output_pixel);
+        if (!output_pixel.opaque) {
+            opaque &= ~(1u << i);
+        }
+        color->cached_color[cache] = output_pixel.pixel;
+        color->cached |= cache_bit;
+        values[i] = output_pixel.pixel;
     }
+    return opaque;
 }
 
 bool displayio_palette_needs_refresh(displayio_palette_t *self) {
@@ -32,6 +32,12 @@
 
 #include "py/obj.h"
 
+// Ports that don't include circuitpy_mpconfig.h (such as unix) get the same
+// default here.
+#ifndef CIRCUITPY_DISPLAYIO_PALETTE_CACHE_COLORSPACES
+#define CIRCUITPY_DISPLAYIO_PALETTE_CACHE_COLORSPACES (2)
+#endif
+
 typedef struct {
     uint8_t depth;
     uint8_t bytes_per_cell;
@@ -49,13 +55,19 @@ typedef struct {
 
 typedef struct {
     uint32_t rgb888;
-    const _displayio_colorspace_t *cached_colorspace;
-    uint32_t cached_color;
-    uint8_t cached_colorspace_grayscale_bit;
-    bool cached_colorspace_grayscale;
+    // Converted color for each of the palette's cached colorspaces.
+    uint32_t cached_color[CIRCUITPY_DISPLAYIO_PALETTE_CACHE_COLORSPACES];
+    uint8_t cached; // Bit i is set when cached_color[i] is valid.
     bool transparent; // This may have additional bits added later for blending.
 } _displayio_color_t;
 
+// Identifies the colorspace a column of cached colors was converted for.
+typedef struct {
+    const _displayio_colorspace_t *colorspace;
+    uint8_t grayscale_bit;
+    bool grayscale;
+} _displayio_palette_cache_t;
+
 typedef struct {
     uint32_t pixel;
     uint16_t x;
@@ -74,13 +86,15 @@ typedef struct displayio_palette {
     mp_obj_base_t base;
     _displayio_color_t *colors;
     uint32_t color_count;
+    _displayio_palette_cache_t caches[CIRCUITPY_DISPLAYIO_PALETTE_CACHE_COLORSPACES];
+    uint8_t next_cache; // Cache to replace when a new colorspace is used.
     bool needs_refresh;
     bool dither;
 } displayio_palette_t;
 
 
 void displayio_palette_get_color(displayio_palette_t *palette, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color);
-;
+uint32_t displayio_palette_get_colors(displayio_palette_t *self, const _displayio_colorspace_t *colorspace, uint32_t *values, uint16_t count);
 bool displayio_palette_needs_refresh(displayio_palette_t *self);
 void displayio_palette_finish_refresh(displayio_palette_t *self);
 
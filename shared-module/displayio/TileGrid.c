@@ -73,6 +73,8 @@ void common_hal_displayio_tilegrid_construct(displayio_tilegrid_t *self, mp_obj_
     self->flip_x = false;
     self->flip_y = false;
     self->transpose_xy = false;
+    self->hardware_scroll = false;
+    self->scrolled_y = 0;
     self->absolute_transform = NULL;
 }
 
@@ -376,11 +378,159 @@ bool common_hal_displayio_tilegrid_contains(displayio_tilegrid_t *self, uint16_t
 }
 
 void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint16_t x, uint16_t y) {
+    if (self->hardware_scroll && x == self->top_left_x && !self->full_change) {
+        // The display moves what it already shows, so only the rows scrolled
+        // into view need drawing. The dirty area moves up with the content.
+        uint16_t rows = ((y % self->height_in_tiles + self->height_in_tiles - self->top_left_y % self->height_in_tiles) % self->height_in_tiles) * self->tile_height;
+        if (self->scrolled_y + rows < self->pixel_height) {
+            if (rows > 0) {
+                displayio_area_t exposed = {
+                    .x1 = 0,
+                    .y1 = self->pixel_height - rows,
+                    .x2 = self->pixel_width,
+                    .y2 = self->pixel_height
+                };
+                if (self->partial_change && self->dirty_area.y2 - rows > 0) {
+                    self->dirty_area.y1 = MAX(self->dirty_area.y1 - rows, 0);
+                    self->dirty_area.y2 -= rows;
+                    displayio_area_union(&self->dirty_area, &exposed, &self->dirty_area);
+                } else {
+                    displayio_area_copy(&exposed, &self->dirty_area);
+                }
+                self->partial_change = true;
+            }
+            self->scrolled_y += rows;
+            self->top_left_y = y;
+            return;
+        }
+    }
     self->top_left_x = x;
     self->top_left_y = y;
     self->full_change = true;
 }
 
+// Fast path for unscaled, untransposed TileGrids that are drawn left to right
+// from a Bitmap or OnDiskBitmap through a non-dithering Palette or
+// ColorConverter. Pixels are fetched and converted a tile-row run at a time
+// instead of one call chain per pixel.
+STATIC bool _fill_area_spans(displayio_tilegrid_t *self, uint8_t *tiles,
+    const _displayio_colorspace_t *colorspace, uint32_t *mask, uint32_t *buffer,
+    int16_t start, int16_t y_stride, int16_t x_shift, int16_t y_shift,
+    int16_t start_x, int16_t end_x, int16_t start_y, int16_t end_y, bool full_coverage) {
+    bool on_disk = mp_obj_is_type(self->bitmap, &displayio_ondiskbitmap_type);
+    bool palette = mp_obj_is_type(self->pixel_shader, &displayio_palette_type);
+    int16_t bitmap_width;
+    int16_t bitmap_height;
+    if (on_disk) {
+        bitmap_width = common_hal_displayio_ondiskbitmap_get_width(self->bitmap);
+        bitmap_height = common_hal_displayio_ondiskbitmap_get_height(self->bitmap);
+    } else {
+        bitmap_width = common_hal_displayio_bitmap_get_width(self->bitmap);
+        bitmap_height = common_hal_displayio_bitmap_get_height(self->bitmap);
+    }
+    uint32_t values[32];
+
+    // Glyph style bitmaps of four bits or fewer are expanded through a table
+    // of their converted colors, built once for the whole area, and read from
+    // the bitmap a word at a time.
+    displayio_bitmap_t *glyphs = on_disk ? NULL : self->bitmap;
+    uint32_t expanded[16];
+    uint32_t expanded_opaque = 0;
+    if (glyphs != NULL && glyphs->bits_per_value <= 4) {
+        uint16_t value_count = 1 << glyphs->bits_per_value;
+        for (uint16_t i = 0; i < value_count; i++) {
+            expanded[i] = i;
+        }
+        expanded_opaque = palette ?
+            displayio_palette_get_colors(self->pixel_shader, colorspace, expanded, value_count) :
+            displayio_colorconverter_get_colors(self->pixel_shader, colorspace, expanded, value_count);
+    } else {
+        glyphs = NULL;
+    }
+
+    for (int16_t y = start_y; y < end_y; ++y) {
+        int16_t row_start = start + (y - start_y + y_shift) * y_stride;
+        uint16_t tile_row = ((y / self->tile_height + self->top_left_y) % self->height_in_tiles) * self->width_in_tiles;
+        uint16_t y_in_tile = y % self->tile_height;
+        int16_t offset = row_start + x_shift;
+        int16_t x = start_x;
+        while (x < end_x) {
+            uint16_t x_in_tile = x % self->tile_width;
+            uint16_t count = MIN(end_x - x, self->tile_width - x_in_tile);
+            count = MIN(count, MP_ARRAY_SIZE(values));
+            uint8_t tile = tiles[tile_row + (x / self->tile_width + self->top_left_x) % self->width_in_tiles];
+            int16_t tile_x = (tile % self->bitmap_width_in_tiles) * self->tile_width + x_in_tile;
+            int16_t tile_y = (tile / self->bitmap_width_in_tiles) * self->tile_height + y_in_tile;
+
+            if (glyphs != NULL && tile_x >= 0 && tile_x + count <= bitmap_width && tile_y >= 0 && tile_y < bitmap_height) {
+                const uint32_t *row = glyphs->data + tile_y * glyphs->stride;
+                uint8_t bits_per_value = glyphs->bits_per_value;
+                uint32_t word = row[tile_x >> glyphs->x_shift] << ((tile_x & glyphs->x_mask) * bits_per_value);
+                for (uint16_t i = 0; i < count; i++, offset++) {
+                    if (i > 0 && ((tile_x + i) & glyphs->x_mask) == 0) {
+                        word = row[(tile_x + i) >> glyphs->x_shift];
+                    }
+                    uint32_t value = word >> (32 - bits_per_value);
+                    word <<= bits_per_value;
+                    if ((mask[offset / 32] & (1 << (offset % 32))) != 0) {
+                        continue;
+                    }
+                    if ((expanded_opaque & (1u << value)) == 0) {
+                        full_coverage = false;
+                        continue;
+                    }
+                    mask[offset / 32] |= 1 << (offset % 32);
+                    if (colorspace->depth == 16) {
+                        *(((uint16_t *)buffer) + offset) = expanded[value];
+                    } else if (colorspace->depth == 32) {
+                        *(((uint32_t *)buffer) + offset) = expanded[value];
+                    } else {
+                        *(((uint8_t *)buffer) + offset) = expanded[value];
+                    }
+                }
+                x += count;
+                continue;
+            }
+
+            if (tile_x < 0 || tile_x + count > bitmap_width || tile_y < 0 || tile_y >= bitmap_height) {
+                // Out of range pixels read as zero. Match the per-pixel path.
+                for (uint16_t i = 0; i < count; i++) {
+                    values[i] = on_disk ?
+                        common_hal_displayio_ondiskbitmap_get_pixel(self->bitmap, tile_x + i, tile_y) :
+                        common_hal_displayio_bitmap_get_pixel(self->bitmap, tile_x + i, tile_y);
+                }
+            } else if (on_disk) {
+                displayio_ondiskbitmap_get_row_pixels(self->bitmap, tile_x, tile_y, count, values);
+            } else {
+                displayio_bitmap_get_row_pixels(self->bitmap, tile_x, tile_y, count, values);
+            }
+            uint32_t opaque = palette ?
+                displayio_palette_get_colors(self->pixel_shader, colorspace, values, count) :
+                displayio_colorconverter_get_colors(self->pixel_shader, colorspace, values, count);
+
+            for (uint16_t i = 0; i < count; i++, offset++) {
+                if ((mask[offset / 32] & (1 << (offset % 32))) != 0) {
+                    continue;
+                }
+                if ((opaque & (1u << i)) == 0) {
+                    full_coverage = false;
+                    continue;
+                }
+                mask[offset / 32] |= 1 << (offset % 32);
+                if (colorspace->depth == 16) {
+                    *(((uint16_t *)buffer) + offset) = values[i];
+                } else if (colorspace->depth == 32) {
+                    *(((uint32_t *)buffer) + offset) = values[i];
+                } else {
+                    *(((uint8_t *)buffer) + offset) = values[i];
+                }
+            }
+            x += count;
+        }
+    }
+    return full_coverage;
+}
+
 bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     const _displayio_colorspace_t *colorspace, const displayio_area_t *area,
     uint32_t *mask, uint32_t *buffer) {
@@ -468,6 +618,19 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
         y_shift = temp_shift;
     }
 
+    if (self->transpose_xy == self->absolute_transform->transpose_xy &&
+        x_stride == 1 && self->absolute_transform->scale == 1 &&
+        colorspace->depth >= 8 &&
+        (mp_obj_is_type(self->bitmap, &displayio_bitmap_type) ||
+         mp_obj_is_type(self->bitmap, &displayio_ondiskbitmap_type)) &&
+        ((mp_obj_is_type(self->pixel_shader, &displayio_palette_type) &&
+          !((displayio_palette_t *)MP_OBJ_TO_PTR(self->pixel_shader))->dither) ||
+         (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type) &&
+          !((displayio_colorconverter_t *)MP_OBJ_TO_PTR(self->pixel_shader))->dither))) {
+        return _fill_area_spans(self, tiles, colorspace, mask, buffer, start, y_stride,
+            x_shift, y_shift, start_x, end_x, start_y, end_y, full_coverage);
+    }
+
     uint8_t pixels_per_byte = 8 / colorspace->depth;
 
     displayio_input_pixel_t input_pixel;
@@ -563,6 +726,7 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     self->moved = false;
     self->full_change = false;
     self->partial_change = false;
+    self->bitmap_dirty_area_count = 0;
     if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
         displayio_palette_finish_refresh(self->pixel_shader);
     } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
@@ -578,6 +742,51 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     // That way they won't change during a refresh and tear.
 }
 
+// Converts an area relative to the TileGrid's pixels into absolute display
+// coordinates in place.
+STATIC void _transform_relative_area(displayio_tilegrid_t *self, displayio_area_t *area) {
+    int16_t x = self->x;
+    int16_t y = self->y;
+    if (self->absolute_transform->transpose_xy) {
+        int16_t temp = y;
+        y = x;
+        x = temp;
+    }
+    int16_t x1 = area->x1;
+    int16_t x2 = area->x2;
+    if (self->flip_x) {
+        x1 = self->pixel_width - x1;
+        x2 = self->pixel_width - x2;
+    }
+    int16_t y1 = area->y1;
+    int16_t y2 = area->y2;
+    if (self->flip_y) {
+        y1 = self->pixel_height - y1;
+        y2 = self->pixel_height - y2;
+    }
+    if (self->transpose_xy != self->absolute_transform->transpose_xy) {
+        int16_t temp1 = y1, temp2 = y2;
+        y1 = x1;
+        x1 = temp1;
+        y2 = x2;
+        x2 = temp2;
+    }
+    area->x1 = self->absolute_transform->x + self->absolute_transform->dx * (x + x1);
+    area->y1 = self->absolute_transform->y + self->absolute_transform->dy * (y + y1);
+    area->x2 = self->absolute_transform->x + self->absolute_transform->dx * (x + x2);
+    area->y2 = self->absolute_transform->y + self->absolute_transform->dy * (y + y2);
+    if (area->y2 < area->y1) {
+        int16_t temp = area->y2;
+        area->y2 = area->y1;
+        area->y1 = temp;
+    }
+    if (area->x2 < area->x1) {
+        int16_t temp = area->x2;
+        area->x2 = area->x1;
+        area->x1 = temp;
+    }
+}
+
 displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *self, displayio_area_t *tail) {
     bool first_draw = self->previous_area.x1 == self->previous_area.x2;
     bool hidden = self->hidden || self->hidden_by_parent;
@@ -606,10 +815,15 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
         displayio_area_t *refresh_area = displayio_bitmap_get_refresh_areas(self->bitmap, tail);
         if (refresh_area != tail) {
             // Special case a TileGrid that shows a full bitmap and use its
-            // dirty area. Copy it to ours so we can transform it.
+            // dirty areas. Copy them to ours so we can transform them.
             if (self->tiles_in_bitmap == 1) {
-                displayio_area_copy(refresh_area, &self->dirty_area);
-                self->partial_change = true;
+                size_t count = 0;
+                for (const displayio_area_t *area = refresh_area;
+                     area != tail && count < CIRCUITPY_DISPLAYIO_BITMAP_DIRTY_AREAS;
+                     area = area->next) {
+                    displayio_area_copy(area, &self->bitmap_dirty_areas[count++]);
+                }
+                self->bitmap_dirty_area_count = count;
             } else {
                 self->full_change = true;
             }
@@ -626,48 +840,15 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
         return &self->current_area;
     }
 
-    if (self->partial_change) {
-        int16_t x = self->x;
-        int16_t y = self->y;
-        if (self->absolute_transform->transpose_xy) {
-            int16_t temp = y;
-            y = x;
-            x = temp;
-        }
-        int16_t x1 = self->dirty_area.x1;
-        int16_t x2 = self->dirty_area.x2;
-        if (self->flip_x) {
-            x1 = self->pixel_width - x1;
-            x2 = self->pixel_width - x2;
-        }
-        int16_t y1 = self->dirty_area.y1;
-        int16_t y2 = self->dirty_area.y2;
-        if (self->flip_y) {
-            y1 = self->pixel_height - y1;
-            y2 = self->pixel_height - y2;
-        }
-        if (self->transpose_xy != self->absolute_transform->transpose_xy) {
-            int16_t temp1 = y1, temp2 = y2;
-            y1 = x1;
-            x1 = temp1;
-            y2 = x2;
-            x2 = temp2;
-        }
-        self->dirty_area.x1 = self->absolute_transform->x + self->absolute_transform->dx * (x + x1);
-        self->dirty_area.y1 = self->absolute_transform->y + self->absolute_transform->dy * (y + y1);
-        self->dirty_area.x2 = self->absolute_transform->x + self->absolute_transform->dx * (x + x2);
-        self->dirty_area.y2 = self->absolute_transform->y + self->absolute_transform->dy * (y + y2);
-        if (self->dirty_area.y2 < self->dirty_area.y1) {
-            int16_t temp = self->dirty_area.y2;
-            self->dirty_area.y2 = self->dirty_area.y1;
-            self->dirty_area.y1 = temp;
-        }
-        if (self->dirty_area.x2 < self->dirty_area.x1) {
-            int16_t temp = self->dirty_area.x2;
-            self->dirty_area.x2 = self->dirty_area.x1;
-            self->dirty_area.x1 = temp;
-        }
+    for (size_t i = 0; i < self->bitmap_dirty_area_count; i++) {
+        displayio_area_t *area = &self->bitmap_dirty_areas[i];
+        _transform_relative_area(self, area);
+        area->next = tail;
+        tail = area;
+    }
 
+    if (self->partial_change) {
+        _transform_relative_area(self, &self->dirty_area);
         self->dirty_area.next = tail;
         return &self->dirty_area;
     }
@@ -32,6 +32,7 @@
 
 #include "py/obj.h"
 #include "shared-module/displayio/area.h"
+#include "shared-module/displayio/Bitmap.h"
 #include "shared-module/displayio/Palette.h"
 
 typedef struct {
@@ -51,11 +52,15 @@ typedef struct {
     uint16_t tile_height;
     uint16_t top_left_x;
     uint16_t top_left_y;
+    uint16_t scrolled_y; // Pixels scrolled up since the last refresh, for hardware_scroll.
     uint8_t *tiles;
     const displayio_buffer_transform_t *absolute_transform;
     displayio_area_t dirty_area; // Stored as a relative area until the refresh area is fetched.
     displayio_area_t previous_area; // Stored as an absolute area.
     displayio_area_t current_area; // Stored as an absolute area so it applies across frames.
+    // Copies of a full Bitmap's dirty areas, transformed when the refresh areas are fetched.
+    displayio_area_t bitmap_dirty_areas[CIRCUITPY_DISPLAYIO_BITMAP_DIRTY_AREAS];
+    uint8_t bitmap_dirty_area_count;
     bool partial_change : 1;
     bool full_change : 1;
     bool moved : 1;
@@ -67,7 +72,8 @@ typedef struct {
     bool hidden : 1;
     bool hidden_by_parent : 1;
     bool rendered_hidden : 1;
-    uint8_t padding : 6;
+    bool hardware_scroll : 1; // The display moves the pixels when top_left_y changes.
+    uint8_t padding : 5;
 } displayio_tilegrid_t;
 
 void displayio_tilegrid_set_hidden_by_parent(displayio_tilegrid_t *self, bool hidden);
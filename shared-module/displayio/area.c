@@ -112,6 +112,70 @@ void displayio_area_union(const displayio_area_t *a,
     u->y2 = MAX(a->y2, b->y2);
 }
 
+// Merge two areas when refreshing their union costs no more than refreshing them
+// separately. Overdraw is allowed up to DISPLAYIO_AREA_MERGE_OVERDRAW_PERCENT of
+// the separate sizes plus the per-area overhead given in pixels (such as the
+// commands needed to set a display window).
+bool displayio_area_should_merge(const displayio_area_t *a, const displayio_area_t *b, uint32_t area_overhead) {
+    displayio_area_t u;
+    displayio_area_union(a, b, &u);
+    uint32_t separate = displayio_area_size(a) + displayio_area_size(b);
+    return displayio_area_size(&u) * 100 <= separate * DISPLAYIO_AREA_MERGE_OVERDRAW_PERCENT + area_overhead * 100;
+}
+
+// Merges area i with every other area the policy allows, repeating until no
+// more merges happen. Returns the new number of areas.
+STATIC size_t _merge_into(displayio_area_t *areas, size_t count, size_t i, uint32_t area_overhead) {
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (size_t j = 0; j < count; j++) {
+            if (j == i || !displayio_area_should_merge(&areas[i], &areas[j], area_overhead)) {
+                continue;
+            }
+            displayio_area_union(&areas[i], &areas[j], &areas[i]);
+            count--;
+            if (j != count) {
+                displayio_area_copy(&areas[count], &areas[j]);
+                if (i == count) {
+                    i = j;
+                }
+            }
+            merged = true;
+            break;
+        }
+    }
+    return count;
+}
+
+// Adds area to the count areas in the array, merging it with the ones that are
+// cheaper to refresh together. When all max_count slots are in use, area grows
+// the one that gains the fewest extra pixels. Returns the new number of areas.
+size_t displayio_area_add_merged(displayio_area_t *areas, size_t count, size_t max_count,
+    const displayio_area_t *area, uint32_t area_overhead) {
+    displayio_area_t added;
+    displayio_area_copy(area, &added);
+    size_t i = count;
+    if (count < max_count) {
+        count++;
+    } else {
+        // Out of space so grow the area that gains the fewest extra pixels.
+        uint32_t best_growth = UINT32_MAX;
+        for (size_t j = 0; j < count; j++) {
+            displayio_area_t u;
+            displayio_area_union(&areas[j], &added, &u);
+            uint32_t growth = displayio_area_size(&u) - displayio_area_size(&areas[j]);
+            if (growth < best_growth) {
+                best_growth = growth;
+                i = j;
+            }
+        }
+        displayio_area_union(&areas[i], &added, &added);
+    }
+    displayio_area_copy(&added, &areas[i]);
+    return _merge_into(areas, count, i, area_overhead);
+}
+
 uint16_t displayio_area_width(const displayio_area_t *area) {
     return area->x2 - area->x1;
 }
@@ -27,10 +27,17 @@
 #ifndef MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_AREA_H
 #define MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_AREA_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 
 // Implementations are in area.c
+
+// Maximum size of a merged area relative to the sum of the areas it replaces.
+#ifndef DISPLAYIO_AREA_MERGE_OVERDRAW_PERCENT
+#define DISPLAYIO_AREA_MERGE_OVERDRAW_PERCENT (130)
+#endif
+
 typedef struct _displayio_area_t displayio_area_t;
 
 struct _displayio_area_t {
@@ -68,6 +75,9 @@ void displayio_area_shift(displayio_area_t *area, int16_t dx, int16_t dy);
 bool displayio_area_compute_overlap(const displayio_area_t *a,
     const displayio_area_t *b,
     displayio_area_t *overlap);
+bool displayio_area_should_merge(const displayio_area_t *a, const displayio_area_t *b, uint32_t area_overhead);
+size_t displayio_area_add_merged(displayio_area_t *areas, size_t count, size_t max_count,
+    const displayio_area_t *area, uint32_t area_overhead);
 uint16_t displayio_area_width(const displayio_area_t *area);
 uint16_t displayio_area_height(const displayio_area_t *area);
 uint32_t displayio_area_size(const displayio_area_t *area);
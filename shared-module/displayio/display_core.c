@@ -31,6 +31,7 @@
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
+#include "shared-module/displayio/dither.h"
 #include "supervisor/shared/display.h"
 #include "supervisor/shared/tick.h"
 
@@ -196,6 +197,55 @@ bool displayio_display_core_fill_area(displayio_display_core_t *self, displayio_
     return false;
 }
 
+// Luminance is rendered at most this many bytes at a time when dithering.
+#define DITHER_BAND_BYTES (512)
+
+// Groups render into this for dithered refreshes. It lives as long as the
+// firmware because ColorConverter caches by colorspace address.
+STATIC const _displayio_colorspace_t luma_colorspace = {
+    .depth = 8,
+    .bytes_per_cell = 1,
+    .grayscale = true,
+    .grayscale_bit = 0,
+    .pixels_in_byte_share_row = true,
+};
+
+bool displayio_display_core_fill_area_dithered(displayio_display_core_t *self, displayio_area_t *area, uint32_t *buffer) {
+    if (self->current_group == NULL) {
+        return false;
+    }
+    uint16_t width = displayio_area_width(area);
+    uint16_t height = displayio_area_height(area);
+    uint16_t rows_per_band = MAX(1, DITHER_BAND_BYTES / width);
+    size_t band_pixels = (size_t)rows_per_band * width;
+    uint32_t luma[(band_pixels + 3) / 4];
+    uint32_t mask[band_pixels / 32 + 1];
+    uint8_t *out = (uint8_t *)buffer;
+    bool lsb_first = !self->colorspace.reverse_pixels_in_byte;
+
+    // The ordered kernel needs no state between bands, and its pattern stays
+    // put when only part of the display is redrawn.
+    displayio_dither_t dither;
+    displayio_dither_init(&dither, DISPLAYIO_DITHER_ORDERED, width, NULL);
+    bool full_coverage = true;
+    for (uint16_t y = 0; y < height; y += rows_per_band) {
+        displayio_area_t band = {
+            .x1 = area->x1,
+            .y1 = area->y1 + y,
+            .x2 = area->x2,
+            .y2 = MIN(area->y2, area->y1 + y + rows_per_band),
+        };
+        memset(luma, 0, sizeof(luma));
+        memset(mask, 0, sizeof(mask));
+        full_coverage &= displayio_group_fill_area(self->current_group, &luma_colorspace, &band, mask, luma);
+        for (int16_t row = band.y1; row < band.y2; row++) {
+            displayio_dither_row(&dither, (uint8_t *)luma + (row - band.y1) * width,
+                band.x1, row, out + (row - area->y1) * (width / 8), lsb_first);
+        }
+    }
+    return full_coverage;
+}
+
 bool displayio_display_core_clip_area(displayio_display_core_t *self, const displayio_area_t *area, displayio_area_t *clipped) {
     bool overlaps = displayio_area_compute_overlap(&self->area, area, clipped);
     if (!overlaps) {
@@ -223,3 +273,23 @@ bool displayio_display_core_clip_area(displayio_display_core_t *self, const disp
     }
     return true;
 }
+
+// Clips the given refresh areas to the display and merges the ones that are
+// cheaper to refresh together. area_overhead is the fixed cost of refreshing
+// one area expressed in pixels. The returned list lives in self and is valid
+// until the next call.
+const displayio_area_t *displayio_display_core_coalesce_areas(displayio_display_core_t *self, const displayio_area_t *first, uint32_t area_overhead) {
+    displayio_area_t *areas = self->coalesced_areas;
+    size_t count = 0;
+    for (const displayio_area_t *area = first; area != NULL; area = area->next) {
+        displayio_area_t clipped;
+        if (!displayio_display_core_clip_area(self, area, &clipped)) {
+            continue;
+        }
+        count = displayio_area_add_merged(areas, count, CIRCUITPY_DISPLAY_COALESCED_AREAS, &clipped, area_overhead);
+    }
+    for (size_t i = 0; i < count; i++) {
+        areas[i].next = i + 1 < count ? &areas[i + 1] : NULL;
+    }
+    return count > 0 ? areas : NULL;
+}
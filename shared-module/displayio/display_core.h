@@ -38,6 +38,8 @@ typedef struct {
     uint64_t last_refresh;
     displayio_buffer_transform_t transform;
     displayio_area_t area;
+    // Storage for the refresh areas after they've been clipped and merged.
+    displayio_area_t coalesced_areas[CIRCUITPY_DISPLAY_COALESCED_AREAS];
     uint16_t width;
     uint16_t height;
     uint16_t rotation;
@@ -70,4 +72,10 @@ void displayio_display_core_collect_ptrs(displayio_display_core_t *self);
 
 bool displayio_display_core_fill_area(displayio_display_core_t *self, displayio_area_t *area, uint32_t *mask, uint32_t *buffer);
 
+// Fills a one bit per pixel area, rows packed together, by dithering the
+// group's luminance. The area must be byte aligned.
+bool displayio_display_core_fill_area_dithered(displayio_display_core_t *self, displayio_area_t *area, uint32_t *buffer);
+
 bool displayio_display_core_clip_area(displayio_display_core_t *self, const displayio_area_t *area, displayio_area_t *clipped);
+
+const displayio_area_t *displayio_display_core_coalesce_areas(displayio_display_core_t *self, const displayio_area_t *first, uint32_t area_overhead);
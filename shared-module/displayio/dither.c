@@ -0,0 +1,150 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-module/displayio/dither.h"
+
+#include <string.h>
+
+#include "py/mpconfig.h"
+
+#define T(b) ((b) * 4 + 2)
+
+// An 8x8 Bayer matrix scaled to thresholds between 2 and 254.
+STATIC const uint8_t bayer_thresholds[8][8] = {
+    {T(0), T(32), T(8), T(40), T(2), T(34), T(10), T(42)},
+    {T(48), T(16), T(56), T(24), T(50), T(18), T(58), T(26)},
+    {T(12), T(44), T(4), T(36), T(14), T(46), T(6), T(38)},
+    {T(60), T(28), T(52), T(20), T(62), T(30), T(54), T(22)},
+    {T(3), T(35), T(11), T(43), T(1), T(33), T(9), T(41)},
+    {T(51), T(19), T(59), T(27), T(49), T(17), T(57), T(25)},
+    {T(15), T(47), T(7), T(39), T(13), T(45), T(5), T(37)},
+    {T(63), T(31), T(55), T(23), T(61), T(29), T(53), T(21)},
+};
+
+#undef T
+
+static inline void set_white(uint8_t *out, int i, bool lsb_first) {
+    out[i >> 3] |= lsb_first ? (1 << (i & 7)) : (0x80 >> (i & 7));
+}
+
+void displayio_dither_init(displayio_dither_t *self, displayio_dither_kernel_t kernel, uint16_t width, int16_t *error) {
+    self->kernel = kernel;
+    self->width = width;
+    self->reverse = false;
+    if (kernel == DISPLAYIO_DITHER_ORDERED) {
+        self->error[0] = self->error[1] = NULL;
+        return;
+    }
+    memset(error, 0, DISPLAYIO_DITHER_ERROR_LENGTH(width) * sizeof(int16_t));
+    // Skip the padding so pixel -1 and pixel width can be written.
+    self->error[0] = error + 1;
+    self->error[1] = error + width + 3;
+}
+
+STATIC void dither_row_ordered(displayio_dither_t *self, const uint8_t *luma, uint16_t x, uint16_t y, uint8_t *out, bool lsb_first) {
+    const uint8_t *thresholds = bayer_thresholds[y & 7];
+    for (int i = 0; i < self->width; i++) {
+        if (luma[i] > thresholds[(x + i) & 7]) {
+            set_white(out, i, lsb_first);
+        }
+    }
+}
+
+// Atkinson passes on 6/8 of the error: 1/8 to each of the next two pixels, the
+// three pixels below and the pixel two rows down. The two-rows-down share is
+// stored where this row's incoming error was just read, since that row of
+// errors becomes the one after next.
+STATIC void dither_row_atkinson(displayio_dither_t *self, const uint8_t *luma, uint8_t *out, bool lsb_first) {
+    int16_t *cur = self->error[0];
+    int16_t *next = self->error[1];
+    int width = self->width;
+    int dir = self->reverse ? -1 : 1;
+    int i = self->reverse ? width - 1 : 0;
+    int carry1 = 0, carry2 = 0;
+    for (int n = 0; n < width; n++, i += dir) {
+        int pixel = luma[i] + cur[i] + carry1;
+        bool white = pixel >= 128;
+        if (white) {
+            set_white(out, i, lsb_first);
+            pixel -= 255;
+        }
+        int share = pixel / 8;
+        carry1 = carry2 + share;
+        carry2 = share;
+        next[i - dir] += share;
+        next[i] += share;
+        next[i + dir] += share;
+        cur[i] = share;
+    }
+}
+
+// Floyd-Steinberg passes on all of the error: 7/16 to the next pixel and 3/16,
+// 5/16 and 1/16 to the pixels below.
+STATIC void dither_row_floyd_steinberg(displayio_dither_t *self, const uint8_t *luma, uint8_t *out, bool lsb_first) {
+    int16_t *cur = self->error[0];
+    int16_t *next = self->error[1];
+    int width = self->width;
+    int dir = self->reverse ? -1 : 1;
+    int i = self->reverse ? width - 1 : 0;
+    int carry = 0;
+    for (int n = 0; n < width; n++, i += dir) {
+        int pixel = luma[i] + cur[i] + carry;
+        bool white = pixel >= 128;
+        if (white) {
+            set_white(out, i, lsb_first);
+            pixel -= 255;
+        }
+        int share3 = pixel * 3 / 16;
+        int share5 = pixel * 5 / 16;
+        int share1 = pixel / 16;
+        carry = pixel - share3 - share5 - share1;
+        next[i - dir] += share3;
+        next[i] += share5;
+        next[i + dir] += share1;
+        cur[i] = 0;
+    }
+}
+
+void displayio_dither_row(displayio_dither_t *self, const uint8_t *luma, uint16_t x, uint16_t y, uint8_t *out, bool lsb_first) {
+    memset(out, 0, (self->width + 7) / 8);
+    if (self->kernel == DISPLAYIO_DITHER_ORDERED) {
+        dither_row_ordered(self, luma, x, y, out, lsb_first);
+        return;
+    }
+    if (self->kernel == DISPLAYIO_DITHER_ATKINSON) {
+        dither_row_atkinson(self, luma, out, lsb_first);
+    } else {
+        dither_row_floyd_steinberg(self, luma, out, lsb_first);
+    }
+
+    // Roll the rows. The padding of the new next row has collected error that
+    // belongs to no pixel.
+    int16_t *done = self->error[0];
+    self->error[0] = self->error[1];
+    self->error[1] = done;
+    done[-1] = done[self->width] = 0;
+    self->reverse = !self->reverse;
+}
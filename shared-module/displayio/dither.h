@@ -0,0 +1,64 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_DITHER_H
+#define MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_DITHER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Kernels that reduce rows of 8-bit luminance to one bit per pixel, for
+// bitmaptools.dither and for 1-bit displays that dither as they refresh.
+typedef enum {
+    // Compares against an 8x8 Bayer matrix. Needs no state, and the pattern
+    // stays in place when only part of an image is redrawn.
+    DISPLAYIO_DITHER_ORDERED,
+    DISPLAYIO_DITHER_ATKINSON,
+    DISPLAYIO_DITHER_FLOYD_STEINBERG,
+} displayio_dither_kernel_t;
+
+// The number of int16_t the error diffusion kernels need for rows of width
+// pixels: two rows carrying error forward, with a pixel of padding at each end.
+#define DISPLAYIO_DITHER_ERROR_LENGTH(width) (2 * ((width) + 2))
+
+typedef struct {
+    int16_t *error[2]; // Error for the next row and the one after.
+    uint16_t width;
+    displayio_dither_kernel_t kernel;
+    bool reverse; // Error diffusion goes right to left on alternate rows.
+} displayio_dither_t;
+
+// error must hold DISPLAYIO_DITHER_ERROR_LENGTH(width) values, or may be NULL
+// for the ordered kernel.
+void displayio_dither_init(displayio_dither_t *self, displayio_dither_kernel_t kernel, uint16_t width, int16_t *error);
+
+// Dithers the next width luminance values into (width + 7) / 8 bytes of out,
+// where a set bit is white. Bits go most significant first unless lsb_first.
+// x and y place the row for the ordered kernel; error diffusion expects rows
+// in order.
+void displayio_dither_row(displayio_dither_t *self, const uint8_t *luma, uint16_t x, uint16_t y, uint8_t *out, bool lsb_first);
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_DITHER_H
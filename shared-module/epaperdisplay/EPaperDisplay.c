@@ -42,6 +42,9 @@
 
 #define DELAY 0x80
 
+// Cost of sending one more update window, in pixels.
+#define AREA_COMMAND_OVERHEAD (64)
+
 void common_hal_epaperdisplay_epaperdisplay_construct(epaperdisplay_epaperdisplay_obj_t *self,
     mp_obj_t bus, const uint8_t *start_sequence, uint16_t start_sequence_len, mp_float_t start_up_time,
     const uint8_t *stop_sequence, uint16_t stop_sequence_len,
@@ -96,6 +99,11 @@ void common_hal_epaperdisplay_epaperdisplay_construct(epaperdisplay_epaperdispla
     self->stop_sequence_len = stop_sequence_len;
     self->refresh_sequence = refresh_sequence;
     self->refresh_sequence_len = refresh_sequence_len;
+    self->partial_refresh_sequence = NULL;
+    self->partial_refresh_sequence_len = 0;
+    self->full_refresh_interval = 1;
+    self->partial_refreshes = 0;
+    self->partial_refresh = false;
 
     self->busy.base.type = &mp_type_NoneType;
     self->two_byte_sequence_length = two_byte_sequence_length;
@@ -119,7 +127,16 @@ bool common_hal_epaperdisplay_epaperdisplay_set_root_group(epaperdisplay_epaperd
     return displayio_display_core_set_root_group(&self->core, root_group);
 }
 
+void common_hal_epaperdisplay_epaperdisplay_set_partial_refresh(epaperdisplay_epaperdisplay_obj_t *self,
+    const uint8_t *partial_refresh_sequence, uint16_t partial_refresh_sequence_len, uint16_t full_refresh_interval) {
+    self->partial_refresh_sequence = partial_refresh_sequence;
+    self->partial_refresh_sequence_len = partial_refresh_sequence_len;
+    self->full_refresh_interval = full_refresh_interval;
+    self->partial_refreshes = 0;
+}
+
 STATIC const displayio_area_t *epaperdisplay_epaperdisplay_get_refresh_areas(epaperdisplay_epaperdisplay_obj_t *self) {
+    self->partial_refresh = false;
     if (self->core.full_refresh) {
         self->core.area.next = NULL;
         return &self->core.area;
@@ -133,6 +150,12 @@ STATIC const displayio_area_t *epaperdisplay_epaperdisplay_get_refresh_areas(epa
         self->core.area.next = NULL;
         return &self->core.area;
     }
+    if (first_area != NULL && self->partial_refresh_sequence != NULL && !self->acep) {
+        // Only the changed windows are rewritten, so the panel can update just
+        // them until it is due a full refresh to clear the ghosting.
+        self->partial_refresh = self->partial_refreshes + 1 < self->full_refresh_interval;
+        return displayio_display_core_coalesce_areas(&self->core, first_area, AREA_COMMAND_OVERHEAD);
+    }
     return first_area;
 }
 
@@ -223,11 +246,31 @@ uint32_t common_hal_epaperdisplay_epaperdisplay_get_time_to_refresh(epaperdispla
     return self->milliseconds_per_frame - elapsed_time;
 }
 
+STATIC void _refresh_done(epaperdisplay_epaperdisplay_obj_t *self) {
+    if (self->busy.base.type != &digitalio_digitalinout_type) {
+        supervisor_disable_tick();
+    }
+    self->refreshing = false;
+    // Run stop sequence but don't wait for busy because busy is set when sleeping.
+    send_command_sequence(self, false, self->stop_sequence, self->stop_sequence_len);
+}
+
 STATIC void epaperdisplay_epaperdisplay_finish_refresh(epaperdisplay_epaperdisplay_obj_t *self) {
     // Actually refresh the display now that all pixel RAM has been updated.
-    send_command_sequence(self, false, self->refresh_sequence, self->refresh_sequence_len);
+    if (self->partial_refresh) {
+        send_command_sequence(self, false, self->partial_refresh_sequence, self->partial_refresh_sequence_len);
+        self->partial_refreshes++;
+    } else {
+        send_command_sequence(self, false, self->refresh_sequence, self->refresh_sequence_len);
+        self->partial_refreshes = 0;
+    }
 
-    supervisor_enable_tick();
+    // With a busy pin, the end of the refresh is noticed whenever something
+    // next checks: a refresh, reading busy, or any other background tick. The
+    // board can idle meanwhile. Otherwise, ticks keep time for refresh_time.
+    if (self->busy.base.type != &digitalio_digitalinout_type) {
+        supervisor_enable_tick();
+    }
     self->refreshing = true;
 
     displayio_display_core_finish_refresh(&self->core);
@@ -259,6 +302,15 @@ uint16_t common_hal_epaperdisplay_epaperdisplay_get_rotation(epaperdisplay_epape
     return self->core.rotation;
 }
 
+bool common_hal_epaperdisplay_epaperdisplay_get_dither(epaperdisplay_epaperdisplay_obj_t *self) {
+    return displayio_display_core_get_dither(&self->core);
+}
+
+void common_hal_epaperdisplay_epaperdisplay_set_dither(epaperdisplay_epaperdisplay_obj_t *self, bool dither) {
+    displayio_display_core_set_dither(&self->core, dither);
+    self->core.full_refresh = true;
+}
+
 mp_obj_t common_hal_epaperdisplay_epaperdisplay_get_root_group(epaperdisplay_epaperdisplay_obj_t *self) {
     if (self->core.current_group == NULL) {
         return mp_const_none;
@@ -300,6 +352,12 @@ STATIC bool epaperdisplay_epaperdisplay_refresh_area(epaperdisplay_epaperdisplay
     volatile uint32_t mask_length = (pixels_per_buffer / 32) + 1;
     uint32_t mask[mask_length];
 
+    // Black and white panels can dither the black pass as it is converted.
+    // Grayscale, tricolor and seven color panels already have their shades.
+    bool dither = self->core.colorspace.dither && self->core.colorspace.depth == 1 && !self->grayscale &&
+        !self->core.colorspace.tricolor && !self->core.colorspace.sevencolor &&
+        self->core.colorspace.pixels_in_byte_share_row;
+
     uint8_t passes = 1;
     if (self->write_color_ram_command != NO_COMMAND) {
         passes = 2;
@@ -351,6 +409,8 @@ STATIC bool epaperdisplay_epaperdisplay_refresh_area(epaperdisplay_epaperdisplay
                 } else if (self->core.colorspace.sevencolor) {
                     displayio_display_core_fill_area(&self->core, &subrectangle, mask, buffer);
                 }
+            } else if (dither) {
+                displayio_display_core_fill_area_dithered(&self->core, &subrectangle, buffer);
             } else {
                 displayio_display_core_fill_area(&self->core, &subrectangle, mask, buffer);
             }
@@ -415,10 +475,7 @@ bool common_hal_epaperdisplay_epaperdisplay_refresh(epaperdisplay_epaperdisplay_
 
     if (self->refreshing && self->busy.base.type == &digitalio_digitalinout_type) {
         if (common_hal_digitalio_digitalinout_get_value(&self->busy) != self->busy_state) {
-            supervisor_disable_tick();
-            self->refreshing = false;
-            // Run stop sequence but don't wait for busy because busy is set when sleeping.
-            send_command_sequence(self, false, self->stop_sequence, self->stop_sequence_len);
+            _refresh_done(self);
         } else {
             return false;
         }
@@ -444,6 +501,7 @@ bool common_hal_epaperdisplay_epaperdisplay_refresh(epaperdisplay_epaperdisplay_
         epaperdisplay_epaperdisplay_finish_refresh(self);
         while (self->refreshing && !mp_hal_is_interrupted()) {
             RUN_BACKGROUND_TASKS;
+            epaperdisplay_epaperdisplay_background(self);
         }
     }
     if (mp_hal_is_interrupted()) {
@@ -469,10 +527,7 @@ void epaperdisplay_epaperdisplay_background(epaperdisplay_epaperdisplay_obj_t *s
             refresh_done = supervisor_ticks_ms64() - self->core.last_refresh > self->refresh_time;
         }
         if (refresh_done) {
-            supervisor_disable_tick();
-            self->refreshing = false;
-            // Run stop sequence but don't wait for busy because busy is set when sleeping.
-            send_command_sequence(self, false, self->stop_sequence, self->stop_sequence_len);
+            _refresh_done(self);
         }
     }
 }
@@ -485,10 +540,7 @@ bool common_hal_epaperdisplay_epaperdisplay_get_busy(epaperdisplay_epaperdisplay
 void release_epaperdisplay(epaperdisplay_epaperdisplay_obj_t *self) {
     if (self->refreshing) {
         wait_for_busy(self);
-        supervisor_disable_tick();
-        self->refreshing = false;
-        // Run stop sequence but don't wait for busy because busy is set when sleeping.
-        send_command_sequence(self, false, self->stop_sequence, self->stop_sequence_len);
+        _refresh_done(self);
     }
 
     release_display_core(&self->core);
@@ -507,6 +559,7 @@ void epaperdisplay_epaperdisplay_collect_ptrs(epaperdisplay_epaperdisplay_obj_t
     displayio_display_bus_collect_ptrs(&self->bus);
     gc_collect_ptr((void *)self->start_sequence);
     gc_collect_ptr((void *)self->stop_sequence);
+    gc_collect_ptr((void *)self->partial_refresh_sequence);
 }
 
 size_t maybe_refresh_epaperdisplay(void) {
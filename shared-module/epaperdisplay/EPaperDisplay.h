@@ -42,9 +42,14 @@ typedef struct {
     const uint8_t *start_sequence;
     const uint8_t *stop_sequence;
     const uint8_t *refresh_sequence;
+    const uint8_t *partial_refresh_sequence;
     uint16_t start_sequence_len;
     uint16_t stop_sequence_len;
     uint16_t refresh_sequence_len;
+    uint16_t partial_refresh_sequence_len;
+    // Refreshes in a row that may be partial before a full one clears ghosting.
+    uint16_t full_refresh_interval;
+    uint16_t partial_refreshes;
     uint16_t start_up_time_ms;
     uint16_t refresh_time;
     uint16_t write_black_ram_command;
@@ -54,6 +59,7 @@ typedef struct {
     bool black_bits_inverted;
     bool color_bits_inverted;
     bool refreshing;
+    bool partial_refresh; // The refresh being drawn only sends changed windows.
     bool grayscale;
     bool acep;
     bool two_byte_sequence_length;
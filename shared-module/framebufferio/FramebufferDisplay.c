@@ -127,12 +127,86 @@ STATIC const displayio_area_t *_get_refresh_areas(framebufferio_framebufferdispl
         self->core.area.next = NULL;
         return &self->core.area;
     } else if (self->core.current_group != NULL) {
-        return displayio_group_get_refresh_areas(self->core.current_group, NULL);
+        const displayio_area_t *first = displayio_group_get_refresh_areas(self->core.current_group, NULL);
+        // No per-area command cost; only merge areas that overlap enough.
+        return displayio_display_core_coalesce_areas(&self->core, first, 0);
     }
     return NULL;
 }
 
 #define MARK_ROW_DIRTY(r) (dirty_row_bitmask[r / 8] |= (1 << (r & 7)))
+
+// Whole-byte pixels can be rendered straight into the framebuffer, a row at
+// a time, or several rows at a time when rows are packed without padding.
+// This is used when the area buffer would hold no more than one row anyway,
+// so it saves the copy without adding any passes over the group.
+STATIC bool _can_refresh_area_direct(framebufferio_framebufferdisplay_obj_t *self, const displayio_area_t *clipped) {
+    uint8_t depth = self->core.colorspace.depth;
+    if (depth < 8) {
+        return false;
+    }
+    size_t pixel_size = depth / 8;
+    size_t rowsize = displayio_area_width(clipped) * pixel_size;
+    uintptr_t first = (uintptr_t)self->bufinfo.buf + self->first_pixel_offset + clipped->x1 * pixel_size;
+    if (first % pixel_size != 0 || self->row_stride % pixel_size != 0) {
+        return false;
+    }
+    return rowsize == self->row_stride || rowsize >= CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE;
+}
+
+STATIC void _refresh_area_direct(framebufferio_framebufferdisplay_obj_t *self, const displayio_area_t *clipped, uint8_t *dirty_row_bitmask) {
+    size_t pixel_size = self->core.colorspace.depth / 8;
+    uint16_t width = displayio_area_width(clipped);
+    size_t rowsize = width * pixel_size;
+    uint16_t rows_per_buffer = 1;
+    if (rowsize == self->row_stride) {
+        // The mask gets the stack space the area buffer would have used.
+        rows_per_buffer = MAX(1, CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE * 8 / width);
+    }
+    uint32_t mask_length = (rows_per_buffer * width / 32) + 1;
+    uint32_t mask[mask_length];
+
+    uint8_t *buf = (uint8_t *)self->bufinfo.buf, *endbuf = buf + self->bufinfo.len;
+    (void)endbuf; // Hint to compiler that endbuf is "used" even if NDEBUG
+    buf += self->first_pixel_offset;
+
+    for (uint16_t y = clipped->y1; y < clipped->y2; y += rows_per_buffer) {
+        displayio_area_t subrectangle = {
+            .x1 = clipped->x1,
+            .y1 = y,
+            .x2 = clipped->x2,
+            .y2 = MIN(y + rows_per_buffer, clipped->y2),
+        };
+        uint8_t *dest = buf + y * self->row_stride + clipped->x1 * pixel_size;
+        size_t pixel_count = displayio_area_size(&subrectangle);
+        assert(dest >= buf && dest + pixel_count * pixel_size <= endbuf);
+
+        memset(mask, 0, mask_length * sizeof(mask[0]));
+        bool full_coverage = displayio_display_core_fill_area(&self->core, &subrectangle, mask, (uint32_t *)(void *)dest);
+
+        // Pixels that no layer drew are black, as in the area buffer
+        if (!full_coverage) {
+            for (size_t i = 0; i < pixel_count; i++) {
+                if (mask[i / 32] == 0xffffffff) {
+                    i |= 31;
+                    continue;
+                }
+                if ((mask[i / 32] & (1u << (i % 32))) == 0) {
+                    memset(dest + i * pixel_size, 0, pixel_size);
+                }
+            }
+        }
+
+        for (uint16_t i = subrectangle.y1; i < subrectangle.y2; i++) {
+            MARK_ROW_DIRTY(i);
+        }
+
+        #if CIRCUITPY_USB
+        usb_background();
+        #endif
+    }
+}
+
 STATIC bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const displayio_area_t *area, uint8_t *dirty_row_bitmask) {
     uint16_t buffer_size = CIRCUITPY_DISPLAY_AREA_BUFFER_SIZE / sizeof(uint32_t); // In uint32_ts
 
@@ -150,6 +224,11 @@ STATIC bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
         clipped.x2 = ((clipped.x2 + div - 1) / div) * div;
     }
 
+    if (_can_refresh_area_direct(self, &clipped)) {
+        _refresh_area_direct(self, &clipped, dirty_row_bitmask);
+        return true;
+    }
+
     uint16_t rows_per_buffer = displayio_area_height(&clipped);
     uint8_t pixels_per_word = (sizeof(uint32_t) * 8) / self->core.colorspace.depth;
     uint16_t pixels_per_buffer = displayio_area_size(&clipped);
@@ -182,6 +261,9 @@ STATIC bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
     uint32_t mask_length = (pixels_per_buffer / 32) + 1;
     uint32_t mask[mask_length];
     uint16_t remaining_rows = displayio_area_height(&clipped);
+    // Monochrome panels dither as they convert, rather than thresholding.
+    bool dither = self->core.colorspace.dither && self->core.colorspace.depth == 1 &&
+        self->core.colorspace.grayscale && self->core.colorspace.pixels_in_byte_share_row;
 
     for (uint16_t j = 0; j < subrectangles; j++) {
         displayio_area_t subrectangle = {
@@ -199,7 +281,11 @@ STATIC bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
         memset(mask, 0, mask_length * sizeof(mask[0]));
         memset(buffer, 0, buffer_size * sizeof(buffer[0]));
 
-        displayio_display_core_fill_area(&self->core, &subrectangle, mask, buffer);
+        if (dither) {
+            displayio_display_core_fill_area_dithered(&self->core, &subrectangle, buffer);
+        } else {
+            displayio_display_core_fill_area(&self->core, &subrectangle, mask, buffer);
+        }
 
         uint8_t *buf = (uint8_t *)self->bufinfo.buf, *endbuf = buf + self->bufinfo.len;
         (void)endbuf; // Hint to compiler that endbuf is "used" even if NDEBUG
@@ -212,8 +298,11 @@ STATIC bool _refresh_area(framebufferio_framebufferdisplay_obj_t *self, const di
 
         for (uint16_t i = subrectangle.y1; i < subrectangle.y2; i++) {
             assert(dest >= buf && dest < endbuf && dest + rowsize <= endbuf);
-            MARK_ROW_DIRTY(i);
-            memcpy(dest, src, rowsize);
+            // Only rows that actually change need to go out to the framebuffer.
+            if (memcmp(dest, src, rowsize) != 0) {
+                MARK_ROW_DIRTY(i);
+                memcpy(dest, src, rowsize);
+            }
             dest += rowstride;
             src += rowsize;
         }
@@ -314,6 +403,15 @@ void common_hal_framebufferio_framebufferdisplay_set_auto_refresh(framebufferio_
     self->auto_refresh = auto_refresh;
 }
 
+bool common_hal_framebufferio_framebufferdisplay_get_dither(framebufferio_framebufferdisplay_obj_t *self) {
+    return displayio_display_core_get_dither(&self->core);
+}
+
+void common_hal_framebufferio_framebufferdisplay_set_dither(framebufferio_framebufferdisplay_obj_t *self, bool dither) {
+    displayio_display_core_set_dither(&self->core, dither);
+    self->core.full_refresh = true;
+}
+
 STATIC void _update_backlight(framebufferio_framebufferdisplay_obj_t *self) {
     // TODO(tannewt): Fade the backlight based on it's existing value and a target value. The target
     // should account for ambient light when possible.
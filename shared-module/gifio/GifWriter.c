@@ -36,7 +36,21 @@
 #include "shared-bindings/displayio/ColorConverter.h"
 #include "shared-bindings/util.h"
 
-#define BLOCK_SIZE (126) // (2^7) - 2 // (DO NOT CHANGE!)
+// Bytes buffered before they are written to the file. This must hold the
+// header, or a data sub-block along with the frame headers.
+#define DATA_SIZE (512)
+// Slots in the LZW string table. Each is a uint32_t, so this takes 4kB of RAM.
+#define LZW_TABLE_SIZE (1024)
+#define LZW_TABLE_BITS (10)
+// Pixels are 7 bits, so codes start at 8 bits wide and the first two after
+// the literals are the clear and end codes.
+#define LZW_MIN_CODE_SIZE (7)
+#define LZW_CLEAR_CODE (1 << LZW_MIN_CODE_SIZE)
+#define LZW_END_CODE (LZW_CLEAR_CODE + 1)
+#define LZW_FIRST_CODE (LZW_CLEAR_CODE + 2)
+// Start over once the table is three-quarters full, which keeps probes short
+// and codes at most 10 bits wide.
+#define LZW_MAX_CODE (LZW_FIRST_CODE + LZW_TABLE_SIZE * 3 / 4)
 
 static void handle_error(gifio_gifwriter_t *self) {
     if (self->error != 0) {
@@ -56,9 +70,10 @@ static void flush_data(gifio_gifwriter_t *self) {
     }
 }
 
-// These "write" calls _MUST_ have enough buffer space available!  This is
-// ensured by allocating the proper buffer size in construct.
 static void write_data(gifio_gifwriter_t *self, const void *data, size_t size) {
+    if (self->cur + size > self->size) {
+        flush_data(self);
+    }
     assert(self->cur + size <= self->size);
     memcpy(self->data + self->cur, data, size);
     self->cur += size;
@@ -88,9 +103,9 @@ void shared_module_gifio_gifwriter_construct(gifio_gifwriter_t *self, mp_obj_t *
     self->dither = dither;
     self->own_file = own_file;
 
-    size_t nblocks = (width * height + 125) / 126;
-    self->size = nblocks * 128 + 4;
+    self->size = DATA_SIZE;
     self->data = m_malloc(self->size);
+    self->lzw_table = m_malloc(LZW_TABLE_SIZE * sizeof(uint32_t));
     self->cur = 0;
     self->error = 0;
 
@@ -174,7 +189,119 @@ static const uint8_t g_bayer[4][4] = {
     {31, 14, 26, 10}
 };
 
+// State of the LZW encoder while a frame is written. Codes are packed into
+// bytes least significant bit first, and the bytes into data sub-blocks of up
+// to 255 bytes that are built in place in self->data.
+typedef struct {
+    gifio_gifwriter_t *self;
+    uint32_t bits;
+    uint8_t bit_count;
+    uint8_t code_size;
+    uint16_t next_code;
+    int prefix;
+    size_t block_start;
+    uint8_t block_len;
+} lzw_encoder_t;
+
+static void lzw_end_block(lzw_encoder_t *lzw) {
+    if (lzw->block_len) {
+        lzw->self->data[lzw->block_start] = lzw->block_len;
+        lzw->block_len = 0;
+    }
+}
+
+static void lzw_write_byte(lzw_encoder_t *lzw, uint8_t value) {
+    gifio_gifwriter_t *self = lzw->self;
+    if (lzw->block_len == 0) {
+        if (self->cur + 256 > self->size) {
+            flush_data(self);
+        }
+        lzw->block_start = self->cur++;
+    }
+    self->data[self->cur++] = value;
+    if (++lzw->block_len == 255) {
+        lzw_end_block(lzw);
+    }
+}
+
+static void lzw_write_code(lzw_encoder_t *lzw, int code) {
+    lzw->bits |= code << lzw->bit_count;
+    lzw->bit_count += lzw->code_size;
+    while (lzw->bit_count >= 8) {
+        lzw_write_byte(lzw, lzw->bits);
+        lzw->bits >>= 8;
+        lzw->bit_count -= 8;
+    }
+    // Grow the codes once the last assigned one no longer fits, the same
+    // way the decoder does.
+    if (lzw->next_code >= (1 << lzw->code_size)) {
+        lzw->code_size++;
+    }
+}
+
+static void lzw_reset(lzw_encoder_t *lzw) {
+    memset(lzw->self->lzw_table, 0, LZW_TABLE_SIZE * sizeof(uint32_t));
+    lzw->code_size = LZW_MIN_CODE_SIZE + 1;
+    lzw->next_code = LZW_FIRST_CODE;
+}
+
+static void lzw_start(lzw_encoder_t *lzw, gifio_gifwriter_t *self) {
+    lzw->self = self;
+    lzw->bits = 0;
+    lzw->bit_count = 0;
+    lzw->prefix = -1;
+    lzw->block_len = 0;
+    lzw_reset(lzw);
+    lzw_write_code(lzw, LZW_CLEAR_CODE);
+}
+
+// Each table slot holds the string's prefix code and last pixel above the
+// code assigned to it. Zero marks an empty slot, since no string gets code 0.
+static inline void lzw_add_pixel(lzw_encoder_t *lzw, int pixel) {
+    if (lzw->prefix < 0) {
+        lzw->prefix = pixel;
+        return;
+    }
+    uint32_t key = (lzw->prefix << 8) | pixel;
+    uint32_t *table = lzw->self->lzw_table;
+    size_t slot = (key * 2654435761u) >> (32 - LZW_TABLE_BITS);
+    uint32_t entry;
+    while ((entry = table[slot]) != 0) {
+        if ((entry >> 12) == key) {
+            lzw->prefix = entry & 0xfff;
+            return;
+        }
+        slot = (slot + 1) & (LZW_TABLE_SIZE - 1);
+    }
+    lzw_write_code(lzw, lzw->prefix);
+    lzw->prefix = pixel;
+    if (lzw->next_code >= LZW_MAX_CODE) {
+        lzw_write_code(lzw, LZW_CLEAR_CODE);
+        lzw_reset(lzw);
+    } else {
+        table[slot] = (key << 12) | lzw->next_code++;
+    }
+}
+
+static void lzw_finish(lzw_encoder_t *lzw) {
+    if (lzw->prefix >= 0) {
+        lzw_write_code(lzw, lzw->prefix);
+    }
+    lzw_write_code(lzw, LZW_END_CODE);
+    if (lzw->bit_count) {
+        lzw_write_byte(lzw, lzw->bits);
+    }
+    lzw_end_block(lzw);
+}
+
 void shared_module_gifio_gifwriter_add_frame(gifio_gifwriter_t *self, const mp_buffer_info_t *bufinfo, int16_t delay) {
+    int pixel_count = self->width * self->height;
+    if (self->colorspace == DISPLAYIO_COLORSPACE_L8) {
+        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(pixel_count - 1), false);
+    } else {
+        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(2 * pixel_count - 1), false);
+    }
+
     if (delay) {
         write_data(self, (uint8_t []) {'!', 0xF9, 0x04, 0x04}, 4);
         write_word(self, delay);
@@ -185,85 +312,56 @@ void shared_module_gifio_gifwriter_add_frame(gifio_gifwriter_t *self, const mp_b
     write_long(self, 0);
     write_word(self, self->width);
     write_word(self, self->height);
-    write_data(self, (uint8_t []) {0x00, 0x07}, 2); // 7-bits
+    write_data(self, (uint8_t []) {0x00, LZW_MIN_CODE_SIZE}, 2); // 7-bits
 
-    int pixel_count = self->width * self->height;
-    int blocks = (pixel_count + BLOCK_SIZE - 1) / BLOCK_SIZE;
-
-    uint8_t *data = self->data + self->cur;
+    lzw_encoder_t lzw;
+    lzw_start(&lzw, self);
 
     if (self->colorspace == DISPLAYIO_COLORSPACE_L8) {
-        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(pixel_count - 1), false);
-
         uint8_t *pixels = bufinfo->buf;
-        for (int i = 0; i < blocks; i++) {
-            assert(pixel_count >= 0);
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                *data++ = (*pixels++) >> 1;
-            }
+        for (int i = 0; i < pixel_count; i++) {
+            lzw_add_pixel(&lzw, (*pixels++) >> 1);
         }
     } else if (!self->dither) {
-        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(2 * pixel_count - 1), false);
-
         uint16_t *pixels = bufinfo->buf;
-        for (int i = 0; i < blocks; i++) {
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                int pixel = *pixels++;
-                if (self->byteswap) {
-                    pixel = __builtin_bswap16(pixel);
-                }
-                int red = (pixel >> (11 + (5 - 2))) & 0x3;
-                int green = (pixel >> (5 + (6 - 3))) & 0x7;
-                int blue = (pixel >> (0 + (5 - 2))) & 0x3;
-                *data++ = (red << 5) | (green << 2) | blue;
+        for (int i = 0; i < pixel_count; i++) {
+            int pixel = *pixels++;
+            if (self->byteswap) {
+                pixel = __builtin_bswap16(pixel);
             }
+            int red = (pixel >> (11 + (5 - 2))) & 0x3;
+            int green = (pixel >> (5 + (6 - 3))) & 0x7;
+            int blue = (pixel >> (0 + (5 - 2))) & 0x3;
+            lzw_add_pixel(&lzw, (red << 5) | (green << 2) | blue);
         }
     } else {
-        mp_get_index(&mp_type_memoryview, bufinfo->len, MP_OBJ_NEW_SMALL_INT(2 * pixel_count - 1), false);
-
         uint16_t *pixels = bufinfo->buf;
         int x = 0, y = 0;
-        for (int i = 0; i < blocks; i++) {
-            int block_size = MIN(BLOCK_SIZE, pixel_count);
-            pixel_count -= block_size;
-
-            *data++ = 1 + block_size;
-            *data++ = 0x80;
-            for (int j = 0; j < block_size; j++) {
-                int pixel = *pixels++;
-                if (self->byteswap) {
-                    pixel = __builtin_bswap16(pixel);
-                }
-                int red = (pixel >> 8) & 0xf8;
-                int green = (pixel >> 3) & 0xfc;
-                int blue = (pixel << 3) & 0xf8;
-
-                red = MAX(0, red - rb_bayer[x % 4][y % 4]);
-                green = MAX(0, green - g_bayer[x % 4][(y + 2) % 4]);
-                blue = MAX(0, blue - rb_bayer[(x + 2) % 4][y % 4]);
-                x++;
-                if (x == self->width) {
-                    x = 0;
-                    y++;
-                }
-
-                *data++ = ((red >> 1) & 0x60) | ((green >> 3) & 0x1c) | (blue >> 6);
+        for (int i = 0; i < pixel_count; i++) {
+            int pixel = *pixels++;
+            if (self->byteswap) {
+                pixel = __builtin_bswap16(pixel);
             }
+            int red = (pixel >> 8) & 0xf8;
+            int green = (pixel >> 3) & 0xfc;
+            int blue = (pixel << 3) & 0xf8;
+
+            red = MAX(0, red - rb_bayer[x % 4][y % 4]);
+            green = MAX(0, green - g_bayer[x % 4][(y + 2) % 4]);
+            blue = MAX(0, blue - rb_bayer[(x + 2) % 4][y % 4]);
+            x++;
+            if (x == self->width) {
+                x = 0;
+                y++;
+            }
+
+            lzw_add_pixel(&lzw, ((red >> 1) & 0x60) | ((green >> 3) & 0x1c) | (blue >> 6));
         }
     }
 
-    self->cur = data - self->data;
+    lzw_finish(&lzw);
 
-    write_data(self, (uint8_t []) {0x01, 0x81, 0x00}, 3); // end code
+    write_byte(self, 0x00); // end of image data
     flush_data(self);
     handle_error(self);
 }
@@ -39,6 +39,8 @@ typedef struct gifio_gifwriter {
     int error;
     uint8_t *data;
     size_t cur, size;
+    // Hash table of the LZW encoder's strings.
+    uint32_t *lzw_table;
     bool own_file;
     bool byteswap;
     bool dither;
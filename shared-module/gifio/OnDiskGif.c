@@ -149,6 +149,7 @@ static void GIFDraw(GIFDRAW *pDraw) {
 
 void common_hal_gifio_ondiskgif_construct(gifio_ondiskgif_t *self, pyb_file_obj_t *file, bool use_palette) {
     self->file = file;
+    vfs_fat_file_drop_buffer(file);
 
     if (use_palette == true) {
         GIF_begin(&self->gif, GIF_PALETTE_RGB888);
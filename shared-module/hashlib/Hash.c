@@ -33,6 +33,9 @@ void common_hal_hashlib_hash_update(hashlib_hash_obj_t *self, const uint8_t *dat
     if (self->hash_type == MBEDTLS_SSL_HASH_SHA1) {
         mbedtls_sha1_update_ret(&self->sha1, data, datalen);
         return;
+    } else if (self->hash_type == MBEDTLS_SSL_HASH_SHA256) {
+        mbedtls_sha256_update_ret(&self->sha256, data, datalen);
+        return;
     }
 }
 
@@ -47,12 +50,19 @@ void common_hal_hashlib_hash_digest(hashlib_hash_obj_t *self, uint8_t *data, siz
         mbedtls_sha1_clone(&copy, &self->sha1);
         mbedtls_sha1_finish_ret(&self->sha1, data);
         mbedtls_sha1_clone(&self->sha1, &copy);
+    } else if (self->hash_type == MBEDTLS_SSL_HASH_SHA256) {
+        mbedtls_sha256_context copy;
+        mbedtls_sha256_clone(&copy, &self->sha256);
+        mbedtls_sha256_finish_ret(&self->sha256, data);
+        mbedtls_sha256_clone(&self->sha256, &copy);
     }
 }
 
 size_t common_hal_hashlib_hash_get_digest_size(hashlib_hash_obj_t *self) {
     if (self->hash_type == MBEDTLS_SSL_HASH_SHA1) {
         return 20;
+    } else if (self->hash_type == MBEDTLS_SSL_HASH_SHA256) {
+        return 32;
     }
     return 0;
 }
@@ -42,3 +42,8 @@ __attribute__((weak))
 mp_obj_t common_hal_imagecapture_parallelimagecapture_continuous_capture_get_frame(imagecapture_parallelimagecapture_obj_t *self) {
     mp_raise_NotImplementedError(MP_ERROR_TEXT("This microcontroller does not support continuous capture."));
 }
+
+__attribute__((weak))
+mp_obj_t common_hal_imagecapture_parallelimagecapture_continuous_capture_latest_frame(imagecapture_parallelimagecapture_obj_t *self) {
+    mp_raise_NotImplementedError(MP_ERROR_TEXT("This microcontroller does not support continuous capture."));
+}
@@ -57,7 +57,7 @@ void common_hal_is31fl3741_framebuffer_construct(is31fl3741_framebuffer_obj_t *s
         mp_raise_ValueError(MP_ERROR_TEXT("LED mappings must match display size"));
     }
 
-    self->mapping = port_malloc(sizeof(uint16_t) * len, false);
+    self->mapping = port_malloc_tagged(sizeof(uint16_t) * len, false, PORT_HEAP_TAG_DISPLAY);
     if (self->mapping == NULL) {
         m_malloc_fail(sizeof(uint16_t) * len);
     }
@@ -70,6 +70,11 @@ void common_hal_is31fl3741_framebuffer_construct(is31fl3741_framebuffer_obj_t *s
         self->mapping[i] = (uint16_t)value;
     }
 
+    self->pwm = port_malloc_tagged(IS31FL3741_LED_COUNT * 2, false, PORT_HEAP_TAG_DISPLAY);
+    if (self->pwm == NULL) {
+        m_malloc_fail(IS31FL3741_LED_COUNT * 2);
+    }
+
     common_hal_is31fl3741_framebuffer_reconstruct(self, framebuffer);
 }
 
@@ -89,11 +94,11 @@ void common_hal_is31fl3741_framebuffer_reconstruct(is31fl3741_framebuffer_obj_t
         mp_get_index(mp_obj_get_type(self->framebuffer), self->bufinfo.len, MP_OBJ_NEW_SMALL_INT(self->bufsize - 1), false);
     } else {
         if (self->framebuffer == NULL && self->bufinfo.buf != NULL) {
-            port_free(self->bufinfo.buf);
+            port_free_tagged(self->bufinfo.buf, PORT_HEAP_TAG_DISPLAY);
         }
 
         self->framebuffer = NULL;
-        self->bufinfo.buf = port_malloc(self->bufsize, false);
+        self->bufinfo.buf = port_malloc_tagged(self->bufsize, false, PORT_HEAP_TAG_DISPLAY);
         if (self->bufinfo.buf == NULL) {
             return;
         }
@@ -106,9 +111,11 @@ void common_hal_is31fl3741_framebuffer_reconstruct(is31fl3741_framebuffer_obj_t
     common_hal_is31fl3741_set_current(self->is31fl3741, 0xFE);
 
     // set scale (brightness) to max for all LEDs
-    for (int i = 0; i < 351; i++) {
-        common_hal_is31fl3741_set_led(self->is31fl3741, i, 0xFF, 2);
-    }
+    memset(self->pwm, 0xFF, IS31FL3741_LED_COUNT);
+    common_hal_is31fl3741_write_leds(self->is31fl3741, 0, self->pwm, IS31FL3741_LED_COUNT, 2);
+
+    // The reset cleared every PWM register.
+    memset(self->pwm, 0, IS31FL3741_LED_COUNT * 2);
 
     common_hal_is31fl3741_send_enable(self->is31fl3741);
     common_hal_is31fl3741_end_transaction(self->is31fl3741);
@@ -122,12 +129,17 @@ void common_hal_is31fl3741_framebuffer_deinit(is31fl3741_framebuffer_obj_t *self
     common_hal_is31fl3741_IS31FL3741_deinit(self->is31fl3741);
 
     if (self->mapping != NULL) {
-        port_free(self->mapping);
+        port_free_tagged(self->mapping, PORT_HEAP_TAG_DISPLAY);
         self->mapping = NULL;
     }
 
+    if (self->pwm != NULL) {
+        port_free_tagged(self->pwm, PORT_HEAP_TAG_DISPLAY);
+        self->pwm = NULL;
+    }
+
     if (self->framebuffer == NULL && self->bufinfo.buf != NULL) {
-        port_free(self->bufinfo.buf);
+        port_free_tagged(self->bufinfo.buf, PORT_HEAP_TAG_DISPLAY);
     }
 
     self->base.type = NULL;
@@ -145,6 +157,56 @@ bool common_hal_is31fl3741_framebuffer_get_paused(is31fl3741_framebuffer_obj_t *
     return self->paused;
 }
 
+// Set the PWM levels to show for a pixel, with the same LED mapping as
+// common_hal_is31fl3741_draw_pixel.
+STATIC void is31fl3741_framebuffer_set_pixel(is31fl3741_framebuffer_obj_t *self, int16_t x, int16_t y, uint32_t color) {
+    int16_t x1 = (x * self->scale_height + y) * 3;
+    uint16_t ridx = self->mapping[x1 + 2];
+    if (ridx == 65535) {
+        return;
+    }
+    uint16_t gidx = self->mapping[x1 + 1];
+    uint16_t bidx = self->mapping[x1 + 0];
+    if (ridx < IS31FL3741_LED_COUNT) {
+        self->pwm[ridx] = color >> 16 & 0xFF;
+    }
+    if (gidx < IS31FL3741_LED_COUNT) {
+        self->pwm[gidx] = color >> 8 & 0xFF;
+    }
+    if (bidx < IS31FL3741_LED_COUNT) {
+        self->pwm[bidx] = color & 0xFF;
+    }
+}
+
+// An I2C write costs the address and register bytes on top of the levels, so
+// runs of changed LEDs separated by no more than this many unchanged ones are
+// sent together.
+#define IS31FL3741_MERGE_GAP (2)
+
+// Send the runs of PWM levels that differ from what the chip already has.
+STATIC void is31fl3741_framebuffer_send_changes(is31fl3741_framebuffer_obj_t *self) {
+    uint8_t *levels = self->pwm;
+    uint8_t *sent = self->pwm + IS31FL3741_LED_COUNT;
+    uint16_t led = 0;
+    while (led < IS31FL3741_LED_COUNT) {
+        if (levels[led] == sent[led]) {
+            led++;
+            continue;
+        }
+        uint16_t first = led;
+        uint16_t last = led;
+        for (led++; led < IS31FL3741_LED_COUNT && led <= last + IS31FL3741_MERGE_GAP + 1; led++) {
+            if (levels[led] != sent[led]) {
+                last = led;
+            }
+        }
+        uint16_t count = last - first + 1;
+        common_hal_is31fl3741_write_leds(self->is31fl3741, first, levels + first, count, 0);
+        memcpy(sent + first, levels + first, count);
+        led = last + 1;
+    }
+}
+
 void common_hal_is31fl3741_framebuffer_refresh(is31fl3741_framebuffer_obj_t *self, uint8_t *dirtyrows) {
     if (!self->paused) {
         common_hal_is31fl3741_begin_transaction(self->is31fl3741);
@@ -180,7 +242,7 @@ void common_hal_is31fl3741_framebuffer_refresh(is31fl3741_framebuffer_obj_t *sel
                     } else {
                         color = (rsum << 16) + (gsum << 8) + bsum;
                     }
-                    common_hal_is31fl3741_draw_pixel(self->is31fl3741, x, y, color, self->mapping, self->scale_height);
+                    is31fl3741_framebuffer_set_pixel(self, x, y, color);
                 }
             }
         } else {
@@ -201,7 +263,7 @@ void common_hal_is31fl3741_framebuffer_refresh(is31fl3741_framebuffer_obj_t *sel
                             color = *buffer;
                         }
 
-                        common_hal_is31fl3741_draw_pixel(self->is31fl3741, x, y, color, self->mapping, self->scale_height);
+                        is31fl3741_framebuffer_set_pixel(self, x, y, color);
                         buffer++;
                     }
                 } else {
@@ -209,6 +271,7 @@ void common_hal_is31fl3741_framebuffer_refresh(is31fl3741_framebuffer_obj_t *sel
                 }
             }
         }
+        is31fl3741_framebuffer_send_changes(self);
         common_hal_is31fl3741_end_transaction(self->is31fl3741);
     }
 }
@@ -148,6 +148,28 @@ void common_hal_is31fl3741_set_led(is31fl3741_IS31FL3741_obj_t *self, uint16_t l
     common_hal_busio_i2c_write(self->i2c, self->device_address, cmd, 2);
 }
 
+// Write the levels of count consecutive LEDs, starting at first, as one burst per
+// register page. The address auto-increments after each register written.
+void common_hal_is31fl3741_write_leds(is31fl3741_IS31FL3741_obj_t *self, uint16_t first, const uint8_t *levels, uint16_t count, uint8_t page) {
+    uint8_t cmd[IS31FL3741_LEDS_PER_PAGE + 1];
+    while (count > 0) {
+        uint16_t reg = first;
+        uint8_t led_page = page;
+        if (first >= IS31FL3741_LEDS_PER_PAGE) {
+            reg -= IS31FL3741_LEDS_PER_PAGE;
+            led_page++;
+        }
+        uint16_t run = MIN(count, IS31FL3741_LEDS_PER_PAGE - reg);
+        common_hal_is31fl3741_set_page(self, led_page);
+        cmd[0] = (uint8_t)reg;
+        memcpy(cmd + 1, levels, run);
+        common_hal_busio_i2c_write(self->i2c, self->device_address, cmd, run + 1);
+        first += run;
+        levels += run;
+        count -= run;
+    }
+}
+
 void common_hal_is31fl3741_draw_pixel(is31fl3741_IS31FL3741_obj_t *self, int16_t x, int16_t y, uint32_t color, uint16_t *mapping, uint8_t display_height) {
     uint8_t r = color >> 16 & 0xFF;
     uint8_t g = color >> 8 & 0xFF;
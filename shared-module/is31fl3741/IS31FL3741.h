@@ -30,6 +30,10 @@
 #include "lib/protomatter/src/core.h"
 #include "shared-bindings/busio/I2C.h"
 
+// LEDs are numbered across two register pages, 180 on the first and 171 on the second.
+#define IS31FL3741_LED_COUNT (351)
+#define IS31FL3741_LEDS_PER_PAGE (180)
+
 extern const mp_obj_type_t is31fl3741_is31fl3741_type;
 typedef struct {
     mp_obj_base_t base;
@@ -205,12 +205,10 @@ static int bitmap_output(JDEC *jd, void *data, JRECT *rect) {
     return 1;
 }
 
-void common_hal_jpegio_jpegdecoder_decode_into(
-    jpegio_jpegdecoder_obj_t *self,
-    displayio_bitmap_t *bitmap, int scale, int16_t x, int16_t y,
-    bitmaptools_rect_t *lim,
-    uint32_t skip_source_index, bool skip_source_index_none,
-    uint32_t skip_dest_index, bool skip_dest_index_none) {
+// Decode the part of the image that lands in a width x height destination,
+// handing each MCU to outfunc.
+static void decode_mcus(jpegio_jpegdecoder_obj_t *self, int (*outfunc)(JDEC *, void *, JRECT *),
+    int scale, int16_t x, int16_t y, bitmaptools_rect_t *lim, int width, int height) {
     if (self->data_obj == MP_OBJ_NULL) {
         mp_raise_RuntimeError_varg(MP_ERROR_TEXT("%q() without %q()"), MP_QSTR_decode, MP_QSTR_open);
     }
@@ -218,15 +216,91 @@ void common_hal_jpegio_jpegdecoder_decode_into(
     self->x = x;
     self->y = y;
     self->lim = *lim;
+
+    // Only the source pixels that land inside the destination are needed, so
+    // the decoder can skip converting the MCUs outside them.
+    int right = MIN(lim->x2, lim->x1 + width - x);
+    int bottom = MIN(lim->y2, lim->y1 + height - y);
+    JRESULT result = JDR_OK;
+    if (right > lim->x1 && bottom > lim->y1) {
+        JRECT clip = {
+            .left = lim->x1,
+            .right = right - 1,
+            .top = lim->y1,
+            .bottom = bottom - 1,
+        };
+        self->decoder.clip = &clip;
+        result = jd_decomp(&self->decoder, outfunc, scale);
+        self->decoder.clip = NULL;
+    }
+    common_hal_jpegio_jpegdecoder_close(self);
+    if (result != JDR_INTR) {
+        check_jresult(result);
+    }
+}
+
+void common_hal_jpegio_jpegdecoder_decode_into(
+    jpegio_jpegdecoder_obj_t *self,
+    displayio_bitmap_t *bitmap, int scale, int16_t x, int16_t y,
+    bitmaptools_rect_t *lim,
+    uint32_t skip_source_index, bool skip_source_index_none,
+    uint32_t skip_dest_index, bool skip_dest_index_none) {
     self->skip_source_index = skip_source_index;
     self->skip_source_index_none = skip_source_index_none;
     self->skip_dest_index = skip_dest_index;
     self->skip_dest_index_none = skip_dest_index_none;
 
     self->dest = bitmap;
-    JRESULT result = jd_decomp(&self->decoder, bitmap_output, scale);
-    common_hal_jpegio_jpegdecoder_close(self);
-    if (result != JDR_INTR) {
-        check_jresult(result);
+    decode_mcus(self, bitmap_output, scale, x, y, lim, bitmap->width, bitmap->height);
+}
+
+#if CIRCUITPY_BUSDISPLAY
+static int display_output(JDEC *jd, void *data, JRECT *rect) {
+    jpegio_jpegdecoder_obj_t *self = CONTAINER_OF(jd, jpegio_jpegdecoder_obj_t, decoder);
+    const displayio_area_t *clip = &self->display->core.area;
+    int src_width = rect->right - rect->left + 1;
+
+    // The part of this MCU inside the crop, in image coordinates.
+    int left = MAX(rect->left, self->lim.x1);
+    int top = MAX(rect->top, self->lim.y1);
+    int right = MIN(rect->right + 1, self->lim.x2);
+    int bottom = MIN(rect->bottom + 1, self->lim.y2);
+
+    // Where it goes on the display, trimmed to the display.
+    displayio_area_t area = {
+        .x1 = self->x + left - self->lim.x1,
+        .y1 = self->y + top - self->lim.y1,
+    };
+    area.x2 = MIN(area.x1 + right - left, clip->x2);
+    area.y2 = MIN(area.y1 + bottom - top, clip->y2);
+    if (area.x2 <= area.x1 || area.y2 <= area.y1) {
+        return DECODER_CONTINUE;
+    }
+
+    // Pack the rows to send next to each other. They only move toward the
+    // start of the buffer, so this can be done in place.
+    uint16_t *pixels = data;
+    int width = displayio_area_width(&area);
+    int height = displayio_area_height(&area);
+    const uint16_t *src = pixels + (top - rect->top) * src_width + (left - rect->left);
+    if (width != src_width) {
+        for (int row = 0; row < height; row++) {
+            memmove(pixels + row * width, src + row * src_width, width * sizeof(uint16_t));
+        }
+    } else if (src != pixels) {
+        memmove(pixels, src, width * height * sizeof(uint16_t));
     }
+
+    busdisplay_busdisplay_write_rgb565(self->display, &area, (uint8_t *)pixels);
+    return DECODER_CONTINUE;
+}
+
+void common_hal_jpegio_jpegdecoder_decode_to_display(
+    jpegio_jpegdecoder_obj_t *self,
+    busdisplay_busdisplay_obj_t *display, int scale, int16_t x, int16_t y,
+    bitmaptools_rect_t *lim) {
+    self->display = display;
+    decode_mcus(self, display_output, scale, x, y, lim, display->core.width, display->core.height);
+    self->display = NULL;
 }
+#endif
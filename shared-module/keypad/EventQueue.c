@@ -24,6 +24,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "shared-bindings/keypad/Event.h"
 #include "shared-bindings/keypad/EventQueue.h"
 #include "shared-bindings/supervisor/__init__.h"
@@ -52,6 +54,29 @@ bool common_hal_keypad_eventqueue_get_into(keypad_eventqueue_obj_t *self, keypad
     return true;
 }
 
+size_t common_hal_keypad_eventqueue_get_many(keypad_eventqueue_obj_t *self, uint8_t *records, size_t max_events) {
+    size_t count = 0;
+    while (count < max_events) {
+        int encoded_event = ringbuf_get16(&self->encoded_events);
+        if (encoded_event == -1) {
+            break;
+        }
+        mp_obj_t ticks;
+        ringbuf_get_n(&self->encoded_events, (uint8_t *)&ticks, sizeof(ticks));
+
+        // The records may not be aligned.
+        uint32_t record[KEYPAD_EVENTQUEUE_RECORD_SIZE / sizeof(uint32_t)] = {
+            encoded_event & EVENT_KEY_NUM_MASK,
+            (encoded_event & EVENT_PRESSED) != 0,
+            mp_obj_get_int(ticks),
+        };
+        memcpy(records, record, sizeof(record));
+        records += sizeof(record);
+        count++;
+    }
+    return count;
+}
+
 mp_obj_t common_hal_keypad_eventqueue_get(keypad_eventqueue_obj_t *self) {
     keypad_event_obj_t *event = mp_obj_malloc(keypad_event_obj_t, &keypad_event_type);
     bool result = common_hal_keypad_eventqueue_get_into(self, event);
@@ -76,6 +76,7 @@ void common_hal_keypad_keymatrix_construct(keypad_keymatrix_obj_t *self, mp_uint
     self->previously_pressed = (bool *)m_malloc(sizeof(bool) * num_row_pins * num_column_pins);
 
     self->columns_to_anodes = columns_to_anodes;
+    self->any_pressed = false;
     self->funcs = &keymatrix_funcs;
 
     keypad_construct_common((keypad_scanner_obj_t *)self, interval, max_events);
@@ -124,9 +125,44 @@ static size_t keymatrix_get_key_count(void *self_in) {
     return common_hal_keypad_keymatrix_get_column_count(self) * common_hal_keypad_keymatrix_get_row_count(self);
 }
 
+// Drive every row at once, so that one read of the columns tells whether any key is pressed.
+static bool keymatrix_any_column_active(keypad_keymatrix_obj_t *self) {
+    const size_t num_rows = common_hal_keypad_keymatrix_get_row_count(self);
+    for (size_t row = 0; row < num_rows; row++) {
+        common_hal_digitalio_digitalinout_switch_to_output(
+            self->row_digitalinouts->items[row], !self->columns_to_anodes, DRIVE_MODE_PUSH_PULL);
+    }
+
+    bool active = false;
+    for (size_t column = 0; column < common_hal_keypad_keymatrix_get_column_count(self); column++) {
+        if (common_hal_digitalio_digitalinout_get_value(self->column_digitalinouts->items[column]) !=
+            self->columns_to_anodes) {
+            active = true;
+            break;
+        }
+    }
+
+    // Return the rows to rest the same way a full scan does.
+    for (size_t row = 0; row < num_rows; row++) {
+        digitalio_digitalinout_obj_t *row_dio = self->row_digitalinouts->items[row];
+        common_hal_digitalio_digitalinout_set_value(row_dio, self->columns_to_anodes);
+        common_hal_digitalio_digitalinout_switch_to_input(
+            row_dio, self->columns_to_anodes ? PULL_UP : PULL_DOWN);
+    }
+    return active;
+}
+
 static void keymatrix_scan_now(void *self_in, mp_obj_t timestamp) {
     keypad_keymatrix_obj_t *self = self_in;
 
+    // While no keys are down, check all of them at once and only scan row by row
+    // once one is pressed.
+    if (!self->any_pressed && !keymatrix_any_column_active(self)) {
+        return;
+    }
+
+    bool any_pressed = false;
+
     // On entry, all pins are set to inputs with a pull-up or pull-down,
     // depending on the diode orientation.
     for (size_t row = 0; row < common_hal_keypad_keymatrix_get_row_count(self); row++) {
@@ -148,6 +184,7 @@ static void keymatrix_scan_now(void *self_in, mp_obj_t timestamp) {
                 common_hal_digitalio_digitalinout_get_value(self->column_digitalinouts->items[column]) !=
                 self->columns_to_anodes;
             self->currently_pressed[key_number] = current;
+            any_pressed |= current;
 
             // Record any transitions.
             if (previous != current) {
@@ -163,4 +200,6 @@ static void keymatrix_scan_now(void *self_in, mp_obj_t timestamp) {
         common_hal_digitalio_digitalinout_switch_to_input(
             row_dio, self->columns_to_anodes ? PULL_UP : PULL_DOWN);
     }
+
+    self->any_pressed = any_pressed;
 }
@@ -39,6 +39,7 @@ typedef struct {
     mp_obj_tuple_t *row_digitalinouts;
     mp_obj_tuple_t *column_digitalinouts;
     bool columns_to_anodes;
+    bool any_pressed;
 } keypad_keymatrix_obj_t;
 
 void keypad_keymatrix_scan(keypad_keymatrix_obj_t *self);
@@ -45,16 +45,31 @@ void keypad_tick(void) {
         return;
     }
 
+    uint64_t now = port_get_raw_ticks(NULL);
+    #if CIRCUITPY_TICKLESS
+    // Try again on the next tick if the lock is busy.
+    uint64_t next_scan_ticks = now + 1;
+    #endif
     // Skip scanning if someone else has the lock. Don't wait for the lock.
     if (supervisor_try_lock(&keypad_scanners_linked_list_lock)) {
-        uint64_t now = port_get_raw_ticks(NULL);
+        #if CIRCUITPY_TICKLESS
+        next_scan_ticks = UINT64_MAX;
+        #endif
         mp_obj_t scanner = MP_STATE_VM(keypad_scanners_linked_list);
         while (scanner) {
             keypad_scan_maybe(scanner, now);
+            #if CIRCUITPY_TICKLESS
+            next_scan_ticks = MIN(next_scan_ticks, ((keypad_scanner_obj_t *)scanner)->next_scan_ticks);
+            #endif
             scanner = ((keypad_scanner_obj_t *)scanner)->next;
         }
         supervisor_release_lock(&keypad_scanners_linked_list_lock);
     }
+    #if CIRCUITPY_TICKLESS
+    if (next_scan_ticks != UINT64_MAX) {
+        supervisor_tick_at(next_scan_ticks);
+    }
+    #endif
 }
 
 void keypad_reset(void) {
@@ -70,14 +85,21 @@ void keypad_register_scanner(keypad_scanner_obj_t *scanner) {
     MP_STATE_VM(keypad_scanners_linked_list) = scanner;
     supervisor_release_lock(&keypad_scanners_linked_list_lock);
 
+    #if CIRCUITPY_TICKLESS
+    // Scanning reschedules itself from keypad_tick().
+    supervisor_tick_at(port_get_raw_ticks(NULL));
+    #else
     // One more request for ticks.
     supervisor_enable_tick();
+    #endif
 }
 
 // Remove scanner from the list of active scanners.
 void keypad_deregister_scanner(keypad_scanner_obj_t *scanner) {
+    #if !CIRCUITPY_TICKLESS
     // One less request for ticks.
     supervisor_disable_tick();
+    #endif
 
     supervisor_acquire_lock(&keypad_scanners_linked_list_lock);
     if (MP_STATE_VM(keypad_scanners_linked_list) == scanner) {
@@ -0,0 +1,375 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/objarray.h"
+#include "py/objlist.h"
+#include "py/objtuple.h"
+#include "py/runtime.h"
+
+#include "shared-bindings/msgpack/ExtType.h"
+#include "shared-bindings/msgpack/Unpacker.h"
+
+void common_hal_msgpack_unpacker_construct(msgpack_unpacker_obj_t *self, mp_obj_t ext_hook, bool use_list, bool use_memoryview) {
+    self->ext_hook = ext_hook;
+    self->use_list = use_list;
+    self->use_memoryview = use_memoryview;
+    self->buf = NULL;
+    self->alloc = 0;
+    self->start = 0;
+    self->end = 0;
+    self->depth = 0;
+    self->buf_shared = false;
+}
+
+void common_hal_msgpack_unpacker_feed(msgpack_unpacker_obj_t *self, const uint8_t *data, size_t len) {
+    size_t pending = self->end - self->start;
+    if (self->end + len > self->alloc) {
+        size_t needed = pending + len;
+        if (!self->buf_shared && needed <= self->alloc) {
+            memmove(self->buf, self->buf + self->start, pending);
+        } else {
+            size_t new_alloc = MAX(needed, self->alloc * 2);
+            if (self->buf_shared) {
+                // Leave the old buffer to the memoryviews that point into it.
+                byte *new_buf = m_new(byte, new_alloc);
+                memcpy(new_buf, self->buf + self->start, pending);
+                self->buf = new_buf;
+                self->buf_shared = false;
+            } else {
+                memmove(self->buf, self->buf + self->start, pending);
+                self->buf = m_renew(byte, self->buf, self->alloc, new_alloc);
+            }
+            self->alloc = new_alloc;
+        }
+        self->start = 0;
+        self->end = pending;
+    }
+    memcpy(self->buf + self->end, data, len);
+    self->end += len;
+}
+
+STATIC uint64_t get_be(const byte *p, size_t n) {
+    uint64_t res = 0;
+    while (n--) {
+        res = (res << 8) | *p++;
+    }
+    return res;
+}
+
+STATIC mp_obj_t new_bin(msgpack_unpacker_obj_t *self, size_t offset, size_t len) {
+    if (!self->use_memoryview) {
+        return mp_obj_new_bytes(self->buf + offset, len);
+    }
+    // The view keeps the whole buffer alive because it points at its start.
+    mp_obj_array_t *view = m_new_obj(mp_obj_array_t);
+    mp_obj_memoryview_init(view, 'B', offset, len, self->buf);
+    self->buf_shared = true;
+    return MP_OBJ_FROM_PTR(view);
+}
+
+STATIC mp_obj_t new_ext(msgpack_unpacker_obj_t *self, int8_t code, size_t offset, size_t len) {
+    mp_obj_t data = mp_obj_new_bytes(self->buf + offset, len);
+    if (self->ext_hook != mp_const_none) {
+        return mp_call_function_2(self->ext_hook, MP_OBJ_NEW_SMALL_INT(code), data);
+    }
+    mod_msgpack_extype_obj_t *o = mp_obj_malloc(mod_msgpack_extype_obj_t, &mod_msgpack_exttype_type);
+    o->code = code;
+    o->data = data;
+    return MP_OBJ_FROM_PTR(o);
+}
+
+// Start an array or map of len elements. Empty ones are complete straight away;
+// otherwise a frame is pushed and MP_OBJ_NULL returned.
+STATIC mp_obj_t start_container(msgpack_unpacker_obj_t *self, size_t len, bool is_map) {
+    mp_obj_t container;
+    if (is_map) {
+        container = mp_obj_new_dict(len);
+    } else if (self->use_list) {
+        container = mp_obj_new_list(len, NULL);
+    } else {
+        container = mp_obj_new_tuple(len, NULL);
+    }
+    if (len == 0) {
+        return container;
+    }
+    if (self->depth == CIRCUITPY_MSGPACK_UNPACKER_MAX_DEPTH) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("maximum recursion depth exceeded"));
+    }
+    msgpack_unpacker_frame_t *frame = &self->stack[self->depth++];
+    frame->container = container;
+    frame->key = MP_OBJ_NULL;
+    frame->len = len;
+    frame->index = 0;
+    return MP_OBJ_NULL;
+}
+
+// Decode the item at the start of the pending data. Returns false without consuming
+// anything if it isn't all there yet. *value is MP_OBJ_NULL for a started container.
+STATIC bool unpack_item(msgpack_unpacker_obj_t *self, mp_obj_t *value) {
+    const byte *p = self->buf + self->start;
+    size_t avail = self->end - self->start;
+    if (avail < 1) {
+        return false;
+    }
+    uint8_t code = p[0];
+
+    // Bytes needed for the whole item, and the size of its length field if any.
+    size_t need = 1;
+    size_t n = 0;
+    if (((code & 0b10000000) == 0) || ((code & 0b11100000) == 0b11100000)) {
+        // fixint
+    } else if ((code & 0b11100000) == 0b10100000) {
+        // fixstr
+        need += code & 0b11111;
+    } else if ((code & 0b11100000) == 0b10000000) {
+        // fixarray, fixmap
+    } else {
+        switch (code) {
+            case 0xc4:
+            case 0xc5:
+            case 0xc6:
+                // bin 8, 16, 32
+                n = 1 << (code - 0xc4);
+                break;
+            case 0xc7:
+            case 0xc8:
+            case 0xc9:
+                // ext 8, 16, 32
+                n = 1 << (code - 0xc7);
+                need += 1;
+                break;
+            case 0xd9:
+            case 0xda:
+            case 0xdb:
+                // str 8, 16, 32
+                n = 1 << (code - 0xd9);
+                break;
+            case 0xdc:
+            case 0xdd:
+                // array 16 & 32
+                n = 2 << (code - 0xdc);
+                break;
+            case 0xde:
+            case 0xdf:
+                // map 16 & 32
+                n = 2 << (code - 0xde);
+                break;
+            case 0xca:
+                need += 4;
+                break;
+            case 0xcb:
+                need += 8;
+                break;
+            case 0xcc:
+            case 0xcd:
+            case 0xce:
+            case 0xcf:
+                need += 1 << (code - 0xcc);
+                break;
+            case 0xd0:
+            case 0xd1:
+            case 0xd2:
+            case 0xd3:
+                need += 1 << (code - 0xd0);
+                break;
+            case 0xd4:
+            case 0xd5:
+            case 0xd6:
+            case 0xd7:
+            case 0xd8:
+                // fixext 1, 2, 4, 8, 16
+                need += 1 + (1 << (code - 0xd4));
+                break;
+            case 0xc0:
+            case 0xc2:
+            case 0xc3:
+                break;
+            case 0xc1: // never used
+            default:
+                mp_raise_ValueError(MP_ERROR_TEXT("Invalid format"));
+        }
+    }
+
+    size_t len = 0;
+    if (n > 0) {
+        if (avail < need + n) {
+            return false;
+        }
+        len = get_be(p + 1, n);
+        need += n;
+        // Arrays and maps are followed by their elements, everything else by a payload.
+        if (code < 0xdc) {
+            if (len > avail - need) {
+                return false;
+            }
+            need += len;
+        }
+    }
+    if (avail < need) {
+        return false;
+    }
+
+    // Consume the item before building it so that a failing ext_hook can't
+    // leave the same bytes to be decoded again.
+    size_t offset = self->start;
+    self->start += need;
+
+    if (((code & 0b10000000) == 0) || ((code & 0b11100000) == 0b11100000)) {
+        *value = MP_OBJ_NEW_SMALL_INT((int8_t)code);
+        return true;
+    }
+    if ((code & 0b11100000) == 0b10100000) {
+        *value = mp_obj_new_str((const char *)p + 1, code & 0b11111);
+        return true;
+    }
+    if ((code & 0b11110000) == 0b10010000) {
+        *value = start_container(self, code & 0b1111, false);
+        return true;
+    }
+    if ((code & 0b11110000) == 0b10000000) {
+        *value = start_container(self, code & 0b1111, true);
+        return true;
+    }
+    switch (code) {
+        case 0xc0:
+            *value = mp_const_none;
+            break;
+        case 0xc2:
+            *value = mp_const_false;
+            break;
+        case 0xc3:
+            *value = mp_const_true;
+            break;
+        case 0xc4:
+        case 0xc5:
+        case 0xc6:
+            *value = new_bin(self, offset + 1 + n, len);
+            break;
+        case 0xc7:
+        case 0xc8:
+        case 0xc9:
+            *value = new_ext(self, (int8_t)p[1 + n], offset + 2 + n, len);
+            break;
+        case 0xca: {
+            union {
+                uint32_t u;
+                float f;
+            } data = { (uint32_t)get_be(p + 1, 4) };
+            *value = mp_obj_new_float_from_f(data.f);
+            break;
+        }
+        case 0xcb: {
+            union {
+                uint64_t u;
+                double d;
+            } data = { get_be(p + 1, 8) };
+            *value = mp_obj_new_float_from_d(data.d);
+            break;
+        }
+        case 0xcc: // uint8
+        case 0xcd: // uint16
+        case 0xce: // uint32
+        case 0xcf: // uint64
+            *value = mp_obj_new_int_from_ull(get_be(p + 1, 1 << (code - 0xcc)));
+            break;
+        case 0xd0: // int8
+            *value = MP_OBJ_NEW_SMALL_INT((int8_t)p[1]);
+            break;
+        case 0xd1: // int16
+            *value = MP_OBJ_NEW_SMALL_INT((int16_t)get_be(p + 1, 2));
+            break;
+        case 0xd2: // int32
+            *value = mp_obj_new_int((int32_t)get_be(p + 1, 4));
+            break;
+        case 0xd3: // int64
+            *value = mp_obj_new_int_from_ll((int64_t)get_be(p + 1, 8));
+            break;
+        case 0xd4:
+        case 0xd5:
+        case 0xd6:
+        case 0xd7:
+        case 0xd8:
+            *value = new_ext(self, (int8_t)p[1], offset + 2, 1 << (code - 0xd4));
+            break;
+        case 0xd9:
+        case 0xda:
+        case 0xdb:
+            *value = mp_obj_new_str((const char *)p + 1 + n, len);
+            break;
+        case 0xdc:
+        case 0xdd:
+            *value = start_container(self, len, false);
+            break;
+        case 0xde:
+        case 0xdf:
+            *value = start_container(self, len, true);
+            break;
+    }
+    return true;
+}
+
+mp_obj_t common_hal_msgpack_unpacker_next(msgpack_unpacker_obj_t *self) {
+    for (;;) {
+        mp_obj_t value;
+        if (!unpack_item(self, &value)) {
+            if (self->start == self->end && !self->buf_shared) {
+                self->start = 0;
+                self->end = 0;
+            }
+            return MP_OBJ_NULL;
+        }
+        // Put the finished value into its container, finishing containers in turn.
+        while (value != MP_OBJ_NULL) {
+            if (self->depth == 0) {
+                return value;
+            }
+            msgpack_unpacker_frame_t *frame = &self->stack[self->depth - 1];
+            if (mp_obj_is_type(frame->container, &mp_type_dict)) {
+                if (frame->key == MP_OBJ_NULL) {
+                    frame->key = value;
+                    value = MP_OBJ_NULL;
+                    continue;
+                }
+                mp_obj_dict_store(frame->container, frame->key, value);
+                frame->key = MP_OBJ_NULL;
+            } else if (self->use_list) {
+                ((mp_obj_list_t *)MP_OBJ_TO_PTR(frame->container))->items[frame->index] = value;
+            } else {
+                ((mp_obj_tuple_t *)MP_OBJ_TO_PTR(frame->container))->items[frame->index] = value;
+            }
+            frame->index++;
+            if (frame->index < frame->len) {
+                value = MP_OBJ_NULL;
+            } else {
+                value = frame->container;
+                frame->container = MP_OBJ_NULL;
+                self->depth--;
+            }
+        }
+    }
+}
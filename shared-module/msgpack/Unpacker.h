@@ -0,0 +1,57 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_MSGPACK_UNPACKER_H
+#define MICROPY_INCLUDED_SHARED_MODULE_MSGPACK_UNPACKER_H
+
+#include "py/obj.h"
+
+// An array or map that has been started but not filled yet.
+typedef struct {
+    mp_obj_t container;
+    // Map key waiting for its value, or MP_OBJ_NULL.
+    mp_obj_t key;
+    size_t len;
+    size_t index;
+} msgpack_unpacker_frame_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t ext_hook;
+    byte *buf;
+    size_t alloc;
+    // Fed data not yet parsed is buf[start:end].
+    size_t start;
+    size_t end;
+    size_t depth;
+    bool use_list;
+    bool use_memoryview;
+    // memoryviews into buf have been returned, so its contents must not move.
+    bool buf_shared;
+    msgpack_unpacker_frame_t stack[CIRCUITPY_MSGPACK_UNPACKER_MAX_DEPTH];
+} msgpack_unpacker_obj_t;
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_MSGPACK_UNPACKER_H
@@ -26,6 +26,7 @@
 
 #include <stdio.h>
 #include <inttypes.h>
+#include <string.h>
 
 #include "py/obj.h"
 #include "py/binary.h"
@@ -48,11 +49,15 @@ typedef struct _msgpack_stream_t {
     mp_uint_t (*read)(mp_obj_t obj, void *buf, mp_uint_t size, int *errcode);
     mp_uint_t (*write)(mp_obj_t obj, const void *buf, mp_uint_t size, int *errcode);
     int errcode;
+    // Used instead of a stream when stream_obj is MP_OBJ_NULL.
+    uint8_t *buf;
+    size_t buf_len;
+    size_t buf_pos;
 } msgpack_stream_t;
 
 STATIC msgpack_stream_t get_stream(mp_obj_t stream_obj, int flags) {
     const mp_stream_p_t *stream_p = mp_get_stream_raise(stream_obj, flags);
-    msgpack_stream_t s = {stream_obj, stream_p->read, stream_p->write, 0};
+    msgpack_stream_t s = {stream_obj, stream_p->read, stream_p->write, 0, NULL, 0, 0};
     return s;
 }
 
@@ -131,6 +136,14 @@ STATIC size_t read_size(msgpack_stream_t *s, uint8_t len_index) {
 // writers
 
 STATIC void write(msgpack_stream_t *s, const void *buf, mp_uint_t size) {
+    if (s->stream_obj == MP_OBJ_NULL) {
+        if (size > s->buf_len - s->buf_pos) {
+            mp_raise_ValueError(MP_ERROR_TEXT("buffer too small"));
+        }
+        memcpy(s->buf + s->buf_pos, buf, size);
+        s->buf_pos += size;
+        return;
+    }
     mp_uint_t ret = s->write(s->stream_obj, buf, size, &s->errcode);
     if (s->errcode != 0) {
         mp_raise_OSError(s->errcode);
@@ -518,6 +531,12 @@ void common_hal_msgpack_pack(mp_obj_t obj, mp_obj_t stream_obj, mp_obj_t default
     pack(obj, &stream, default_handler);
 }
 
+size_t common_hal_msgpack_pack_into(mp_obj_t obj, uint8_t *buf, size_t len, mp_obj_t default_handler) {
+    msgpack_stream_t stream = {MP_OBJ_NULL, NULL, NULL, 0, buf, len, 0};
+    pack(obj, &stream, default_handler);
+    return stream.buf_pos;
+}
+
 mp_obj_t common_hal_msgpack_unpack(mp_obj_t stream_obj, mp_obj_t ext_hook, bool use_list) {
     msgpack_stream_t stream = get_stream(stream_obj, MP_STREAM_OP_READ);
     return unpack(&stream, ext_hook, use_list);
@@ -29,6 +29,7 @@
 #include "py/stream.h"
 
 void common_hal_msgpack_pack(mp_obj_t obj, mp_obj_t stream_obj, mp_obj_t default_handler);
+size_t common_hal_msgpack_pack_into(mp_obj_t obj, uint8_t *buf, size_t len, mp_obj_t default_handler);
 mp_obj_t common_hal_msgpack_unpack(mp_obj_t stream_obj, mp_obj_t ext_hook, bool use_list);
 
 #endif
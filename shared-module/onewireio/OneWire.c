@@ -24,11 +24,17 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
+#include "py/runtime.h"
 #include "common-hal/microcontroller/Pin.h"
 #include "shared-bindings/onewireio/OneWire.h"
 #include "shared-bindings/microcontroller/__init__.h"
 #include "shared-bindings/digitalio/DigitalInOut.h"
 
+#define ONEWIRE_SEARCH_ROM (0xf0)
+#define ONEWIRE_MATCH_ROM (0x55)
+
 // Durations are taken from here: https://www.maximintegrated.com/en/app-notes/index.mvp/id/126
 
 void common_hal_onewireio_onewire_construct(onewireio_onewire_obj_t *self,
@@ -52,16 +58,19 @@ void common_hal_onewireio_onewire_deinit(onewireio_onewire_obj_t *self) {
 // to do accurate timekeeping, since we disable interrupts during the delays below.
 
 bool common_hal_onewireio_onewire_reset(onewireio_onewire_obj_t *self) {
-    common_hal_mcu_disable_interrupts();
+    // Only the presence check needs exact timing. The reset pulse may run
+    // longer than 480us, and the rest of the slot has no upper limit, so
+    // interrupts stay on for those.
     common_hal_digitalio_digitalinout_switch_to_output(&self->pin, false, DRIVE_MODE_OPEN_DRAIN);
     common_hal_mcu_delay_us(480);
+    common_hal_mcu_disable_interrupts();
     common_hal_digitalio_digitalinout_switch_to_input(&self->pin, PULL_NONE);
     common_hal_mcu_delay_us(70);
     bool value = common_hal_digitalio_digitalinout_get_value(&self->pin);
+    common_hal_mcu_enable_interrupts();
     common_hal_mcu_delay_us(410);
     // test if bus returned high (idle) and not stuck at low
     bool idle = common_hal_digitalio_digitalinout_get_value(&self->pin);
-    common_hal_mcu_enable_interrupts();
     return value || !idle;
 }
 
@@ -89,3 +98,116 @@ void common_hal_onewireio_onewire_write_bit(onewireio_onewire_obj_t *self,
     common_hal_mcu_delay_us(bit? 64 : 10);
     common_hal_mcu_enable_interrupts();
 }
+
+// Bytes go least significant bit first. The bus may idle for any time between
+// slots, so background tasks get a turn after each byte.
+void common_hal_onewireio_onewire_write(onewireio_onewire_obj_t *self, const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        for (uint8_t mask = 1; mask != 0; mask <<= 1) {
+            common_hal_onewireio_onewire_write_bit(self, (data[i] & mask) != 0);
+        }
+        RUN_BACKGROUND_TASKS;
+    }
+}
+
+void common_hal_onewireio_onewire_readinto(onewireio_onewire_obj_t *self, uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        uint8_t value = 0;
+        for (uint8_t mask = 1; mask != 0; mask <<= 1) {
+            if (common_hal_onewireio_onewire_read_bit(self)) {
+                value |= mask;
+            }
+        }
+        data[i] = value;
+        RUN_BACKGROUND_TASKS;
+    }
+}
+
+// The Dallas/Maxim CRC-8 that ends every ROM code.
+STATIC uint8_t onewire_crc8(const uint8_t *data, size_t len) {
+    uint8_t crc = 0;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (size_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0x8c : crc >> 1;
+        }
+    }
+    return crc;
+}
+
+// Walk the ROM search tree as in Maxim application note 187, storing up to
+// max_roms codes of 8 bytes each. Codes with a bad CRC are skipped.
+size_t common_hal_onewireio_onewire_search(onewireio_onewire_obj_t *self, uint8_t *roms, size_t max_roms) {
+    uint8_t rom[8] = { 0 };
+    size_t found = 0;
+    size_t last_discrepancy = 0;
+    bool last_device = false;
+
+    while (!last_device && found < max_roms) {
+        if (common_hal_onewireio_onewire_reset(self)) {
+            // No devices.
+            break;
+        }
+        const uint8_t command = ONEWIRE_SEARCH_ROM;
+        common_hal_onewireio_onewire_write(self, &command, 1);
+
+        size_t last_zero = 0;
+        size_t bit_number;
+        for (bit_number = 1; bit_number <= 64; bit_number++) {
+            size_t byte = (bit_number - 1) / 8;
+            uint8_t mask = 1 << ((bit_number - 1) % 8);
+            bool id_bit = common_hal_onewireio_onewire_read_bit(self);
+            bool complement_bit = common_hal_onewireio_onewire_read_bit(self);
+            bool direction;
+            if (id_bit && complement_bit) {
+                // Nothing answered.
+                break;
+            } else if (id_bit != complement_bit) {
+                // Every remaining device has the same bit here.
+                direction = id_bit;
+            } else {
+                // Devices differ here. Take the branch not yet taken.
+                if (bit_number < last_discrepancy) {
+                    direction = (rom[byte] & mask) != 0;
+                } else {
+                    direction = bit_number == last_discrepancy;
+                }
+                if (!direction) {
+                    last_zero = bit_number;
+                }
+            }
+            if (direction) {
+                rom[byte] |= mask;
+            } else {
+                rom[byte] &= ~mask;
+            }
+            common_hal_onewireio_onewire_write_bit(self, direction);
+        }
+        if (bit_number <= 64) {
+            break;
+        }
+        last_discrepancy = last_zero;
+        last_device = last_discrepancy == 0;
+        if (onewire_crc8(rom, 8) == 0) {
+            memcpy(roms + found * 8, rom, 8);
+            found++;
+        }
+        RUN_BACKGROUND_TASKS;
+    }
+    return found;
+}
+
+// Address one device and run a command on it, reading the reply into data.
+// Returns false when no device answered the reset.
+bool common_hal_onewireio_onewire_transact(onewireio_onewire_obj_t *self, const uint8_t *rom,
+    const uint8_t *command, size_t command_len, uint8_t *data, size_t data_len) {
+    if (common_hal_onewireio_onewire_reset(self)) {
+        return false;
+    }
+    const uint8_t match = ONEWIRE_MATCH_ROM;
+    common_hal_onewireio_onewire_write(self, &match, 1);
+    common_hal_onewireio_onewire_write(self, rom, 8);
+    common_hal_onewireio_onewire_write(self, command, command_len);
+    common_hal_onewireio_onewire_readinto(self, data, data_len);
+    return true;
+}
@@ -0,0 +1,91 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "extmod/vfs.h"
+#include "extmod/vfs_fat.h"
+#include "py/runtime.h"
+#include "shared-bindings/os/__init__.h"
+#include "shared-bindings/os/DirEntry.h"
+
+mp_obj_t common_hal_os_direntry_get_name(os_direntry_obj_t *self) {
+    return self->name;
+}
+
+mp_obj_t common_hal_os_direntry_get_path(os_direntry_obj_t *self) {
+    size_t dir_len;
+    const char *dir = mp_obj_str_get_data(self->dir, &dir_len);
+    size_t name_len;
+    const char *name = mp_obj_str_get_data(self->name, &name_len);
+    vstr_t vstr;
+    vstr_init(&vstr, dir_len + 1 + name_len);
+    vstr_add_strn(&vstr, dir, dir_len);
+    if (dir_len > 0 && dir[dir_len - 1] != '/') {
+        vstr_add_byte(&vstr, '/');
+    }
+    vstr_add_strn(&vstr, name, name_len);
+    return mp_obj_new_str_from_vstr(&vstr);
+}
+
+bool common_hal_os_direntry_is_dir(os_direntry_obj_t *self) {
+    return self->mode == MP_S_IFDIR;
+}
+
+bool common_hal_os_direntry_is_file(os_direntry_obj_t *self) {
+    return self->mode == MP_S_IFREG;
+}
+
+mp_obj_t common_hal_os_direntry_stat(os_direntry_obj_t *self) {
+    if (self->stat != MP_OBJ_NULL) {
+        return self->stat;
+    }
+    if (!self->has_fat_time) {
+        mp_obj_t path = common_hal_os_direntry_get_path(self);
+        self->stat = common_hal_os_stat(mp_obj_str_get_str(path));
+        return self->stat;
+    }
+
+    // Everything is known from the directory entry, in the same form as os.stat().
+    FILINFO fno;
+    fno.fdate = self->fdate;
+    fno.ftime = self->ftime;
+    mp_obj_t seconds = fat_vfs_filinfo_mtime(&fno);
+
+    mp_obj_tuple_t *t = MP_OBJ_TO_PTR(mp_obj_new_tuple(10, NULL));
+    t->items[0] = MP_OBJ_NEW_SMALL_INT(self->mode); // st_mode
+    t->items[1] = MP_OBJ_NEW_SMALL_INT(0); // st_ino
+    t->items[2] = MP_OBJ_NEW_SMALL_INT(0); // st_dev
+    t->items[3] = MP_OBJ_NEW_SMALL_INT(0); // st_nlink
+    t->items[4] = MP_OBJ_NEW_SMALL_INT(0); // st_uid
+    t->items[5] = MP_OBJ_NEW_SMALL_INT(0); // st_gid
+    t->items[6] = mp_obj_new_int_from_uint(self->size); // st_size
+    t->items[7] = seconds; // st_atime
+    t->items[8] = seconds; // st_mtime
+    t->items[9] = seconds; // st_ctime
+    self->stat = MP_OBJ_FROM_PTR(t);
+    return self->stat;
+}
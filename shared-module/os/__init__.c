@@ -29,12 +29,14 @@
 #include <string.h>
 
 #include "extmod/vfs.h"
+#include "extmod/vfs_fat.h"
 #include "py/mperrno.h"
 #include "py/mpstate.h"
 #include "py/obj.h"
 #include "py/objstr.h"
 #include "py/runtime.h"
 #include "shared-bindings/os/__init__.h"
+#include "shared-bindings/os/DirEntry.h"
 
 // This provides all VFS related OS functions so that ports can share the code
 // as needed. It does not provide uname.
@@ -101,6 +103,8 @@ void common_hal_os_chdir(const char *path) {
     } else {
         mp_vfs_proxy_call(vfs, MP_QSTR_chdir, 1, &path_out);
     }
+    // sys.path may hold relative directories.
+    mp_import_dir_cache_invalidate();
 }
 
 mp_obj_t common_hal_os_getcwd(void) {
@@ -135,18 +139,99 @@ mp_obj_t common_hal_os_listdir(const char *path) {
     return dir_list;
 }
 
+typedef struct {
+    mp_obj_base_t base;
+    mp_fun_1_t iternext;
+    // The path given to scandir(), for the entries' paths.
+    mp_obj_t dir;
+    // The ilistdir iterator of the filesystem, which reads the directory.
+    mp_obj_t ilistdir;
+    bool is_fat;
+} os_scandir_it_t;
+
+STATIC mp_obj_t os_scandir_it_iternext(mp_obj_t self_in) {
+    os_scandir_it_t *self = MP_OBJ_TO_PTR(self_in);
+    os_direntry_obj_t *entry;
+
+    #if MICROPY_VFS_FAT
+    if (self->is_fat) {
+        // Keep everything from the FatFs directory entry, so that stat()
+        // doesn't need to find the file again.
+        FILINFO fno;
+        if (!fat_vfs_ilistdir_next(self->ilistdir, &fno)) {
+            return MP_OBJ_STOP_ITERATION;
+        }
+        entry = mp_obj_malloc(os_direntry_obj_t, &os_direntry_type);
+        entry->name = mp_obj_new_str(fno.fname, strlen(fno.fname));
+        entry->mode = (fno.fattrib & AM_DIR) ? MP_S_IFDIR : MP_S_IFREG;
+        entry->size = fno.fsize;
+        entry->fdate = fno.fdate;
+        entry->ftime = fno.ftime;
+        entry->has_fat_time = true;
+        entry->dir = self->dir;
+        entry->stat = MP_OBJ_NULL;
+        return MP_OBJ_FROM_PTR(entry);
+    }
+    #endif
+
+    mp_obj_t next = mp_iternext(self->ilistdir);
+    if (next == MP_OBJ_STOP_ITERATION) {
+        return MP_OBJ_STOP_ITERATION;
+    }
+    // next is (name, type, inode[, size]).
+    size_t len;
+    mp_obj_t *items;
+    mp_obj_tuple_get(next, &len, &items);
+    entry = mp_obj_malloc(os_direntry_obj_t, &os_direntry_type);
+    entry->name = items[0];
+    entry->mode = mp_obj_get_int(items[1]);
+    entry->size = len > 3 ? mp_obj_get_int(items[3]) : 0;
+    entry->has_fat_time = false;
+    entry->dir = self->dir;
+    entry->stat = MP_OBJ_NULL;
+    return MP_OBJ_FROM_PTR(entry);
+}
+
+mp_obj_t common_hal_os_scandir(const char *path) {
+    mp_obj_t path_out;
+    mp_vfs_mount_t *vfs = lookup_dir_path(path, &path_out);
+
+    os_scandir_it_t *self = mp_obj_malloc(os_scandir_it_t, &mp_type_polymorph_iter);
+    self->iternext = os_scandir_it_iternext;
+    self->dir = mp_obj_new_str(path, strlen(path));
+    self->is_fat = false;
+
+    if (vfs == MP_VFS_ROOT) {
+        // list the root directory
+        mp_vfs_ilistdir_it_t *iter = mp_obj_malloc(mp_vfs_ilistdir_it_t, &mp_type_polymorph_iter);
+        iter->iternext = mp_vfs_ilistdir_it_iternext;
+        iter->cur.vfs = MP_STATE_VM(vfs_mount_table);
+        iter->is_str = true;
+        iter->is_iter = false;
+        self->ilistdir = MP_OBJ_FROM_PTR(iter);
+    } else {
+        self->ilistdir = mp_vfs_proxy_call(vfs, MP_QSTR_ilistdir, 1, &path_out);
+        #if MICROPY_VFS_FAT
+        self->is_fat = mp_obj_is_type(vfs->obj, &mp_fat_vfs_type);
+        #endif
+    }
+    return MP_OBJ_FROM_PTR(self);
+}
+
 void common_hal_os_mkdir(const char *path) {
     mp_obj_t path_out;
     mp_vfs_mount_t *vfs = lookup_dir_path(path, &path_out);
     if (vfs == MP_VFS_ROOT || (vfs != MP_VFS_NONE && !strcmp(mp_obj_str_get_str(path_out), "/"))) {
         mp_raise_OSError(MP_EEXIST);
     }
+    mp_import_dir_cache_invalidate();
     mp_vfs_proxy_call(vfs, MP_QSTR_mkdir, 1, &path_out);
 }
 
 void common_hal_os_remove(const char *path) {
     mp_obj_t path_out;
     mp_vfs_mount_t *vfs = lookup_path(path, &path_out);
+    mp_import_dir_cache_invalidate();
     mp_vfs_proxy_call(vfs, MP_QSTR_remove, 1, &path_out);
 }
 
@@ -158,12 +243,14 @@ void common_hal_os_rename(const char *old_path, const char *new_path) {
         // can't rename across filesystems
         mp_raise_OSError(MP_EPERM);
     }
+    mp_import_dir_cache_invalidate();
     mp_vfs_proxy_call(old_vfs, MP_QSTR_rename, 2, args);
 }
 
 void common_hal_os_rmdir(const char *path) {
     mp_obj_t path_out;
     mp_vfs_mount_t *vfs = lookup_dir_path(path, &path_out);
+    mp_import_dir_cache_invalidate();
     mp_vfs_proxy_call(vfs, MP_QSTR_rmdir, 1, &path_out);
 }
 
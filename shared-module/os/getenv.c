@@ -42,20 +42,31 @@
 #include "py/parsenum.h"
 #include "py/runtime.h"
 #include "supervisor/filesystem.h"
+#include "supervisor/shared/boot_timeline.h"
 
 #define GETENV_PATH "/settings.toml"
 
 #include "extmod/vfs.h"
 #include "extmod/vfs_fat.h"
-typedef FIL file_arg;
+// Reading settings.toml one f_read() per byte is slow, so bytes are taken
+// from a small buffer that is refilled a block at a time.
+typedef struct {
+    FIL fp;
+    UINT len;
+    UINT pos;
+    uint8_t buf[64];
+} file_arg;
+
 STATIC bool open_file(const char *name, file_arg *active_file) {
+    active_file->len = 0;
+    active_file->pos = 0;
     #if defined(UNIX)
     nlr_buf_t nlr;
     if (nlr_push(&nlr) == 0) {
         mp_obj_t file_obj = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_builtin_open_obj), mp_obj_new_str(name, strlen(name)), MP_ROM_QSTR(MP_QSTR_rb));
         mp_arg_validate_type(file_obj, &mp_type_vfs_fat_fileio, MP_QSTR_file);
         pyb_file_obj_t *file = MP_OBJ_TO_PTR(file_obj);
-        *active_file = file->fp;
+        active_file->fp = file->fp;
         nlr_pop();
         return true;
     } else {
@@ -63,7 +74,7 @@ STATIC bool open_file(const char *name, file_arg *active_file) {
     }
     #else
     FATFS *fs = filesystem_circuitpy();
-    FRESULT result = f_open(fs, active_file, name, FA_READ);
+    FRESULT result = f_open(fs, &active_file->fp, name, FA_READ);
     return result == FR_OK;
     #endif
 }
@@ -71,19 +82,33 @@ STATIC void close_file(file_arg *active_file) {
     // nothing
 }
 STATIC bool is_eof(file_arg *active_file) {
-    return f_eof(active_file) || f_error(active_file);
+    return active_file->pos == active_file->len &&
+           (f_eof(&active_file->fp) || f_error(&active_file->fp));
 }
 
 // Return 0 if there is no next character (EOF).
-STATIC uint8_t get_next_byte(FIL *active_file) {
-    uint8_t character = 0;
-    UINT quantity_read;
-    // If there's an error or quantity_read is 0, character will remain 0.
-    f_read(active_file, &character, 1, &quantity_read);
-    return character;
+STATIC uint8_t get_next_byte(file_arg *active_file) {
+    if (active_file->pos == active_file->len) {
+        active_file->pos = 0;
+        // If there's an error, len will remain 0.
+        active_file->len = 0;
+        f_read(&active_file->fp, active_file->buf, sizeof(active_file->buf), &active_file->len);
+        if (active_file->len == 0) {
+            return 0;
+        }
+    }
+    return active_file->buf[active_file->pos++];
+}
+STATIC void seek_to(file_arg *active_file, FSIZE_t offset) {
+    f_lseek(&active_file->fp, offset);
+    active_file->len = 0;
+    active_file->pos = 0;
 }
 STATIC void seek_eof(file_arg *active_file) {
-    f_lseek(active_file, f_size(active_file));
+    seek_to(active_file, f_size(&active_file->fp));
+}
+STATIC FSIZE_t tell(file_arg *active_file) {
+    return f_tell(&active_file->fp) - (active_file->len - active_file->pos);
 }
 
 // For a fixed buffer, record the required size rather than throwing
@@ -281,6 +306,90 @@ STATIC mp_int_t read_value(file_arg *active_file, vstr_t *buf, bool *quoted) {
     }
 }
 
+// Index of where each key's line starts in settings.toml, so a lookup can seek
+// straight to it instead of rereading the file from the top. It is static, so
+// it survives soft reloads, and any write to a FAT filesystem invalidates it.
+// Keys are stored as hashes and always rechecked with key_matches() after seeking.
+#define GETENV_INDEX_SIZE (32)
+
+typedef struct {
+    uint32_t hash;
+    uint32_t offset;
+} getenv_index_entry_t;
+
+typedef struct {
+    uint8_t count;
+    bool valid : 1;
+    // False when the file has more keys than fit in entries.
+    bool complete : 1;
+    getenv_index_entry_t entries[GETENV_INDEX_SIZE];
+} getenv_index_t;
+
+STATIC getenv_index_t getenv_index;
+
+// FNV-1a
+#define GETENV_HASH_INIT (2166136261u)
+STATIC uint32_t hash_step(uint32_t hash, uint8_t character) {
+    return (hash ^ character) * 16777619u;
+}
+
+STATIC uint32_t hash_key(const char *key) {
+    uint32_t hash = GETENV_HASH_INIT;
+    while (*key) {
+        hash = hash_step(hash, *key++);
+    }
+    return hash;
+}
+
+// One pass over the file, recording each "key =" line the way key_matches() reads it.
+STATIC void build_index(file_arg *active_file) {
+    getenv_index.count = 0;
+    getenv_index.complete = true;
+    while (!is_eof(active_file)) {
+        uint32_t offset = tell(active_file);
+        uint8_t character = consume_whitespace(active_file);
+        if (character == '[' || character == 0) {
+            break;
+        }
+        uint32_t hash = GETENV_HASH_INIT;
+        while (character != '=' && character != 0 && !unichar_isspace(character)) {
+            hash = hash_step(hash, character);
+            character = get_next_byte(active_file);
+        }
+        if (character != '\n' && unichar_isspace(character)) {
+            character = consume_whitespace(active_file);
+        }
+        if (character == '=') {
+            if (getenv_index.count == GETENV_INDEX_SIZE) {
+                getenv_index.complete = false;
+                break;
+            }
+            getenv_index.entries[getenv_index.count].hash = hash;
+            getenv_index.entries[getenv_index.count].offset = offset;
+            getenv_index.count++;
+        }
+        if (character != '\n' && character != 0) {
+            next_line(active_file);
+        }
+    }
+    seek_to(active_file, 0);
+    #if CIRCUITPY_SUPERVISOR_BOOT_TIMELINE
+    // The first index build is the first full read of settings.toml.
+    supervisor_boot_timeline_mark(SUPERVISOR_BOOT_EVENT_SETTINGS_READ);
+    #endif
+}
+
+void os_getenv_invalidate_index(void) {
+    getenv_index.valid = false;
+}
+
+STATIC void update_index(file_arg *active_file) {
+    if (!getenv_index.valid) {
+        build_index(active_file);
+        getenv_index.valid = true;
+    }
+}
+
 STATIC os_getenv_err_t os_getenv_vstr(const char *path, const char *key, vstr_t *buf, bool *quoted) {
     file_arg active_file;
     if (!open_file(path, &active_file)) {
@@ -288,10 +397,40 @@ STATIC os_getenv_err_t os_getenv_vstr(const char *path, const char *key, vstr_t
     }
 
     os_getenv_err_t result = GETENV_ERR_NOT_FOUND;
-    while (!is_eof(&active_file)) {
-        if (key_matches(&active_file, key)) {
-            result = read_value(&active_file, buf, quoted);
-            break;
+    bool scan = true;
+    if (strcmp(path, GETENV_PATH) == 0) {
+        update_index(&active_file);
+        uint32_t hash = hash_key(key);
+        bool mismatch = false;
+        for (size_t i = 0; i < getenv_index.count && scan; i++) {
+            if (getenv_index.entries[i].hash != hash) {
+                continue;
+            }
+            seek_to(&active_file, getenv_index.entries[i].offset);
+            if (key_matches(&active_file, key)) {
+                result = read_value(&active_file, buf, quoted);
+                scan = false;
+            } else {
+                mismatch = true;
+            }
+        }
+        if (mismatch) {
+            // A hash collision or a file changed within the timestamp's
+            // resolution. Read it the slow way and rebuild next time.
+            getenv_index.valid = false;
+        }
+        if (scan && getenv_index.complete && !mismatch) {
+            scan = false;
+        } else if (scan) {
+            seek_to(&active_file, 0);
+        }
+    }
+    if (scan) {
+        while (!is_eof(&active_file)) {
+            if (key_matches(&active_file, key)) {
+                result = read_value(&active_file, buf, quoted);
+                break;
+            }
         }
     }
     close_file(&active_file);
@@ -34,32 +34,25 @@
 
 void shared_module_qrio_qrdecoder_construct(qrdecoder_qrdecoder_obj_t *self, int width, int height) {
     self->quirc = quirc_new();
+    self->width = width;
+    self->height = height;
     quirc_resize(self->quirc, width, height);
 }
 
 int shared_module_qrio_qrdecoder_get_height(qrdecoder_qrdecoder_obj_t *self) {
-    int height;
-    quirc_begin(self->quirc, NULL, &height);
-    return height;
+    return self->height;
 }
 
 int shared_module_qrio_qrdecoder_get_width(qrdecoder_qrdecoder_obj_t *self) {
-    int width;
-    quirc_begin(self->quirc, &width, NULL);
-    return width;
+    return self->width;
 }
+
 void shared_module_qrio_qrdecoder_set_height(qrdecoder_qrdecoder_obj_t *self, int height) {
-    if (height != shared_module_qrio_qrdecoder_get_height(self)) {
-        int width = shared_module_qrio_qrdecoder_get_width(self);
-        quirc_resize(self->quirc, width, height);
-    }
+    self->height = height;
 }
 
 void shared_module_qrio_qrdecoder_set_width(qrdecoder_qrdecoder_obj_t *self, int width) {
-    if (width != shared_module_qrio_qrdecoder_get_width(self)) {
-        int height = shared_module_qrio_qrdecoder_get_height(self);
-        quirc_resize(self->quirc, width, height);
-    }
+    self->width = width;
 }
 
 STATIC mp_obj_t data_type(int type) {
@@ -98,28 +91,26 @@ STATIC mp_obj_t data_type(int type) {
     return mp_obj_new_int(type);
 }
 
-STATIC void quirc_fill_buffer(qrdecoder_qrdecoder_obj_t *self, void *buf, qrio_pixel_policy_t policy) {
-    int width, height;
-    uint8_t *framebuffer = quirc_begin(self->quirc, &width, &height);
-    uint8_t *src = buf;
+// Convert count pixels of buf, starting at pixel index start, to 8-bit luma.
+STATIC void pixels_to_luma(uint8_t *dest, const void *buf, size_t start, size_t count, qrio_pixel_policy_t policy) {
+    const uint8_t *src = buf;
+    const uint16_t *src16 = (const uint16_t *)buf + start;
 
     switch (policy) {
-        case QRIO_RGB565: {
-            uint16_t *src16 = buf;
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = (src16[i] >> 3) & 0xfc;
+        case QRIO_RGB565:
+            for (size_t i = 0; i < count; i++) {
+                dest[i] = (src16[i] >> 3) & 0xfc;
             }
             break;
-        }
-        case QRIO_RGB565_SWAPPED: {
-            uint16_t *src16 = buf;
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = (__builtin_bswap16(src16[i]) >> 3) & 0xfc;
+
+        case QRIO_RGB565_SWAPPED:
+            for (size_t i = 0; i < count; i++) {
+                dest[i] = (__builtin_bswap16(src16[i]) >> 3) & 0xfc;
             }
             break;
-        }
+
         case QRIO_EVERY_BYTE:
-            memcpy(framebuffer, src, width * height);
+            memcpy(dest, src + start, count);
             break;
 
         case QRIO_ODD_BYTES:
@@ -127,52 +118,147 @@ STATIC void quirc_fill_buffer(qrdecoder_qrdecoder_obj_t *self, void *buf, qrio_p
             MP_FALLTHROUGH;
 
         case QRIO_EVEN_BYTES:
-            for (int i = 0; i < width * height; i++) {
-                framebuffer[i] = src[2 * i];
+            src += 2 * start;
+            for (size_t i = 0; i < count; i++) {
+                dest[i] = src[2 * i];
             }
             break;
     }
+}
+
+// Output pixels averaged per pass in quirc_fill_scaled.
+#define SCALE_CHUNK (64)
+
+// Box filter scale x scale blocks of the w x h source region at (x, y) into the quirc image.
+STATIC void quirc_fill_scaled(qrdecoder_qrdecoder_obj_t *self, uint8_t *framebuffer, const void *buf, qrio_pixel_policy_t policy, int x, int y, int out_width, int out_height, int scale) {
+    uint8_t line[SCALE_CHUNK * 4];
+    uint16_t sums[SCALE_CHUNK];
+    int shift = scale == 4 ? 4 : 2;
+
+    for (int oy = 0; oy < out_height; oy++) {
+        for (int ox = 0; ox < out_width; ox += SCALE_CHUNK) {
+            int n = MIN(SCALE_CHUNK, out_width - ox);
+            memset(sums, 0, n * sizeof(sums[0]));
+            for (int dy = 0; dy < scale; dy++) {
+                size_t start = (size_t)(y + oy * scale + dy) * self->width + x + ox * scale;
+                pixels_to_luma(line, buf, start, n * scale, policy);
+                for (int i = 0; i < n; i++) {
+                    for (int dx = 0; dx < scale; dx++) {
+                        sums[i] += line[i * scale + dx];
+                    }
+                }
+            }
+            uint8_t *dest = framebuffer + oy * out_width + ox;
+            for (int i = 0; i < n; i++) {
+                dest[i] = sums[i] >> shift;
+            }
+        }
+    }
+}
+
+// Load the w x h region of buf at (x, y), reduced by scale (1, 2 or 4), into quirc
+// and locate the codes in it.
+STATIC void quirc_fill_buffer(qrdecoder_qrdecoder_obj_t *self, const void *buf, qrio_pixel_policy_t policy, int x, int y, int w, int h, int scale) {
+    int out_width = w / scale;
+    int out_height = h / scale;
+    int width, height;
+    quirc_begin(self->quirc, &width, &height);
+    if (width != out_width || height != out_height) {
+        quirc_resize(self->quirc, out_width, out_height);
+    }
+    uint8_t *framebuffer = quirc_begin(self->quirc, NULL, NULL);
+
+    if (scale != 1) {
+        quirc_fill_scaled(self, framebuffer, buf, policy, x, y, out_width, out_height, scale);
+    } else if (w == self->width) {
+        pixels_to_luma(framebuffer, buf, (size_t)y * self->width, (size_t)w * h, policy);
+    } else {
+        for (int row = 0; row < h; row++) {
+            pixels_to_luma(framebuffer + row * w, buf, (size_t)(y + row) * self->width + x, w, policy);
+        }
+    }
     quirc_end(self->quirc);
 }
 
+STATIC bool decode_code(qrdecoder_qrdecoder_obj_t *self, int i, mp_obj_t result) {
+    quirc_extract(self->quirc, i, &self->code);
+    if (quirc_decode(&self->code, &self->data) != QUIRC_SUCCESS) {
+        return false;
+    }
+    mp_obj_t elems[2] = {
+        mp_obj_new_bytes(self->data.payload, self->data.payload_len),
+        data_type(self->data.data_type),
+    };
+    mp_obj_t code_obj = namedtuple_make_new((const mp_obj_type_t *)&qrio_qrinfo_type_obj, 2, 0, elems);
+    mp_obj_list_append(result, code_obj);
+    return true;
+}
+
+// Codes found in a downscaled image that are too fine to decode there are
+// decoded again at full resolution, from at most this many regions.
+#define MAX_FULL_RESOLUTION_REGIONS (4)
+
+typedef struct {
+    int x, y, w, h;
+} region_t;
 
-mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
-    quirc_fill_buffer(self, bufinfo->buf, policy);
+// The bounding box of self->code in source pixels, with a margin for the quiet zone.
+STATIC region_t code_region(qrdecoder_qrdecoder_obj_t *self, int scale) {
+    int x0 = self->code.corners[0].x, x1 = x0;
+    int y0 = self->code.corners[0].y, y1 = y0;
+    for (int i = 1; i < 4; i++) {
+        x0 = MIN(x0, self->code.corners[i].x);
+        x1 = MAX(x1, self->code.corners[i].x);
+        y0 = MIN(y0, self->code.corners[i].y);
+        y1 = MAX(y1, self->code.corners[i].y);
+    }
+    int margin = MAX(x1 - x0, y1 - y0) / 8 + 2;
+    x0 = MAX(0, (x0 - margin) * scale);
+    y0 = MAX(0, (y0 - margin) * scale);
+    x1 = MIN(self->width, (x1 + margin + 1) * scale);
+    y1 = MIN(self->height, (y1 + margin + 1) * scale);
+    return (region_t) { x0, y0, x1 - x0, y1 - y0 };
+}
+
+mp_obj_t shared_module_qrio_qrdecoder_decode(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, int downscale) {
+    quirc_fill_buffer(self, bufinfo->buf, policy, 0, 0, self->width, self->height, downscale);
     int count = quirc_count(self->quirc);
     mp_obj_t result = mp_obj_new_list(0, NULL);
+    region_t regions[MAX_FULL_RESOLUTION_REGIONS];
+    size_t n_regions = 0;
     for (int i = 0; i < count; i++) {
-        quirc_extract(self->quirc, i, &self->code);
-        mp_obj_t code_obj;
-        if (quirc_decode(&self->code, &self->data) != QUIRC_SUCCESS) {
-            continue;
+        if (!decode_code(self, i, result) && downscale != 1 && n_regions < MAX_FULL_RESOLUTION_REGIONS) {
+            regions[n_regions++] = code_region(self, downscale);
+        }
+    }
+    // Each region replaces the image quirc holds, so the boxes were collected first.
+    for (size_t r = 0; r < n_regions; r++) {
+        quirc_fill_buffer(self, bufinfo->buf, policy, regions[r].x, regions[r].y, regions[r].w, regions[r].h, 1);
+        count = quirc_count(self->quirc);
+        for (int i = 0; i < count; i++) {
+            decode_code(self, i, result);
         }
-        mp_obj_t elems[2] = {
-            mp_obj_new_bytes(self->data.payload, self->data.payload_len),
-            data_type(self->data.data_type),
-        };
-        code_obj = namedtuple_make_new((const mp_obj_type_t *)&qrio_qrinfo_type_obj, 2, 0, elems);
-        mp_obj_list_append(result, code_obj);
     }
     return result;
 }
 
 
-mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy) {
-    quirc_fill_buffer(self, bufinfo->buf, policy);
+mp_obj_t shared_module_qrio_qrdecoder_find(qrdecoder_qrdecoder_obj_t *self, const mp_buffer_info_t *bufinfo, qrio_pixel_policy_t policy, int downscale) {
+    quirc_fill_buffer(self, bufinfo->buf, policy, 0, 0, self->width, self->height, downscale);
     int count = quirc_count(self->quirc);
     mp_obj_t result = mp_obj_new_list(0, NULL);
     for (int i = 0; i < count; i++) {
         quirc_extract(self->quirc, i, &self->code);
         mp_obj_t code_obj;
         mp_obj_t elems[9] = {
-            mp_obj_new_int(self->code.corners[0].x),
-            mp_obj_new_int(self->code.corners[0].y),
-            mp_obj_new_int(self->code.corners[1].x),
-            mp_obj_new_int(self->code.corners[1].y),
-            mp_obj_new_int(self->code.corners[2].x),
-            mp_obj_new_int(self->code.corners[2].y),
-            mp_obj_new_int(self->code.corners[3].x),
-            mp_obj_new_int(self->code.corners[3].y),
+            mp_obj_new_int(self->code.corners[0].x * downscale),
+            mp_obj_new_int(self->code.corners[0].y * downscale),
+            mp_obj_new_int(self->code.corners[1].x * downscale),
+            mp_obj_new_int(self->code.corners[1].y * downscale),
+            mp_obj_new_int(self->code.corners[2].x * downscale),
+            mp_obj_new_int(self->code.corners[2].y * downscale),
+            mp_obj_new_int(self->code.corners[3].x * downscale),
+            mp_obj_new_int(self->code.corners[3].y * downscale),
             mp_obj_new_int(self->code.size),
         };
         code_obj = namedtuple_make_new((const mp_obj_type_t *)&qrio_qrposition_type_obj, 9, 0, elems);
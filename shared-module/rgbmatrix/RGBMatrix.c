@@ -80,7 +80,7 @@ STATIC void common_hal_rgbmatrix_rgbmatrix_construct1(rgbmatrix_rgbmatrix_obj_t
         // verify that the matrix is big enough
         mp_get_index(mp_obj_get_type(self->framebuffer), self->bufinfo.len, MP_OBJ_NEW_SMALL_INT(self->bufsize - 1), false);
     } else {
-        self->bufinfo.buf = port_malloc(self->bufsize, false);
+        self->bufinfo.buf = port_malloc_tagged(self->bufsize, false, PORT_HEAP_TAG_DISPLAY);
         if (self->bufinfo.buf == NULL) {
             m_malloc_fail(self->bufsize);
         }
@@ -164,7 +164,7 @@ STATIC void common_hal_rgbmatrix_rgbmatrix_deinit1(rgbmatrix_rgbmatrix_obj_t *se
     // If it was supervisor-allocated, it is supervisor-freed and the pointer
     // is zeroed, otherwise the pointer is just zeroed
     if (self->framebuffer == mp_const_none) {
-        port_free(self->bufinfo.buf);
+        port_free_tagged(self->bufinfo.buf, PORT_HEAP_TAG_DISPLAY);
     }
     self->bufinfo.buf = NULL;
 
@@ -198,7 +198,7 @@ void common_hal_rgbmatrix_rgbmatrix_reconstruct(rgbmatrix_rgbmatrix_obj_t *self)
     // Stop using any Python provided framebuffer.
     if (self->framebuffer != mp_const_none) {
         memset(&self->bufinfo, 0, sizeof(self->bufinfo));
-        self->bufinfo.buf = port_malloc(self->bufsize, false);
+        self->bufinfo.buf = port_malloc_tagged(self->bufsize, false, PORT_HEAP_TAG_DISPLAY);
         if (self->bufinfo.buf == NULL) {
             common_hal_rgbmatrix_rgbmatrix_deinit(self);
             return;
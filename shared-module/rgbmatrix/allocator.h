@@ -36,6 +36,6 @@
 #define _PM_allocate(x) heap_caps_malloc(x, MALLOC_CAP_DMA | MALLOC_CAP_8BIT)
 #define _PM_free(x) heap_caps_free(x)
 #else
-#define _PM_allocate(x) port_malloc(x, true)
-#define _PM_free(x) port_free(x)
+#define _PM_allocate(x) port_malloc_tagged(x, true, PORT_HEAP_TAG_DISPLAY)
+#define _PM_free(x) port_free_tagged(x, PORT_HEAP_TAG_DISPLAY)
 #endif
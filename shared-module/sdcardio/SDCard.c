@@ -129,17 +129,47 @@ STATIC int exit_cmd25(sdcardio_sdcard_obj_t *self) {
     if (self->in_cmd25) {
         DEBUG_PRINT("exit cmd25\n");
         self->in_cmd25 = false;
+        // The last block may still be programming.
+        wait_for_ready(self);
         return cmd_nodata(self, TOKEN_STOP_TRAN, 0);
     }
     return 0;
 }
 
+STATIC int cmd(sdcardio_sdcard_obj_t *self, int cmd, int arg, void *response_buf, size_t response_len, bool data_block, bool wait);
+
+STATIC int exit_cmd18(sdcardio_sdcard_obj_t *self) {
+    if (!self->in_cmd18) {
+        return 0;
+    }
+    DEBUG_PRINT("exit cmd18\n");
+    self->in_cmd18 = false;
+
+    // End the multi-block read
+    int r = cmd(self, 12, 0, NULL, 0, true, false);
+
+    // Return first status 0 or last before card ready (0xff)
+    while (r != 0) {
+        uint8_t single_byte;
+        common_hal_busio_spi_read(self->bus, &single_byte, 1, 0xff);
+        if (single_byte & 0x80) {
+            return r;
+        }
+        r = single_byte;
+    }
+    return 0;
+}
+
 // In Python API, defaults are response=None, data_block=True, wait=True
 STATIC int cmd(sdcardio_sdcard_obj_t *self, int cmd, int arg, void *response_buf, size_t response_len, bool data_block, bool wait) {
     int r = exit_cmd25(self);
     if (r < 0) {
         return r;
     }
+    r = exit_cmd18(self);
+    if (r < 0) {
+        return r;
+    }
 
     DEBUG_PRINT("cmd % 3d [%02x] arg=% 11d [%08x] len=%d%s%s\n", cmd, cmd, arg, arg, response_len, data_block ? " data" : "", wait ? " wait" : "");
     uint8_t cmdbuf[6];
@@ -232,6 +262,7 @@ STATIC mp_rom_error_text_t init_card(sdcardio_sdcard_obj_t *self) {
 
     assert(!self->in_cmd25);
     self->in_cmd25 = false; // should be false already
+    self->in_cmd18 = false;
 
     // CMD0: init card: should return _R1_IDLE_STATE (allow 5 attempts)
     {
@@ -358,39 +389,43 @@ STATIC int readinto(sdcardio_sdcard_obj_t *self, void *buf, size_t size) {
     return 0;
 }
 
+// Reads are streamed with CMD18 and the read is left open afterwards, like
+// writes are with CMD25, so that a following read of the next block only
+// waits for its data token. Any other command ends the read first.
 STATIC int readblocks(sdcardio_sdcard_obj_t *self, uint32_t start_block, mp_buffer_info_t *buf) {
     uint32_t nblocks = buf->len / 512;
-    if (nblocks == 1) {
-        //  Use CMD17 to read a single block
+    DEBUG_PRINT("cmd18? %d next_read_block %d start_block %d\n", self->in_cmd18, self->next_read_block, start_block);
+    bool continues = self->in_cmd18 && start_block == self->next_read_block;
+    bool last_block = start_block + nblocks >= self->sectors;
+    if (nblocks == 1 && last_block && !continues) {
+        //  Use CMD17 to read a single block when there is nothing after it to stream.
         return block_cmd(self, 17, start_block, buf->buf, buf->len, true, true);
-    } else {
+    }
+
+    if (!continues) {
+        DEBUG_PRINT("entering CMD18 at %d\n", (int)start_block);
         //  Use CMD18 to read multiple blocks
         int r = block_cmd(self, 18, start_block, NULL, 0, true, true);
         if (r < 0) {
             return r;
         }
+        self->in_cmd18 = true;
+    }
 
-        uint8_t *ptr = buf->buf;
-        while (nblocks--) {
-            r = readinto(self, ptr, 512);
-            if (r < 0) {
-                return r;
-            }
-            ptr += 512;
+    uint8_t *ptr = buf->buf;
+    while (nblocks--) {
+        int r = readinto(self, ptr, 512);
+        if (r < 0) {
+            self->in_cmd18 = false;
+            return r;
         }
+        ptr += 512;
+    }
+    self->next_read_block = start_block + buf->len / 512;
 
-        // End the multi-block read
-        r = cmd(self, 12, 0, NULL, 0, true, false);
-
-        // Return first status 0 or last before card ready (0xff)
-        while (r != 0) {
-            uint8_t single_byte;
-            common_hal_busio_spi_read(self->bus, &single_byte, 1, 0xff);
-            if (single_byte & 0x80) {
-                return r;
-            }
-            r = single_byte;
-        }
+    if (last_block) {
+        // Don't leave the card reading past its end.
+        return exit_cmd18(self);
     }
     return 0;
 }
@@ -407,6 +442,8 @@ int common_hal_sdcardio_sdcard_readblocks(sdcardio_sdcard_obj_t *self, uint32_t
     return r;
 }
 
+// Sends one block. The card is left to program it while the caller gets the
+// next one ready; the next token or command waits for it to finish.
 STATIC int _write(sdcardio_sdcard_obj_t *self, uint8_t token, void *buf, size_t size) {
     wait_for_ready(self);
 
@@ -443,11 +480,6 @@ STATIC int _write(sdcardio_sdcard_obj_t *self, uint8_t token, void *buf, size_t
         }
     }
 
-    // Wait for the write to finish
-    do {
-        common_hal_busio_spi_read(self->bus, cmd, 1, 0xff);
-    } while (cmd[0] == 0);
-
     // Success
     return 0;
 }
@@ -460,6 +492,13 @@ STATIC int writeblocks(sdcardio_sdcard_obj_t *self, uint32_t start_block, mp_buf
 
     if (!self->in_cmd25 || start_block != self->next_block) {
         DEBUG_PRINT("entering CMD25 at %d\n", (int)start_block);
+        if (nblocks > 1) {
+            // ACMD23: let the card pre-erase the blocks we know are coming.
+            // It is only a hint, so failure doesn't matter and writing further
+            // blocks is still allowed.
+            cmd(self, 55, 0, NULL, 0, true, true);
+            cmd(self, 23, nblocks, NULL, 0, true, true);
+        }
         //  Use CMD25 to write multiple block
         int r = block_cmd(self, 25, start_block, NULL, 0, true, true);
         if (r < 0) {
@@ -488,6 +527,9 @@ int common_hal_sdcardio_sdcard_sync(sdcardio_sdcard_obj_t *self) {
     common_hal_sdcardio_check_for_deinit(self);
     lock_and_configure_bus(self);
     int r = exit_cmd25(self);
+    if (r >= 0) {
+        r = exit_cmd18(self);
+    }
     extraclock_and_unlock_bus(self);
     return r;
 }
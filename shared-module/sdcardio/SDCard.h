@@ -42,7 +42,9 @@ typedef struct {
     int baudrate;
     uint32_t sectors;
     uint32_t next_block;
+    uint32_t next_read_block;
     bool in_cmd25;
+    bool in_cmd18;
 } sdcardio_sdcard_obj_t;
 
 void common_hal_sdcardio_sdcard_construct(sdcardio_sdcard_obj_t *self, busio_spi_obj_t *spi, const mcu_pin_obj_t *cs, int baudrate);
@@ -92,7 +92,7 @@ void common_hal_sharpdisplay_framebuffer_get_bufinfo(sharpdisplay_framebuffer_ob
         int row_stride = common_hal_sharpdisplay_framebuffer_get_row_stride(self);
         int height = common_hal_sharpdisplay_framebuffer_get_height(self);
         self->bufinfo.len = row_stride * height + 2;
-        self->bufinfo.buf = port_malloc(self->bufinfo.len, false);
+        self->bufinfo.buf = port_malloc_tagged(self->bufinfo.len, false, PORT_HEAP_TAG_DISPLAY);
         if (self->bufinfo.buf == NULL) {
             m_malloc_fail(self->bufinfo.len);
         }
@@ -131,7 +131,7 @@ void common_hal_sharpdisplay_framebuffer_deinit(sharpdisplay_framebuffer_obj_t *
 
     common_hal_reset_pin(self->chip_select.pin);
 
-    port_free(self->bufinfo.buf);
+    port_free_tagged(self->bufinfo.buf, PORT_HEAP_TAG_DISPLAY);
 
     memset(self, 0, sizeof(*self));
 }
@@ -169,24 +169,54 @@ STATIC void common_hal_sharpdisplay_framebuffer_swapbuffers(sharpdisplay_framebu
     // set chip select high
     common_hal_digitalio_digitalinout_set_value(&self->chip_select, true);
 
-    // output the toggling signal
+    // toggle the VCOM signal in the command byte
     uint8_t *data = self->bufinfo.buf;
     data[0] ^= SHARPMEM_BIT_VCOM_LSB;
 
-    common_hal_busio_spi_write(self->bus, data++, 1);
-
-    // output each changed row
+    // Each row already carries its address and trailing dummy byte, so a run of
+    // consecutive changed rows is a single write. The command byte is sent with
+    // the first run when that starts at the top row, and the trailing zero of a
+    // Sharp display comes from the spare byte after the last row.
     size_t row_stride = common_hal_sharpdisplay_framebuffer_get_row_stride(self);
-    for (int y = 0; y < self->height; y++) {
-        if (self->full_refresh || (dirty_row_bitmask[y / 8] & (1 << (y & 7)))) {
-            common_hal_busio_spi_write(self->bus, data, row_stride);
+    uint8_t *rows = data + 1;
+    size_t trailer = self->jdi_display ? 2 : 1;
+    bool command_sent = false;
+    int y = 0;
+    while (y < self->height) {
+        if (!self->full_refresh && !(dirty_row_bitmask[y / 8] & (1 << (y & 7)))) {
+            y++;
+            continue;
+        }
+        int first_row = y;
+        while (y < self->height && (self->full_refresh || (dirty_row_bitmask[y / 8] & (1 << (y & 7))))) {
+            y++;
+        }
+        uint8_t *start = rows + first_row * row_stride;
+        size_t length = (y - first_row) * row_stride;
+        if (!command_sent) {
+            if (first_row == 0) {
+                start = data;
+                length++;
+            } else {
+                common_hal_busio_spi_write(self->bus, data, 1);
+            }
+            command_sent = true;
+        }
+        if (y == self->height && !self->jdi_display) {
+            length++;
+            trailer = 0;
         }
-        data += row_stride;
+        common_hal_busio_spi_write(self->bus, start, length);
+    }
+    if (!command_sent) {
+        common_hal_busio_spi_write(self->bus, data, 1);
     }
 
-    // output a trailing zero
-    uint8_t zero[2] = {0, 0};
-    common_hal_busio_spi_write(self->bus, zero, self->jdi_display ? 2 : 1);
+    // output the trailing zeros
+    if (trailer) {
+        uint8_t zero[2] = {0, 0};
+        common_hal_busio_spi_write(self->bus, zero, trailer);
+    }
 
     // set chip select low
     common_hal_digitalio_digitalinout_set_value(&self->chip_select, false);
@@ -209,6 +209,8 @@ void common_hal_storage_mount(mp_obj_t vfs_obj, const char *mount_path, bool rea
     mp_vfs_mount_t **vfsp = &MP_STATE_VM(vfs_mount_table);
     vfs->next = *vfsp;
     *vfsp = vfs;
+
+    mp_import_dir_cache_invalidate();
 }
 
 void common_hal_storage_umount_object(mp_obj_t vfs_obj) {
@@ -231,6 +233,8 @@ void common_hal_storage_umount_object(mp_obj_t vfs_obj) {
         MP_STATE_VM(vfs_cur) = MP_VFS_ROOT;
     }
 
+    mp_import_dir_cache_invalidate();
+
     // call the underlying object to do any unmounting operation
     mp_vfs_proxy_call(vfs, MP_QSTR_umount, 0, NULL);
 }
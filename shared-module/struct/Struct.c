@@ -0,0 +1,150 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "py/binary.h"
+#include "shared-bindings/struct/Struct.h"
+#include "shared-module/struct/__init__.h"
+
+// Upper bound on the ops needed for fmt, before adjacent runs are merged.
+size_t common_hal_struct_struct_max_ops(mp_obj_t format) {
+    const char *fmt = mp_obj_str_get_str(format);
+    get_fmt_type(&fmt);
+    size_t num_ops = 0;
+    for (; *fmt; fmt++) {
+        if (unichar_isdigit(*fmt)) {
+            get_fmt_num(&fmt);
+        }
+        num_ops++;
+    }
+    return num_ops;
+}
+
+void common_hal_struct_struct_construct(struct_struct_obj_t *self, mp_obj_t format) {
+    const char *fmt = mp_obj_str_get_str(format);
+    self->format = format;
+    self->fmt_type = get_fmt_type(&fmt);
+
+    size_t num_ops = 0;
+    size_t size = 0;
+    size_t num_items = 0;
+    for (; *fmt; fmt++) {
+        struct_validate_format(*fmt);
+
+        size_t cnt = 1;
+        if (unichar_isdigit(*fmt)) {
+            cnt = get_fmt_num(&fmt);
+        }
+        char code = *fmt;
+
+        size_t offset;
+        if (code == 's') {
+            offset = size;
+            size += cnt;
+            num_items++;
+        } else {
+            mp_uint_t align;
+            size_t sz = mp_binary_get_size(self->fmt_type, code, &align);
+            if (cnt == 0) {
+                continue;
+            }
+            // Every item of a run has the same alignment, so only the first needs aligning.
+            size = (size + align - 1) & ~(align - 1);
+            offset = size;
+            size += sz * cnt;
+            if (code != 'x') {
+                num_items += cnt;
+            }
+            if (num_ops > 0) {
+                struct_struct_op_t *prev = &self->ops[num_ops - 1];
+                if (prev->code == code && prev->offset + prev->count * sz == offset) {
+                    prev->count += cnt;
+                    continue;
+                }
+            }
+        }
+        self->ops[num_ops++] = (struct_struct_op_t) {
+            .offset = offset,
+            .count = cnt,
+            .code = code,
+        };
+    }
+    self->num_ops = num_ops;
+    self->size = size;
+    self->num_items = num_items;
+}
+
+mp_obj_t common_hal_struct_struct_get_format(struct_struct_obj_t *self) {
+    return self->format;
+}
+
+size_t common_hal_struct_struct_get_size(struct_struct_obj_t *self) {
+    return self->size;
+}
+
+size_t common_hal_struct_struct_get_num_items(struct_struct_obj_t *self) {
+    return self->num_items;
+}
+
+void common_hal_struct_struct_pack_into(struct_struct_obj_t *self, byte *p, size_t n_args, const mp_obj_t *args) {
+    (void)mp_arg_validate_length(n_args, self->num_items, MP_QSTR_values);
+
+    size_t i = 0;
+    for (size_t n = 0; n < self->num_ops; n++) {
+        const struct_struct_op_t *op = &self->ops[n];
+        byte *q = p + op->offset;
+        if (op->code == 's') {
+            mp_buffer_info_t bufinfo;
+            mp_get_buffer_raise(args[i++], &bufinfo, MP_BUFFER_READ);
+            size_t to_copy = MIN(bufinfo.len, op->count);
+            memcpy(q, bufinfo.buf, to_copy);
+            memset(q + to_copy, 0, op->count - to_copy);
+        } else if (op->code == 'x') {
+            memset(q, 0, op->count);
+        } else {
+            for (size_t j = 0; j < op->count; j++) {
+                mp_binary_set_val(self->fmt_type, op->code, args[i++], p, &q);
+            }
+        }
+    }
+}
+
+void common_hal_struct_struct_unpack_into(struct_struct_obj_t *self, byte *p, mp_obj_t *items) {
+    size_t i = 0;
+    for (size_t n = 0; n < self->num_ops; n++) {
+        const struct_struct_op_t *op = &self->ops[n];
+        byte *q = p + op->offset;
+        if (op->code == 's') {
+            items[i++] = mp_obj_new_bytes(q, op->count);
+        } else if (op->code != 'x') {
+            for (size_t j = 0; j < op->count; j++) {
+                items[i++] = mp_binary_get_val(self->fmt_type, op->code, p, &q);
+            }
+        }
+    }
+}
@@ -0,0 +1,191 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "py/bc.h"
+#include "py/objfun.h"
+#include "py/mpstate.h"
+#include "py/runtime.h"
+#include "shared-bindings/supervisor/Profiler.h"
+#include "supervisor/port.h"
+#include "supervisor/shared/tick.h"
+
+// Each sample is stored as a frame count followed by (source file, function)
+// qstr pairs, innermost frame first. The buffer is a ring: once it is full the
+// oldest samples are overwritten.
+#define SAMPLE_ENTRIES(depth) (1 + 2 * (depth))
+
+static volatile bool _running;
+// Sample period and the time of the next sample, in port ticks (1/1024 s).
+static uint32_t _interval_ticks;
+static uint64_t _next_sample_tick;
+static uint8_t _depth;
+static size_t _capacity;
+static size_t _next_index;
+static size_t _sample_count;
+
+static void take_sample(void) {
+    const mp_code_state_t *code_state = MP_STATE_THREAD(current_code_state);
+    if (code_state == NULL) {
+        // No Python code is running.
+        return;
+    }
+    qstr_short_t *record = MP_STATE_VM(supervisor_profiler_samples) + _next_index * SAMPLE_ENTRIES(_depth);
+    size_t n_frames = 0;
+    while (code_state != NULL && n_frames < _depth) {
+        const byte *ip = code_state->fun_bc->bytecode;
+        MP_BC_PRELUDE_SIG_DECODE(ip);
+        MP_BC_PRELUDE_SIZE_DECODE(ip);
+        qstr block_name = mp_decode_uint_value(ip);
+        #if MICROPY_EMIT_BYTECODE_USES_QSTR_TABLE
+        block_name = code_state->fun_bc->context->constants.qstr_table[block_name];
+        qstr source_file = code_state->fun_bc->context->constants.qstr_table[0];
+        #else
+        qstr source_file = code_state->fun_bc->context->constants.source_file;
+        #endif
+        record[1 + 2 * n_frames] = source_file;
+        record[2 + 2 * n_frames] = block_name;
+        n_frames++;
+        code_state = code_state->prev_state;
+    }
+    record[0] = n_frames;
+
+    _next_index++;
+    if (_next_index == _capacity) {
+        _next_index = 0;
+    }
+    if (_sample_count < _capacity) {
+        _sample_count++;
+    }
+}
+
+void supervisor_profiler_tick(void) {
+    // Fast path. Return immediately when not profiling.
+    if (!_running) {
+        return;
+    }
+    uint64_t now = port_get_raw_ticks(NULL);
+    if (now < _next_sample_tick) {
+        return;
+    }
+    _next_sample_tick = now + _interval_ticks;
+    take_sample();
+}
+
+void supervisor_profiler_reset(void) {
+    shared_module_supervisor_profiler_stop(&shared_module_supervisor_profiler_obj);
+    MP_STATE_VM(supervisor_profiler_samples) = NULL;
+}
+
+void shared_module_supervisor_profiler_start(supervisor_profiler_obj_t *self, mp_int_t interval_ms, mp_int_t samples, mp_int_t depth) {
+    shared_module_supervisor_profiler_stop(self);
+
+    // Free any previous buffer before allocating, so restarting doesn't need room for both.
+    m_del(qstr_short_t, MP_STATE_VM(supervisor_profiler_samples), _capacity * SAMPLE_ENTRIES(_depth));
+    MP_STATE_VM(supervisor_profiler_samples) = NULL;
+    MP_STATE_VM(supervisor_profiler_samples) = m_new(qstr_short_t, samples * SAMPLE_ENTRIES(depth));
+
+    _interval_ticks = interval_ms * 1024 / 1000;
+    if (_interval_ticks == 0) {
+        _interval_ticks = 1;
+    }
+    _depth = depth;
+    _capacity = samples;
+    _next_index = 0;
+    _sample_count = 0;
+    _next_sample_tick = port_get_raw_ticks(NULL) + _interval_ticks;
+
+    _running = true;
+    supervisor_enable_tick();
+}
+
+void shared_module_supervisor_profiler_stop(supervisor_profiler_obj_t *self) {
+    if (!_running) {
+        return;
+    }
+    _running = false;
+    supervisor_disable_tick();
+}
+
+bool shared_module_supervisor_profiler_get_running(supervisor_profiler_obj_t *self) {
+    return _running;
+}
+
+mp_int_t shared_module_supervisor_profiler_get_sample_count(supervisor_profiler_obj_t *self) {
+    if (MP_STATE_VM(supervisor_profiler_samples) == NULL) {
+        return 0;
+    }
+    return _sample_count;
+}
+
+void shared_module_supervisor_profiler_dump(supervisor_profiler_obj_t *self, const mp_print_t *print) {
+    // The tick must not write samples while they are being read.
+    shared_module_supervisor_profiler_stop(self);
+
+    size_t sample_count = shared_module_supervisor_profiler_get_sample_count(self);
+    if (sample_count == 0) {
+        return;
+    }
+
+    // Count identical stacks, oldest sample first.
+    mp_obj_dict_t *counts = MP_OBJ_TO_PTR(mp_obj_new_dict(0));
+    size_t index = sample_count < _capacity ? 0 : _next_index;
+    vstr_t vstr;
+    vstr_init(&vstr, 64);
+    for (size_t i = 0; i < sample_count; i++) {
+        const qstr_short_t *record = MP_STATE_VM(supervisor_profiler_samples) + index * SAMPLE_ENTRIES(_depth);
+        vstr_reset(&vstr);
+        // Folded stacks list the outermost frame first.
+        for (size_t frame = record[0]; frame > 0; frame--) {
+            if (frame != record[0]) {
+                vstr_add_byte(&vstr, ';');
+            }
+            vstr_add_str(&vstr, qstr_str(record[2 * frame - 1]));
+            vstr_add_byte(&vstr, ':');
+            vstr_add_str(&vstr, qstr_str(record[2 * frame]));
+        }
+        mp_obj_t stack = mp_obj_new_str(vstr.buf, vstr.len);
+        mp_map_elem_t *elem = mp_map_lookup(&counts->map, stack, MP_MAP_LOOKUP_ADD_IF_NOT_FOUND);
+        if (elem->value == MP_OBJ_NULL) {
+            elem->value = MP_OBJ_NEW_SMALL_INT(0);
+        }
+        elem->value = MP_OBJ_NEW_SMALL_INT(MP_OBJ_SMALL_INT_VALUE(elem->value) + 1);
+
+        index++;
+        if (index == _capacity) {
+            index = 0;
+        }
+    }
+    vstr_clear(&vstr);
+
+    for (size_t i = 0; i < counts->map.alloc; i++) {
+        mp_map_elem_t *elem = &counts->map.table[i];
+        if (mp_map_slot_is_filled(&counts->map, i)) {
+            mp_printf(print, "%s %d\n", mp_obj_str_get_str(elem->key), (int)MP_OBJ_SMALL_INT_VALUE(elem->value));
+        }
+    }
+}
+
+MP_REGISTER_ROOT_POINTER(qstr_short_t *supervisor_profiler_samples);
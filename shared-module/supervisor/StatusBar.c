@@ -51,6 +51,7 @@ void shared_module_supervisor_status_bar_set_console(supervisor_status_bar_obj_t
     }
 
     self->console = enabled;
+    supervisor_status_bar_invalidate();
 
     // Update may be ignored.
     supervisor_status_bar_update();
@@ -73,6 +74,7 @@ void shared_module_supervisor_status_bar_set_display(supervisor_status_bar_obj_t
     }
 
     self->display = enabled;
+    supervisor_status_bar_invalidate();
 
     // Update may be ignored.
     supervisor_status_bar_update();
@@ -29,6 +29,10 @@
 #include "shared-bindings/supervisor/StatusBar.h"
 #include "shared-bindings/supervisor/__init__.h"
 
+#if CIRCUITPY_SUPERVISOR_PROFILE
+#include "shared-bindings/supervisor/Profiler.h"
+#endif
+
 // The singleton supervisor.StatusBar object, bound to supervisor.status_bar
 supervisor_status_bar_obj_t shared_module_supervisor_status_bar_obj = {
     .base = {
@@ -36,6 +40,15 @@ supervisor_status_bar_obj_t shared_module_supervisor_status_bar_obj = {
     },
 };
 
+#if CIRCUITPY_SUPERVISOR_PROFILE
+// The singleton supervisor.Profiler object, bound to supervisor.profile
+supervisor_profiler_obj_t shared_module_supervisor_profiler_obj = {
+    .base = {
+        .type = &supervisor_profiler_type,
+    },
+};
+#endif
+
 // String of the last traceback.
 char *prev_traceback_string = NULL;
 
@@ -28,6 +28,9 @@
 
 #include "py/obj.h"
 
+// Fractional bits of the filter coefficients in biquad_filter_state.
+#define BIQUAD_SHIFT (15)
+
 typedef struct {
     int32_t a1, a2, b0, b1, b2;
     int32_t x[2], y[2];
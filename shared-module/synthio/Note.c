@@ -29,6 +29,7 @@
 #include "shared-module/synthio/Note.h"
 #include "shared-bindings/synthio/Note.h"
 #include "shared-bindings/synthio/__init__.h"
+#include "shared-bindings/synthio/Wavetable.h"
 
 mp_float_t common_hal_synthio_note_get_frequency(synthio_note_obj_t *self) {
     return self->frequency;
@@ -110,7 +111,7 @@ mp_obj_t common_hal_synthio_note_get_waveform_obj(synthio_note_obj_t *self) {
 }
 
 void common_hal_synthio_note_set_waveform(synthio_note_obj_t *self, mp_obj_t waveform_in) {
-    if (waveform_in == mp_const_none) {
+    if (waveform_in == mp_const_none || mp_obj_is_type(waveform_in, &synthio_wavetable_type)) {
         memset(&self->waveform_buf, 0, sizeof(self->waveform_buf));
     } else {
         mp_buffer_info_t bufinfo_waveform;
@@ -25,12 +25,13 @@
  */
 
 #include "py/runtime.h"
+#include "py/nlr.h"
 #include "shared-bindings/synthio/LFO.h"
 #include "shared-bindings/synthio/Note.h"
 #include "shared-bindings/synthio/Synthesizer.h"
 #include "shared-module/synthio/Note.h"
 
-
+STATIC void synthesizer_apply_due_events(synthio_synthesizer_obj_t *self);
 
 void common_hal_synthio_synthesizer_construct(synthio_synthesizer_obj_t *self,
     uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj,
@@ -38,6 +39,8 @@ void common_hal_synthio_synthesizer_construct(synthio_synthesizer_obj_t *self,
 
     synthio_synth_init(&self->synth, sample_rate, channel_count, waveform_obj, envelope_obj);
     self->blocks = mp_obj_new_list(0, NULL);
+    self->frame = 0;
+    self->event_count = 0;
 }
 
 void common_hal_synthio_synthesizer_deinit(synthio_synthesizer_obj_t *self) {
@@ -68,10 +71,23 @@ audioio_get_buffer_result_t synthio_synthesizer_get_buffer(synthio_synthesizer_o
         *buffer_length = 0;
         return GET_BUFFER_ERROR;
     }
-    self->synth.span.dur = SYNTHIO_MAX_DUR;
+    channel = single_channel_output ? channel : 0;
+    // The second channel of a block gets the buffer already synthesized.
+    bool new_block = channel != self->synth.other_channel;
+    if (new_block) {
+        synthesizer_apply_due_events(self);
+        // End the block early at the next scheduled change.
+        self->synth.span.dur = SYNTHIO_MAX_DUR;
+        if (self->event_count) {
+            self->synth.span.dur = MIN(SYNTHIO_MAX_DUR, self->events[0].frame - self->frame);
+        }
+    }
 
+    synthio_synth_synthesize(&self->synth, buffer, buffer_length, channel);
 
-    synthio_synth_synthesize(&self->synth, buffer, buffer_length, single_channel_output ? channel : 0);
+    if (new_block) {
+        self->frame += *buffer_length / (SYNTHIO_BYTES_PER_SAMPLE * self->synth.channel_count);
+    }
 
     // free-running LFOs
     mp_obj_iter_buf_t iter_buf;
@@ -169,6 +185,131 @@ void common_hal_synthio_synthesizer_retrigger(synthio_synthesizer_obj_t *self, m
     }
 }
 
+uint32_t common_hal_synthio_synthesizer_get_frame(synthio_synthesizer_obj_t *self) {
+    return self->frame;
+}
+
+uint32_t common_hal_synthio_synthesizer_get_control_period(synthio_synthesizer_obj_t *self) {
+    return self->synth.control_period;
+}
+
+void common_hal_synthio_synthesizer_set_control_period(synthio_synthesizer_obj_t *self, uint32_t period) {
+    self->synth.control_period = period;
+    // update the blocks at the start of the next block of output
+    self->synth.control_remaining = 0;
+}
+
+STATIC void synthesizer_apply_event(synthio_synthesizer_obj_t *self, synthio_event_t *event) {
+    switch (event->kind) {
+        case SYNTHIO_EVENT_SET: {
+            // Errors cannot be raised from the background task, so a value
+            // the note rejects is simply dropped.
+            nlr_buf_t nlr;
+            if (nlr_push(&nlr) == 0) {
+                mp_store_attr(event->target, event->attr, event->value);
+                nlr_pop();
+            }
+            break;
+        }
+        case SYNTHIO_EVENT_RELEASE:
+            common_hal_synthio_synthesizer_release(self, event->target);
+            break;
+        case SYNTHIO_EVENT_PRESS:
+            common_hal_synthio_synthesizer_press(self, event->target);
+            break;
+        case SYNTHIO_EVENT_RETRIGGER:
+            common_hal_synthio_synthesizer_retrigger(self, event->target);
+            break;
+    }
+}
+
+STATIC void synthesizer_apply_due_events(synthio_synthesizer_obj_t *self) {
+    size_t due = 0;
+    while (due < self->event_count && (int32_t)(self->events[due].frame - self->frame) <= 0) {
+        synthesizer_apply_event(self, &self->events[due]);
+        due++;
+    }
+    if (due == 0) {
+        return;
+    }
+    self->event_count -= due;
+    memmove(self->events, self->events + due, self->event_count * sizeof(synthio_event_t));
+    // Let the applied notes be collected.
+    memset(self->events + self->event_count, 0, due * sizeof(synthio_event_t));
+}
+
+STATIC void stage_event(synthio_event_t *staged, size_t *n_staged, size_t capacity,
+    uint8_t kind, mp_obj_t target, qstr attr, mp_obj_t value) {
+    if (*n_staged == capacity) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("schedule queue full"));
+    }
+    staged[(*n_staged)++] = (synthio_event_t) {
+        .kind = kind, .target = target, .attr = attr, .value = value,
+    };
+}
+
+STATIC void stage_notes(synthio_event_t *staged, size_t *n_staged, size_t capacity, uint8_t kind, mp_obj_t notes) {
+    if (is_note(notes)) {
+        stage_event(staged, n_staged, capacity, kind, validate_note(notes), MP_QSTRnull, MP_OBJ_NULL);
+        return;
+    }
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iterable = mp_getiter(notes, &iter_buf);
+    mp_obj_t item;
+    while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+        stage_event(staged, n_staged, capacity, kind, validate_note(item), MP_QSTRnull, MP_OBJ_NULL);
+    }
+}
+
+void common_hal_synthio_synthesizer_schedule(synthio_synthesizer_obj_t *self, uint32_t frame,
+    mp_obj_t set, mp_obj_t release, mp_obj_t press, mp_obj_t retrigger) {
+    // Validate everything before queueing anything, so a bad argument or a
+    // full queue leaves the schedule unchanged.
+    size_t capacity = CIRCUITPY_SYNTHIO_MAX_EVENTS - self->event_count;
+    synthio_event_t staged[CIRCUITPY_SYNTHIO_MAX_EVENTS];
+    size_t n_staged = 0;
+
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iterable = mp_getiter(set, &iter_buf);
+    mp_obj_t item;
+    while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+        mp_obj_t *change;
+        mp_obj_get_array_fixed_n(item, 3, &change);
+        mp_obj_t target = mp_arg_validate_type(change[0], &synthio_note_type, MP_QSTR_set);
+        stage_event(staged, &n_staged, capacity, SYNTHIO_EVENT_SET, target, mp_obj_str_get_qstr(change[1]), change[2]);
+    }
+
+    stage_notes(staged, &n_staged, capacity, SYNTHIO_EVENT_RELEASE, release);
+    stage_notes(staged, &n_staged, capacity, SYNTHIO_EVENT_PRESS, press);
+
+    if (mp_obj_is_type(retrigger, &synthio_lfo_type)) {
+        stage_event(staged, &n_staged, capacity, SYNTHIO_EVENT_RETRIGGER, retrigger, MP_QSTRnull, MP_OBJ_NULL);
+    } else {
+        iterable = mp_getiter(retrigger, &iter_buf);
+        while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+            mp_arg_validate_type(item, &synthio_lfo_type, MP_QSTR_retrigger);
+            stage_event(staged, &n_staged, capacity, SYNTHIO_EVENT_RETRIGGER, item, MP_QSTRnull, MP_OBJ_NULL);
+        }
+    }
+
+    // Insert after any events already scheduled for the same frame.
+    size_t pos = self->event_count;
+    while (pos > 0 && (int32_t)(self->events[pos - 1].frame - frame) > 0) {
+        pos--;
+    }
+    memmove(self->events + pos + n_staged, self->events + pos, (self->event_count - pos) * sizeof(synthio_event_t));
+    for (size_t i = 0; i < n_staged; i++) {
+        staged[i].frame = frame;
+        self->events[pos + i] = staged[i];
+    }
+    self->event_count += n_staged;
+}
+
+void common_hal_synthio_synthesizer_cancel_scheduled(synthio_synthesizer_obj_t *self) {
+    memset(self->events, 0, self->event_count * sizeof(synthio_event_t));
+    self->event_count = 0;
+}
+
 mp_obj_t common_hal_synthio_synthesizer_get_pressed_notes(synthio_synthesizer_obj_t *self) {
     int count = 0;
     for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
@@ -31,10 +31,31 @@
 
 #include "shared-module/synthio/__init__.h"
 
+typedef enum {
+    SYNTHIO_EVENT_SET,
+    SYNTHIO_EVENT_RELEASE,
+    SYNTHIO_EVENT_PRESS,
+    SYNTHIO_EVENT_RETRIGGER,
+} synthio_event_kind_t;
+
+// One change scheduled for a given output frame.
+typedef struct {
+    uint32_t frame;
+    uint8_t kind;
+    qstr attr; // SYNTHIO_EVENT_SET only
+    mp_obj_t target; // note or LFO
+    mp_obj_t value; // SYNTHIO_EVENT_SET only
+} synthio_event_t;
+
 typedef struct {
     mp_obj_base_t base;
     synthio_synth_t synth;
     mp_obj_t blocks;
+    // Frames output so far; compared with event frames modulo 2**32.
+    uint32_t frame;
+    // Sorted by frame; events for the same frame stay in the order scheduled.
+    uint16_t event_count;
+    synthio_event_t events[CIRCUITPY_SYNTHIO_MAX_EVENTS];
 } synthio_synthesizer_obj_t;
 
 
@@ -0,0 +1,250 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+
+#include "py/runtime.h"
+#include "shared-bindings/synthio/Wavetable.h"
+#include "shared-module/synthio/Wavetable.h"
+
+#define MP_PI MICROPY_FLOAT_CONST(3.14159265358979323846)
+
+// Band-limiting happens once, at construction, from a discrete Fourier
+// transform of each single-cycle waveform. Mip level n keeps only the
+// harmonics that fit below the Nyquist frequency of a table of length
+// (length >> n), so a note can be played from the level it steps through at
+// most (1 << n) samples of the longest table at a time without aliasing. All
+// arithmetic is fixed point; only the cosine tables are computed in floating
+// point.
+
+typedef struct {
+    const int16_t *cos_in, *sin_in;
+    const int16_t *cos_out;
+    int32_t *a, *b;
+    uint32_t in_length, harmonics;
+} wavetable_work_t;
+
+STATIC void fill_table(int16_t *table, size_t len, bool sine) {
+    for (size_t i = 0; i < len; i++) {
+        mp_float_t angle = (mp_float_t)(2 * MP_PI) * i / len;
+        mp_float_t value = sine ? MICROPY_FLOAT_C_FUN(sin)(angle) : MICROPY_FLOAT_C_FUN(cos)(angle);
+        table[i] = (int16_t)MICROPY_FLOAT_C_FUN(round)(MICROPY_FLOAT_CONST(32767.) * value);
+    }
+}
+
+STATIC void wavetable_analyze(wavetable_work_t *work, const int16_t *waveform) {
+    uint32_t len = work->in_length;
+    for (uint32_t h = 0; h <= work->harmonics; h++) {
+        int64_t sum_cos = 0, sum_sin = 0;
+        uint32_t phase = 0;
+        for (uint32_t i = 0; i < len; i++) {
+            sum_cos += (int32_t)waveform[i] * work->cos_in[phase];
+            sum_sin += (int32_t)waveform[i] * work->sin_in[phase];
+            phase += h;
+            if (phase >= len) {
+                phase -= len;
+            }
+        }
+        int64_t den = (int64_t)len * 32767 * (h ? 1 : 2);
+        work->a[h] = (sum_cos * 2 + (sum_cos < 0 ? -den : den) / 2) / den;
+        work->b[h] = (sum_sin * 2 + (sum_sin < 0 ? -den : den) / 2) / den;
+    }
+}
+
+// Synthesize every mip level of one frame. When out is NULL only the peak
+// magnitude is computed, so that all frames can be scaled alike.
+STATIC int32_t wavetable_synthesize(synthio_wavetable_obj_t *self, wavetable_work_t *work, int16_t *out, int32_t peak) {
+    uint32_t mask = self->length - 1;
+    uint32_t quarter = self->length / 4;
+    int32_t result = 0;
+    for (uint8_t level = 0; level < self->level_count; level++) {
+        uint8_t shift = MIN(level, self->max_shift);
+        uint32_t len = self->length >> shift;
+        uint32_t harmonics = MIN(work->harmonics, (uint32_t)(self->length >> level) / 2 - 1);
+        for (uint32_t i = 0; i < len; i++) {
+            int64_t acc = (int64_t)work->a[0] << 15;
+            for (uint32_t h = 1; h <= harmonics; h++) {
+                uint32_t idx = ((h * i) << shift) & mask;
+                acc += work->a[h] * work->cos_out[idx];
+                acc += work->b[h] * work->cos_out[(idx - quarter) & mask];
+            }
+            int32_t sample = (acc + (1 << 14)) >> 15;
+            result = MAX(result, abs(sample));
+            if (out) {
+                if (peak > 32767) {
+                    sample = (int64_t)sample * 32767 / peak;
+                }
+                *out++ = MIN(32767, MAX(-32767, sample));
+            }
+        }
+    }
+    return result;
+}
+
+void common_hal_synthio_wavetable_construct(synthio_wavetable_obj_t *self, mp_obj_t waveforms) {
+    mp_buffer_info_t bufinfo;
+    size_t frame_count;
+    mp_obj_t *frames;
+    if (mp_get_buffer(waveforms, &bufinfo, MP_BUFFER_READ)) {
+        frame_count = 1;
+        frames = &waveforms;
+    } else {
+        mp_obj_get_array(waveforms, &frame_count, &frames);
+    }
+    mp_arg_validate_length_range(frame_count, 1, 65535, MP_QSTR_waveforms);
+
+    synthio_synth_parse_waveform(&bufinfo, frames[0]);
+    uint32_t in_length = mp_arg_validate_length_range(bufinfo.len, 2, SYNTHIO_WAVETABLE_MAX_LENGTH, MP_QSTR_waveform);
+    for (size_t i = 1; i < frame_count; i++) {
+        synthio_synth_parse_waveform(&bufinfo, frames[i]);
+        mp_arg_validate_length(bufinfo.len, in_length, MP_QSTR_waveform);
+    }
+
+    // the last level holds just the fundamental, as (length >> n) == 4
+    uint32_t length = SYNTHIO_WAVETABLE_MIN_LENGTH;
+    uint8_t max_shift = 0;
+    while (length < in_length) {
+        length *= 2;
+        max_shift++;
+    }
+
+    self->frame_count = frame_count;
+    self->length = length;
+    self->max_shift = max_shift;
+    self->level_count = max_shift + 3;
+    self->frame_stride = 2 * length + SYNTHIO_WAVETABLE_MIN_LENGTH;
+    self->table = m_new(int16_t, frame_count * self->frame_stride);
+
+    wavetable_work_t work = {
+        .in_length = in_length,
+        .harmonics = (in_length - 1) / 2,
+    };
+    int16_t *cos_in = m_new(int16_t, in_length);
+    int16_t *sin_in = m_new(int16_t, in_length);
+    int16_t *cos_out = m_new(int16_t, length);
+    work.a = m_new(int32_t, work.harmonics + 1);
+    work.b = m_new(int32_t, work.harmonics + 1);
+    fill_table(cos_in, in_length, false);
+    fill_table(sin_in, in_length, true);
+    fill_table(cos_out, length, false);
+    work.cos_in = cos_in;
+    work.sin_in = sin_in;
+    work.cos_out = cos_out;
+
+    // Gibbs overshoot can push band-limited sharp edges past full scale,
+    // so find the peak of all frames first and scale them together
+    int32_t peak = 0;
+    for (size_t i = 0; i < frame_count; i++) {
+        synthio_synth_parse_waveform(&bufinfo, frames[i]);
+        wavetable_analyze(&work, bufinfo.buf);
+        peak = MAX(peak, wavetable_synthesize(self, &work, NULL, 0));
+    }
+    for (size_t i = 0; i < frame_count; i++) {
+        synthio_synth_parse_waveform(&bufinfo, frames[i]);
+        wavetable_analyze(&work, bufinfo.buf);
+        wavetable_synthesize(self, &work, self->table + i * self->frame_stride, peak);
+    }
+
+    m_del(int32_t, work.b, work.harmonics + 1);
+    m_del(int32_t, work.a, work.harmonics + 1);
+    m_del(int16_t, cos_out, length);
+    m_del(int16_t, sin_in, in_length);
+    m_del(int16_t, cos_in, in_length);
+}
+
+mp_obj_t common_hal_synthio_wavetable_get_morph(synthio_wavetable_obj_t *self) {
+    return self->morph.obj;
+}
+
+void common_hal_synthio_wavetable_set_morph(synthio_wavetable_obj_t *self, mp_obj_t arg) {
+    synthio_block_assign_slot(arg, &self->morph, MP_QSTR_morph);
+}
+
+mp_int_t common_hal_synthio_wavetable_get_frame_count(synthio_wavetable_obj_t *self) {
+    return self->frame_count;
+}
+
+mp_int_t common_hal_synthio_wavetable_get_length(synthio_wavetable_obj_t *self) {
+    return self->length;
+}
+
+bool synthio_wavetable_render(synthio_wavetable_obj_t *self, uint32_t *accum_in, int32_t frequency_scaled, int32_t sample_rate, int32_t *out_buffer32, uint16_t dur) {
+    uint32_t dds_rate = synthio_frequency_convert_scaled_to_dds((uint64_t)frequency_scaled * self->length, sample_rate);
+
+    // Use the level with the most harmonics that all stay below nyquist; the
+    // last level holds only the fundamental, which is good up to twice the
+    // rate of the level before it
+    const int16_t *table = self->table;
+    uint8_t level = 0;
+    while ((dds_rate >> level) > (1 << SYNTHIO_FREQUENCY_SHIFT) && level + 1 < self->level_count) {
+        table += self->length >> MIN(level, self->max_shift);
+        level++;
+    }
+    if ((dds_rate >> level) > (2 << SYNTHIO_FREQUENCY_SHIFT)) {
+        // beyond nyquist, can't play note
+        return false;
+    }
+
+    mp_float_t morph = synthio_block_slot_get_limited(&self->morph, 0, self->frame_count - 1);
+    uint32_t frame = (uint32_t)morph;
+    int32_t morph_frac = (int32_t)((morph - frame) * 32768);
+    if (frame + 1 >= self->frame_count) {
+        frame = self->frame_count - 1;
+        morph_frac = 0;
+    }
+    table += frame * self->frame_stride;
+    const int16_t *next_table = table + self->frame_stride;
+
+    uint8_t shift = MIN(level, self->max_shift);
+    uint32_t mask = (self->length >> shift) - 1;
+    uint32_t lim = self->length << SYNTHIO_FREQUENCY_SHIFT;
+    uint32_t accum = *accum_in;
+
+    // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
+    if (accum >= lim) {
+        accum %= lim;
+    }
+
+    for (uint16_t i = 0; i < dur; i++) {
+        accum += dds_rate;
+        if (accum >= lim) {
+            accum -= lim;
+        }
+        uint32_t pos = accum >> shift;
+        uint32_t idx = pos >> SYNTHIO_FREQUENCY_SHIFT;
+        uint32_t idx_next = (idx + 1) & mask;
+        int32_t frac = (pos >> (SYNTHIO_FREQUENCY_SHIFT - 15)) & 0x7fff;
+        int32_t sample = table[idx] + (((table[idx_next] - table[idx]) * frac) >> 15);
+        if (morph_frac) {
+            int32_t other = next_table[idx] + (((next_table[idx_next] - next_table[idx]) * frac) >> 15);
+            sample += ((other - sample) * morph_frac) >> 15;
+        }
+        out_buffer32[i] = sample;
+    }
+    *accum_in = accum;
+    return true;
+}
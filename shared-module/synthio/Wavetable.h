@@ -0,0 +1,55 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "shared-module/synthio/block.h"
+
+// Longest band-limited table kept for each frame; longer single-cycle
+// waveforms are band-limited down to this many samples
+#define SYNTHIO_WAVETABLE_MAX_LENGTH (1024)
+// Shortest table kept for a mip level; the levels with only the lowest few
+// harmonics stay this long so that linear interpolation stays smooth
+#define SYNTHIO_WAVETABLE_MIN_LENGTH (16)
+
+typedef struct synthio_wavetable_obj {
+    mp_obj_base_t base;
+    synthio_block_slot_t morph;
+    // frame_count frames of frame_stride samples each; within a frame, the
+    // mip levels are stored back to back. Level n holds the harmonics that
+    // fit in (length >> n) samples, in a table of length >> MIN(n, max_shift).
+    int16_t *table;
+    uint16_t frame_count;
+    uint16_t length;
+    uint16_t frame_stride;
+    uint8_t level_count;
+    uint8_t max_shift;
+} synthio_wavetable_obj_t;
+
+// Fill dur samples of out_buffer32 from the wavetable at the given phase
+// accumulator and frequency. Returns false when even the shortest mip level
+// cannot represent the frequency.
+bool synthio_wavetable_render(synthio_wavetable_obj_t *self, uint32_t *accum, int32_t frequency_scaled, int32_t sample_rate, int32_t *out_buffer32, uint16_t dur);
@@ -29,6 +29,8 @@
 #include "shared-bindings/synthio/__init__.h"
 #include "shared-module/synthio/Biquad.h"
 #include "shared-module/synthio/Note.h"
+#include "shared-module/synthio/Wavetable.h"
+#include "shared-bindings/synthio/Wavetable.h"
 #include "py/runtime.h"
 #include <math.h>
 #include <stdlib.h>
@@ -188,6 +190,9 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
     uint32_t ring_waveform_start = 0;
     uint32_t ring_waveform_length = 0;
 
+    synthio_wavetable_obj_t *wavetable = NULL;
+    int32_t frequency_scaled = 0;
+
     if (mp_obj_is_small_int(note_obj)) {
         uint8_t note = mp_obj_get_int(note_obj);
         uint8_t octave = note / 12;
@@ -200,8 +205,10 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
         dds_rate = (sample_rate / 2 + ((uint64_t)(base_freq * waveform_length) << (SYNTHIO_FREQUENCY_SHIFT - 10 + octave))) / sample_rate;
     } else {
         synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
-        int32_t frequency_scaled = synthio_note_step(note, sample_rate, dur, loudness);
-        if (note->waveform_buf.buf) {
+        frequency_scaled = synthio_note_step(note, sample_rate, dur, loudness);
+        if (mp_obj_is_type(note->waveform_obj, &synthio_wavetable_type)) {
+            wavetable = MP_OBJ_TO_PTR(note->waveform_obj);
+        } else if (note->waveform_buf.buf) {
             waveform = note->waveform_buf.buf;
             waveform_length = note->waveform_buf.len;
             if (note->waveform_loop_start > 0 && note->waveform_loop_start < waveform_length) {
@@ -229,6 +236,32 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
         }
     }
 
+    if (wavetable) {
+        if (!synthio_wavetable_render(wavetable, &synth->accum[chan], frequency_scaled, sample_rate, out_buffer32, dur)) {
+            return false;
+        }
+        if (!ring_dds_rate) {
+            return true;
+        }
+        // modulate the band-limited waveform by ring in a second pass
+        uint32_t ring_accum = synth->ring_accum[chan];
+        uint32_t ring_offset = ring_waveform_start << SYNTHIO_FREQUENCY_SHIFT;
+        uint32_t ring_lim = ring_waveform_length << SYNTHIO_FREQUENCY_SHIFT;
+        if (ring_accum > ring_lim) {
+            ring_accum = ring_accum % ring_lim + ring_offset;
+        }
+        for (uint16_t i = 0; i < dur; i++) {
+            ring_accum += ring_dds_rate;
+            if (ring_accum > ring_lim) {
+                ring_accum = ring_accum - ring_lim + ring_offset;
+            }
+            int16_t ring_idx = ring_accum >> SYNTHIO_FREQUENCY_SHIFT;
+            out_buffer32[i] = (ring_waveform[ring_idx] * out_buffer32[i]) / 32768;
+        }
+        synth->ring_accum[chan] = ring_accum;
+        return true;
+    }
+
     uint32_t offset = waveform_start << SYNTHIO_FREQUENCY_SHIFT;
     uint32_t lim = waveform_length << SYNTHIO_FREQUENCY_SHIFT;
     uint32_t accum = synth->accum[chan];
@@ -243,47 +276,52 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
         accum = accum % lim + offset;
     }
 
-    // first, fill with waveform
-    for (uint16_t i = 0; i < dur; i++) {
-        accum += dds_rate;
-        // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
-        if (accum > lim) {
-            accum = accum - lim + offset;
-        }
-        int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-        out_buffer32[i] = waveform[idx];
+    if (ring_dds_rate > lim / 2) {
+        // beyond nyquist, can't play ring (but can still synth the main sound)
+        ring_dds_rate = 0;
     }
-    synth->accum[chan] = accum;
-
-    if (ring_dds_rate) {
-        if (ring_dds_rate > lim / 2) {
-            // beyond nyquist, can't play ring (but did synth main sound so
-            // return true)
-            return true;
-        }
-
-        // now modulate by ring and accumulate
-        accum = synth->ring_accum[chan];
-        offset = ring_waveform_start << SYNTHIO_FREQUENCY_SHIFT;
-        lim = ring_waveform_length << SYNTHIO_FREQUENCY_SHIFT;
-
-        // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
-        if (accum > lim) {
-            accum = accum % lim + offset;
-        }
 
+    if (!ring_dds_rate) {
+        // fill with waveform
         for (uint16_t i = 0; i < dur; i++) {
-            accum += ring_dds_rate;
+            accum += dds_rate;
             // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
             if (accum > lim) {
                 accum = accum - lim + offset;
             }
             int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-            int16_t wi = (ring_waveform[idx] * out_buffer32[i]) / 32768;
-            out_buffer32[i] = wi;
+            out_buffer32[i] = waveform[idx];
         }
-        synth->ring_accum[chan] = accum;
+        synth->accum[chan] = accum;
+        return true;
     }
+
+    // fill with waveform modulated by ring, in the same pass
+    uint32_t ring_accum = synth->ring_accum[chan];
+    uint32_t ring_offset = ring_waveform_start << SYNTHIO_FREQUENCY_SHIFT;
+    uint32_t ring_lim = ring_waveform_length << SYNTHIO_FREQUENCY_SHIFT;
+
+    // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
+    if (ring_accum > ring_lim) {
+        ring_accum = ring_accum % ring_lim + ring_offset;
+    }
+
+    for (uint16_t i = 0; i < dur; i++) {
+        accum += dds_rate;
+        if (accum > lim) {
+            accum = accum - lim + offset;
+        }
+        ring_accum += ring_dds_rate;
+        if (ring_accum > ring_lim) {
+            ring_accum = ring_accum - ring_lim + ring_offset;
+        }
+        int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
+        int16_t ring_idx = ring_accum >> SYNTHIO_FREQUENCY_SHIFT;
+        int16_t wi = (ring_waveform[ring_idx] * waveform[idx]) / 32768;
+        out_buffer32[i] = wi;
+    }
+    synth->accum[chan] = accum;
+    synth->ring_accum[chan] = ring_accum;
     return true;
 }
 
@@ -298,6 +336,26 @@ STATIC mp_obj_t synthio_synth_get_note_filter(mp_obj_t note_obj) {
     return mp_const_none;
 }
 
+// Ramp linearly from the previous block's loudness, so that envelope and
+// block input changes don't step at block boundaries
+STATIC void sum_with_loudness_ramp(int32_t *out_buffer32, int32_t *tmp_buffer32, int16_t last_loudness[2], int16_t loudness[2], size_t dur, int synth_chan) {
+    int32_t level0 = last_loudness[0] << 14, step0 = ((loudness[0] - last_loudness[0]) << 14) / (int32_t)dur;
+    int32_t level1 = last_loudness[1] << 14, step1 = ((loudness[1] - last_loudness[1]) << 14) / (int32_t)dur;
+    if (synth_chan == 1) {
+        for (size_t i = 0; i < dur; i++) {
+            level0 += step0;
+            *out_buffer32++ += (*tmp_buffer32++ *(level0 >> 14)) >> 16;
+        }
+    } else {
+        for (size_t i = 0; i < dur; i++) {
+            level0 += step0;
+            level1 += step1;
+            *out_buffer32++ += (*tmp_buffer32 * (level0 >> 14)) >> 16;
+            *out_buffer32++ += (*tmp_buffer32++ *(level1 >> 14)) >> 16;
+        }
+    }
+}
+
 STATIC void sum_with_loudness(int32_t *out_buffer32, int32_t *tmp_buffer32, int16_t loudness[2], size_t dur, int synth_chan) {
     if (synth_chan == 1) {
         for (size_t i = 0; i < dur; i++) {
@@ -319,13 +377,23 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
         return;
     }
 
-    shared_bindings_synthio_lfo_tick(synth->sample_rate);
-
     synth->buffer_index = !synth->buffer_index;
     synth->other_channel = 1 - channel;
     synth->other_buffer_index = synth->buffer_index;
 
     uint16_t dur = MIN(SYNTHIO_MAX_DUR, synth->span.dur);
+    if (synth->control_period) {
+        // update the block graph once per control period, ending blocks
+        // early so that updates land on the period
+        if (synth->control_remaining == 0) {
+            synth->control_remaining = synth->control_period;
+            shared_bindings_synthio_lfo_tick(synth->sample_rate, synth->control_period);
+        }
+        dur = MIN(dur, synth->control_remaining);
+        synth->control_remaining -= dur;
+    } else {
+        shared_bindings_synthio_lfo_tick(synth->sample_rate, dur);
+    }
     synth->span.dur -= dur;
 
     int32_t out_buffer32[SYNTHIO_MAX_DUR * synth->channel_count];
@@ -346,7 +414,11 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
 
         int16_t loudness[2] = {synth->envelope_state[chan].level, synth->envelope_state[chan].level};
 
-        if (!synth_note_into_buffer(synth, chan, tmp_buffer32, dur, loudness)) {
+        bool synthed = synth_note_into_buffer(synth, chan, tmp_buffer32, dur, loudness);
+        int16_t last_loudness[2] = {synth->last_loudness[chan][0], synth->last_loudness[chan][1]};
+        synth->last_loudness[chan][0] = loudness[0];
+        synth->last_loudness[chan][1] = loudness[1];
+        if (!synthed) {
             // for some other reason, such as being above nyquist, note
             // couldn't be synthed, so don't filter or sum it in
             continue;
@@ -359,7 +431,11 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
         }
 
         // adjust loudness by envelope
-        sum_with_loudness(out_buffer32, tmp_buffer32, loudness, dur, synth->channel_count);
+        if (last_loudness[0] == INT16_MIN || (last_loudness[0] == loudness[0] && last_loudness[1] == loudness[1])) {
+            sum_with_loudness(out_buffer32, tmp_buffer32, loudness, dur, synth->channel_count);
+        } else {
+            sum_with_loudness_ramp(out_buffer32, tmp_buffer32, last_loudness, loudness, dur, synth->channel_count);
+        }
     }
 
     int16_t *out_buffer16 = (int16_t *)(void *)synth->buffers[synth->buffer_index];
@@ -422,6 +498,7 @@ void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channe
 
     for (size_t i = 0; i < CIRCUITPY_SYNTHIO_MAX_CHANNELS; i++) {
         synth->span.note_obj[i] = SYNTHIO_SILENCE;
+        synth->last_loudness[i][0] = synth->last_loudness[i][1] = INT16_MIN;
     }
 }
 
@@ -491,6 +568,7 @@ bool synthio_span_change_note(synthio_synth_t *synth, mp_obj_t old_note, mp_obj_
             synth->span.note_obj[channel] = new_note;
             synthio_envelope_state_init(&synth->envelope_state[channel], synthio_synth_get_note_envelope(synth, new_note));
             synth->accum[channel] = 0;
+            synth->last_loudness[channel][0] = synth->last_loudness[channel][1] = INT16_MIN;
         }
         return true;
     }
@@ -509,8 +587,8 @@ uint32_t synthio_frequency_convert_scaled_to_dds(uint64_t frequency_scaled, int3
     return (sample_rate / 2 + frequency_scaled) / sample_rate;
 }
 
-void shared_bindings_synthio_lfo_tick(uint32_t sample_rate) {
-    synthio_global_rate_scale = (mp_float_t)SYNTHIO_MAX_DUR / sample_rate;
+void shared_bindings_synthio_lfo_tick(uint32_t sample_rate, uint32_t dur) {
+    synthio_global_rate_scale = (mp_float_t)dur / sample_rate;
     synthio_global_tick++;
 }
 
@@ -71,6 +71,10 @@ typedef struct synthio_synth {
     uint32_t accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
     uint32_t ring_accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
     synthio_envelope_state_t envelope_state[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
+    // loudness at the end of the previous block, or INT16_MIN for a just-started note
+    int16_t last_loudness[CIRCUITPY_SYNTHIO_MAX_CHANNELS][2];
+    // frames between updates of the block graph, or 0 to update every block
+    uint32_t control_period, control_remaining;
 } synthio_synth_t;
 
 typedef struct {
@@ -110,4 +114,4 @@ int synthio_sweep_in_step(synthio_lfo_state_t *state, uint16_t dur);
 
 extern mp_float_t synthio_global_rate_scale;
 extern uint8_t synthio_global_tick;
-void shared_bindings_synthio_lfo_tick(uint32_t sample_rate);
+void shared_bindings_synthio_lfo_tick(uint32_t sample_rate, uint32_t dur);
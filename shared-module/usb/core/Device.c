@@ -29,6 +29,7 @@
 #include "tusb_config.h"
 
 #include "lib/tinyusb/src/host/usbh.h"
+#include "py/ringbuf.h"
 #include "py/runtime.h"
 #include "shared/runtime/interrupt_char.h"
 #include "shared-bindings/usb/core/__init__.h"
@@ -44,8 +45,51 @@ void tuh_mount_cb(uint8_t dev_addr) {
     _mounted_devices |= 1 << dev_addr;
 }
 
+// IN endpoints that are read in the background by read_into(). TinyUSB allows
+// one queued transfer per endpoint, so each stream keeps its endpoint armed
+// from the completion callback and collects the data in a ring buffer.
+#define USB_CORE_MAX_STREAMS (4)
+#define USB_CORE_STREAM_TRANSFER_SIZE (512)
+#define USB_CORE_STREAM_RING_SIZE (2048)
+
+typedef struct {
+    ringbuf_t ringbuf;
+    uint8_t *transfer_buffer;
+    uint8_t device_number;
+    uint8_t endpoint;
+    bool transfer_queued;
+} usb_core_stream_t;
+
+STATIC usb_core_stream_t _streams[USB_CORE_MAX_STREAMS];
+
+MP_REGISTER_ROOT_POINTER(uint8_t *usb_core_stream_buffers[4]);
+
+STATIC void _stop_stream(usb_core_stream_t *stream, bool abort) {
+    if (stream->transfer_queued && abort) {
+        tuh_edpt_abort_xfer(stream->device_number, stream->endpoint);
+    }
+    stream->device_number = 0;
+    stream->endpoint = 0;
+    stream->transfer_queued = false;
+    MP_STATE_VM(usb_core_stream_buffers)[stream - _streams] = NULL;
+}
+
+void usb_core_reset(void) {
+    for (size_t i = 0; i < USB_CORE_MAX_STREAMS; i++) {
+        if (_streams[i].device_number != 0) {
+            _stop_stream(&_streams[i], true);
+        }
+    }
+}
+
 void tuh_umount_cb(uint8_t dev_addr) {
     _mounted_devices &= ~(1 << dev_addr);
+    // The endpoints are gone so there is nothing to abort.
+    for (size_t i = 0; i < USB_CORE_MAX_STREAMS; i++) {
+        if (_streams[i].device_number == dev_addr) {
+            _stop_stream(&_streams[i], false);
+        }
+    }
 }
 
 STATIC xfer_result_t _xfer_result;
@@ -240,6 +284,80 @@ STATIC bool _open_endpoint(usb_core_device_obj_t *self, mp_int_t endpoint) {
     return open;
 }
 
+STATIC void _stream_done_cb(tuh_xfer_t *xfer);
+
+// Queue the next transfer if the ring has room for all of it. Otherwise the
+// endpoint is left idle, so the device is held off instead of losing data,
+// and read_into() queues it again once it has drained the ring.
+STATIC void _queue_stream(usb_core_stream_t *stream) {
+    if (stream->transfer_queued ||
+        ringbuf_num_empty(&stream->ringbuf) < USB_CORE_STREAM_TRANSFER_SIZE) {
+        return;
+    }
+    tuh_xfer_t xfer = {
+        .daddr = stream->device_number,
+        .ep_addr = stream->endpoint,
+        .buffer = stream->transfer_buffer,
+        .buflen = USB_CORE_STREAM_TRANSFER_SIZE,
+        .complete_cb = _stream_done_cb,
+    };
+    stream->transfer_queued = tuh_edpt_xfer(&xfer);
+}
+
+STATIC usb_core_stream_t *_find_stream(uint8_t device_number, uint8_t endpoint) {
+    for (size_t i = 0; i < USB_CORE_MAX_STREAMS; i++) {
+        if (_streams[i].device_number == device_number && _streams[i].endpoint == endpoint) {
+            return &_streams[i];
+        }
+    }
+    return NULL;
+}
+
+STATIC void _stream_done_cb(tuh_xfer_t *xfer) {
+    usb_core_stream_t *stream = _find_stream(xfer->daddr, xfer->ep_addr);
+    if (stream == NULL) {
+        return;
+    }
+    stream->transfer_queued = false;
+    if (xfer->result == XFER_RESULT_SUCCESS) {
+        ringbuf_put_n(&stream->ringbuf, stream->transfer_buffer, xfer->actual_len);
+    }
+    // Requeue from the callback so the endpoint is idle as briefly as possible.
+    if (xfer->result != XFER_RESULT_STALLED) {
+        _queue_stream(stream);
+    }
+}
+
+STATIC usb_core_stream_t *_start_stream(usb_core_device_obj_t *self, uint8_t endpoint) {
+    usb_core_stream_t *stream = _find_stream(self->device_number, endpoint);
+    if (stream != NULL) {
+        return stream;
+    }
+    stream = _find_stream(0, 0);
+    if (stream == NULL) {
+        mp_raise_usb_core_USBError(NULL);
+    }
+    // One heap block holds the transfer buffer and then the ring.
+    uint8_t *buffer = m_malloc(USB_CORE_STREAM_TRANSFER_SIZE + USB_CORE_STREAM_RING_SIZE);
+    MP_STATE_VM(usb_core_stream_buffers)[stream - _streams] = buffer;
+    stream->transfer_buffer = buffer;
+    ringbuf_init(&stream->ringbuf, buffer + USB_CORE_STREAM_TRANSFER_SIZE, USB_CORE_STREAM_RING_SIZE);
+    stream->device_number = self->device_number;
+    stream->endpoint = endpoint;
+    stream->transfer_queued = false;
+    return stream;
+}
+
+mp_int_t common_hal_usb_core_device_read_into(usb_core_device_obj_t *self, mp_int_t endpoint, uint8_t *buffer, mp_int_t len) {
+    if ((endpoint & TUSB_DIR_IN_MASK) == 0 || !_open_endpoint(self, endpoint)) {
+        mp_raise_usb_core_USBError(NULL);
+    }
+    usb_core_stream_t *stream = _start_stream(self, endpoint);
+    size_t count = ringbuf_get_n(&stream->ringbuf, buffer, len);
+    _queue_stream(stream);
+    return count;
+}
+
 mp_int_t common_hal_usb_core_device_write(usb_core_device_obj_t *self, mp_int_t endpoint, const uint8_t *buffer, mp_int_t len, mp_int_t timeout) {
     if (!_open_endpoint(self, endpoint)) {
         mp_raise_usb_core_USBError(NULL);
@@ -256,6 +374,24 @@ mp_int_t common_hal_usb_core_device_read(usb_core_device_obj_t *self, mp_int_t e
     if (!_open_endpoint(self, endpoint)) {
         mp_raise_usb_core_USBError(NULL);
     }
+    // A streamed endpoint already has a transfer queued, so wait on its ring instead.
+    usb_core_stream_t *stream = _find_stream(self->device_number, endpoint);
+    if (stream != NULL) {
+        uint32_t start_time = supervisor_ticks_ms32();
+        while (ringbuf_num_filled(&stream->ringbuf) == 0) {
+            if (mp_hal_is_interrupted()) {
+                return 0;
+            }
+            if (timeout != 0 && supervisor_ticks_ms32() - start_time >= (uint32_t)timeout) {
+                mp_raise_usb_core_USBTimeoutError();
+            }
+            _queue_stream(stream);
+            RUN_BACKGROUND_TASKS;
+        }
+        size_t count = ringbuf_get_n(&stream->ringbuf, buffer, len);
+        _queue_stream(stream);
+        return count;
+    }
     tuh_xfer_t xfer;
     xfer.daddr = self->device_number;
     xfer.ep_addr = endpoint;
@@ -37,4 +37,7 @@ typedef struct {
     uint8_t open_endpoints[8];
 } usb_core_device_obj_t;
 
+// Stop all background endpoint streams before the heap goes away.
+void usb_core_reset(void);
+
 #endif // MICROPY_INCLUDED_SHARED_MODULE_USB_CORE_DEVICE_H
@@ -78,14 +78,52 @@ size_t common_hal_usb_cdc_serial_read(usb_cdc_serial_obj_t *self, uint8_t *data,
     return total_num_read;
 }
 
+void usb_cdc_serial_write_buffered(usb_cdc_serial_obj_t *self) {
+    if (self->tx_ringbuf == NULL) {
+        return;
+    }
+    uint8_t chunk[64];
+    bool wrote = false;
+    while (ringbuf_num_filled(self->tx_ringbuf) > 0) {
+        uint32_t available = tud_cdc_n_write_available(self->idx);
+        if (available == 0) {
+            break;
+        }
+        size_t num_read = ringbuf_get_n(self->tx_ringbuf, chunk, MIN(available, sizeof(chunk)));
+        tud_cdc_n_write(self->idx, chunk, num_read);
+        wrote = true;
+    }
+    if (wrote) {
+        tud_cdc_n_write_flush(self->idx);
+    }
+}
+
+// Write directly to the TinyUSB FIFO when nothing is buffered, and buffer whatever
+// doesn't fit. Buffered output always goes out first so that order is kept.
+// Pass flush=false to leave a short packet in the FIFO for the next write to fill.
+STATIC size_t _write(usb_cdc_serial_obj_t *self, const uint8_t *data, size_t len, bool flush) {
+    size_t num_written = 0;
+    usb_cdc_serial_write_buffered(self);
+    if (self->tx_ringbuf == NULL || ringbuf_num_filled(self->tx_ringbuf) == 0) {
+        num_written = tud_cdc_n_write(self->idx, data, len);
+        if (flush) {
+            tud_cdc_n_write_flush(self->idx);
+        }
+    }
+    if (self->tx_ringbuf != NULL) {
+        num_written += ringbuf_put_n(self->tx_ringbuf, data + num_written, len - num_written);
+    }
+    return num_written;
+}
+
 size_t common_hal_usb_cdc_serial_write(usb_cdc_serial_obj_t *self, const uint8_t *data, size_t len, int *errcode) {
     const bool wait_forever = self->write_timeout < 0.0f;
     const bool wait_for_timeout = self->write_timeout > 0.0f;
 
     // Write as many bytes as possible immediately.
-    // The number of bytes written at once will not be larger than what can fit in the TinyUSB FIFO.
-    uint32_t total_num_written = tud_cdc_n_write(self->idx, data, len);
-    tud_cdc_n_write_flush(self->idx);
+    // The number of bytes written at once will not be larger than what can fit in the
+    // TinyUSB FIFO and the transmit buffer.
+    uint32_t total_num_written = _write(self, data, len, true);
 
     if (wait_forever || wait_for_timeout) {
         // Continue writing the rest of the buffer.
@@ -112,8 +150,7 @@ size_t common_hal_usb_cdc_serial_write(usb_cdc_serial_obj_t *self, const uint8_t
             data += num_written;
 
             // Try to write another batch of bytes.
-            num_written = tud_cdc_n_write(self->idx, data, len);
-            tud_cdc_n_write_flush(self->idx);
+            num_written = _write(self, data, len, true);
             total_num_written += num_written;
         }
     }
@@ -121,13 +158,48 @@ size_t common_hal_usb_cdc_serial_write(usb_cdc_serial_obj_t *self, const uint8_t
     return total_num_written;
 }
 
+// Queue all the pieces before flushing so that small pieces share USB packets.
+size_t common_hal_usb_cdc_serial_writev(usb_cdc_serial_obj_t *self, const mp_buffer_info_t *bufs, size_t count, int *errcode) {
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t *data = bufs[i].buf;
+        size_t len = bufs[i].len;
+        size_t num_written = _write(self, data, len, false);
+        total += num_written;
+        if (num_written < len) {
+            // The FIFO and buffer are full: send what's queued and let the usual
+            // write timeout apply to the rest of this piece.
+            tud_cdc_n_write_flush(self->idx);
+            size_t remaining = len - num_written;
+            num_written = common_hal_usb_cdc_serial_write(self, data + num_written, remaining, errcode);
+            total += num_written;
+            if (num_written < remaining) {
+                return total;
+            }
+        }
+    }
+    tud_cdc_n_write_flush(self->idx);
+    return total;
+}
+
 uint32_t common_hal_usb_cdc_serial_get_in_waiting(usb_cdc_serial_obj_t *self) {
     return tud_cdc_n_available(self->idx);
 }
 
 uint32_t common_hal_usb_cdc_serial_get_out_waiting(usb_cdc_serial_obj_t *self) {
-    // Return number of FIFO bytes currently occupied.
-    return CFG_TUD_CDC_TX_BUFSIZE - tud_cdc_n_write_available(self->idx);
+    // Return number of FIFO and buffer bytes currently occupied.
+    uint32_t out_waiting = CFG_TUD_CDC_TX_BUFSIZE - tud_cdc_n_write_available(self->idx);
+    if (self->tx_ringbuf != NULL) {
+        out_waiting += ringbuf_num_filled(self->tx_ringbuf);
+    }
+    return out_waiting;
+}
+
+uint32_t common_hal_usb_cdc_serial_get_out_available(usb_cdc_serial_obj_t *self) {
+    if (self->tx_ringbuf != NULL) {
+        return ringbuf_num_empty(self->tx_ringbuf);
+    }
+    return tud_cdc_n_write_available(self->idx);
 }
 
 void common_hal_usb_cdc_serial_reset_input_buffer(usb_cdc_serial_obj_t *self) {
@@ -135,10 +207,21 @@ void common_hal_usb_cdc_serial_reset_input_buffer(usb_cdc_serial_obj_t *self) {
 }
 
 uint32_t common_hal_usb_cdc_serial_reset_output_buffer(usb_cdc_serial_obj_t *self) {
+    if (self->tx_ringbuf != NULL) {
+        ringbuf_clear(self->tx_ringbuf);
+    }
     return tud_cdc_n_write_clear(self->idx);
 }
 
 uint32_t common_hal_usb_cdc_serial_flush(usb_cdc_serial_obj_t *self) {
+    // Wait for the transmit buffer to drain into the TinyUSB FIFO.
+    while (self->tx_ringbuf != NULL &&
+           ringbuf_num_filled(self->tx_ringbuf) > 0 &&
+           tud_cdc_n_connected(self->idx) &&
+           !mp_hal_is_interrupted()) {
+        usb_cdc_serial_write_buffered(self);
+        RUN_BACKGROUND_TASKS;
+    }
     return tud_cdc_n_write_flush(self->idx);
 }
 
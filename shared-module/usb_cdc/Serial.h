@@ -28,12 +28,18 @@
 #define SHARED_MODULE_USB_CDC_SERIAL_H
 
 #include "py/obj.h"
+#include "py/ringbuf.h"
 
 typedef struct {
     mp_obj_base_t base;
     mp_float_t timeout;       // if negative, wait forever.
     mp_float_t write_timeout; // if negative, wait forever.
+    ringbuf_t *tx_ringbuf;    // Output waiting for room in the TinyUSB FIFO. NULL if unbuffered.
     uint8_t idx;              // which CDC device?
 } usb_cdc_serial_obj_t;
 
+// Move buffered output into the TinyUSB FIFO as room frees up. Called from the USB
+// background task.
+void usb_cdc_serial_write_buffered(usb_cdc_serial_obj_t *self);
+
 #endif // SHARED_MODULE_USB_CDC_SERIAL_H
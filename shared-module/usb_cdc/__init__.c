@@ -165,6 +165,11 @@ static usb_cdc_serial_obj_t usb_cdc_data_obj = {
     .write_timeout = -1.0f,
 };
 
+#if CIRCUITPY_USB_CDC_DATA_TX_BUFFER_SIZE > 0
+static uint8_t usb_cdc_data_tx_buffer[CIRCUITPY_USB_CDC_DATA_TX_BUFFER_SIZE];
+static ringbuf_t usb_cdc_data_tx_ringbuf;
+#endif
+
 static bool usb_cdc_console_is_enabled;
 static bool usb_cdc_data_is_enabled;
 
@@ -181,6 +186,12 @@ bool usb_cdc_data_enabled(void) {
     return usb_cdc_data_is_enabled;
 }
 
+void usb_cdc_background(void) {
+    if (usb_cdc_data_is_enabled) {
+        usb_cdc_serial_write_buffered(&usb_cdc_data_obj);
+    }
+}
+
 size_t usb_cdc_descriptor_length(void) {
     return sizeof(usb_cdc_descriptor_template);
 }
@@ -258,6 +269,10 @@ bool common_hal_usb_cdc_enable(bool console, bool data) {
     usb_cdc_set_data(data ? MP_OBJ_FROM_PTR(&usb_cdc_data_obj) : mp_const_none);
     if (data) {
         usb_cdc_data_obj.idx = idx;
+        #if CIRCUITPY_USB_CDC_DATA_TX_BUFFER_SIZE > 0
+        ringbuf_init(&usb_cdc_data_tx_ringbuf, usb_cdc_data_tx_buffer, sizeof(usb_cdc_data_tx_buffer));
+        usb_cdc_data_obj.tx_ringbuf = &usb_cdc_data_tx_ringbuf;
+        #endif
     }
 
 
@@ -380,7 +395,7 @@ uint8_t const *vendor_ms_os_20_descriptor() {
 
 size_t usb_vendor_add_descriptor(uint8_t *descriptor_buf, descriptor_counts_t *descriptor_counts, uint8_t *current_interface_string) {
     if (ms_os_20_descriptor == NULL) {
-        ms_os_20_descriptor = port_malloc(sizeof(ms_os_20_descriptor_template), false);
+        ms_os_20_descriptor = port_malloc_tagged(sizeof(ms_os_20_descriptor_template), false, PORT_HEAP_TAG_USB);
         if (ms_os_20_descriptor == NULL) {
             return 0;
         }
@@ -33,6 +33,7 @@
 
 bool usb_cdc_console_enabled(void);
 bool usb_cdc_data_enabled(void);
+void usb_cdc_background(void);
 
 void usb_cdc_set_defaults(void);
 
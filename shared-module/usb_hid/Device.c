@@ -28,6 +28,7 @@
 #include <string.h>
 
 #include "py/gc.h"
+#include "py/ringbuf.h"
 #include "py/runtime.h"
 #include "shared-bindings/usb_hid/Device.h"
 #include "shared-module/usb_hid/__init__.h"
@@ -217,25 +218,61 @@ uint16_t common_hal_usb_hid_device_get_usage(usb_hid_device_obj_t *self) {
     return self->usage;
 }
 
-void common_hal_usb_hid_device_send_report(usb_hid_device_obj_t *self, uint8_t *report, uint8_t len, uint8_t report_id) {
+// Reports sent without blocking wait here as [report id][length][report] until the
+// HID IN endpoint is free. All the devices share that one endpoint, so a single
+// queue keeps the reports in the order they were sent.
+STATIC uint8_t report_queue_buf[CIRCUITPY_USB_HID_REPORT_QUEUE_SIZE];
+STATIC ringbuf_t report_queue = { report_queue_buf, sizeof(report_queue_buf), 0, 0, 0 };
+
+void usb_hid_clear_report_queue(void) {
+    ringbuf_clear(&report_queue);
+}
+
+// Called from the USB background task, after TinyUSB has handled any report
+// completion, and after each queued report is added.
+void usb_hid_send_queued_report(void) {
+    if (ringbuf_num_filled(&report_queue) == 0 || !tud_hid_ready()) {
+        return;
+    }
+    uint8_t report_id = ringbuf_get(&report_queue);
+    uint8_t len = ringbuf_get(&report_queue);
+    uint8_t report[UINT8_MAX];
+    ringbuf_get_n(&report_queue, report, len);
+    tud_hid_report(report_id, report, len);
+}
+
+bool common_hal_usb_hid_device_send_report(usb_hid_device_obj_t *self, uint8_t *report, uint8_t len, uint8_t report_id, bool block) {
     // report_id and len have already been validated for this device.
     size_t id_idx = get_report_id_idx(self, report_id);
 
     mp_arg_validate_length(len, self->in_report_lengths[id_idx], MP_QSTR_report);
 
-    // Wait until interface is ready, timeout = 2 seconds
+    if (!block) {
+        if (ringbuf_num_empty(&report_queue) < (size_t)len + 2) {
+            return false;
+        }
+        ringbuf_put(&report_queue, report_id);
+        ringbuf_put(&report_queue, len);
+        ringbuf_put_n(&report_queue, report, len);
+        usb_hid_send_queued_report();
+        return true;
+    }
+
+    // Wait until interface is ready and earlier queued reports have gone, timeout = 2 seconds
     uint64_t end_ticks = supervisor_ticks_ms64() + 2000;
-    while ((supervisor_ticks_ms64() < end_ticks) && !tud_hid_ready()) {
+    while ((supervisor_ticks_ms64() < end_ticks) &&
+           (ringbuf_num_filled(&report_queue) > 0 || !tud_hid_ready())) {
         RUN_BACKGROUND_TASKS;
     }
 
-    if (!tud_hid_ready()) {
+    if (ringbuf_num_filled(&report_queue) > 0 || !tud_hid_ready()) {
         mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("USB busy"));
     }
 
     if (!tud_hid_report(report_id, report, len)) {
         mp_raise_msg(&mp_type_OSError, MP_ERROR_TEXT("USB error"));
     }
+    return true;
 }
 
 mp_obj_t common_hal_usb_hid_device_get_last_received_report(usb_hid_device_obj_t *self, uint8_t report_id) {
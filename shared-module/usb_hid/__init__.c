@@ -253,6 +253,9 @@ void usb_hid_setup_devices(void) {
 
     usb_hid_set_devices_from_hid_devices();
 
+    // Reports queued for the previous devices are not sent.
+    usb_hid_clear_report_queue();
+
     // Create report buffers on the heap.
     for (mp_int_t i = 0; i < num_hid_devices; i++) {
         usb_hid_device_create_report_buffers(&hid_devices[i]);
@@ -275,7 +278,7 @@ void usb_hid_build_report_descriptor(void) {
         return;
     }
     size_t report_length = usb_hid_report_descriptor_length();
-    hid_report_descriptor = port_malloc(report_length, false);
+    hid_report_descriptor = port_malloc_tagged(report_length, false, PORT_HEAP_TAG_USB);
     if (hid_report_descriptor == NULL) {
         return;
     }
@@ -46,6 +46,9 @@ void usb_hid_build_report_descriptor(void);
 
 bool usb_hid_get_device_with_report_id(uint8_t report_id, usb_hid_device_obj_t **device_out, size_t *id_idx_out);
 
+void usb_hid_clear_report_queue(void);
+void usb_hid_send_queued_report(void);
+
 void usb_hid_gc_collect(void);
 
 #endif // SHARED_MODULE_USB_HID___INIT___H
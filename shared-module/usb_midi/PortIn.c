@@ -24,8 +24,11 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "shared-bindings/usb_midi/PortIn.h"
 #include "shared-module/usb_midi/PortIn.h"
+#include "shared-module/usb_midi/__init__.h"
 #include "supervisor/shared/translate/translate.h"
 #include "tusb.h"
 
@@ -36,3 +39,60 @@ size_t common_hal_usb_midi_portin_read(usb_midi_portin_obj_t *self, uint8_t *dat
 uint32_t common_hal_usb_midi_portin_bytes_available(usb_midi_portin_obj_t *self) {
     return tud_midi_available();
 }
+
+// Each USB MIDI event packet carries one complete message, so no running status
+// or byte stream state is needed. System exclusive data is skipped.
+STATIC bool usb_midi_portin_unpack(const uint8_t packet[4], usb_midi_message_t *message) {
+    uint8_t code_index = packet[0] & 0xf;
+    uint8_t length;
+    switch (code_index) {
+        case 0x2: // two-byte system common
+        case 0xc: // program change
+        case 0xd: // channel pressure
+            length = 2;
+            break;
+        case 0x3: // three-byte system common
+        case 0x8:
+        case 0x9:
+        case 0xa:
+        case 0xb:
+        case 0xe:
+            length = 3;
+            break;
+        case 0x5: // tune request, or the end of system exclusive data
+            if (packet[1] != 0xf6) {
+                return false;
+            }
+            length = 1;
+            break;
+        case 0xf: // system real time, or a lone byte
+            if (packet[1] < 0xf8) {
+                return false;
+            }
+            length = 1;
+            break;
+        default:
+            return false;
+    }
+    message->status = packet[1];
+    message->data1 = length > 1 ? packet[2] : 0;
+    message->data2 = length > 2 ? packet[3] : 0;
+    message->reserved = 0;
+    return true;
+}
+
+size_t common_hal_usb_midi_portin_read_messages(usb_midi_portin_obj_t *self, uint8_t *buffer, size_t max_count) {
+    uint32_t now = usb_midi_ticks_ms();
+    size_t count = 0;
+    uint8_t packet[4];
+    while (count < max_count && tud_midi_packet_read(packet)) {
+        usb_midi_message_t message;
+        if (!usb_midi_portin_unpack(packet, &message)) {
+            continue;
+        }
+        message.timestamp = now;
+        memcpy(buffer + count * sizeof(message), &message, sizeof(message));
+        count++;
+    }
+    return count;
+}
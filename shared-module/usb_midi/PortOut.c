@@ -24,8 +24,13 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
+#include "py/runtime.h"
 #include "shared-bindings/usb_midi/PortOut.h"
 #include "shared-module/usb_midi/PortOut.h"
+#include "shared-module/usb_midi/__init__.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/shared/translate/translate.h"
 #include "tusb.h"
 
@@ -36,3 +41,120 @@ size_t common_hal_usb_midi_portout_write(usb_midi_portout_obj_t *self, const uin
 bool common_hal_usb_midi_portout_ready_to_tx(usb_midi_portout_obj_t *self) {
     return tud_midi_mounted();
 }
+
+#define TICKS_MAX ((1 << 29) - 1)
+#define TICKS_HALFPERIOD (1 << 28)
+
+// Messages waiting for their timestamps, earliest first. The tick is kept
+// enabled while any are waiting so that they go out on time.
+STATIC usb_midi_message_t scheduled[CIRCUITPY_USB_MIDI_SCHEDULE_LENGTH];
+STATIC size_t scheduled_count;
+
+// Signed difference of two supervisor.ticks_ms() values, as in adafruit_ticks.
+STATIC int32_t ticks_diff(uint32_t ticks1, uint32_t ticks2) {
+    int32_t diff = (ticks1 - ticks2) & TICKS_MAX;
+    return ((diff + TICKS_HALFPERIOD) & TICKS_MAX) - TICKS_HALFPERIOD;
+}
+
+STATIC uint8_t code_index_for_status(uint8_t status) {
+    if (status < 0x80) {
+        return 0;
+    }
+    if (status < 0xf0) {
+        return status >> 4;
+    }
+    switch (status) {
+        case 0xf1:
+        case 0xf3:
+            return 0x2;
+        case 0xf2:
+            return 0x3;
+        case 0xf6:
+            return 0x5;
+        default:
+            // System exclusive can't be sent as a single message.
+            return status >= 0xf8 ? 0xf : 0;
+    }
+}
+
+STATIC bool usb_midi_portout_send(const usb_midi_message_t *message) {
+    uint8_t code_index = code_index_for_status(message->status);
+    uint8_t packet[4] = { code_index, message->status, message->data1, message->data2 };
+    // Unused data bytes are sent as zeros.
+    if (code_index == 0x2 || code_index == 0xc || code_index == 0xd) {
+        packet[3] = 0;
+    } else if (code_index == 0x5 || code_index == 0xf) {
+        packet[2] = packet[3] = 0;
+    }
+    return tud_midi_packet_write(packet);
+}
+
+STATIC bool usb_midi_portout_schedule(const usb_midi_message_t *message) {
+    if (scheduled_count == CIRCUITPY_USB_MIDI_SCHEDULE_LENGTH) {
+        return false;
+    }
+    // After any waiting messages with the same timestamp.
+    size_t i = scheduled_count;
+    while (i > 0 && ticks_diff(scheduled[i - 1].timestamp, message->timestamp) > 0) {
+        i--;
+    }
+    memmove(&scheduled[i + 1], &scheduled[i], (scheduled_count - i) * sizeof(scheduled[0]));
+    scheduled[i] = *message;
+    if (scheduled_count++ == 0) {
+        supervisor_enable_tick();
+    }
+    return true;
+}
+
+// Send the waiting messages that are due, in order.
+STATIC void usb_midi_portout_send_due(uint32_t now) {
+    size_t sent = 0;
+    while (sent < scheduled_count && ticks_diff(scheduled[sent].timestamp, now) <= 0 &&
+           usb_midi_portout_send(&scheduled[sent])) {
+        sent++;
+    }
+    if (sent == 0) {
+        return;
+    }
+    scheduled_count -= sent;
+    memmove(&scheduled[0], &scheduled[sent], scheduled_count * sizeof(scheduled[0]));
+    if (scheduled_count == 0) {
+        supervisor_disable_tick();
+    }
+}
+
+void usb_midi_background(void) {
+    if (scheduled_count > 0) {
+        usb_midi_portout_send_due(usb_midi_ticks_ms());
+    }
+}
+
+void usb_midi_clear_scheduled(void) {
+    if (scheduled_count > 0) {
+        scheduled_count = 0;
+        supervisor_disable_tick();
+    }
+}
+
+size_t common_hal_usb_midi_portout_write_messages(usb_midi_portout_obj_t *self, const uint8_t *buffer, size_t count) {
+    usb_midi_message_t message;
+    for (size_t i = 0; i < count; i++) {
+        memcpy(&message, buffer + i * sizeof(message), sizeof(message));
+        if (code_index_for_status(message.status) == 0) {
+            mp_arg_error_invalid(MP_QSTR_status);
+        }
+    }
+
+    uint32_t now = usb_midi_ticks_ms();
+    usb_midi_portout_send_due(now);
+    size_t i;
+    for (i = 0; i < count; i++) {
+        memcpy(&message, buffer + i * sizeof(message), sizeof(message));
+        // Waiting messages are all later than now, so a due message goes first.
+        bool due = ticks_diff(message.timestamp, now) <= 0;
+        if (!(due && usb_midi_portout_send(&message)) && !usb_midi_portout_schedule(&message)) {
+            break;
+        }
+    }
+    return i;
+}
@@ -33,6 +33,7 @@
 #include "py/objtuple.h"
 #include "shared-bindings/usb_midi/PortIn.h"
 #include "shared-bindings/usb_midi/PortOut.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/usb.h"
 #include "tusb.h"
 
@@ -246,6 +247,9 @@ void usb_midi_setup_ports(void) {
     // Right now midi_ports_tuple contains no heap objects, but if it does in the future,
     // it will need to be protected against gc.
 
+    // Messages scheduled by the previous program are not sent.
+    usb_midi_clear_scheduled();
+
     mp_obj_tuple_t *ports = usb_midi_is_enabled ? MP_OBJ_FROM_PTR(&midi_ports_tuple) : mp_const_empty_tuple;
     mp_map_lookup(&usb_midi_module_globals.map, MP_ROM_QSTR(MP_QSTR_ports), MP_MAP_LOOKUP)->value =
         MP_OBJ_FROM_PTR(ports);
@@ -267,3 +271,8 @@ bool common_hal_usb_midi_disable(void) {
 bool common_hal_usb_midi_enable(void) {
     return usb_midi_set_enabled(true);
 }
+
+// The same clock as supervisor.ticks_ms(), which starts shortly before its wrap.
+uint32_t usb_midi_ticks_ms(void) {
+    return (supervisor_ticks_ms64() + 0x1fff0000) % (1 << 29);
+}
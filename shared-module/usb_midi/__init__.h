@@ -29,6 +29,20 @@
 
 #include "supervisor/usb.h"
 
+// A MIDI message as packed by PortIn.read_messages() and PortOut.write_messages().
+// Unused data bytes are zero.
+typedef struct {
+    uint8_t status;
+    uint8_t data1;
+    uint8_t data2;
+    uint8_t reserved;
+    uint32_t timestamp; // in supervisor.ticks_ms() units
+} usb_midi_message_t;
+
+uint32_t usb_midi_ticks_ms(void);
+void usb_midi_background(void);
+void usb_midi_clear_scheduled(void);
+
 bool usb_midi_enabled(void);
 void usb_midi_set_defaults(void);
 void usb_midi_setup_ports(void);
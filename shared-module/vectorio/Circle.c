@@ -39,6 +39,34 @@ uint32_t common_hal_vectorio_circle_get_pixel(void *obj, int16_t x, int16_t y) {
     return pythagorasSmallerThanRadius ? self->color_index : 0;
 }
 
+int common_hal_vectorio_circle_get_row_spans(void *obj, int16_t y, int16_t x1, int16_t x2, int16_t *spans, int max_spans, uint32_t *pixel) {
+    vectorio_circle_t *self = obj;
+    *pixel = self->color_index;
+    int32_t radius = self->radius;
+    y = abs(y);
+    if (y > radius) {
+        return 0;
+    }
+    // The widest x with x*x + y*y <= radius*radius, as in get_pixel
+    int32_t limit = radius * radius - (int32_t)y * y;
+    int32_t half_width = radius;
+    while (half_width * half_width > limit) {
+        // Newton's method from above converges to the integer square root
+        half_width = (half_width + limit / half_width) / 2;
+    }
+    int16_t start = MAX(x1, -half_width);
+    int16_t end = MIN(x2, half_width + 1);
+    if (start >= end) {
+        return 0;
+    }
+    if (max_spans < 1) {
+        return -1;
+    }
+    spans[0] = start;
+    spans[1] = end;
+    return 1;
+}
+
 
 void common_hal_vectorio_circle_get_area(void *circle, displayio_area_t *out_area) {
     vectorio_circle_t *self = circle;
@@ -179,6 +179,95 @@ uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y)
     return winding_number == 0 ? 0 : self->color_index;
 }
 
+// Edges crossing one row, beyond which a row is drawn a pixel at a time
+#define VECTORIO_POLYGON_MAX_CROSSINGS (32)
+
+// Scanline form of get_pixel. An edge that get_pixel would count for a row
+// winds every pixel left of where it crosses the row, so the winding number
+// only changes at the crossings. They are found once for the row, sorted,
+// and swept left to right.
+int common_hal_vectorio_polygon_get_row_spans(void *obj, int16_t y, int16_t x1, int16_t x2, int16_t *spans, int max_spans, uint32_t *pixel) {
+    vectorio_polygon_t *self = obj;
+    *pixel = self->color_index;
+
+    int16_t crossing_x[VECTORIO_POLYGON_MAX_CROSSINGS];
+    int8_t crossing_wind[VECTORIO_POLYGON_MAX_CROSSINGS];
+    int crossings = 0;
+    int winding_number = 0;
+
+    for (uint16_t i = 0; i < self->len; i += 2) {
+        int16_t ex1 = self->points_list[i];
+        int16_t ey1 = self->points_list[i + 1];
+        int16_t ex2 = self->points_list[(i + 2) % self->len];
+        int16_t ey2 = self->points_list[(i + 3) % self->len];
+        int8_t wind;
+        if (ey1 <= y && ey2 > y) {
+            wind = 1;
+        } else if (ey2 <= y && ey1 > y) {
+            wind = -1;
+        } else {
+            continue;
+        }
+        // Pixels strictly left of the crossing are wound, so round it up
+        int32_t num = (int32_t)(y - ey1) * (ex2 - ex1);
+        int32_t den = ey2 - ey1;
+        if (den < 0) {
+            num = -num;
+            den = -den;
+        }
+        int32_t x = ex1 + (num >= 0 ? (num + den - 1) / den : -(-num / den));
+        if (x <= x1) {
+            continue;
+        }
+        winding_number += wind;
+        if (x >= x2) {
+            continue;
+        }
+        if (crossings == VECTORIO_POLYGON_MAX_CROSSINGS) {
+            return -1;
+        }
+        int j = crossings++;
+        while (j > 0 && crossing_x[j - 1] > x) {
+            crossing_x[j] = crossing_x[j - 1];
+            crossing_wind[j] = crossing_wind[j - 1];
+            j--;
+        }
+        crossing_x[j] = x;
+        crossing_wind[j] = wind;
+    }
+
+    int count = 0;
+    bool inside = winding_number != 0;
+    int16_t start = x1;
+    for (int i = 0; i < crossings; i++) {
+        winding_number -= crossing_wind[i];
+        if (i + 1 < crossings && crossing_x[i + 1] == crossing_x[i]) {
+            continue;
+        }
+        bool now_inside = winding_number != 0;
+        if (inside && !now_inside) {
+            if (count == max_spans) {
+                return -1;
+            }
+            spans[2 * count] = start;
+            spans[2 * count + 1] = crossing_x[i];
+            count++;
+        } else if (!inside && now_inside) {
+            start = crossing_x[i];
+        }
+        inside = now_inside;
+    }
+    if (inside) {
+        if (count == max_spans) {
+            return -1;
+        }
+        spans[2 * count] = start;
+        spans[2 * count + 1] = x2;
+        count++;
+    }
+    return count;
+}
+
 mp_obj_t common_hal_vectorio_polygon_get_draw_protocol(void *polygon) {
     vectorio_polygon_t *self = polygon;
     return self->draw_protocol_instance;
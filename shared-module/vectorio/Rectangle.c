@@ -27,6 +27,22 @@ uint32_t common_hal_vectorio_rectangle_get_pixel(void *obj, int16_t x, int16_t y
     return 0;
 }
 
+int common_hal_vectorio_rectangle_get_row_spans(void *obj, int16_t y, int16_t x1, int16_t x2, int16_t *spans, int max_spans, uint32_t *pixel) {
+    vectorio_rectangle_t *self = obj;
+    *pixel = self->color_index;
+    int16_t start = MAX(x1, 0);
+    int16_t end = MIN(x2, self->width);
+    if (y < 0 || y >= self->height || start >= end) {
+        return 0;
+    }
+    if (max_spans < 1) {
+        return -1;
+    }
+    spans[0] = start;
+    spans[1] = end;
+    return 1;
+}
+
 
 void common_hal_vectorio_rectangle_get_area(void *rectangle, displayio_area_t *out_area) {
     vectorio_rectangle_t *self = rectangle;
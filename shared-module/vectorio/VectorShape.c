@@ -315,6 +315,51 @@ void common_hal_vectorio_vector_shape_set_pixel_shader(vectorio_vector_shape_t *
     common_hal_vectorio_vector_shape_set_dirty(self);
 }
 
+// Runs kept for one row of a shape; rows with more are drawn a pixel at a time
+#define VECTORIO_SHAPE_MAX_SPANS (16)
+
+// Convert a shape pixel value (already 0-based) to an output color. Returns whether it is opaque.
+static bool _shade_pixel(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_pixel) {
+    output_pixel->pixel = 0;
+    output_pixel->opaque = true;
+    if (self->pixel_shader == mp_const_none) {
+        output_pixel->pixel = input_pixel->pixel;
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        displayio_palette_get_color(self->pixel_shader, colorspace, input_pixel, output_pixel);
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        displayio_colorconverter_convert(self->pixel_shader, colorspace, input_pixel, output_pixel);
+    }
+    return output_pixel->opaque;
+}
+
+static void _write_pixel(const _displayio_colorspace_t *colorspace, uint32_t *buffer, uint16_t pixel_index, uint16_t linestride_px, uint32_t pixel) {
+    if (colorspace->depth == 16) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", pixel);
+        *(((uint16_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth == 32) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", pixel);
+        *(((uint32_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth == 8) {
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", pixel);
+        *(((uint8_t *)buffer) + pixel_index) = pixel;
+    } else if (colorspace->depth < 8) {
+        uint8_t pixels_per_byte = 8 / colorspace->depth;
+        // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
+        if (!colorspace->pixels_in_byte_share_row) {
+            uint16_t row = pixel_index / linestride_px;
+            uint16_t col = pixel_index % linestride_px;
+            pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
+        }
+        uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
+        if (colorspace->reverse_pixels_in_byte) {
+            // Reverse the shift by subtracting it from the leftmost shift.
+            shift = (pixels_per_byte - 1) * colorspace->depth - shift;
+        }
+        VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", pixel, colorspace->depth);
+        ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= pixel << shift;
+    }
+}
+
 bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
     // Shape areas are relative to 0,0.  This will allow rotation about a known axis.
     //   The consequence is that the area reported by the shape itself is _relative_ to 0,0.
@@ -343,7 +388,6 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
 
     bool full_coverage = displayio_area_equal(area, &overlap);
 
-    uint8_t pixels_per_byte = 8 / colorspace->depth;
     VECTORIO_SHAPE_DEBUG(" xy:(%3d %3d) tform:{x:%d y:%d dx:%d dy:%d scl:%d w:%d h:%d mx:%d my:%d tr:%d}",
         self->x, self->y,
         self->absolute_transform->x, self->absolute_transform->y, self->absolute_transform->dx, self->absolute_transform->dy, self->absolute_transform->scale,
@@ -354,17 +398,81 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
     uint16_t line_dirty_offset_px = (overlap.y1 - area->y1) * linestride_px;
     uint16_t column_dirty_offset_px = overlap.x1 - area->x1;
     VECTORIO_SHAPE_DEBUG(", linestride:%3d line_offset:%3d col_offset:%3d depth:%2d ppb:%2d shape:%s",
-        linestride_px, line_dirty_offset_px, column_dirty_offset_px, colorspace->depth, pixels_per_byte, mp_obj_get_type_str(self->ishape.shape));
+        linestride_px, line_dirty_offset_px, column_dirty_offset_px, colorspace->depth, 8 / colorspace->depth, mp_obj_get_type_str(self->ishape.shape));
 
     displayio_input_pixel_t input_pixel;
     displayio_output_pixel_t output_pixel;
 
-    displayio_area_t shape_area;
-    self->ishape.get_area(self->ishape.shape, &shape_area);
+    // Shapes that can describe a row as runs are drawn a run at a time when
+    // screen rows are shape rows. Without dithering, each run's color is
+    // looked up once.
+    bool spans = self->ishape.get_row_spans != NULL && !self->absolute_transform->transpose_xy;
+    bool dither = (mp_obj_is_type(self->pixel_shader, &displayio_palette_type) &&
+        ((displayio_palette_t *)MP_OBJ_TO_PTR(self->pixel_shader))->dither) ||
+        (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type) &&
+            ((displayio_colorconverter_t *)MP_OBJ_TO_PTR(self->pixel_shader))->dither);
+    int16_t shape_x_origin = self->absolute_transform->x + self->absolute_transform->dx * self->x;
+    bool mirror_x = self->absolute_transform->dx < 1;
 
     uint16_t mask_start_px = line_dirty_offset_px;
     for (input_pixel.y = overlap.y1; input_pixel.y < overlap.y2; ++input_pixel.y) {
         mask_start_px += column_dirty_offset_px;
+        int16_t row_spans[2 * VECTORIO_SHAPE_MAX_SPANS];
+        int span_count = -1;
+        uint32_t span_pixel = 0;
+        if (spans) {
+            int16_t shape_x1, shape_x2, shape_y;
+            screen_to_shape_coordinates(self, overlap.x1, input_pixel.y, &shape_x1, &shape_y);
+            screen_to_shape_coordinates(self, overlap.x2 - 1, input_pixel.y, &shape_x2, &shape_y);
+            #ifdef VECTORIO_PERF
+            uint64_t pre_pixel = common_hal_time_monotonic_ns();
+            #endif
+            span_count = self->ishape.get_row_spans(self->ishape.shape, shape_y,
+                MIN(shape_x1, shape_x2), MAX(shape_x1, shape_x2) + 1, row_spans, VECTORIO_SHAPE_MAX_SPANS, &span_pixel);
+            #ifdef VECTORIO_PERF
+            pixel_time += common_hal_time_monotonic_ns() - pre_pixel;
+            #endif
+        }
+        if (span_count >= 0) {
+            uint16_t covered = 0;
+            for (int i = 0; i < span_count; i++) {
+                // Back to screen columns, which run the other way when mirrored
+                int16_t start = row_spans[2 * i] + shape_x_origin;
+                int16_t end = row_spans[2 * i + 1] + shape_x_origin;
+                if (mirror_x) {
+                    start = shape_x_origin - row_spans[2 * i + 1] + 1;
+                    end = shape_x_origin - row_spans[2 * i] + 1;
+                }
+                covered += end - start;
+                input_pixel.pixel = span_pixel - 1;
+                bool opaque = true;
+                if (!dither) {
+                    input_pixel.x = start;
+                    opaque = _shade_pixel(self, colorspace, &input_pixel, &output_pixel);
+                }
+                for (input_pixel.x = start; input_pixel.x < end; ++input_pixel.x) {
+                    uint16_t pixel_index = mask_start_px + (input_pixel.x - overlap.x1);
+                    uint32_t *mask_doubleword = &(mask[pixel_index / 32]);
+                    uint8_t mask_bit = pixel_index % 32;
+                    if ((*mask_doubleword & (1u << mask_bit)) != 0) {
+                        continue;
+                    }
+                    if (dither) {
+                        opaque = _shade_pixel(self, colorspace, &input_pixel, &output_pixel);
+                    }
+                    if (!opaque) {
+                        full_coverage = false;
+                    }
+                    *mask_doubleword |= 1u << mask_bit;
+                    _write_pixel(colorspace, buffer, pixel_index, linestride_px, output_pixel.pixel);
+                }
+            }
+            if (covered < overlap.x2 - overlap.x1) {
+                full_coverage = false;
+            }
+            mask_start_px += linestride_px - column_dirty_offset_px;
+            continue;
+        }
         for (input_pixel.x = overlap.x1; input_pixel.x < overlap.x2; ++input_pixel.x) {
             // Check the mask first to see if the pixel has already been set.
             uint16_t pixel_index = mask_start_px + (input_pixel.x - overlap.x1);
@@ -401,47 +509,15 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
             } else {
                 // Pixel is not transparent. Let's pull the pixel value index down to 0-base for more error-resistant palettes.
                 input_pixel.pixel -= 1;
-                output_pixel.opaque = true;
-
-                if (self->pixel_shader == mp_const_none) {
-                    output_pixel.pixel = input_pixel.pixel;
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
-                    displayio_palette_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-                } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
-                    displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-                }
 
                 // We double-check this to fast-path the case when a pixel is not covered by the shape & not call the color converter unnecessarily.
-                if (!output_pixel.opaque) {
+                if (!_shade_pixel(self, colorspace, &input_pixel, &output_pixel)) {
                     VECTORIO_SHAPE_PIXEL_DEBUG(" (encountered transparent pixel from colorconverter; input area is not fully covered)");
                     full_coverage = false;
                 }
 
                 *mask_doubleword |= 1u << mask_bit;
-                if (colorspace->depth == 16) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 16", output_pixel.pixel);
-                    *(((uint16_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 32) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %04x 32", output_pixel.pixel);
-                    *(((uint32_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth == 8) {
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %02x 8", output_pixel.pixel);
-                    *(((uint8_t *)buffer) + pixel_index) = output_pixel.pixel;
-                } else if (colorspace->depth < 8) {
-                    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
-                    if (!colorspace->pixels_in_byte_share_row) {
-                        uint16_t row = pixel_index / linestride_px;
-                        uint16_t col = pixel_index % linestride_px;
-                        pixel_index = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * linestride_px + row % pixels_per_byte;
-                    }
-                    uint8_t shift = (pixel_index % pixels_per_byte) * colorspace->depth;
-                    if (colorspace->reverse_pixels_in_byte) {
-                        // Reverse the shift by subtracting it from the leftmost shift.
-                        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
-                    }
-                    VECTORIO_SHAPE_PIXEL_DEBUG(" buffer = %2d %d", output_pixel.pixel, colorspace->depth);
-                    ((uint8_t *)buffer)[pixel_index / pixels_per_byte] |= output_pixel.pixel << shift;
-                }
+                _write_pixel(colorspace, buffer, pixel_index, linestride_px, output_pixel.pixel);
             }
         }
         mask_start_px += linestride_px - column_dirty_offset_px;
@@ -11,6 +11,10 @@
 
 typedef void get_area_function(mp_obj_t shape, displayio_area_t *out_area);
 typedef uint32_t get_pixel_function(mp_obj_t shape, int16_t x, int16_t y);
+// Stores the covered runs of row y, clipped to [x1, x2), as increasing
+// [start, end) pairs in spans, and the pixel value of the runs in pixel.
+// Returns the number of runs, or -1 if the row needs more than max_spans.
+typedef int get_row_spans_function(mp_obj_t shape, int16_t y, int16_t x1, int16_t x2, int16_t *spans, int max_spans, uint32_t *pixel);
 
 // This struct binds a shape's common Shape support functions (its vector shape interface)
 //   to its instance pointer.  We only check at construction time what the type of the
@@ -22,6 +26,7 @@ typedef struct {
     mp_obj_t shape;
     get_area_function *get_area;
     get_pixel_function *get_pixel;
+    get_row_spans_function *get_row_spans;
 } vectorio_ishape_t;
 
 typedef struct {
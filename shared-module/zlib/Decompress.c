@@ -0,0 +1,275 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "py/runtime.h"
+
+#include "shared-bindings/zlib/Decompress.h"
+
+// uzlib can't stop partway through a symbol when the input runs out, so
+// inflating is done in steps of at most ZLIB_DECOMPRESS_STEP bytes. The
+// decoder state and the part of the window a step can overwrite are saved
+// first, and restored if the step runs out of input. The unused input is
+// kept and the step is retried once more input arrives.
+
+STATIC int decompress_read_cb(TINF_DATA *d) {
+    zlib_decompress_obj_t *self = d->self;
+    // Move on from the pending input to this call's data.
+    if (self->pending_len > 0 && d->source_limit == self->pending + self->pending_len && self->data_len > 0) {
+        d->source = self->data;
+        d->source_limit = self->data + self->data_len;
+        return *d->source++;
+    }
+    self->starved = true;
+    return -1;
+}
+
+STATIC NORETURN void decompress_error(int st) {
+    mp_raise_type_arg(&mp_type_ValueError, MP_OBJ_NEW_SMALL_INT(st));
+}
+
+void common_hal_zlib_decompress_construct(zlib_decompress_obj_t *self, mp_int_t wbits, mp_obj_t window) {
+    memset(&self->decomp, 0, sizeof(self->decomp));
+    uzlib_uncompress_init(&self->decomp, NULL, 0);
+    self->decomp.self = self;
+    self->decomp.source_read_cb = decompress_read_cb;
+    self->window_obj = window;
+    self->window = NULL;
+    self->pending = NULL;
+    self->pending_len = 0;
+    self->data = NULL;
+    self->data_len = 0;
+    self->unconsumed_tail = mp_const_empty_bytes;
+    self->unused_data = mp_const_empty_bytes;
+    self->wbits = wbits;
+    self->header_done = false;
+    self->eof = false;
+    self->starved = false;
+}
+
+STATIC void decompress_start_window(zlib_decompress_obj_t *self, int bits) {
+    size_t size = 1 << bits;
+    if (self->window_obj != mp_const_none) {
+        mp_buffer_info_t bufinfo;
+        mp_get_buffer_raise(self->window_obj, &bufinfo, MP_BUFFER_WRITE);
+        mp_arg_validate_length_min(bufinfo.len, size, MP_QSTR_window);
+        self->window = bufinfo.buf;
+    } else {
+        self->window = m_new(uint8_t, size);
+    }
+    // Don't let a bad back reference show earlier memory contents.
+    memset(self->window, 0, size);
+    self->decomp.dict_ring = self->window;
+    self->decomp.dict_size = size;
+    self->decomp.dict_idx = 0;
+}
+
+STATIC void window_copy(TINF_DATA *d, size_t start, uint8_t *buf, size_t len, bool to_window) {
+    size_t first = MIN(len, d->dict_size - start);
+    if (to_window) {
+        memcpy(d->dict_ring + start, buf, first);
+        memcpy(d->dict_ring, buf + first, len - first);
+    } else {
+        memcpy(buf, d->dict_ring + start, first);
+        memcpy(buf + first, d->dict_ring, len - first);
+    }
+}
+
+STATIC void decompress_save(zlib_decompress_obj_t *self, size_t step) {
+    self->saved = self->decomp;
+    if (self->decomp.dict_ring != NULL) {
+        window_copy(&self->decomp, self->decomp.dict_idx, self->window_saved, step, false);
+    }
+    self->starved = false;
+}
+
+STATIC void decompress_restore(zlib_decompress_obj_t *self, size_t step) {
+    self->decomp = self->saved;
+    if (self->decomp.dict_ring != NULL) {
+        window_copy(&self->decomp, self->decomp.dict_idx, self->window_saved, step, true);
+    }
+}
+
+// Returns false if the header isn't all there yet.
+STATIC bool decompress_parse_header(zlib_decompress_obj_t *self) {
+    int bits = self->wbits;
+    if (bits < 0) {
+        // raw DEFLATE: no header
+        bits = -bits;
+    } else {
+        decompress_save(self, 0);
+        int st;
+        if (bits >= 16) {
+            st = uzlib_gzip_parse_header(&self->decomp);
+            bits -= 16;
+        } else {
+            st = uzlib_zlib_parse_header(&self->decomp);
+        }
+        if (self->starved) {
+            decompress_restore(self, 0);
+            return false;
+        }
+        if (st < 0) {
+            decompress_error(st);
+        }
+        if (self->wbits < 16) {
+            // A zlib header gives the window size used to compress.
+            int header_bits = st + 8;
+            if (bits == 0) {
+                bits = header_bits;
+            } else if (header_bits > bits) {
+                decompress_error(TINF_DICT_ERROR);
+            }
+        }
+    }
+    decompress_start_window(self, bits);
+    self->header_done = true;
+    return true;
+}
+
+// Keep the input that wasn't used. With more to come it stays pending; otherwise
+// it is handed back as unconsumed_tail, or as unused_data after the end of stream.
+STATIC void decompress_keep_remaining(zlib_decompress_obj_t *self, bool out_full) {
+    TINF_DATA *d = &self->decomp;
+    bool on_pending = self->pending_len > 0 && d->source_limit == self->pending + self->pending_len;
+    size_t rest_pending_len = on_pending ? (size_t)(d->source_limit - d->source) : 0;
+    const uint8_t *rest_data = on_pending ? self->data : d->source;
+    size_t rest_data_len = self->data_len - (rest_data - self->data);
+
+    if (self->eof || out_full) {
+        vstr_t vstr;
+        vstr_init_len(&vstr, rest_pending_len + rest_data_len);
+        memcpy(vstr.buf, d->source, rest_pending_len);
+        memcpy(vstr.buf + rest_pending_len, rest_data, rest_data_len);
+        mp_obj_t rest = mp_obj_new_bytes_from_vstr(&vstr);
+        if (self->eof) {
+            self->unused_data = rest;
+        } else {
+            self->unconsumed_tail = rest;
+        }
+        m_del(uint8_t, self->pending, self->pending_len);
+        self->pending = NULL;
+        self->pending_len = 0;
+        return;
+    }
+
+    size_t new_len = rest_pending_len + rest_data_len;
+    if (new_len == 0) {
+        m_del(uint8_t, self->pending, self->pending_len);
+        self->pending = NULL;
+    } else {
+        if (on_pending) {
+            memmove(self->pending, d->source, rest_pending_len);
+        }
+        self->pending = m_renew(uint8_t, self->pending, self->pending_len, new_len);
+        memcpy(self->pending + rest_pending_len, rest_data, rest_data_len);
+    }
+    self->pending_len = new_len;
+}
+
+void common_hal_zlib_decompress_decompress(zlib_decompress_obj_t *self, const uint8_t *data, size_t len, vstr_t *out, size_t max_length) {
+    self->unconsumed_tail = mp_const_empty_bytes;
+    if (self->eof) {
+        // Everything after the end of the stream is unused.
+        size_t unused_len;
+        const char *unused = mp_obj_str_get_data(self->unused_data, &unused_len);
+        vstr_t vstr;
+        vstr_init_len(&vstr, unused_len + len);
+        memcpy(vstr.buf, unused, unused_len);
+        memcpy(vstr.buf + unused_len, data, len);
+        self->unused_data = mp_obj_new_bytes_from_vstr(&vstr);
+        return;
+    }
+
+    TINF_DATA *d = &self->decomp;
+    self->data = data;
+    self->data_len = len;
+    if (self->pending_len > 0) {
+        d->source = self->pending;
+        d->source_limit = self->pending + self->pending_len;
+    } else {
+        d->source = data;
+        d->source_limit = data + len;
+    }
+
+    bool out_full = false;
+    while (!self->eof) {
+        if (!self->header_done) {
+            if (!decompress_parse_header(self)) {
+                break;
+            }
+            continue;
+        }
+        size_t step = MIN(ZLIB_DECOMPRESS_STEP, d->dict_size);
+        if (max_length > 0) {
+            if (out->len >= max_length) {
+                out_full = true;
+                break;
+            }
+            step = MIN(step, max_length - out->len);
+        }
+        if (!out->fixed_buf && out->alloc - out->len < step) {
+            // Grow geometrically rather than a step at a time.
+            vstr_hint_size(out, MAX(step, out->len));
+        }
+
+        decompress_save(self, step);
+        uint8_t *dest = (uint8_t *)vstr_add_len(out, step);
+        d->dest_start = dest;
+        d->dest = dest;
+        d->dest_limit = dest + step;
+        int st = uzlib_uncompress_chksum(d);
+        if (self->starved) {
+            decompress_restore(self, step);
+            out->len -= step;
+            break;
+        }
+        out->len -= step - (d->dest - dest);
+        if (st < 0) {
+            decompress_error(st);
+        }
+        if (st == TINF_DONE) {
+            self->eof = true;
+        }
+    }
+
+    decompress_keep_remaining(self, out_full);
+    self->data = NULL;
+    self->data_len = 0;
+}
+
+bool common_hal_zlib_decompress_get_eof(zlib_decompress_obj_t *self) {
+    return self->eof;
+}
+
+mp_obj_t common_hal_zlib_decompress_get_unconsumed_tail(zlib_decompress_obj_t *self) {
+    return self->unconsumed_tail;
+}
+
+mp_obj_t common_hal_zlib_decompress_get_unused_data(zlib_decompress_obj_t *self) {
+    return self->unused_data;
+}
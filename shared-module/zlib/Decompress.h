@@ -0,0 +1,59 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_ZLIB_DECOMPRESS_H
+#define MICROPY_INCLUDED_SHARED_MODULE_ZLIB_DECOMPRESS_H
+
+#include "py/obj.h"
+#include "lib/uzlib/tinf.h"
+
+// Most bytes inflated by one undoable step. A step is undone when the input
+// runs out partway through it.
+#define ZLIB_DECOMPRESS_STEP (512)
+
+typedef struct {
+    mp_obj_base_t base;
+    TINF_DATA decomp;
+    // decomp as it was before the current step.
+    TINF_DATA saved;
+    mp_obj_t window_obj;
+    uint8_t *window;
+    // Input from earlier calls that ended partway through a symbol or header.
+    uint8_t *pending;
+    size_t pending_len;
+    // Input of the current call.
+    const uint8_t *data;
+    size_t data_len;
+    mp_obj_t unconsumed_tail;
+    mp_obj_t unused_data;
+    int8_t wbits;
+    bool header_done;
+    bool eof;
+    bool starved;
+    uint8_t window_saved[ZLIB_DECOMPRESS_STEP];
+} zlib_decompress_obj_t;
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_ZLIB_DECOMPRESS_H
@@ -116,9 +116,17 @@ STATIC int parse_compile_execute(const void *source, mp_parse_input_kind_t input
                     lex = (mp_lexer_t *)source;
                 }
                 // source is a lexer, parse and compile the script
-                qstr source_name = lex->source_name;
-                mp_parse_tree_t parse_tree = mp_parse(lex, input_kind);
-                module_fun = mp_compile(&parse_tree, source_name, exec_flags & EXEC_FLAG_IS_REPL);
+                // CIRCUITPY-CHANGE: compile scripts as they are parsed
+                #if MICROPY_COMP_STREAMING
+                if (input_kind == MP_PARSE_FILE_INPUT && !(exec_flags & EXEC_FLAG_IS_REPL)) {
+                    module_fun = mp_compile_stream(lex);
+                } else
+                #endif
+                {
+                    qstr source_name = lex->source_name;
+                    mp_parse_tree_t parse_tree = mp_parse(lex, input_kind);
+                    module_fun = mp_compile(&parse_tree, source_name, exec_flags & EXEC_FLAG_IS_REPL);
+                }
                 #else
                 mp_raise_msg(&mp_type_RuntimeError, MP_ERROR_TEXT("script compilation not supported"));
                 #endif
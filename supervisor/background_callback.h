@@ -48,6 +48,12 @@
  *
  * background_callback_add can be called from interrupt context.
  *
+ * Each callback has a priority class. Realtime callbacks always run. The
+ * others run in priority order while the pass is within
+ * CIRCUITPY_BACKGROUND_CALLBACK_BUDGET_TICKS, and whatever is left waits for
+ * the next pass, ahead of anything queued later. Zero-initialized callbacks are
+ * realtime. Set `priority` once, before the callback is first added.
+ *
  * If your work isn't triggered by an event, then it may be better implemented
  * using ticks, which runs tasks every millisecond or so. Ticks are enabled with
  * supervisor_enable_tick() and disabled with supervisor_disable_tick(). When
@@ -55,11 +61,25 @@
  * which includes port_background_tick(), every millisecond.
  */
 typedef void (*background_callback_fun)(void *data);
+
+typedef enum {
+    // Audio buffer refills, USB: anything that drops data when late.
+    BACKGROUND_CALLBACK_PRIORITY_REALTIME,
+    // Serial output, network and other I/O servicing.
+    BACKGROUND_CALLBACK_PRIORITY_IO,
+    // Display refreshes and the supervisor tick that drives them.
+    BACKGROUND_CALLBACK_PRIORITY_DISPLAY,
+    // Status bar, workflow and other work that can wait.
+    BACKGROUND_CALLBACK_PRIORITY_HOUSEKEEPING,
+    BACKGROUND_CALLBACK_PRIORITY_COUNT,
+} background_callback_priority_t;
+
 typedef struct background_callback {
     background_callback_fun fun;
     void *data;
     struct background_callback *next;
     struct background_callback *prev;
+    background_callback_priority_t priority;
 } background_callback_t;
 
 /* Add a background callback for which 'fun' and 'data' were previously set */
@@ -72,6 +72,11 @@ uint32_t port_get_saved_word(void);
 // tick is 32 subticks (for a resolution of 1/32768 or 30.5ish microseconds.)
 uint64_t port_get_raw_ticks(uint8_t *subticks);
 
+// Get the number of microseconds since start up. Ports with a high resolution timer should
+// override this. The default is derived from port_get_raw_ticks() and only has subtick
+// resolution.
+uint64_t port_get_raw_ticks_us(void);
+
 // Enable 1/1024 second tick.
 void port_enable_tick(void);
 
@@ -47,3 +47,42 @@ void port_free(void *ptr);
 void port_realloc(void *ptr, size_t size);
 
 size_t port_heap_get_largest_free_size(void);
+
+// Usable size of a block returned by port_malloc(). Ports with their own heap
+// must provide this when CIRCUITPY_SUPERVISOR_MEMORY_STATS is enabled.
+size_t port_heap_get_block_size(void *ptr);
+
+// Who an outer heap allocation belongs to, for supervisor.memory_stats().
+typedef enum {
+    PORT_HEAP_TAG_VM,
+    PORT_HEAP_TAG_SUPERVISOR,
+    PORT_HEAP_TAG_DISPLAY,
+    PORT_HEAP_TAG_FLASH_CACHE,
+    PORT_HEAP_TAG_USB,
+    PORT_HEAP_TAG_NATIVE_CODE,
+    PORT_HEAP_TAG_COUNT,
+} port_heap_tag_t;
+
+// port_malloc() and port_free() that also count the bytes held by each tag.
+// A block must be freed with the tag it was allocated with.
+#if CIRCUITPY_SUPERVISOR_MEMORY_STATS
+void *port_malloc_tagged(size_t size, bool dma_capable, port_heap_tag_t tag);
+void port_free_tagged(void *ptr, port_heap_tag_t tag);
+#else
+static inline void *port_malloc_tagged(size_t size, bool dma_capable, port_heap_tag_t tag) {
+    (void)tag;
+    return port_malloc(size, dma_capable);
+}
+static inline void port_free_tagged(void *ptr, port_heap_tag_t tag) {
+    (void)tag;
+    port_free(ptr);
+}
+#endif
+
+// Native machine code is copied out of the VM heap into memory returned here,
+// and freed again when the VM stops. Ports whose outer heap isn't executable, or
+// which have faster instruction memory such as ITCM, may override these. The
+// default implementations use port_malloc() and port_free().
+void *port_native_code_alloc(size_t size);
+
+void port_native_code_free(void *ptr);
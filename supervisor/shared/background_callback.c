@@ -34,7 +34,10 @@
 #include "supervisor/shared/tick.h"
 #include "shared-bindings/microcontroller/__init__.h"
 
-STATIC volatile background_callback_t *volatile callback_head, *volatile callback_tail;
+STATIC volatile background_callback_t *volatile callback_head[BACKGROUND_CALLBACK_PRIORITY_COUNT];
+STATIC volatile background_callback_t *volatile callback_tail[BACKGROUND_CALLBACK_PRIORITY_COUNT];
+// The callbacks taken by the running pass that haven't run yet.
+STATIC volatile background_callback_t *volatile pass_head[BACKGROUND_CALLBACK_PRIORITY_COUNT];
 
 #ifndef CALLBACK_CRITICAL_BEGIN
 #define CALLBACK_CRITICAL_BEGIN (common_hal_mcu_disable_interrupts())
@@ -47,20 +50,24 @@ MP_WEAK void PLACE_IN_ITCM(port_wake_main_task)(void) {
 }
 
 void PLACE_IN_ITCM(background_callback_add_core)(background_callback_t * cb) {
+    size_t priority = cb->priority;
+    if (priority >= BACKGROUND_CALLBACK_PRIORITY_COUNT) {
+        priority = BACKGROUND_CALLBACK_PRIORITY_COUNT - 1;
+    }
     CALLBACK_CRITICAL_BEGIN;
-    if (cb->prev || callback_head == cb) {
+    if (cb->prev || callback_head[priority] == cb || pass_head[priority] == cb) {
         CALLBACK_CRITICAL_END;
         return;
     }
     cb->next = 0;
-    cb->prev = (background_callback_t *)callback_tail;
-    if (callback_tail) {
-        callback_tail->next = cb;
+    cb->prev = (background_callback_t *)callback_tail[priority];
+    if (callback_tail[priority]) {
+        callback_tail[priority]->next = cb;
     }
-    if (!callback_head) {
-        callback_head = cb;
+    if (!callback_head[priority]) {
+        callback_head[priority] = cb;
     }
-    callback_tail = cb;
+    callback_tail[priority] = cb;
     CALLBACK_CRITICAL_END;
 
     port_wake_main_task();
@@ -73,7 +80,55 @@ void PLACE_IN_ITCM(background_callback_add)(background_callback_t * cb, backgrou
 }
 
 inline bool background_callback_pending(void) {
-    return callback_head != NULL;
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_PRIORITY_COUNT; i++) {
+        if (callback_head[i] != NULL) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Run the first callback of the given pass list. Called and returns in the critical section.
+STATIC void run_first(size_t priority) {
+    background_callback_t *cb = (background_callback_t *)pass_head[priority];
+    pass_head[priority] = cb->next;
+    cb->next = cb->prev = NULL;
+    background_callback_fun fun = cb->fun;
+    void *data = cb->data;
+    CALLBACK_CRITICAL_END;
+    // Leave the critical section in order to run the callback function
+    if (fun) {
+        fun(data);
+    }
+    CALLBACK_CRITICAL_BEGIN;
+}
+
+// Move a queue into its pass list. Called in the critical section.
+STATIC void take_queue(size_t priority) {
+    pass_head[priority] = callback_head[priority];
+    callback_head[priority] = NULL;
+    callback_tail[priority] = NULL;
+}
+
+// Put what is left of a pass list back at the front of its queue. Called in the critical section.
+STATIC void requeue_pass(size_t priority) {
+    background_callback_t *first = (background_callback_t *)pass_head[priority];
+    if (!first) {
+        return;
+    }
+    background_callback_t *last = first;
+    while (last->next) {
+        last = last->next;
+    }
+    last->next = (background_callback_t *)callback_head[priority];
+    if (callback_head[priority]) {
+        callback_head[priority]->prev = last;
+    } else {
+        callback_tail[priority] = last;
+    }
+    first->prev = NULL;
+    callback_head[priority] = first;
+    pass_head[priority] = NULL;
 }
 
 static bool in_background_callback;
@@ -82,27 +137,44 @@ void PLACE_IN_ITCM(background_callback_run_all)() {
     if (!background_callback_pending()) {
         return;
     }
+    uint64_t deadline = port_get_raw_ticks(NULL) + CIRCUITPY_BACKGROUND_CALLBACK_BUDGET_TICKS;
     CALLBACK_CRITICAL_BEGIN;
     if (in_background_callback) {
         CALLBACK_CRITICAL_END;
         return;
     }
     in_background_callback = true;
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    callback_head = NULL;
-    callback_tail = NULL;
-    while (cb) {
-        background_callback_t *next = cb->next;
-        cb->next = cb->prev = NULL;
-        background_callback_fun fun = cb->fun;
-        void *data = cb->data;
-        CALLBACK_CRITICAL_END;
-        // Leave the critical section in order to run the callback function
-        if (fun) {
-            fun(data);
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_PRIORITY_COUNT; i++) {
+        take_queue(i);
+    }
+    bool ran_deferrable = false;
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_PRIORITY_COUNT; i++) {
+        while (pass_head[i]) {
+            if (i != BACKGROUND_CALLBACK_PRIORITY_REALTIME) {
+                // Always make some progress, then stop once the budget is used.
+                if (ran_deferrable) {
+                    CALLBACK_CRITICAL_END;
+                    bool over_budget = port_get_raw_ticks(NULL) >= deadline;
+                    CALLBACK_CRITICAL_BEGIN;
+                    if (over_budget) {
+                        goto out_of_time;
+                    }
+                }
+                // Realtime work queued meanwhile goes before the next slower callback.
+                if (callback_head[BACKGROUND_CALLBACK_PRIORITY_REALTIME]) {
+                    take_queue(BACKGROUND_CALLBACK_PRIORITY_REALTIME);
+                    while (pass_head[BACKGROUND_CALLBACK_PRIORITY_REALTIME]) {
+                        run_first(BACKGROUND_CALLBACK_PRIORITY_REALTIME);
+                    }
+                }
+                ran_deferrable = true;
+            }
+            run_first(i);
         }
-        CALLBACK_CRITICAL_BEGIN;
-        cb = next;
+    }
+out_of_time:
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_PRIORITY_COUNT; i++) {
+        requeue_pass(i);
     }
     in_background_callback = false;
     CALLBACK_CRITICAL_END;
@@ -119,25 +191,31 @@ void background_callback_end_critical_section() {
 
 // Filter out queued callbacks if they are allocated on the heap.
 void background_callback_reset() {
-    background_callback_t *new_head = NULL;
-    background_callback_t **previous_next = &new_head;
-    background_callback_t *new_tail = NULL;
     CALLBACK_CRITICAL_BEGIN;
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    while (cb) {
-        background_callback_t *next = cb->next;
-        if (gc_ptr_on_heap((void *)cb)) {
-            *previous_next = cb;
-            previous_next = &cb->next;
-            cb->next = NULL;
-            new_tail = cb;
-        } else {
-            memset(cb, 0, sizeof(*cb));
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_PRIORITY_COUNT; i++) {
+        background_callback_t *new_head = NULL;
+        background_callback_t **previous_next = &new_head;
+        background_callback_t *new_tail = NULL;
+        background_callback_t *cb = (background_callback_t *)callback_head[i];
+        while (cb) {
+            background_callback_t *next = cb->next;
+            if (gc_ptr_on_heap((void *)cb)) {
+                *previous_next = cb;
+                previous_next = &cb->next;
+                cb->next = NULL;
+                new_tail = cb;
+            } else {
+                // Static callbacks keep their priority for the next time they are added.
+                background_callback_priority_t priority = cb->priority;
+                memset(cb, 0, sizeof(*cb));
+                cb->priority = priority;
+            }
+            cb = next;
         }
-        cb = next;
+        callback_head[i] = new_head;
+        callback_tail[i] = new_tail;
+        pass_head[i] = NULL;
     }
-    callback_head = new_head;
-    callback_tail = new_tail;
     in_background_callback = false;
     CALLBACK_CRITICAL_END;
 }
@@ -157,9 +235,18 @@ void background_callback_gc_collect(void) {
     // It's necessary to traverse the whole list here, as the callbacks
     // themselves can be in non-gc memory, and some of the cb->data
     // objects themselves might be in non-gc memory.
-    background_callback_t *cb = (background_callback_t *)callback_head;
-    while (cb) {
-        gc_collect_ptr(cb->data);
-        cb = cb->next;
+    //
+    // Callbacks taken by a running pass but not yet run are traversed too.
+    for (size_t i = 0; i < BACKGROUND_CALLBACK_PRIORITY_COUNT; i++) {
+        background_callback_t *cb = (background_callback_t *)callback_head[i];
+        while (cb) {
+            gc_collect_ptr(cb->data);
+            cb = cb->next;
+        }
+        cb = (background_callback_t *)pass_head[i];
+        while (cb) {
+            gc_collect_ptr(cb->data);
+            cb = cb->next;
+        }
     }
 }
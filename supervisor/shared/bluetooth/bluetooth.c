@@ -112,20 +112,20 @@ bool supervisor_bluetooth_status_dirty(void) {
 #endif
 
 #if CIRCUITPY_STATUS_BAR
-void supervisor_bluetooth_status(void) {
-    serial_write("BLE:");
+void supervisor_bluetooth_status(const mp_print_t *print) {
+    mp_print_str(print, "BLE:");
     if (advertising) {
         if (_private_advertising) {
-            serial_write_compressed(MP_ERROR_TEXT("Reconnecting"));
+            mp_printf(print, "%S", MP_ERROR_TEXT("Reconnecting"));
         } else {
             const char *name = (char *)circuitpython_scan_response_data + 2;
             int len = MIN(strlen(name), sizeof(circuitpython_scan_response_data) - 2);
-            serial_write_substring(name, len);
+            print->print_strn(print->data, name, len);
         }
     } else if (was_connected) {
-        serial_write_compressed(MP_ERROR_TEXT("Ok"));
+        mp_printf(print, "%S", MP_ERROR_TEXT("Ok"));
     } else {
-        serial_write_compressed(MP_ERROR_TEXT("Off"));
+        mp_printf(print, "%S", MP_ERROR_TEXT("Off"));
     }
 
     _last_connected = was_connected;
@@ -29,6 +29,8 @@
 
 #include <stdbool.h>
 
+#include "py/mpprint.h"
+
 void supervisor_bluetooth_background(void);
 void supervisor_bluetooth_init(void);
 void supervisor_start_bluetooth(void);
@@ -41,6 +43,6 @@ bool supervisor_bluetooth_workflow_is_enabled(void);
 
 // Title bar status
 bool supervisor_bluetooth_status_dirty(void);
-void supervisor_bluetooth_status(void);
+void supervisor_bluetooth_status(const mp_print_t *print);
 
 #endif // MICROPY_INCLUDED_SUPERVISOR_SHARED_BLUETOOTH_H
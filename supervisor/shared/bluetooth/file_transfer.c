@@ -41,6 +41,7 @@
 #include "bluetooth/ble_drv.h"
 
 #include "common-hal/_bleio/__init__.h"
+#include "common-hal/_bleio/Connection.h"
 
 #include "supervisor/fatfs.h"
 #include "supervisor/filesystem.h"
@@ -65,8 +66,16 @@ const uint8_t file_transfer_base_uuid[16] = {0x72, 0x65, 0x66, 0x73, 0x6e, 0x61,
 
 STATIC mp_obj_list_t characteristic_list;
 STATIC mp_obj_t characteristic_list_items[2];
-// 2 * 10 ringbuf packets, 512 for a disk sector and 12 for the file transfer write header.
-#define PACKET_BUFFER_SIZE (2 * 10 + 512 + 12)
+
+#define COMMAND_SIZE 1024
+
+// The number of whole commands, each with the ringbuf's two byte length prefix on
+// every minimum size (20 byte) packet, that can be queued while another is being
+// processed. This bounds how many WRITE_DATA commands a client may have in flight.
+#ifndef CIRCUITPY_BLE_FILE_TRANSFER_WINDOW
+#define CIRCUITPY_BLE_FILE_TRANSFER_WINDOW (2)
+#endif
+#define PACKET_BUFFER_SIZE (CIRCUITPY_BLE_FILE_TRANSFER_WINDOW * (COMMAND_SIZE + 2 * (COMMAND_SIZE / 20 + 1)))
 // uint32_t so its aligned
 STATIC uint32_t _buffer[PACKET_BUFFER_SIZE / 4 + 1];
 STATIC uint32_t _outgoing1[BLE_GATTS_VAR_ATTR_LEN_MAX / 4];
@@ -102,7 +111,7 @@ void supervisor_start_bluetooth_file_transfer(void) {
         NULL,                                       // no initial value
         NULL); // no description
 
-    uint32_t version = 4;
+    uint32_t version = 5;
     mp_buffer_info_t bufinfo;
     bufinfo.buf = &version;
     bufinfo.len = sizeof(version);
@@ -130,8 +139,6 @@ void supervisor_start_bluetooth_file_transfer(void) {
         &static_handler_entry);
 }
 
-#define COMMAND_SIZE 1024
-
 #define ANY_COMMAND 0x00
 #define THIS_COMMAND 0x01
 
@@ -149,6 +156,56 @@ STATIC uint64_t truncate_time(uint64_t input_time, DWORD *fattime) {
     return truncated_time;
 }
 
+// Longest connection interval asked for during a transfer, in 1.25 ms units.
+#ifndef CIRCUITPY_BLE_FILE_TRANSFER_CONN_INTERVAL
+#define CIRCUITPY_BLE_FILE_TRANSFER_CONN_INTERVAL (12)
+#endif
+
+STATIC bool _fast_connection_requested = false;
+
+// Ask the central for a short connection interval so that more packets are
+// exchanged each second. The central may ignore this. Only asks once per connection.
+STATIC void _request_fast_connection(void) {
+    uint16_t conn_handle = _transfer_packet_buffer.conn_handle;
+    if (_fast_connection_requested || conn_handle == BLE_CONN_HANDLE_INVALID) {
+        return;
+    }
+    bleio_connection_internal_t *connection = bleio_conn_handle_to_connection(conn_handle);
+    if (connection == NULL ||
+        connection->conn_params.max_conn_interval <= CIRCUITPY_BLE_FILE_TRANSFER_CONN_INTERVAL) {
+        return;
+    }
+    ble_gap_conn_params_t conn_params = connection->conn_params;
+    conn_params.min_conn_interval = BLE_GAP_CP_MIN_CONN_INTVL_MIN;
+    conn_params.max_conn_interval = CIRCUITPY_BLE_FILE_TRANSFER_CONN_INTERVAL;
+    conn_params.slave_latency = 0;
+    if (sd_ble_gap_conn_param_update(conn_handle, &conn_params) == NRF_SUCCESS) {
+        _fast_connection_requested = true;
+    }
+}
+
+// The payload of one packet at the negotiated MTU.
+STATIC size_t _packet_size(void) {
+    mp_int_t packet_size = common_hal_bleio_packet_buffer_get_outgoing_packet_length(&_transfer_packet_buffer);
+    // 20 is the minimum.
+    return MAX(packet_size, 20);
+}
+
+// The largest WRITE_DATA payload that, with its header, fills whole packets.
+STATIC size_t _write_chunk_size(void) {
+    size_t packet_size = _packet_size();
+    size_t packets = (COMMAND_SIZE - 1) / packet_size;
+    return packets * packet_size - sizeof(struct write_data);
+}
+
+// How many more full size WRITE_DATA commands fit in the incoming packet buffer
+// while one is being written.
+STATIC uint16_t _write_credits(void) {
+    size_t packet_size = _packet_size();
+    size_t packets = (COMMAND_SIZE - 1) / packet_size;
+    return (PACKET_BUFFER_SIZE - 1) / (packets * (packet_size + sizeof(uint16_t)));
+}
+
 // Used by read and write.
 STATIC FIL active_file;
 STATIC uint8_t _process_read(const uint8_t *raw_buf, size_t command_len) {
@@ -159,6 +216,7 @@ STATIC uint8_t _process_read(const uint8_t *raw_buf, size_t command_len) {
     struct read_data response;
     response.command = READ_DATA;
     response.status = STATUS_OK;
+    response.reserved = 0;
     if (command->path_length > (COMMAND_SIZE - response_size - 1)) { // -1 for the null we'll write
         // TODO: throw away any more packets of path.
         response.status = STATUS_ERROR;
@@ -173,6 +231,8 @@ STATIC uint8_t _process_read(const uint8_t *raw_buf, size_t command_len) {
     char *path = (char *)((uint8_t *)command) + header_size;
     path[command->path_length] = '\0';
 
+    _request_fast_connection();
+
     FATFS *fs = filesystem_circuitpy();
     FRESULT result = f_open(fs, &active_file, path, FA_READ);
     if (result != FR_OK) {
@@ -213,6 +273,7 @@ STATIC uint8_t _process_read_pacing(const uint8_t *raw_buf, size_t command_len)
     struct read_data response;
     response.command = READ_DATA;
     response.status = STATUS_OK;
+    response.reserved = 0;
     size_t response_size = sizeof(struct read_data);
 
     uint32_t total_length = f_size(&active_file);
@@ -239,7 +300,7 @@ STATIC uint8_t _process_read_pacing(const uint8_t *raw_buf, size_t command_len)
         common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&data, quantity_read, NULL, 0);
         chunk_offset += quantity_read;
     }
-    if ((chunk_offset + chunk_size) >= total_length) {
+    if ((command->chunk_offset + chunk_offset) >= total_length) {
         f_close(&active_file);
         return ANY_COMMAND;
     }
@@ -272,6 +333,7 @@ STATIC uint8_t _process_write(const uint8_t *raw_buf, size_t command_len) {
     struct write_pacing response;
     response.command = WRITE_PACING;
     response.status = STATUS_OK;
+    response.credits = 0;
     if (command->path_length > (COMMAND_SIZE - header_size - 1)) { // -1 for the null we'll write
         // TODO: throw away any more packets of path.
         response.status = STATUS_ERROR;
@@ -290,6 +352,8 @@ STATIC uint8_t _process_write(const uint8_t *raw_buf, size_t command_len) {
         return ANY_COMMAND;
     }
 
+    _request_fast_connection();
+
     FATFS *fs = filesystem_circuitpy();
     DWORD fattime;
     _truncated_time = truncate_time(command->modification_time, &fattime);
@@ -306,9 +370,9 @@ STATIC uint8_t _process_write(const uint8_t *raw_buf, size_t command_len) {
     }
     // Write out the pacing response.
 
-    // Align the next chunk to a sector boundary.
+    // Size chunks to fill whole packets and let the client keep several in flight.
     uint32_t offset = command->offset;
-    size_t chunk_size = MIN(total_write_length - offset, 512 - (offset % 512));
+    size_t chunk_size = MIN(total_write_length - offset, _write_chunk_size());
     // Special case when truncating the file. (Deleting stuff off the end.)
     if (chunk_size == 0) {
         f_lseek(&active_file, offset);
@@ -322,6 +386,7 @@ STATIC uint8_t _process_write(const uint8_t *raw_buf, size_t command_len) {
     response.offset = offset;
     response.free_space = chunk_size;
     response.truncated_time = _truncated_time;
+    response.credits = _write_credits();
     common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, sizeof(struct write_pacing), NULL, 0);
     if (chunk_size == 0) {
         // Don't reload until everything is written out of the packet buffer.
@@ -338,6 +403,7 @@ STATIC uint8_t _process_write_data(const uint8_t *raw_buf, size_t command_len) {
     struct write_pacing response;
     response.command = WRITE_PACING;
     response.status = STATUS_OK;
+    response.credits = 0;
     if (command->data_size > (COMMAND_SIZE - header_size - 1)) { // -1 for the null we'll write
         // TODO: throw away any more packets of path.
         response.status = STATUS_ERROR;
@@ -367,11 +433,11 @@ STATIC uint8_t _process_write_data(const uint8_t *raw_buf, size_t command_len) {
         return ANY_COMMAND;
     }
     offset += command->data_size;
-    // Align the next chunk to a sector boundary.
-    size_t chunk_size = MIN(total_write_length - offset, 512);
+    size_t chunk_size = MIN(total_write_length - offset, _write_chunk_size());
     response.offset = offset;
     response.free_space = chunk_size;
     response.truncated_time = _truncated_time;
+    response.credits = _write_credits();
     common_hal_bleio_packet_buffer_write(&_transfer_packet_buffer, (const uint8_t *)&response, sizeof(struct write_pacing), NULL, 0);
     if (total_write_length == offset) {
         f_truncate(&active_file);
@@ -717,6 +783,7 @@ void supervisor_bluetooth_file_transfer_background(void) {
 }
 
 void supervisor_bluetooth_file_transfer_disconnected(void) {
+    _fast_connection_requested = false;
     next_command = ANY_COMMAND;
     current_offset = 0;
     f_close(&active_file);
@@ -83,7 +83,9 @@ struct write_command {
 struct write_pacing {
     uint8_t command;
     uint8_t status;
-    uint16_t reserved;
+    // Added in version 5. The number of further WRITE_DATA commands of up to
+    // free_space bytes each that may be sent before waiting for this reply.
+    uint16_t credits;
     uint32_t offset;
     uint64_t truncated_time;
     uint32_t free_space;
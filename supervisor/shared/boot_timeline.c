@@ -0,0 +1,98 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "supervisor/shared/boot_timeline.h"
+
+#include "py/misc.h"
+#include "supervisor/port.h"
+
+// Indexed by supervisor_boot_event_t.
+STATIC const char *const event_names[SUPERVISOR_BOOT_EVENT_COUNT] = {
+    "port_init",
+    "filesystem_init",
+    "board_init",
+    "boot_py_start",
+    "boot_py_done",
+    "usb_init",
+    "settings_read",
+    "wifi_connect_start",
+    "wifi_connected",
+    "web_workflow_start",
+    "workflow_start",
+    "code_py_start",
+};
+
+// These live in BSS so they are cleared by a hard reset but survive soft reloads.
+// Times are in 1/32768ths of a second: port ticks with their subticks.
+STATIC uint64_t event_times[SUPERVISOR_BOOT_EVENT_COUNT];
+STATIC uint32_t recorded;
+
+void supervisor_boot_timeline_mark(supervisor_boot_event_t event) {
+    MP_STATIC_ASSERT(SUPERVISOR_BOOT_EVENT_COUNT <= 32);
+    if (recorded & (1 << event)) {
+        return;
+    }
+    uint8_t subticks;
+    uint64_t ticks = port_get_raw_ticks(&subticks);
+    event_times[event] = ticks * 32 + subticks;
+    recorded |= 1 << event;
+}
+
+size_t supervisor_boot_timeline_events(supervisor_boot_event_t events[SUPERVISOR_BOOT_EVENT_COUNT]) {
+    size_t count = 0;
+    for (size_t event = 0; event < SUPERVISOR_BOOT_EVENT_COUNT; event++) {
+        if (!(recorded & (1 << event))) {
+            continue;
+        }
+        // Insertion sort. Events are usually already in order.
+        size_t i = count;
+        while (i > 0 && event_times[events[i - 1]] > event_times[event]) {
+            events[i] = events[i - 1];
+            i--;
+        }
+        events[i] = event;
+        count++;
+    }
+    return count;
+}
+
+mp_float_t supervisor_boot_timeline_time_ms(supervisor_boot_event_t event) {
+    return (mp_float_t)event_times[event] * MICROPY_FLOAT_CONST(1000.0) / MICROPY_FLOAT_CONST(32768.0);
+}
+
+const char *supervisor_boot_timeline_name(supervisor_boot_event_t event) {
+    return event_names[event];
+}
+
+void supervisor_boot_timeline_print(const mp_print_t *print) {
+    supervisor_boot_event_t events[SUPERVISOR_BOOT_EVENT_COUNT];
+    size_t count = supervisor_boot_timeline_events(events);
+    for (size_t i = 0; i < count; i++) {
+        // Whole microseconds, so this doesn't depend on float formatting.
+        uint32_t us = event_times[events[i]] * 1000000 / 32768;
+        mp_printf(print, "%8u.%03u ms %s\n", (unsigned)(us / 1000), (unsigned)(us % 1000), event_names[events[i]]);
+    }
+}
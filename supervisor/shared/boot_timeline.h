@@ -0,0 +1,64 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "py/mpconfig.h"
+#include "py/mpprint.h"
+
+// Fixed points in startup, in the order they normally happen. Each one is
+// timestamped the first time it is reached after a hard reset, so later soft
+// reloads don't move them.
+typedef enum {
+    SUPERVISOR_BOOT_EVENT_PORT_INIT,
+    SUPERVISOR_BOOT_EVENT_FILESYSTEM_INIT,
+    SUPERVISOR_BOOT_EVENT_BOARD_INIT,
+    SUPERVISOR_BOOT_EVENT_BOOT_PY_START,
+    SUPERVISOR_BOOT_EVENT_BOOT_PY_DONE,
+    SUPERVISOR_BOOT_EVENT_USB_INIT,
+    SUPERVISOR_BOOT_EVENT_SETTINGS_READ,
+    SUPERVISOR_BOOT_EVENT_WIFI_CONNECT_START,
+    SUPERVISOR_BOOT_EVENT_WIFI_CONNECTED,
+    SUPERVISOR_BOOT_EVENT_WEB_WORKFLOW_START,
+    SUPERVISOR_BOOT_EVENT_WORKFLOW_START,
+    SUPERVISOR_BOOT_EVENT_CODE_PY_START,
+    SUPERVISOR_BOOT_EVENT_COUNT,
+} supervisor_boot_event_t;
+
+void supervisor_boot_timeline_mark(supervisor_boot_event_t event);
+
+// Fills events with the events recorded so far, earliest first, and returns
+// how many there are.
+size_t supervisor_boot_timeline_events(supervisor_boot_event_t events[SUPERVISOR_BOOT_EVENT_COUNT]);
+// Milliseconds since the port's tick counter started. Only valid for recorded events.
+mp_float_t supervisor_boot_timeline_time_ms(supervisor_boot_event_t event);
+const char *supervisor_boot_timeline_name(supervisor_boot_event_t event);
+
+// Print the recorded events in time order, one per line.
+void supervisor_boot_timeline_print(const mp_print_t *print);
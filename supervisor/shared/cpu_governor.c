@@ -0,0 +1,78 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "supervisor/shared/cpu_governor.h"
+
+#include "py/mpconfig.h"
+#include "shared-bindings/microcontroller/Processor.h"
+#include "supervisor/background_callback.h"
+
+#if CIRCUITPY_OS_GETENV
+#include "shared-module/os/__init__.h"
+#endif
+
+static bool governing;
+// The frequency to restore when the idle ends, or 0 if the clock wasn't lowered.
+static uint32_t full_frequency;
+
+void cpu_governor_start(void) {
+    governing = false;
+    #if CIRCUITPY_OS_GETENV
+    mp_int_t enable = 0;
+    (void)common_hal_os_getenv_int("CIRCUITPY_CPU_GOVERNOR", &enable);
+    governing = enable != 0;
+    #endif
+}
+
+void cpu_governor_idle_begin(uint64_t expected_ticks) {
+    full_frequency = 0;
+    // Pending callbacks will end the idle as soon as it begins.
+    if (!governing || background_callback_pending()) {
+        return;
+    }
+    uint64_t expected_ms = expected_ticks == UINT64_MAX ? UINT64_MAX : expected_ticks * 1000 / 1024;
+    uint32_t current = common_hal_mcu_processor_get_frequency();
+    size_t count;
+    const cpu_governor_level_t *levels = port_cpu_governor_levels(&count);
+    for (size_t i = 0; i < count; i++) {
+        if (levels[i].frequency >= current) {
+            break;
+        }
+        if (levels[i].min_idle_ms <= expected_ms) {
+            if (port_cpu_governor_set_frequency(levels[i].frequency)) {
+                full_frequency = current;
+            }
+            return;
+        }
+    }
+}
+
+void cpu_governor_idle_end(void) {
+    if (full_frequency != 0) {
+        port_cpu_governor_set_frequency(full_frequency);
+        full_frequency = 0;
+    }
+}
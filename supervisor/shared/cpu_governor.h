@@ -0,0 +1,62 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// The CPU governor runs the CPU at full speed while the VM is working and drops
+// the clock while it idles in time.sleep(), select.poll() and the like. Each
+// wake restores full speed before any Python code or background work runs, so
+// code and peripherals are always set up at the full frequency.
+
+typedef struct {
+    uint32_t frequency;
+    // The shortest expected idle worth switching to this frequency for.
+    uint16_t min_idle_ms;
+} cpu_governor_level_t;
+
+// Provided by the port: the frequencies to idle at, lowest first. The governor
+// uses the lowest one whose min_idle_ms fits the expected idle and that is below
+// the current frequency.
+const cpu_governor_level_t *port_cpu_governor_levels(size_t *count);
+// Switch the CPU clock without raising an exception. Called with the VM stopped
+// in an idle wait, so it must not allocate or run background tasks. Return false
+// to stay at the current frequency, such as when a running peripheral is timed
+// from the CPU clock. Going back up to the frequency from before the idle must
+// always work.
+bool port_cpu_governor_set_frequency(uint32_t frequency);
+
+// Read CIRCUITPY_CPU_GOVERNOR from settings.toml before code.py runs. The
+// setting also covers the wait after code.py finishes.
+void cpu_governor_start(void);
+
+// Bracket an idle wait that is expected to last for expected_ticks, or
+// UINT64_MAX if it has no end.
+void cpu_governor_idle_begin(uint64_t expected_ticks);
+void cpu_governor_idle_end(void);
@@ -94,14 +94,14 @@ void supervisor_start_terminal(uint16_t width_px, uint16_t height_px) {
     // Reuse the previous allocation if possible
     if (tilegrid_tiles) {
         if (tilegrid_tiles_size != total_tiles) {
-            port_free(tilegrid_tiles);
+            port_free_tagged(tilegrid_tiles, PORT_HEAP_TAG_DISPLAY);
             tilegrid_tiles = NULL;
             tilegrid_tiles_size = 0;
             reset_tiles = true;
         }
     }
     if (!tilegrid_tiles) {
-        tilegrid_tiles = port_malloc(total_tiles, false);
+        tilegrid_tiles = port_malloc_tagged(total_tiles, false, PORT_HEAP_TAG_DISPLAY);
         reset_tiles = true;
         if (!tilegrid_tiles) {
             return;
@@ -148,6 +148,10 @@ void supervisor_start_terminal(uint16_t width_px, uint16_t height_px) {
         scroll_area->full_change = true;
 
         common_hal_terminalio_terminal_construct(&supervisor_terminal, scroll_area, &supervisor_terminal_font, status_bar);
+        #if CIRCUITPY_STATUS_BAR
+        // The new status bar starts out blank.
+        supervisor_status_bar_invalidate();
+        #endif
 
         // Do not update status bar until after boot.py has run, in case it is disabled.
     }
@@ -159,7 +163,7 @@ void supervisor_start_terminal(uint16_t width_px, uint16_t height_px) {
 void supervisor_stop_terminal(void) {
     #if CIRCUITPY_TERMINALIO
     if (tilegrid_tiles != NULL) {
-        port_free(tilegrid_tiles);
+        port_free_tagged(tilegrid_tiles, PORT_HEAP_TAG_DISPLAY);
         tilegrid_tiles = NULL;
         tilegrid_tiles_size = 0;
         supervisor_terminal_scroll_area_text_grid.tiles = NULL;
@@ -42,21 +42,32 @@
 
 #define NO_SECTOR_LOADED 0xFFFFFFFF
 
-// The currently cached sector in the cache, ram or flash based.
-static uint32_t current_sector;
+#define BLOCKS_PER_SECTOR (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE)
+#define PAGES_PER_BLOCK (FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE)
+
+// A sector with blocks waiting to be written, held in ram or, for slot 0 only
+// when ram can't be allocated, in the scratch sector at the end of the flash.
+typedef struct {
+    // The cached sector's address or NO_SECTOR_LOADED.
+    uint32_t sector;
+    // Track which blocks (up to 32) in the sector currently live in the cache.
+    uint32_t dirty_mask;
+    // Value of cache_use_count when last written, for least recently used eviction.
+    uint32_t last_use;
+    // Table of pointers to each cached page. NULL when using the scratch sector.
+    uint8_t **pages;
+} cache_slot_t;
+
+static cache_slot_t cache_slots[CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS];
+// Number of slots with ram allocated. 0 means slot 0 uses the scratch sector.
+static uint8_t ram_slot_count;
+static uint32_t cache_use_count;
 
 STATIC const external_flash_device possible_devices[] = {EXTERNAL_FLASH_DEVICES};
 #define EXTERNAL_FLASH_DEVICE_COUNT MP_ARRAY_SIZE(possible_devices)
 
 static const external_flash_device *flash_device = NULL;
 
-// Track which blocks (up to 32) in the current sector currently live in the
-// cache.
-static uint32_t dirty_mask;
-
-// Table of pointers to each cached block
-static uint8_t **flash_cache_table = NULL;
-
 // Wait until both the write enable and write in progress bits have cleared.
 static bool wait_for_flash_ready(void) {
     if (flash_device == NULL) {
@@ -293,9 +304,12 @@ void supervisor_flash_init(void) {
 
     wait_for_flash_ready();
 
-    current_sector = NO_SECTOR_LOADED;
-    dirty_mask = 0;
-    flash_cache_table = NULL;
+    for (uint8_t i = 0; i < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; i++) {
+        cache_slots[i].sector = NO_SECTOR_LOADED;
+        cache_slots[i].dirty_mask = 0;
+        cache_slots[i].pages = NULL;
+    }
+    ram_slot_count = 0;
 }
 
 // The size of each individual block.
@@ -316,17 +330,18 @@ uint32_t supervisor_flash_get_block_count(void) {
 // Flush the cache that was written to the scratch portion of flash. Only used
 // when ram is tight.
 static bool flush_scratch_flash(void) {
-    if (current_sector == NO_SECTOR_LOADED) {
+    cache_slot_t *slot = &cache_slots[0];
+    if (slot->sector == NO_SECTOR_LOADED) {
         return true;
     }
     // First, copy out any blocks that we haven't touched from the sector we've
     // cached.
     bool copy_to_scratch_ok = true;
     uint32_t scratch_sector = flash_device->total_size - SPI_FLASH_ERASE_SIZE;
-    for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
-        if ((dirty_mask & (1 << i)) == 0) {
+    for (uint8_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
+        if ((slot->dirty_mask & (1 << i)) == 0) {
             copy_to_scratch_ok = copy_to_scratch_ok &&
-                copy_block(current_sector + i * FILESYSTEM_BLOCK_SIZE,
+                copy_block(slot->sector + i * FILESYSTEM_BLOCK_SIZE,
                 scratch_sector + i * FILESYSTEM_BLOCK_SIZE);
         }
     }
@@ -336,91 +351,76 @@ static bool flush_scratch_flash(void) {
         return false;
     }
     // Second, erase the current sector.
-    erase_sector(current_sector);
+    erase_sector(slot->sector);
     // Finally, copy the new version into it.
-    for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
+    for (uint8_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
         copy_block(scratch_sector + i * FILESYSTEM_BLOCK_SIZE,
-            current_sector + i * FILESYSTEM_BLOCK_SIZE);
+            slot->sector + i * FILESYSTEM_BLOCK_SIZE);
     }
     return true;
 }
 
-// Attempts to allocate a new set of page buffers for caching a full sector in
-// ram. Each page is allocated separately so that the GC doesn't need to provide
-// one huge block. We can free it as we write if we want to also.
+static void free_slot_pages(cache_slot_t *slot, uint8_t page_count) {
+    for (uint8_t i = 0; i < page_count; i++) {
+        port_free_tagged(slot->pages[i], PORT_HEAP_TAG_FLASH_CACHE);
+    }
+    port_free_tagged(slot->pages, PORT_HEAP_TAG_FLASH_CACHE);
+    slot->pages = NULL;
+}
+
+// Attempts to allocate page buffers for caching up to
+// CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS full sectors in ram. Each page is
+// allocated separately so that the GC doesn't need to provide one huge block.
+// Succeeds if at least one sector fits.
 static bool allocate_ram_cache(void) {
-    uint8_t blocks_per_sector = SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE;
-    uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
-
-    uint32_t table_size = blocks_per_sector * pages_per_block * sizeof(size_t);
-    // Attempt to allocate outside the heap first.
-    flash_cache_table = port_malloc(table_size, false);
-
-    // Declare i and j outside the loops in case we fail to allocate everything
-    // we need. In that case we'll give it back.
-    uint8_t i = 0;
-    uint8_t j = 0;
-    bool success = flash_cache_table != NULL;
-    for (i = 0; i < blocks_per_sector && success; i++) {
-        for (j = 0; j < pages_per_block && success; j++) {
-            uint8_t *page_cache = port_malloc(SPI_FLASH_PAGE_SIZE, false);
-            if (page_cache == NULL) {
-                success = false;
+    uint8_t pages_per_sector = BLOCKS_PER_SECTOR * PAGES_PER_BLOCK;
+    for (ram_slot_count = 0; ram_slot_count < CIRCUITPY_EXTERNAL_FLASH_CACHE_SECTORS; ram_slot_count++) {
+        cache_slot_t *slot = &cache_slots[ram_slot_count];
+        // Attempt to allocate outside the heap first.
+        slot->pages = port_malloc_tagged(pages_per_sector * sizeof(uint8_t *), false, PORT_HEAP_TAG_FLASH_CACHE);
+        if (slot->pages == NULL) {
+            break;
+        }
+        uint8_t i;
+        for (i = 0; i < pages_per_sector; i++) {
+            slot->pages[i] = port_malloc_tagged(SPI_FLASH_PAGE_SIZE, false, PORT_HEAP_TAG_FLASH_CACHE);
+            if (slot->pages[i] == NULL) {
                 break;
             }
-            flash_cache_table[i * pages_per_block + j] = page_cache;
         }
-    }
-    // We couldn't allocate enough so give back what we got.
-    if (!success) {
-        // We add 1 so that we delete 0 when i is 1. Going to zero (i >= 0)
-        // would never stop because i is unsigned.
-        i++;
-        for (; i > 0; i--) {
-            for (; j > 0; j--) {
-                port_free(flash_cache_table[(i - 1) * pages_per_block + (j - 1)]);
-            }
-            j = pages_per_block;
+        // We couldn't allocate enough so give back what we got for this sector.
+        if (i < pages_per_sector) {
+            free_slot_pages(slot, i);
+            break;
         }
-        port_free(flash_cache_table);
-        flash_cache_table = NULL;
+        slot->sector = NO_SECTOR_LOADED;
+        slot->dirty_mask = 0;
     }
-    return success;
+    return ram_slot_count > 0;
 }
 
 static void release_ram_cache(void) {
-    uint8_t blocks_per_sector = SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE;
-    uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
-    for (uint8_t i = 0; i < blocks_per_sector; i++) {
-        for (uint8_t j = 0; j < pages_per_block; j++) {
-            uint32_t offset = i * pages_per_block + j;
-            port_free(flash_cache_table[offset]);
-        }
+    for (uint8_t i = 0; i < ram_slot_count; i++) {
+        free_slot_pages(&cache_slots[i], BLOCKS_PER_SECTOR * PAGES_PER_BLOCK);
     }
-    port_free(flash_cache_table);
-    flash_cache_table = NULL;
+    ram_slot_count = 0;
 }
 
-// Flush the cached sector from ram onto the flash. We'll free the cache unless
-// keep_cache is true.
-static bool flush_ram_cache(bool keep_cache) {
-    if (current_sector == NO_SECTOR_LOADED) {
-        if (!keep_cache) {
-            release_ram_cache();
-        }
+// Flush one cached sector from ram onto the flash and mark the slot unused.
+static bool flush_ram_slot(cache_slot_t *slot) {
+    if (slot->sector == NO_SECTOR_LOADED) {
         return true;
     }
     // First, copy out any blocks that we haven't touched from the sector
     // we've cached. If we don't do this we'll erase the data during the sector
     // erase below.
     bool copy_to_ram_ok = true;
-    uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
-    for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
-        if ((dirty_mask & (1 << i)) == 0) {
-            for (uint8_t j = 0; j < pages_per_block; j++) {
+    for (uint8_t i = 0; i < BLOCKS_PER_SECTOR; i++) {
+        if ((slot->dirty_mask & (1 << i)) == 0) {
+            for (uint8_t j = 0; j < PAGES_PER_BLOCK; j++) {
                 copy_to_ram_ok = read_flash(
-                    current_sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
-                    flash_cache_table[i * pages_per_block + j],
+                    slot->sector + (i * PAGES_PER_BLOCK + j) * SPI_FLASH_PAGE_SIZE,
+                    slot->pages[i * PAGES_PER_BLOCK + j],
                     SPI_FLASH_PAGE_SIZE);
                 if (!copy_to_ram_ok) {
                     break;
@@ -436,35 +436,37 @@ static bool flush_ram_cache(bool keep_cache) {
         return false;
     }
     // Second, erase the current sector.
-    erase_sector(current_sector);
+    erase_sector(slot->sector);
     // Lastly, write all the data in ram that we've cached.
-    for (uint8_t i = 0; i < SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE; i++) {
-        for (uint8_t j = 0; j < pages_per_block; j++) {
-            write_flash(current_sector + (i * pages_per_block + j) * SPI_FLASH_PAGE_SIZE,
-                flash_cache_table[i * pages_per_block + j],
-                SPI_FLASH_PAGE_SIZE);
-        }
-    }
-    // We're done with the cache for now so give it back.
-    if (!keep_cache) {
-        release_ram_cache();
+    for (uint8_t i = 0; i < BLOCKS_PER_SECTOR * PAGES_PER_BLOCK; i++) {
+        write_flash(slot->sector + i * SPI_FLASH_PAGE_SIZE, slot->pages[i], SPI_FLASH_PAGE_SIZE);
     }
+    slot->sector = NO_SECTOR_LOADED;
+    slot->dirty_mask = 0;
     return true;
 }
 
 // Delegates to the correct flash flush method depending on the existing cache.
+// Every dirty sector is written out together, so the filesystem flush interval
+// is what coalesces repeated writes to the same sectors.
 // TODO Don't blink the status indicator if we don't actually do any writing (hard to tell right now).
 static void spi_flash_flush_keep_cache(bool keep_cache) {
     #ifdef MICROPY_HW_LED_MSC
     port_pin_set_output_level(MICROPY_HW_LED_MSC, true);
     #endif
     // If we've cached to the flash itself flush from there.
-    if (flash_cache_table == NULL) {
+    if (ram_slot_count == 0) {
         flush_scratch_flash();
+        cache_slots[0].sector = NO_SECTOR_LOADED;
     } else {
-        flush_ram_cache(keep_cache);
+        for (uint8_t i = 0; i < ram_slot_count; i++) {
+            flush_ram_slot(&cache_slots[i]);
+        }
+        // We're done with the cache for now so give it back.
+        if (!keep_cache) {
+            release_ram_cache();
+        }
     }
-    current_sector = NO_SECTOR_LOADED;
     #ifdef MICROPY_HW_LED_MSC
     port_pin_set_output_level(MICROPY_HW_LED_MSC, false);
     #endif
@@ -487,6 +489,29 @@ static int32_t convert_block_to_flash_addr(uint32_t block) {
     return -1;
 }
 
+// Returns the slot caching the sector that address is in, or NULL.
+static cache_slot_t *find_slot(uint32_t address) {
+    // Mask out the lower bits that designate the address within the sector.
+    uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
+    uint8_t slot_count = ram_slot_count > 0 ? ram_slot_count : 1;
+    for (uint8_t i = 0; i < slot_count; i++) {
+        if (cache_slots[i].sector == this_sector) {
+            return &cache_slots[i];
+        }
+    }
+    return NULL;
+}
+
+static uint8_t block_index_in_sector(uint32_t address) {
+    return (address / FILESYSTEM_BLOCK_SIZE) % BLOCKS_PER_SECTOR;
+}
+
+// Returns true if the block at address has a newer version in the cache.
+static bool block_cached(uint32_t address) {
+    cache_slot_t *slot = find_slot(address);
+    return slot != NULL && (slot->dirty_mask & (1 << block_index_in_sector(address))) != 0;
+}
+
 static bool external_flash_read_block(uint8_t *dest, uint32_t block) {
     int32_t address = convert_block_to_flash_addr(block);
     if (address == -1) {
@@ -494,17 +519,14 @@ static bool external_flash_read_block(uint8_t *dest, uint32_t block) {
         return false;
     }
 
-    // Mask out the lower bits that designate the address within the sector.
-    uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
-    uint8_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE);
-    uint8_t mask = 1 << (block_index);
-    // We're reading from the currently cached sector.
-    if (current_sector == this_sector && (mask & dirty_mask) > 0) {
-        if (flash_cache_table != NULL) {
-            uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
-            for (int i = 0; i < pages_per_block; i++) {
+    // We're reading from a cached sector.
+    if (block_cached(address)) {
+        cache_slot_t *slot = find_slot(address);
+        uint8_t block_index = block_index_in_sector(address);
+        if (slot->pages != NULL) {
+            for (int i = 0; i < PAGES_PER_BLOCK; i++) {
                 memcpy(dest + i * SPI_FLASH_PAGE_SIZE,
-                    flash_cache_table[block_index * pages_per_block + i],
+                    slot->pages[block_index * PAGES_PER_BLOCK + i],
                     SPI_FLASH_PAGE_SIZE);
             }
             return true;
@@ -516,6 +538,39 @@ static bool external_flash_read_block(uint8_t *dest, uint32_t block) {
     return read_flash(address, dest, FILESYSTEM_BLOCK_SIZE);
 }
 
+// Picks a slot to cache a new sector in, writing out the least recently used
+// sector if every slot is taken.
+static cache_slot_t *claim_slot(void) {
+    if (ram_slot_count == 0) {
+        if (cache_slots[0].sector != NO_SECTOR_LOADED) {
+            supervisor_flash_flush();
+        }
+        if (!allocate_ram_cache()) {
+            erase_sector(flash_device->total_size - SPI_FLASH_ERASE_SIZE);
+            wait_for_flash_ready();
+            return &cache_slots[0];
+        }
+    }
+    cache_slot_t *oldest = &cache_slots[0];
+    for (uint8_t i = 0; i < ram_slot_count; i++) {
+        cache_slot_t *slot = &cache_slots[i];
+        if (slot->sector == NO_SECTOR_LOADED) {
+            return slot;
+        }
+        if (cache_use_count - slot->last_use > cache_use_count - oldest->last_use) {
+            oldest = slot;
+        }
+    }
+    #ifdef MICROPY_HW_LED_MSC
+    port_pin_set_output_level(MICROPY_HW_LED_MSC, true);
+    #endif
+    flush_ram_slot(oldest);
+    #ifdef MICROPY_HW_LED_MSC
+    port_pin_set_output_level(MICROPY_HW_LED_MSC, false);
+    #endif
+    return oldest;
+}
+
 static bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     // Non-MBR block, copy to cache
     int32_t address = convert_block_to_flash_addr(block);
@@ -525,34 +580,28 @@ static bool external_flash_write_block(const uint8_t *data, uint32_t block) {
     }
     // Wait for any previous writes to finish.
     wait_for_flash_ready();
-    // Mask out the lower bits that designate the address within the sector.
-    uint32_t this_sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
-    uint8_t block_index = (address / FILESYSTEM_BLOCK_SIZE) % (SPI_FLASH_ERASE_SIZE / FILESYSTEM_BLOCK_SIZE);
+    uint8_t block_index = block_index_in_sector(address);
     uint8_t mask = 1 << (block_index);
-    // Flush the cache if we're moving onto a sector or we're writing the
-    // same block again.
-    if (current_sector != this_sector || (mask & dirty_mask) > 0) {
+    cache_slot_t *slot = find_slot(address);
+    // Start caching the sector if it isn't yet. The scratch sector also has to
+    // be flushed when writing the same block again because it can't be
+    // rewritten in place. Ram cached blocks are simply replaced.
+    if (slot == NULL || (slot->pages == NULL && (mask & slot->dirty_mask) > 0)) {
         // Check to see if we'd write to an erased page. In that case we
         // can write directly.
-        if (page_erased(address)) {
+        if (slot == NULL && page_erased(address)) {
             return write_flash(address, data, FILESYSTEM_BLOCK_SIZE);
         }
-        if (current_sector != NO_SECTOR_LOADED) {
-            supervisor_flash_flush();
-        }
-        if (flash_cache_table == NULL && !allocate_ram_cache()) {
-            erase_sector(flash_device->total_size - SPI_FLASH_ERASE_SIZE);
-            wait_for_flash_ready();
-        }
-        current_sector = this_sector;
-        dirty_mask = 0;
+        slot = claim_slot();
+        slot->sector = address & (~(SPI_FLASH_ERASE_SIZE - 1));
+        slot->dirty_mask = 0;
     }
-    dirty_mask |= mask;
+    slot->dirty_mask |= mask;
+    slot->last_use = ++cache_use_count;
     // Copy the block to the appropriate cache.
-    if (flash_cache_table != NULL) {
-        uint8_t pages_per_block = FILESYSTEM_BLOCK_SIZE / SPI_FLASH_PAGE_SIZE;
-        for (int i = 0; i < pages_per_block; i++) {
-            memcpy(flash_cache_table[block_index * pages_per_block + i],
+    if (slot->pages != NULL) {
+        for (int i = 0; i < PAGES_PER_BLOCK; i++) {
+            memcpy(slot->pages[block_index * PAGES_PER_BLOCK + i],
                 data + i * SPI_FLASH_PAGE_SIZE,
                 SPI_FLASH_PAGE_SIZE);
         }
@@ -564,10 +613,28 @@ static bool external_flash_write_block(const uint8_t *data, uint32_t block) {
 }
 
 mp_uint_t supervisor_flash_read_blocks(uint8_t *dest, uint32_t block_num, uint32_t num_blocks) {
-    for (size_t i = 0; i < num_blocks; i++) {
-        if (!external_flash_read_block(dest + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
+    size_t i = 0;
+    while (i < num_blocks) {
+        int32_t address = convert_block_to_flash_addr(block_num + i);
+        if (address == -1 || block_cached(address)) {
+            if (!external_flash_read_block(dest + i * FILESYSTEM_BLOCK_SIZE, block_num + i)) {
+                return 1; // error
+            }
+            i++;
+            continue;
+        }
+        // Read runs of consecutive uncached blocks, up to a sector, with a
+        // single command so that the flash streams them.
+        size_t run = 1;
+        while (i + run < num_blocks && run < BLOCKS_PER_SECTOR &&
+               convert_block_to_flash_addr(block_num + i + run) != -1 &&
+               !block_cached(address + run * FILESYSTEM_BLOCK_SIZE)) {
+            run++;
+        }
+        if (!read_flash(address, dest + i * FILESYSTEM_BLOCK_SIZE, run * FILESYSTEM_BLOCK_SIZE)) {
             return 1; // error
         }
+        i += run;
     }
     return 0; // success
 }
@@ -34,6 +34,8 @@
 
 #include "supervisor/flash.h"
 #include "supervisor/linker.h"
+#include "supervisor/shared/boot_timeline.h"
+#include "supervisor/usb.h"
 
 static mp_vfs_mount_t _mp_vfs;
 static fs_user_mount_t _internal_vfs;
@@ -170,10 +172,18 @@ bool filesystem_init(bool create_allowed, bool force_create) {
     supervisor_flash_update_extended();
     #endif
 
+    #if CIRCUITPY_SUPERVISOR_BOOT_TIMELINE
+    supervisor_boot_timeline_mark(SUPERVISOR_BOOT_EVENT_FILESYSTEM_INIT);
+    #endif
+
     return true;
 }
 
 void PLACE_IN_ITCM(filesystem_flush)(void) {
+    #if CIRCUITPY_USB_MSC
+    // Hand over any host writes that are still being held.
+    usb_msc_flush_writes();
+    #endif
     // Reset interval before next flush.
     filesystem_flush_interval_ms = CIRCUITPY_FILESYSTEM_FLUSH_INTERVAL_MS;
     supervisor_flash_flush();
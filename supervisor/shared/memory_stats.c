@@ -0,0 +1,77 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2026 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "supervisor/shared/memory_stats.h"
+
+#include "py/misc.h"
+
+// Indexed by port_heap_tag_t.
+STATIC const char *const tag_names[PORT_HEAP_TAG_COUNT] = {
+    "vm",
+    "supervisor",
+    "display",
+    "flash_cache",
+    "usb",
+    "native_code",
+};
+
+// Kept in BSS so that peaks cover everything since the last hard reset.
+STATIC supervisor_memory_stats_t stats[PORT_HEAP_TAG_COUNT];
+
+void *port_malloc_tagged(size_t size, bool dma_capable, port_heap_tag_t tag) {
+    void *ptr = port_malloc(size, dma_capable);
+    if (ptr != NULL) {
+        supervisor_memory_stats_t *s = &stats[tag];
+        s->in_use += port_heap_get_block_size(ptr);
+        s->blocks++;
+        if (s->in_use > s->peak) {
+            s->peak = s->in_use;
+        }
+    }
+    return ptr;
+}
+
+void port_free_tagged(void *ptr, port_heap_tag_t tag) {
+    if (ptr == NULL) {
+        return;
+    }
+    supervisor_memory_stats_t *s = &stats[tag];
+    size_t size = port_heap_get_block_size(ptr);
+    // Don't wrap around if a block was freed with the wrong tag.
+    s->in_use -= MIN(size, s->in_use);
+    if (s->blocks > 0) {
+        s->blocks--;
+    }
+    port_free(ptr);
+}
+
+const supervisor_memory_stats_t *supervisor_memory_stats(port_heap_tag_t tag) {
+    return &stats[tag];
+}
+
+const char *supervisor_memory_stats_name(port_heap_tag_t tag) {
+    return tag_names[tag];
+}
@@ -0,0 +1,72 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "supervisor/shared/native_code.h"
+
+#include <string.h>
+
+#include "py/persistentcode.h"
+#include "py/runtime.h"
+#include "supervisor/port_heap.h"
+
+#if CIRCUITPY_ENABLE_MPY_NATIVE
+
+typedef struct _native_code_block_t {
+    struct _native_code_block_t *next;
+    uint32_t code[];
+} native_code_block_t;
+
+// Blocks live outside the VM heap so the list head is plain C state rather than a root pointer.
+static native_code_block_t *native_code_blocks;
+
+void *supervisor_native_code_commit(void *buf, size_t len, void *reloc) {
+    size_t code_len = (len + sizeof(uint32_t) - 1) & ~(sizeof(uint32_t) - 1);
+    native_code_block_t *block = port_native_code_alloc(sizeof(native_code_block_t) + code_len);
+    if (block == NULL) {
+        m_malloc_fail(len);
+    }
+    block->next = native_code_blocks;
+    native_code_blocks = block;
+
+    uint8_t *code = (uint8_t *)block->code;
+    memcpy(code, buf, len);
+    if (reloc != NULL) {
+        // Relocate against the final address, in place, so relative calls and
+        // literal pools point at the copy that will actually run.
+        mp_native_relocate(reloc, code, (uintptr_t)code);
+    }
+    return code;
+}
+
+void supervisor_native_code_free_all(void) {
+    while (native_code_blocks != NULL) {
+        native_code_block_t *next = native_code_blocks->next;
+        port_native_code_free(native_code_blocks);
+        native_code_blocks = next;
+    }
+}
+
+#endif
@@ -46,6 +46,13 @@ MP_WEAK void port_yield(void) {
 MP_WEAK void port_boot_info(void) {
 }
 
+MP_WEAK uint64_t port_get_raw_ticks_us(void) {
+    uint8_t subticks = 0;
+    uint64_t all_subticks = port_get_raw_ticks(&subticks) * 32 + subticks;
+    // 1000000/32768 = 15625/512 in lowest terms
+    return all_subticks * 15625 / 512;
+}
+
 MP_WEAK void port_heap_init(void) {
     uint32_t *heap_bottom = port_heap_get_bottom();
     uint32_t *heap_top = port_heap_get_top();
@@ -66,6 +73,18 @@ MP_WEAK void port_realloc(void *ptr, size_t size) {
     tlsf_realloc(heap, ptr, size);
 }
 
+MP_WEAK size_t port_heap_get_block_size(void *ptr) {
+    return tlsf_block_size(ptr);
+}
+
+MP_WEAK void *port_native_code_alloc(size_t size) {
+    return port_malloc_tagged(size, false, PORT_HEAP_TAG_NATIVE_CODE);
+}
+
+MP_WEAK void port_native_code_free(void *ptr) {
+    port_free_tagged(ptr, PORT_HEAP_TAG_NATIVE_CODE);
+}
+
 static void max_size_walker(void *ptr, size_t size, int used, void *user) {
     size_t *max_size = (size_t *)user;
     if (!used && *max_size < size) {
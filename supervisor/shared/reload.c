@@ -26,6 +26,7 @@
 
 #include "reload.h"
 
+#include "py/builtin.h"
 #include "py/mphal.h"
 #include "py/mpstate.h"
 #include "supervisor/port.h"
@@ -81,6 +82,8 @@ inline bool autoreload_is_enabled() {
 }
 
 void autoreload_trigger() {
+    // Files were changed from outside the VM, so any directory listings kept by import are stale.
+    mp_import_dir_cache_invalidate();
     if (!autoreload_enabled || autoreload_suspended != 0) {
         return;
     }
@@ -43,7 +43,8 @@ enum {
     AUTORELOAD_SUSPEND_REPL = 0x1,
     AUTORELOAD_SUSPEND_BLE = 0x2,
     AUTORELOAD_SUSPEND_USB = 0x4,
-    AUTORELOAD_SUSPEND_WEB = 0x8
+    AUTORELOAD_SUSPEND_WEB = 0x8,
+    AUTORELOAD_SUSPEND_WEBSOCKET = 0x10
 };
 
 // Helper for exiting the VM and reloading immediately.
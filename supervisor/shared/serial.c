@@ -29,7 +29,9 @@
 
 #include "py/mpconfig.h"
 #include "py/mphal.h"
+#include "py/ringbuf.h"
 
+#include "supervisor/background_callback.h"
 #include "supervisor/shared/cpu.h"
 #include "supervisor/shared/display.h"
 #include "shared-bindings/terminalio/Terminal.h"
@@ -80,6 +82,53 @@ static bool _serial_console_write_disabled;
 // Set to true to temporarily discard writes to the display terminal only.
 static bool _serial_display_write_disabled;
 
+#if CIRCUITPY_TERMINALIO && CIRCUITPY_TERMINAL_OUTPUT_BUFFER_SIZE > 0
+// Output for the display terminal is collected here and drawn from the background
+// so that printing doesn't wait on the display. When output comes faster than it
+// can be drawn, the oldest lines are dropped. They would have scrolled off anyway.
+static uint8_t _terminal_output_buf[CIRCUITPY_TERMINAL_OUTPUT_BUFFER_SIZE];
+static ringbuf_t _terminal_output_ringbuf;
+static background_callback_t _terminal_output_callback = { .priority = BACKGROUND_CALLBACK_PRIORITY_IO };
+
+STATIC void _terminal_output_flush(void *unused) {
+    uint8_t chunk[64];
+    size_t len;
+    while ((len = ringbuf_get_n(&_terminal_output_ringbuf, chunk, sizeof(chunk))) > 0) {
+        if (supervisor_terminal_started()) {
+            int errcode;
+            common_hal_terminalio_terminal_write(&supervisor_terminal, chunk, len, &errcode);
+        }
+    }
+}
+
+// Drop buffered output through the end of a line so that what is left starts a
+// fresh line.
+STATIC void _terminal_output_drop_line(void) {
+    int c;
+    do {
+        c = ringbuf_get(&_terminal_output_ringbuf);
+    } while (c >= 0 && c != '\n');
+}
+
+STATIC void _terminal_output_write(const char *text, uint32_t length) {
+    if (_terminal_output_ringbuf.buf == NULL) {
+        ringbuf_init(&_terminal_output_ringbuf, _terminal_output_buf, sizeof(_terminal_output_buf));
+    }
+    size_t capacity = ringbuf_size(&_terminal_output_ringbuf);
+    if (length > capacity) {
+        // Only the end of the text fits.
+        ringbuf_clear(&_terminal_output_ringbuf);
+        text += length - capacity;
+        length = capacity;
+    }
+    while (ringbuf_num_empty(&_terminal_output_ringbuf) < length) {
+        _terminal_output_drop_line();
+    }
+    ringbuf_put_n(&_terminal_output_ringbuf, (const uint8_t *)text, length);
+    background_callback_add(&_terminal_output_callback, _terminal_output_flush, NULL);
+}
+#endif
+
 #if CIRCUITPY_CONSOLE_UART
 STATIC void console_uart_print_strn(void *env, const char *str, size_t len) {
     (void)env;
@@ -314,9 +363,13 @@ void serial_write_substring(const char *text, uint32_t length) {
     }
 
     #if CIRCUITPY_TERMINALIO
-    int errcode;
     if (!_serial_display_write_disabled) {
+        #if CIRCUITPY_TERMINAL_OUTPUT_BUFFER_SIZE > 0
+        _terminal_output_write(text, length);
+        #else
+        int errcode;
         common_hal_terminalio_terminal_write(&supervisor_terminal, (const uint8_t *)text, length, &errcode);
+        #endif
     }
     #endif
 
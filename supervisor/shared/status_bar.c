@@ -25,13 +25,19 @@
  */
 
 #include <stdbool.h>
+#include <string.h>
 #include "genhdr/mpversion.h"
 #include "py/mpconfig.h"
+#include "py/misc.h"
+#include "py/mpprint.h"
 #include "shared-bindings/supervisor/__init__.h"
 #include "shared-bindings/supervisor/StatusBar.h"
+#include "shared-bindings/microcontroller/__init__.h"
 #include "supervisor/background_callback.h"
+#include "supervisor/port.h"
 #include "supervisor/serial.h"
 #include "supervisor/shared/status_bar.h"
+#include "supervisor/shared/tick.h"
 
 #if CIRCUITPY_TERMINALIO
 #include "shared-module/terminalio/Terminal.h"
@@ -45,37 +51,113 @@
 #include "supervisor/shared/bluetooth/bluetooth.h"
 #endif
 
-static background_callback_t status_bar_background_cb;
+static background_callback_t status_bar_background_cb = { .priority = BACKGROUND_CALLBACK_PRIORITY_HOUSEKEEPING };
 
 static bool _forced_dirty = false;
 static bool _suspended = false;
 
+static uint64_t _last_update_ticks;
+// Raw tick at which a held back update is looked at again, or 0 if none is
+// waiting. Read by supervisor_status_bar_tick() from the tick interrupt.
+static volatile uint64_t _retry_ticks;
+
+static void _set_retry_ticks(uint64_t ticks) {
+    common_hal_mcu_disable_interrupts();
+    _retry_ticks = ticks;
+    common_hal_mcu_enable_interrupts();
+}
+
+// Hash of the status that the console and display last showed, 0 if unknown.
+// Status that hasn't changed isn't sent again.
+static uint32_t _console_shown;
+static uint32_t _display_shown;
+
+// The status is rendered here before it is sent. An OSC title can be up to 255
+// characters but some may be cut off, so longer status is truncated.
+typedef struct {
+    char buf[255];
+    size_t len;
+} status_bar_text_t;
+
+static void _status_bar_text_strn(void *data, const char *str, size_t len) {
+    status_bar_text_t *text = data;
+    len = MIN(len, sizeof(text->buf) - text->len);
+    memcpy(text->buf + text->len, str, len);
+    text->len += len;
+}
+
+static uint32_t _hash(const char *str, size_t len) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        hash = (hash ^ (uint8_t)str[i]) * 16777619u;
+    }
+    return hash == 0 ? 1 : hash;
+}
+
 // Clear if possible, but give up if we can't do it now.
 void supervisor_status_bar_clear(void) {
     if (!_suspended) {
         serial_write("\x1b" "]0;" "\x1b" "\\");
+        supervisor_status_bar_invalidate();
     }
 }
 
+void supervisor_status_bar_invalidate(void) {
+    _console_shown = 0;
+    _display_shown = 0;
+}
+
 void supervisor_status_bar_update(void) {
     if (_suspended) {
         supervisor_status_bar_request_update(true);
         return;
     }
     _forced_dirty = false;
+    _last_update_ticks = port_get_raw_ticks(NULL);
 
     shared_module_supervisor_status_bar_updated(&shared_module_supervisor_status_bar_obj);
 
+    // Render the status first so that it can be compared with what each sink shows.
+    status_bar_text_t text;
+    text.len = 0;
+    const mp_print_t print = {&text, _status_bar_text_strn};
+    mp_print_str(&print, "🐍");
+
+    #if CIRCUITPY_WEB_WORKFLOW
+    supervisor_web_workflow_status(&print);
+    mp_print_str(&print, " | ");
+    #endif
+
+    #if CIRCUITPY_BLE_FILE_SERVICE || CIRCUITPY_SERIAL_BLE
+    supervisor_bluetooth_status(&print);
+    mp_print_str(&print, " | ");
+    #endif
+
+    supervisor_execution_status(&print);
+    mp_print_str(&print, " | ");
+    mp_print_str(&print, MICROPY_GIT_TAG);
+    uint32_t hash = _hash(text.buf, text.len);
+
     // Disable status bar console writes if supervisor.status_bar.console is False.
     // Also disable if there is no serial connection now. This avoids sending part
     // of the status bar update if the serial connection comes up during the update.
     bool disable_console_writes =
         !shared_module_supervisor_status_bar_get_console(&shared_module_supervisor_status_bar_obj) ||
         !serial_connected();
+    if (disable_console_writes) {
+        // A new connection needs the whole status.
+        _console_shown = 0;
+    }
+    disable_console_writes = disable_console_writes || _console_shown == hash;
 
     // Disable status bar display writes if supervisor.status_bar.display is False.
     bool disable_display_writes =
-        !shared_module_supervisor_status_bar_get_display(&shared_module_supervisor_status_bar_obj);
+        !shared_module_supervisor_status_bar_get_display(&shared_module_supervisor_status_bar_obj) ||
+        _display_shown == hash;
+
+    if (disable_console_writes && disable_display_writes) {
+        return;
+    }
 
     // Suppress writes to console and/or display if status bar is not enabled for either or both.
     bool prev_console_disable = false;
@@ -90,38 +172,34 @@ void supervisor_status_bar_update(void) {
 
     // Neighboring "..." "..." are concatenated by the compiler. Without this separation, the hex code
     // doesn't get terminated after two following characters and the value is invalid.
-    // This is the OSC command to set the title and the icon text. It can be up to 255 characters
-    // but some may be cut off.
+    // This is the OSC command to set the title and the icon text.
     serial_write("\x1b" "]0;");
-    serial_write("🐍");
-
-    #if CIRCUITPY_WEB_WORKFLOW
-    supervisor_web_workflow_status();
-    serial_write(" | ");
-    #endif
-
-    #if CIRCUITPY_BLE_FILE_SERVICE || CIRCUITPY_SERIAL_BLE
-    supervisor_bluetooth_status();
-    serial_write(" | ");
-    #endif
-
-    supervisor_execution_status();
-    serial_write(" | ");
-    serial_write(MICROPY_GIT_TAG);
+    serial_write_substring(text.buf, text.len);
     // Send string terminator
     serial_write("\x1b" "\\");
 
     // Restore writes to console and/or display.
     if (disable_console_writes) {
         serial_console_write_disable(prev_console_disable);
+    } else {
+        _console_shown = hash;
     }
     if (disable_display_writes) {
         serial_display_write_disable(prev_display_disable);
+    } else {
+        _display_shown = hash;
     }
 
 }
 
 static void status_bar_background(void *data) {
+    uint64_t now = port_get_raw_ticks(NULL);
+    if (_retry_ticks != 0 && now >= _retry_ticks) {
+        _set_retry_ticks(0);
+        #if !CIRCUITPY_TICKLESS
+        supervisor_disable_tick();
+        #endif
+    }
     if (_suspended) {
         return;
     }
@@ -135,9 +213,40 @@ static void status_bar_background(void *data) {
     dirty = dirty || supervisor_bluetooth_status_dirty();
     #endif
 
-    if (dirty) {
-        supervisor_status_bar_update();
+    if (!dirty) {
+        return;
+    }
+    uint64_t retry_ticks = _last_update_ticks + CIRCUITPY_STATUS_BAR_MIN_INTERVAL_MS * 1024 / 1000;
+    if (now < retry_ticks) {
+        // Too soon after the last update. Look again once the interval is
+        // over, and send any changes until then together.
+        if (_retry_ticks == 0) {
+            _set_retry_ticks(retry_ticks);
+            #if CIRCUITPY_TICKLESS
+            supervisor_tick_at(retry_ticks);
+            #else
+            supervisor_enable_tick();
+            #endif
+        }
+        return;
+    }
+    supervisor_status_bar_update();
+}
+
+void supervisor_status_bar_tick(void) {
+    uint64_t retry_ticks = _retry_ticks;
+    if (retry_ticks == 0) {
+        return;
     }
+    if (port_get_raw_ticks(NULL) < retry_ticks) {
+        #if CIRCUITPY_TICKLESS
+        // Only the earliest deadline is kept, so ask again.
+        supervisor_tick_at(retry_ticks);
+        #endif
+        return;
+    }
+    // The callback stops the tick.
+    background_callback_add_core(&status_bar_background_cb);
 }
 
 void supervisor_status_bar_start(void) {
@@ -28,6 +28,8 @@
 
 #include <stdbool.h>
 
+#include "py/mpprint.h"
+
 void supervisor_status_bar_init(void);
 
 void supervisor_status_bar_start(void);
@@ -36,6 +38,14 @@ void supervisor_status_bar_resume(void);
 
 void supervisor_status_bar_clear(void);
 
+// Forget what the console and display show, so that the next update is sent
+// to both even if the status hasn't changed.
+void supervisor_status_bar_invalidate(void);
+
+// Called from supervisor_tick() to send an update that was held back by
+// CIRCUITPY_STATUS_BAR_MIN_INTERVAL_MS once the interval is over.
+void supervisor_status_bar_tick(void);
+
 // Update the title bar immediately. Useful from main.c where we know state has changed and the code
 // will only be run once.
 void supervisor_status_bar_update(void);
@@ -45,4 +55,4 @@ void supervisor_status_bar_update(void);
 void supervisor_status_bar_request_update(bool force_dirty);
 
 // Provided by main.c
-void supervisor_execution_status(void);
+void supervisor_execution_status(const mp_print_t *print);
@@ -26,6 +26,8 @@
 
 #include "supervisor/shared/tick.h"
 
+#include <string.h>
+
 #include "shared/runtime/interrupt_char.h"
 #include "py/mphal.h"
 #include "py/mpstate.h"
@@ -39,6 +41,10 @@
 #include "common-hal/_bleio/__init__.h"
 #endif
 
+#if CIRCUITPY_CPU_GOVERNOR
+#include "supervisor/shared/cpu_governor.h"
+#endif
+
 #if CIRCUITPY_DISPLAYIO
 #include "shared-module/displayio/__init__.h"
 #endif
@@ -47,6 +53,22 @@
 #include "shared-module/keypad/__init__.h"
 #endif
 
+#if CIRCUITPY_STATUS_BAR
+#include "supervisor/shared/status_bar.h"
+#endif
+
+#if CIRCUITPY_SUPERVISOR_PROFILE
+#include "shared-module/supervisor/Profiler.h"
+#endif
+
+#if CIRCUITPY_USB_MSC
+#include "supervisor/usb.h"
+#endif
+
+#if CIRCUITPY_USB_MIDI
+#include "shared-module/usb_midi/__init__.h"
+#endif
+
 #include "shared-bindings/microcontroller/__init__.h"
 
 #if CIRCUITPY_WATCHDOG
@@ -58,13 +80,79 @@
 
 static volatile uint64_t PLACE_IN_DTCM_BSS(background_ticks);
 
-static background_callback_t tick_callback;
+// The tick drives display refreshes, so it yields to realtime and I/O work.
+static background_callback_t tick_callback = { .priority = BACKGROUND_CALLBACK_PRIORITY_DISPLAY };
+
+// When the pending tick callback was queued, or 0 when none is pending.
+static volatile uint64_t tick_queued_at;
+
+static uint32_t tick_latency_histogram[SUPERVISOR_TICK_LATENCY_BUCKETS];
 
 static volatile uint64_t last_finished_tick = 0;
 
 static volatile size_t tick_enable_count = 0;
 
+#if CIRCUITPY_TICKLESS
+// Raw tick of the earliest supervisor_tick_at() deadline, or UINT64_MAX.
+static volatile uint64_t tick_deadline = UINT64_MAX;
+// Raw tick that mp_hal_delay_ms() is sleeping until, or UINT64_MAX.
+static volatile uint64_t delay_end = UINT64_MAX;
+
+// Program the port's one-shot wakeup for the earlier of the two. Called with
+// interrupts disabled.
+static void schedule_wakeup(void) {
+    uint64_t wakeup = MIN(tick_deadline, delay_end);
+    if (wakeup == UINT64_MAX) {
+        return;
+    }
+    uint64_t now = port_get_raw_ticks(NULL);
+    port_interrupt_after_ticks(wakeup > now ? MIN(wakeup - now, UINT32_MAX) : 0);
+}
+
+void supervisor_tick_at(uint64_t deadline) {
+    common_hal_mcu_disable_interrupts();
+    if (deadline < tick_deadline) {
+        tick_deadline = deadline;
+        schedule_wakeup();
+    }
+    common_hal_mcu_enable_interrupts();
+}
+
+void supervisor_tick_deadline_interrupt(void) {
+    if (tick_deadline != UINT64_MAX && port_get_raw_ticks(NULL) >= tick_deadline) {
+        tick_deadline = UINT64_MAX;
+        supervisor_tick();
+    }
+    // The wakeup may have been for a delay, for a deadline, or early.
+    schedule_wakeup();
+}
+#endif
+
+static void record_tick_latency(void) {
+    uint64_t queued_at = tick_queued_at;
+    tick_queued_at = 0;
+    if (queued_at == 0) {
+        return;
+    }
+    uint64_t latency = port_get_raw_ticks(NULL) - queued_at;
+    size_t bucket = 0;
+    while (latency > 0 && bucket < SUPERVISOR_TICK_LATENCY_BUCKETS - 1) {
+        latency >>= 1;
+        bucket++;
+    }
+    tick_latency_histogram[bucket]++;
+}
+
+void supervisor_background_tick_latency(uint32_t histogram[SUPERVISOR_TICK_LATENCY_BUCKETS], bool reset) {
+    memcpy(histogram, tick_latency_histogram, sizeof(tick_latency_histogram));
+    if (reset) {
+        memset(tick_latency_histogram, 0, sizeof(tick_latency_histogram));
+    }
+}
+
 static void supervisor_background_tick(void *unused) {
+    record_tick_latency();
+
     port_start_background_tick();
 
     assert_heap_ok();
@@ -77,6 +165,14 @@ static void supervisor_background_tick(void *unused) {
     displayio_background();
     #endif
 
+    #if CIRCUITPY_USB_MSC
+    usb_msc_background();
+    #endif
+
+    #if CIRCUITPY_USB_MIDI
+    usb_midi_background();
+    #endif
+
     filesystem_background();
 
     port_background_tick();
@@ -102,6 +198,17 @@ void supervisor_tick(void) {
     keypad_tick();
     #endif
 
+    #if CIRCUITPY_STATUS_BAR
+    supervisor_status_bar_tick();
+    #endif
+
+    #if CIRCUITPY_SUPERVISOR_PROFILE
+    supervisor_profiler_tick();
+    #endif
+
+    if (tick_queued_at == 0) {
+        tick_queued_at = port_get_raw_ticks(NULL);
+    }
     background_callback_add(&tick_callback, supervisor_background_tick, NULL);
 }
 
@@ -133,11 +240,30 @@ void mp_hal_delay_ms(mp_uint_t delay_ms) {
         if (remaining < 1) {
             break;
         }
+        #if CIRCUITPY_TICKLESS
+        // Sleep to the end of the delay or to the next tick deadline, whichever is first.
+        common_hal_mcu_disable_interrupts();
+        delay_end = end_tick;
+        schedule_wakeup();
+        common_hal_mcu_enable_interrupts();
+        #else
         port_interrupt_after_ticks(remaining);
+        #endif
         // Idle until an interrupt happens.
+        #if CIRCUITPY_CPU_GOVERNOR
+        cpu_governor_idle_begin(remaining);
+        #endif
         port_idle_until_interrupt();
+        #if CIRCUITPY_CPU_GOVERNOR
+        cpu_governor_idle_end();
+        #endif
         remaining = end_tick - port_get_raw_ticks(NULL);
     }
+    #if CIRCUITPY_TICKLESS
+    common_hal_mcu_disable_interrupts();
+    delay_end = UINT64_MAX;
+    common_hal_mcu_enable_interrupts();
+    #endif
 }
 
 void supervisor_enable_tick(void) {
@@ -57,6 +57,21 @@ extern uint64_t supervisor_ticks_ms64(void);
 extern void supervisor_enable_tick(void);
 extern void supervisor_disable_tick(void);
 
+#if CIRCUITPY_TICKLESS
+/**
+ * @brief Ask for supervisor_tick() to run at the given raw tick
+ *
+ * Only the earliest requested deadline is kept, and it is forgotten once it
+ * passes, so callers request their next deadline from supervisor_tick(). Unlike
+ * supervisor_enable_tick(), the CPU only wakes for the deadline. Can be called
+ * from interrupts.
+ */
+extern void supervisor_tick_at(uint64_t deadline);
+
+// Called by the port from the interrupt for port_interrupt_after_ticks().
+extern void supervisor_tick_deadline_interrupt(void);
+#endif
+
 /**
  * @brief Return true if tick-based background tasks ran within the last 1s
  *
@@ -65,4 +80,17 @@ extern void supervisor_disable_tick(void);
  */
 extern bool supervisor_background_ticks_ok(void);
 
+// Bucket 0 counts ticks that started within the raw tick they were queued in.
+// Bucket i counts delays of 2**(i-1) up to 2**i - 1 raw ticks, and the last
+// bucket also counts anything longer.
+#define SUPERVISOR_TICK_LATENCY_BUCKETS (12)
+
+/**
+ * @brief Copy out how long tick-based background tasks waited to run
+ *
+ * Each entry counts the background ticks in one SUPERVISOR_TICK_LATENCY_BUCKETS
+ * bucket since the last reset.
+ */
+extern void supervisor_background_tick_latency(uint32_t histogram[SUPERVISOR_TICK_LATENCY_BUCKETS], bool reset);
+
 #endif
@@ -85,6 +85,10 @@ bool usb_enabled(void) {
 MP_WEAK void post_usb_init(void) {
 }
 
+MP_WEAK bool port_usb_vbus_present(void) {
+    return false;
+}
+
 void usb_init(void) {
 
     usb_identification_t defaults;
@@ -173,6 +177,10 @@ void usb_background(void) {
             // Console will always be itf 0.
             tud_cdc_write_flush();
         }
+        usb_cdc_background();
+        #endif
+        #if CIRCUITPY_USB_HID
+        usb_hid_send_queued_report();
         #endif
     }
 }
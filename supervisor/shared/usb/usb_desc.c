@@ -111,8 +111,8 @@ static const uint8_t configuration_descriptor_template[] = {
 
 static bool usb_build_device_descriptor(const usb_identification_t *identification) {
     device_descriptor =
-        (uint8_t *)port_malloc(sizeof(device_descriptor_template),
-            /*dma_capable*/ false);
+        (uint8_t *)port_malloc_tagged(sizeof(device_descriptor_template),
+            /*dma_capable*/ false, PORT_HEAP_TAG_USB);
     if (device_descriptor == NULL) {
         return false;
     }
@@ -179,8 +179,8 @@ static bool usb_build_configuration_descriptor(void) {
 
     // Now we know how big the configuration descriptor will be, so we can allocate space for it.
     configuration_descriptor =
-        (uint8_t *)port_malloc(total_descriptor_length,
-            /*dma_capable*/ false);
+        (uint8_t *)port_malloc_tagged(total_descriptor_length,
+            /*dma_capable*/ false, PORT_HEAP_TAG_USB);
     if (configuration_descriptor == NULL) {
         return false;
     }
@@ -287,8 +287,8 @@ static bool usb_build_interface_string_table(void) {
     // Allocate space for the le16 String descriptors.
     // Space needed is 2 bytes for String Descriptor header, then 2 bytes for each character
     string_descriptors =
-        port_malloc(current_interface_string * 2 + collected_interface_strings_length * 2,
-            /*dma_capable*/ false);
+        port_malloc_tagged(current_interface_string * 2 + collected_interface_strings_length * 2,
+            /*dma_capable*/ false, PORT_HEAP_TAG_USB);
     if (string_descriptors == NULL) {
         return false;
     }
@@ -37,6 +37,8 @@
 #include "shared-module/storage/__init__.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/shared/reload.h"
+#include "supervisor/shared/tick.h"
+#include "supervisor/usb.h"
 
 #define MSC_FLASH_BLOCK_SIZE    512
 
@@ -47,6 +49,16 @@ static bool ejected[1] = {true};
 static bool _usb_msc_lock = false;
 static bool _usb_connected_while_locked = false;
 
+#if CIRCUITPY_USB_MSC_WRITE_BUFFER_BLOCKS > 0
+// Host writes are gathered here so that contiguous transfers reach the block
+// device as one run. Word aligned so it can be handed straight to flash drivers.
+static uint32_t _write_buffer[CIRCUITPY_USB_MSC_WRITE_BUFFER_BLOCKS * MSC_FLASH_BLOCK_SIZE / sizeof(uint32_t)];
+static uint8_t _write_lun;
+static uint32_t _write_lba;
+static uint32_t _write_block_count = 0;
+static uint32_t _last_write_ms;
+#endif
+
 STATIC void _usb_msc_uneject(void) {
     for (uint8_t i = 0; i < sizeof(ejected); i++) {
         ejected[i] = false;
@@ -65,6 +77,7 @@ void usb_msc_mount(void) {
 }
 
 void usb_msc_umount(void) {
+    usb_msc_flush_writes();
 }
 
 bool usb_msc_ejected(void) {
@@ -111,6 +124,108 @@ static fs_user_mount_t *get_vfs(int lun) {
     return current_mount->obj;
 }
 
+// Count the unallocated clusters whose FAT entries are in the given sector of the first FAT.
+STATIC uint32_t _free_fat_entries(FATFS *fs, DWORD sector, const uint8_t *data) {
+    const uint32_t entry_size = fs->fs_type == FS_FAT16 ? 2 : 4;
+    const uint32_t entries_per_sector = MSC_FLASH_BLOCK_SIZE / entry_size;
+    const uint32_t first_cluster = (sector - fs->fatbase) * entries_per_sector;
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < entries_per_sector; i++) {
+        uint32_t cluster = first_cluster + i;
+        // Entries 0 and 1 are reserved, and the end of the last sector is padding.
+        if (cluster < 2 || cluster >= fs->n_fatent) {
+            continue;
+        }
+        const uint8_t *entry = data + i * entry_size;
+        uint32_t value = entry[0] | (entry[1] << 8);
+        if (entry_size == 4) {
+            value |= (entry[2] << 16) | ((entry[3] & 0x0f) << 24);
+        }
+        if (value == 0) {
+            count++;
+        }
+    }
+    return count;
+}
+
+// The host edits the FAT behind FatFs' back. Keep FatFs' free cluster count, which it
+// otherwise only gets by scanning the whole FAT, in step with what each written FAT sector
+// frees or allocates. This must be called while the device still holds the old contents.
+STATIC void _update_free_clusters(fs_user_mount_t *vfs, uint32_t lba, const uint8_t *buffer, uint32_t block_count) {
+    FATFS *fs = &vfs->fatfs;
+    if (fs->fs_type == 0 || fs->free_clst > fs->n_fatent - 2) {
+        // Not mounted, or the count isn't known yet.
+        return;
+    }
+    const DWORD fat_end = fs->fatbase + fs->fsize;
+    if (lba >= fat_end || lba + block_count <= fs->fatbase) {
+        return;
+    }
+    // FAT12 entries straddle sectors and exFAT keeps a bitmap instead. Those rescan.
+    bool countable = fs->fs_type == FS_FAT16 || fs->fs_type == FS_FAT32;
+    #if FF_MAX_SS != FF_MIN_SS
+    countable = countable && fs->ssize == MSC_FLASH_BLOCK_SIZE;
+    #endif
+    int32_t change = 0;
+    for (uint32_t i = 0; i < block_count && countable; i++) {
+        DWORD sector = lba + i;
+        if (sector < fs->fatbase || sector >= fat_end) {
+            continue;
+        }
+        uint8_t old[MSC_FLASH_BLOCK_SIZE];
+        if (disk_read(vfs, old, sector, 1) != RES_OK) {
+            countable = false;
+            break;
+        }
+        change += _free_fat_entries(fs, sector, buffer + i * MSC_FLASH_BLOCK_SIZE);
+        change -= _free_fat_entries(fs, sector, old);
+    }
+    int64_t free_clusters = (int64_t)fs->free_clst + change;
+    if (!countable || free_clusters < 0 || free_clusters > fs->n_fatent - 2) {
+        fs->free_clst = 0xFFFFFFFF;
+        return;
+    }
+    fs->free_clst = free_clusters;
+}
+
+#if CIRCUITPY_USB_MSC_WRITE_BUFFER_BLOCKS > 0
+// Pass the gathered run to the block device. Autoreload stays suspended until
+// usb_msc_flush_writes() so a reload can't start with host data still held.
+STATIC void _write_buffered_blocks(void) {
+    if (_write_block_count == 0) {
+        return;
+    }
+    fs_user_mount_t *vfs = get_vfs(_write_lun);
+    if (vfs != NULL) {
+        disk_write(vfs, (uint8_t *)_write_buffer, _write_lba, _write_block_count);
+    }
+    _write_block_count = 0;
+    // Ticks were enabled when the first block was buffered.
+    supervisor_disable_tick();
+}
+#endif
+
+void usb_msc_flush_writes(void) {
+    #if CIRCUITPY_USB_MSC_WRITE_BUFFER_BLOCKS > 0
+    if (_write_block_count == 0) {
+        return;
+    }
+    _write_buffered_blocks();
+    // The host's writes have now all landed; initiate an autoreload.
+    autoreload_resume(AUTORELOAD_SUSPEND_USB);
+    autoreload_trigger();
+    #endif
+}
+
+void usb_msc_background(void) {
+    #if CIRCUITPY_USB_MSC_WRITE_BUFFER_BLOCKS > 0
+    if (_write_block_count > 0 &&
+        supervisor_ticks_ms32() - _last_write_ms >= CIRCUITPY_USB_MSC_WRITE_FLUSH_DELAY_MS) {
+        usb_msc_flush_writes();
+    }
+    #endif
+}
+
 // Callback invoked when received an SCSI command not in built-in list below
 // - READ_CAPACITY10, READ_FORMAT_CAPACITY, INQUIRY, TEST_UNIT_READY, START_STOP_UNIT, MODE_SENSE6, REQUEST_SENSE
 // - READ10 and WRITE10 have their own callbacks
@@ -120,7 +235,11 @@ int32_t tud_msc_scsi_cb(uint8_t lun, const uint8_t scsi_cmd[16], void *buffer, u
 
     switch (scsi_cmd[0]) {
         case SCSI_CMD_PREVENT_ALLOW_MEDIUM_REMOVAL:
-            // Host is about to read/write etc ... better not to disconnect disk
+            // Host is about to read/write etc ... better not to disconnect disk.
+            // Allowing removal means it is done, so don't hold on to its data.
+            if ((scsi_cmd[4] & 0x3) == 0) {
+                usb_msc_flush_writes();
+            }
             resplen = 0;
             break;
 
@@ -174,6 +293,14 @@ int32_t tud_msc_read10_cb(uint8_t lun, uint32_t lba, uint32_t offset, void *buff
 
     const uint32_t block_count = bufsize / MSC_FLASH_BLOCK_SIZE;
 
+    #if CIRCUITPY_USB_MSC_WRITE_BUFFER_BLOCKS > 0
+    // Make sure the host reads back what it wrote.
+    if (_write_block_count > 0 && lun == _write_lun &&
+        lba < _write_lba + _write_block_count && _write_lba < lba + block_count) {
+        usb_msc_flush_writes();
+    }
+    #endif
+
     fs_user_mount_t *vfs = get_vfs(lun);
     disk_read(vfs, buffer, lba, block_count);
 
@@ -190,7 +317,41 @@ int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *
     const uint32_t block_count = bufsize / MSC_FLASH_BLOCK_SIZE;
 
     fs_user_mount_t *vfs = get_vfs(lun);
+    #if CIRCUITPY_USB_MSC_WRITE_BUFFER_BLOCKS > 0
+    // Start a new run unless this continues the buffered one.
+    if (_write_block_count > 0 && (lun != _write_lun || lba != _write_lba + _write_block_count)) {
+        _write_buffered_blocks();
+    }
+    // A continued run starts past the buffered blocks, so the device has the old contents.
+    if (vfs != NULL) {
+        _update_free_clusters(vfs, lba, buffer, block_count);
+    }
+    uint32_t next_lba = lba;
+    const uint8_t *next = buffer;
+    uint32_t remaining = block_count;
+    while (remaining > 0) {
+        if (_write_block_count == 0) {
+            // Keep ticks going so the run is written once the host goes idle.
+            supervisor_enable_tick();
+            _write_lun = lun;
+            _write_lba = next_lba;
+        }
+        uint32_t count = MIN(remaining, CIRCUITPY_USB_MSC_WRITE_BUFFER_BLOCKS - _write_block_count);
+        memcpy((uint8_t *)_write_buffer + _write_block_count * MSC_FLASH_BLOCK_SIZE, next,
+            count * MSC_FLASH_BLOCK_SIZE);
+        _write_block_count += count;
+        next_lba += count;
+        next += count * MSC_FLASH_BLOCK_SIZE;
+        remaining -= count;
+        if (_write_block_count == CIRCUITPY_USB_MSC_WRITE_BUFFER_BLOCKS) {
+            _write_buffered_blocks();
+        }
+    }
+    _last_write_ms = supervisor_ticks_ms32();
+    #else
+    _update_free_clusters(vfs, lba, buffer, block_count);
     disk_write(vfs, buffer, lba, block_count);
+    #endif
     // Since by getting here we assume the mount is read-only to
     // MicroPython let's update the cached FatFs sector if it's the one
     // we just wrote.
@@ -215,6 +376,13 @@ int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *
 void tud_msc_write10_complete_cb(uint8_t lun) {
     (void)lun;
 
+    #if CIRCUITPY_USB_MSC_WRITE_BUFFER_BLOCKS > 0
+    if (_write_block_count > 0) {
+        // usb_msc_flush_writes() will trigger the autoreload once the host is idle.
+        return;
+    }
+    #endif
+
     // This write is complete; initiate an autoreload.
     autoreload_resume(AUTORELOAD_SUSPEND_USB);
     autoreload_trigger();
@@ -264,6 +432,7 @@ bool tud_msc_start_stop_cb(uint8_t lun, uint8_t power_condition, bool start, boo
     if (load_eject) {
         if (!start) {
             // Eject but first flush.
+            usb_msc_flush_writes();
             if (disk_ioctl(current_mount, CTRL_SYNC, NULL) != RES_OK) {
                 return false;
             } else {
@@ -276,6 +445,7 @@ bool tud_msc_start_stop_cb(uint8_t lun, uint8_t power_condition, bool start, boo
     } else {
         if (!start) {
             // Stop the unit but don't eject.
+            usb_msc_flush_writes();
             if (disk_ioctl(current_mount, CTRL_SYNC, NULL) != RES_OK) {
                 return false;
             }
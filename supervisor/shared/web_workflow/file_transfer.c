@@ -0,0 +1,549 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <string.h>
+
+#include "extmod/vfs.h"
+#include "extmod/vfs_fat.h"
+#include "py/mpconfig.h"
+#include "py/misc.h"
+#include "shared/timeutils/timeutils.h"
+#include "shared-module/storage/__init__.h"
+
+#include "supervisor/fatfs.h"
+#include "supervisor/filesystem.h"
+#include "supervisor/shared/bluetooth/file_transfer_protocol.h"
+#include "supervisor/shared/reload.h"
+#include "supervisor/shared/web_workflow/file_transfer.h"
+#include "supervisor/shared/web_workflow/websocket.h"
+#include "supervisor/shared/workflow.h"
+#include "supervisor/usb.h"
+
+// The commands and replies are the BLE file transfer protocol's. Each binary
+// WebSocket message holds exactly one complete command or reply, so there is no
+// need to wait for more of a command. Chunks of a file are addressed by offset so
+// the client may have several READ_PACING or WRITE_DATA messages outstanding at
+// once. They are answered in the order they are received.
+
+#define CHUNK_SIZE CIRCUITPY_WEB_WORKFLOW_FILE_TRANSFER_CHUNK_SIZE
+// TCP flow control keeps anything more from being lost so this only needs to be
+// enough to cover the TCP window.
+#define WRITE_CREDITS (4)
+
+// Used by read and write.
+STATIC FIL active_file;
+STATIC enum {
+    TRANSFER_NONE,
+    TRANSFER_READ,
+    TRANSFER_WRITE,
+} _transfer = TRANSFER_NONE;
+// Used by write and write data to know when the write is complete.
+STATIC size_t total_write_length;
+STATIC uint64_t _truncated_time;
+
+// FATFS has a two second timestamp resolution but the protocol allows for nanosecond resolution.
+// This function truncates the time the time to a resolution storable by FATFS and fills in the
+// FATFS encoded version into fattime.
+STATIC uint64_t truncate_time(uint64_t input_time, DWORD *fattime) {
+    timeutils_struct_time_t tm;
+    uint64_t seconds_since_epoch = timeutils_seconds_since_epoch_from_nanoseconds_since_1970(input_time);
+    timeutils_seconds_since_epoch_to_struct_time(seconds_since_epoch, &tm);
+    uint64_t truncated_time = timeutils_nanoseconds_since_epoch_to_nanoseconds_since_1970((seconds_since_epoch / 2) * 2 * 1000000000);
+
+    *fattime = ((tm.tm_year - 1980) << 25) | (tm.tm_mon << 21) | (tm.tm_mday << 16) |
+        (tm.tm_hour << 11) | (tm.tm_min << 5) | (tm.tm_sec >> 1);
+    return truncated_time;
+}
+
+STATIC void _send(const void *response, size_t response_size) {
+    websocket_write_binary((const uint8_t *)response, response_size);
+}
+
+// Replies are the command plus one except for the pacing commands that share a
+// reply with the command they continue.
+STATIC void _send_protocol_error(uint8_t command) {
+    uint8_t response[2];
+    if (command == READ_PACING) {
+        response[0] = READ_DATA;
+    } else if (command == WRITE_DATA) {
+        response[0] = WRITE_PACING;
+    } else {
+        response[0] = command + 1;
+    }
+    response[1] = STATUS_ERROR_PROTOCOL;
+    _send(response, sizeof(response));
+}
+
+// Returns true if usb is active and replies with an error if so. If not, it grabs
+// the USB mass storage lock and returns false. Make sure to release the lock with
+// usb_msc_unlock() when the transaction is complete.
+STATIC bool _usb_active(void *response, size_t response_size) {
+    // Check to see if USB has already been mounted. If not, then we "eject" from USB until we're done.
+    #if CIRCUITPY_USB && CIRCUITPY_USB_MSC
+    if (storage_usb_enabled() && !usb_msc_lock()) {
+        // Status is always the second byte of the response.
+        ((uint8_t *)response)[1] = STATUS_ERROR_READONLY;
+        _send(response, response_size);
+        return true;
+    }
+    #endif
+    return false;
+}
+
+STATIC void _finish_write(void) {
+    f_close(&active_file);
+    override_fattime(0);
+    #if CIRCUITPY_USB_MSC
+    usb_msc_unlock();
+    #endif
+    autoreload_resume(AUTORELOAD_SUSPEND_WEBSOCKET);
+    _transfer = TRANSFER_NONE;
+}
+
+void web_workflow_file_transfer_reset(void) {
+    if (_transfer == TRANSFER_WRITE) {
+        _finish_write();
+    } else if (_transfer == TRANSFER_READ) {
+        f_close(&active_file);
+        _transfer = TRANSFER_NONE;
+    }
+}
+
+// Reply with one chunk of the file being read. The reply is built in the message
+// buffer so that it goes out as a single message.
+STATIC void _send_read_data(uint8_t *buf, uint32_t offset, uint32_t chunk_size) {
+    struct read_data *response = (struct read_data *)buf;
+    uint32_t total_length = f_size(&active_file);
+    if (offset > total_length) {
+        offset = total_length;
+    }
+    chunk_size = MIN(MIN(chunk_size, CHUNK_SIZE), total_length - offset);
+    UINT quantity_read = 0;
+    FRESULT result = f_lseek(&active_file, offset);
+    if (result == FR_OK) {
+        result = f_read(&active_file, response->data, chunk_size, &quantity_read);
+    }
+    response->command = READ_DATA;
+    response->status = result == FR_OK ? STATUS_OK : STATUS_ERROR;
+    response->reserved = 0;
+    response->chunk_offset = offset;
+    response->total_length = total_length;
+    // A file shortened under us gives a short chunk.
+    response->data_size = quantity_read;
+    _send(response, sizeof(struct read_data) + quantity_read);
+    if (result != FR_OK || offset + quantity_read >= total_length) {
+        f_close(&active_file);
+        _transfer = TRANSFER_NONE;
+    }
+}
+
+STATIC void _process_read(uint8_t *buf, size_t command_len) {
+    const struct read_command *command = (struct read_command *)buf;
+    size_t header_size = sizeof(struct read_command);
+    if (command_len < header_size || command_len < header_size + command->path_length) {
+        _send_protocol_error(READ);
+        return;
+    }
+    web_workflow_file_transfer_reset();
+
+    char *path = (char *)command->path;
+    path[command->path_length] = '\0';
+    uint32_t offset = command->chunk_offset;
+    uint32_t chunk_size = command->chunk_size;
+
+    FATFS *fs = filesystem_circuitpy();
+    FRESULT result = f_open(fs, &active_file, path, FA_READ);
+    if (result != FR_OK) {
+        struct read_data response;
+        response.command = READ_DATA;
+        response.status = STATUS_ERROR;
+        response.reserved = 0;
+        response.chunk_offset = 0;
+        response.total_length = 0;
+        response.data_size = 0;
+        _send(&response, sizeof(struct read_data));
+        return;
+    }
+    _transfer = TRANSFER_READ;
+    _send_read_data(buf, offset, chunk_size);
+}
+
+STATIC void _process_read_pacing(uint8_t *buf, size_t command_len) {
+    const struct read_pacing *command = (struct read_pacing *)buf;
+    if (command_len < sizeof(struct read_pacing) || _transfer != TRANSFER_READ) {
+        _send_protocol_error(READ_PACING);
+        return;
+    }
+    _send_read_data(buf, command->chunk_offset, command->chunk_size);
+}
+
+STATIC void _process_write(uint8_t *buf, size_t command_len) {
+    struct write_command *command = (struct write_command *)buf;
+    size_t header_size = sizeof(struct write_command);
+    struct write_pacing response;
+    response.command = WRITE_PACING;
+    response.status = STATUS_OK;
+    response.credits = WRITE_CREDITS;
+    response.offset = 0;
+    response.truncated_time = 0;
+    response.free_space = 0;
+    if (command_len < header_size || command_len < header_size + command->path_length) {
+        _send_protocol_error(WRITE);
+        return;
+    }
+    web_workflow_file_transfer_reset();
+
+    char *path = (char *)command->path;
+    path[command->path_length] = '\0';
+    if (_usb_active(&response, sizeof(struct write_pacing))) {
+        return;
+    }
+
+    FATFS *fs = filesystem_circuitpy();
+    DWORD fattime;
+    _truncated_time = truncate_time(command->modification_time, &fattime);
+    override_fattime(fattime);
+    FRESULT result = f_open(fs, &active_file, path, FA_WRITE | FA_OPEN_ALWAYS);
+    if (result != FR_OK) {
+        response.status = STATUS_ERROR;
+        _send(&response, sizeof(struct write_pacing));
+        #if CIRCUITPY_USB_MSC
+        usb_msc_unlock();
+        #endif
+        override_fattime(0);
+        return;
+    }
+    autoreload_suspend(AUTORELOAD_SUSPEND_WEBSOCKET);
+    _transfer = TRANSFER_WRITE;
+    total_write_length = command->total_length;
+
+    uint32_t offset = MIN(command->offset, total_write_length);
+    size_t chunk_size = MIN(total_write_length - offset, CHUNK_SIZE);
+    response.offset = offset;
+    response.free_space = chunk_size;
+    response.truncated_time = _truncated_time;
+    // Special case when truncating the file. (Deleting stuff off the end.)
+    if (chunk_size == 0) {
+        f_lseek(&active_file, offset);
+        f_truncate(&active_file);
+        _finish_write();
+    }
+    _send(&response, sizeof(struct write_pacing));
+    if (chunk_size == 0) {
+        autoreload_trigger();
+    }
+}
+
+STATIC void _process_write_data(uint8_t *buf, size_t command_len) {
+    const struct write_data *command = (struct write_data *)buf;
+    size_t header_size = sizeof(struct write_data);
+    struct write_pacing response;
+    response.command = WRITE_PACING;
+    response.status = STATUS_OK;
+    response.credits = WRITE_CREDITS;
+    response.truncated_time = _truncated_time;
+    if (command_len < header_size ||
+        command_len < header_size + command->data_size ||
+        _transfer != TRANSFER_WRITE) {
+        _send_protocol_error(WRITE_DATA);
+        return;
+    }
+    uint32_t offset = command->offset;
+    response.offset = offset;
+    response.free_space = 0;
+    if (offset > total_write_length || command->data_size > total_write_length - offset) {
+        // Past the length given by WRITE.
+        response.status = STATUS_ERROR_PROTOCOL;
+        _send(&response, sizeof(struct write_pacing));
+        return;
+    }
+    UINT actual = 0;
+    FRESULT result = f_lseek(&active_file, offset);
+    if (result == FR_OK) {
+        result = f_write(&active_file, command->data, command->data_size, &actual);
+    }
+    if (result != FR_OK || actual < command->data_size) {
+        _finish_write();
+        response.status = STATUS_ERROR;
+        _send(&response, sizeof(struct write_pacing));
+        return;
+    }
+    offset += command->data_size;
+    response.offset = offset;
+    response.free_space = MIN(total_write_length - offset, CHUNK_SIZE);
+    if (offset == total_write_length) {
+        f_truncate(&active_file);
+        _finish_write();
+    }
+    _send(&response, sizeof(struct write_pacing));
+    if (offset == total_write_length) {
+        autoreload_trigger();
+    }
+}
+
+STATIC void _process_delete(uint8_t *buf, size_t command_len) {
+    const struct delete_command *command = (struct delete_command *)buf;
+    size_t header_size = sizeof(struct delete_command);
+    struct delete_status response;
+    response.command = DELETE_STATUS;
+    response.status = STATUS_OK;
+    if (command_len < header_size || command_len < header_size + command->path_length) {
+        _send_protocol_error(DELETE);
+        return;
+    }
+    // An open write holds the USB lock. End it before taking the lock again.
+    web_workflow_file_transfer_reset();
+    if (_usb_active(&response, sizeof(struct delete_status))) {
+        return;
+    }
+    FATFS *fs = filesystem_circuitpy();
+    char *path = (char *)command->path;
+    path[command->path_length] = '\0';
+    FILINFO file;
+    FRESULT result = f_stat(fs, path, &file);
+    if (result == FR_OK) {
+        if ((file.fattrib & AM_DIR) != 0) {
+            result = supervisor_workflow_delete_directory_contents(fs, path);
+        }
+        if (result == FR_OK) {
+            result = f_unlink(fs, path);
+        }
+    }
+    #if CIRCUITPY_USB_MSC
+    usb_msc_unlock();
+    #endif
+    if (result != FR_OK) {
+        response.status = STATUS_ERROR;
+    }
+    _send(&response, sizeof(struct delete_status));
+    if (result == FR_OK) {
+        autoreload_trigger();
+    }
+}
+
+// NULL-terminate the path and remove any trailing /. Older versions of the
+// protocol require it but newer ones do not.
+STATIC void _terminate_path(char *path, size_t path_length) {
+    // -1 because fatfs doesn't want a trailing /
+    if (path_length > 0 && path[path_length - 1] == '/') {
+        path[path_length - 1] = '\0';
+    } else {
+        path[path_length] = '\0';
+    }
+}
+
+STATIC void _process_mkdir(uint8_t *buf, size_t command_len) {
+    const struct mkdir_command *command = (struct mkdir_command *)buf;
+    size_t header_size = sizeof(struct mkdir_command);
+    struct mkdir_status response;
+    response.command = MKDIR_STATUS;
+    response.status = STATUS_OK;
+    response.reserved = 0;
+    response.reserved2 = 0;
+    response.truncated_time = 0;
+    if (command_len < header_size || command_len < header_size + command->path_length) {
+        _send_protocol_error(MKDIR);
+        return;
+    }
+    web_workflow_file_transfer_reset();
+    if (_usb_active(&response, sizeof(struct mkdir_status))) {
+        return;
+    }
+    FATFS *fs = filesystem_circuitpy();
+    char *path = (char *)command->path;
+    _terminate_path(path, command->path_length);
+
+    DWORD fattime;
+    response.truncated_time = truncate_time(command->modification_time, &fattime);
+    override_fattime(fattime);
+    FRESULT result = supervisor_workflow_mkdir_parents(fs, path);
+    override_fattime(0);
+    #if CIRCUITPY_USB_MSC
+    usb_msc_unlock();
+    #endif
+    if (result != FR_OK) {
+        response.status = STATUS_ERROR;
+    }
+    _send(&response, sizeof(struct mkdir_status));
+    if (result == FR_OK) {
+        autoreload_trigger();
+    }
+}
+
+STATIC void _process_listdir(uint8_t *buf, size_t command_len) {
+    const struct listdir_command *command = (struct listdir_command *)buf;
+    size_t header_size = sizeof(struct listdir_command);
+    if (command_len < header_size || command_len < header_size + command->path_length) {
+        _send_protocol_error(LISTDIR);
+        return;
+    }
+
+    FATFS *fs = filesystem_circuitpy();
+    char *path = (char *)command->path;
+    _terminate_path(path, command->path_length);
+    FF_DIR dir;
+    FRESULT res = f_opendir(fs, &dir, path);
+
+    // We reuse the command buffer so that each entry and its name go out as one
+    // message. The path isn't needed after opening the directory.
+    struct listdir_entry *entry = (struct listdir_entry *)buf;
+    entry->command = LISTDIR_ENTRY;
+    entry->status = STATUS_OK;
+    entry->path_length = 0;
+    entry->entry_number = 0;
+    entry->entry_count = 0;
+    entry->flags = 0;
+    entry->truncated_time = 0;
+    entry->file_size = 0;
+
+    if (res != FR_OK) {
+        entry->status = STATUS_ERROR_NO_FILE;
+        _send(entry, sizeof(struct listdir_entry));
+        return;
+    }
+    FILINFO file_info;
+    res = f_readdir(&dir, &file_info);
+    char *fn = file_info.fname;
+    size_t total_entries = 0;
+    while (res == FR_OK && fn[0] != 0) {
+        res = f_readdir(&dir, &file_info);
+        total_entries += 1;
+    }
+    // Rewind the directory.
+    f_readdir(&dir, NULL);
+    entry->entry_count = total_entries;
+    for (size_t i = 0; i < total_entries; i++) {
+        res = f_readdir(&dir, &file_info);
+        entry->entry_number = i;
+        uint64_t truncated_time = timeutils_mktime(1980 + (file_info.fdate >> 9),
+            (file_info.fdate >> 5) & 0xf,
+            file_info.fdate & 0x1f,
+            file_info.ftime >> 11,
+            (file_info.ftime >> 5) & 0x1f,
+            (file_info.ftime & 0x1f) * 2) * 1000000000ULL;
+        entry->truncated_time = truncated_time;
+        if ((file_info.fattrib & AM_DIR) != 0) {
+            entry->flags = 1; // Directory
+            entry->file_size = 0;
+        } else {
+            entry->flags = 0;
+            entry->file_size = file_info.fsize;
+        }
+
+        size_t name_length = strlen(file_info.fname);
+        entry->path_length = name_length;
+        memcpy(entry->path, file_info.fname, name_length);
+        _send(entry, sizeof(struct listdir_entry) + name_length);
+    }
+    f_closedir(&dir);
+    entry->path_length = 0;
+    entry->entry_number = entry->entry_count;
+    entry->flags = 0;
+    entry->file_size = 0;
+    _send(entry, sizeof(struct listdir_entry));
+}
+
+STATIC void _process_move(uint8_t *buf, size_t command_len) {
+    const struct move_command *command = (struct move_command *)buf;
+    size_t header_size = sizeof(struct move_command);
+    struct move_status response;
+    response.command = MOVE_STATUS;
+    response.status = STATUS_OK;
+    if (command_len < header_size) {
+        _send_protocol_error(MOVE);
+        return;
+    }
+    // +1 for the reserved byte between the paths.
+    uint32_t total_path_length = command->old_path_length + command->new_path_length + 1;
+    if (command_len < header_size + total_path_length) {
+        _send_protocol_error(MOVE);
+        return;
+    }
+    web_workflow_file_transfer_reset();
+    if (_usb_active(&response, sizeof(struct move_status))) {
+        return;
+    }
+    FATFS *fs = filesystem_circuitpy();
+    char *old_path = (char *)command->paths;
+    old_path[command->old_path_length] = '\0';
+
+    char *new_path = old_path + command->old_path_length + 1;
+    new_path[command->new_path_length] = '\0';
+
+    FRESULT result = f_rename(fs, old_path, new_path);
+    #if CIRCUITPY_USB_MSC
+    usb_msc_unlock();
+    #endif
+    if (result != FR_OK) {
+        response.status = STATUS_ERROR;
+    }
+    _send(&response, sizeof(struct move_status));
+    if (result == FR_OK) {
+        autoreload_trigger();
+    }
+}
+
+void web_workflow_file_transfer_process(uint8_t *message, size_t message_len) {
+    if (message_len == 0) {
+        return;
+    }
+    uint8_t command = message[0];
+    // Leave room to null terminate a path at the very end.
+    if (message_len >= WEB_WORKFLOW_FILE_TRANSFER_MESSAGE_SIZE) {
+        _send_protocol_error(command);
+        return;
+    }
+    switch (command) {
+        case READ:
+            _process_read(message, message_len);
+            break;
+        case READ_PACING:
+            _process_read_pacing(message, message_len);
+            break;
+        case WRITE:
+            _process_write(message, message_len);
+            break;
+        case WRITE_DATA:
+            _process_write_data(message, message_len);
+            break;
+        case DELETE:
+            _process_delete(message, message_len);
+            break;
+        case MKDIR:
+            _process_mkdir(message, message_len);
+            break;
+        case LISTDIR:
+            _process_listdir(message, message_len);
+            break;
+        case MOVE:
+            _process_move(message, message_len);
+            break;
+        default:
+            _send_protocol_error(command);
+            break;
+    }
+}
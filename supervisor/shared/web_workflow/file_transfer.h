@@ -0,0 +1,49 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2023 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Largest piece of a file carried by one binary WebSocket message.
+#ifndef CIRCUITPY_WEB_WORKFLOW_FILE_TRANSFER_CHUNK_SIZE
+#define CIRCUITPY_WEB_WORKFLOW_FILE_TRANSFER_CHUNK_SIZE (1024)
+#endif
+
+// A chunk plus the largest message header (READ_DATA's 16 bytes) and a spare byte
+// to null terminate paths in place.
+#define WEB_WORKFLOW_FILE_TRANSFER_MESSAGE_SIZE (CIRCUITPY_WEB_WORKFLOW_FILE_TRANSFER_CHUNK_SIZE + 16 + 1)
+
+// Handle one file transfer command received as a binary WebSocket message. The
+// message buffer is WEB_WORKFLOW_FILE_TRANSFER_MESSAGE_SIZE long and is reused for
+// the reply. message_len is the full length received and may be larger than the
+// buffer, in which case only the start of the message was kept.
+void web_workflow_file_transfer_process(uint8_t *message, size_t message_len);
+
+// Close any file left open by an unfinished transfer.
+void web_workflow_file_transfer_reset(void);
@@ -33,6 +33,7 @@
 #include "extmod/vfs.h"
 #include "extmod/vfs_fat.h"
 #include "genhdr/mpversion.h"
+#include "py/gc.h"
 #include "py/mperrno.h"
 #include "py/mpstate.h"
 #include "py/stackctrl.h"
@@ -43,12 +44,15 @@
 #include "supervisor/fatfs.h"
 #include "supervisor/filesystem.h"
 #include "supervisor/port.h"
+#include "supervisor/shared/boot_timeline.h"
 #include "supervisor/shared/reload.h"
+#include "supervisor/shared/tick.h"
 #include "supervisor/shared/translate/translate.h"
 #include "supervisor/shared/web_workflow/web_workflow.h"
 #include "supervisor/shared/web_workflow/websocket.h"
 #include "supervisor/shared/workflow.h"
 #include "supervisor/usb.h"
+#include "supervisor/workflow.h"
 
 #include "shared-bindings/hashlib/__init__.h"
 #include "shared-bindings/hashlib/Hash.h"
@@ -100,14 +104,39 @@ typedef struct {
     bool expect;
     bool json;
     bool websocket;
-    bool new_socket;
+    // Whether to leave the connection open for another request afterwards.
+    bool keep_alive;
+    bool body_read;
+    // Set by a "Range: bytes=" header. range_end is inclusive.
+    bool range;
+    bool range_suffix;
+    uint32_t range_start;
+    uint32_t range_end;
+    // Validators from "If-None-Match" and "If-Modified-Since", in seconds since 1970.
+    char if_none_match[64];
+    uint64_t if_modified_since;
     uint32_t websocket_version;
     // RFC6455 for websockets says this header should be 24 base64 characters long.
     char websocket_key[24 + 1];
+    // When the connection was accepted or last started or finished a request.
+    // Not cleared between requests.
+    uint64_t last_active_ms;
 } _request;
 
+typedef struct {
+    socketpool_socket_obj_t socket;
+    _request request;
+} _client;
+
 static wifi_radio_error_t _wifi_status = WIFI_RADIO_ERROR_NONE;
 
+// The Wi-Fi connection is made in the background so that code.py doesn't wait on
+// association and DHCP. The rest of the web workflow starts once it is up.
+static bool _wifi_connecting = false;
+static bool _reload_when_connected;
+static uint64_t _wifi_connect_deadline_ms;
+#define WIFI_CONNECT_TIMEOUT_MS (8000)
+
 #if CIRCUITPY_STATUS_BAR
 // Store various last states to compute if status bar needs an update.
 static bool _last_enabled = false;
@@ -121,11 +150,43 @@ static mdns_server_obj_t mdns;
 
 static mp_int_t web_api_port = 80;
 
+// Bytes read from a file and sent per socket send. Multiples of the sector
+// size let FatFs read straight into the buffer instead of through its window.
+#ifndef CIRCUITPY_WEB_WORKFLOW_FILE_CHUNK_SIZE
+#define CIRCUITPY_WEB_WORKFLOW_FILE_CHUNK_SIZE (1024)
+#endif
+
+// File download totals reported in version.json. They wrap at 32 bits because
+// printing 64 bit numbers isn't supported everywhere.
+static uint32_t _file_bytes_sent = 0;
+static uint32_t _file_send_ms = 0;
+
+// Connections served at once. Browsers open several connections at a time and
+// keep them open between requests.
+#ifndef CIRCUITPY_WEB_WORKFLOW_CLIENTS
+#define CIRCUITPY_WEB_WORKFLOW_CLIENTS (3)
+#endif
+
+// Idle connections are closed after this long so that their sockets can be reused.
+#ifndef CIRCUITPY_WEB_WORKFLOW_KEEP_ALIVE_MS
+#define CIRCUITPY_WEB_WORKFLOW_KEEP_ALIVE_MS (10000)
+#endif
+
+// Time spent serving connections in one background call before letting the VM run.
+#ifndef CIRCUITPY_WEB_WORKFLOW_TIME_BUDGET_MS
+#define CIRCUITPY_WEB_WORKFLOW_TIME_BUDGET_MS (50)
+#endif
+
 static socketpool_socketpool_obj_t pool;
 static socketpool_socket_obj_t listening;
-static socketpool_socket_obj_t active;
 
-static _request active_request;
+static _client clients[CIRCUITPY_WEB_WORKFLOW_CLIENTS];
+// The client to serve first next time, so that each gets a turn.
+static size_t _next_client = 0;
+// Autoreload is suspended while any request is in progress.
+static size_t _requests_in_progress = 0;
+
+static void _close_client(_client *client);
 
 static char _api_password[64];
 static char web_instance_name[50];
@@ -224,36 +285,36 @@ bool supervisor_web_workflow_status_dirty(void) {
 #endif
 
 #if CIRCUITPY_STATUS_BAR
-void supervisor_web_workflow_status(void) {
+void supervisor_web_workflow_status(const mp_print_t *print) {
     _last_enabled = common_hal_wifi_radio_get_enabled(&common_hal_wifi_radio_obj);
     if (_last_enabled) {
         uint32_t ipv4_address = wifi_radio_get_ipv4_address(&common_hal_wifi_radio_obj);
         if (ipv4_address != 0) {
             _update_encoded_ip();
             _last_ip = _encoded_ip;
-            mp_printf(&mp_plat_print, "%s", _our_ip_encoded);
+            mp_printf(print, "%s", _our_ip_encoded);
             if (web_api_port != 80) {
-                mp_printf(&mp_plat_print, ":%d", web_api_port);
+                mp_printf(print, ":%d", web_api_port);
             }
             // TODO: Use these unicode to show signal strength: ▂▄▆█
             return;
         }
-        serial_write_compressed(MP_ERROR_TEXT("Wi-Fi: "));
+        mp_printf(print, "%S", MP_ERROR_TEXT("Wi-Fi: "));
         _last_wifi_status = _wifi_status;
         if (_wifi_status == WIFI_RADIO_ERROR_AUTH_EXPIRE ||
             _wifi_status == WIFI_RADIO_ERROR_AUTH_FAIL) {
-            serial_write_compressed(MP_ERROR_TEXT("Authentication failure"));
+            mp_printf(print, "%S", MP_ERROR_TEXT("Authentication failure"));
         } else if (_wifi_status != WIFI_RADIO_ERROR_NONE) {
-            mp_printf(&mp_plat_print, "%d", _wifi_status);
+            mp_printf(print, "%d", _wifi_status);
         } else if (ipv4_address == 0) {
             _last_ip = 0;
-            serial_write_compressed(MP_ERROR_TEXT("No IP"));
+            mp_printf(print, "%S", MP_ERROR_TEXT("No IP"));
         } else {
         }
     } else {
         // Keep Wi-Fi print separate so its data can be matched with the one above.
-        serial_write_compressed(MP_ERROR_TEXT("Wi-Fi: "));
-        serial_write_compressed(MP_ERROR_TEXT("off"));
+        mp_printf(print, "%S", MP_ERROR_TEXT("Wi-Fi: "));
+        mp_printf(print, "%S", MP_ERROR_TEXT("off"));
     }
 }
 #endif
@@ -289,15 +350,36 @@ bool supervisor_start_web_workflow(bool reload) {
     // network. If we are connected to a different network, then it will disconnect before
     // attempting to connect to the given network.
 
-    _wifi_status = common_hal_wifi_radio_connect(
+    #if CIRCUITPY_SUPERVISOR_BOOT_TIMELINE
+    supervisor_boot_timeline_mark(SUPERVISOR_BOOT_EVENT_WIFI_CONNECT_START);
+    #endif
+    _wifi_status = common_hal_wifi_radio_connect_start(
         &common_hal_wifi_radio_obj, (uint8_t *)ssid, strlen(ssid), (uint8_t *)password, strlen(password),
-        0, 8, NULL, 0);
+        0, NULL, 0);
 
     if (_wifi_status != WIFI_RADIO_ERROR_NONE) {
         common_hal_wifi_radio_set_enabled(&common_hal_wifi_radio_obj, false);
         return false;
     }
 
+    // Finish in the background. A reload while still connecting keeps the first
+    // request's reload flag, since nothing has been started yet.
+    if (!_wifi_connecting) {
+        _reload_when_connected = reload;
+    }
+    _wifi_connecting = true;
+    _wifi_connect_deadline_ms = supervisor_ticks_ms64() + WIFI_CONNECT_TIMEOUT_MS;
+    return true;
+    #else
+    return false;
+    #endif
+}
+
+#if CIRCUITPY_WEB_WORKFLOW && CIRCUITPY_WIFI && CIRCUITPY_OS_GETENV
+// Start everything that needs the network, once Wi-Fi is connected.
+STATIC bool _start_web_workflow_services(bool reload) {
+    os_getenv_err_t result;
+
     // Skip starting the workflow if we're not starting from power on or reset.
     const mcu_reset_reason_t reset_reason = common_hal_mcu_processor_get_reset_reason();
     if (reset_reason != RESET_REASON_POWER_ON &&
@@ -332,7 +414,9 @@ bool supervisor_start_web_workflow(bool reload) {
         common_hal_socketpool_socketpool_construct(&pool, &common_hal_wifi_radio_obj);
 
         socketpool_socket_reset(&listening);
-        socketpool_socket_reset(&active);
+        for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CLIENTS; i++) {
+            socketpool_socket_reset(&clients[i].socket);
+        }
 
         websocket_init();
     }
@@ -340,8 +424,8 @@ bool supervisor_start_web_workflow(bool reload) {
     initialized = pool.base.type == &socketpool_socketpool_type;
 
     if (initialized) {
-        if (!common_hal_socketpool_socket_get_closed(&active)) {
-            common_hal_socketpool_socket_close(&active);
+        for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CLIENTS; i++) {
+            _close_client(&clients[i]);
         }
 
         #if CIRCUITPY_MDNS
@@ -364,16 +448,40 @@ bool supervisor_start_web_workflow(bool reload) {
             common_hal_socketpool_socket_settimeout(&listening, 0);
             // Bind to any ip. (Not checking for failures)
             common_hal_socketpool_socket_bind(&listening, "", 0, web_api_port);
-            common_hal_socketpool_socket_listen(&listening, 1);
+            common_hal_socketpool_socket_listen(&listening, CIRCUITPY_WEB_WORKFLOW_CLIENTS);
         }
         // Wake polling thread (maybe)
         socketpool_socket_poll_resume();
+        #if CIRCUITPY_SUPERVISOR_BOOT_TIMELINE
+        supervisor_boot_timeline_mark(SUPERVISOR_BOOT_EVENT_WEB_WORKFLOW_START);
+        #endif
         return true;
     }
-    #endif
     return false;
 }
 
+// Returns true once there is no connection attempt left to wait for.
+STATIC bool _finish_wifi_connect(void) {
+    if (!common_hal_wifi_radio_connect_finished(&common_hal_wifi_radio_obj, &_wifi_status)) {
+        if (supervisor_ticks_ms64() < _wifi_connect_deadline_ms) {
+            return false;
+        }
+        _wifi_status = WIFI_RADIO_ERROR_UNSPECIFIED;
+    }
+    _wifi_connecting = false;
+
+    if (_wifi_status != WIFI_RADIO_ERROR_NONE) {
+        common_hal_wifi_radio_set_enabled(&common_hal_wifi_radio_obj, false);
+        return true;
+    }
+    #if CIRCUITPY_SUPERVISOR_BOOT_TIMELINE
+    supervisor_boot_timeline_mark(SUPERVISOR_BOOT_EVENT_WIFI_CONNECTED);
+    #endif
+    (void)_start_web_workflow_services(_reload_when_connected);
+    return true;
+}
+#endif
+
 void web_workflow_send_raw(socketpool_socket_obj_t *socket, bool flush, const uint8_t *buf, int len) {
     int total_sent = 0;
     int sent = -MP_EAGAIN;
@@ -450,37 +558,6 @@ STATIC void _print_chunk(void *env, const char *str, size_t len) {
     web_workflow_send_raw((socketpool_socket_obj_t *)env, true, (const uint8_t *)"\r\n", 2);
 }
 
-// A bit of a misnomer because it sends all arguments as one chunk.
-// The last argument must be NULL! Otherwise, it won't stop.
-static void _send_chunks(socketpool_socket_obj_t *socket, ...) {
-    va_list strs_to_count;
-    va_start(strs_to_count, socket);
-
-    va_list strs_to_send;
-    va_copy(strs_to_send, strs_to_count);
-
-    size_t chunk_len = 0;
-    const char *str = va_arg(strs_to_count, const char *);
-    while (str != NULL) {
-        chunk_len += strlen(str);
-        str = va_arg(strs_to_count, const char *);
-    }
-    va_end(strs_to_count);
-
-
-    mp_print_t _socket_print = {socket, _print_raw};
-    mp_printf(&_socket_print, "%X\r\n", chunk_len);
-
-    str = va_arg(strs_to_send, const char *);
-    while (str != NULL) {
-        _send_str(socket, str);
-        str = va_arg(strs_to_send, const char *);
-    }
-    va_end(strs_to_send);
-
-    _send_str(socket, "\r\n");
-}
-
 static bool _endswith(const char *str, const char *suffix) {
     if (str == NULL || suffix == NULL) {
         return false;
@@ -536,6 +613,49 @@ STATIC bool _usb_active(void) {
 }
 
 
+// Bytes collected into one HTTP chunk before it is sent. With the chunk's framing
+// this fits in one TCP segment.
+#ifndef CIRCUITPY_WEB_WORKFLOW_JSON_CHUNK_SIZE
+#define CIRCUITPY_WEB_WORKFLOW_JSON_CHUNK_SIZE (1400)
+#endif
+
+// Room for the hex length and \r\n before the data, and \r\n after.
+#define CHUNK_HEADER_SIZE (6)
+
+typedef struct {
+    socketpool_socket_obj_t *socket;
+    size_t len;
+    char buf[CHUNK_HEADER_SIZE + CIRCUITPY_WEB_WORKFLOW_JSON_CHUNK_SIZE + 2];
+} _chunk_buffer;
+
+// Sends what has been collected as one chunk with a single socket write.
+static void _chunk_buffer_flush(_chunk_buffer *chunk) {
+    if (chunk->len == 0) {
+        return;
+    }
+    char header[CHUNK_HEADER_SIZE + 1];
+    size_t header_len = snprintf(header, sizeof(header), "%X\r\n", (unsigned int)chunk->len);
+    char *start = chunk->buf + CHUNK_HEADER_SIZE - header_len;
+    memcpy(start, header, header_len);
+    memcpy(chunk->buf + CHUNK_HEADER_SIZE + chunk->len, "\r\n", 2);
+    web_workflow_send_raw(chunk->socket, false, (const uint8_t *)start, header_len + chunk->len + 2);
+    chunk->len = 0;
+}
+
+STATIC void _print_chunk_buffer(void *env, const char *str, size_t len) {
+    _chunk_buffer *chunk = env;
+    while (len > 0) {
+        size_t copy_len = MIN(len, CIRCUITPY_WEB_WORKFLOW_JSON_CHUNK_SIZE - chunk->len);
+        memcpy(chunk->buf + CHUNK_HEADER_SIZE + chunk->len, str, copy_len);
+        chunk->len += copy_len;
+        str += copy_len;
+        len -= copy_len;
+        if (chunk->len == CIRCUITPY_WEB_WORKFLOW_JSON_CHUNK_SIZE) {
+            _chunk_buffer_flush(chunk);
+        }
+    }
+}
+
 static const char *OK_JSON = "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\nContent-Type: application/json\r\n";
 
 static void _cors_header(socketpool_socket_obj_t *socket, _request *request) {
@@ -568,12 +688,23 @@ static void _reply_no_content(socketpool_socket_obj_t *socket, _request *request
     _send_final_str(socket, "\r\n");
 }
 
+// Replies to a file write with the SHA-256 of the received body, as lowercase hex.
+static void _reply_written(socketpool_socket_obj_t *socket, _request *request, bool created, const char *sha256) {
+    _send_strs(socket,
+        created ? "HTTP/1.1 201 Created\r\n" : "HTTP/1.1 204 No Content\r\n",
+        "Content-Length: 0\r\n",
+        "X-SHA256: ", sha256, "\r\n",
+        "Access-Control-Expose-Headers: X-SHA256\r\n", NULL);
+    _cors_header(socket, request);
+    _send_final_str(socket, "\r\n");
+}
+
 static void _reply_access_control(socketpool_socket_obj_t *socket, _request *request) {
     _send_strs(socket,
         "HTTP/1.1 204 No Content\r\n",
         "Content-Length: 0\r\n",
         "Access-Control-Expose-Headers: Access-Control-Allow-Methods\r\n",
-        "Access-Control-Allow-Headers: X-Timestamp, X-Destination, Content-Type, Authorization\r\n",
+        "Access-Control-Allow-Headers: X-Timestamp, X-Destination, Content-Type, Authorization, If-None-Match, If-Modified-Since\r\n",
         "Access-Control-Allow-Methods:GET, OPTIONS", NULL);
     if (!_usb_active()) {
         _send_str(socket, ", PUT, DELETE, MOVE");
@@ -594,6 +725,96 @@ static void _reply_missing(socketpool_socket_obj_t *socket, _request *request) {
     _send_final_str(socket, "\r\n");
 }
 
+static const char _months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+static const char _weekdays[] = "MonTueWedThuFriSatSun";
+
+// Seconds since 1970 for a FatFs date and time, which we treat as UTC.
+static uint64_t _fat_seconds(WORD fdate, WORD ftime) {
+    return timeutils_mktime(1980 + (fdate >> 9),
+        (fdate >> 5) & 0xf,
+        fdate & 0x1f,
+        ftime >> 11,
+        (ftime >> 5) & 0x3f,
+        (ftime & 0x1f) * 2);
+}
+
+// Parses an IMF-fixdate such as "Sun, 06 Nov 1994 08:49:37 GMT" into seconds
+// since 1970. Returns 0 for anything else.
+static uint64_t _parse_http_date(const char *value) {
+    const char *comma = strchr(value, ',');
+    if (comma == NULL) {
+        return 0;
+    }
+    char *end;
+    mp_uint_t day = strtoul(comma + 1, &end, 10);
+    while (*end == ' ') {
+        end++;
+    }
+    size_t month = 0;
+    while (month < 12 && strncmp(end, _months + month * 3, 3) != 0) {
+        month++;
+    }
+    if (month == 12) {
+        return 0;
+    }
+    mp_uint_t year = strtoul(end + 3, &end, 10);
+    mp_uint_t hour = strtoul(end, &end, 10);
+    if (*end != ':') {
+        return 0;
+    }
+    mp_uint_t minute = strtoul(end + 1, &end, 10);
+    if (*end != ':') {
+        return 0;
+    }
+    mp_uint_t second = strtoul(end + 1, &end, 10);
+    if (year < 1970 || day < 1 || day > 31 || hour > 23 || minute > 59 || second > 60) {
+        return 0;
+    }
+    return timeutils_mktime(year, month + 1, day, hour, minute, second);
+}
+
+// True when the client's cached copy is current. An ETag match wins over the
+// date, as RFC 9110 requires. modified is 0 when there is no date to compare.
+static bool _not_modified(_request *request, const char *etag, uint64_t modified) {
+    if (request->if_none_match[0] != '\0') {
+        return strcmp(request->if_none_match, "*") == 0 || strstr(request->if_none_match, etag) != NULL;
+    }
+    return modified > 0 && request->if_modified_since > 0 && modified <= request->if_modified_since;
+}
+
+// Sends the headers that let clients make conditional requests. no-cache makes
+// browsers check with us every time instead of guessing from Last-Modified.
+static void _send_validators(socketpool_socket_obj_t *socket, const char *etag, uint64_t modified) {
+    _send_strs(socket,
+        "ETag: ", etag, "\r\n",
+        "Cache-Control: no-cache\r\n",
+        "Access-Control-Expose-Headers: ETag, Last-Modified\r\n", NULL);
+    if (modified > 0) {
+        timeutils_struct_time_t tm;
+        timeutils_seconds_since_epoch_to_struct_time(modified, &tm);
+        mp_print_t _socket_print = {socket, _print_raw};
+        mp_printf(&_socket_print, "Last-Modified: %.3s, %02d %.3s %d %02d:%02d:%02d GMT\r\n",
+            _weekdays + tm.tm_wday * 3, tm.tm_mday, _months + (tm.tm_mon - 1) * 3, tm.tm_year,
+            tm.tm_hour, tm.tm_min, tm.tm_sec);
+    }
+}
+
+static void _reply_not_modified(socketpool_socket_obj_t *socket, _request *request, const char *etag, uint64_t modified) {
+    _send_str(socket, "HTTP/1.1 304 Not Modified\r\n");
+    _send_validators(socket, etag, modified);
+    _cors_header(socket, request);
+    _send_final_str(socket, "\r\n");
+}
+
+static void _reply_range_not_satisfiable(socketpool_socket_obj_t *socket, _request *request, uint32_t total_length) {
+    _send_str(socket, "HTTP/1.1 416 Range Not Satisfiable\r\n");
+    mp_print_t _socket_print = {socket, _print_raw};
+    mp_printf(&_socket_print, "Content-Range: bytes */%u\r\n", total_length);
+    _send_str(socket, "Content-Length: 0\r\n");
+    _cors_header(socket, request);
+    _send_final_str(socket, "\r\n");
+}
+
 static void _reply_method_not_allowed(socketpool_socket_obj_t *socket, _request *request) {
     _send_strs(socket,
         "HTTP/1.1 405 Method Not Allowed\r\n",
@@ -664,6 +885,7 @@ static void _reply_server_error(socketpool_socket_obj_t *socket, _request *reque
 static void _reply_redirect(socketpool_socket_obj_t *socket, _request *request, const char *path) {
     int nodelay = 1;
     common_hal_socketpool_socket_setsockopt(socket, SOCKETPOOL_IPPROTO_TCP, SOCKETPOOL_TCP_NODELAY, &nodelay, sizeof(nodelay));
+    request->keep_alive = false;
     const char *hostname = common_hal_mdns_server_get_hostname(&mdns);
     _send_strs(socket,
         "HTTP/1.1 307 Temporary Redirect\r\n",
@@ -687,61 +909,119 @@ static void _reply_redirect(socketpool_socket_obj_t *socket, _request *request,
 }
 #endif
 
-static void _reply_directory_json(socketpool_socket_obj_t *socket, _request *request, FF_DIR *dir, const char *request_path, const char *path) {
+// Lists the directory entries modified at or after since, in seconds.
+static void _reply_directory_json(socketpool_socket_obj_t *socket, _request *request, FF_DIR *dir, const char *request_path, const char *path, uint32_t since) {
+    FILINFO file_info;
+    char *fn = file_info.fname;
+
+    // FAT doesn't change a directory's date when its contents change, so the
+    // ETag is a hash of the listing. Reading the entries twice is far cheaper
+    // than sending them.
+    uint32_t hash = 2166136261u ^ since;
+    FRESULT res = f_readdir(dir, &file_info);
+    while (res == FR_OK && fn[0] != 0) {
+        if (_fat_seconds(file_info.fdate, file_info.ftime) >= since) {
+            uint32_t fields[] = { file_info.fsize, file_info.fdate, file_info.ftime, file_info.fattrib };
+            const uint8_t *parts[] = { (const uint8_t *)fields, (const uint8_t *)fn };
+            size_t lens[] = { sizeof(fields), strlen(fn) + 1 };
+            for (size_t p = 0; p < MP_ARRAY_SIZE(parts); p++) {
+                for (size_t i = 0; i < lens[p]; i++) {
+                    hash = (hash ^ parts[p][i]) * 16777619u;
+                }
+            }
+        }
+        res = f_readdir(dir, &file_info);
+    }
+    char etag[12];
+    snprintf(etag, sizeof(etag), "\"d%08" PRIx32 "\"", hash);
+    if (_not_modified(request, etag, 0)) {
+        _reply_not_modified(socket, request, etag, 0);
+        return;
+    }
+    // Rewind for the listing.
+    f_readdir(dir, NULL);
+
     socketpool_socket_send(socket, (const uint8_t *)OK_JSON, strlen(OK_JSON));
+    _send_validators(socket, etag, 0);
     _cors_header(socket, request);
     _send_str(socket, "\r\n");
-    mp_print_t _socket_print = {socket, _print_chunk};
-    _send_chunk(socket, "[");
+    // Uses the stack so the buffer only exists while a directory is being listed.
+    _chunk_buffer chunk;
+    chunk.socket = socket;
+    chunk.len = 0;
+    mp_print_t _chunk_print = {&chunk, _print_chunk_buffer};
+    mp_print_str(&_chunk_print, "[");
     bool first = true;
 
-    FILINFO file_info;
-    char *fn = file_info.fname;
-    FRESULT res = f_readdir(dir, &file_info);
+    res = f_readdir(dir, &file_info);
     while (res == FR_OK && fn[0] != 0) {
-        if (!first) {
-            _send_chunk(socket, ",");
+        uint32_t truncated_time = _fat_seconds(file_info.fdate, file_info.ftime);
+        if (truncated_time < since) {
+            res = f_readdir(dir, &file_info);
+            continue;
         }
-        _send_chunks(socket,
-            "{\"name\": \"", file_info.fname, "\",",
-            "\"directory\": ", NULL);
-        if ((file_info.fattrib & AM_DIR) != 0) {
-            _send_chunk(socket, "true");
-        } else {
-            _send_chunk(socket, "false");
+
+        if (!first) {
+            mp_print_str(&_chunk_print, ",");
         }
-        // We use nanoseconds past Jan 1, 1970 for consistency with BLE API and
-        // LittleFS.
-        _send_chunk(socket, ", ");
-
-        uint32_t truncated_time = timeutils_mktime(1980 + (file_info.fdate >> 9),
-            (file_info.fdate >> 5) & 0xf,
-            file_info.fdate & 0x1f,
-            file_info.ftime >> 11,
-            (file_info.ftime >> 5) & 0x3f,
-            (file_info.ftime & 0x1f) * 2);
-
-        // Manually append zeros to make the time nanoseconds. Support for printing 64 bit numbers
-        // varies across chipsets.
-        mp_printf(&_socket_print, "\"modified_ns\": %lu000000000, ", truncated_time);
         size_t file_size = 0;
         if ((file_info.fattrib & AM_DIR) == 0) {
             file_size = file_info.fsize;
         }
-        mp_printf(&_socket_print, "\"file_size\": %d }", file_size);
+        // We use nanoseconds past Jan 1, 1970 for consistency with BLE API and
+        // LittleFS. Manually append zeros to make the time nanoseconds. Support for
+        // printing 64 bit numbers varies across chipsets.
+        mp_printf(&_chunk_print, "{\"name\": \"%s\",\"directory\": %s, \"modified_ns\": %lu000000000, \"file_size\": %d }",
+            file_info.fname,
+            (file_info.fattrib & AM_DIR) != 0 ? "true" : "false",
+            truncated_time,
+            file_size);
 
         first = false;
         res = f_readdir(dir, &file_info);
     }
-    _send_chunk(socket, "]");
+    mp_print_str(&_chunk_print, "]");
+    _chunk_buffer_flush(&chunk);
     _send_chunk(socket, "");
 }
 
-static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request, const char *filename, FIL *active_file) {
-    uint32_t total_length = f_size(active_file);
+// Makes a FatFs file's ETag from its size, date and time.
+static void _file_etag(const FILINFO *info, char *etag, size_t etag_len) {
+    snprintf(etag, etag_len, "\"%08" PRIx32 "-%04x%04x\"", (uint32_t)info->fsize, info->fdate, info->ftime);
+}
+
+static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request, const char *filename, FIL *active_file, const char *etag, uint64_t modified) {
+    uint32_t file_length = f_size(active_file);
+    uint32_t start = 0;
+    uint32_t total_length = file_length;
+    if (request->range) {
+        uint32_t end = MIN(request->range_end, file_length - 1);
+        if (request->range_suffix) {
+            start = file_length - MIN(request->range_end, file_length);
+            end = file_length - 1;
+        } else {
+            start = request->range_start;
+        }
+        if (file_length == 0 || start > end || (request->range_suffix && request->range_end == 0)) {
+            _reply_range_not_satisfiable(socket, request, file_length);
+            return;
+        }
+        total_length = end - start + 1;
+        if (f_lseek(active_file, start) != FR_OK) {
+            _reply_range_not_satisfiable(socket, request, file_length);
+            return;
+        }
+    }
 
-    _send_str(socket, "HTTP/1.1 200 OK\r\n");
     mp_print_t _socket_print = {socket, _print_raw};
+    if (request->range) {
+        _send_str(socket, "HTTP/1.1 206 Partial Content\r\n");
+        mp_printf(&_socket_print, "Content-Range: bytes %u-%u/%u\r\n", start, start + total_length - 1, file_length);
+    } else {
+        _send_str(socket, "HTTP/1.1 200 OK\r\n");
+    }
+    _send_str(socket, "Accept-Ranges: bytes\r\n");
+    _send_validators(socket, etag, modified);
     mp_printf(&_socket_print, "Content-Length: %d\r\n", total_length);
     // TODO: Make this a table to save space.
     if (_endswith(filename, ".txt") || _endswith(filename, ".py") || _endswith(filename, ".toml")) {
@@ -758,16 +1038,23 @@ static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request,
     _cors_header(socket, request);
     _send_str(socket, "\r\n");
 
-    uint32_t total_read = 0;
+    uint64_t start_ms = supervisor_ticks_ms64();
+    uint32_t total_sent = 0;
     int nodelay_ok = -1;
-    while (total_read < total_length) {
-        uint8_t data_buffer[64];
-        size_t quantity_read;
-        f_read(active_file, data_buffer, 64, &quantity_read);
-        total_read += quantity_read;
+    // Uses the stack so the buffer only exists while a file is being sent.
+    uint8_t data_buffer[CIRCUITPY_WEB_WORKFLOW_FILE_CHUNK_SIZE];
+    // Read up to a chunk boundary first so that the rest of the reads are sector aligned.
+    size_t chunk_size = sizeof(data_buffer) - start % sizeof(data_buffer);
+    while (total_sent < total_length) {
+        UINT quantity_read;
+        if (f_read(active_file, data_buffer, MIN(chunk_size, total_length - total_sent), &quantity_read) != FR_OK ||
+            quantity_read == 0) {
+            break;
+        }
+        chunk_size = sizeof(data_buffer);
         // When getting near the end of the file, disable Nagle's combining algorithm so that
         // data is sent immediately.
-        if (total_length - total_read < 64) {
+        if (total_length - total_sent - quantity_read < sizeof(data_buffer) && nodelay_ok != 0) {
             int nodelay = 1;
             // Returns 0 when it works.
             nodelay_ok = common_hal_socketpool_socket_setsockopt(socket, SOCKETPOOL_IPPROTO_TCP, SOCKETPOOL_TCP_NODELAY, &nodelay, sizeof(nodelay));
@@ -784,8 +1071,14 @@ static void _reply_with_file(socketpool_socket_obj_t *socket, _request *request,
             }
             send_offset += sent;
         }
+        total_sent += send_offset;
+        if (send_offset < quantity_read) {
+            break;
+        }
     }
-    if (total_read < total_length) {
+    _file_bytes_sent += total_sent;
+    _file_send_ms += supervisor_ticks_ms64() - start_ms;
+    if (total_sent < total_length) {
         socketpool_socket_close(socket);
     }
 
@@ -851,7 +1144,7 @@ static void _reply_with_version_json(socketpool_socket_obj_t *socket, _request *
     _update_encoded_ip();
     // Note: this leverages the fact that C concats consecutive string literals together.
     mp_printf(&_socket_print,
-        "{\"web_api_version\": 3, "
+        "{\"web_api_version\": 4, "
         "\"version\": \"" MICROPY_GIT_TAG "\", "
         "\"build_date\": \"" MICROPY_BUILD_DATE "\", "
         "\"board_name\": \"%s\", "
@@ -870,11 +1163,53 @@ static void _reply_with_version_json(socketpool_socket_obj_t *socket, _request *
     }
     mp_printf(&_socket_print, "\", ");
     #endif
+    mp_printf(&_socket_print, "\"file_bytes_sent\": %u, \"file_send_ms\": %u, ", _file_bytes_sent, _file_send_ms);
     mp_printf(&_socket_print, "\"ip\": \"%s\"}", _our_ip_encoded);
     // Empty chunk signals the end of the response.
     _send_chunk(socket, "");
 }
 
+#if MICROPY_GC_STATS
+// Same values as gc.stats(), except that the totals wrap at 32 bits like the
+// file transfer ones in version.json. The heap ones are only present while it
+// exists.
+static void _reply_with_gc_json(socketpool_socket_obj_t *socket, _request *request) {
+    _send_str(socket, OK_JSON);
+    _cors_header(socket, request);
+    _send_str(socket, "\r\n");
+    mp_print_t _socket_print = {socket, _print_chunk};
+
+    mp_gc_stats_t stats;
+    uint64_t elapsed_us = gc_stats(&stats, false);
+    mp_printf(&_socket_print,
+        "{\"elapsed_ms\": %u, "
+        "\"allocs\": %u, "
+        "\"alloc_bytes\": %u, "
+        "\"allocs_per_s\": %u, "
+        "\"bytes_per_s\": %u, "
+        "\"collections\": %u, "
+        "\"max_pause_us\": %u, "
+        "\"avg_pause_us\": %u",
+        (uint32_t)(elapsed_us / 1000),
+        (uint32_t)stats.allocs,
+        (uint32_t)stats.alloc_bytes,
+        (uint32_t)(stats.allocs * 1000000 / elapsed_us),
+        (uint32_t)(stats.alloc_bytes * 1000000 / elapsed_us),
+        stats.collections,
+        stats.max_pause_us,
+        stats.collections == 0 ? 0 : (uint32_t)(stats.total_pause_us / stats.collections));
+    if (gc_alloc_possible()) {
+        gc_info_t info;
+        gc_info(&info);
+        mp_printf(&_socket_print, ", \"free\": %u, \"largest_free\": %u, \"fragmentation\": %u",
+            info.free, info.max_free * MICROPY_BYTES_PER_GC_BLOCK, gc_info_fragmentation(&info));
+    }
+    mp_printf(&_socket_print, "}");
+    // Empty chunk signals the end of the response.
+    _send_chunk(socket, "");
+}
+#endif
+
 static void _reply_with_diskinfo_json(socketpool_socket_obj_t *socket, _request *request) {
     _send_str(socket, OK_JSON);
     _cors_header(socket, request);
@@ -939,6 +1274,8 @@ STATIC void _discard_incoming(socketpool_socket_obj_t *socket, size_t amount) {
 
 static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *request, FATFS *fs, const TCHAR *path) {
     FIL active_file;
+    // Every reply below reads or discards the body first, except a refused Expect.
+    request->body_read = true;
 
     if (_usb_active()) {
         _discard_incoming(socket, request->content_length);
@@ -999,6 +1336,7 @@ static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *req
         #endif
         // Too large.
         if (request->expect) {
+            request->keep_alive = false;
             _reply_expectation_failed(socket, request);
         } else {
             _discard_incoming(socket, request->content_length);
@@ -1011,25 +1349,35 @@ static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *req
     f_truncate(&active_file);
     f_rewind(&active_file);
 
+    hashlib_hash_obj_t hash;
+    common_hal_hashlib_new(&hash, "sha256");
+
+    // Collect a whole chunk before writing it. Writes then start on sector
+    // boundaries and cover whole sectors, which FatFs sends straight to the
+    // disk, while the network stack keeps receiving into its TCP window.
+    uint8_t bytes[CIRCUITPY_WEB_WORKFLOW_FILE_CHUNK_SIZE];
     size_t total_read = 0;
     bool error = false;
     while (total_read < request->content_length && !error) {
-        uint8_t bytes[64];
-        size_t read_len = MIN(sizeof(bytes), request->content_length - total_read);
-        int len = socketpool_socket_recv_into(socket, bytes, read_len);
-        if (len < 0) {
+        size_t chunk_len = MIN(sizeof(bytes), request->content_length - total_read);
+        size_t buffered = 0;
+        while (buffered < chunk_len) {
+            int len = socketpool_socket_recv_into(socket, bytes + buffered, chunk_len - buffered);
             if (len == -MP_EAGAIN) {
                 continue;
             }
-            error = true;
-            break;
+            if (len <= 0) {
+                error = true;
+                break;
+            }
+            buffered += len;
         }
-        total_read += len;
+        total_read += buffered;
+        common_hal_hashlib_hash_update(&hash, bytes, buffered);
         UINT actual;
-        f_write(&active_file, bytes, len, &actual);
-        if (actual < (UINT)len) {
+        f_write(&active_file, bytes, buffered, &actual);
+        if (actual < (UINT)buffered) {
             error = true;
-            break;
         }
     }
 
@@ -1042,11 +1390,15 @@ static void _write_file_and_reply(socketpool_socket_obj_t *socket, _request *req
     if (error) {
         _discard_incoming(socket, request->content_length - total_read);
         _reply_server_error(socket, request);
-    } else if (new_file) {
-        _reply_created(socket, request);
-    } else {
-        _reply_no_content(socket, request);
+        return;
     }
+    uint8_t digest[32];
+    common_hal_hashlib_hash_digest(&hash, digest, sizeof(digest));
+    char sha256[sizeof(digest) * 2 + 1];
+    for (size_t i = 0; i < sizeof(digest); i++) {
+        snprintf(sha256 + i * 2, 3, "%02x", digest[i]);
+    }
+    _reply_written(socket, request, new_file, sha256);
 }
 
 #define STATIC_FILE(filename) extern uint32_t filename##_length; extern uint8_t filename[]; extern const char *filename##_content_type;
@@ -1134,6 +1486,21 @@ static void _decode_percents(char *str) {
     }
 }
 
+// Returns the "since" query parameter, given in nanoseconds like modified_ns, in
+// seconds. FAT times don't have finer resolution.
+static uint32_t _query_since(const char *query) {
+    while (query != NULL) {
+        if (strncmp(query, "since=", 6) == 0) {
+            return strtoull(query + 6, NULL, 10) / 1000000000;
+        }
+        query = strchr(query, '&');
+        if (query != NULL) {
+            query++;
+        }
+    }
+    return 0;
+}
+
 static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
     if (request->redirect) {
         #if CIRCUITPY_MDNS
@@ -1161,6 +1528,11 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
             // Decode any percent encoded bytes so that we're left with UTF-8.
             // We only do this on /fs/ paths and after redirect so that any
             // path echoing we do stays encoded.
+            char *query = strchr(request->path, '?');
+            if (query != NULL) {
+                *query = '\0';
+                query++;
+            }
             _decode_percents(request->path);
 
             char *path = request->path + 3;
@@ -1245,7 +1617,7 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
                         return false;
                     }
                     if (request->json) {
-                        _reply_directory_json(socket, request, &dir, request->path, path);
+                        _reply_directory_json(socket, request, &dir, request->path, path, _query_since(query));
                     } else if (pathlen == 1) {
                         _REPLY_STATIC(socket, request, directory_html);
                     } else {
@@ -1282,16 +1654,30 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
                 }
             } else { // Dealing with a file.
                 if (strcasecmp(request->method, "GET") == 0) {
+                    FILINFO info;
+                    FRESULT result = f_stat(fs, path, &info);
+                    char etag[24] = "";
+                    uint64_t modified = 0;
+                    if (result == FR_OK) {
+                        _file_etag(&info, etag, sizeof(etag));
+                        modified = _fat_seconds(info.fdate, info.ftime);
+                        if (_not_modified(request, etag, modified)) {
+                            _reply_not_modified(socket, request, etag, modified);
+                            return false;
+                        }
+                    }
+
                     FIL active_file;
-                    FRESULT result = f_open(fs, &active_file, path, FA_READ);
+                    if (result == FR_OK) {
+                        result = f_open(fs, &active_file, path, FA_READ);
+                    }
 
                     if (result != FR_OK) {
                         _reply_missing(socket, request);
                     } else {
-                        _reply_with_file(socket, request, path, &active_file);
+                        _reply_with_file(socket, request, path, &active_file, etag, modified);
+                        f_close(&active_file);
                     }
-
-                    f_close(&active_file);
                 } else if (strcasecmp(request->method, "PUT") == 0) {
                     _write_file_and_reply(socket, request, fs, path);
                     return true;
@@ -1323,6 +1709,10 @@ static bool _reply(socketpool_socket_obj_t *socket, _request *request) {
             _reply_with_version_json(socket, request);
         } else if (strcmp(path, "/diskinfo.json") == 0) {
             _reply_with_diskinfo_json(socket, request);
+        #if MICROPY_GC_STATS
+        } else if (strcmp(path, "/gc.json") == 0) {
+            _reply_with_gc_json(socket, request);
+        #endif
         } else if (strcmp(path, "/serial/") == 0) {
             if (!request->authenticated) {
                 if (_api_password[0] != '\0') {
@@ -1376,11 +1766,42 @@ static void _reset_request(_request *request) {
     request->redirect = false;
     request->done = false;
     request->in_progress = false;
-    request->new_socket = false;
     request->authenticated = false;
     request->expect = false;
     request->json = false;
     request->websocket = false;
+    request->keep_alive = true;
+    request->body_read = false;
+    request->range = false;
+    request->if_none_match[0] = '\0';
+    request->if_modified_since = 0;
+}
+
+static void _start_request(_request *request) {
+    if (_requests_in_progress == 0) {
+        autoreload_suspend(AUTORELOAD_SUSPEND_WEB);
+    }
+    _requests_in_progress++;
+    request->in_progress = true;
+    request->last_active_ms = supervisor_ticks_ms64();
+}
+
+static void _finish_request(_request *request) {
+    if (request->in_progress) {
+        _requests_in_progress--;
+        if (_requests_in_progress == 0) {
+            autoreload_resume(AUTORELOAD_SUSPEND_WEB);
+        }
+    }
+    _reset_request(request);
+    request->last_active_ms = supervisor_ticks_ms64();
+}
+
+static void _close_client(_client *client) {
+    _finish_request(&client->request);
+    if (!common_hal_socketpool_socket_get_closed(&client->socket)) {
+        common_hal_socketpool_socket_close(&client->socket);
+    }
 }
 
 static void _process_request(socketpool_socket_obj_t *socket, _request *request) {
@@ -1395,15 +1816,13 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
             more = false;
             if (len == 0 || len == -MP_ENOTCONN) {
                 // Disconnect - clear 'in-progress'
-                _reset_request(request);
+                _finish_request(request);
                 common_hal_socketpool_socket_close(socket);
             }
             break;
         }
         if (!request->in_progress) {
-            autoreload_suspend(AUTORELOAD_SUSPEND_WEB);
-            request->in_progress = true;
-            request->new_socket = false;
+            _start_request(request);
         }
         switch (request->state) {
             case STATE_METHOD: {
@@ -1480,6 +1899,8 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
                                 request->header_value[strlen(cp_local)] == ':');
                         strncpy(request->host, request->header_value, sizeof(request->host) - 1);
                         request->host[sizeof(request->host) - 1] = '\0';
+                    } else if (strcasecmp(request->header_key, "Connection") == 0) {
+                        request->keep_alive = strcasecmp(request->header_value, "close") != 0;
                     } else if (strcasecmp(request->header_key, "Content-Length") == 0) {
                         request->content_length = strtoul(request->header_value, NULL, 10);
                     } else if (strcasecmp(request->header_key, "Expect") == 0) {
@@ -1498,8 +1919,31 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
                     } else if (strcasecmp(request->header_key, "Sec-WebSocket-Key") == 0 &&
                                strlen(request->header_value) == 24) {
                         strcpy(request->websocket_key, request->header_value);
+                    } else if (strcasecmp(request->header_key, "If-None-Match") == 0) {
+                        strncpy(request->if_none_match, request->header_value, sizeof(request->if_none_match) - 1);
+                        request->if_none_match[sizeof(request->if_none_match) - 1] = '\0';
+                    } else if (strcasecmp(request->header_key, "If-Modified-Since") == 0) {
+                        request->if_modified_since = _parse_http_date(request->header_value);
                     } else if (strcasecmp(request->header_key, "X-Destination") == 0) {
                         strcpy(request->destination, request->header_value);
+                    } else if (strcasecmp(request->header_key, "Range") == 0 &&
+                               strncmp(request->header_value, "bytes=", 6) == 0) {
+                        // Only a single range is supported: "N-M", "N-" or "-N".
+                        const char *spec = request->header_value + 6;
+                        char *end;
+                        request->range_suffix = *spec == '-';
+                        request->range_start = 0;
+                        if (!request->range_suffix) {
+                            request->range_start = strtoul(spec, &end, 10);
+                            spec = end;
+                        }
+                        request->range = *spec == '-';
+                        request->range_end = UINT32_MAX;
+                        if (request->range && spec[1] != '\0') {
+                            request->range_end = strtoul(spec + 1, &end, 10);
+                            // Multiple or malformed ranges get the whole file.
+                            request->range = *end == '\0';
+                        }
                     }
                 } else if (request->offset > sizeof(request->header_value) - 1) {
                     // Skip methods that are too long.
@@ -1522,57 +1966,99 @@ static void _process_request(socketpool_socket_obj_t *socket, _request *request)
         common_hal_socketpool_socket_setsockopt(socket, SOCKETPOOL_IPPROTO_TCP, SOCKETPOOL_TCP_NODELAY, &nodelay, sizeof(nodelay));
         socketpool_socket_send(socket, (const uint8_t *)error_response, strlen(error_response));
         request->done = true;
+        request->keep_alive = false;
     }
     if (!request->done) {
         return;
     }
     bool reload = _reply(socket, request);
-    _reset_request(request);
-    common_hal_socketpool_socket_close(socket);
-    autoreload_resume(AUTORELOAD_SUSPEND_WEB);
+    // Every reply is framed by its length, so the connection can take another
+    // request unless an unread body is left in the way.
+    bool keep_alive = request->keep_alive && (request->content_length == 0 || request->body_read);
+    _finish_request(request);
+    if (!keep_alive && !common_hal_socketpool_socket_get_closed(socket)) {
+        common_hal_socketpool_socket_close(socket);
+    }
     if (reload) {
         autoreload_trigger();
     }
 }
 
+// Returns a closed client to accept a connection into. Idle connections that
+// have timed out are closed, and when a connection is waiting and no client is
+// free the one idle the longest makes way for it.
+static _client *_free_client(void) {
+    uint64_t now = supervisor_ticks_ms64();
+    _client *free_client = NULL;
+    _client *idlest = NULL;
+    for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CLIENTS; i++) {
+        _client *client = &clients[i];
+        if (!client->request.in_progress &&
+            (!common_hal_socketpool_socket_get_connected(&client->socket) ||
+             now - client->request.last_active_ms > CIRCUITPY_WEB_WORKFLOW_KEEP_ALIVE_MS)) {
+            _close_client(client);
+        }
+        if (common_hal_socketpool_socket_get_closed(&client->socket)) {
+            free_client = client;
+        } else if (!client->request.in_progress &&
+                   (idlest == NULL || client->request.last_active_ms < idlest->request.last_active_ms)) {
+            idlest = client;
+        }
+    }
+    if (free_client == NULL && idlest != NULL && common_hal_socketpool_readable(&listening)) {
+        _close_client(idlest);
+        free_client = idlest;
+    }
+    return free_client;
+}
+
 
 void supervisor_web_workflow_background(void *data) {
-    while (true) {
-        // If we have a request in progress, continue working on it. Do this first
-        // so that we can accept another socket after finishing this request.
-        if (common_hal_socketpool_socket_get_connected(&active)) {
-            _process_request(&active, &active_request);
-            if (active_request.in_progress) {
-                break;
-            }
-        } else {
-            // Close the active socket if necessary
-            if (!common_hal_socketpool_socket_get_closed(&active)) {
-                common_hal_socketpool_socket_close(&active);
-            }
+    #if CIRCUITPY_WEB_WORKFLOW && CIRCUITPY_WIFI && CIRCUITPY_OS_GETENV
+    if (_wifi_connecting && !_finish_wifi_connect()) {
+        // Nothing wakes us when the connection completes, so poll.
+        supervisor_workflow_request_background();
+        return;
+    }
+    #endif
+    if (pool.base.type != &socketpool_socketpool_type) {
+        // Wi-Fi didn't connect or the web workflow wasn't configured.
+        return;
+    }
+
+    // Accept any waiting connections first so that they get served this time.
+    while (!common_hal_socketpool_socket_get_closed(&listening)) {
+        _client *client = _free_client();
+        if (client == NULL) {
+            break;
         }
-        // Otherwise, see if we have another socket to accept.
-        if ((!common_hal_socketpool_socket_get_connected(&active) ||
-             (!active_request.in_progress && !active_request.new_socket)) &&
-            !common_hal_socketpool_socket_get_closed(&listening)) {
-            uint32_t ip;
-            uint32_t port;
-            if (!common_hal_socketpool_socket_get_closed(&active)) {
-                common_hal_socketpool_socket_close(&active);
-            }
-            int newsoc = socketpool_socket_accept(&listening, (uint8_t *)&ip, &port, &active);
-            if (newsoc == -EBADF) {
-                common_hal_socketpool_socket_close(&listening);
-                break;
-            }
-            if (newsoc > 0) {
-                common_hal_socketpool_socket_settimeout(&active, 0);
-                _reset_request(&active_request);
-                // Mark new sockets, otherwise we may accept another before the first
-                // could start its request.
-                active_request.new_socket = true;
-                continue;
-            }
+        uint32_t ip;
+        uint32_t port;
+        int newsoc = socketpool_socket_accept(&listening, (uint8_t *)&ip, &port, &client->socket);
+        if (newsoc == -EBADF) {
+            common_hal_socketpool_socket_close(&listening);
+            break;
+        }
+        if (newsoc <= 0) {
+            break;
+        }
+        common_hal_socketpool_socket_settimeout(&client->socket, 0);
+        _reset_request(&client->request);
+        client->request.last_active_ms = supervisor_ticks_ms64();
+    }
+
+    // Serve each connection in turn, starting after the last one served, until
+    // out of time.
+    uint64_t start_ms = supervisor_ticks_ms64();
+    for (size_t i = 0; i < CIRCUITPY_WEB_WORKFLOW_CLIENTS; i++) {
+        _client *client = &clients[_next_client];
+        _next_client = (_next_client + 1) % CIRCUITPY_WEB_WORKFLOW_CLIENTS;
+        if (common_hal_socketpool_socket_get_connected(&client->socket)) {
+            _process_request(&client->socket, &client->request);
+        } else if (!common_hal_socketpool_socket_get_closed(&client->socket)) {
+            _close_client(client);
+        }
+        if (supervisor_ticks_ms64() - start_ms >= CIRCUITPY_WEB_WORKFLOW_TIME_BUDGET_MS) {
             break;
         }
     }
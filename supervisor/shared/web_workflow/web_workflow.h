@@ -28,6 +28,8 @@
 
 #include <stdbool.h>
 
+#include "py/mpprint.h"
+
 #include "shared-bindings/mdns/Server.h"
 #include "shared-bindings/socketpool/Socket.h"
 
@@ -35,7 +37,7 @@
 // on events.
 void supervisor_web_workflow_background(void *data);
 bool supervisor_web_workflow_status_dirty(void);
-void supervisor_web_workflow_status(void);
+void supervisor_web_workflow_status(const mp_print_t *print);
 bool supervisor_start_web_workflow(bool);
 void supervisor_stop_web_workflow(void);
 
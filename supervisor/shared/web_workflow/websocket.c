@@ -30,6 +30,7 @@
 #include "py/runtime.h"
 #include "shared/runtime/interrupt_char.h"
 #include "shared-bindings/socketpool/SocketPool.h"
+#include "supervisor/shared/web_workflow/file_transfer.h"
 #include "supervisor/shared/web_workflow/web_workflow.h"
 
 #if CIRCUITPY_STATUS_BAR
@@ -51,6 +52,9 @@ typedef struct {
 // interrupt character.
 STATIC ringbuf_t _incoming_ringbuf;
 STATIC uint8_t _buf[16];
+// Binary messages are collected here before being handled as file transfer
+// commands. uint32_t so its aligned.
+STATIC uint32_t _message[WEB_WORKFLOW_FILE_TRANSFER_MESSAGE_SIZE / 4 + 1];
 // make sure background is not called recursively
 STATIC bool in_web_background = false;
 
@@ -67,6 +71,8 @@ void websocket_handoff(socketpool_socket_obj_t *socket) {
         common_hal_socketpool_socket_close(&cp_serial.socket);
     }
 
+    web_workflow_file_transfer_reset();
+
     socketpool_socket_move(socket, &cp_serial.socket);
     cp_serial.opcode = 0;
     cp_serial.frame_index = 0;
@@ -92,7 +98,39 @@ static bool _read_byte(uint8_t *c) {
     return true;
 }
 
-static void _read_next_frame_header(void) {
+// Read the rest of a binary frame and hand it off as one file transfer message.
+// Anything past the end of the message buffer is discarded. Returns true once the
+// message has been handled.
+static bool _read_binary_payload(void) {
+    uint8_t *message = (uint8_t *)_message;
+    while (cp_serial.payload_remaining > 0) {
+        size_t message_offset = cp_serial.frame_index - cp_serial.frame_len;
+        int len;
+        if (message_offset < sizeof(_message)) {
+            size_t space = MIN(cp_serial.payload_remaining, sizeof(_message) - message_offset);
+            len = socketpool_socket_recv_into(&cp_serial.socket, message + message_offset, space);
+            for (int i = 0; cp_serial.masked && i < len; i++) {
+                message[message_offset + i] ^= cp_serial.mask[(message_offset + i) % 4];
+            }
+        } else {
+            uint8_t discard[16];
+            len = socketpool_socket_recv_into(&cp_serial.socket, discard, MIN(cp_serial.payload_remaining, sizeof(discard)));
+        }
+        if (len < 1) {
+            return false;
+        }
+        cp_serial.frame_index += len;
+        cp_serial.payload_remaining -= len;
+    }
+    size_t message_len = cp_serial.frame_index - cp_serial.frame_len;
+    cp_serial.frame_index = 0;
+    web_workflow_file_transfer_process(message, message_len);
+    return true;
+}
+
+// Returns true if a binary message was handled so that the caller can move on to
+// the next frame.
+static bool _read_next_frame_header(void) {
     uint8_t h;
     if (cp_serial.frame_index == 0 && _read_byte(&h)) {
         cp_serial.frame_index++;
@@ -159,10 +197,18 @@ static void _read_next_frame_header(void) {
             }
         }
     }
+    if (cp_serial.opcode == 0x2 &&
+        cp_serial.frame_index >= cp_serial.frame_len) {
+        return _read_binary_payload();
+    }
+    return false;
 }
 
 static bool _read_next_payload_byte(uint8_t *c) {
-    _read_next_frame_header();
+    while (_read_next_frame_header()) {
+        // Binary messages are handled as they complete. Keep going until there is
+        // a text frame to read from or no more data.
+    }
     if (cp_serial.opcode == 0x1 &&
         cp_serial.frame_index >= cp_serial.frame_len &&
         cp_serial.payload_remaining > 0) {
@@ -196,11 +242,10 @@ char websocket_read_char(void) {
     return -1;
 }
 
-static void _websocket_send(_websocket *ws, const char *text, size_t len) {
+static void _websocket_send(_websocket *ws, uint8_t opcode, const uint8_t *payload, size_t len) {
     if (!websocket_connected()) {
         return;
     }
-    uint32_t opcode = 1;
     uint8_t frame_header[2];
     frame_header[0] = 1 << 7 | opcode;
     uint8_t payload_len;
@@ -228,15 +273,20 @@ static void _websocket_send(_websocket *ws, const char *text, size_t len) {
         extended_len[3] = len & 0xff;
         web_workflow_send_raw(&ws->socket, false, extended_len, 4);
     }
-    web_workflow_send_raw(&ws->socket, false, (const uint8_t *)text, len);
+    web_workflow_send_raw(&ws->socket, false, payload, len);
 }
 
 void websocket_write(const char *text, size_t len) {
-    _websocket_send(&cp_serial, text, len);
+    _websocket_send(&cp_serial, 0x1, (const uint8_t *)text, len);
+}
+
+void websocket_write_binary(const uint8_t *buf, size_t len) {
+    _websocket_send(&cp_serial, 0x2, buf, len);
 }
 
 void websocket_background(void) {
     if (!websocket_connected()) {
+        web_workflow_file_transfer_reset();
         return;
     }
     if (in_web_background) {
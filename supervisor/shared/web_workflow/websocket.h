@@ -37,3 +37,5 @@ bool websocket_available(void);
 char websocket_read_char(void);
 void websocket_background(void);
 void websocket_write(const char *text, size_t len);
+// Send buf as a single binary message.
+void websocket_write_binary(const uint8_t *buf, size_t len);
@@ -32,6 +32,7 @@
 #include "supervisor/workflow.h"
 #include "supervisor/serial.h"
 #include "supervisor/shared/workflow.h"
+#include "supervisor/shared/boot_timeline.h"
 
 #if CIRCUITPY_BLEIO
 #include "shared-bindings/_bleio/__init__.h"
@@ -43,9 +44,13 @@
 #include "tusb.h"
 #endif
 
+#if CIRCUITPY_ALARM_FAST_RESUME
+#include "shared-bindings/microcontroller/Processor.h"
+#endif
+
 #if CIRCUITPY_WEB_WORKFLOW
 #include "supervisor/shared/web_workflow/web_workflow.h"
-static background_callback_t workflow_background_cb = {NULL, NULL};
+static background_callback_t workflow_background_cb = { .priority = BACKGROUND_CALLBACK_PRIORITY_HOUSEKEEPING };
 #endif
 
 
@@ -91,9 +96,22 @@ bool supervisor_workflow_active(void) {
 void supervisor_workflow_start(void) {
     // Start USB after giving boot.py a chance to tweak behavior.
     #if CIRCUITPY_USB
-    // Setup USB connection after heap is available.
-    // It needs the heap to build descriptors.
-    usb_init();
+    bool start_usb = true;
+    #if CIRCUITPY_ALARM_FAST_RESUME
+    // After a true deep sleep with no host attached the next sleep is a true one too.
+    // Save the enumeration time, and start USB later only if code.py doesn't go back
+    // to sleep. A host that may be attached gets USB as usual.
+    start_usb = common_hal_mcu_processor_get_reset_reason() != RESET_REASON_DEEP_SLEEP_ALARM ||
+        port_usb_vbus_present();
+    #endif
+    if (start_usb) {
+        // Setup USB connection after heap is available.
+        // It needs the heap to build descriptors.
+        usb_init();
+        #if CIRCUITPY_SUPERVISOR_BOOT_TIMELINE
+        supervisor_boot_timeline_mark(SUPERVISOR_BOOT_EVENT_USB_INIT);
+        #endif
+    }
     #endif
 
     // Set up any other serial connection.
@@ -116,6 +134,21 @@ void supervisor_workflow_start(void) {
     #if CIRCUITPY_USB_KEYBOARD_WORKFLOW
     usb_keyboard_init();
     #endif
+
+    #if CIRCUITPY_SUPERVISOR_BOOT_TIMELINE
+    supervisor_boot_timeline_mark(SUPERVISOR_BOOT_EVENT_WORKFLOW_START);
+    #endif
+}
+
+void supervisor_workflow_start_usb(void) {
+    #if CIRCUITPY_USB
+    if (!usb_enabled()) {
+        usb_init();
+        #if CIRCUITPY_SUPERVISOR_BOOT_TIMELINE
+        supervisor_boot_timeline_mark(SUPERVISOR_BOOT_EVENT_USB_INIT);
+        #endif
+    }
+    #endif
 }
 
 FRESULT supervisor_workflow_mkdir_parents(FATFS *fs, char *path) {
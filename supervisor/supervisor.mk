@@ -9,6 +9,7 @@ SRC_SUPERVISOR = \
 	supervisor/shared/flash.c \
 	supervisor/shared/lock.c \
 	supervisor/shared/micropython.c \
+	supervisor/shared/native_code.c \
 	supervisor/shared/port.c \
 	supervisor/shared/reload.c \
 	supervisor/shared/safe_mode.c \
@@ -103,6 +104,18 @@ ifneq ($(wildcard supervisor/serial.c),)
   SRC_SUPERVISOR += supervisor/serial.c
 endif
 
+ifeq ($(CIRCUITPY_CPU_GOVERNOR),1)
+  SRC_SUPERVISOR += supervisor/shared/cpu_governor.c
+endif
+
+ifeq ($(CIRCUITPY_SUPERVISOR_BOOT_TIMELINE),1)
+  SRC_SUPERVISOR += supervisor/shared/boot_timeline.c
+endif
+
+ifeq ($(CIRCUITPY_SUPERVISOR_MEMORY_STATS),1)
+  SRC_SUPERVISOR += supervisor/shared/memory_stats.c
+endif
+
 ifeq ($(CIRCUITPY_STATUS_BAR),1)
   SRC_SUPERVISOR += \
     supervisor/shared/status_bar.c \
@@ -183,7 +196,8 @@ $(BUILD)/autogen_web_workflow_static.c: ../../tools/gen_web_workflow_static.py $
 		$(STATIC_RESOURCES)
 
 ifeq ($(CIRCUITPY_WEB_WORKFLOW),1)
-  SRC_SUPERVISOR += supervisor/shared/web_workflow/web_workflow.c \
+  SRC_SUPERVISOR += supervisor/shared/web_workflow/file_transfer.c \
+                    supervisor/shared/web_workflow/web_workflow.c \
                     supervisor/shared/web_workflow/websocket.c
   SRC_SUPERVISOR += $(BUILD)/autogen_web_workflow_static.c
 endif
@@ -50,6 +50,10 @@ void init_usb_hardware(void);
 // Temporary hook for code after init. Only used for RP2040.
 void post_usb_init(void);
 
+// Whether the port senses VBUS, so a host may be attached. Ports that can't
+// sense it return false.
+bool port_usb_vbus_present(void);
+
 // Indexes and counts updated as descriptors are built.
 typedef struct {
     size_t current_interface;
@@ -90,6 +94,11 @@ bool usb_msc_ejected(void);
 // else (likely BLE.)
 bool usb_msc_lock(void);
 void usb_msc_unlock(void);
+
+// Write out host writes that are being held to merge with later ones.
+void usb_msc_flush_writes(void);
+// Flushes held writes once the host has been idle for a bit. Run from the tick.
+void usb_msc_background(void);
 #endif
 
 #if CIRCUITPY_USB_KEYBOARD_WORKFLOW
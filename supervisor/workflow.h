@@ -34,3 +34,6 @@ bool supervisor_workflow_active(void);
 void supervisor_workflow_request_background(void);
 
 void supervisor_workflow_start(void);
+
+// Start USB if supervisor_workflow_start() left it off for a fast wake from deep sleep.
+void supervisor_workflow_start_usb(void);
@@ -0,0 +1,25 @@
+# test that builtin loads done before overriding builtins see the override
+
+import builtins
+
+
+def f():
+    return abs(-1)
+
+
+before = f()
+
+try:
+    builtins.abs = lambda x: "override"
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+print(before)
+print(f())
+
+orig_min = min
+builtins.min = lambda *x: "min override"
+print(min(1, 2))
+builtins.min = orig_min
+print(min(1, 2))
@@ -0,0 +1,67 @@
+# test that class attribute lookups see changes to classes made after a lookup
+
+
+class A:
+    x = 1
+
+    def f(self):
+        return "A.f"
+
+
+class B(A):
+    pass
+
+
+b = B()
+for i in range(3):
+    print(b.x, b.f())
+
+# change an attribute of the base
+A.x = 2
+A.f = lambda self: "new A.f"
+print(b.x, b.f())
+
+# shadow it in the subclass
+B.x = 3
+B.f = lambda self: "B.f"
+print(b.x, b.f())
+
+# remove the shadowing
+del B.x
+del B.f
+print(b.x, b.f())
+
+# instance members still take priority
+b.x = 4
+print(b.x)
+del b.x
+print(b.x)
+
+
+# one lookup site seeing several types
+class C:
+    def f(self):
+        return "C.f"
+
+
+class D(C):
+    def f(self):
+        return "D.f"
+
+
+for o in (C(), D(), B(), C(), D()):
+    print(o.f())
+
+
+# classes created in a loop, possibly reusing memory of collected ones
+def make(n):
+    class E:
+        def f(self):
+            return n
+
+    return E()
+
+
+for n in range(20):
+    print(make(n).f(), end=" ")
+print()
@@ -0,0 +1,58 @@
+# test that dicts iterate in insertion order
+
+keys = ["k%d" % i for i in range(20)]
+d = {}
+for k in keys:
+    d[k] = len(d)
+if list(d) != keys:
+    print("SKIP")
+    raise SystemExit
+
+print(list(d.items())[:4])
+
+# removing keys keeps the order of the rest, and a re-added key goes at the end
+for k in keys[::3]:
+    del d[k]
+d["k0"] = "again"
+print(list(d))
+
+# popitem takes the newest entry
+print(d.popitem(), d.popitem())
+print(list(d)[-2:])
+
+# many removals and additions, including of keys that aren't strings
+for i in range(200):
+    d[i] = i
+    if i % 4:
+        del d[i - 1]
+print(len(d), list(d)[-5:])
+for i in range(100):
+    d.pop(i, None)
+print(len(d), list(d)[:3], list(d)[-3:])
+
+# copies and small dicts keep the order too
+print(list(d.copy()) == list(d))
+small = {}
+for k in "zyxa":
+    small[k] = 1
+del small["y"]
+small["y"] = 2
+print(small)
+
+# a read-only instance __dict__ keeps its hash index, so copies of it can be searched
+class A:
+    pass
+a = A()
+for k in keys[:12]:
+    setattr(a, k, k)
+c = a.__dict__.copy()
+print(len(c), c["k0"], c["k11"], list(c)[-2:])
+
+# emptying a dict from the end
+n = 0
+while d:
+    d.popitem()
+    n += 1
+print(n, d)
+d["a"] = 1
+print(d)
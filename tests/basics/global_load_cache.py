@@ -0,0 +1,53 @@
+# test that global and builtin loads see later changes to globals
+
+
+def f():
+    return len([1, 2, 3])
+
+
+for i in range(3):
+    print(f())
+
+# shadow the builtin with a global
+len = lambda x: "global len"
+print(f())
+
+# update the global
+len = lambda x: "new global len"
+print(f())
+
+# remove it again
+del len
+print(f())
+
+
+def g():
+    return x
+
+
+x = 1
+print(g())
+x = 2
+print(g())
+del x
+try:
+    g()
+except NameError:
+    print("NameError")
+
+# a function running with other globals
+d = {}
+exec("def h():\n    return abs(-1)", d)
+h = d["h"]
+print(h())
+d["abs"] = lambda x: "d abs"
+print(h())
+d.clear()
+print(h())
+
+# many globals, so the dict is rehashed while a builtin load is cached
+for i in range(3):
+    print(f())
+    for j in range(20):
+        globals()["v%d" % (10 * i + j)] = j
+    print(f())
@@ -0,0 +1,37 @@
+# test multiplication and 3 arg pow of integers large enough to take the
+# Karatsuba and Montgomery paths
+
+seed = 12345
+
+
+def rnd(bits):
+    global seed
+    r = 0
+    for _ in range((bits + 29) // 30):
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+        r = (r << 30) | (seed >> 1)
+    return r % (1 << bits) | (1 << (bits - 1))
+
+
+# balanced, unbalanced and signed products
+for bits in (500, 1000, 3000, 7000):
+    for other in (bits, bits // 3 + 1, 40):
+        a = rnd(bits)
+        b = rnd(other)
+        print(bits, other, a * b % 1000000007, a * a % 999999937, -a * b % 1000000007)
+
+# products that carry all the way through
+a = (1 << 4000) - 1
+print(a * a == (1 << 8000) - (1 << 4001) + 1)
+
+# odd and even moduli, with exponents that use different window sizes
+for bits in (40, 512, 1024):
+    m = rnd(bits) | 1
+    for ebits in (1, 17, 64, 200, bits):
+        a = rnd(bits + 5)
+        e = rnd(ebits)
+        print(bits, ebits, pow(a, e, m) % 1000000007, pow(-a, e, m) % 1000000007, pow(a, e, m + 1) % 1000000007)
+
+print(pow(3, 65537, (1 << 2048) + 1) % 1000003)
+print(pow(7, 5, (1 << 600) - 1))
+print(pow(1 << 700, 3, (1 << 600) + 1))
@@ -0,0 +1,55 @@
+# test small int binary ops and comparisons feeding conditional jumps
+
+
+def count(n):
+    c = 0
+    i = 0
+    while i < n:
+        if i & 1 == 0:
+            c += 1
+        i += 1
+    return c
+
+
+print(count(10), count(0), count(-5))
+
+# comparisons in branches, both jump senses
+for a, b in ((1, 2), (2, 1), (3, 3), (-4, 4)):
+    r = []
+    if a < b:
+        r.append("lt")
+    if not a > b:
+        r.append("not gt")
+    if a == b:
+        r.append("eq")
+    if a != b:
+        r.append("ne")
+    if a <= b:
+        r.append("le")
+    if not a >= b:
+        r.append("not ge")
+    print(a, b, r)
+
+# results that don't fit in a small int
+x = 1 << 29
+for _ in range(6):
+    x = x + x
+print(x, x - x, -x - x)
+y = -(1 << 29)
+for _ in range(6):
+    y -= 1 << 29
+print(y)
+
+# mixed operand types fall back to the generic path
+print(1 < 1.5, 2 == 2.0, 3 + True, 5 - 0.5, 1 | True)
+print([1 < x for x in (0, 1, 2, 1 << 70)])
+
+# comparison result used as a value rather than a branch
+b = 3 < 4
+print(b, 3 > 4, (7 & 3) ^ 1)
+
+try:
+    if 1 < "a":
+        pass
+except TypeError:
+    print("TypeError")
@@ -0,0 +1,59 @@
+# list.sort is stable, calls key once per element and handles runs
+
+# Equal keys keep their order, with and without reverse.
+pairs = [(i * 7 % 5, i) for i in range(200)]
+for reverse in (False, True):
+    l = pairs[:]
+    l.sort(key=lambda p: p[0], reverse=reverse)
+    print(l[:8], l[-8:])
+
+# Already ordered, reversed and partly ordered data.
+for l in (
+    list(range(1000)),
+    list(range(1000, 0, -1)),
+    list(range(500)) + list(range(500, 0, -1)),
+    [i % 10 for i in range(1000)],
+    [(i * 7919) % 1009 for i in range(1000)],
+):
+    s = l[:]
+    s.sort()
+    print(s == sorted(l), all(s[i] <= s[i + 1] for i in range(len(s) - 1)))
+    s.sort(reverse=True)
+    print(all(s[i] >= s[i + 1] for i in range(len(s) - 1)))
+
+# The key function is called once per element.
+calls = 0
+
+
+def key(x):
+    global calls
+    calls += 1
+    return -x
+
+
+l = [(i * 37) % 101 for i in range(300)]
+l.sort(key=key)
+print(calls, l[:5])
+
+
+# A comparison that raises leaves every element in the list.
+class Item:
+    def __init__(self, value):
+        self.value = value
+
+    def __lt__(self, other):
+        global budget
+        budget -= 1
+        if budget == 0:
+            raise ValueError
+        return self.value < other.value
+
+
+items = [Item((i * 13) % 97) for i in range(400)]
+before = sorted(id(x) for x in items)
+for budget in (50, 700, 2000):
+    try:
+        items.sort()
+    except ValueError:
+        print("ValueError")
+    print(sorted(id(x) for x in items) == before)
@@ -0,0 +1,22 @@
+# test interning many distinct strings, as names and as dict keys
+
+class A:
+    pass
+
+
+a = A()
+n = 1500
+for i in range(n):
+    setattr(a, "attr_%d" % i, i)
+print(all(getattr(a, "attr_%d" % i) == i for i in range(n)))
+print(len([k for k in dir(a) if k.startswith("attr_")]))
+
+# names that differ only slightly, and ones that collide in length
+ns = {}
+for i in range(300):
+    exec("v%d = %d" % (i, i), ns)
+    exec("w%03d = -%d" % (i, i), ns)
+print(sum(ns["v%d" % i] for i in range(300)), sum(ns["w%03d" % i] for i in range(300)))
+
+# existing names are still found
+print(getattr(a, "__class__") is A, hasattr(a, "attr_1499"), hasattr(a, "attr_1500"))
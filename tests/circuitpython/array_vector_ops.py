@@ -0,0 +1,54 @@
+# test elementwise arithmetic functions in the array module
+try:
+    import array
+
+    array.dot
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+a = array.array("h", [1, 2, 3, 30000, -30000])
+array.add(a, 5000)
+print(a)
+array.mul(a, 0.5)
+print(a)
+b = array.array("i", [10, 20, 30, 40, 50])
+array.add(a, b)
+print(a, array.sum(a), array.min(a), array.max(a), array.dot(a, b))
+f = array.array("f", [0] * 5)
+array.convert(f, a)
+print(f)
+array.mul(f, 1.5)
+u = bytearray(5)
+array.convert(u, f)
+print(u)
+m = memoryview(b)[1:4]
+array.mul(m, 2)
+print(b, array.sum(memoryview(b)[::1]))
+try:
+    array.add(a, array.array("h", [1]))
+except ValueError as e:
+    print(e)
+try:
+    array.min(array.array("d"))
+except ValueError as e:
+    print(e)
+try:
+    array.add(b"abc", 1)
+except TypeError as e:
+    print("TypeError")
+print(array.sum(b"\xff\xff"), array.dot(array.array("d", [0.5, 2]), b"\x02\x04"))
+
+# integer results are clipped to the typecode
+a = array.array("b", [100, -100, 5])
+array.mul(a, 2)
+print(a)
+a = array.array("B", [10, 200])
+array.add(a, -50)
+print(a)
+q = array.array("q", [1 << 40, -(1 << 40)])
+array.add(q, 1)
+print(q, array.sum(q))
+d = array.array("d", [1.5, -2.5, 4.0])
+array.add(d, array.array("b", [1, 1, 1]))
+print(d, array.min(d), array.max(d))
@@ -0,0 +1,64 @@
+import array
+import audiocore
+import audiomixer
+
+
+def collect(sample):
+    audiocore.reset_buffer(sample)
+    data = []
+    while True:
+        result, buf = audiocore.get_buffer(sample)
+        data.extend(buf)
+        if result != 1:
+            return data
+
+
+ramp_data = array.array("h", [i * 1000 for i in range(-16, 16)])
+ramp = audiocore.RawSample(ramp_data, sample_rate=8000)
+
+# Same rate and format passes the samples through.
+r = audiocore.Resampler(ramp, sample_rate=8000, buffer_size=16)
+print(r.sample_rate, r.bits_per_sample, r.channel_count, r.sample is ramp)
+print(collect(r) == list(ramp_data))
+
+# Doubling the rate interpolates halfway between samples.
+r = audiocore.Resampler(ramp, sample_rate=16000, buffer_size=32)
+out = collect(r)
+print(len(out), out[:6], out[-4:])
+
+# Halving it drops every other sample.
+r = audiocore.Resampler(ramp, sample_rate=4000)
+print(collect(r))
+
+# Each reset starts over.
+print(collect(r))
+
+# Mono to stereo, unsigned 8 bit.
+r = audiocore.Resampler(ramp, sample_rate=8000, channel_count=2, bits_per_sample=8, samples_signed=False, buffer_size=20)
+print(audiocore.get_structure(r))
+print(collect(r)[:8])
+
+# Stereo to mono from unsigned 8 bit.
+st = audiocore.RawSample(array.array("B", [0, 255, 128, 128, 64, 192, 255, 255]), channel_count=2, sample_rate=11025)
+r = audiocore.Resampler(st, sample_rate=11025, channel_count=1)
+print(r.channel_count, collect(r))
+
+# The polyphase filter overshoots a step a little where linear interpolation doesn't.
+step = audiocore.RawSample(array.array("h", [0] * 8 + [16000] * 8 + [0] * 8), sample_rate=11025)
+for polyphase in (False, True):
+    r = audiocore.Resampler(step, sample_rate=44100, polyphase=polyphase)
+    out = collect(r)
+    print(len(out), min(out), max(out), out[36:40], out[60:68])
+
+# A resampled voice mixes with one at the mixer's rate.
+a = audiocore.RawSample(array.array("h", [1000, -1000, 3000, -3000] * 8), sample_rate=16000)
+b = audiocore.RawSample(array.array("h", [100, 200] * 16), sample_rate=8000)
+mixer = audiomixer.Mixer(voice_count=2, sample_rate=8000, channel_count=1, buffer_size=32)
+mixer.voice[0].play(audiocore.Resampler(a, sample_rate=8000), loop=True)
+mixer.voice[1].play(b, loop=True)
+print(list(audiocore.get_buffer(mixer)[1]))
+
+try:
+    audiocore.Resampler(ramp, sample_rate=8000, bits_per_sample=12)
+except ValueError as e:
+    print(e)
@@ -0,0 +1,67 @@
+import os
+import struct
+
+try:
+    import audiocore
+
+    os.VfsFat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMFS:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        buf[:] = self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)]
+        return 0
+
+    def writeblocks(self, n, buf):
+        self.data[n * self.SEC_SIZE : n * self.SEC_SIZE + len(buf)] = buf
+        return 0
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+bdev = RAMFS(64)
+os.VfsFat.mkfs(bdev)
+vfs = os.VfsFat(bdev)
+
+samples = bytes(i * 7 % 256 for i in range(3000))
+with vfs.open("/test.wav", "wb") as f:
+    f.write(b"RIFF")
+    f.write(struct.pack("<I", 36 + len(samples)))
+    f.write(b"WAVEfmt ")
+    f.write(struct.pack("<IHHIIHH", 16, 1, 1, 8000, 8000, 1, 8))
+    f.write(b"data")
+    f.write(struct.pack("<I", len(samples)))
+    f.write(samples)
+
+
+def play(wav):
+    audiocore.reset_buffer(wav)
+    data = b""
+    lengths = []
+    while True:
+        result, buf = audiocore.get_buffer(wav)
+        data += buf
+        lengths.append(len(buf))
+        if result != 1:
+            break
+    return result, data, lengths
+
+
+for buffer in (None, bytearray(100), bytearray(1024), bytearray(4096)):
+    f = vfs.open("/test.wav", "rb")
+    wav = audiocore.WaveFile(f) if buffer is None else audiocore.WaveFile(f, buffer)
+    for _ in range(2):
+        result, data, lengths = play(wav)
+        print(result, data == samples, max(lengths), wav.underruns)
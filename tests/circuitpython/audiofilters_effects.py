@@ -0,0 +1,71 @@
+import array
+import audiocore
+import audiofilters
+import synthio
+
+
+def collect(sample):
+    audiocore.reset_buffer(sample)
+    data = []
+    while True:
+        result, buf = audiocore.get_buffer(sample)
+        data.extend(buf)
+        if result != 1:
+            return data
+
+
+impulse = audiocore.RawSample(array.array("h", [16000] + [0] * 31), sample_rate=8000)
+
+# A delay of 10 frames at 8kHz, each echo half the one before.
+echo = audiofilters.Echo(impulse, max_delay=0.01, delay=0.00125, decay=0.5, buffer_size=16)
+print(echo.sample is impulse, echo.delay, echo.decay)
+out = collect(echo)
+print(len(out), [(i, v) for i, v in enumerate(out) if v])
+
+# Chained effects and unsigned 8 bit stereo pass through in the same format.
+u8 = audiocore.RawSample(array.array("B", [128, 255, 0, 128] * 4), channel_count=2, sample_rate=8000)
+clip = audiofilters.SoftClip(u8, drive=1.0)
+print(audiocore.get_structure(clip), collect(clip)[:4])
+clip.drive = 4
+print(collect(clip)[:4])
+chain = audiofilters.Echo(audiofilters.SoftClip(u8), delay=0.0005)
+print(collect(chain))
+
+# Soft clipping keeps quiet samples and rounds off loud ones.
+levels = audiocore.RawSample(array.array("h", [1000, -1000, 16000, -16000, 30000, -32768, 0, 0]), sample_rate=8000)
+print(collect(audiofilters.SoftClip(levels)))
+print(collect(audiofilters.SoftClip(levels, drive=4)))
+
+# A low pass filter smooths a square wave, starting from silence again when replayed.
+synth = synthio.Synthesizer(sample_rate=8000)
+square = audiocore.RawSample(array.array("h", [10000] * 4 + [-10000] * 4), sample_rate=8000)
+lpf = audiofilters.Filter(square, filter=synth.low_pass_filter(1000))
+print(collect(lpf))
+print(collect(lpf))
+lpf.filter = None
+print(lpf.filter, collect(lpf))
+
+# The compressor turns down a loud tone and leaves a quiet one alone.
+loud = audiocore.RawSample(array.array("h", [30000, -30000] * 256), sample_rate=8000)
+comp = audiofilters.Compressor(loud, threshold=0.25, ratio=4, attack_time=0, release_time=0.1)
+out = collect(comp)
+print(comp.gain, out[:2], out[-2:])
+quiet = audiocore.RawSample(array.array("h", [3000, -3000] * 64), sample_rate=8000)
+comp = audiofilters.Compressor(quiet, threshold=0.25)
+out = collect(comp)
+print(comp.gain, out[:2], out[-2:])
+
+for kwargs in ({"decay": 2}, {"delay": -1}):
+    try:
+        audiofilters.Echo(impulse, **kwargs)
+    except ValueError as e:
+        print(e)
+try:
+    audiofilters.Filter(impulse, filter=3)
+except TypeError as e:
+    print(e)
+echo.deinit()
+try:
+    echo.delay
+except ValueError as e:
+    print(e)
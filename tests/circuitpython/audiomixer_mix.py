@@ -0,0 +1,40 @@
+import array
+import audiocore
+import audiomixer
+
+
+def dump(mixer):
+    print(list(audiocore.get_buffer(mixer)[1][:12]))
+
+
+a = audiocore.RawSample(array.array("h", [1000, -1000, 30000, -30000] * 16), sample_rate=8000)
+b = audiocore.RawSample(array.array("h", [500, 500, 10000, -10000] * 16), sample_rate=8000)
+mixer = audiomixer.Mixer(voice_count=2, sample_rate=8000, channel_count=1, buffer_size=64)
+dump(mixer)
+
+mixer.voice[0].play(a, loop=True)
+dump(mixer)
+
+mixer.voice[1].play(b, loop=True)
+dump(mixer)
+
+mixer.voice[0].level = 0.5
+dump(mixer)
+
+mixer.voice[1].level = 0.25
+dump(mixer)
+
+u = audiocore.RawSample(array.array("H", [32768, 33768, 31768, 65535] * 16), sample_rate=8000)
+mixer = audiomixer.Mixer(voice_count=1, sample_rate=8000, channel_count=1, buffer_size=64, samples_signed=False)
+mixer.voice[0].play(u, loop=True)
+dump(mixer)
+mixer.voice[0].level = 0.5
+dump(mixer)
+
+c = audiocore.RawSample(array.array("b", [10, -10, 100, -100] * 16), sample_rate=8000)
+mixer = audiomixer.Mixer(voice_count=2, sample_rate=8000, channel_count=1, buffer_size=64, bits_per_sample=8)
+mixer.voice[0].play(c, loop=True)
+mixer.voice[1].play(c, loop=True)
+dump(mixer)
+mixer.voice[1].level = 0.5
+dump(mixer)
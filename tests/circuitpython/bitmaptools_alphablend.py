@@ -0,0 +1,66 @@
+# Exercise bitmaptools.alphablend across colorspaces, blend modes, skips and masks.
+import bitmaptools
+import displayio
+
+Colorspace = displayio.Colorspace
+
+
+def pattern(bitmap, seed):
+    mask = (1 << bitmap.bits_per_value) - 1
+    for y in range(bitmap.height):
+        for x in range(bitmap.width):
+            bitmap[x, y] = (x * 2731 + y * 1237 + seed * 40503) & mask
+
+
+def row(bitmap, y=0):
+    return [bitmap[x, y] for x in range(bitmap.width)]
+
+
+for colorspace, bits in (
+    (Colorspace.L8, 8),
+    (Colorspace.RGB565, 16),
+    (Colorspace.RGB565_SWAPPED, 16),
+):
+    print(colorspace)
+    s1 = displayio.Bitmap(6, 2, 1 << bits)
+    s2 = displayio.Bitmap(6, 2, 1 << bits)
+    dest = displayio.Bitmap(6, 2, 1 << bits)
+    pattern(s1, 1)
+    pattern(s2, 2)
+
+    # The extremes reproduce one source exactly.
+    bitmaptools.alphablend(dest, s1, s2, colorspace, 1.0, 0.0)
+    print(row(dest, 1) == row(s1, 1))
+    bitmaptools.alphablend(dest, s1, s2, colorspace, 0.0, 1.0)
+    print(row(dest, 1) == row(s2, 1))
+
+    for factor1, factor2 in ((0.5, None), (0.25, 0.75), (0.75, 0.5), (2.0, -1.0)):
+        bitmaptools.alphablend(dest, s1, s2, colorspace, factor1, factor2)
+        print(row(dest))
+    bitmaptools.alphablend(dest, s1, s2, colorspace, 0.5, 0.5, blendmode=bitmaptools.BlendMode.Screen)
+    print(row(dest))
+    bitmaptools.alphablend(dest, s1, s2, colorspace, 0.0, 0.0)
+    print(row(dest))
+
+    bitmaptools.alphablend(
+        dest, s1, s2, colorspace, 0.5, skip_source1_index=s1[1, 0], skip_source2_index=s2[2, 0]
+    )
+    print(row(dest))
+
+    # A mask takes source 1 where it is 0 and blends normally where it is full.
+    for mask_bits in (1, 8):
+        mask = displayio.Bitmap(6, 2, 1 << mask_bits)
+        for x in range(6):
+            mask[x, 0] = ((1 << mask_bits) - 1) * (x % 3) // 2
+        bitmaptools.alphablend(dest, s1, s2, colorspace, 1.0, 1.0, alpha_mask=mask)
+        print(row(dest))
+        print(dest[0, 0] == s1[0, 0], dest[2, 0] == s2[2, 0])
+
+try:
+    bitmaptools.alphablend(dest, s1, s2, colorspace, alpha_mask=displayio.Bitmap(5, 2, 2))
+except ValueError as e:
+    print(e)
+try:
+    bitmaptools.alphablend(dest, s1, s2, colorspace, alpha_mask=displayio.Bitmap(6, 2, 65536))
+except ValueError as e:
+    print(e)
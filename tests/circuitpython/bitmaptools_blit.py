@@ -0,0 +1,64 @@
+# Exercise bitmaptools.blit and fill_region across depths, clipping, skips and
+# blits of a bitmap into itself.
+import bitmaptools
+import displayio
+
+
+def checksum(bitmap):
+    total = 0
+    for y in range(bitmap.height):
+        for x in range(bitmap.width):
+            total = (total * 31 + bitmap[x, y] + 1) & 0xFFFFFF
+    return total
+
+
+def pattern(bitmap, seed):
+    mask = (1 << bitmap.bits_per_value) - 1
+    for y in range(bitmap.height):
+        for x in range(bitmap.width):
+            bitmap[x, y] = (x * 7 + y * 13 + seed) & mask
+
+
+for bits in (1, 2, 4, 8, 16):
+    mask = (1 << bits) - 1
+    source = displayio.Bitmap(37, 11, 1 << bits)
+    pattern(source, 3)
+
+    dest = displayio.Bitmap(41, 13, 1 << bits)
+    pattern(dest, 5)
+    bitmaptools.blit(dest, source, 2, 1)
+    bitmaptools.blit(dest, source, 0, 0, x1=4, y1=2, x2=30, y2=10)
+    bitmaptools.blit(dest, source, 30, 8, x1=1, y1=1, x2=20, y2=9)
+    # The source area may extend past the source, which reads as 0.
+    bitmaptools.blit(dest, source, 1, 1, x1=30, y1=5, x2=40, y2=13)
+    print(bits, "blit", checksum(dest))
+
+    pattern(dest, 5)
+    bitmaptools.blit(dest, source, 3, 2, skip_source_index=1 & mask)
+    bitmaptools.blit(dest, source, 1, 0, x1=5, y1=1, x2=36, y2=10, skip_dest_index=mask)
+    bitmaptools.blit(
+        dest, source, 0, 4, x1=0, y1=0, x2=36, y2=7, skip_source_index=0, skip_dest_index=2 & mask
+    )
+    print(bits, "skip", checksum(dest))
+
+    pattern(dest, 5)
+    bitmaptools.blit(dest, dest, 3, 2, x1=0, y1=0, x2=35, y2=10)
+    bitmaptools.blit(dest, dest, 0, 0, x1=4, y1=3, x2=41, y2=13)
+    bitmaptools.blit(dest, dest, 9, 0, x1=0, y1=0, x2=32, y2=13)
+    print(bits, "self", checksum(dest))
+
+    pattern(dest, 5)
+    bitmaptools.fill_region(dest, 0, 0, 41, 1, 1 & mask)
+    bitmaptools.fill_region(dest, 3, 2, 38, 9, 2 & mask)
+    bitmaptools.fill_region(dest, 5, 4, 6, 12, mask)
+    bitmaptools.fill_region(dest, 17, 5, 41, 13, 3 & mask)
+    print(bits, "fill", checksum(dest))
+
+# Smaller values into a deeper bitmap.
+source = displayio.Bitmap(19, 7, 16)
+pattern(source, 1)
+dest = displayio.Bitmap(23, 9, 65536)
+pattern(dest, 2)
+bitmaptools.blit(dest, source, 2, 1)
+bitmaptools.blit(dest, source, 11, 3, skip_source_index=3)
+print("mixed", checksum(dest))
@@ -0,0 +1,90 @@
+# Compare bitmaptools.boundary_fill against a simple flood fill.
+import bitmaptools
+import displayio
+
+
+def reference_fill(bitmap, x, y, fill, replaced):
+    if replaced is None:
+        replaced = bitmap[x, y]
+    if fill == replaced:
+        return
+    todo = [(x, y)]
+    while todo:
+        x, y = todo.pop()
+        if bitmap[x, y] != replaced:
+            continue
+        bitmap[x, y] = fill
+        if x > 0:
+            todo.append((x - 1, y))
+        if x + 1 < bitmap.width:
+            todo.append((x + 1, y))
+        if y > 0:
+            todo.append((x, y - 1))
+        if y + 1 < bitmap.height:
+            todo.append((x, y + 1))
+
+
+def copy(bitmap):
+    result = displayio.Bitmap(bitmap.width, bitmap.height, 4)
+    for y in range(bitmap.height):
+        for x in range(bitmap.width):
+            result[x, y] = bitmap[x, y]
+    return result
+
+
+def same(a, b):
+    for y in range(a.height):
+        for x in range(a.width):
+            if a[x, y] != b[x, y]:
+                return False
+    return True
+
+
+seed = 1
+
+
+def rand(n):
+    global seed
+    seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+    return (seed >> 8) % n
+
+
+def check(bitmap, x, y, fill, replaced=None):
+    expected = copy(bitmap)
+    reference_fill(expected, x, y, fill, replaced)
+    if replaced is None:
+        bitmaptools.boundary_fill(bitmap, x, y, fill)
+    else:
+        bitmaptools.boundary_fill(bitmap, x, y, fill, replaced)
+    return same(bitmap, expected)
+
+
+# Random blobs, filled from several places.
+results = []
+for size in ((1, 1), (7, 5), (23, 17), (40, 31)):
+    for trial in range(4):
+        bitmap = displayio.Bitmap(size[0], size[1], 4)
+        for y in range(bitmap.height):
+            for x in range(bitmap.width):
+                bitmap[x, y] = rand(4) // 3
+        x = rand(bitmap.width)
+        y = rand(bitmap.height)
+        results.append(check(bitmap, x, y, 2 + trial % 2))
+        results.append(check(bitmap, 0, 0, 3, bitmap[0, 0]))
+print(results)
+
+# A comb with many teeth opening in both directions needs more pending spans
+# than fit in the fill's buffers.
+bitmap = displayio.Bitmap(250, 120, 4)
+for x in range(1, 250, 2):
+    for y in range(1, 119):
+        bitmap[x, y] = 1
+    bitmap[x, 0 if x % 4 == 1 else 119] = 1
+for x in range(0, 250, 8):
+    bitmap[x, rand(120)] = 1
+print(check(bitmap, 0, 0, 2))
+
+# Filling with the color already there does nothing.
+bitmap = displayio.Bitmap(4, 4, 4)
+bitmaptools.boundary_fill(bitmap, 1, 1, 0)
+print(bitmap[1, 1], bitmap[3, 3])
@@ -0,0 +1,105 @@
+# Compare bitmaptools.dither with straightforward versions of each algorithm.
+import bitmaptools
+import displayio
+
+Colorspace = displayio.Colorspace
+DitherAlgorithm = bitmaptools.DitherAlgorithm
+
+
+def div(a, b):
+    # C division, which truncates towards zero.
+    q = abs(a) // b
+    return q if a >= 0 else -q
+
+
+BAYER = (
+    (0, 32, 8, 40, 2, 34, 10, 42),
+    (48, 16, 56, 24, 50, 18, 58, 26),
+    (12, 44, 4, 36, 14, 46, 6, 38),
+    (60, 28, 52, 20, 62, 30, 54, 22),
+    (3, 35, 11, 43, 1, 33, 9, 41),
+    (51, 19, 59, 27, 49, 17, 57, 25),
+    (15, 47, 7, 39, 13, 45, 5, 37),
+    (63, 31, 55, 23, 61, 29, 53, 21),
+)
+
+ATKINSON = ((1, 0, 1), (2, 0, 1), (-1, 1, 1), (0, 1, 1), (1, 1, 1), (0, 2, 1))
+FLOYD_STEINBERG = ((1, 0, 7), (-1, 1, 3), (0, 1, 5), (1, 1, 1))
+
+
+def reference(luma, width, height, algorithm):
+    out = [[0] * width for _ in range(height)]
+    if algorithm is DitherAlgorithm.Ordered:
+        for y in range(height):
+            for x in range(width):
+                out[y][x] = int(luma[y][x] > BAYER[y % 8][x % 8] * 4 + 2)
+        return out
+    # Padding soaks up the error that falls off either end of a row.
+    error = [[0] * (width + 4) for _ in range(height + 2)]
+    for y in range(height):
+        xs = range(width) if y % 2 == 0 else range(width - 1, -1, -1)
+        d = 1 if y % 2 == 0 else -1
+        for x in xs:
+            pixel = luma[y][x] + error[y][x + 2]
+            out[y][x] = int(pixel >= 128)
+            if out[y][x]:
+                pixel -= 255
+            if algorithm is DitherAlgorithm.Atkinson:
+                shares = [(dx, dy, div(pixel, 8)) for dx, dy, _ in ATKINSON]
+            else:
+                s3 = div(pixel * 3, 16)
+                s5 = div(pixel * 5, 16)
+                s1 = div(pixel, 16)
+                shares = [(1, 0, pixel - s3 - s5 - s1), (-1, 1, s3), (0, 1, s5), (1, 1, s1)]
+            for dx, dy, share in shares:
+                error[y + dy][x + dx * d + 2] += share
+    return out
+
+
+def luma565(pixel):
+    r = (pixel >> 8) & 0xF8
+    g = (pixel >> 3) & 0xFC
+    b = (pixel << 3) & 0xF8
+    return (r * 78 + g * 154 + b * 29) // 256
+
+
+width, height = 45, 11
+l8 = displayio.Bitmap(width, height, 256)
+rgb = displayio.Bitmap(width, height, 65536)
+luma = []
+for y in range(height):
+    row = []
+    for x in range(width):
+        l8[x, y] = (x * 255 // (width - 1) + y * 37) % 256
+        rgb[x, y] = (x * 1456 + y * 9001) & 0xFFFF
+        row.append(l8[x, y])
+    luma.append(row)
+rgb_luma = [[luma565(rgb[x, y]) for x in range(width)] for y in range(height)]
+
+for algorithm in (DitherAlgorithm.Atkinson, DitherAlgorithm.FloydStenberg, DitherAlgorithm.Ordered):
+    results = []
+    for source, colorspace, expected_luma in (
+        (l8, Colorspace.L8, luma),
+        (rgb, Colorspace.RGB565, rgb_luma),
+    ):
+        expected = reference(expected_luma, width, height, algorithm)
+        for bits in (1, 16):
+            dest = displayio.Bitmap(width, height, 1 << bits)
+            bitmaptools.dither(dest, source, colorspace, algorithm)
+            white = (1 << bits) - 1
+            ok = True
+            for y in range(height):
+                for x in range(width):
+                    if dest[x, y] != expected[y][x] * white:
+                        ok = False
+            results.append(ok)
+    print(algorithm, results)
+
+# Flat gray comes out about half white with every algorithm.
+gray = displayio.Bitmap(64, 16, 256)
+gray.fill(128)
+for algorithm in (DitherAlgorithm.Atkinson, DitherAlgorithm.FloydStenberg, DitherAlgorithm.Ordered):
+    dest = displayio.Bitmap(64, 16, 2)
+    bitmaptools.dither(dest, gray, Colorspace.L8, algorithm)
+    count = sum(dest[x, y] for y in range(16) for x in range(64))
+    print(480 <= count <= 544)
@@ -0,0 +1,61 @@
+# Check bitmaptools.readinto against a direct decoding of every layout.
+import io
+import bitmaptools
+import displayio
+
+
+def expected_value(data, rowsize, x, y, bits, element_size, reverse_pixels, swap):
+    row = bytearray(data[y * rowsize : (y + 1) * rowsize])
+    if swap and bits != 24:
+        for i in range(0, rowsize, element_size):
+            row[i : i + element_size] = bytes(reversed(row[i : i + element_size]))
+    if bits < 8:
+        per_byte = 8 // bits
+        shift = x % per_byte
+        if reverse_pixels:
+            shift = per_byte - 1 - shift
+        return (row[x // per_byte] >> (shift * bits)) & ((1 << bits) - 1)
+    if bits == 24:
+        return row[x * 3] << 16 | row[x * 3 + 1] << 8 | row[x * 3 + 2]
+    size = bits // 8
+    return int.from_bytes(row[x * size : (x + 1) * size], "little")
+
+
+def check(width, height, bits, value_bits, element_size, reverse_pixels, swap, reverse_rows):
+    elements = (width * bits + element_size * 8 - 1) // (element_size * 8)
+    rowsize = elements * element_size
+    data = bytes((i * 73 + 41) & 0xFF for i in range(rowsize * height))
+    bitmap = displayio.Bitmap(width, height, 1 << value_bits)
+    bitmaptools.readinto(bitmap, io.BytesIO(data), bits, element_size, reverse_pixels, swap, reverse_rows)
+    mask = (1 << value_bits) - 1
+    for y in range(height):
+        file_y = height - 1 - y if reverse_rows else y
+        for x in range(width):
+            value = expected_value(data, rowsize, x, file_y, bits, element_size, reverse_pixels, swap)
+            if bitmap[x, y] != value & mask:
+                return False
+    return True
+
+
+for bits in (1, 2, 4, 8, 16):
+    results = []
+    for width in (5, 16, 37):
+        for element_size in (1, 2, 4):
+            for flags in range(8):
+                results.append(
+                    check(width, 3, bits, bits, element_size, flags & 1, flags & 2, flags & 4)
+                )
+    print(bits, all(results), len(results))
+
+# Files with other depths than the bitmap go pixel by pixel.
+print(check(13, 4, 4, 8, 1, False, False, False))
+print(check(13, 4, 8, 4, 2, True, True, True))
+print(check(13, 4, 24, 16, 1, False, False, True))
+print(check(13, 4, 32, 16, 4, False, True, False))
+
+# Short files raise EOFError.
+bitmap = displayio.Bitmap(16, 4, 256)
+try:
+    bitmaptools.readinto(bitmap, io.BytesIO(bytes(63)), 8)
+except EOFError:
+    print("EOFError")
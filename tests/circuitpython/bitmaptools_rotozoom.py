@@ -0,0 +1,42 @@
+# Rotate and scale a bitmap with and without clipping and a skip index.
+import bitmaptools
+import displayio
+
+
+def checksum(bitmap):
+    total = 0
+    for y in range(bitmap.height):
+        for x in range(bitmap.width):
+            total = (total * 31 + bitmap[x, y] + 1) & 0xFFFFFF
+    return total
+
+
+source = displayio.Bitmap(23, 17, 256)
+for y in range(source.height):
+    for x in range(source.width):
+        source[x, y] = (x * 5 + y * 11) & 255
+
+for case in range(12):
+    dest = displayio.Bitmap(40, 36, 256)
+    dest.fill(7)
+    kwargs = {}
+    if case % 3 == 0:
+        kwargs["source_clip0"] = (2, 3)
+        kwargs["source_clip1"] = (20, 15)
+    if case % 4 == 1:
+        kwargs["skip_index"] = 0
+    if case % 5 == 2:
+        kwargs["dest_clip0"] = (5, 4)
+        kwargs["dest_clip1"] = (33, 30)
+    bitmaptools.rotozoom(
+        dest,
+        source,
+        ox=(case * 11) % 40,
+        oy=(case * 7) % 36,
+        px=case % 23,
+        py=case % 17,
+        angle=case * 0.61 - 3,
+        scale=0.5 + (case % 4) * 0.5,
+        **kwargs
+    )
+    print(case, checksum(dest))
@@ -0,0 +1,126 @@
+# Render displayio scenes into a RGB565 bitmap and check the pixels, including
+# that incremental renders of the dirty areas match a full render.
+import displayio
+import vectorio
+
+W, H = 48, 32
+
+
+def checksum(bitmap):
+    total = 0
+    for y in range(bitmap.height):
+        for x in range(bitmap.width):
+            total = (total * 31 + bitmap[x, y] + 1) & 0xFFFFFF
+    return total
+
+
+def pattern(bitmap, seed):
+    mask = (1 << bitmap.bits_per_value) - 1
+    for y in range(bitmap.height):
+        for x in range(bitmap.width):
+            bitmap[x, y] = (x * 7 + y * 13 + seed) & mask
+
+
+def check(name, group, fb):
+    rendered = displayio._render(group, fb)
+    incremental = checksum(fb)
+    displayio._render(group, fb, True)
+    full = checksum(fb)
+    print(name, rendered > 0, incremental == full, full)
+
+
+palette = displayio.Palette(4)
+palette[0] = 0x000000
+palette[1] = 0xFF0000
+palette[2] = 0x00FF00
+palette[3] = 0x0000FF
+palette.make_transparent(0)
+
+background = displayio.Bitmap(W, H, 1)
+background_palette = displayio.Palette(1)
+background_palette[0] = 0x203040
+
+tiles = displayio.Bitmap(16, 8, 4)
+pattern(tiles, 1)
+
+fb = displayio.Bitmap(W, H, 65536)
+root = displayio.Group()
+root.append(displayio.TileGrid(background, pixel_shader=background_palette))
+print("empty", displayio._render(root, fb), hex(fb[0, 0]), hex(fb[W - 1, H - 1]))
+
+grid = displayio.TileGrid(
+    tiles, pixel_shader=palette, width=3, height=2, tile_width=8, tile_height=8, x=3, y=5
+)
+grid[0, 0] = 1
+grid[2, 1] = 1
+root.append(grid)
+check("tilegrid", root, fb)
+print(hex(fb[3, 5]), hex(fb[4, 5]))
+
+# Nothing changed, so nothing is drawn.
+print("idle", displayio._render(root, fb))
+
+grid.x = 11
+grid.flip_x = True
+check("moved", root, fb)
+
+scaled = displayio.Group(scale=2, x=1, y=1)
+scaled.append(displayio.TileGrid(tiles, pixel_shader=palette, width=1, height=1, tile_width=8, tile_height=8))
+root.append(scaled)
+check("scaled", root, fb)
+
+scaled.hidden = True
+check("hidden", root, fb)
+
+converter = displayio.ColorConverter()
+rgb = displayio.Bitmap(6, 6, 65536)
+pattern(rgb, 3)
+root.append(displayio.TileGrid(rgb, pixel_shader=converter, x=40, y=24))
+check("converter", root, fb)
+
+root.append(vectorio.Circle(pixel_shader=palette, radius=6, x=24, y=16, color_index=3))
+root.append(vectorio.Rectangle(pixel_shader=palette, width=10, height=4, x=2, y=26, color_index=2))
+polygon = vectorio.Polygon(pixel_shader=palette, points=[(0, 0), (9, 2), (3, 8)], x=36, y=2, color_index=1)
+root.append(polygon)
+check("vectorio", root, fb)
+
+polygon.x = 30
+palette[3] = 0xFFFF00
+check("changed", root, fb)
+
+# Many small children, reordered and removed.
+sprites = displayio.Group()
+for i in range(30):
+    sprites.append(
+        displayio.TileGrid(
+            tiles,
+            pixel_shader=palette,
+            width=1,
+            height=1,
+            tile_width=4,
+            tile_height=4,
+            x=(i * 11) % 44,
+            y=(i * 7) % 28,
+        )
+    )
+sprites[5][0] = 3
+root.append(sprites)
+check("sprites", root, fb)
+
+sprites.sort(key=lambda sprite: sprite.y)
+check("sorted", root, fb)
+
+sprites.pop(3)
+sprites[0].x = 20
+check("popped", root, fb)
+
+# Dirty areas and the bitmap are clipped to one another.
+clipped = displayio.Group(x=-5, y=3)
+clipped.append(displayio.TileGrid(tiles, pixel_shader=palette, width=3, height=2, tile_width=8, tile_height=8))
+clipped.append(vectorio.Circle(pixel_shader=palette, radius=6, x=20, y=6, color_index=3))
+check("clipped", clipped, displayio.Bitmap(20, 10, 65536))
+
+try:
+    displayio._render(root, displayio.Bitmap(4, 4, 256))
+except ValueError as e:
+    print("ValueError", e)
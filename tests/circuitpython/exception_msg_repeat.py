@@ -0,0 +1,38 @@
+# test exceptions raised repeatedly by the runtime with the same message
+
+
+def check(f):
+    msgs = []
+    excs = []
+    for i in range(3):
+        try:
+            f()
+        except Exception as e:
+            excs.append(e)
+            msgs.append(str(e))
+    print(type(excs[0]).__name__, msgs[0], all(m == msgs[0] for m in msgs))
+    # the message is still correct after being used as a str
+    print(excs[0].args, excs[1].args == excs[2].args)
+    print(repr(excs[2]))
+    print(msgs[0] == excs[1].args[0], hash(excs[0].args[0]) == hash(msgs[0]))
+
+
+check(lambda: [].pop())
+check(lambda: {}.popitem())
+check(lambda: int("x"))
+
+# a different message from the same place in between
+for f in (lambda: [].pop(), lambda: {}.popitem(), lambda: [].pop()):
+    try:
+        f()
+    except Exception as e:
+        print(e)
+
+# many different messages pushing others out
+errs = [lambda: [].pop(), lambda: {}.popitem(), lambda: set().pop(), lambda: [].remove(1)]
+for _ in range(3):
+    for f in errs:
+        try:
+            f()
+        except Exception as e:
+            print(type(e).__name__, e)
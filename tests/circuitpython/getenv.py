@@ -89,3 +89,10 @@ run_test(f"noeol", b"noeol=3")
 
 for content in content_bad:
     run_test("key", content)
+
+# More keys than the index holds, and a value rewritten in place
+content_many = b"".join(b"many%d = %d\n" % (i, i) for i in range(40))
+run_test("many0", content_many)
+run_test("many39", content_many)
+run_test("many40", content_many)
+run_test("many39", content_many.replace(b"= 39", b"= 93"))
@@ -0,0 +1,46 @@
+import io
+import json
+
+doc = """{
+  "timezone": "UTC",
+  "daily": [
+    {"dt": 1, "temp": {"min": 1.5, "max": 9}, "weather": [{"id": 800, "main": "Clear"}]},
+    {"dt": 2, "temp": {"min": -2, "max": 4}, "text": "a \\"quoted\\" ] } string"},
+    {"dt": 3, "temp": {"min": 0, "max": 7}, "flags": [true, false, null]}
+  ],
+  "current": {"temp": 3.25}
+}"""
+
+print(json.select(doc, ["timezone"]))
+print(json.select(doc, ["daily", "*", "temp"]))
+print(json.select(doc, ["daily", "*", "temp", "max"]))
+print(json.select(doc, ["daily", 1, "dt"]))
+print(json.select(doc, ["daily", 0, "weather", 0, "main"]))
+print(json.select(doc, ["*", "temp"]))
+print(json.select(doc, ["daily", 5]))
+print(json.select(doc, ["timezone", "x"]))
+print(json.select(doc, [])[0] == json.loads(doc))
+
+# Streams and objects with readinto() work like json.load().
+print(json.select(io.StringIO(doc), ["current"]))
+print(json.select(io.BytesIO(doc.encode()), ["daily", 2, "flags"]))
+
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+
+    def readinto(self, buf):
+        n = min(len(buf), len(self.data))
+        buf[:n] = self.data[:n]
+        self.data = self.data[n:]
+        return n
+
+
+print(json.select(Reader(doc.encode()), ["daily", "*", "dt"]))
+
+for bad in ('{"a": [1, 2', '{"a": "x', '{1: 2}'):
+    try:
+        json.select(bad, ["a", "*"])
+    except ValueError as e:
+        print("ValueError", e)
@@ -0,0 +1,44 @@
+import struct
+
+s = struct.Struct("<hB2xI3s")
+print(s.format, s.size, s.size == struct.calcsize(s.format))
+
+data = s.pack(-2, 7, 0x12345678, b"ab")
+print(data)
+print(data == struct.pack(s.format, -2, 7, 0x12345678, b"ab"))
+print(s.unpack(data))
+
+buf = bytearray(3 + s.size)
+s.pack_into(buf, 3, 1, 2, 3, b"xyz")
+print(buf)
+print(s.unpack_from(buf, 3))
+print(s.unpack_from(buf, -s.size))
+
+# Native alignment matches the module level functions.
+n = struct.Struct("BHBI")
+print(n.size == struct.calcsize("BHBI"))
+print(n.unpack(n.pack(1, 2, 3, 4)))
+
+# Values are written into an existing list.
+items = [None] * 4
+s.unpack_from_into(items, buf, 3)
+print(items)
+
+records = b"".join(struct.pack("<HH", i, i * i) for i in range(4))
+for r in struct.Struct("<2H").iter_unpack(records):
+    print(r)
+
+
+def check(f):
+    try:
+        f()
+    except Exception as e:
+        print(type(e).__name__)
+
+
+check(lambda: s.pack(1, 2, 3))
+check(lambda: s.unpack(data + b"\0"))
+check(lambda: s.unpack_from(buf, 4))
+check(lambda: s.unpack_from_into([None] * 3, buf, 3))
+check(lambda: s.unpack_from_into((None,) * 4, buf, 3))
+check(lambda: struct.Struct("<HH").iter_unpack(b"\0" * 5))
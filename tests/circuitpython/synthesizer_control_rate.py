@@ -0,0 +1,53 @@
+from synthio import Synthesizer, Note, LFO
+from audiocore import get_buffer
+
+s = Synthesizer(sample_rate=8000)
+print(s.control_rate)
+lfo = LFO(rate=10)
+s.blocks.append(lfo)
+
+
+def blocks(n):
+    for _ in range(n):
+        result, buf = get_buffer(s)
+        print(s.frame, len(buf), "%.2f %.2f" % (lfo.value, lfo.phase))
+
+
+# By default the blocks are updated once per block of output
+blocks(2)
+
+# Updates land on the control period, ending blocks early when needed
+s.control_rate = 100
+print(s.control_rate)
+blocks(3)
+
+# Several blocks of output can share one update
+s.control_rate = 20
+print(s.control_rate)
+blocks(4)
+
+s.control_rate = None
+print(s.control_rate)
+blocks(1)
+
+for bad in (0, 8001, "fast"):
+    try:
+        s.control_rate = bad
+    except (ValueError, TypeError) as e:
+        print(type(e).__name__)
+
+# Slow rates keep their whole period at high sample rates
+s = Synthesizer(sample_rate=96000)
+s.control_rate = 1
+print(s.control_rate)
+
+# Loudness ramps from one block to the next instead of stepping
+s = Synthesizer(sample_rate=8000)
+n = Note(1000, amplitude=1)
+s.press(n)
+get_buffer(s)
+n.amplitude = 0.5
+result, buf = get_buffer(s)
+print(max(buf[:8]), max(buf[-8:]))
+result, buf = get_buffer(s)
+print(max(buf[:8]), max(buf[-8:]))
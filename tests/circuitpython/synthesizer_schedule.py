@@ -0,0 +1,47 @@
+from synthio import Synthesizer, Note
+from audiocore import get_buffer
+
+
+def blocks(n):
+    for _ in range(n):
+        result, buf = get_buffer(s)
+        print(s.frame, len(buf), list(buf[:2]), list(buf[-2:]), len(s.pressed))
+
+
+s = Synthesizer(sample_rate=8000)
+print(s.frame)
+blocks(1)
+
+# A press mid-block ends the block early so the note starts on its frame
+n = Note(1000)
+s.schedule(s.frame + 100, press=n)
+s.schedule(s.frame + 300, release=n)
+blocks(4)
+
+# Changes for the same frame are made in order, attributes first
+s.schedule(s.frame + 10, press=(60, 64))
+s.schedule(s.frame + 10, release=60, set=((n, "frequency", 2000),))
+s.schedule(s.frame + 10, press=n)
+blocks(2)
+print(n.frequency)
+
+# A frame that is already past takes effect next block
+s.schedule(s.frame - 1000, release=(64, n))
+blocks(1)
+
+# Bad arguments schedule nothing
+for kw in ({"press": 128}, {"retrigger": (n,)}, {"set": ((64, "frequency", 1),)}):
+    try:
+        s.schedule(s.frame + 10, release=n, **kw)
+    except (ValueError, TypeError) as e:
+        print(type(e).__name__)
+blocks(1)
+
+# The queue has a fixed size
+try:
+    for i in range(100):
+        s.schedule(s.frame + 1000, press=60)
+except RuntimeError as e:
+    print(i, e)
+s.cancel_scheduled()
+blocks(5)
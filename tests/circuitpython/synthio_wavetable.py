@@ -0,0 +1,38 @@
+import array, math
+from synthio import Synthesizer, Note, Wavetable
+from audiocore import get_buffer
+
+saw = array.array("h", [round(32767 * (2 * i / 256 - 1)) for i in range(256)])
+sine = array.array("h", [round(32767 * math.sin(2 * math.pi * i / 100)) for i in range(100)])
+square = array.array("h", [32767] * 50 + [-32767] * 50)
+
+w = Wavetable(saw)
+print(w.frame_count, w.length, w.morph)
+m = Wavetable((sine, square), morph=0.5)
+print(m.frame_count, m.length, m.morph)
+
+
+def render(wave, freq):
+    s = Synthesizer(sample_rate=8000)
+    s.press(Note(freq, waveform=wave))
+    get_buffer(s)
+    result, buf = get_buffer(s)
+    return list(buf)
+
+
+# Higher notes play from tables with fewer harmonics; past nyquist is silent
+for f in (50, 500, 2500, 3900, 4100):
+    b = render(w, f)
+    print(f, max(b), min(b), b[:4])
+
+# Morph is clamped to the available frames
+for mo in (-1, 0, 0.25, 1, 5):
+    m.morph = mo
+    b = render(m, 100)
+    print(mo, max(b), min(b), b[10:13])
+
+for bad in ([], [saw, sine], array.array("h", [0] * 2000), array.array("b", [0] * 8), 3):
+    try:
+        Wavetable(bad)
+    except (ValueError, TypeError) as e:
+        print(type(e).__name__, e)
@@ -0,0 +1,97 @@
+# test zlib.decompressobj
+try:
+    import zlib
+
+    zlib.decompressobj
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+DATA = b"".join(b"line %d\n" % (i * i % 97) for i in range(600))
+# zlib.compress(DATA, 9)
+Z = b"x\xda\xed\x92;\x0e\x021\x0c\x05{N\xc1\x11H\xb2\xf9\xec\x81(\x90V\xdc\xbfD(3HIM\xe9\xca\x8a\xe3\xcf\xb3=\xd7\xeb\xfd\xbc?n\xd7\xd7\xa4i\x8eiN\x9cm\xda\\\xa7-\xbc\x0f\xfe\x1b\xe1\x83\xecB8\xee\xa3O\xdb3~\xa2\x88n\xbcO\xab\x93\xde\x95\xc4\x7f\xc5\x7f\xda]\x91j\xf6\x1f\x7f%\x7f\xd0\x86\xf2\x195\x03\x7f%<\xd3f8\x94\xc3\x90\x97x\x0f\xda7eP\xa7\x90\x9f\xec\x87\x1aT\r\xcat\xcaw\xdfe\xb3[\x9cy\xd6ik\x17\xbb\xaaBU\xaaL\xdb\x14N\xe5\x94N\xed\x16\xdc\x8a[rkc\xdd\xa9;\xfe\xed<m7i\xeb\xcd\xbc\xa17\xf5\xc6\xde\xbcmL\xe4\x95\x18\t\x92\xa8\xb2\xf2&\x7f\xf2X6^\xe5\xf7\\\xe0&9\xc0\x0f\xf0\x03\xfc\x00?\xc0\x0f\xf0\x03\xfc\x00?\xc0\x0f\xf0\x03\xfc\x00?\xc0\x0f\xf0\x03\xfc\x7f\x80\xff\x013g'\xaa"
+
+# all at once
+d = zlib.decompressobj()
+print(d.decompress(Z) == DATA, d.eof, d.unused_data, d.unconsumed_tail)
+
+# a byte at a time, including through the header and trailer
+d = zlib.decompressobj()
+out = b""
+for i in range(len(Z)):
+    out += d.decompress(Z[i : i + 1])
+print(out == DATA, d.eof)
+
+# bounded output
+d = zlib.decompressobj()
+out = d.decompress(Z, 1000)
+print(len(out), len(d.unconsumed_tail) > 0, d.eof)
+while d.unconsumed_tail:
+    part = d.decompress(d.unconsumed_tail, 1000)
+    print(len(part))
+    out += part
+print(out == DATA, d.eof)
+
+d = zlib.decompressobj()
+out = d.decompress(Z, 100) + d.flush()
+print(out == DATA, d.eof)
+
+# into a buffer
+d = zlib.decompressobj()
+buf = bytearray(700)
+out = b""
+data = Z
+while not d.eof:
+    n = d.decompress_into(data, buf)
+    out += buf[:n]
+    data = d.unconsumed_tail
+print(out == DATA)
+
+# data after the end of the stream
+d = zlib.decompressobj()
+print(d.decompress(Z + b"abc") == DATA, d.unused_data)
+print(d.decompress(b"de"), d.unused_data)
+
+# other formats and window sizes
+S = b"abcdefgh" * 40
+for wbits, z in (
+    (-9, b"KLJNIMK\xcfH\x1c\xa5\xc9\xa2\x01"),
+    (9, b"\x18\xd3KLJNIMK\xcfH\x1c\xa5\xc9\xa2\x01\xc2\x12}\xa1"),
+    (0, b"\x18\xd3KLJNIMK\xcfH\x1c\xa5\xc9\xa2\x01\xc2\x12}\xa1"),
+    (25, b"\x1f\x8b\x08\x00\x00\x00\x00\x00\x02\x03KLJNIMK\xcfH\x1c\xa5\xc9\xa2\x01O&\xc2\x97@\x01\x00\x00"),
+):
+    d = zlib.decompressobj(wbits)
+    out = b""
+    for i in range(0, len(z), 3):
+        out += d.decompress(z[i : i + 3])
+    print(wbits, out == S, d.eof)
+
+# caller supplied window
+window = bytearray(512)
+d = zlib.decompressobj(-9, window=window)
+print(d.decompress(b"KLJNIMK\xcfH\x1c\xa5\xc9\xa2\x01") == S)
+try:
+    d = zlib.decompressobj(-10, window=window)
+    d.decompress(b"KL")
+except ValueError:
+    print("ValueError")
+
+# header asks for a larger window than wbits allows
+d = zlib.decompressobj(9)
+try:
+    d.decompress(Z)
+except ValueError:
+    print("ValueError")
+
+for wbits in (7, 16, -16, 40):
+    try:
+        zlib.decompressobj(wbits)
+    except ValueError:
+        print("ValueError")
+
+# corrupt data
+d = zlib.decompressobj()
+try:
+    d.decompress(b"\x78\x9c\xff\xff\xff\xff")
+except ValueError:
+    print("ValueError")
@@ -11,3 +11,7 @@ with open(f"{loc}/data/qr.pgm", "rb") as f:
 decoder = qrio.QRDecoder(320, 240)
 for r in decoder.decode(content):
     print(r)
+
+# locate at half resolution, falling back to the full image around each code
+for r in decoder.decode(content, downscale=2):
+    print(r)
@@ -0,0 +1,99 @@
+# Test reads through the read buffer of FAT files.
+
+try:
+    import os
+
+    os.VfsFat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMFS:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        for i in range(len(buf)):
+            buf[i] = self.data[n * self.SEC_SIZE + i]
+
+    def writeblocks(self, n, buf):
+        for i in range(len(buf)):
+            self.data[n * self.SEC_SIZE + i] = buf[i]
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+try:
+    bdev = RAMFS(50)
+    os.VfsFat.mkfs(bdev)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+vfs = os.VfsFat(bdev)
+os.mount(vfs, "/ramdisk")
+os.chdir("/ramdisk")
+
+lines = ["%d,%s\n" % (i, "x" * (i % 37)) for i in range(200)]
+with open("data.csv", "w") as f:
+    for line in lines:
+        f.write(line)
+data = "".join(lines)
+
+# readline(), iteration and readlines() with several buffer sizes
+for buffering in (-1, 0, 1, 7, 64, 4096):
+    with open("data.csv", "r", buffering) as f:
+        first = f.readline()
+        rest = [line for line in f]
+    with open("data.csv", "r", buffering) as f:
+        all_lines = f.readlines()
+    print(buffering, [first] + rest == lines, all_lines == lines)
+
+# small reads mixed with readline() and large reads
+with open("data.csv", "rb", 16) as f:
+    parts = [f.read(1), f.read(3), f.readline(), f.read(100), f.readline(5), f.read()]
+print(b"".join(parts) == data.encode(), [len(p) for p in parts[:5]])
+with open("data.csv", "rb", 16) as f:
+    print(f.read(0), f.read(2), f.read(1000) == data.encode()[2:1002])
+
+# tell() and seek() within and beyond the buffer
+with open("data.csv", "rb") as f:
+    f.read(10)
+    print(f.tell())
+    f.seek(3)
+    print(f.tell(), f.read(4) == data.encode()[3:7])
+    f.seek(-5, 1)
+    print(f.tell(), f.read(3) == data.encode()[2:5])
+    f.seek(1000)
+    print(f.tell(), f.readline() == data.encode()[1000:].split(b"\n")[0] + b"\n")
+    f.seek(-4, 2)
+    print(f.read() == data.encode()[-4:], f.read())
+
+# writing after buffered reads writes at the position that was read to
+with open("data.csv", "r+b") as f:
+    f.read(2)
+    f.write(b"#")
+    f.seek(0)
+    print(f.read(4))
+
+# readline() with a size limit
+with open("data.csv", "r", 8) as f:
+    f.readline()
+    print(repr(f.readline(3)), repr(f.readline(100)), repr(f.readline(0)))
+
+# reading a closed file
+f = open("data.csv")
+f.close()
+try:
+    f.readline()
+except OSError:
+    print("OSError")
+
+os.umount("/ramdisk")
@@ -0,0 +1,83 @@
+# Test gathered writes and scattered reads on FAT files.
+
+try:
+    import os
+
+    os.VfsFat
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class RAMFS:
+    SEC_SIZE = 512
+
+    def __init__(self, blocks):
+        self.data = bytearray(blocks * self.SEC_SIZE)
+
+    def readblocks(self, n, buf):
+        for i in range(len(buf)):
+            buf[i] = self.data[n * self.SEC_SIZE + i]
+
+    def writeblocks(self, n, buf):
+        for i in range(len(buf)):
+            self.data[n * self.SEC_SIZE + i] = buf[i]
+
+    def ioctl(self, op, arg):
+        if op == 4:  # MP_BLOCKDEV_IOCTL_BLOCK_COUNT
+            return len(self.data) // self.SEC_SIZE
+        if op == 5:  # MP_BLOCKDEV_IOCTL_BLOCK_SIZE
+            return self.SEC_SIZE
+
+
+try:
+    bdev = RAMFS(50)
+    os.VfsFat.mkfs(bdev)
+except MemoryError:
+    print("SKIP")
+    raise SystemExit
+
+vfs = os.VfsFat(bdev)
+os.mount(vfs, "/ramdisk")
+os.chdir("/ramdisk")
+
+header = b"HEAD"
+body = bytearray(range(256)) * 3
+trailer = memoryview(b"--trailer--")[2:-2]
+
+# writev() joins the pieces in order, skipping empty ones
+with open("v.bin", "wb") as f:
+    print(f.writev([header, b"", body, trailer]))
+    print(f.writev(()))
+    # more pieces than are passed down at once
+    print(f.writev([b"%d" % i for i in range(20)]))
+with open("v.bin", "rb") as f:
+    data = f.read()
+expected = header + body + trailer + b"".join(b"%d" % i for i in range(20))
+print(len(data), data == expected)
+
+# writev() after reading drops what was buffered
+with open("v.bin", "r+b", 64) as f:
+    print(f.read(2))
+    f.writev([b"ab", b"cd"])
+    f.seek(0)
+    print(f.read(8))
+
+# readv() fills each buffer in turn and stops at the end of the file
+a = bytearray(4)
+b = bytearray(3 * 256)
+c = bytearray(100)
+with open("v.bin", "rb") as f:
+    data = f.read()
+    f.seek(0)
+    n = f.readv([a, memoryview(b), bytearray(0), c])
+print(n, a, b == data[4 : 4 + len(b)], c[: n - len(a) - len(b)] == data[len(a) + len(b) :])
+
+# writev() needs buffers
+with open("v.bin", "wb") as f:
+    try:
+        f.writev([b"ok", 1])
+    except TypeError:
+        print("TypeError")
+
+os.umount("/ramdisk")
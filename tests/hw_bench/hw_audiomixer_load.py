@@ -0,0 +1,51 @@
+# Run a fixed Python loop while audiomixer mixes four synthio voices to the
+# board's speaker in the background. hw_loop_baseline.py runs the same loop
+# without audio, so the drop in score shows the CPU share that mixing takes.
+# Score is loop iterations per second.
+
+try:
+    import audiomixer
+    import board
+    import synthio
+
+    try:
+        from audioio import AudioOut
+    except ImportError:
+        from audiopwmio import PWMAudioOut as AudioOut
+
+    speaker = board.SPEAKER
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def bm_setup(params):
+    (n,) = params
+    audio = AudioOut(speaker)
+    mixer = audiomixer.Mixer(voice_count=4, sample_rate=22050, channel_count=1)
+    synths = []
+    for i in range(4):
+        synth = synthio.Synthesizer(sample_rate=22050)
+        synth.press(60 + 4 * i)
+        mixer.voice[i].play(synth)
+        synths.append(synth)
+    audio.play(mixer)
+
+    def run():
+        x = 0
+        for i in range(n):
+            x = (x + i) & 0xFFFF
+
+    def result():
+        audio.stop()
+        audio.deinit()
+        return n, None
+
+    return run, result
+
+
+bm_params = {
+    (50, 25): (10000,),
+    (100, 100): (50000,),
+    (1000, 1000): (500000,),
+}
@@ -0,0 +1,30 @@
+# Copy a bitmap into another one with bitmaptools.blit.
+# Score is pixels copied per second.
+
+try:
+    import bitmaptools
+    import displayio
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+
+def bm_setup(params):
+    size, n = params
+    src = displayio.Bitmap(size, size, 65535)
+    dst = displayio.Bitmap(2 * size, 2 * size, 65535)
+    for i in range(size):
+        src[i, i] = i
+
+    def run():
+        for i in range(n):
+            bitmaptools.blit(dst, src, i % size, (i * 7) % size)
+
+    return run, lambda: (n * size * size, None)
+
+
+bm_params = {
+    (50, 25): (32, 20),
+    (100, 100): (64, 40),
+    (1000, 1000): (128, 200),
+}
@@ -0,0 +1,46 @@
+# Refresh the whole built-in display with a full-screen change every frame.
+# Score is frames per second.
+
+try:
+    import board
+    import displayio
+
+    display = board.DISPLAY
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def bm_setup(params):
+    (frames,) = params
+    bitmap = displayio.Bitmap(display.width, display.height, 2)
+    palette = displayio.Palette(2)
+    palette[0] = 0x000000
+    palette[1] = 0xFFFFFF
+    group = displayio.Group()
+    group.append(displayio.TileGrid(bitmap, pixel_shader=palette))
+
+    old_root = display.root_group
+    old_auto_refresh = display.auto_refresh
+    display.auto_refresh = False
+    display.root_group = group
+    display.refresh()
+
+    def run():
+        for i in range(frames):
+            bitmap.fill((i + 1) & 1)
+            display.refresh()
+
+    def result():
+        display.root_group = old_root
+        display.auto_refresh = old_auto_refresh
+        return frames, None
+
+    return run, result
+
+
+bm_params = {
+    (50, 25): (5,),
+    (100, 100): (10,),
+    (1000, 1000): (30,),
+}
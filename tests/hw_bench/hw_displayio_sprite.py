@@ -0,0 +1,53 @@
+# Move a small sprite across the built-in display, refreshing each step.
+# Only the area around the sprite changes. Score is frames per second.
+
+try:
+    import board
+    import displayio
+
+    display = board.DISPLAY
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def bm_setup(params):
+    (frames,) = params
+    background = displayio.Bitmap(display.width, display.height, 1)
+    sprite = displayio.Bitmap(16, 16, 2)
+    sprite.fill(1)
+    palette = displayio.Palette(2)
+    palette[0] = 0x000040
+    palette[1] = 0xFFFF00
+    group = displayio.Group()
+    group.append(displayio.TileGrid(background, pixel_shader=palette))
+    tile = displayio.TileGrid(sprite, pixel_shader=palette)
+    group.append(tile)
+
+    old_root = display.root_group
+    old_auto_refresh = display.auto_refresh
+    display.auto_refresh = False
+    display.root_group = group
+    display.refresh()
+
+    def run():
+        span_x = display.width - 16
+        span_y = display.height - 16
+        for i in range(frames):
+            tile.x = (i * 3) % span_x
+            tile.y = (i * 2) % span_y
+            display.refresh()
+
+    def result():
+        display.root_group = old_root
+        display.auto_refresh = old_auto_refresh
+        return frames, None
+
+    return run, result
+
+
+bm_params = {
+    (50, 25): (20,),
+    (100, 100): (50,),
+    (1000, 1000): (200,),
+}
@@ -0,0 +1,49 @@
+# Write a file and read it back, to the SD card at /sd if one is mounted,
+# otherwise to the root filesystem when it is writable from code.
+# Score is bytes moved per second.
+
+import os
+import sys
+
+if sys.platform in ("linux", "darwin", "win32"):
+    # Only meant for boards; don't write to a host's root directory.
+    print("SKIP")
+    raise SystemExit
+
+for path in ("/sd/bench.bin", "/bench.bin"):
+    try:
+        with open(path, "wb") as f:
+            f.write(b"x")
+        break
+    except OSError:
+        pass
+else:
+    print("SKIP")
+    raise SystemExit
+
+
+def bm_setup(params):
+    chunk_size, n_chunks = params
+    chunk = bytearray(i & 0xFF for i in range(chunk_size))
+    buf = bytearray(chunk_size)
+
+    def run():
+        with open(path, "wb") as f:
+            for _ in range(n_chunks):
+                f.write(chunk)
+        with open(path, "rb") as f:
+            while f.readinto(buf):
+                pass
+
+    def result():
+        os.remove(path)
+        return 2 * chunk_size * n_chunks, None
+
+    return run, result
+
+
+bm_params = {
+    (50, 25): (512, 32),
+    (100, 100): (4096, 32),
+    (1000, 1000): (4096, 256),
+}
@@ -0,0 +1,27 @@
+# Time full collections of a heap holding many small live objects.
+# Time per collection is the pause an application sees. Score is collections
+# per second.
+
+import gc
+
+
+def bm_setup(params):
+    n_objs, n_collect = params
+    live = [(i, [i]) for i in range(n_objs)]
+
+    def run():
+        for _ in range(n_collect):
+            gc.collect()
+
+    def result():
+        live.clear()
+        return n_collect, None
+
+    return run, result
+
+
+bm_params = {
+    (50, 25): (200, 5),
+    (100, 100): (1000, 10),
+    (1000, 1000): (10000, 20),
+}
@@ -0,0 +1,20 @@
+# The loop from hw_audiomixer_load.py with nothing playing.
+# Score is loop iterations per second.
+
+
+def bm_setup(params):
+    (n,) = params
+
+    def run():
+        x = 0
+        for i in range(n):
+            x = (x + i) & 0xFFFF
+
+    return run, lambda: (n, None)
+
+
+bm_params = {
+    (50, 25): (10000,),
+    (100, 100): (50000,),
+    (1000, 1000): (500000,),
+}
@@ -0,0 +1,29 @@
+# test bytearray(n, fast=True), which asks for the items to go in fast memory
+
+try:
+    bytearray(1, fast=True)
+except TypeError:
+    print("SKIP")
+    raise SystemExit
+
+import gc
+
+for fast in (True, False):
+    b = bytearray(10, fast=fast)
+    print(len(b), b == bytes(10))
+
+# Mix large and fast buffers so they land in areas of both kinds.
+keep = []
+for i in range(40):
+    b = bytearray(2000 if i % 2 else 100, fast=(i % 3 == 0))
+    b[0] = i
+    b[-1] = i
+    keep.append(b)
+gc.collect()
+print(all(b[0] == i and b[-1] == i for i, b in enumerate(keep)))
+
+# Other forms don't take the keyword.
+try:
+    bytearray(b"abc", fast=True)
+except TypeError:
+    print("TypeError")
@@ -0,0 +1,39 @@
+# test compiling and running a large source, which may be compiled in groups of statements
+
+try:
+    from micropython import const
+    import io, sys
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+lines = ["from micropython import const", "_K = const(7)", "log = []"]
+for i in range(200):
+    lines.append("def f%d(x):\n    return x + %d + _K\nlog.append(f%d(1))" % (i, i, i))
+lines.append("class C:\n    def m(self):\n        return later()\n")
+lines.append("def later():\n    return 'later'")
+lines.append("big = 12345678901234567890")
+lines.append("s = 'a string'\nb = b'bytes'")
+g = {}
+exec("\n".join(lines) + "\n", g)
+print(len(g["log"]), g["log"][0], g["log"][-1])
+print(g["C"]().m(), g["big"], g["s"], g["b"])
+
+# builtins are found from an empty globals dict
+exec("len\n" * 300, {})
+print("builtins")
+
+# a syntax error at the end means that nothing runs
+g = {}
+try:
+    exec("log = []\n" + "log.append(1)\n" * 500 + "x = (\n", g)
+except SyntaxError:
+    print("SyntaxError", g)
+
+# an error at run time reports the right line
+try:
+    exec("x = 1\n" * 500 + "y = undefined\n", {})
+except NameError as e:
+    buf = io.StringIO()
+    sys.print_exception(e, buf)
+    print("line 501" in buf.getvalue())
@@ -0,0 +1,66 @@
+# test gc.Arena, which serves allocations inside a with block from one run
+
+try:
+    import gc
+
+    gc.Arena
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def parse(i):
+    return {"id": i, "name": "item" + str(i), "values": [i, i * 2, i * 3]}
+
+
+# Objects kept from inside the block must survive its collection.
+kept = []
+for n in range(20):
+    with gc.Arena(2048):
+        for i in range(10):
+            d = parse(n * 10 + i)
+            if i == 0:
+                kept.append(d)
+print(len(kept), all(d["name"] == "item" + str(d["id"]) for d in kept))
+print(kept[3]["id"], kept[3]["values"])
+
+# Allocations larger than the arena fall back to the rest of the heap.
+with gc.Arena(64):
+    big = bytearray(1000)
+    small = [1, 2, 3]
+print(len(big), small)
+
+# Arenas can be nested, and the outer one is served again after the inner one.
+with gc.Arena(512) as outer:
+    a = [1]
+    with gc.Arena(512):
+        b = [2]
+    c = [3]
+print(a, b, c)
+
+# An arena can't be entered twice at once.
+try:
+    with outer:
+        with outer:
+            pass
+except RuntimeError:
+    print("RuntimeError")
+
+# The arena is left when the block raises.
+try:
+    with gc.Arena(256):
+        raise ValueError("inside")
+except ValueError as e:
+    print(e)
+
+try:
+    gc.Arena(0)
+except ValueError:
+    print("ValueError")
+
+# A run that cannot exist in the heap raises MemoryError.
+try:
+    with gc.Arena(1 << 30):
+        pass
+except MemoryError:
+    print("MemoryError")
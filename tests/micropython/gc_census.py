@@ -0,0 +1,73 @@
+# test gc.census, which groups the heap by type and allocation site
+
+try:
+    import gc
+
+    gc.census
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+class Foo:
+    pass
+
+
+def make_foos(n):
+    l = []
+    for _ in range(n):
+        l.append(Foo())
+    return l
+
+
+def make_buffers(n):
+    l = []
+    for _ in range(n):
+        l.append(bytearray(40))
+    return l
+
+
+def summary(census, fun):
+    # Total the counts for each type allocated by fun.
+    out = {}
+    for (type_name, f, offset), (count, n_bytes) in census.items():
+        if f == fun:
+            out[type_name] = out.get(type_name, 0) + count
+    return sorted(out.items(), key=lambda x: str(x[0]))
+
+
+gc.collect()
+before = gc.census()
+foos = make_foos(25)
+buffers = make_buffers(7)
+gc.collect()
+after = gc.census()
+
+print(summary(before, "make_foos"))
+print(summary(after, "make_foos"))
+print(summary(after, "make_buffers"))
+
+# Each entry maps (type name, function, offset) to (count, bytes).
+key, value = next(iter(after.items()))
+print(len(key), type(key[2]), len(value), value[1] >= value[0] > 0)
+
+# Snapshots don't see each other, so an unchanged heap gives the same census.
+gc.collect()
+print(gc.census() == gc.census())
+
+# Once the objects are gone, so are their entries. Empty the list rather than
+# dropping it, so that a stale pointer to it on the C stack can't keep the
+# objects alive.
+foos.clear()
+buffers = None
+gc.collect()
+print([x for x in summary(gc.census(), "make_foos") if x[0] == "Foo"])
+
+# With a limit, the last entry takes whatever didn't fit.
+small = gc.census(2)
+print(len(small) <= 2, (None, None, 0) in small)
+
+try:
+    gc.census(0)
+except ValueError:
+    print("ValueError")
@@ -0,0 +1,52 @@
+# test gc.compact, which moves list and dict storage into free holes
+
+try:
+    import gc
+
+    gc.compact
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+# Interleave lists and dicts with garbage so that freeing it leaves holes.
+gc.collect()
+junk = []
+lists = []
+dicts = []
+for i in range(100):
+    junk.append(bytearray(200))
+    lists.append([i] * 20)
+    junk.append(bytearray(200))
+    dicts.append({j: str(i + j) for j in range(8)})
+del junk
+moved = 0
+for _ in range(4):
+    moved += gc.compact()
+print(moved > 0)
+print(all(l == [i] * 20 for i, l in enumerate(lists)))
+print(all(d == {j: str(i + j) for j in range(8)} for i, d in enumerate(dicts)))
+
+# Objects still work normally after being moved.
+lists[5].append("x")
+dicts[5]["y"] = 1
+print(lists[5][-2:], dicts[5]["y"], len(dicts[5]))
+
+
+# Compacting while a list is being iterated or sorted, which holds on to its
+# storage from C, leaves it intact.
+def key(x):
+    gc.compact()
+    return -x
+
+
+l = list(range(50))
+total = 0
+for x in l:
+    if x % 10 == 0:
+        gc.compact()
+    total += x
+print(total)
+l.sort(key=key)
+print(l[:5], l[-1])
+print(gc.compact() >= 0)
@@ -0,0 +1,26 @@
+# test that finalisers of objects collected by gc_alloc still run and free them
+
+try:
+    import gc, os
+
+    gc.threshold
+    os.VfsPosix
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+# Each file left open holds a descriptor until its finaliser closes it, so
+# running out of descriptors means finalisers were lost.
+def leak_files(n):
+    for i in range(n):
+        f = open(__file__)
+        f.read(1)
+
+
+gc.collect()
+gc.threshold(1024)
+leak_files(25000)
+gc.threshold(-1)
+gc.collect()
+print("ok")
@@ -0,0 +1,34 @@
+# test that objects survive collections whose sweep is finished by later allocations
+
+try:
+    import gc
+
+    gc.threshold
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+# Collect often so that allocations keep landing around an unfinished sweep.
+gc.collect()
+gc.threshold(2048)
+
+keep = []
+for i in range(3000):
+    x = [i, str(i)]
+    if i % 5 == 0:
+        keep.append(x)
+    if i % 40 == 0:
+        # Grow a kept object, possibly in place across the sweep position.
+        keep[-1].extend(range(8))
+    # Some garbage of a few sizes to leave holes.
+    bytearray(i % 100)
+
+gc.threshold(-1)
+gc.collect()
+
+ok = True
+for x in keep:
+    if int(x[1]) != x[0] or (x[0] % 40 == 0 and x[2:] != list(range(8))):
+        ok = False
+print(ok, len(keep))
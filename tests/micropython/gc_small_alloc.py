@@ -0,0 +1,33 @@
+# test that small allocations reuse the holes left by a collection
+
+try:
+    import gc
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+# Fill the heap with small objects, then drop every other one so the next
+# collection leaves lots of 1, 2 and 4 block holes.
+keep = []
+drop = []
+for i in range(200):
+    keep.append([i])
+    drop.append((i, i + 1, i + 2, i + 3, i + 4, i + 5))
+    keep.append(bytearray(i % 40))
+drop = None
+gc.collect()
+
+# Allocate into the holes and check nothing overlaps the objects we kept.
+new = []
+for i in range(400):
+    new.append((i, -i))
+    new.append([i, i])
+
+ok = True
+for i in range(200):
+    if keep[2 * i] != [i] or len(keep[2 * i + 1]) != i % 40:
+        ok = False
+for i in range(400):
+    if new[2 * i] != (i, -i) or new[2 * i + 1] != [i, i]:
+        ok = False
+print(ok)
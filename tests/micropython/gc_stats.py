@@ -0,0 +1,40 @@
+# test gc.stats() allocation and collection totals
+
+try:
+    import gc
+
+    gc.stats
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+keys = (
+    "elapsed_ms",
+    "allocs",
+    "alloc_bytes",
+    "allocs_per_s",
+    "bytes_per_s",
+    "collections",
+    "max_pause_us",
+    "avg_pause_us",
+    "free",
+    "largest_free",
+    "fragmentation",
+)
+
+s = gc.stats(True)
+print(sorted(s) == sorted(keys))
+
+# Restarted totals only count what happens from here on.
+s = gc.stats()
+print(s["collections"], s["max_pause_us"], s["avg_pause_us"])
+
+x = [bytearray(100) for i in range(10)]
+s = gc.stats()
+print(s["allocs"] >= 11, s["alloc_bytes"] >= 1000)
+
+gc.collect()
+gc.collect()
+s = gc.stats()
+print(s["collections"], s["max_pause_us"] >= s["avg_pause_us"])
+print(0 <= s["fragmentation"] <= 100, 0 < s["largest_free"] <= s["free"])
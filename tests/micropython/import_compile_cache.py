@@ -0,0 +1,67 @@
+# test caching the compiled code of imported .py files
+
+try:
+    import os, sys
+    if not hasattr(os, "mkdir"):
+        raise AttributeError
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+CACHE = ".mpycache"
+MOD = "compile_cache_mod"
+
+
+def write(src):
+    with open(MOD + ".py", "w") as f:
+        f.write(src)
+
+
+def load():
+    sys.modules.pop(MOD, None)
+    mod = __import__(MOD)
+    return mod.value, mod.f(2)
+
+
+def cache_files():
+    return [name for name in os.listdir(CACHE) if name.endswith(".mpy")]
+
+
+def cleanup():
+    for name in os.listdir(CACHE):
+        os.remove(CACHE + "/" + name)
+    os.rmdir(CACHE)
+    os.remove(MOD + ".py")
+
+
+sys.path.insert(0, "")
+os.mkdir(CACHE)
+try:
+    write("value = 'first'\ndef f(x):\n    return [x * i for i in range(3)]\n")
+    result = load()
+    if not cache_files():
+        # The cache isn't supported by this build.
+        print("SKIP")
+        raise SystemExit
+    print(result)
+    print(len(cache_files()))
+
+    # Loaded from the cache.
+    print(load())
+
+    # A changed source replaces the cache file.
+    write("value = 'second, longer'\ndef f(x):\n    return x + 1\n")
+    print(load())
+    print(len(cache_files()))
+
+    # So does an edit that keeps the size, even within the mtime resolution.
+    write("value = 'second, LONGER'\ndef f(x):\n    return x + 1\n")
+    print(load())
+
+    # A corrupt cache file is ignored and rewritten.
+    with open(CACHE + "/" + cache_files()[0], "wb") as f:
+        f.write(b"junk")
+    print(load())
+    print(load())
+finally:
+    cleanup()
@@ -0,0 +1,80 @@
+# test that imports see modules created and removed after a failed search
+
+try:
+    import os, sys
+
+    if not hasattr(os, "mkdir"):
+        raise AttributeError
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+MOD = "dir_cache_mod"
+PKG = "dir_cache_pkg"
+
+
+def write(path, src):
+    with open(path, "w") as f:
+        f.write(src)
+
+
+def try_import(name):
+    sys.modules.pop(name, None)
+    try:
+        return __import__(name).value
+    except ImportError:
+        return "ImportError"
+
+
+def remove(path):
+    try:
+        os.remove(path)
+    except OSError:
+        pass
+
+
+sys.path.insert(0, "")
+try:
+    # Missing, then created.
+    print(try_import(MOD))
+    write(MOD + ".py", "value = 1\n")
+    print(try_import(MOD))
+
+    # Renamed away, then back.
+    os.rename(MOD + ".py", MOD + "_old.py")
+    print(try_import(MOD))
+    os.rename(MOD + "_old.py", MOD + ".py")
+    print(try_import(MOD))
+
+    # Removed.
+    os.remove(MOD + ".py")
+    print(try_import(MOD))
+
+    # A package, and a submodule added to it later.
+    print(try_import(PKG))
+    os.mkdir(PKG)
+    write(PKG + "/__init__.py", "value = 'pkg'\n")
+    print(try_import(PKG))
+    sys.modules.pop(PKG + ".sub", None)
+    try:
+        __import__(PKG + ".sub")
+    except ImportError:
+        print("ImportError")
+    write(PKG + "/sub.py", "value = 'sub'\n")
+    sys.modules.pop(PKG, None)
+    print(__import__(PKG + ".sub").sub.value)
+
+    # Removed package.
+    os.remove(PKG + "/sub.py")
+    os.remove(PKG + "/__init__.py")
+    os.rmdir(PKG)
+    print(try_import(PKG))
+finally:
+    remove(MOD + ".py")
+    remove(MOD + "_old.py")
+    remove(PKG + "/sub.py")
+    remove(PKG + "/__init__.py")
+    try:
+        os.rmdir(PKG)
+    except OSError:
+        pass
@@ -0,0 +1,54 @@
+# test importing .mpy files from a filesystem whose files expose the buffer protocol
+
+try:
+    import sys, os
+
+    os.mount
+    # Other builds can't read files that aren't streams.
+    extra_coverage
+except (ImportError, AttributeError, NameError):
+    print("SKIP")
+    raise SystemExit
+
+
+class UserFS:
+    def __init__(self, files):
+        self.files = files
+
+    def mount(self, readonly, mksfs):
+        pass
+
+    def umount(self):
+        pass
+
+    def stat(self, path):
+        if path in self.files:
+            return (32768, 0, 0, 0, 0, 0, 0, 0, 0, 0)
+        raise OSError
+
+    def open(self, path, mode):
+        # The file contents are returned as-is, rather than as a stream.
+        return self.files[path]
+
+
+# fmt: off
+user_files = {
+    "/xm.mpy": (
+        b'C\x06\x00\x1f\x0e\x02\nxm.py\x00\x0f\x02C\x00\x06add\x00\x08name\x00\x0cC.name\x00'
+        b'\x10greeting\x00\x08data\x00\x02a\x00\x02b\x00/-5\x82\x13\x05\x13hello from a buffer\x00'
+        b'\x06\x03\x00\x01\x02\x00\x81l\x10\x08\x01$$D#\x00\x16\x06#\x01\x16\x072\x00\x16\x03T2'
+        b'\x01\x10\x024\x02\x16\x02Qc\x02P\x1a\x08\x03\x08\t`\xb0\xb1\xf2c\x81\x1c\x00\x06\x02h@'
+        b'\x11\n\x16\x0b\x10\x02\x16\x0c2\x00\x16\x04Qc\x01H\t\x08\x04\r``\x10\x05c'
+    ),
+}
+# fmt: on
+
+os.mount(UserFS(user_files), "/userfs")
+sys.path.append("/userfs")
+
+import xm
+
+print(xm.greeting, xm.data, xm.add(2, 3), xm.C().name())
+
+os.umount("/userfs")
+sys.path.pop()
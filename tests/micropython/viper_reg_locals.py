@@ -0,0 +1,71 @@
+# test viper and native functions whose busiest locals are not the first ones,
+# so that registers are given to later locals and arguments
+
+
+@micropython.viper
+def checksum(a, b, c, buf: ptr8, n: int) -> int:
+    # a, b and c are barely used, the loop works on buf, n, i and s
+    s = 0
+    i = 0
+    while i < n:
+        s = (s + buf[i] * (i + 1)) & 0xFFFF
+        i += 1
+    return s + int(a) + int(b) + int(c)
+
+
+print(checksum(1, 2, 3, b"hello world", 11))
+
+
+@micropython.viper
+def nested(x: int, y: int, z: int, w: int, rows: int, cols: int) -> int:
+    total = 0
+    for r in range(rows):
+        for c in range(cols):
+            total += r * cols + c
+    return total + x + y + z + w
+
+
+print(nested(1, 2, 3, 4, 5, 7))
+
+
+@micropython.viper
+def swap(a: int, b: int, c: int, d: int, e: int) -> int:
+    # many assignments between locals that may be in registers or on the stack
+    for i in range(7):
+        t = e
+        e = d
+        d = c
+        c = b
+        b = a
+        a = t
+    return a * 10000 + b * 1000 + c * 100 + d * 10 + e
+
+
+print(swap(1, 2, 3, 4, 5))
+
+
+@micropython.native
+def count(lst, first, second, target):
+    n = 0
+    for x in lst:
+        if x == target:
+            n += 1
+    return n, first, second
+
+
+print(count([1, 2, 3, 2, 2, 5], "a", "b", 2))
+
+
+@micropython.viper
+def unused(a: int, b: int, c: int, d: int) -> int:
+    e = 0
+    f = 0
+    g = 0
+    for i in range(4):
+        e += i
+        f += e
+        g += f
+    return a + b + c + d + e + f + g
+
+
+print(unused(1, 2, 3, 4))
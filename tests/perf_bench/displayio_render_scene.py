@@ -0,0 +1,66 @@
+# Fully render a layered scene of tile grids, a scaled group and vectorio
+# shapes into an RGB565 bitmap. This needs a build with displayio._render,
+# such as the unix coverage build.
+
+try:
+    import displayio
+    import vectorio
+
+    displayio._render
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def bm_setup(params):
+    width, height, frames = params
+    fb = displayio.Bitmap(width, height, 65536)
+    palette = displayio.Palette(4)
+    palette[0] = 0x102030
+    palette[1] = 0xFF0000
+    palette[2] = 0x00FF00
+    palette[3] = 0x0000FF
+
+    tiles = displayio.Bitmap(32, 16, 4)
+    for y in range(16):
+        for x in range(32):
+            tiles[x, y] = (x ^ y) & 3
+    group = displayio.Group()
+    group.append(
+        displayio.TileGrid(
+            tiles,
+            pixel_shader=palette,
+            width=width // 16 + 1,
+            height=height // 16 + 1,
+            tile_width=16,
+            tile_height=16,
+        )
+    )
+    overlay = displayio.Group(scale=2)
+    shadow = displayio.Palette(4)
+    shadow.make_transparent(0)
+    shadow[1] = 0xFFFFFF
+    overlay.append(displayio.TileGrid(tiles, pixel_shader=shadow, width=1, height=1, tile_width=16))
+    group.append(overlay)
+    group.append(vectorio.Circle(pixel_shader=palette, radius=height // 4, x=width // 2, y=height // 2))
+    group.append(
+        vectorio.Polygon(
+            pixel_shader=palette, points=[(0, 0), (width // 3, 4), (8, height // 3)], x=4, y=4
+        )
+    )
+
+    def run():
+        for i in range(frames):
+            displayio._render(group, fb, True)
+
+    def result():
+        return frames, None
+
+    return run, result
+
+
+bm_params = {
+    (50, 25): (64, 48, 2),
+    (100, 100): (128, 96, 10),
+    (1000, 1000): (320, 240, 40),
+}
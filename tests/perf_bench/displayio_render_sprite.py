@@ -0,0 +1,47 @@
+# Move a sprite over a full-screen background and render only the dirty areas
+# into an RGB565 bitmap, the way a display refresh would. This needs a build
+# with displayio._render, such as the unix coverage build.
+
+try:
+    import displayio
+
+    displayio._render
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+
+def bm_setup(params):
+    width, height, frames = params
+    fb = displayio.Bitmap(width, height, 65536)
+    background = displayio.Bitmap(width, height, 1)
+    sprite = displayio.Bitmap(16, 16, 2)
+    sprite.fill(1)
+    palette = displayio.Palette(2)
+    palette[0] = 0x000040
+    palette[1] = 0xFFFF00
+    group = displayio.Group()
+    group.append(displayio.TileGrid(background, pixel_shader=palette))
+    tile = displayio.TileGrid(sprite, pixel_shader=palette)
+    group.append(tile)
+    displayio._render(group, fb)
+
+    def run():
+        span_x = width - 16
+        span_y = height - 16
+        for i in range(frames):
+            tile.x = (i * 3) % span_x
+            tile.y = (i * 2) % span_y
+            displayio._render(group, fb)
+
+    def result():
+        return frames, None
+
+    return run, result
+
+
+bm_params = {
+    (50, 25): (64, 48, 10),
+    (100, 100): (128, 96, 50),
+    (1000, 1000): (320, 240, 500),
+}
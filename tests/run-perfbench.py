@@ -8,6 +8,7 @@ import os
 import subprocess
 import sys
 import argparse
+import json
 from glob import glob
 
 sys.path.append("../tools")
@@ -89,7 +90,7 @@ def run_benchmark_on_target(target, script):
         return -1, -1, "CRASH: %r" % err
 
 
-def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
+def run_benchmarks(args, target, param_n, param_m, n_average, test_list, results):
     skip_complex = run_feature_test(target, "complex") != "complex"
     skip_native = run_feature_test(target, "native_check") != "native"
     target_had_error = False
@@ -106,6 +107,7 @@ def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
         )
         if skip:
             print("SKIP")
+            results[test_file] = {"error": "SKIP"}
             continue
 
         # Create test script
@@ -126,6 +128,7 @@ def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
             crash, test_script_target = prepare_script_for_target(args, script_text=test_script)
             if crash:
                 print("CRASH:", test_script_target)
+                results[test_file] = {"error": "CRASH"}
                 continue
         else:
             test_script_target = test_script
@@ -165,6 +168,7 @@ def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
             if not error.startswith("SKIP"):
                 target_had_error = True
             print(error)
+            results[test_file] = {"error": error}
         else:
             t_avg, t_sd = compute_stats(times)
             s_avg, s_sd = compute_stats(scores)
@@ -173,6 +177,12 @@ def run_benchmarks(args, target, param_n, param_m, n_average, test_list):
                     t_avg, 100 * t_sd / t_avg, s_avg, 100 * s_sd / s_avg
                 )
             )
+            results[test_file] = {
+                "time_us": t_avg,
+                "time_sd_pct": 100 * t_sd / t_avg,
+                "score": s_avg,
+                "score_sd_pct": 100 * s_sd / s_avg,
+            }
             if 0:
                 print("  times: ", times)
                 print("  scores:", scores)
@@ -264,6 +274,12 @@ def main():
     cmd_parser.add_argument("--heapsize", help="heapsize to use (use default if not specified)")
     cmd_parser.add_argument("--via-mpy", action="store_true", help="compile code to .mpy first")
     cmd_parser.add_argument("--mpy-cross-flags", default="", help="flags to pass to mpy-cross")
+    cmd_parser.add_argument(
+        "--bench-dir",
+        default=BENCH_SCRIPT_DIR,
+        help="directory of benchmarks to run when no files are given (e.g. hw_bench/)",
+    )
+    cmd_parser.add_argument("--json", help="also write the results to this file as JSON")
     cmd_parser.add_argument(
         "N", nargs=1, help="N parameter (approximate target CPU frequency in MHz)"
     )
@@ -297,9 +313,10 @@ def main():
         if M <= 25:
             # These scripts are too big to be compiled by the target
             tests_skip += ("bm_chaos.py", "bm_hexiom.py", "misc_raytrace.py")
+        bench_dir = os.path.join(args.bench_dir, "")
         tests = sorted(
-            BENCH_SCRIPT_DIR + test_file
-            for test_file in os.listdir(BENCH_SCRIPT_DIR)
+            bench_dir + test_file
+            for test_file in os.listdir(bench_dir)
             if test_file.endswith(".py") and test_file not in tests_skip
         )
     else:
@@ -307,7 +324,30 @@ def main():
 
     print("N={} M={} n_average={}".format(N, M, n_average))
 
-    target_had_error = run_benchmarks(args, target, N, M, n_average, tests)
+    results = {}
+    target_had_error = run_benchmarks(args, target, N, M, n_average, tests, results)
+
+    if args.json:
+        # Identify the firmware and board so results can be tracked per release and board.
+        version, err = run_script_on_target(
+            target,
+            b"import sys\nprint(sys.version)\n"
+            b"print(getattr(sys.implementation, '_machine', sys.platform))\n",
+        )
+        version = version.splitlines() if err is None else []
+        with open(args.json, "w") as f:
+            json.dump(
+                {
+                    "version": version[0] if len(version) > 0 else None,
+                    "machine": version[1] if len(version) > 1 else None,
+                    "N": N,
+                    "M": M,
+                    "n_average": n_average,
+                    "results": results,
+                },
+                f,
+                indent=2,
+            )
 
     if isinstance(target, pyboard.Pyboard):
         target.exit_raw_repl()
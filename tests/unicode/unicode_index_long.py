@@ -0,0 +1,35 @@
+# Index and slice long non-ASCII and ASCII strings, as loops over them do.
+
+s = "".join("aé中\U0001f600"[i % 4] * (1 + i % 3) for i in range(200))
+chars = list(s)
+n = len(s)
+print(n, len(chars))
+
+# Every index, forwards and backwards, matches iteration.
+print(all(s[i] == chars[i] for i in range(n)))
+print(all(s[-i] == chars[-i] for i in range(1, n + 1)))
+print(all(s[i] == chars[i] for i in range(n - 1, -1, -1)))
+
+# Slices, including ones that run off either end.
+ok = True
+for start in (-n - 5, -n, -70, -1, 0, 1, 31, 32, 33, 100, n - 1, n, n + 5):
+    for stop in (-n - 5, -1, 0, 5, 64, n, n + 5):
+        if s[start:stop] != "".join(chars[start:stop]):
+            ok = False
+print(ok)
+
+for i in (n, -n - 1, 10**6):
+    try:
+        s[i]
+    except IndexError:
+        print("IndexError", i == n)
+
+# Methods that take positions.
+print(s.find("\U0001f600", 100) == "".join(chars).find("\U0001f600", 100))
+print(s.index("中", -30) == n - 30 + chars[-30:].index("中"))
+
+# Switching between strings, including a long ASCII one.
+a = "abcdefghij" * 20
+t = "".join(reversed(chars))
+print(all(a[i % 200] == "abcdefghij"[i % 10] and t[i] == chars[n - 1 - i] for i in range(n)))
+print(a[-1], a[150:155], a[195:300])